@@ -0,0 +1,441 @@
+/*
+ * Benchmark for the user-space build of the normalization code: times the
+ * normalization of several fixed corpora of names, and reports the results in
+ * a format that can be compared against the results of an earlier run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "unicode.h"
+
+/* Number of names in each corpus */
+#define CORPUS_NAMES	2048
+/* Longest name allowed by APFS, in bytes, not counting the NUL */
+#define NAME_MAX_LEN	255
+/* Each name is normalized this many times per sample, to hide clock cost */
+#define SAMPLE_REPEAT	8
+/* Default number of passes over each corpus */
+#define DEFAULT_ROUNDS	20
+
+struct corpus {
+	const char *name;
+	void (*make_name)(char *buf);	/* Write a random name to buf */
+	int stream_safe;		/* Mode for the cursor */
+	char *names[CORPUS_NAMES];
+	int bytes;			/* Total size of the names */
+};
+
+struct result {
+	char label[64];
+	int names;
+	int bytes;
+	double ns_per_byte;
+	double ns_per_name;
+	double p50;
+	double p99;
+};
+
+/* Deterministic random numbers, so that every run uses the same corpora */
+static unsigned long long rand_state = 0x2545f4914f6cdd1dULL;
+
+static unsigned int rand_next(void)
+{
+	rand_state ^= rand_state >> 12;
+	rand_state ^= rand_state << 25;
+	rand_state ^= rand_state >> 27;
+	return (rand_state * 0x2545f4914f6cdd1dULL) >> 32;
+}
+
+static unsigned int rand_range(unsigned int min, unsigned int max)
+{
+	return min + rand_next() % (max - min + 1);
+}
+
+/* Append @c to @buf as UTF-8, unless the name would get too long */
+static char *put_utf8(char *buf, char *end, unicode_t c)
+{
+	u8 utf8[4];
+	int len;
+
+	len = utf32_to_utf8(c, utf8, sizeof(utf8));
+	if (len < 0 || end - buf < len)
+		return buf;
+	memcpy(buf, utf8, len);
+	return buf + len;
+}
+
+static void make_ascii(char *buf)
+{
+	static const char chars[] = "abcdefghijklmnopqrstuvwxyz"
+				    "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789._-";
+	int len = rand_range(4, 40);
+	int i;
+
+	for (i = 0; i < len; ++i)
+		buf[i] = chars[rand_next() % (sizeof(chars) - 1)];
+	buf[len] = 0;
+}
+
+/* Latin text where about a quarter of the letters are accented */
+static void make_latin(char *buf)
+{
+	char *end = buf + NAME_MAX_LEN;
+	int len = rand_range(4, 32);
+
+	while (len--) {
+		unicode_t c;
+
+		if (rand_next() % 4)
+			c = 'a' + rand_next() % 26;
+		else
+			c = rand_range(0xc0, 0x17f);
+		if (c == 0xd7 || c == 0xf7) /* Not letters */
+			c = 'x';
+		buf = put_utf8(buf, end, c);
+	}
+	*buf = 0;
+}
+
+static void make_hangul(char *buf)
+{
+	char *end = buf + NAME_MAX_LEN;
+	int len = rand_range(2, 12);
+
+	while (len--)
+		buf = put_utf8(buf, end, rand_range(0xac00, 0xd7a3));
+	*buf = 0;
+}
+
+static void make_cjk(char *buf)
+{
+	char *end = buf + NAME_MAX_LEN;
+	int len = rand_range(2, 16);
+
+	while (len--)
+		buf = put_utf8(buf, end, rand_range(0x4e00, 0x9fff));
+	*buf = 0;
+}
+
+/* Letters with long stacks of diacritics, Zalgo style, and Hebrew points */
+static void make_combining(char *buf)
+{
+	char *end = buf + NAME_MAX_LEN;
+	int len = rand_range(1, 6);
+
+	while (len--) {
+		int marks = rand_range(3, 20);
+		bool hebrew = rand_next() % 2;
+
+		buf = put_utf8(buf, end, hebrew ? rand_range(0x5d0, 0x5ea) :
+						  'a' + rand_next() % 26);
+		while (marks--) {
+			unicode_t c;
+
+			if (hebrew)
+				c = rand_range(0x5b0, 0x5bd);
+			else
+				c = rand_range(0x300, 0x36f);
+			buf = put_utf8(buf, end, c);
+		}
+	}
+	*buf = 0;
+}
+
+/*
+ * A letter buried under as many marks as fit in a name, the worst case for
+ * the reordering unless the runs of marks are cut short
+ */
+static void make_zalgo(char *buf)
+{
+	char *end = buf + NAME_MAX_LEN;
+
+	buf = put_utf8(buf, end, 'a' + rand_next() % 26);
+	while (end - buf >= 2)
+		buf = put_utf8(buf, end, rand_range(0x300, 0x33f));
+	*buf = 0;
+}
+
+/* Mostly ASCII, with a malformed sequence somewhere in the name */
+static void make_invalid(char *buf)
+{
+	static const char *const bad[] = {
+		"\xff", "\xc0\xaf", "\xe2\x82", "\xed\xa0\x80", "\x80",
+		"\xf4\x90\x80\x80",
+	};
+	char tail[NAME_MAX_LEN + 1];
+	int pos;
+
+	make_ascii(buf);
+	make_ascii(tail);
+	pos = rand_next() % (strlen(buf) + 1);
+	strcpy(buf + pos, bad[rand_next() % (sizeof(bad) / sizeof(bad[0]))]);
+	strcat(buf, tail);
+}
+
+static struct corpus corpora[] = {
+	{.name = "ascii", .make_name = make_ascii},
+	{.name = "latin", .make_name = make_latin},
+	{.name = "hangul", .make_name = make_hangul},
+	{.name = "cjk", .make_name = make_cjk},
+	{.name = "combining", .make_name = make_combining},
+	{.name = "invalid", .make_name = make_invalid},
+	{.name = "zalgo", .make_name = make_zalgo},
+	{.name = "zalgo-safe", .make_name = make_zalgo,
+	 .stream_safe = APFS_STREAM_SAFE},
+	{.name = "zalgo-strict", .make_name = make_zalgo,
+	 .stream_safe = APFS_STREAM_SAFE_STRICT},
+};
+
+#define CORPUS_COUNT	(sizeof(corpora) / sizeof(corpora[0]))
+
+static void corpus_init(struct corpus *corpus)
+{
+	char buf[NAME_MAX_LEN + 1];
+	int i;
+
+	corpus->bytes = 0;
+	for (i = 0; i < CORPUS_NAMES; ++i) {
+		corpus->make_name(buf);
+		corpus->names[i] = strdup(buf);
+		if (!corpus->names[i]) {
+			printf("Memory allocation failure!\n");
+			exit(1);
+		}
+		corpus->bytes += strlen(buf);
+	}
+}
+
+/* Keeps the compiler from optimizing away the normalization */
+static volatile unicode_t sink;
+
+static void normalize_name(const char *name, bool case_fold, int stream_safe)
+{
+	struct apfs_unicursor cursor;
+	unicode_t sum = 0, c;
+
+	apfs_init_unicursor(&cursor, name);
+	apfs_unicursor_stream_safe(&cursor, stream_safe);
+	while ((c = apfs_normalize_next(&cursor, case_fold)))
+		sum += c;
+	sink = sum;
+}
+
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* Time @rounds passes over @corpus, one sample per name and pass */
+static void bench_corpus(struct corpus *corpus, bool case_fold, int rounds,
+			 struct result *result)
+{
+	double *samples, total = 0;
+	int count = rounds * CORPUS_NAMES;
+	int round, i, j;
+
+	samples = malloc(count * sizeof(*samples));
+	if (!samples) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+
+	/* Warm up the caches and the branch predictors first */
+	for (i = 0; i < CORPUS_NAMES; ++i)
+		normalize_name(corpus->names[i], case_fold,
+			       corpus->stream_safe);
+
+	for (round = 0; round < rounds; ++round) {
+		for (i = 0; i < CORPUS_NAMES; ++i) {
+			const char *name = corpus->names[i];
+			double start, sample;
+
+			start = now_ns();
+			for (j = 0; j < SAMPLE_REPEAT; ++j)
+				normalize_name(name, case_fold,
+					       corpus->stream_safe);
+			sample = (now_ns() - start) / SAMPLE_REPEAT;
+
+			samples[round * CORPUS_NAMES + i] = sample;
+			total += sample;
+		}
+	}
+	qsort(samples, count, sizeof(*samples), cmp_double);
+
+	snprintf(result->label, sizeof(result->label), "%s/%s", corpus->name,
+		 case_fold ? "fold" : "nofold");
+	result->names = CORPUS_NAMES;
+	result->bytes = corpus->bytes;
+	result->ns_per_byte = total / rounds / corpus->bytes;
+	result->ns_per_name = total / count;
+	result->p50 = samples[count / 2];
+	result->p99 = samples[count * 99 / 100];
+	free(samples);
+}
+
+#define RESULT_FORMAT	"%-20s %6d %8d %9.3f %9.1f %9.1f %9.1f\n"
+#define HEADER_FORMAT	"# %-18s %6s %8s %9s %9s %9s %9s\n"
+
+static void print_header(FILE *file)
+{
+	fprintf(file, HEADER_FORMAT, "case", "names", "bytes", "ns/byte",
+		"ns/name", "p50", "p99");
+}
+
+static void print_result(FILE *file, struct result *result)
+{
+	fprintf(file, RESULT_FORMAT, result->label, result->names,
+		result->bytes, result->ns_per_byte, result->ns_per_name,
+		result->p50, result->p99);
+}
+
+/* Look for @label in an earlier results file; returns false if not there */
+static bool find_baseline(FILE *file, const char *label,
+			  struct result *result)
+{
+	char line[256];
+
+	if (!file)
+		return false;
+	rewind(file);
+	while (fgets(line, sizeof(line), file)) {
+		if (line[0] == '#')
+			continue;
+		if (sscanf(line, "%63s %d %d %lf %lf %lf %lf", result->label,
+			   &result->names, &result->bytes,
+			   &result->ns_per_byte, &result->ns_per_name,
+			   &result->p50, &result->p99) != 7)
+			continue;
+		if (!strcmp(result->label, label))
+			return true;
+	}
+	return false;
+}
+
+#ifdef APFS_UNICODE_STATS
+/* Print the work counters for a benchmark case, per normalized name */
+static void print_stats(struct apfs_unistats *before,
+			struct apfs_unistats *after, unsigned long names)
+{
+	unsigned long *old = (unsigned long *)before;
+	unsigned long *new = (unsigned long *)after;
+	static const char *const names_of[] = {
+		"next_calls", "next_chars", "ascii_chars", "twobyte_chars",
+		"fills", "decodes", "lookups", "trie_walks",
+	};
+	int fields = sizeof(names_of) / sizeof(names_of[0]);
+	int i;
+
+	printf("  per name:");
+	for (i = 0; i < fields; ++i)
+		printf(" %s=%.2f", names_of[i], (double)(new[i] - old[i]) / names);
+	printf("\n  trie misses by level:");
+	for (i = 0; i < APFS_STATS_LEVELS; ++i)
+		printf(" %lu", after->trie_misses[i] - before->trie_misses[i]);
+	printf("\n  fills by chars scanned (1, 2-3, 4-7, ...):");
+	for (i = 0; i < APFS_STATS_SUBSTR; ++i)
+		printf(" %lu", after->substrings[i] - before->substrings[i]);
+	printf("\n  hash probes: %lu, misses: %lu\n",
+	       after->hash_probes - before->hash_probes,
+	       after->hash_misses - before->hash_misses);
+}
+#endif
+
+static double change(double new, double old)
+{
+	return old ? 100 * (new - old) / old : 0;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-r rounds] [-o output] [-c baseline]\n",
+		prog);
+	exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *out_path = NULL, *base_path = NULL;
+	FILE *out = NULL, *base = NULL;
+	int rounds = DEFAULT_ROUNDS;
+	int opt, i, fold;
+
+	while ((opt = getopt(argc, argv, "r:o:c:")) != -1) {
+		switch (opt) {
+		case 'r':
+			rounds = atoi(optarg);
+			if (rounds <= 0)
+				usage(argv[0]);
+			break;
+		case 'o':
+			out_path = optarg;
+			break;
+		case 'c':
+			base_path = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+
+	if (out_path) {
+		out = fopen(out_path, "w");
+		if (!out) {
+			perror(out_path);
+			exit(1);
+		}
+		print_header(out);
+	}
+	if (base_path)
+		base = fopen(base_path, "r"); /* It's fine if there is none */
+
+	print_header(stdout);
+	for (i = 0; i < CORPUS_COUNT; ++i) {
+		corpus_init(&corpora[i]);
+		for (fold = 0; fold < 2; ++fold) {
+			struct result result, old;
+#ifdef APFS_UNICODE_STATS
+			struct apfs_unistats before, after;
+
+			apfs_get_unistats(&before);
+#endif
+
+			bench_corpus(&corpora[i], fold, rounds, &result);
+			if (out)
+				print_result(out, &result);
+			print_result(stdout, &result);
+			if (find_baseline(base, result.label, &old))
+				printf("%-20s %15s %+8.1f%% %+8.1f%% %+8.1f%% %+8.1f%%\n",
+				       "  vs baseline", "",
+				       change(result.ns_per_byte, old.ns_per_byte),
+				       change(result.ns_per_name, old.ns_per_name),
+				       change(result.p50, old.p50),
+				       change(result.p99, old.p99));
+#ifdef APFS_UNICODE_STATS
+			apfs_get_unistats(&after);
+			print_stats(&before, &after, (unsigned long)CORPUS_NAMES *
+				    (rounds * SAMPLE_REPEAT + 1));
+#endif
+		}
+	}
+
+	if (out)
+		fclose(out);
+	if (base)
+		fclose(base);
+	return 0;
+}
@@ -0,0 +1,276 @@
+/*
+ * Cache of normalized name hashes, for user-space and FUSE consumers of the
+ * normalization code that keep looking up the same few names: build
+ * directories, node_modules, mail spools. Entries are keyed by the raw bytes
+ * of the name, so a hit never has to decode or normalize anything.
+ *
+ * The cache is split into shards, each with its own lock, so that lookups
+ * from different threads rarely contend. Lookups only take the lock for
+ * reading; when a shard is full, the entry to replace is picked with the
+ * CLOCK algorithm, which only needs a reference bit to be set on each hit.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "unicache.h"
+
+struct apfs_unicache_entry {
+	u64 key;		/* Hash of the raw name and the fold flag */
+	int next;		/* Next entry in the same bucket, or -1 */
+	u32 hash;		/* apfs_normalize_hash() of the name */
+	int normlen;		/* Size of the normalized name in UTF-8 */
+	bool referenced;	/* Hit since the clock hand last went by? */
+	bool case_fold;		/* Was the name case folded? */
+	u8 len;			/* Length of the raw name */
+	char name[APFS_UNICACHE_NAME_MAX];
+};
+
+struct apfs_unicache_shard {
+	pthread_rwlock_t lock;
+	struct apfs_unicache_entry *entries;
+	int *buckets;		/* First entry for each bucket, or -1 */
+	int size;		/* Number of entries, and of buckets */
+	int used;		/* Entries filled so far */
+	int hand;		/* Next entry for the clock to look at */
+
+	/*
+	 * Updated atomically, so that hits don't need the write lock. They get
+	 * their own cache line, so that counting a hit doesn't bounce the line
+	 * of the lock between the cpus that hold it for reading.
+	 */
+	unsigned long hits __attribute__((aligned(64)));
+	unsigned long misses;
+	unsigned long evictions;
+	unsigned long uncached;
+} __attribute__((aligned(64)));
+
+struct apfs_unicache {
+	struct apfs_unicache_shard shards[APFS_UNICACHE_SHARDS];
+};
+
+/* FNV-1a hash of the raw name, which selects both the shard and the bucket */
+static u64 apfs_unicache_key(const char *name, int len, bool case_fold)
+{
+	u64 key = 0xcbf29ce484222325ULL;
+	int i;
+
+	for (i = 0; i < len; ++i) {
+		key ^= (u8)name[i];
+		key *= 0x100000001b3ULL;
+	}
+	key ^= case_fold;
+	key *= 0x100000001b3ULL;
+	return key;
+}
+
+/**
+ * apfs_unicache_create - Allocate a cache of normalized names
+ * @size:	maximum number of names in the cache
+ *
+ * The entries are evenly split among the shards, so @size is rounded up to a
+ * multiple of APFS_UNICACHE_SHARDS. Returns the cache, or NULL on failure.
+ */
+struct apfs_unicache *apfs_unicache_create(int size)
+{
+	struct apfs_unicache *cache;
+	int per_shard, i, j;
+
+	if (size <= 0)
+		return NULL;
+	per_shard = (size + APFS_UNICACHE_SHARDS - 1) / APFS_UNICACHE_SHARDS;
+
+	if (posix_memalign((void **)&cache, 64, sizeof(*cache)))
+		return NULL;
+	memset(cache, 0, sizeof(*cache));
+	for (i = 0; i < APFS_UNICACHE_SHARDS; ++i) {
+		struct apfs_unicache_shard *shard = &cache->shards[i];
+
+		shard->size = per_shard;
+		shard->entries = calloc(per_shard, sizeof(*shard->entries));
+		shard->buckets = malloc(per_shard * sizeof(*shard->buckets));
+		if (!shard->entries || !shard->buckets ||
+		    pthread_rwlock_init(&shard->lock, NULL)) {
+			free(shard->entries);
+			free(shard->buckets);
+			while (i--) {
+				shard = &cache->shards[i];
+				pthread_rwlock_destroy(&shard->lock);
+				free(shard->entries);
+				free(shard->buckets);
+			}
+			free(cache);
+			return NULL;
+		}
+		for (j = 0; j < per_shard; ++j)
+			shard->buckets[j] = -1;
+	}
+	return cache;
+}
+
+/**
+ * apfs_unicache_destroy - Free a cache of normalized names
+ * @cache:	the cache, which must no longer be in use
+ */
+void apfs_unicache_destroy(struct apfs_unicache *cache)
+{
+	int i;
+
+	if (!cache)
+		return;
+	for (i = 0; i < APFS_UNICACHE_SHARDS; ++i) {
+		struct apfs_unicache_shard *shard = &cache->shards[i];
+
+		pthread_rwlock_destroy(&shard->lock);
+		free(shard->entries);
+		free(shard->buckets);
+	}
+	free(cache);
+}
+
+/* Find the entry for a name in @shard; the lock must be held. */
+static struct apfs_unicache_entry *
+apfs_unicache_find(struct apfs_unicache_shard *shard, u64 key,
+		   const char *name, int len, bool case_fold)
+{
+	int i = shard->buckets[(key >> 32) % shard->size];
+
+	while (i >= 0) {
+		struct apfs_unicache_entry *entry = &shard->entries[i];
+
+		if (entry->key == key && entry->len == len &&
+		    entry->case_fold == case_fold &&
+		    !memcmp(entry->name, name, len))
+			return entry;
+		i = entry->next;
+	}
+	return NULL;
+}
+
+/*
+ * Pick the entry of @shard that will hold a new name, and take it out of its
+ * bucket if it was in use. The write lock must be held.
+ */
+static struct apfs_unicache_entry *
+apfs_unicache_evict(struct apfs_unicache_shard *shard)
+{
+	struct apfs_unicache_entry *victim;
+	int *link;
+
+	if (shard->used < shard->size)
+		return &shard->entries[shard->used++];
+
+	/* Give a second chance to every entry that was hit recently */
+	while (shard->entries[shard->hand].referenced) {
+		shard->entries[shard->hand].referenced = false;
+		shard->hand = (shard->hand + 1) % shard->size;
+	}
+	victim = &shard->entries[shard->hand];
+	shard->hand = (shard->hand + 1) % shard->size;
+
+	link = &shard->buckets[(victim->key >> 32) % shard->size];
+	while (&shard->entries[*link] != victim)
+		link = &shard->entries[*link].next;
+	*link = victim->next;
+
+	__atomic_fetch_add(&shard->evictions, 1, __ATOMIC_RELAXED);
+	return victim;
+}
+
+/**
+ * apfs_unicache_lookup - Get the normalized hash and size of a name
+ * @cache:	the cache
+ * @name:	UTF-8 name, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the name
+ * @case_fold:	case fold the name?
+ * @hash:	on return, the apfs_normalize_hash() of the name
+ *
+ * On a hit the cached values are returned, without looking at the unicode
+ * data at all; otherwise the name is normalized and added to the cache.
+ * Names that are too long or have invalid UTF-8 are never cached.
+ *
+ * Returns the size of the normalized name in UTF-8, like the return value of
+ * apfs_normalize_string(), or a negative error code if the name has invalid
+ * UTF-8. @hash is set in both cases.
+ */
+int apfs_unicache_lookup(struct apfs_unicache *cache, const char *name,
+			 int len, bool case_fold, u32 *hash)
+{
+	struct apfs_unicache_shard *shard;
+	struct apfs_unicache_entry *entry;
+	int normlen;
+	u64 key;
+
+	len = strnlen(name, len);
+	key = apfs_unicache_key(name, len, case_fold);
+	shard = &cache->shards[key % APFS_UNICACHE_SHARDS];
+
+	if (len <= APFS_UNICACHE_NAME_MAX) {
+		pthread_rwlock_rdlock(&shard->lock);
+		entry = apfs_unicache_find(shard, key, name, len, case_fold);
+		if (entry) {
+			/* Racing hits all store the same value */
+			if (!__atomic_load_n(&entry->referenced,
+					     __ATOMIC_RELAXED))
+				__atomic_store_n(&entry->referenced, true,
+						 __ATOMIC_RELAXED);
+			*hash = entry->hash;
+			normlen = entry->normlen;
+			pthread_rwlock_unlock(&shard->lock);
+			__atomic_fetch_add(&shard->hits, 1, __ATOMIC_RELAXED);
+			return normlen;
+		}
+		pthread_rwlock_unlock(&shard->lock);
+	}
+
+	/* Normalize without holding the lock; it's the slow part */
+	normlen = apfs_normalize_hash_size(name, len, case_fold, hash);
+	if (len > APFS_UNICACHE_NAME_MAX || normlen < 0) {
+		__atomic_fetch_add(&shard->uncached, 1, __ATOMIC_RELAXED);
+		return normlen;
+	}
+	__atomic_fetch_add(&shard->misses, 1, __ATOMIC_RELAXED);
+
+	pthread_rwlock_wrlock(&shard->lock);
+	/* Another thread may have added the same name in the meantime */
+	if (!apfs_unicache_find(shard, key, name, len, case_fold)) {
+		int *bucket = &shard->buckets[(key >> 32) % shard->size];
+
+		entry = apfs_unicache_evict(shard);
+		entry->key = key;
+		entry->hash = *hash;
+		entry->normlen = normlen;
+		entry->referenced = false;
+		entry->case_fold = case_fold;
+		entry->len = len;
+		memcpy(entry->name, name, len);
+		entry->next = *bucket;
+		*bucket = entry - shard->entries;
+	}
+	pthread_rwlock_unlock(&shard->lock);
+	return normlen;
+}
+
+/**
+ * apfs_unicache_get_stats - Read the lookup counters of a cache
+ * @cache:	the cache
+ * @stats:	on return, the totals for all the shards
+ */
+void apfs_unicache_get_stats(struct apfs_unicache *cache,
+			     struct apfs_unicache_stats *stats)
+{
+	int i;
+
+	memset(stats, 0, sizeof(*stats));
+	for (i = 0; i < APFS_UNICACHE_SHARDS; ++i) {
+		struct apfs_unicache_shard *shard = &cache->shards[i];
+
+		stats->hits += __atomic_load_n(&shard->hits, __ATOMIC_RELAXED);
+		stats->misses += __atomic_load_n(&shard->misses,
+						 __ATOMIC_RELAXED);
+		stats->evictions += __atomic_load_n(&shard->evictions,
+						    __ATOMIC_RELAXED);
+		stats->uncached += __atomic_load_n(&shard->uncached,
+						   __ATOMIC_RELAXED);
+	}
+}
@@ -0,0 +1,29 @@
+#ifndef _APFS_UNICACHE_H
+#define _APFS_UNICACHE_H
+
+#include "unicode.h"
+
+/* Longest name that gets cached, the same as the limit for real names */
+#define APFS_UNICACHE_NAME_MAX	255
+
+/* Number of independently locked parts of a cache */
+#define APFS_UNICACHE_SHARDS	16
+
+struct apfs_unicache;
+
+/* Counters for the lookups of a cache, since it was created */
+struct apfs_unicache_stats {
+	unsigned long hits;		/* Lookups answered by the cache */
+	unsigned long misses;		/* Lookups that normalized the name */
+	unsigned long evictions;	/* Entries dropped to make room */
+	unsigned long uncached;		/* Names too long or invalid to cache */
+};
+
+extern struct apfs_unicache *apfs_unicache_create(int size);
+extern void apfs_unicache_destroy(struct apfs_unicache *cache);
+extern int apfs_unicache_lookup(struct apfs_unicache *cache, const char *name,
+				int len, bool case_fold, u32 *hash);
+extern void apfs_unicache_get_stats(struct apfs_unicache *cache,
+				    struct apfs_unicache_stats *stats);
+
+#endif	/* _APFS_UNICACHE_H */
@@ -0,0 +1,6059 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+#include "unicode.h"
+
+#define ENOMEM 1
+#define EINVAL 2
+#define EIO 3
+
+typedef uint16_t u16;
+
+typedef uint32_t __le32;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define cpu_to_le32(x)	((__le32)(x))
+#else
+#define cpu_to_le32(x)	((__le32)__builtin_bswap32(x))
+#endif
+
+#define likely(x)	__builtin_expect(!!(x), 1)
+#define unlikely(x)	__builtin_expect(!!(x), 0)
+#define __aligned(x)	__attribute__((aligned(x)))
+#define prefetch(x)	__builtin_prefetch(x)
+
+#define swap(a, b) \
+	do { typeof(a) __tmp = (a); (a) = (b); (b) = __tmp; } while (0)
+
+#define isascii(c) (((unsigned char)(c))<=0x7f)
+#define tolower(c) (((c) >= 'A' && (c) <= 'Z') ? (c) + 'a' - 'A' : (c))
+
+static inline int fls(unsigned int x)
+{
+	return x ? 32 - __builtin_clz(x) : 0;
+}
+
+#ifdef APFS_UNICODE_STATS
+/* There are no per-cpu variables in user space, so count per thread */
+static __thread struct apfs_unistats apfs_unistats;
+#define APFS_COUNT_ADD(counter, n)	(apfs_unistats.counter += (n))
+
+/* Copy the counters of the calling thread to @stats */
+void apfs_get_unistats(struct apfs_unistats *stats)
+{
+	*stats = apfs_unistats;
+}
+#else
+#define APFS_COUNT_ADD(counter, n)	do {} while (0)
+#endif
+#define APFS_COUNT(counter)		APFS_COUNT_ADD(counter, 1)
+
+static inline void kfree(void *ptr)
+{
+	free(ptr);
+}
+
+#define GFP_KERNEL 0
+
+/* The flags are just ignored */
+static inline void *kmalloc(size_t size, unsigned int flags)
+{
+	return malloc(size);
+}
+
+/* Don't bother protecting against overflow, this is only used once, safely */
+static inline void *kmalloc_array(size_t n, size_t size, unsigned int flags)
+{
+	return kmalloc(n * size, flags);
+}
+
+/*
+ * Replacement for the kernel's crc32c(): the CRC32C of a buffer, starting from
+ * @crc and without a final inversion. The kernel picks the fastest version it
+ * has at runtime; here it's decided at build time.
+ */
+#if defined(__SSE4_2__)
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	const u8 *p = address;
+
+#ifdef __x86_64__
+	for (; length >= 8; length -= 8, p += 8) {
+		uint64_t word;
+
+		memcpy(&word, p, sizeof(word));
+		crc = _mm_crc32_u64(crc, word);
+	}
+#endif
+	for (; length; --length)
+		crc = _mm_crc32_u8(crc, *p++);
+	return crc;
+}
+
+#elif defined(__ARM_FEATURE_CRC32)
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	const u8 *p = address;
+
+	for (; length >= 8; length -= 8, p += 8) {
+		uint64_t word;
+
+		memcpy(&word, p, sizeof(word));
+		crc = __crc32cd(crc, word);
+	}
+	for (; length; --length)
+		crc = __crc32cb(crc, *p++);
+	return crc;
+}
+
+#else /* Slice-by-8 */
+
+#define CRC32C_POLY_LE	0x82f63b78
+
+static u32 crc32c_table[8][256];
+
+/* Filled before main(), so that threads never see a partial table */
+static void __attribute__((constructor)) crc32c_init_table(void)
+{
+	int i, j;
+
+	for (i = 0; i < 256; ++i) {
+		u32 crc = i;
+
+		for (j = 0; j < 8; ++j)
+			crc = (crc >> 1) ^ (crc & 1 ? CRC32C_POLY_LE : 0);
+		crc32c_table[0][i] = crc;
+	}
+	for (i = 0; i < 256; ++i) {
+		for (j = 1; j < 8; ++j)
+			crc32c_table[j][i] = (crc32c_table[j - 1][i] >> 8) ^
+				crc32c_table[0][crc32c_table[j - 1][i] & 0xff];
+	}
+}
+
+static inline u32 crc32c_load_le(const u8 *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (u32)p[3] << 24;
+}
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	u32 (*t)[256] = crc32c_table;
+	const u8 *p = address;
+
+	for (; length >= 8; length -= 8, p += 8) {
+		u32 lo = crc32c_load_le(p) ^ crc;
+		u32 hi = crc32c_load_le(p + 4);
+
+		crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+		      t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+		      t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+		      t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+	}
+	for (; length; --length)
+		crc = t[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+	return crc;
+}
+
+#endif
+
+/*
+ * Sample implementation from Unicode home page.
+ * http://www.stonehand.com/unicode/standard/fss-utf.html
+ */
+struct utf8_table {
+	int     cmask;
+	int     cval;
+	int     shift;
+	long    lmask;
+	long    lval;
+};
+
+static const struct utf8_table utf8_table[] =
+{
+    {0x80,  0x00,   0*6,    0x7F,           0,         /* 1 byte sequence */},
+    {0xE0,  0xC0,   1*6,    0x7FF,          0x80,      /* 2 byte sequence */},
+    {0xF0,  0xE0,   2*6,    0xFFFF,         0x800,     /* 3 byte sequence */},
+    {0xF8,  0xF0,   3*6,    0x1FFFFF,       0x10000,   /* 4 byte sequence */},
+    {0xFC,  0xF8,   4*6,    0x3FFFFFF,      0x200000,  /* 5 byte sequence */},
+    {0xFE,  0xFC,   5*6,    0x7FFFFFFF,     0x4000000, /* 6 byte sequence */},
+    {0,						       /* end of table    */}
+};
+
+#define UNICODE_MAX	0x0010ffff
+#define PLANE_SIZE	0x00010000
+
+#define SURROGATE_MASK	0xfffff800
+#define SURROGATE_PAIR	0x0000d800
+#define SURROGATE_LOW	0x00000400
+#define SURROGATE_BITS	0x000003ff
+
+static int utf8_to_utf32(const u8 *s, int inlen, unicode_t *pu)
+{
+	unsigned long l;
+	int c0, c, nc;
+	const struct utf8_table *t;
+
+	nc = 0;
+	c0 = *s;
+	l = c0;
+	for (t = utf8_table; t->cmask; t++) {
+		nc++;
+		if ((c0 & t->cmask) == t->cval) {
+			l &= t->lmask;
+			if (l < t->lval || l > UNICODE_MAX ||
+					(l & SURROGATE_MASK) == SURROGATE_PAIR)
+				return -1;
+			*pu = (unicode_t) l;
+			return nc;
+		}
+		if (inlen <= nc)
+			return -1;
+		s++;
+		c = (*s ^ 0x80) & 0xFF;
+		if (c & 0xC0)
+			return -1;
+		l = (l << 6) | c;
+	}
+	return -1;
+}
+
+int utf32_to_utf8(unicode_t u, u8 *s, int maxout)
+{
+	unsigned long l;
+	int c, nc;
+	const struct utf8_table *t;
+
+	if (!s)
+		return 0;
+
+	l = u;
+	if (l > UNICODE_MAX || (l & SURROGATE_MASK) == SURROGATE_PAIR)
+		return -1;
+
+	nc = 0;
+	for (t = utf8_table; t->cmask && maxout; t++, maxout--) {
+		nc++;
+		if (l <= t->lmask) {
+			c = t->shift;
+			*s = (u8) (t->cval | (l >> c));
+			while (c > 0) {
+				c -= 6;
+				s++;
+				*s = (u8) (0x80 | ((l >> c) & 0x3F));
+			}
+			return nc;
+		}
+	}
+	return -1;
+}
+/* Key bits for each level of apfs_trie, from the root down */
+#define TRIE_HEIGHT		3
+#define TRIE_LEVEL_BITS		{ 12, 5, 4, }
+#define TRIE_LEVEL_SHIFT	{ 9, 4, 0, }
+
+/* Position of row zero for each level of the trie */
+#define TRIE_LEVEL_BASE		{ 0, 4064, 5552, }
+
+/* The records are found with a perfect hash, not the trie */
+#define APFS_UNIDATA_HASH
+#define HASH_BUCKETS		735
+#define HASH_SLOTS		2940
+
+/*
+ * Normalization data for a single character. The nfd field holds the position
+ * and length of the character's decomposition in apfs_nfd, and nfdcf holds
+ * those of the case folding of its decomposition in apfs_nfdcf; they are zero
+ * if the character maps to itself.
+ */
+struct apfs_unidata {
+	u16 nfd;
+	u16 nfdcf;
+	u8 ccc;
+};
+
+/* The arrays of unicode data are defined at the bottom of the file */
+#ifdef APFS_UNIDATA_HASH
+static const u16 apfs_hash_disp[];
+static const u32 apfs_hash_slots[];
+#else
+static const u16 apfs_trie[];
+#endif
+static const struct apfs_unidata apfs_unidata[];
+static const struct apfs_unidata apfs_unidata_2byte[];
+static const u16 apfs_nfd[];
+static const u16 apfs_nfdcf[];
+static const u32 apfs_value_wide[];
+static const u32 apfs_nfd_esc[];
+static const u32 apfs_nfdcf_esc[];
+static const u8 apfs_qc_planes[];
+static const u8 apfs_qc_blocks[][256];
+static const u32 apfs_qc_leaves[][16];
+
+#ifndef APFS_UNIDATA_HASH
+/*
+ * The shape of the trie is chosen by mktrie, which defines TRIE_HEIGHT and
+ * the key bits, shift and array position for each level, from the root down.
+ * Every node on a level has one child for each possible value of its bits.
+ */
+static const u8 apfs_trie_bits[TRIE_HEIGHT] = TRIE_LEVEL_BITS;
+static const u8 apfs_trie_shift[TRIE_HEIGHT] = TRIE_LEVEL_SHIFT;
+static const int apfs_trie_base[TRIE_HEIGHT] = TRIE_LEVEL_BASE;
+#endif
+
+#ifdef APFS_LOADABLE_TABLES
+/*
+ * In user space the tables may also come from a file built by mktrie, which
+ * is mapped and used in place; see apfs_load_unitables(). The lookups reach
+ * them through apfs_tables, which points to the built-in arrays by default.
+ */
+#define APFS_UNITABLES_MAX_HEIGHT	8
+
+struct apfs_unitables {
+	const u16 *trie;
+	const struct apfs_unidata *unidata;
+	const struct apfs_unidata *unidata_2byte;
+	const u16 *nfd;
+	const u16 *nfdcf;
+	const u32 *value_wide;
+	const u32 *nfd_esc;
+	const u32 *nfdcf_esc;
+	const u8 *qc_planes;
+	const u8 (*qc_blocks)[256];
+	const u32 (*qc_leaves)[16];
+	int trie_height;
+	const u8 *trie_bits;
+	const u8 *trie_shift;
+	const int *trie_base;
+	const u16 *hash_disp;
+	const u32 *hash_slots;
+	u32 hash_buckets;
+	u32 hash_size;
+};
+
+/* Only the lookup method that was selected by mktrie is built in */
+static const struct apfs_unitables apfs_builtin_tables = {
+	.unidata	= apfs_unidata,
+	.unidata_2byte	= apfs_unidata_2byte,
+	.nfd		= apfs_nfd,
+	.nfdcf		= apfs_nfdcf,
+	.value_wide	= apfs_value_wide,
+	.nfd_esc	= apfs_nfd_esc,
+	.nfdcf_esc	= apfs_nfdcf_esc,
+	.qc_planes	= apfs_qc_planes,
+	.qc_blocks	= apfs_qc_blocks,
+	.qc_leaves	= apfs_qc_leaves,
+#ifdef APFS_UNIDATA_HASH
+	.hash_disp	= apfs_hash_disp,
+	.hash_slots	= apfs_hash_slots,
+	.hash_buckets	= HASH_BUCKETS,
+	.hash_size	= HASH_SLOTS,
+#else
+	.trie		= apfs_trie,
+	.trie_height	= TRIE_HEIGHT,
+	.trie_bits	= apfs_trie_bits,
+	.trie_shift	= apfs_trie_shift,
+	.trie_base	= apfs_trie_base,
+#endif
+};
+
+static const struct apfs_unitables *apfs_tables = &apfs_builtin_tables;
+
+#define APFS_TABLE(name)	(apfs_tables->name)
+#define APFS_TRIE_HEIGHT	(apfs_tables->trie_height)
+#define APFS_HASH_BUCKETS	(apfs_tables->hash_buckets)
+#define APFS_HASH_SLOTS		(apfs_tables->hash_size)
+#else
+#define APFS_TABLE(name)	(apfs_##name)
+#define APFS_TRIE_HEIGHT	TRIE_HEIGHT
+#define APFS_HASH_BUCKETS	HASH_BUCKETS
+#define APFS_HASH_SLOTS		HASH_SLOTS
+#endif	/* APFS_LOADABLE_TABLES */
+
+/* A trie value length is stored in the last three bits of its position */
+#define TRIE_POS_SHIFT		3
+#define TRIE_SIZE_MASK		((1 << TRIE_POS_SHIFT) - 1)
+
+/*
+ * Values that are too long or too far into their array for that encoding
+ * have a length of zero. Their position is then an index into the escape
+ * array for the table, which has the length in the low byte of each entry
+ * and the real position above it.
+ */
+#define ESC_POS_SHIFT		8
+#define ESC_SIZE_MASK		((1 << ESC_POS_SHIFT) - 1)
+
+/*
+ * The value arrays have 16-bit entries. Starters from the BMP are stored as
+ * they are, and the other characters as a surrogate code point, which gives
+ * their position in apfs_value_wide.
+ */
+#define VALUE_WIDE_FIRST	0xd800
+#define VALUE_WIDE_COUNT	0x800
+
+/* Each wide value, and each normalized character, has its ccc on top */
+#define VALUE_CCC_SHIFT		24
+#define VALUE_CHAR_MASK		((1 << VALUE_CCC_SHIFT) - 1)
+
+/* Longest normalization of a single character */
+#define APFS_VALUE_MAX_LEN	8
+
+/*
+ * Each slot of the perfect hash holds a character, in its low bits, and the
+ * index of its record above them.
+ */
+#define HASH_KEY_BITS		18
+#define HASH_KEY_MASK		((1 << HASH_KEY_BITS) - 1)
+
+#ifdef APFS_UNIDATA_HASH
+/*
+ * The hash functions must be the same ones that mktrie used to build the
+ * tables. This is an integer hash with full avalanche, so that every key bit
+ * counts.
+ */
+static inline u32 apfs_hash_mix(u32 x)
+{
+	x ^= x >> 16;
+	x *= 0x7feb352d;
+	x ^= x >> 15;
+	x *= 0x846ca68b;
+	x ^= x >> 16;
+	return x;
+}
+
+/* Map a hash to the range [0, @n), without a division */
+static inline u32 apfs_hash_range(u32 hash, u32 n)
+{
+	return ((u64)hash * n) >> 32;
+}
+
+/* Position of the displacement for a hashed key */
+static inline u32 apfs_hash_bucket(u32 hash)
+{
+	return apfs_hash_range(hash, APFS_HASH_BUCKETS);
+}
+
+/* Position of the slot for a hashed key, given its displacement */
+static inline u32 apfs_hash_slot(u32 hash, u16 disp)
+{
+	return apfs_hash_range(apfs_hash_mix(hash + disp), APFS_HASH_SLOTS);
+}
+
+/* Index of the record in slot @entry, if it belongs to @key, or else zero */
+static inline int apfs_hash_index(u32 entry, unicode_t key)
+{
+	if ((entry & HASH_KEY_MASK) != key) {
+		APFS_COUNT(hash_misses);
+		return 0;
+	}
+	return entry >> HASH_KEY_BITS;
+}
+
+/**
+ * apfs_hash_find - Look up the normalization data for a character
+ * @key:	search key (a unicode character)
+ *
+ * Every character with a record, outside the two-byte range, has its own
+ * slot in the perfect hash; the others land on the slot of some other key,
+ * and the check sends them to the first record, which is all zeroes. This
+ * takes two loads before the record, however sparse the data is around @key.
+ */
+static const struct apfs_unidata *apfs_hash_find(unicode_t key)
+{
+	u32 hash = apfs_hash_mix(key);
+	u16 disp = APFS_TABLE(hash_disp)[apfs_hash_bucket(hash)];
+	u32 entry = APFS_TABLE(hash_slots)[apfs_hash_slot(hash, disp)];
+
+	APFS_COUNT(hash_probes);
+	return &APFS_TABLE(unidata)[apfs_hash_index(entry, key)];
+}
+#else
+/**
+ * apfs_trie_find - Look up the normalization data for a character
+ * @key:	search key (a unicode character)
+ *
+ * Returns the data record for @key; the first record is all zeroes, and it's
+ * used for all characters that don't require any changes.
+ */
+static const struct apfs_unidata *apfs_trie_find(unicode_t key)
+{
+	int node = 0;
+	int h;
+
+	APFS_COUNT(trie_walks);
+	for (h = 0; h < APFS_TRIE_HEIGHT; ++h) {
+		int bits = APFS_TABLE(trie_bits)[h];
+		int shift = APFS_TABLE(trie_shift)[h];
+		int child = (key >> shift) & ((1 << bits) - 1);
+		int child_index = APFS_TABLE(trie_base)[h] + (node << bits) +
+				  child;
+
+		node = APFS_TABLE(trie)[child_index];
+		if (node == 0) {
+			APFS_COUNT(trie_misses[h < APFS_STATS_LEVELS ? h :
+					       APFS_STATS_LEVELS - 1]);
+			break;
+		}
+	}
+
+	/* On the last level, the node is the index of the record */
+	return &APFS_TABLE(unidata)[node];
+}
+#endif	/* APFS_UNIDATA_HASH */
+
+/* Characters with a two-byte UTF-8 encoding have their own flat table */
+#define UTF8_2BYTE_FIRST	0x80
+#define UTF8_2BYTE_LAST		0x7ff
+
+/**
+ * apfs_unidata_find - Get the normalization data for a character
+ * @key:	the character
+ *
+ * Most non-ASCII names are written in scripts from the two-byte UTF-8 range,
+ * so those characters skip the trie walk and use a direct table lookup.
+ */
+static inline const struct apfs_unidata *apfs_unidata_find(unicode_t key)
+{
+	APFS_COUNT(lookups);
+	if (key - UTF8_2BYTE_FIRST <= UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST)
+		return &APFS_TABLE(unidata_2byte)[key - UTF8_2BYTE_FIRST];
+#ifdef APFS_UNIDATA_HASH
+	return apfs_hash_find(key);
+#else
+	return apfs_trie_find(key);
+#endif
+}
+
+/* Number of characters that apfs_unicursor_fill() decodes at a time */
+#define APFS_UNICURSOR_BATCH	8
+
+/**
+ * apfs_unidata_find_batch - Look up the normalization data for several keys
+ * @keys:	search keys, none of them in the two-byte range
+ * @count:	number of keys, up to APFS_UNICURSOR_BATCH
+ * @data:	on return, the data record for each key
+ *
+ * Each lookup in the trie is a chain of dependent loads, so when they are
+ * done one after the other, every cache miss waits for the one before it.
+ * Here the walks for all the keys go down the trie together, one level at a
+ * time, so that their misses overlap; the row of the next level, or the
+ * record, is prefetched as soon as its position is known. The perfect hash
+ * is handled the same way: the displacements, then the slots, and then the
+ * records are read for all the keys in turn.
+ */
+#ifdef APFS_UNIDATA_HASH
+static void apfs_unidata_find_batch(const unicode_t *keys, int count,
+				    const struct apfs_unidata **data)
+{
+	u32 hash[APFS_UNICURSOR_BATCH], slot[APFS_UNICURSOR_BATCH];
+	int i;
+
+	APFS_COUNT_ADD(lookups, count);
+	APFS_COUNT_ADD(hash_probes, count);
+	for (i = 0; i < count; ++i) {
+		hash[i] = apfs_hash_mix(keys[i]);
+		prefetch(&APFS_TABLE(hash_disp)[apfs_hash_bucket(hash[i])]);
+	}
+	for (i = 0; i < count; ++i) {
+		u16 disp = APFS_TABLE(hash_disp)[apfs_hash_bucket(hash[i])];
+
+		slot[i] = apfs_hash_slot(hash[i], disp);
+		prefetch(&APFS_TABLE(hash_slots)[slot[i]]);
+	}
+	for (i = 0; i < count; ++i) {
+		u32 entry = APFS_TABLE(hash_slots)[slot[i]];
+
+		data[i] = &APFS_TABLE(unidata)[apfs_hash_index(entry, keys[i])];
+		prefetch(data[i]);
+	}
+}
+#else
+static void apfs_unidata_find_batch(const unicode_t *keys, int count,
+				    const struct apfs_unidata **data)
+{
+	int node[APFS_UNICURSOR_BATCH] = {0};
+	int h, i;
+
+	APFS_COUNT_ADD(lookups, count);
+	APFS_COUNT_ADD(trie_walks, count);
+	for (h = 0; h < APFS_TRIE_HEIGHT; ++h) {
+		int bits = APFS_TABLE(trie_bits)[h];
+		int shift = APFS_TABLE(trie_shift)[h];
+		int base = APFS_TABLE(trie_base)[h];
+		bool last = h == APFS_TRIE_HEIGHT - 1;
+		int next_base = 0, next_bits = 0;
+
+		if (!last) {
+			next_base = APFS_TABLE(trie_base)[h + 1];
+			next_bits = APFS_TABLE(trie_bits)[h + 1];
+		}
+		for (i = 0; i < count; ++i) {
+			int child = (keys[i] >> shift) & ((1 << bits) - 1);
+
+			/* Empty children are never walked, so they stay 0 */
+			if (h && !node[i])
+				continue;
+			node[i] = APFS_TABLE(trie)[base + (node[i] << bits) +
+						   child];
+			if (!node[i])
+				APFS_COUNT(trie_misses[h < APFS_STATS_LEVELS ?
+						h : APFS_STATS_LEVELS - 1]);
+			else if (!last)
+				prefetch(&APFS_TABLE(trie)[next_base +
+						(node[i] << next_bits)]);
+			else
+				prefetch(&APFS_TABLE(unidata)[node[i]]);
+		}
+	}
+
+	/* On the last level, the node is the index of the record */
+	for (i = 0; i < count; ++i)
+		data[i] = &APFS_TABLE(unidata)[node[i]];
+}
+#endif	/* APFS_UNIDATA_HASH */
+
+/**
+ * apfs_init_unicursor_len - Initialize a cursor for a string of known length
+ * @cursor:	cursor to initialize
+ * @utf8str:	string to normalize, not necessarily NUL-terminated
+ * @len:	length of @utf8str; a NUL byte also ends the string
+ *
+ * Names read from disk can be normalized in place this way, without copying
+ * them to a NUL-terminated buffer first.
+ */
+void apfs_init_unicursor_len(struct apfs_unicursor *cursor,
+			     const char *utf8str, int len)
+{
+	cursor->utf8curr = utf8str;
+	cursor->utf8end = utf8str + len;
+	cursor->buf_len = 0;
+	cursor->buf_pos = 0;
+	cursor->more = false;
+	cursor->stream_safe = APFS_STREAM_SAFE_OFF;
+	cursor->nonstarters = 0;
+	cursor->segs = NULL;
+}
+
+/**
+ * apfs_init_unicursor_segs - Initialize a cursor for a segmented string
+ * @cursor:	cursor to initialize
+ * @state:	room for the state of the cursor across segments
+ * @segs:	pieces of the string to normalize, in order
+ * @count:	number of pieces; must be at least one
+ *
+ * For strings that are not contiguous in memory, like a name that crosses
+ * the boundary between two blocks. The segments are read in place, and
+ * @segs and @state must remain valid while the cursor is in use. A NUL byte
+ * in any of them ends the string.
+ *
+ * The few bytes around each boundary get copied to @state, so that a
+ * substring can be decoded across it. A substring longer than that buffer
+ * (which is not possible in a valid name, or in Stream-Safe text) is rejected
+ * like invalid UTF-8 if it crosses a boundary.
+ */
+void apfs_init_unicursor_segs(struct apfs_unicursor *cursor,
+			      struct apfs_unisegs *state,
+			      const struct apfs_unisegment *segs, int count)
+{
+	apfs_init_unicursor_len(cursor, segs->ptr, segs->len);
+	state->next = segs + 1;
+	state->count = count - 1;
+	state->off = 0;
+	cursor->segs = state;
+}
+
+/**
+ * apfs_init_unicursor - Initialize an apfs_unicursor structure
+ * @cursor:	cursor to initialize
+ * @utf8str:	string to normalize
+ */
+void apfs_init_unicursor(struct apfs_unicursor *cursor, const char *utf8str)
+{
+	apfs_init_unicursor_len(cursor, utf8str, strlen(utf8str));
+}
+
+/* Longest run of non-starters allowed by the Stream-Safe Text Format */
+#define STREAM_SAFE_MAX		30
+/* COMBINING GRAPHEME JOINER, the starter that breaks up longer runs */
+#define UNICODE_CGJ		0x034f
+
+/**
+ * apfs_unicursor_stream_safe - Set how a cursor handles long mark sequences
+ * @cursor:	cursor to set, before its first use
+ * @mode:	APFS_STREAM_SAFE to insert a CGJ before a character that would
+ *		make a run of more than 30 non-starters, as in UAX #15, or
+ *		APFS_STREAM_SAFE_STRICT to stop before it as if it were invalid
+ *
+ * The non-starters are counted in the normalized string. Without a limit,
+ * the work to reorder a run of them grows with its length, so a single name
+ * made of thousands of combining marks can keep the cpu busy; in either mode
+ * no substring has more than 30 non-starters. The output of APFS_STREAM_SAFE
+ * is not the plain normalization of such names, so their hashes will not
+ * match those computed by other implementations.
+ */
+void apfs_unicursor_stream_safe(struct apfs_unicursor *cursor, int mode)
+{
+	cursor->stream_safe = mode;
+}
+
+#define HANGUL_S_BASE	0xac00
+#define HANGUL_L_BASE	0x1100
+#define HANGUL_V_BASE	0x1161
+#define HANGUL_T_BASE	0x11a7
+#define HANGUL_L_COUNT	19
+#define HANGUL_V_COUNT	21
+#define HANGUL_T_COUNT	28
+#define HANGUL_N_COUNT	(HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT	(HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+/**
+ * apfs_is_precomposed_hangul - Check if a character is a Hangul syllable
+ * @utf32char:	character to check
+ *
+ * This function was adapted from sample code in section 3.12 of the
+ * Unicode Standard, version 9.0.
+ *
+ * Copyright (C) 1991-2018 Unicode, Inc.  All rights reserved.  Distributed
+ * under the Terms of Use in http://www.unicode.org/copyright.html.
+ */
+static bool apfs_is_precomposed_hangul(unicode_t utf32char)
+{
+	int index;
+
+	index = utf32char - HANGUL_S_BASE;
+	return (index >= 0 && index < HANGUL_S_COUNT);
+}
+
+/**
+ * apfs_decompose_hangul - Decompose a Hangul syllable
+ * @utf32char:	Hangul syllable to decompose
+ * @buf:	on return, the decomposition of @utf32char
+ *
+ * Returns the length of the decomposition.
+ *
+ * This function was adapted from sample code in section 3.12 of the
+ * Unicode Standard, version 9.0.
+ *
+ * Copyright (C) 1991-2018 Unicode, Inc.  All rights reserved.  Distributed
+ * under the Terms of Use in http://www.unicode.org/copyright.html.
+ */
+static int apfs_decompose_hangul(unicode_t utf32char, unicode_t *buf)
+{
+	int index;
+	int t;
+
+	index = utf32char - HANGUL_S_BASE;
+
+	buf[0] = HANGUL_L_BASE + index / HANGUL_N_COUNT;
+	buf[1] = HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+
+	t = HANGUL_T_BASE + index % HANGUL_T_COUNT;
+	if (t == HANGUL_T_BASE)
+		return 2;
+	buf[2] = t;
+	return 3;
+}
+
+/**
+ * apfs_normalize_char - Normalize a unicode character
+ * @utf32char:	character to normalize
+ * @data:	normalization data for @utf32char, or NULL for ASCII and
+ *		Hangul syllables, which have none
+ * @case_fold:	case fold the char?
+ * @norm:	on return, the normalization of @utf32char; there must be room
+ *		for APFS_VALUE_MAX_LEN characters
+ *
+ * Every character of the normalization has its canonical combining class in
+ * the top byte, like the entries of the wide value array.
+ *
+ * Returns the length of the normalization.
+ */
+static int apfs_normalize_char(unicode_t utf32char,
+			       const struct apfs_unidata *data, bool case_fold,
+			       unicode_t *norm)
+{
+	const u16 *values;
+	unsigned int pos, len, i;
+
+	if (!data) {
+		if (apfs_is_precomposed_hangul(utf32char)) /* No case */
+			return apfs_decompose_hangul(utf32char, norm);
+		norm[0] = case_fold ? tolower(utf32char) : utf32char;
+		return 1;
+	}
+
+	pos = case_fold ? data->nfdcf : data->nfd;
+	if (!pos) {
+		/* The normalization is just the same character */
+		norm[0] = utf32char | (unicode_t)data->ccc << VALUE_CCC_SHIFT;
+		return 1;
+	}
+
+	len = pos & TRIE_SIZE_MASK;
+	pos >>= TRIE_POS_SHIFT;
+	if (unlikely(!len)) {
+		u32 esc = (case_fold ? APFS_TABLE(nfdcf_esc) :
+				       APFS_TABLE(nfd_esc))[pos];
+
+		len = esc & ESC_SIZE_MASK;
+		pos = esc >> ESC_POS_SHIFT;
+	}
+	values = &(case_fold ? APFS_TABLE(nfdcf) : APFS_TABLE(nfd))[pos];
+	for (i = 0; i < len; ++i) {
+		unsigned int wide = (u16)(values[i] - VALUE_WIDE_FIRST);
+
+		if (wide < VALUE_WIDE_COUNT)
+			norm[i] = APFS_TABLE(value_wide)[wide];
+		else
+			norm[i] = values[i];
+	}
+	return len;
+}
+
+/* Are there more segments after the current one? */
+static inline bool apfs_unicursor_more_segs(struct apfs_unicursor *cursor)
+{
+	return unlikely(cursor->segs) && cursor->segs->count;
+}
+
+/**
+ * apfs_unicursor_next_seg - Move the cursor to the start of the next segment
+ * @cursor:	unicode cursor for the string, at the end of a segment
+ *
+ * Returns false if there are no more segments.
+ */
+static bool apfs_unicursor_next_seg(struct apfs_unicursor *cursor)
+{
+	struct apfs_unisegs *state = cursor->segs;
+	const struct apfs_unisegment *seg;
+
+	do {
+		if (!apfs_unicursor_more_segs(cursor))
+			return false;
+		seg = state->next++;
+		state->count--;
+		cursor->utf8curr = seg->ptr + state->off;
+		cursor->utf8end = seg->ptr + seg->len;
+		state->off = 0;
+	} while (cursor->utf8curr == cursor->utf8end);
+	return true;
+}
+
+/**
+ * apfs_unicursor_carry - Join the end of a segment with the following ones
+ * @cursor:	unicode cursor for the string, near the end of a segment
+ *
+ * The rest of the current segment, from @cursor->utf8curr, is moved to the
+ * carry buffer of the segment state, and as much of the following segments
+ * as fits is copied after it. The cursor then reads from the carry buffer,
+ * and moves on to the rest of the segments when it's done with it.
+ *
+ * Returns 0 on success, or -EINVAL if the substring at @cursor->utf8curr is
+ * too long for the carry buffer.
+ */
+static int apfs_unicursor_carry(struct apfs_unicursor *cursor)
+{
+	struct apfs_unisegs *state = cursor->segs;
+	int len = cursor->utf8end - cursor->utf8curr;
+
+	if (len >= APFS_UNICURSOR_CARRY)
+		return -EINVAL;
+	memmove(state->carry, cursor->utf8curr, len);
+
+	while (len < APFS_UNICURSOR_CARRY && state->count) {
+		const struct apfs_unisegment *seg = state->next;
+		int copy = seg->len - state->off;
+
+		if (copy > APFS_UNICURSOR_CARRY - len)
+			copy = APFS_UNICURSOR_CARRY - len;
+		memcpy(state->carry + len, seg->ptr + state->off, copy);
+		len += copy;
+		state->off += copy;
+		if (state->off == seg->len) {
+			state->next++;
+			state->count--;
+			state->off = 0;
+		}
+	}
+
+	cursor->utf8curr = state->carry;
+	cursor->utf8end = state->carry + len;
+	return 0;
+}
+
+/**
+ * apfs_unicursor_stopped - Check if a cursor stopped before the end
+ * @cursor:	unicode cursor, after apfs_normalize_next() returned 0
+ *
+ * Returns true if the cursor stopped at a substring with invalid UTF-8,
+ * false if it got to the end of the string.
+ */
+bool apfs_unicursor_stopped(struct apfs_unicursor *cursor)
+{
+	if (cursor->utf8curr == cursor->utf8end)
+		return apfs_unicursor_more_segs(cursor);
+	return *cursor->utf8curr != 0;
+}
+
+/* Characters decoded ahead by apfs_unicursor_fill(), with their data */
+struct apfs_unibatch {
+	int count;
+	unicode_t chars[APFS_UNICURSOR_BATCH];
+	u8 lens[APFS_UNICURSOR_BATCH];	/* Length of each one in UTF-8 */
+	const struct apfs_unidata *data[APFS_UNICURSOR_BATCH];
+};
+
+/**
+ * apfs_unicursor_decode - Decode the next few characters of a string
+ * @cursor:	unicode cursor for the string
+ * @utf8str:	position of the first character, not at the end
+ * @max:	maximum number of characters, up to APFS_UNICURSOR_BATCH
+ * @batch:	on return, the characters and their normalization data
+ *
+ * Up to @max characters are decoded, and then looked up all together.
+ * Decoding stops early at the end of the string, at invalid UTF-8, near the
+ * end of a segment that is followed by others, and after an ASCII character,
+ * so that the ASCII fast paths get to handle the rest of the run.
+ * ASCII and Hangul syllables have no normalization data, so they get NULL.
+ *
+ * Returns the number of characters decoded, which is zero only if the first
+ * one is invalid.
+ */
+static int apfs_unicursor_decode(struct apfs_unicursor *cursor,
+				 const char *utf8str, int max,
+				 struct apfs_unibatch *batch)
+{
+	unicode_t keys[APFS_UNICURSOR_BATCH];
+	const struct apfs_unidata *data[APFS_UNICURSOR_BATCH];
+	int count, lookups = 0;
+	int i, j;
+
+	for (count = 0; count < max; ++count) {
+		unicode_t utf32char;
+		int utf8len;
+
+		if (count && ((apfs_unicursor_more_segs(cursor) &&
+			       cursor->utf8end - utf8str < 4) ||
+			      utf8str == cursor->utf8end || !*utf8str))
+			break;
+		APFS_COUNT(decodes);
+		utf8len = utf8_to_utf32(utf8str, cursor->utf8end - utf8str,
+					&utf32char);
+		if (utf8len < 0)
+			break;
+		batch->chars[count] = utf32char;
+		batch->lens[count] = utf8len;
+		batch->data[count] = NULL;
+		utf8str += utf8len;
+
+		if (utf32char < 0x80) {
+			count++;
+			break;
+		}
+		if (utf32char <= UTF8_2BYTE_LAST)
+			batch->data[count] = apfs_unidata_find(utf32char);
+		else if (!apfs_is_precomposed_hangul(utf32char))
+			keys[lookups++] = utf32char;
+	}
+
+	/* Only the characters that need a trie walk are left */
+	apfs_unidata_find_batch(keys, lookups, data);
+	for (i = 0, j = 0; j < lookups; ++i) {
+		if (batch->chars[i] > UTF8_2BYTE_LAST &&
+		    !apfs_is_precomposed_hangul(batch->chars[i]))
+			batch->data[i] = data[j++];
+	}
+	batch->count = count;
+	return count;
+}
+
+/*
+ * Characters of a substring are ordered by the number of starters that come
+ * before them (other than the first character), then by canonical combining
+ * class, then by position. Starters never move, and runs of non-starters get
+ * a stable sort by their ccc.
+ */
+#define KEY_GROUP_SHIFT		40
+#define KEY_CCC_SHIFT		32
+
+/**
+ * apfs_unicursor_fill - Decompose and reorder the next substrings of a string
+ * @cursor:	unicode cursor for the string
+ * @case_fold:	case fold the string?
+ *
+ * A substring begins at @cursor->utf8curr and ends before the next character
+ * whose normalization begins with a starter. Its normalized characters are
+ * decoded once and put in canonical order in the cursor buffer. Substrings
+ * that don't fit get buffered in several batches, each with the lowest sort
+ * keys that were not returned yet; @cursor->utf8curr only moves on when the
+ * last batch is buffered.
+ *
+ * The characters are decoded and looked up a few at a time, so the following
+ * substrings are also buffered while there is room, up to the next ASCII
+ * character; the work already done for them is not thrown away. If one of
+ * them can't be finished, because it doesn't fit, has invalid UTF-8 or goes
+ * on in the next segment, the buffer ends before it and it's left for the
+ * next call.
+ *
+ * In the Stream-Safe modes, the run of non-starters is counted as they get
+ * buffered. A CGJ that gets inserted is a starter, so it begins a new
+ * substring; if the fill ends there, the length of the run is kept in the
+ * cursor so that the next fill inserts it again.
+ *
+ * Returns the number of characters buffered, 0 at the end of the string, or
+ * -EINVAL if the substring has invalid UTF-8, or too many non-starters for
+ * APFS_STREAM_SAFE_STRICT.
+ */
+static int apfs_unicursor_fill(struct apfs_unicursor *cursor, bool case_fold)
+{
+	u64 keys[APFS_UNICURSOR_BUFSIZE];
+	/* Room for a CGJ before the normalization of each char */
+	unicode_t norm[APFS_VALUE_MAX_LEN + 1] = {0};
+	struct apfs_unibatch batch;
+	const char *utf8str, *boundary;
+	bool resume = cursor->more;
+	bool marks, cgj;
+	int group, pos, count, next, max, boundary_count, run;
+
+	APFS_COUNT(fills);
+restart:
+	utf8str = cursor->utf8curr;
+	group = pos = count = 0;
+	boundary = NULL;
+	boundary_count = 0;
+	marks = false;
+	run = cursor->nonstarters;
+	batch.count = next = 0;
+	cursor->more = false;
+	while (1) {
+		unicode_t utf32char, *chars;
+		int norm_len, i;
+
+		cgj = false;
+		if (next == batch.count) {
+			/* The substring may go on in the next segment */
+			if (apfs_unicursor_more_segs(cursor) &&
+			    cursor->utf8end - utf8str < 4) {
+				if (boundary_count)
+					goto stop_early;
+				if (apfs_unicursor_carry(cursor))
+					return -EINVAL;
+				goto restart;
+			}
+			if (utf8str == cursor->utf8end || !*utf8str)
+				break;
+			/*
+			 * Once there are combining marks, the fill ends with
+			 * the substring, so don't decode past it.
+			 */
+			max = marks ? 1 : APFS_UNICURSOR_BATCH;
+			next = 0;
+			if (!apfs_unicursor_decode(cursor, utf8str, max,
+						   &batch)) {
+				if (boundary_count)
+					goto stop_early;
+				/* Invalid unicode; don't normalize anything */
+				return -EINVAL;
+			}
+		}
+
+		utf32char = batch.chars[next];
+		chars = norm + 1;
+		norm_len = apfs_normalize_char(utf32char, batch.data[next],
+					       case_fold, chars);
+		if (cursor->stream_safe) {
+			for (i = 0; i < norm_len; ++i) {
+				if (!(chars[i] >> VALUE_CCC_SHIFT))
+					break;
+			}
+			if (run + i > STREAM_SAFE_MAX) {
+				if (cursor->stream_safe ==
+				    APFS_STREAM_SAFE_STRICT) {
+					if (boundary_count)
+						goto stop_early;
+					return -EINVAL;
+				}
+				*--chars = UNICODE_CGJ;
+				norm_len++;
+				cgj = true;
+			}
+		}
+		if (pos && !(chars[0] >> VALUE_CCC_SHIFT)) {
+			/*
+			 * Reached the next substring. Keep going if it was
+			 * just starters, and there's still room.
+			 */
+			if (count && (resume || marks || utf32char < 0x80 ||
+				      count > APFS_UNICURSOR_BUFSIZE -
+					      APFS_UNICURSOR_BATCH))
+				break;
+			boundary = utf8str;
+			boundary_count = count;
+		}
+
+		for (i = 0; i < norm_len; ++i, ++pos) {
+			u64 ccc = chars[i] >> VALUE_CCC_SHIFT;
+			u64 key;
+			int j;
+
+			if (pos && !ccc)
+				group++;
+			marks |= ccc != 0;
+			key = (u64)group << KEY_GROUP_SHIFT |
+			      ccc << KEY_CCC_SHIFT | pos;
+			if (resume && key <= cursor->last_key)
+				continue; /* Returned in an earlier batch */
+
+			if (count == APFS_UNICURSOR_BUFSIZE) {
+				/* Only a lone substring is split in batches */
+				if (boundary_count)
+					goto stop_early;
+				cursor->more = true;
+				if (key > keys[count - 1])
+					continue;
+				count--; /* Leave the highest key for later */
+			}
+
+			/* Insertion sort; the buffer is almost always tiny */
+			for (j = count; j > 0 && keys[j - 1] > key; --j) {
+				keys[j] = keys[j - 1];
+				cursor->buf[j] = cursor->buf[j - 1];
+			}
+			keys[j] = key;
+			cursor->buf[j] = chars[i];
+			count++;
+		}
+		if (cursor->stream_safe) {
+			/* The run goes on only if there was no starter */
+			for (i = norm_len; i > 0; --i) {
+				if (!(chars[i - 1] >> VALUE_CCC_SHIFT))
+					break;
+			}
+			run = i ? norm_len - i : run + norm_len;
+		}
+		utf8str += batch.lens[next++];
+	}
+
+	if (cursor->more) {
+		cursor->last_key = keys[count - 1];
+	} else {
+		cursor->utf8curr = utf8str;
+		cursor->nonstarters = cgj ? run : 0;
+		if (pos)
+			APFS_COUNT(substrings[fls(pos) <= APFS_STATS_SUBSTR ?
+					      fls(pos) - 1 :
+					      APFS_STATS_SUBSTR - 1]);
+	}
+	cursor->buf_len = count;
+	cursor->buf_pos = 0;
+	return count;
+
+stop_early:
+	/*
+	 * The keys of the last substring are higher than all the others, so
+	 * the buffer only needs to be cut where it begins.
+	 */
+	cursor->more = false;
+	cursor->nonstarters = 0;
+	cursor->utf8curr = boundary;
+	cursor->buf_len = boundary_count;
+	cursor->buf_pos = 0;
+	return boundary_count;
+}
+
+/* Word-at-a-time helpers, for when there is no SIMD to scan ASCII runs */
+#define REPEAT_BYTE(x)	((~0ul / 0xff) * (x))
+#define HAS_ZERO(w)	(((w) - REPEAT_BYTE(0x01)) & ~(w) & REPEAT_BYTE(0x80))
+
+/**
+ * apfs_ascii_len - Measure a run of ASCII characters
+ * @s:		string to scan
+ * @len:	maximum length of the run
+ *
+ * Returns the number of bytes at the start of @s that are ASCII characters
+ * other than NUL, up to @len.
+ */
+static int apfs_ascii_len(const u8 *s, int len)
+{
+	int i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+		__m256i nul = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+		u32 stop = _mm256_movemask_epi8(_mm256_or_si256(v, nul));
+
+		if (stop)
+			return i + __builtin_ctz(stop);
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+		__m128i nul = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+		u32 stop = _mm_movemask_epi8(_mm_or_si128(v, nul));
+
+		if (stop)
+			return i + __builtin_ctz(stop);
+	}
+#else
+	for (; i + sizeof(unsigned long) <= len; i += sizeof(unsigned long)) {
+		unsigned long w;
+
+		memcpy(&w, s + i, sizeof(w));
+		if ((w & REPEAT_BYTE(0x80)) || HAS_ZERO(w))
+			break;
+	}
+#endif
+	for (; i < len; ++i) {
+		if (!s[i] || !isascii(s[i]))
+			break;
+	}
+	return i;
+}
+
+/**
+ * apfs_ascii_fold - Copy a run of ASCII characters, in lower case
+ * @dst:	destination buffer
+ * @src:	ASCII characters to copy, from apfs_ascii_len()
+ * @len:	number of characters
+ */
+static void apfs_ascii_fold(u8 *dst, const u8 *src, int len)
+{
+	int i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+		__m256i upper = _mm256_and_si256(
+			_mm256_cmpgt_epi8(v, _mm256_set1_epi8('A' - 1)),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), v));
+
+		v = _mm256_or_si256(v, _mm256_and_si256(upper,
+						_mm256_set1_epi8(0x20)));
+		_mm256_storeu_si256((__m256i *)(dst + i), v);
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i upper = _mm_and_si128(
+			_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+			_mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+
+		v = _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+		_mm_storeu_si128((__m128i *)(dst + i), v);
+	}
+#else
+	for (; i + sizeof(unsigned long) <= len; i += sizeof(unsigned long)) {
+		unsigned long w, above_z, from_a;
+
+		/* All bytes are ASCII, so no carries between them */
+		memcpy(&w, src + i, sizeof(w));
+		from_a = w + REPEAT_BYTE(0x80 - 'A');
+		above_z = w + REPEAT_BYTE(0x7f - 'Z');
+		w |= ((from_a ^ above_z) & REPEAT_BYTE(0x80)) >> 2;
+		memcpy(dst + i, &w, sizeof(w));
+	}
+#endif
+	for (; i < len; ++i)
+		dst[i] = tolower(src[i]);
+}
+
+/**
+ * apfs_normalize_ascii - Return a run of normalized ASCII characters
+ * @cursor:	unicode cursor for the string
+ * @buf:	buffer for the normalized characters
+ * @buflen:	size of @buf
+ * @case_fold:	case fold the string?
+ *
+ * ASCII characters are starters and are never changed by normalization,
+ * other than by case folding, so a whole run of them can be consumed at once.
+ * Copies the run that begins at @cursor->utf8curr to @buf, up to @buflen
+ * characters, and moves the cursor past it.
+ *
+ * Returns the number of characters copied, which is 0 if the cursor is not
+ * at the start of an ASCII run; apfs_normalize_next() must be called then.
+ */
+int apfs_normalize_ascii(struct apfs_unicursor *cursor, u8 *buf, int buflen,
+			 bool case_fold)
+{
+	const u8 *utf8str = (const u8 *)cursor->utf8curr;
+	int len;
+
+	/* In the middle of a substring */
+	if (cursor->buf_pos < cursor->buf_len || cursor->more)
+		return 0;
+
+	len = cursor->utf8end - cursor->utf8curr;
+	len = apfs_ascii_len(utf8str, len < buflen ? len : buflen);
+	if (case_fold)
+		apfs_ascii_fold(buf, utf8str, len);
+	else
+		memcpy(buf, utf8str, len);
+
+	cursor->utf8curr += len;
+	APFS_COUNT_ADD(ascii_chars, len);
+	return len;
+}
+
+/**
+ * apfs_normalize_next - Return the next normalized character from a string
+ * @cursor:	unicode cursor for the string
+ * @case_fold:	case fold the string?
+ *
+ * Returns a single normalized character, taken from the cursor buffer, which
+ * gets refilled with the next substring as needed. Returns 0 at the end of
+ * the string, or if the substring has invalid UTF-8.
+ */
+unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
+{
+	const char *utf8str = cursor->utf8curr;
+
+	APFS_COUNT(next_calls);
+	if (cursor->buf_pos < cursor->buf_len) {
+		APFS_COUNT(next_chars);
+		return cursor->buf[cursor->buf_pos++] & VALUE_CHAR_MASK;
+	}
+	if (cursor->more)
+		goto fill;
+
+	if (utf8str == cursor->utf8end) {
+		if (!apfs_unicursor_next_seg(cursor))
+			return 0;
+		utf8str = cursor->utf8curr;
+	}
+	if (!*utf8str)
+		return 0;
+	if (likely(isascii(*utf8str))) {
+		cursor->utf8curr = utf8str + 1;
+		APFS_COUNT(next_chars);
+		APFS_COUNT(ascii_chars);
+		if (case_fold)
+			return tolower(*utf8str);
+		return *utf8str;
+	}
+
+	/*
+	 * A two-byte character that is a starter and normalizes to itself can
+	 * also be returned right away, without looking at the rest of the
+	 * substring. Overlong encodings are left for utf8_to_utf32() to reject.
+	 */
+	if (cursor->utf8end - utf8str >= 2 &&
+	    ((u8)utf8str[0] & 0xe0) == 0xc0 &&
+	    ((u8)utf8str[1] & 0xc0) == 0x80) {
+		unicode_t utf32char = ((utf8str[0] & 0x1f) << 6) |
+				      (utf8str[1] & 0x3f);
+		const struct apfs_unidata *data;
+
+		if (utf32char >= UTF8_2BYTE_FIRST) {
+			data = &APFS_TABLE(unidata_2byte)[utf32char -
+							  UTF8_2BYTE_FIRST];
+			if (!data->ccc &&
+			    !(case_fold ? data->nfdcf : data->nfd)) {
+				cursor->utf8curr = utf8str + 2;
+				APFS_COUNT(next_chars);
+				APFS_COUNT(twobyte_chars);
+				return utf32char;
+			}
+		}
+	}
+
+fill:
+	if (apfs_unicursor_fill(cursor, case_fold) <= 0)
+		return 0;
+	APFS_COUNT(next_chars);
+	return cursor->buf[cursor->buf_pos++] & VALUE_CHAR_MASK;
+}
+
+/**
+ * apfs_qc_stable - Check the quick check bitmap for a character
+ * @utf32char:	the character, a valid code point
+ * @case_fold:	check the case folding too?
+ *
+ * Returns true if @utf32char is a starter that normalizes to itself, and
+ * also case folds to itself if @case_fold is set. A false return means that
+ * the normalization data must be looked up to know.
+ */
+static inline bool apfs_qc_stable(unicode_t utf32char, bool case_fold)
+{
+	int block = APFS_TABLE(qc_planes)[utf32char >> 16];
+	int leaf = APFS_TABLE(qc_blocks)[block][(utf32char >> 8) & 0xff];
+	u32 word = APFS_TABLE(qc_leaves)[leaf][(utf32char >> 4) & 0xf];
+
+	return (word >> (((utf32char & 0xf) << 1) + case_fold)) & 1;
+}
+
+/*
+ * The work of apfs_is_normalized(), which only adds the counters. With
+ * @stream_safe set, a run of more than 30 non-starters also fails the check.
+ */
+static bool apfs_quick_check(const char *name, int len, bool case_fold,
+			     bool stream_safe)
+{
+	const u8 *curr = (const u8 *)name;
+	const u8 *end = curr + len;
+	u8 last_ccc = 0;
+	int run = 0;
+
+	while (curr < end && *curr) {
+		const struct apfs_unidata *data;
+		unicode_t utf32char;
+		int runlen, charlen;
+
+		runlen = apfs_ascii_len(curr, end - curr);
+		if (runlen) {
+			if (case_fold) {
+				int i;
+
+				for (i = 0; i < runlen; ++i) {
+					if (curr[i] >= 'A' && curr[i] <= 'Z')
+						return false;
+				}
+			}
+			curr += runlen;
+			last_ccc = run = 0;
+			continue;
+		}
+
+		charlen = utf8_to_utf32(curr, end - curr, &utf32char);
+		if (charlen < 0)
+			return false;
+		APFS_COUNT(decodes);
+		curr += charlen;
+
+		if (apfs_qc_stable(utf32char, case_fold)) {
+			last_ccc = run = 0;
+			continue;
+		}
+		if (apfs_is_precomposed_hangul(utf32char))
+			return false;
+		data = apfs_unidata_find(utf32char);
+		if (case_fold ? data->nfdcf : data->nfd)
+			return false;
+		if (data->ccc && data->ccc < last_ccc)
+			return false;
+		run = data->ccc ? run + 1 : 0;
+		if (stream_safe && run > STREAM_SAFE_MAX)
+			return false;
+		last_ccc = data->ccc;
+	}
+	return true;
+}
+
+/* Run the quick check, and count its result */
+static bool __apfs_is_normalized(const char *name, int len, bool case_fold,
+				 bool stream_safe)
+{
+	bool ret = apfs_quick_check(name, len, case_fold, stream_safe);
+
+	if (ret)
+		APFS_COUNT(quick_yes);
+	else
+		APFS_COUNT(quick_no);
+	return ret;
+}
+
+/**
+ * apfs_is_normalized - Check if a string is its own normalization
+ * @name:	UTF-8 string to check, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	check against the case folded normalization?
+ *
+ * Most names are already normalized, and for those the input bytes can be
+ * used as they are. Each character is only decoded and checked against the
+ * quick check bitmap; the normalization data is looked up just for the few
+ * characters that the bitmap doesn't cover, to confirm that they map to
+ * themselves and that the combining marks are in canonical order.
+ *
+ * Returns true if the normalization of @name is identical to @name, false
+ * if it isn't, or if @name has invalid UTF-8.
+ */
+bool apfs_is_normalized(const char *name, int len, bool case_fold)
+{
+	return __apfs_is_normalized(name, len, case_fold,
+				    false /* stream_safe */);
+}
+
+/**
+ * apfs_put_char - Append a character to the output of a bulk normalization
+ * @dst:	output buffer
+ * @dstlen:	size of @dst in bytes
+ * @pos:	position in @dst for the character
+ * @utf32char:	character to append
+ * @utf8:	encode the character as UTF-8 instead of UTF-32?
+ *
+ * The character is only written if it fits in the buffer. Returns its size.
+ */
+static int apfs_put_char(u8 *dst, int dstlen, int pos, unicode_t utf32char,
+			 bool utf8)
+{
+	u8 utf8buf[4];
+	int len;
+
+	if (!utf8) {
+		if (pos + (int)sizeof(utf32char) <= dstlen)
+			memcpy(dst + pos, &utf32char, sizeof(utf32char));
+		return sizeof(utf32char);
+	}
+
+	len = utf32_to_utf8(utf32char, utf8buf, sizeof(utf8buf));
+	if (pos + len <= dstlen)
+		memcpy(dst + pos, utf8buf, len);
+	return len;
+}
+
+/**
+ * apfs_normalize_string - Normalize a whole string into a buffer
+ * @src:	UTF-8 string to normalize, not necessarily NUL-terminated
+ * @len:	length of @src; a NUL byte also ends the string
+ * @dst:	output buffer
+ * @dstlen:	size of @dst in bytes
+ * @flags:	APFS_NORM_CASE_FOLD to case fold the string, APFS_NORM_UTF8
+ *		to encode the output as UTF-8 instead of an array of unicode_t,
+ *		and APFS_NORM_STREAM_SAFE or APFS_NORM_STREAM_STRICT to limit
+ *		the runs of non-starters, see apfs_unicursor_stream_safe()
+ *
+ * The output is not NUL-terminated. If it doesn't fit in @dstlen bytes, @dst
+ * only holds part of it; the return value is still the full size, so the
+ * caller can retry with a bigger buffer. A NULL @dst with a @dstlen of zero
+ * may be used to just get the size.
+ *
+ * Returns the size of the normalized string in bytes, or -EINVAL if @src is
+ * not valid UTF-8, or is rejected by APFS_NORM_STREAM_STRICT.
+ */
+int apfs_normalize_string(const char *src, int len, void *dst, int dstlen,
+			  unsigned int flags)
+{
+	struct apfs_unicursor cursor;
+	bool case_fold = flags & APFS_NORM_CASE_FOLD;
+	bool utf8 = flags & APFS_NORM_UTF8;
+	bool stream_safe = flags & (APFS_NORM_STREAM_SAFE |
+				    APFS_NORM_STREAM_STRICT);
+	u8 *out = dst;
+	int size = 0;
+
+	/* Already normalized UTF-8 needs no work at all */
+	if (utf8 && __apfs_is_normalized(src, len, case_fold, stream_safe)) {
+		size = strnlen(src, len);
+		if (dstlen)
+			memcpy(dst, src, size < dstlen ? size : dstlen);
+		return size;
+	}
+
+	apfs_init_unicursor_len(&cursor, src, len);
+	if (flags & APFS_NORM_STREAM_STRICT)
+		apfs_unicursor_stream_safe(&cursor, APFS_STREAM_SAFE_STRICT);
+	else if (flags & APFS_NORM_STREAM_SAFE)
+		apfs_unicursor_stream_safe(&cursor, APFS_STREAM_SAFE);
+	while (1) {
+		unicode_t utf32char;
+		u8 run[64];
+		int runlen, i;
+
+		if (utf8 && size < dstlen) {
+			/* ASCII goes straight to the output buffer */
+			runlen = apfs_normalize_ascii(&cursor, out + size,
+						      dstlen - size,
+						      case_fold);
+			size += runlen;
+			if (runlen)
+				continue;
+		}
+
+		runlen = apfs_normalize_ascii(&cursor, run, sizeof(run),
+					      case_fold);
+		for (i = 0; i < runlen; ++i)
+			size += apfs_put_char(out, dstlen, size, run[i], utf8);
+		if (runlen)
+			continue;
+
+		utf32char = apfs_normalize_next(&cursor, case_fold);
+		if (!utf32char)
+			break;
+		size += apfs_put_char(out, dstlen, size, utf32char, utf8);
+	}
+
+	/* The cursor stops early on invalid UTF-8 */
+	if (apfs_unicursor_stopped(&cursor))
+		return -EINVAL;
+	return size;
+}
+
+/* Number of normalized characters hashed at a time */
+#define HASH_CHUNK	16
+
+/* Size of @utf32char in UTF-8, which must be a valid code point */
+static inline int apfs_utf8_size(unicode_t utf32char)
+{
+	if (utf32char < 0x80)
+		return 1;
+	if (utf32char < 0x800)
+		return 2;
+	return utf32char < 0x10000 ? 3 : 4;
+}
+
+/**
+ * apfs_normalize_hash_size - Hash the normalization of a string, and size it
+ * @name:	UTF-8 string to hash, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	case fold the string?
+ * @hash:	on return, the hash of the normalized string
+ *
+ * Computes the CRC32C of the normalized string, as an array of little-endian
+ * UTF-32 characters, without ever holding more than a few of them. The seed
+ * is ~0 and there is no final inversion, so the result matches a crc32c() of
+ * the characters returned by apfs_normalize_next(), one at a time. Like the
+ * cursor, the hash stops before the first substring with invalid UTF-8.
+ *
+ * Returns the size of the normalized string in UTF-8, like the return value
+ * of apfs_normalize_string() with APFS_NORM_UTF8, or -EINVAL if @name is not
+ * valid UTF-8. @hash is set in both cases.
+ */
+int apfs_normalize_hash_size(const char *name, int len, bool case_fold,
+			     u32 *hash)
+{
+	struct apfs_unicursor cursor;
+	__le32 chunk[HASH_CHUNK];
+	u32 crc = ~0;
+	int count = 0, size = 0;
+
+	/*
+	 * The characters of a normalized string are hashed as they are, so
+	 * they only need to be decoded.
+	 */
+	if (apfs_is_normalized(name, len, case_fold)) {
+		const u8 *curr = (const u8 *)name;
+		const u8 *end = curr + len;
+
+		while (curr < end && *curr) {
+			unicode_t utf32char;
+
+			if (count == HASH_CHUNK) {
+				crc = crc32c(crc, chunk, sizeof(chunk));
+				count = 0;
+			}
+			curr += utf8_to_utf32(curr, end - curr, &utf32char);
+			chunk[count++] = cpu_to_le32(utf32char);
+		}
+		*hash = crc32c(crc, chunk, count * sizeof(*chunk));
+		return curr - (const u8 *)name;
+	}
+
+	apfs_init_unicursor_len(&cursor, name, len);
+	while (1) {
+		unicode_t utf32char;
+		u8 run[HASH_CHUNK];
+		int runlen, i;
+
+		if (count == HASH_CHUNK) {
+			crc = crc32c(crc, chunk, sizeof(chunk));
+			count = 0;
+		}
+
+		runlen = apfs_normalize_ascii(&cursor, run, HASH_CHUNK - count,
+					      case_fold);
+		for (i = 0; i < runlen; ++i)
+			chunk[count++] = cpu_to_le32(run[i]);
+		size += runlen;
+		if (runlen)
+			continue;
+
+		utf32char = apfs_normalize_next(&cursor, case_fold);
+		if (!utf32char)
+			break;
+		chunk[count++] = cpu_to_le32(utf32char);
+		size += apfs_utf8_size(utf32char);
+	}
+	*hash = crc32c(crc, chunk, count * sizeof(*chunk));
+
+	/* The cursor stops early on invalid UTF-8 */
+	if (apfs_unicursor_stopped(&cursor))
+		return -EINVAL;
+	return size;
+}
+
+/**
+ * apfs_normalize_hash - Hash the normalization of a string
+ * @name:	UTF-8 string to hash, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	case fold the string?
+ *
+ * Returns the same hash as apfs_normalize_hash_size().
+ */
+u32 apfs_normalize_hash(const char *name, int len, bool case_fold)
+{
+	u32 hash;
+
+	apfs_normalize_hash_size(name, len, case_fold, &hash);
+	return hash;
+}
+
+/**
+ * apfs_normalized_cmp - Compare the normalizations of two strings
+ * @a:		first UTF-8 string, NUL-terminated
+ * @b:		second UTF-8 string, NUL-terminated
+ * @case_fold:	compare the case folded normalizations instead?
+ *
+ * The normalized strings are compared one UTF-32 character at a time, and
+ * only as far as needed to find the first difference. If either string has
+ * invalid UTF-8, the bytes after the last valid substring are compared too,
+ * so that two different invalid names never match.
+ *
+ * Returns 0 if the normalizations are equal; otherwise a negative or positive
+ * value, depending on which string sorts first.
+ */
+int apfs_normalized_cmp(const char *a, const char *b, bool case_fold)
+{
+	struct apfs_unicursor cursor_a, cursor_b;
+	unicode_t char_a, char_b;
+	int len_a, len_b;
+
+	/*
+	 * ASCII characters are starters, so the normalization of an identical
+	 * ASCII prefix is the same on both sides and can be skipped.
+	 */
+	while (*a == *b && *a && isascii(*a)) {
+		a++;
+		b++;
+	}
+
+	/* Keep going with ASCII while it lasts, since it needs no lookups */
+	while (*a && *b && isascii(*a) && isascii(*b)) {
+		char_a = case_fold ? tolower(*a) : *a;
+		char_b = case_fold ? tolower(*b) : *b;
+		if (char_a != char_b)
+			return char_a < char_b ? -1 : 1;
+		a++;
+		b++;
+	}
+	if (!*a || !*b)
+		return (u8)*a - (u8)*b;
+
+	/*
+	 * UTF-8 sorts like the code points, so normalized names need no work.
+	 * The quick check must get the real lengths: it reads whole words,
+	 * and would run past the end of the names.
+	 */
+	len_a = strlen(a);
+	len_b = strlen(b);
+	if (apfs_is_normalized(a, len_a, case_fold) &&
+	    apfs_is_normalized(b, len_b, case_fold))
+		return strcmp(a, b);
+
+	apfs_init_unicursor_len(&cursor_a, a, len_a);
+	apfs_init_unicursor_len(&cursor_b, b, len_b);
+	do {
+		char_a = apfs_normalize_next(&cursor_a, case_fold);
+		char_b = apfs_normalize_next(&cursor_b, case_fold);
+		if (char_a != char_b)
+			return char_a < char_b ? -1 : 1;
+	} while (char_a);
+
+	/* Both cursors stopped, at the end or at some invalid UTF-8 */
+	return strcmp(cursor_a.utf8curr, cursor_b.utf8curr);
+}
+
+#ifdef APFS_LOADABLE_TABLES
+/*
+ * Layout of the binary tables written by "mktrie -o", see the comment there.
+ * The tables are used in place, so the fields are little-endian like the host.
+ */
+#define APFS_UNITABLES_MAGIC	0x42544e55	/* "UNTB" */
+#define APFS_UNITABLES_VERSION	4
+#define APFS_UNITABLES_ALIGN	64
+
+enum {
+	APFS_UNITABLES_TRIE,
+	APFS_UNITABLES_UNIDATA,
+	APFS_UNITABLES_UNIDATA_2BYTE,
+	APFS_UNITABLES_NFD,
+	APFS_UNITABLES_NFDCF,
+	APFS_UNITABLES_QC_PLANES,
+	APFS_UNITABLES_QC_BLOCKS,
+	APFS_UNITABLES_QC_LEAVES,
+	APFS_UNITABLES_NFD_ESC,
+	APFS_UNITABLES_NFDCF_ESC,
+	APFS_UNITABLES_HASH_DISP,
+	APFS_UNITABLES_HASH_SLOTS,
+	APFS_UNITABLES_VALUE_WIDE,
+	APFS_UNITABLES_COUNT
+};
+
+struct apfs_unitables_header {
+	u32 magic;
+	u32 version;
+	u32 size;		/* Size of the whole file */
+	u32 checksum;		/* CRC32C, computed with this field zeroed */
+	u32 trie_height;
+	u8 trie_bits[APFS_UNITABLES_MAX_HEIGHT];
+	u8 trie_shift[APFS_UNITABLES_MAX_HEIGHT];
+	int trie_base[APFS_UNITABLES_MAX_HEIGHT];
+	struct {
+		u32 offset;
+		u32 size;
+	} tables[APFS_UNITABLES_COUNT];
+};
+
+/* Number of planes, and so of entries in the qc_planes table */
+#define APFS_QC_PLANES		17
+
+/* The tables from a file, when apfs_tables points to them */
+static struct apfs_unitables apfs_loaded_tables;
+
+/* The mapping of the file, if it was made by apfs_load_unitables() */
+static void *apfs_unitables_map;
+static size_t apfs_unitables_map_size;
+
+/**
+ * apfs_unitables_find - Find one of the tables in a binary table file
+ * @blob:	contents of the file
+ * @table:	index of the table in the header
+ * @elem_size:	size of each element of the table
+ * @count:	on return, the number of elements
+ *
+ * Returns a pointer to the table, or NULL if it's out of bounds or not made
+ * of whole elements.
+ */
+static const void *apfs_unitables_find(const u8 *blob, int table,
+				       size_t elem_size, long *count)
+{
+	const struct apfs_unitables_header *hdr = (const void *)blob;
+	u32 offset = hdr->tables[table].offset;
+	u32 size = hdr->tables[table].size;
+
+	if (offset % APFS_UNITABLES_ALIGN || offset < sizeof(*hdr) ||
+	    offset > hdr->size || size > hdr->size - offset ||
+	    size % elem_size)
+		return NULL;
+	*count = size / elem_size;
+	return blob + offset;
+}
+
+/*
+ * Check that every lookup that goes through the row of @node, on trie level
+ * @level, stays inside the trie and ends on an existing record.
+ */
+static bool apfs_unitables_walk(const struct apfs_unitables *tables,
+				long trie_count, long unidata_count,
+				int level, long node)
+{
+	int bits = tables->trie_bits[level];
+	long start = tables->trie_base[level] + (node << bits);
+	int i;
+
+	if (start < 0 || start + (1 << bits) > trie_count)
+		return false;
+	for (i = 0; i < 1 << bits; ++i) {
+		long child = tables->trie[start + i];
+
+		if (level == tables->trie_height - 1) {
+			if (child >= unidata_count)
+				return false;
+		} else if (child && !apfs_unitables_walk(tables, trie_count,
+							 unidata_count,
+							 level + 1, child)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+ * Check that the entries of an escape array point inside the value array, and
+ * that the values fit the buffers of the runtime code.
+ */
+static bool apfs_escapes_valid(const u32 *esc, long esc_count, long count)
+{
+	long i;
+
+	/* The first entry is never used */
+	for (i = 1; i < esc_count; ++i) {
+		long pos = esc[i] >> ESC_POS_SHIFT;
+		long len = esc[i] & ESC_SIZE_MASK;
+
+		if (len > APFS_VALUE_MAX_LEN || pos + len > count)
+			return false;
+	}
+	return true;
+}
+
+/* Check that an encoded value points inside its value or escape array */
+static bool apfs_value_valid(u16 value, long count, long esc_count)
+{
+	long pos = value >> TRIE_POS_SHIFT;
+	long len = value & TRIE_SIZE_MASK;
+
+	if (value && !len)
+		return pos < esc_count;
+	return pos + len <= count;
+}
+
+/*
+ * Check that all entries of a value array are characters, or point inside the
+ * wide value array.
+ */
+static bool apfs_values_valid(const u16 *values, long count, long wide_count)
+{
+	long i;
+
+	for (i = 0; i < count; ++i) {
+		u16 wide = values[i] - VALUE_WIDE_FIRST;
+
+		if (!values[i] ||
+		    (wide < VALUE_WIDE_COUNT && wide >= wide_count))
+			return false;
+	}
+	return true;
+}
+
+/* Check that all entries of the wide value array are characters */
+static bool apfs_wide_valid(const u32 *wide, long wide_count)
+{
+	long i;
+
+	for (i = 0; i < wide_count; ++i) {
+		unicode_t utf32char = wide[i] & VALUE_CHAR_MASK;
+
+		if (!utf32char || utf32char > 0x10ffff)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * apfs_unitables_parse - Check a binary table file, and find its tables
+ * @blob:	contents of the file
+ * @size:	size of @blob
+ * @tables:	on return, the tables inside @blob
+ *
+ * Besides the checksum, every index stored in the tables is checked against
+ * the size of the table it points to, so that the lookups can never read out
+ * of bounds, even if the file was not built by mktrie.
+ *
+ * Returns 0 on success, or -EINVAL if @blob is not valid.
+ */
+static int apfs_unitables_parse(const u8 *blob, size_t size,
+				struct apfs_unitables *tables)
+{
+	const struct apfs_unitables_header *hdr = (const void *)blob;
+	struct apfs_unitables_header copy;
+	long trie_count = 0, unidata_count = 0, twobyte_count = 0;
+	long nfd_count = 0, nfdcf_count = 0, wide_count = 0;
+	long nfd_esc_count = 0, nfdcf_esc_count = 0;
+	long disp_count = 0, slot_count = 0;
+	long plane_count = 0, block_count = 0, leaf_count = 0;
+	long i;
+	int bits, h;
+	u32 crc;
+
+	if (cpu_to_le32(1) != 1)
+		return -EINVAL;
+	if ((unsigned long)blob % APFS_UNITABLES_ALIGN || size < sizeof(*hdr))
+		return -EINVAL;
+	if (hdr->magic != APFS_UNITABLES_MAGIC ||
+	    hdr->version != APFS_UNITABLES_VERSION ||
+	    hdr->size < sizeof(*hdr) || hdr->size > size)
+		return -EINVAL;
+
+	memcpy(&copy, hdr, sizeof(copy));
+	copy.checksum = 0;
+	crc = crc32c(~0, &copy, sizeof(copy));
+	crc = crc32c(crc, blob + sizeof(copy), hdr->size - sizeof(copy));
+	if (crc != hdr->checksum)
+		return -EINVAL;
+
+	/* The levels must split the bits of the characters among them */
+	if (hdr->trie_height < 1 ||
+	    hdr->trie_height > APFS_UNITABLES_MAX_HEIGHT)
+		return -EINVAL;
+	bits = 0;
+	for (h = hdr->trie_height - 1; h >= 0; --h) {
+		if (!hdr->trie_bits[h] || hdr->trie_shift[h] != bits)
+			return -EINVAL;
+		bits += hdr->trie_bits[h];
+	}
+	if (bits != 21)
+		return -EINVAL;
+	tables->trie_height = hdr->trie_height;
+	tables->trie_bits = hdr->trie_bits;
+	tables->trie_shift = hdr->trie_shift;
+	tables->trie_base = hdr->trie_base;
+
+	tables->trie = apfs_unitables_find(blob, APFS_UNITABLES_TRIE,
+					   sizeof(*tables->trie), &trie_count);
+	tables->unidata = apfs_unitables_find(blob, APFS_UNITABLES_UNIDATA,
+					      sizeof(*tables->unidata),
+					      &unidata_count);
+	tables->unidata_2byte = apfs_unitables_find(blob,
+					APFS_UNITABLES_UNIDATA_2BYTE,
+					sizeof(*tables->unidata_2byte),
+					&twobyte_count);
+	tables->nfd = apfs_unitables_find(blob, APFS_UNITABLES_NFD,
+					  sizeof(*tables->nfd), &nfd_count);
+	tables->nfdcf = apfs_unitables_find(blob, APFS_UNITABLES_NFDCF,
+					    sizeof(*tables->nfdcf),
+					    &nfdcf_count);
+	tables->nfd_esc = apfs_unitables_find(blob, APFS_UNITABLES_NFD_ESC,
+					      sizeof(*tables->nfd_esc),
+					      &nfd_esc_count);
+	tables->nfdcf_esc = apfs_unitables_find(blob, APFS_UNITABLES_NFDCF_ESC,
+						sizeof(*tables->nfdcf_esc),
+						&nfdcf_esc_count);
+	tables->qc_planes = apfs_unitables_find(blob, APFS_UNITABLES_QC_PLANES,
+						sizeof(*tables->qc_planes),
+						&plane_count);
+	tables->qc_blocks = apfs_unitables_find(blob, APFS_UNITABLES_QC_BLOCKS,
+						sizeof(*tables->qc_blocks),
+						&block_count);
+	tables->qc_leaves = apfs_unitables_find(blob, APFS_UNITABLES_QC_LEAVES,
+						sizeof(*tables->qc_leaves),
+						&leaf_count);
+	tables->hash_disp = apfs_unitables_find(blob, APFS_UNITABLES_HASH_DISP,
+						sizeof(*tables->hash_disp),
+						&disp_count);
+	tables->hash_slots = apfs_unitables_find(blob,
+						 APFS_UNITABLES_HASH_SLOTS,
+						 sizeof(*tables->hash_slots),
+						 &slot_count);
+	tables->value_wide = apfs_unitables_find(blob,
+						 APFS_UNITABLES_VALUE_WIDE,
+						 sizeof(*tables->value_wide),
+						 &wide_count);
+	if (!tables->trie || !tables->unidata || !tables->unidata_2byte ||
+	    !tables->nfd || !tables->nfdcf || !tables->nfd_esc ||
+	    !tables->nfdcf_esc || !tables->qc_planes ||
+	    !tables->qc_blocks || !tables->qc_leaves ||
+	    !tables->hash_disp || !tables->hash_slots || !tables->value_wide)
+		return -EINVAL;
+	if (twobyte_count != UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST + 1 ||
+	    plane_count != APFS_QC_PLANES || !unidata_count ||
+	    !disp_count || !slot_count)
+		return -EINVAL;
+	tables->hash_buckets = disp_count;
+	tables->hash_size = slot_count;
+
+	if (!apfs_unitables_walk(tables, trie_count, unidata_count, 0, 0))
+		return -EINVAL;
+	for (i = 0; i < slot_count; ++i) {
+		if (tables->hash_slots[i] >> HASH_KEY_BITS >= unidata_count)
+			return -EINVAL;
+	}
+	if (!apfs_escapes_valid(tables->nfd_esc, nfd_esc_count, nfd_count) ||
+	    !apfs_escapes_valid(tables->nfdcf_esc, nfdcf_esc_count,
+				nfdcf_count))
+		return -EINVAL;
+	for (i = 0; i < unidata_count + twobyte_count; ++i) {
+		const struct apfs_unidata *data = i < unidata_count ?
+			&tables->unidata[i] :
+			&tables->unidata_2byte[i - unidata_count];
+
+		if (!apfs_value_valid(data->nfd, nfd_count, nfd_esc_count) ||
+		    !apfs_value_valid(data->nfdcf, nfdcf_count,
+				      nfdcf_esc_count))
+			return -EINVAL;
+	}
+	if (!apfs_values_valid(tables->nfd, nfd_count, wide_count) ||
+	    !apfs_values_valid(tables->nfdcf, nfdcf_count, wide_count) ||
+	    !apfs_wide_valid(tables->value_wide, wide_count))
+		return -EINVAL;
+
+	for (i = 0; i < plane_count; ++i) {
+		if (tables->qc_planes[i] >= block_count)
+			return -EINVAL;
+	}
+	for (i = 0; i < block_count * 256; ++i) {
+		if (tables->qc_blocks[i / 256][i % 256] >= leaf_count)
+			return -EINVAL;
+	}
+	return 0;
+}
+
+/**
+ * apfs_use_unitables - Switch to the tables in a binary table file
+ * @blob:	contents of the file, aligned to a cache line
+ * @size:	size of @blob
+ *
+ * The tables are checked and then used in place, without copying, so @blob
+ * must remain valid until they are replaced. The tables can only be switched
+ * while no normalization is running on any thread.
+ *
+ * Returns 0 on success, or -EINVAL if @blob is not a valid table file; the
+ * tables in use are left alone in that case.
+ */
+int apfs_use_unitables(const void *blob, size_t size)
+{
+	struct apfs_unitables tables;
+	int err;
+
+	err = apfs_unitables_parse(blob, size, &tables);
+	if (err)
+		return err;
+	apfs_unload_unitables();
+	apfs_loaded_tables = tables;
+	apfs_tables = &apfs_loaded_tables;
+	return 0;
+}
+
+/**
+ * apfs_load_unitables - Map a binary table file and switch to its tables
+ * @path:	path to the file, written by "mktrie -o"
+ *
+ * The file is mapped read-only and shared, so all processes that load the
+ * same file also share a single copy of the tables in the page cache. Like
+ * apfs_use_unitables(), this may only be called while no normalization is
+ * running on any thread.
+ *
+ * Returns 0 on success, -EIO if the file can't be mapped, or -EINVAL if it's
+ * not a valid table file; the tables in use are left alone on failure.
+ */
+int apfs_load_unitables(const char *path)
+{
+	struct stat st;
+	void *map;
+	int fd, err;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return -EIO;
+	if (fstat(fd, &st) || st.st_size <= 0) {
+		close(fd);
+		return -EIO;
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return -EIO;
+
+	err = apfs_use_unitables(map, st.st_size);
+	if (err) {
+		munmap(map, st.st_size);
+		return err;
+	}
+	apfs_unitables_map = map;
+	apfs_unitables_map_size = st.st_size;
+	return 0;
+}
+
+/**
+ * apfs_unload_unitables - Go back to the built-in tables
+ *
+ * If the tables in use were mapped by apfs_load_unitables(), the mapping is
+ * removed. No normalization may be running on any thread.
+ */
+void apfs_unload_unitables(void)
+{
+	apfs_tables = &apfs_builtin_tables;
+	if (apfs_unitables_map)
+		munmap(apfs_unitables_map, apfs_unitables_map_size);
+	apfs_unitables_map = NULL;
+	apfs_unitables_map_size = 0;
+}
+#endif	/* APFS_LOADABLE_TABLES */
+
+/*
+ * The following arrays were built with data provided by the Unicode Standard,
+ * version 9.0.
+ *
+ * Copyright (C) 1991-2018 Unicode, Inc.  All rights reserved.  Distributed
+ * under the Terms of Use in http://www.unicode.org/copyright.html.
+ */
+
+
+static const u16 apfs_hash_disp[] __aligned(64) = {
+	0x010e, 0x001a, 0x0240, 0x001a, 0x0004, 0x00ba, 0x001d, 0x002a,
+	0x0000, 0x0047, 0x0089, 0x0004, 0x0003, 0x0000, 0x0005, 0x008c,
+	0x0021, 0x003c, 0x0009, 0x0118, 0x0000, 0x0034, 0x000c, 0x0000,
+	0x0007, 0x0005, 0x0000, 0x02cc, 0x0003, 0x0000, 0x003d, 0x0005,
+	0x0026, 0x004a, 0x0001, 0x0055, 0x0044, 0x006a, 0x0017, 0x005d,
+	0x0000, 0x0061, 0x0000, 0x0002, 0x0000, 0x0002, 0x0025, 0x0008,
+	0x0004, 0x0004, 0x0015, 0x0004, 0x0000, 0x0006, 0x00c7, 0x0005,
+	0x0001, 0x00c9, 0x000d, 0x0020, 0x0001, 0x0000, 0x0002, 0x0008,
+	0x0003, 0x0058, 0x000e, 0x002c, 0x0013, 0x0001, 0x002e, 0x0003,
+	0x0000, 0x0005, 0x0004, 0x0003, 0x002c, 0x0023, 0x000c, 0x0000,
+	0x0000, 0x001b, 0x0029, 0x006a, 0x000b, 0x0125, 0x0020, 0x003b,
+	0x0016, 0x0076, 0x0010, 0x0005, 0x004d, 0x0020, 0x0060, 0x0016,
+	0x0001, 0x006d, 0x004a, 0x0012, 0x0000, 0x0004, 0x0003, 0x0000,
+	0x0009, 0x0018, 0x0068, 0x0072, 0x0032, 0x0011, 0x0001, 0x0002,
+	0x0002, 0x0000, 0x0010, 0x0006, 0x0055, 0x0000, 0x0007, 0x0000,
+	0x0003, 0x002c, 0x0047, 0x0006, 0x0000, 0x0000, 0x0006, 0x001b,
+	0x0002, 0x00bd, 0x0001, 0x0000, 0x0003, 0x0056, 0x0004, 0x0353,
+	0x0000, 0x0006, 0x0000, 0x0004, 0x001a, 0x0017, 0x0002, 0x000a,
+	0x0042, 0x0015, 0x0011, 0x0002, 0x000a, 0x000a, 0x0021, 0x0011,
+	0x000b, 0x0011, 0x0024, 0x0018, 0x0000, 0x0006, 0x0083, 0x0006,
+	0x0000, 0x00aa, 0x001b, 0x0032, 0x0100, 0x00b0, 0x0058, 0x0008,
+	0x0012, 0x02cb, 0x0015, 0x0011, 0x0014, 0x0000, 0x0056, 0x0033,
+	0x003f, 0x00d9, 0x0000, 0x0054, 0x0006, 0x00ac, 0x00bf, 0x0000,
+	0x0002, 0x0014, 0x0002, 0x0000, 0x0028, 0x0038, 0x00a6, 0x0001,
+	0x0056, 0x00cb, 0x0000, 0x0032, 0x0004, 0x0006, 0x0007, 0x0005,
+	0x000e, 0x002c, 0x002a, 0x0000, 0x000a, 0x0021, 0x00bc, 0x0017,
+	0x0003, 0x000d, 0x0000, 0x0000, 0x0006, 0x0045, 0x0019, 0x001e,
+	0x000b, 0x0042, 0x0039, 0x0046, 0x0000, 0x00b6, 0x0003, 0x0000,
+	0x013d, 0x0001, 0x0001, 0x00ae, 0x0008, 0x000d, 0x002f, 0x0005,
+	0x000f, 0x00eb, 0x0017, 0x0000, 0x008f, 0x0005, 0x0007, 0x0053,
+	0x0004, 0x0004, 0x00cb, 0x0000, 0x0000, 0x0010, 0x0010, 0x000e,
+	0x0028, 0x0009, 0x00f9, 0x0001, 0x0019, 0x002b, 0x0014, 0x0032,
+	0x0001, 0x001e, 0x001d, 0x0124, 0x0000, 0x009d, 0x005d, 0x0018,
+	0x0058, 0x0000, 0x0035, 0x0027, 0x0015, 0x00c0, 0x0034, 0x005b,
+	0x004b, 0x0071, 0x0000, 0x004b, 0x0043, 0x0005, 0x0078, 0x0060,
+	0x00f2, 0x007e, 0x0087, 0x0001, 0x0006, 0x001b, 0x0123, 0x0022,
+	0x0027, 0x0081, 0x0001, 0x00a9, 0x0013, 0x002b, 0x008a, 0x004c,
+	0x0002, 0x0003, 0x0001, 0x0016, 0x0216, 0x0098, 0x0009, 0x0003,
+	0x0001, 0x0004, 0x00f4, 0x0078, 0x001b, 0x006e, 0x0000, 0x00e5,
+	0x001a, 0x003e, 0x000e, 0x00fe, 0x0000, 0x0002, 0x0233, 0x0006,
+	0x00f5, 0x0027, 0x004e, 0x00d2, 0x002a, 0x029a, 0x0000, 0x00cb,
+	0x005d, 0x02f1, 0x001b, 0x00b6, 0x0001, 0x014c, 0x001c, 0x0082,
+	0x000d, 0x008e, 0x00e4, 0x0005, 0x0001, 0x02d3, 0x0021, 0x0179,
+	0x004f, 0x000b, 0x003a, 0x0001, 0x0001, 0x0001, 0x0002, 0x0000,
+	0x0052, 0x0051, 0x0001, 0x0001, 0x0021, 0x003e, 0x007b, 0x0031,
+	0x0000, 0x0010, 0x0008, 0x0144, 0x0045, 0x000d, 0x000f, 0x001d,
+	0x00fe, 0x00a3, 0x0000, 0x0005, 0x0014, 0x0009, 0x004e, 0x0008,
+	0x0473, 0x002d, 0x009e, 0x0003, 0x0076, 0x035e, 0x03f9, 0x000a,
+	0x0043, 0x0241, 0x03e2, 0x02bb, 0x0015, 0x0065, 0x023b, 0x00f8,
+	0x0136, 0x00aa, 0x01b6, 0x003d, 0x014e, 0x0042, 0x011b, 0x005a,
+	0x0002, 0x00ea, 0x0120, 0x0054, 0x0018, 0x0016, 0x00f7, 0x005b,
+	0x001c, 0x003f, 0x0008, 0x0034, 0x0008, 0x0000, 0x0048, 0x0002,
+	0x0048, 0x0002, 0x00bc, 0x000d, 0x0008, 0x009c, 0x00f9, 0x0051,
+	0x01e7, 0x0020, 0x0062, 0x0000, 0x006a, 0x0002, 0x0113, 0x009e,
+	0x00eb, 0x01c0, 0x0002, 0x0006, 0x0001, 0x000e, 0x0002, 0x001a,
+	0x001e, 0x01c6, 0x00bd, 0x0021, 0x007a, 0x03d6, 0x0002, 0x0010,
+	0x0000, 0x0052, 0x0011, 0x0170, 0x012e, 0x0000, 0x0182, 0x00ab,
+	0x0001, 0x0555, 0x0001, 0x0240, 0x0081, 0x006a, 0x007f, 0x0090,
+	0x001d, 0x0136, 0x000b, 0x0006, 0x00f3, 0x000f, 0x0315, 0x00b6,
+	0x0005, 0x000a, 0x0211, 0x0000, 0x03ee, 0x011e, 0x00ab, 0x0061,
+	0x0002, 0x0021, 0x0008, 0x014c, 0x0001, 0x0019, 0x006b, 0x0020,
+	0x0226, 0x0008, 0x0005, 0x020f, 0x0010, 0x006d, 0x0024, 0x0000,
+	0x001a, 0x00dc, 0x0028, 0x0122, 0x0000, 0x0003, 0x0012, 0x0006,
+	0x046d, 0x0005, 0x02c5, 0x0019, 0x0295, 0x03ee, 0x007d, 0x0056,
+	0x0447, 0x00ac, 0x0001, 0x0380, 0x0041, 0x0199, 0x0000, 0x0007,
+	0x0021, 0x0030, 0x01a7, 0x0001, 0x0003, 0x000a, 0x0022, 0x0196,
+	0x015e, 0x0004, 0x0005, 0x0061, 0x002f, 0x0000, 0x007f, 0x0094,
+	0x013b, 0x01ef, 0x010f, 0x0000, 0x00c9, 0x0000, 0x0001, 0x0019,
+	0x000a, 0x0003, 0x048e, 0x10e4, 0x0076, 0x0038, 0x0048, 0x0868,
+	0x0153, 0x0000, 0x0019, 0x0228, 0x000f, 0x01d8, 0x0180, 0x02a6,
+	0x016b, 0x0001, 0x001e, 0x01f5, 0x0013, 0x0119, 0x01bc, 0x001a,
+	0x0000, 0x0000, 0x00c0, 0x0001, 0x0302, 0x02ec, 0x005b, 0x002f,
+	0x004e, 0x0189, 0x01de, 0x0045, 0x0053, 0x0000, 0x00ad, 0x0000,
+	0x00a4, 0x0072, 0x0001, 0x0015, 0x0057, 0x0153, 0x0045, 0x030a,
+	0x0230, 0x0029, 0x0043, 0x0012, 0x0272, 0x06a8, 0x0036, 0x000f,
+	0x014d, 0x005b, 0x090c, 0x034c, 0x004d, 0x0e25, 0x001b, 0x03eb,
+	0x0007, 0x0001, 0x0182, 0x0003, 0x02bc, 0x0208, 0x015e, 0x0000,
+	0x0006, 0x01e2, 0x0025, 0x0020, 0x04bd, 0x002b, 0x0531, 0x025b,
+	0x00a5, 0x000a, 0x0001, 0x003a, 0x0068, 0x0002, 0x0005, 0x022b,
+	0x0009, 0x0012, 0x0026, 0x0010, 0x0502, 0x0000, 0x0081, 0x007a,
+	0x05b7, 0x009b, 0x0006, 0x0002, 0x00df, 0x0003, 0x0002, 0x0164,
+	0x0000, 0x00c2, 0x0002, 0x0c14, 0x000a, 0x0000, 0x0000, 0x0137,
+	0x053d, 0x00d5, 0x006c, 0x0030, 0x04fa, 0x0697, 0x0000, 0x0025,
+	0x000a, 0x0266, 0x0059, 0x0155, 0x0024, 0x07c3, 0x03be, 0x001f,
+	0x010b, 0x0158, 0x0008, 0x0a38, 0x0617, 0x0017, 0x0b09, 0x0019,
+	0x02cb, 0x0889, 0x0000, 0x00f0, 0x0049, 0x0003, 0x03fc, 0x0016,
+	0x0009, 0x2b84, 0x06d7, 0x006d, 0x000d, 0x0000, 0x00da, 0x12cb,
+	0x02fb, 0x0079, 0x0dc4, 0x005a, 0x0001, 0x0002, 0x0028, 0x0000,
+	0x0047, 0x05f8, 0x0002, 0x0010, 0x0024, 0x011c, 0x01b5, 0x001e,
+	0x053f, 0x0005, 0x0003, 0x003b, 0x02e6, 0x002a, 0x00d6, 0x0033,
+	0x085f, 0x004f, 0x010d, 0x0005, 0x05d6, 0x000a, 0x0286, 0x0474,
+	0x3b02, 0x0011, 0x041a, 0x1172, 0x302c, 0x0005, 0x002a,
+};
+
+static const u32 apfs_hash_slots[] __aligned(64) = {
+	0x0c4c10ad, 0x262910ab, 0x15cc24bc, 0x21e4fa93, 0x1dfcf98b, 0x0595e006,
+	0x1a40a798, 0x05941b73, 0x059de8d4, 0x2bd6f911, 0x0ec41e68, 0x1b5caba3,
+	0x1e20f994, 0x11581f13, 0x2d2ef967, 0x1e68f9a6, 0x1a50a7a0, 0x1ab0ab78,
+	0x2adaf8d2, 0x2e36f9a9, 0x1c1cf913, 0x2084fa39, 0x059c1ced, 0x2310fb04,
+	0x05941dea, 0x0df01e33, 0x24c904b1, 0x0ca810c4, 0x10b41ee7, 0x1b00ab8c,
+	0x05941de6, 0x0595e003, 0x29d6f891, 0x12a01f71, 0x1cecf947, 0x059c20e8,
+	0x0bbc0eb9, 0x0fc81eac, 0x2f7af9fa, 0x159422e2, 0x0d441e08, 0x2c96f941,
+	0x05940953, 0x1b0cab8f, 0x0dec1e32, 0x0595e01f, 0x15c824bb, 0x2796f801,
+	0x253904cd, 0x14d02166, 0x24390405, 0x268118ac, 0x29baf88a, 0x17082c72,
+	0x2cb2f948, 0x12641f62, 0x186c30b0, 0x1e50f9a0, 0x245d040e, 0x05a820ea,
+	0x1e74f9a9, 0x16bc2c27, 0x0bc80f4d, 0x1900a650, 0x1d10f950, 0x2a06f89d,
+	0x231cfb13, 0x2294fabf, 0x2188fa7c, 0x25dd0ca2, 0x1cdcf943, 0x0c7810b8,
+	0x144c1fe6, 0x14801ff6, 0x29c6f88d, 0x0e001e37, 0x282ef827, 0x2320fb14,
+	0x2a42f8ac, 0x0595e00b, 0x2128fa62, 0x167c2c17, 0x1544226e, 0x2fb2fa08,
+	0x1c70f928, 0x05a81ce2, 0x0b001be6, 0x0030004c, 0x0595d243, 0x059420db,
+	0x2aeef8d7, 0x2254faaf, 0x2a7af8ba, 0x0b5c0b4c, 0x21a8fa84, 0x0d541e0c,
+	0x2d1af962, 0x2000fa0c, 0x2822f824, 0x059cfe2b, 0x0594a676, 0x0594fe2e,
+	0x19a4a73c, 0x1818305e, 0x27bef80b, 0x2d4af96e, 0x2210fa9e, 0x05942dff,
+	0x0de41e30, 0x10781ed8, 0x26b118b8, 0x11041efc, 0x2220faa2, 0x059de8d2,
+	0x13b81fba, 0x1994a734, 0x1d3cf95b, 0x0595e944, 0x13341f98, 0x1ce4f945,
+	0x059ca92d, 0x0595d186, 0x250104bf, 0x29bef88b, 0x0d481e09, 0x1950a68a,
+	0x10681ed4, 0x2274fab7, 0x05a81ce6, 0x13681fa5, 0x10c41eeb, 0x2fe2fa14,
+	0x0cf81b43, 0x2e82f9bc, 0x2b92f900, 0x17a42cc6, 0x2acaf8ce, 0x190ca656,
+	0x2dcef98f, 0x0ba00d4c, 0x29e2f894, 0x24310403, 0x159022e1, 0x05942dfe,
+	0x1e94f9b1, 0x1c64f925, 0x059408f3, 0x2d32f968, 0x272de909, 0x0cbc13f9,
+	0x2f86f9fd, 0x16c42c29, 0x10ec1ef5, 0x17042c70, 0x0fa81ea4, 0x0f681e91,
+	0x13381f99, 0x2360fb33, 0x1e8cf9af, 0x1f54f9e1, 0x0594fe26, 0x05c41dcd,
+	0x2aaef8c7, 0x059dd18b, 0x150c21ce, 0x0f481e89, 0x23b4fb4d, 0x16d82c2e,
+	0x1e84f9ad, 0x11c41f32, 0x2882f83c, 0x2da2f984, 0x0594fe25, 0x2418ff38,
+	0x13181f91, 0x2779e91c, 0x0595d1aa, 0x2ca6f945, 0x1f94f9f1, 0x1f5cf9e3,
+	0x05951371, 0x1b58aba2, 0x2d76f979, 0x294ef86f, 0x28a6f845, 0x059c1ab7,
+	0x26d1d15e, 0x2174fa77, 0x13a41fb4, 0x05940829, 0x2ed2f9d0, 0x16c02c28,
+	0x28a2f844, 0x2952f870, 0x2745e90f, 0x16342c05, 0x1c00f90c, 0x27a6f805,
+	0x1afcab8b, 0x25ad0c96, 0x2c5ef933, 0x2afaf8da, 0x12dc1f82, 0x2120fa60,
+	0x25a90c95, 0x2224faa3, 0x2e6ef9b7, 0x2024fa1a, 0x05941de7, 0x00440051,
+	0x0ea81e61, 0x16782c16, 0x2f8af9fe, 0x059c20ed, 0x19d4a754, 0x0595e945,
+	0x12541f5d, 0x18f0a648, 0x0b880cc7, 0x2414ff37, 0x29c2f88c, 0x0595136b,
+	0x10e81ef4, 0x0cd41b08, 0x0fe81eb4, 0x23b8fb4e, 0x1bdcf903, 0x2ad2f8d0,
+	0x196ca698, 0x19c0a74a, 0x19aca740, 0x1c4cf91f, 0x1f38f9da, 0x11d01f35,
+	0x2d52f970, 0x19a8a73e, 0x2b9ef903, 0x2b82f8fc, 0x18583094, 0x2741e90e,
+	0x14481fe5, 0x05950a0f, 0x209cfa3f, 0x05941a75, 0x16902c1c, 0x0be00f7a,
+	0x2aa6f8c5, 0x1efcf9cb, 0x05a96af1, 0x05942df3, 0x059408fb, 0x27d6f811,
+	0x2d6af976, 0x1a98ab72, 0x11f01f3d, 0x14441fe4, 0x26010cab, 0x0d701e13,
+	0x20a8fa42, 0x1c44f91d, 0x2739e90c, 0x1e98f9b2, 0x0595e00d, 0x0b0516b6,
+	0x1a54a7a2, 0x05940823, 0x0595e01c, 0x2eaef9c7, 0x2d9af982, 0x25810c8b,
+	0x05a1d171, 0x05941dc7, 0x2c06f91d, 0x17882cb8, 0x05941de4, 0x1e40f99c,
+	0x2d3ef96b, 0x2054fa2d, 0x290ef85f, 0x0b700bcb, 0x20a4fa41, 0x05942de5,
+	0x0e8c1e5a, 0x0594a67d, 0x175c2ca2, 0x059c1cdd, 0x293af86a, 0x1bc8abbe,
+	0x100c1ebd, 0x1854307d, 0x1ca0f934, 0x2350fb2f, 0x0b3409dd, 0x2304fb01,
+	0x2218faa0, 0x059c20ec, 0x1fa4f9f5, 0x0595d242, 0x19dca758, 0x16742c15,
+	0x13401f9b, 0x0b0512ea, 0x267518a9, 0x2c42f92c, 0x222cfaa5, 0x17902cbc,
+	0x26150cb0, 0x2c6af936, 0x2ab6f8c9, 0x0ffc1eb9, 0x2cd2f950, 0x2b86f8fd,
+	0x2388fb40, 0x1d54f961, 0x1bf0f908, 0x13c01fbc, 0x2bdef913, 0x05942cef,
+	0x17ac2cca, 0x2adef8d3, 0x192ca666, 0x2701d1bf, 0x0b041bab, 0x0b900cca,
+	0x05a81cd4, 0x169c2c1f, 0x1b64aba5, 0x1f48f9de, 0x25a50c94, 0x14201fda,
+	0x0595e00a, 0x0be40f73, 0x24e104b7, 0x0bbc0eb8, 0x2c3ef92b, 0x15742288,
+	0x107c1ed9, 0x26e5d163, 0x0b05163f, 0x296ef877, 0x0b980d4a, 0x0595e00f,
+	0x2781e91e, 0x1eacf9b7, 0x0bc00ec9, 0x05951102, 0x2048fa2a, 0x26c518bd,
+	0x14cc2165, 0x1fb8f9fa, 0x11b01f2d, 0x0b04094d, 0x11941f26, 0x0594fe23,
+	0x13a01fb3, 0x21d8fa90, 0x2f1af9e2, 0x2a8af8be, 0x2e8ef9bf, 0x2170fa76,
+	0x0d881e19, 0x2238faa8, 0x13481f9d, 0x05941b6b, 0x2ba6f905, 0x059c1aba,
+	0x139c1fb2, 0x25d10c9f, 0x11381f0b, 0x05941dd3, 0x2b66f8f5, 0x16402c08,
+	0x05941dfe, 0x2a16f8a1, 0x0b011173, 0x05942df8, 0x23d8ff28, 0x2996f881,
+	0x05942df5, 0x29aaf886, 0x249d041e, 0x2dc6f98d, 0x168c2c1b, 0x0d601e0f,
+	0x0594a67b, 0x29cef88f, 0x2e62f9b4, 0x10301ec6, 0x2709e900, 0x2f66f9f5,
+	0x2284fabb, 0x0f041e78, 0x2d26f965, 0x12b01f75, 0x05940825, 0x0595e949,
+	0x2e56f9b1, 0x0fe01eb2, 0x2836f829, 0x10281ec4, 0x2ac2f8cc, 0x182c3069,
+	0x2e5af9b2, 0x059408d5, 0x0594a8eb, 0x11641f18, 0x25b50c98, 0x1dd8f982,
+	0x16582c0e, 0x203cfa22, 0x2ae6f8d5, 0x1dc8f97e, 0x13dc1fc7, 0x0595e014,
+	0x05950379, 0x2094fa3d, 0x1bb8abba, 0x1f9cf9f3, 0x2c36f929, 0x2150fa6c,
+	0x12341f52, 0x1be8f906, 0x2f0af9de, 0x23b0fb4c, 0x1954a68c, 0x284ef82f,
+	0x1b28ab96, 0x25cd0c9e, 0x2df2f998, 0x26ad18b7, 0x13101f8f, 0x1b40ab9c,
+	0x25b10c97, 0x0b051133, 0x178c2cba, 0x2eb6f9c9, 0x2a3af8aa, 0x05956b33,
+	0x2130fa64, 0x1eb8f9ba, 0x29fef89b, 0x05941de2, 0x2ec6f9cd, 0x10541ecf,
+	0x0d181c87, 0x22a4fac3, 0x2404ff33, 0x1b04ab8d, 0x2230faa6, 0x2caaf946,
+	0x0da81e21, 0x05941de0, 0x059c1a18, 0x130c1f8e, 0x10dc1ef1, 0x0b4c0a5b,
+	0x16702c14, 0x059de8d6, 0x18d430f9, 0x1f00f9cc, 0x2a56f8b1, 0x2acef8cf,
+	0x2afef8db, 0x10701ed6, 0x1d2cf957, 0x059408ec, 0x2e02f99c, 0x2812f820,
+	0x2fbafa0a, 0x25610c83, 0x1d7cf96b, 0x2344fb2c, 0x16282c02, 0x2ccef94f,
+	0x15382260, 0x1d8cf96f, 0x1bc0abbc, 0x2f4ef9ef, 0x2208fa9c, 0x15502271,
+	0x28f6f859, 0x27aaf806, 0x10d01eee, 0x27f6f819, 0x12a41f72, 0x0b800c56,
+	0x266918a6, 0x0b00a9b3, 0x15fc24c8, 0x2af6f8d9, 0x269918b2, 0x1af0ab88,
+	0x24fd04be, 0x13e01fc8, 0x2178fa78, 0x10241ec3, 0x2b02f8dc, 0x1b80abac,
+	0x17c02cd4, 0x1cf8f94a, 0x11841f22, 0x16802c18, 0x27cef80f, 0x1e60f9a4,
+	0x296af876, 0x25990c91, 0x12e81f85, 0x189c30c9, 0x16e02c62, 0x250904c1,
+	0x181c3060, 0x05a1d172, 0x16542c0d, 0x157c22ac, 0x16f02c69, 0x15282241,
+	0x13ac1fb7, 0x1d14f951, 0x15f424c6, 0x059d0a0d, 0x189830c7, 0x05a820d3,
+	0x05a96af2, 0x0dcc1e2a, 0x1938a66c, 0x1de8f986, 0x1d9cf973, 0x1c5cf923,
+	0x2d82f97c, 0x1990a732, 0x05a1d170, 0x22fcfad9, 0x0e941e5c, 0x1f80f9ec,
+	0x284af82e, 0x15642280, 0x05942de1, 0x1ab8ab7a, 0x2f5af9f2, 0x059c08ee,
+	0x05940822, 0x0c7010b6, 0x05a9d168, 0x059408e8, 0x1fc8f9fe, 0x059c193b,
+	0x287ef83b, 0x11ac1f2c, 0x243d0406, 0x05941cf9, 0x0b01e94a, 0x2d5af972,
+	0x0b040bcd, 0x2f3af9ea, 0x1f70f9e8, 0x11681f19, 0x0e481e49, 0x1980a728,
+	0x05941cf4, 0x2cfef95b, 0x05941dd2, 0x2bf6f919, 0x10741ed7, 0x2866f835,
+	0x2d62f974, 0x1f14f9d1, 0x2abaf8ca, 0x26cd18bf, 0x1fc0f9fc, 0x1a5ca7a6,
+	0x0c6410b3, 0x1a88a7b4, 0x10a01ee2, 0x29def893, 0x20b8fa46, 0x1ddcf983,
+	0x13641fa4, 0x0df41e34, 0x059c1ab5, 0x1ac4ab7d, 0x104c1ecd, 0x0e281e41,
+	0x0b18095c, 0x24b10423, 0x1b14ab91, 0x05942ded, 0x059de8d5, 0x05951369,
+	0x05942df2, 0x116c1f1a, 0x059408fd, 0x17c42cd6, 0x0d001c81, 0x26f1d1bb,
+	0x2fbefa0b, 0x2010fa15, 0x2184fa7b, 0x18443077, 0x2806f81d, 0x24890419,
+	0x0f541e8c, 0x2ea2f9c4, 0x1e88f9ae, 0x05a9d169, 0x149c1ffd, 0x0bdc0f71,
+	0x28aef847, 0x24f504bc, 0x059c0f37, 0x0b041a60, 0x11101f01, 0x2902f85c,
+	0x2d0af95e, 0x0b041734, 0x0b0c0959, 0x11501f11, 0x25690c85, 0x1ad0ab80,
+	0x05a81ce4, 0x27eef817, 0x27e2f814, 0x2c6ef937, 0x2ec2f9cc, 0x202cfa1c,
+	0x1c30f918, 0x26edd16d, 0x28def853, 0x05a820d8, 0x11b41f2e, 0x1c80f92c,
+	0x0c3410a7, 0x05941dda, 0x1d08f94e, 0x059420d1, 0x25bd0c9a, 0x138c1fae,
+	0x05941a79, 0x0a68302b, 0x2912f860, 0x253d04ce, 0x2982f87c, 0x1ec4f9bd,
+	0x1bccabbf, 0x14041fd1, 0x2e42f9ac, 0x2c66f935, 0x0ce81b3b, 0x211cfa5f,
+	0x1de0f984, 0x2896f841, 0x2f92fa00, 0x0b051442, 0x25a10c93, 0x05942dee,
+	0x00140045, 0x0a641939, 0x188830be, 0x12901f6d, 0x15e424c2, 0x059c1a7f,
+	0x268918ae, 0x1b6caba7, 0x05a00f39, 0x2832f828, 0x0b04a9c0, 0x0ef01e73,
+	0x0e181e3d, 0x059c08f9, 0x15d424be, 0x273de90d, 0x2190fa7e, 0x2c7ef93b,
+	0x28aaf846, 0x1d00f94c, 0x0d401e07, 0x187030b2, 0x0dc01e27, 0x0e581e4d,
+	0x2ce2f954, 0x118c1f24, 0x12c81f7b, 0x05956b34, 0x1ff4fa09, 0x285ef833,
+	0x13301f97, 0x2038fa20, 0x1af4ab89, 0x05941dfb, 0x14181fd8, 0x21d4fa8f,
+	0x15682281, 0x24e904b9, 0x05941dc8, 0x2b52f8f0, 0x2dfaf99a, 0x1f68f9e6,
+	0x12ec1f86, 0x15342249, 0x0f701e93, 0x15142204, 0x1810305a, 0x0595e00e,
+	0x0e401e47, 0x22ccfacd, 0x2eb2f9c8, 0x14101fd6, 0x1d70f968, 0x264114bc,
+	0x187830b6, 0x12d41f80, 0x1d80f96c, 0x1c3cf91b, 0x24a1041f, 0x21dcfa91,
+	0x2c62f934, 0x10901ede, 0x26e9d164, 0x210cfa5b, 0x12bc1f78, 0x2e12f9a0,
+	0x0594a8f1, 0x241cff39, 0x239cfb47, 0x0e301e43, 0x0cb010c7, 0x1b74aba9,
+	0x21b8fa88, 0x18cc30f7, 0x28baf84a, 0x0c141026, 0x05941dd6, 0x2270fab6,
+	0x1cccf93f, 0x15ec24c4, 0x1df8f98a, 0x0594a6f1, 0x0594082d, 0x1b98abb2,
+	0x15d824bf, 0x0b7c0c55, 0x059d0ae6, 0x13c81fc1, 0x0b780c48, 0x1cf0f948,
+	0x14381fe1, 0x18243065, 0x13981fb1, 0x16c82c2a, 0x14001fd0, 0x2408ff34,
+	0x11fc1f40, 0x12fc1f8a, 0x05956b31, 0x0c1810a0, 0x2816f821, 0x1ad4ab81,
+	0x0b051235, 0x05a1d16e, 0x05941df5, 0x0b051134, 0x1aecab87, 0x05942de3,
+	0x17c82cd8, 0x1a9cab73, 0x10581ed0, 0x0594a8f0, 0x12481f57, 0x0b480a5a,
+	0x059cfe29, 0x059408f5, 0x26050cac, 0x059408f4, 0x05951100, 0x2e4ef9af,
+	0x1a60a7a8, 0x267d18ab, 0x18e4a642, 0x0b001b34, 0x29a6f885, 0x22bcfac9,
+	0x2daef987, 0x0595d189, 0x0d801e17, 0x0f081e79, 0x288ef83f, 0x120c1f44,
+	0x17fc3050, 0x2fe6fa15, 0x0034004d, 0x14b42132, 0x2efaf9da, 0x0e5c1e4e,
+	0x0594aac1, 0x17a82cc8, 0x113c1f0c, 0x2264fab3, 0x13e41fc9, 0x2040fa25,
+	0x0f881e99, 0x05941cda, 0x1a1ca780, 0x13bc1fbb, 0x205cfa2f, 0x2e0ef99f,
+	0x2f1ef9e3, 0x220cfa9d, 0x26b518b9, 0x102c1ec5, 0x1df0f988, 0x268518ad,
+	0x2ef2f9d8, 0x2e1af9a2, 0x059408e4, 0x2d8ef97f, 0x1c38f91a, 0x18043054,
+	0x166c2c13, 0x18a830d3, 0x059c1dcf, 0x22f4fad7, 0x0ed81e6d, 0x05940826,
+	0x0b041039, 0x1bc4abbd, 0x140c1fd3, 0x15e024c1, 0x15bc24b8, 0x2da6f985,
+	0x0dd41e2c, 0x18c430dd, 0x2be2f914, 0x0b04a953, 0x1c2cf917, 0x2d66f975,
+	0x0c1c10a1, 0x2068fa32, 0x2826f825, 0x0f6c1e92, 0x0fa41ea3, 0x13881fad,
+	0x2b36f8e9, 0x11e81f3b, 0x0a64302d, 0x05941deb, 0x0c4410ab, 0x15b424b6,
+	0x2cc2f94c, 0x2bfef91b, 0x0e381e45, 0x0fac1ea5, 0x0c7c10b9, 0x1a4ca79e,
+	0x0b0110ba, 0x2ff2fa18, 0x1fb4f9f9, 0x2114fa5d, 0x2b3ef8eb, 0x2ba2f904,
+	0x0e081e39, 0x2f32f9e8, 0x2a6ef8b7, 0x0b041714, 0x278de921, 0x18343071,
+	0x2a26f8a5, 0x0b040e3a, 0x2280faba, 0x1a30a78d, 0x131c1f92, 0x2dcaf98e,
+	0x0eac1e62, 0x101c1ec1, 0x2ffefa1b, 0x0b8c0cc8, 0x2a0ef89f, 0x0594a8e6,
+	0x05941de3, 0x1cc0f93c, 0x2fdafa12, 0x0dfc1e36, 0x2b46f8ed, 0x05942de4,
+	0x1fd0fa00, 0x11481f0f, 0x160024c9, 0x12c01f79, 0x0ecc1e6a, 0x1bd4f901,
+	0x2631112f, 0x1968a696, 0x0b0515bf, 0x05950376, 0x1be4f905, 0x0594a8e7,
+	0x19a0a73a, 0x1988a72c, 0x11e01f39, 0x2018fa17, 0x0b14095b, 0x05942dfd,
+	0x1b94abb1, 0x17f0302f, 0x0b400a36, 0x05941abc, 0x2a4af8ae, 0x158422ae,
+	0x1b48ab9e, 0x15e824c3, 0x1e64f9a5, 0x0d2c1e02, 0x0e701e53, 0x2856f831,
+	0x004c0053, 0x159c22ea, 0x1f44f9dd, 0x1a00a76a, 0x0b3809df, 0x2314fb05,
+	0x05a1d166, 0x13141f90, 0x1f50f9e0, 0x0f5c1e8e, 0x250504c0, 0x05950378,
+	0x059408fe, 0x260d0cae, 0x05940818, 0x13701fa7, 0x198ca72e, 0x125c1f60,
+	0x2d92f980, 0x1548226f, 0x16ac2c23, 0x17582ca0, 0x25fd0caa, 0x17482c98,
+	0x0ebc1e66, 0x2cf2f958, 0x1aacab77, 0x05c01dfc, 0x1d4cf95f, 0x134c1f9e,
+	0x13001f8b, 0x05941cd1, 0x059c1dc2, 0x23c8ff24, 0x0cac10c5, 0x05942de2,
+	0x0eb41e64, 0x059c0f35, 0x1cd4f941, 0x0d901e1b, 0x17dc2ce2, 0x059420d5,
+	0x277de91d, 0x2455040c, 0x25850c8c, 0x3002fa1c, 0x0be00f7b, 0x0c6810b4,
+	0x2f4af9ee, 0x1e7cf9ab, 0x191ca65e, 0x059dd18a, 0x0cb813f8, 0x0595d185,
+	0x05940821, 0x05942df1, 0x0c3c10a9, 0x2e22f9a4, 0x2a96f8c1, 0x274de911,
+	0x22c0faca, 0x2f46f9ed, 0x2cbaf94a, 0x2f62f9f4, 0x2feefa17, 0x20b0fa44,
+	0x27caf80e, 0x2dbaf98a, 0x1b20ab94, 0x2e6af9b6, 0x20fcfa57, 0x279ef803,
+	0x18a030d0, 0x16cc2c2b, 0x2a7ef8bb, 0x2240faaa, 0x285af832, 0x10401eca,
+	0x2f8ef9ff, 0x2b16f8e1, 0x1bd8f902, 0x10d81ef0, 0x0fbc1ea9, 0x161024cd,
+	0x297af87a, 0x05941df1, 0x05942de7, 0x11281f07, 0x20f0fa54, 0x17102c7e,
+	0x2b6af8f6, 0x059d02e0, 0x05941df0, 0x29d2f890, 0x2b96f901, 0x2d86f97d,
+	0x1a14a77d, 0x0dbc1e26, 0x05951366, 0x16382c06, 0x0f741e94, 0x2e66f9b5,
+	0x2a2ef8a7, 0x2f6af9f6, 0x19b0a742, 0x14601feb, 0x059ca92b, 0x2625109c,
+	0x1c7cf92b, 0x1c98f932, 0x0f441e88, 0x2ff6fa19, 0x11901f25, 0x1e3cf99b,
+	0x1b68aba6, 0x288af83e, 0x17982cc0, 0x0d241e00, 0x0b05134d, 0x0594a8e3,
+	0x2168fa74, 0x159822e3, 0x1aa0ab74, 0x0f401e87, 0x0bc00ec8, 0x0b01133c,
+	0x05941ab4, 0x059c1cde, 0x2761e916, 0x1bb0abb8, 0x20d8fa4e, 0x295ef873,
+	0x0c9810c0, 0x0e7c1e56, 0x0db41e24, 0x237cfb3b, 0x27def813, 0x20bcfa47,
+	0x14f4216f, 0x00480052, 0x19eca760, 0x17d42cde, 0x232cfb17, 0x1a7ca7b1,
+	0x266d18a7, 0x1ca8f936, 0x16e42c63, 0x0d681e11, 0x2639134c, 0x17f8304e,
+	0x286ef837, 0x0b0114c3, 0x0028004a, 0x2378fb3a, 0x24790415, 0x21f8fa98,
+	0x16b82c26, 0x2a82f8bc, 0x059408e5, 0x05941ded, 0x0cfc1c80, 0x2b4af8ee,
+	0x1984a72a, 0x122c1f50, 0x05a1d16f, 0x16242c01, 0x269118b0, 0x16a82c22,
+	0x1964a694, 0x27b2f808, 0x14241fdb, 0x0c5410af, 0x0038004e, 0x2148fa6a,
+	0x2db6f989, 0x1c50f920, 0x2846f82d, 0x0fd81eb0, 0x0595e002, 0x0595e008,
+	0x24e504b8, 0x0d101c85, 0x0b3009dc, 0x22a0fac2, 0x2f56f9f1, 0x2fa6fa05,
+	0x0595e024, 0x1978a724, 0x1accab7f, 0x1d94f971, 0x0f001e77, 0x14541fe8,
+	0x1e54f9a1, 0x2a52f8b0, 0x1df4f989, 0x183c3074, 0x1b54aba1, 0x1eb0f9b8,
+	0x2200fa9a, 0x2db2f988, 0x2bc2f90c, 0x059c1dca, 0x05941dcb, 0x11341f0a,
+	0x0f4c1e8a, 0x10981ee0, 0x0c3010a6, 0x187430b4, 0x2b3af8ea, 0x11541f12,
+	0x11cc1f34, 0x0595e029, 0x1d50f960, 0x14b82160, 0x0c4010aa, 0x27faf81a,
+	0x059d0a3a, 0x1ae8ab86, 0x0b0511c0, 0x2d4ef96f, 0x188430bc, 0x1cbcf93b,
+	0x17502c9c, 0x2dd6f991, 0x267118a8, 0x2bdaf912, 0x13541fa0, 0x19d0a752,
+	0x29f6f899, 0x13d41fc4, 0x059420d6, 0x05941dc4, 0x0594135f, 0x2e86f9bd,
+	0x2140fa68, 0x18383073, 0x059408e7, 0x254d04d2, 0x0fd41eaf, 0x2ebaf9ca,
+	0x0f601e8f, 0x0594aab8, 0x24710413, 0x0e741e54, 0x1e80f9ac, 0x20d4fa4d,
+	0x2384fb3e, 0x059c1dfd, 0x21e8fa94, 0x207cfa37, 0x257d0c8a, 0x05941a7a,
+	0x21bcfa89, 0x1d64f965, 0x1d6cf967, 0x2deaf996, 0x0595037a, 0x05941dd5,
+	0x19d8a756, 0x146c1fee, 0x1fd8fa02, 0x05951374, 0x2b12f8e0, 0x2ea6f9c5,
+	0x161c2adc, 0x143c1fe2, 0x295af872, 0x14c42163, 0x1c54f921, 0x2fcafa0e,
+	0x1f40f9dc, 0x10941edf, 0x0b000abc, 0x1cb0f938, 0x13a81fb6, 0x05a81ce7,
+	0x2d06f95d, 0x1b34ab99, 0x2e96f9c1, 0x2956f871, 0x111c1f04, 0x0f501e8b,
+	0x0b04a806, 0x21a0fa82, 0x12101f45, 0x12f01f87, 0x1da4f975, 0x15c024b9,
+	0x1eb4f9b9, 0x2922f864, 0x283ef82b, 0x2374fb39, 0x0c8c10bd, 0x12e01f83,
+	0x059dd17b, 0x1f24f9d5, 0x16a42c21, 0x05941ab0, 0x18d030f8, 0x19c8a74e,
+	0x05941df4, 0x234cfb2e, 0x0594aabf, 0x13841fac, 0x1ea8f9b6, 0x1a90ab70,
+	0x0c2010a2, 0x1ce0f944, 0x2f52f9f0, 0x2c52f930, 0x256d0c86, 0x2e2af9a6,
+	0x0bac0ddd, 0x11e41f3a, 0x13581fa1, 0x258d0c8e, 0x0b04a8c4, 0x1f4cf9df,
+	0x1f1cf9d3, 0x24750414, 0x059420f0, 0x17cc2cda, 0x2c1af922, 0x10c81eec,
+	0x2b5af8f2, 0x0b440a59, 0x16302c04, 0x059c108d, 0x1fb0f9f8, 0x252504c8,
+	0x0c2410a3, 0x16882c1a, 0x0b840cc0, 0x160c24cc, 0x059c1b6c, 0x26e1d162,
+	0x059408ea, 0x1edcf9c3, 0x24d504b4, 0x1bf8f90a, 0x0595d1ad, 0x2108fa5a,
+	0x26c118bc, 0x18c030dc, 0x2771e91a, 0x21c4fa8b, 0x059408da, 0x1a0ca779,
+	0x2c86f93d, 0x2972f878, 0x059420e1, 0x0be00f7d, 0x26a918b6, 0x16982c1e,
+	0x16a02c20, 0x0af40929, 0x2c8af93e, 0x0bb80e4a, 0x18fca64e, 0x0594135e,
+	0x10f01ef6, 0x0b040b4d, 0x0fcc1ead, 0x2a5ef8b3, 0x14a42001, 0x12001f41,
+	0x1d60f964, 0x059c1cd5, 0x13501f9f, 0x17e82cf2, 0x05a96af4, 0x206cfa33,
+	0x1f74f9e9, 0x103c1ec9, 0x1f18f9d2, 0x219cfa81, 0x21a4fa83, 0x2eeaf9d6,
+	0x1dd0f980, 0x1940a682, 0x2842f82c, 0x0b040acd, 0x17402c94, 0x1a2ca78b,
+	0x1e0cf98f, 0x23fcff31, 0x16602c10, 0x0e3c1e46, 0x18e8a644, 0x2288fabc,
+	0x15b0232a, 0x0595e016, 0x1d20f954, 0x1f08f9ce, 0x059408ff, 0x0b0009bc,
+	0x14881ff8, 0x05940827, 0x0fc01eaa, 0x0f8c1e9a, 0x23acfb4b, 0x17d82ce0,
+	0x23ecff2d, 0x276de919, 0x0595e00c, 0x28bef84b, 0x2248faac, 0x0d201dce,
+	0x1ed8f9c2, 0x1fccf9ff, 0x2154fa6d, 0x197ca726, 0x0594a66f, 0x16dc2c60,
+	0x2c22f924, 0x0d0c1c84, 0x28fef85b, 0x0594a8e9, 0x1c20f914, 0x2755e913,
+	0x059dd17d, 0x233cfb2a, 0x05a820d2, 0x2f6ef9f7, 0x2e26f9a5, 0x1cb4f939,
+	0x1dacf977, 0x1e38f99a, 0x121c1f4a, 0x15a822ed, 0x0d081c83, 0x2b22f8e4,
+	0x2d5ef973, 0x0598302c, 0x165c2c0f, 0x25c90c9d, 0x0c8010ba, 0x216cfa75,
+	0x1f88f9ee, 0x0d301e03, 0x264d15bb, 0x2729e908, 0x059c1cd8, 0x136c1fa6,
+	0x1f0cf9cf, 0x0be80f74, 0x24f104bb, 0x0f9c1ea1, 0x05950377, 0x18303070,
+	0x2a8ef8bf, 0x289ef843, 0x1914a65a, 0x25f50ca8, 0x0594081f, 0x2bbaf90a,
+	0x1b3cab9b, 0x2e0af99e, 0x0acc08f0, 0x263d14bb, 0x2198fa80, 0x0e041e38,
+	0x2765e917, 0x14141fd7, 0x22f8fad8, 0x1fe8fa06, 0x24490409, 0x20f4fa55,
+	0x059408eb, 0x13cc1fc2, 0x17802cb4, 0x2719e904, 0x28daf852, 0x1bfcf90b,
+	0x2621109a, 0x2852f830, 0x14f0216e, 0x059408d6, 0x0595e017, 0x0594a8e2,
+	0x0b040ccd, 0x26a118b4, 0x0f641e90, 0x114c1f10, 0x05941a17, 0x28eaf856,
+	0x26d9d160, 0x059c085b, 0x0594081d, 0x0c5010ae, 0x0595e028, 0x059c1cd7,
+	0x18283067, 0x2759e914, 0x0b600b5c, 0x1abcab7b, 0x1e28f996, 0x059c0952,
+	0x0cd01b06, 0x16502c0c, 0x05942dfc, 0x20ecfa53, 0x0b740bcc, 0x1b84abad,
+	0x2aaaf8c6, 0x1d38f95a, 0x12381f53, 0x22b4fac7, 0x05942df6, 0x05941a7c,
+	0x1910a658, 0x1a8ca7b6, 0x185c309a, 0x2c4ef92f, 0x059cfe2c, 0x268d18af,
+	0x05942dea, 0x25550c80, 0x2f72f9f8, 0x0bd40f5c, 0x2af2f8d8, 0x14281fdd,
+	0x18c830f4, 0x1e78f9aa, 0x0b0112e9, 0x1f10f9d0, 0x267918aa, 0x0d1c1c88,
+	0x12301f51, 0x17bc2cd2, 0x11f81f3f, 0x2ceef957, 0x1dc4f97d, 0x2635134b,
+	0x2b76f8f9, 0x0594a679, 0x1f7cf9eb, 0x1fd4fa01, 0x2334fb1e, 0x059420d0,
+	0x0c000f9d, 0x1c0cf90f, 0x172c2c8a, 0x2308fb02, 0x0b000b3c, 0x0fc41eab,
+	0x0f841e98, 0x10fc1ef9, 0x1c08f90e, 0x1970a69a, 0x0e681e51, 0x23ccff25,
+	0x2250faae, 0x13941fb0, 0x1a28a786, 0x0b680b94, 0x13ec1fcb, 0x0ea01e5f,
+	0x2d16f961, 0x2ddaf992, 0x05941b72, 0x1b4cab9f, 0x002c004b, 0x0b04103a,
+	0x2d02f95c, 0x2b0ef8df, 0x0594fe24, 0x2074fa35, 0x2d42f96c, 0x0e201e3f,
+	0x22b8fac8, 0x10a81ee4, 0x2368fb35, 0x0eb81e65, 0x1e70f9a8, 0x26ddd161,
+	0x0594a8e5, 0x1f6cf9e7, 0x22f0fad6, 0x20c4fa49, 0x05a820d9, 0x2a12f8a0,
+	0x0594a8e0, 0x2c8ef93f, 0x2364fb34, 0x0cc013fa, 0x15f024c5, 0x0b000a3c,
+	0x10101ebe, 0x0c2c10a5, 0x2d56f971, 0x0b0514c2, 0x05a820eb, 0x18083056,
+	0x29b2f888, 0x0f141e7c, 0x12201f4b, 0x247d0416, 0x2b06f8dd, 0x1e5cf9a3,
+	0x05941dd9, 0x0ec81e69, 0x0bb80e49, 0x1ee0f9c4, 0x0595e000, 0x0eb01e63,
+	0x1ec8f9be, 0x17d02cdc, 0x2ef6f9d9, 0x15302247, 0x0be00f72, 0x1f64f9e5,
+	0x1ab4ab79, 0x24ed04ba, 0x2fcefa0f, 0x0c040fa2, 0x0c9c10c1, 0x2a4ef8af,
+	0x1decf987, 0x1d84f96d, 0x23a8fb4a, 0x1da8f976, 0x0f181e7d, 0x05942df7,
+	0x0594a6f0, 0x1998a736, 0x1dd4f981, 0x2c1ef923, 0x2008fa10, 0x1cfcf94b,
+	0x1c88f92e, 0x05951373, 0x21f4fa97, 0x2c9af942, 0x2cc6f94d, 0x1ea0f9b4,
+	0x05941dc3, 0x0595e01e, 0x00600058, 0x0eec1e72, 0x265118a0, 0x2c56f931,
+	0x2180fa7a, 0x23e8ff2c, 0x11241f06, 0x0b20095e, 0x15d024bd, 0x0e241e40,
+	0x16202c00, 0x05941df2, 0x1948a686, 0x2cd6f951, 0x2b0af8de, 0x26bd18bb,
+	0x292ef867, 0x0b04aaf6, 0x059de8d1, 0x25d50ca0, 0x29faf89a, 0x14d42167,
+	0x0f801e97, 0x1c28f916, 0x23f0ff2e, 0x228cfabd, 0x0c6010b2, 0x28b2f848,
+	0x13d81fc6, 0x0e981e5d, 0x264915ba, 0x2324fb15, 0x24ad0422, 0x292af866,
+	0x2a46f8ad, 0x20a0fa40, 0x1dbcf97b, 0x1cd0f940, 0x2775e91b, 0x2fdefa13,
+	0x2491041b, 0x163c2c07, 0x0a6818a9, 0x16642c11, 0x2290fabe, 0x137c1faa,
+	0x19e0a75a, 0x106c1ed5, 0x1a94ab71, 0x14501fe7, 0x28caf84e, 0x29aef887,
+	0x11801f21, 0x17e42ced, 0x059c1cd6, 0x1b10ab90, 0x19bca748, 0x19f0a762,
+	0x17742cae, 0x0595e027, 0x1cd8f942, 0x05942dfa, 0x2d46f96d, 0x2c5af932,
+	0x0d5c1e0e, 0x0595136c, 0x05941a78, 0x28cef84f, 0x1e04f98d, 0x0c8810bc,
+	0x16482c0a, 0x289af842, 0x0595e001, 0x05956b36, 0x11a41f2a, 0x27d2f810,
+	0x2ae2f8d4, 0x235cfb32, 0x05942dec, 0x14081fd2, 0x2bbef90b, 0x208cfa3b,
+	0x0e841e58, 0x0ef41e74, 0x20c0fa48, 0x261d0cb2, 0x1ef0f9c8, 0x2daaf986,
+	0x2258fab0, 0x05942df0, 0x2926f865, 0x148c1ff9, 0x05950ae5, 0x16f42c6b,
+	0x059408d7, 0x171c2c82, 0x1e9cf9b3, 0x0ff01eb6, 0x11001efa, 0x059cfe28,
+	0x1e24f995, 0x2886f83d, 0x2beef917, 0x05942de9, 0x05940816, 0x246d0412,
+	0x12141f48, 0x059420dc, 0x0fb41ea7, 0x1904a652, 0x059c1ab6, 0x13b01fb8,
+	0x24810417, 0x2204fa9b, 0x15782289, 0x189430c5, 0x2078fa36, 0x15202224,
+	0x1c10f910, 0x1bd0f900, 0x1b1cab93, 0x251904c5, 0x16d42c2d, 0x1ac0ab7c,
+	0x0c100fb9, 0x05941de1, 0x224cfaad, 0x17382c90, 0x2c76f939, 0x0ca010c2,
+	0x2a0af89e, 0x2ceaf956, 0x12741f66, 0x17a02cc4, 0x22e0fad2, 0x14701fef,
+	0x23a4fb49, 0x0e0c1e3a, 0x0d9c1e1e, 0x280af81e, 0x05942df4, 0x0594a67a,
+	0x1d58f962, 0x266118a4, 0x059c1ab9, 0x13f81fce, 0x162c2c03, 0x0b040c4d,
+	0x0595e011, 0x11781f1d, 0x0bd00f57, 0x269518b1, 0x05941dd7, 0x13281f95,
+	0x0595e015, 0x20e8fa52, 0x1e30f998, 0x18f8a64c, 0x293ef86b, 0x2b2af8e6,
+	0x1f98f9f2, 0x059408df, 0x2aeaf8d6, 0x12601f61, 0x2070fa34, 0x2a32f8a8,
+	0x1f58f9e2, 0x126c1f64, 0x0da01e1f, 0x12a81f73, 0x0e441e48, 0x05941ddc,
+	0x2de6f995, 0x176c2caa, 0x298ef87f, 0x27a2f804, 0x05941abb, 0x2e8af9be,
+	0x10841edb, 0x14941ffb, 0x2a1ef8a3, 0x185c3099, 0x0b05172b, 0x05941cd2,
+	0x00200048, 0x27daf812, 0x2d12f960, 0x25e90ca5, 0x2a02f89c, 0x199ca738,
+	0x155c2278, 0x2b72f8f8, 0x2dc2f98c, 0x0594fe22, 0x05941ddb, 0x0b000cbc,
+	0x0b050a3f, 0x0ad008f1, 0x18f4a64a, 0x253504cc, 0x20d0fa4c, 0x0c080fa7,
+	0x1af8ab8a, 0x13901faf, 0x10341ec7, 0x18d830fa, 0x2c26f925, 0x279af802,
+	0x2735e90b, 0x24d104b3, 0x0f1c1e7e, 0x1ff8fa0a, 0x28e2f854, 0x2aa2f8c4,
+	0x0595e021, 0x2c2af926, 0x2499041d, 0x10001eba, 0x17442c96, 0x2338fb1f,
+	0x05941cd0, 0x1d88f96e, 0x1944a684, 0x16fc2c6e, 0x240cff35, 0x2ecaf9ce,
+	0x0afc0934, 0x0d501e0b, 0x127c1f68, 0x2711e902, 0x0d341e04, 0x158c22e0,
+	0x05940819, 0x0b001c37, 0x2bcef90f, 0x1fa8f9f6, 0x18ac30d4, 0x29caf88e,
+	0x28f2f858, 0x05941ce0, 0x059c20ee, 0x2080fa38, 0x1c84f92d, 0x22acfac5,
+	0x0594a674, 0x2ca2f944, 0x10bc1ee9, 0x29b6f889, 0x23e0ff2a, 0x23dcff29,
+	0x22d0face, 0x2baef907, 0x00500054, 0x25910c8f, 0x0594aab2, 0x2c4af92e,
+	0x1d28f956, 0x1e6cf9a7, 0x0ef81e75, 0x110c1f00, 0x0594a8ef, 0x1db8f97a,
+	0x2118fa5e, 0x221cfaa1, 0x15b824b7, 0x2edef9d3, 0x13201f93, 0x2abef8cb,
+	0x25e50ca4, 0x29eaf896, 0x0b05107f, 0x2ccaf94e, 0x17342c8e, 0x10081ebc,
+	0x12e41f84, 0x28c2f84c, 0x189030c2, 0x0de01e2f, 0x10881edc, 0x13b41fb9,
+	0x12701f65, 0x14ec216d, 0x2228faa4, 0x24410407, 0x12501f5b, 0x2ac6f8cd,
+	0x15242226, 0x2028fa1b, 0x265518a1, 0x05951370, 0x23a0fb48, 0x1a70a7ad,
+	0x05a96af3, 0x2e9ef9c3, 0x2c2ef927, 0x13e81fca, 0x2e3ef9ab, 0x0b0409cd,
+	0x059c1abd, 0x1c90f930, 0x059dd180, 0x12d81f81, 0x1b8cabaf, 0x17002c6f,
+	0x05950a38, 0x25ed0ca6, 0x0bb80e4b, 0x188c30c0, 0x059408fc, 0x059dd181,
+	0x254504d0, 0x2f82f9fc, 0x11c01f31, 0x16d02c2c, 0x105c1ed1, 0x22c8facc,
+	0x0bb00dde, 0x059408f7, 0x156c2284, 0x059c1cd9, 0x1f04f9cd, 0x2fd6fa11,
+	0x0ad408f2, 0x10f41ef7, 0x2ed6f9d1, 0x29daf892, 0x1e08f98e, 0x1a68a7ab,
+	0x0b10095a, 0x05a96af0, 0x0595e020, 0x25890c8d, 0x2bc6f90d, 0x2358fb31,
+	0x28eef857, 0x13f41fcd, 0x2d1ef963, 0x25750c88, 0x16b02c24, 0x1f28f9d6,
+	0x2a66f8b5, 0x2906f85d, 0x1d30f958, 0x10441ecb, 0x11601f15, 0x164c2c0b,
+	0x1ad8ab82, 0x0e4c1e4a, 0x1c24f915, 0x2dfef99b, 0x184c307a, 0x0b580b4b,
+	0x0e801e57, 0x10381ec8, 0x2e7af9ba, 0x135c1fa2, 0x230cfb03, 0x1f34f9d9,
+	0x0cf01b40, 0x0bfc0f93, 0x2fc2fa0c, 0x223cfaa9, 0x18003052, 0x2faefa07,
+	0x26c918be, 0x2cbef94b, 0x14641fec, 0x0594a8e1, 0x22a8fac4, 0x1fbcf9fb,
+	0x0dac1e22, 0x0d281e01, 0x194ca688, 0x2f02f9dc, 0x18b830d9, 0x13fc1fcf,
+	0x24690411, 0x22d8fad0, 0x10b01ee6, 0x265d18a3, 0x05941dec, 0x25d90ca1,
+	0x0b0417d2, 0x0594a69f, 0x26d5d15f, 0x1e18f992, 0x14fc219a, 0x1974a722,
+	0x0d041c82, 0x2090fa3c, 0x11a81f2b, 0x1b90abb0, 0x25c50c9c, 0x00040041,
+	0x2ebef9cb, 0x059dd17e, 0x2862f834, 0x0f581e8d, 0x12b81f77, 0x0f241e80,
+	0x0c7410b7, 0x11441f0e, 0x27c2f80c, 0x147c1ff4, 0x0c0c0fac, 0x1aa4ab75,
+	0x0fec1eb5, 0x05951368, 0x19c4a74c, 0x2461040f, 0x2bfaf91a, 0x0ce41b12,
+	0x299af882, 0x059408f8, 0x11181f03, 0x0594082a, 0x28d6f851, 0x05941a7b,
+	0x201cfa18, 0x0df81e35, 0x0e881e59, 0x0cc413fb, 0x0c4810ac, 0x05a90a39,
+	0x2058fa2e, 0x12441f56, 0x2380fb3c, 0x1f20f9d4, 0x0594a69e, 0x0f2c1e82,
+	0x2ddef993, 0x0595e012, 0x0b2c09cc, 0x1d04f94d, 0x0cb410cd, 0x05941def,
+	0x21c8fa8c, 0x2bd2f910, 0x11f41f3e, 0x2330fb1d, 0x059c08fa, 0x1e58f9a2,
+	0x2edaf9d2, 0x05941de8, 0x161824cf, 0x0d641e10, 0x17782cb0, 0x2298fac0,
+	0x10601ed2, 0x150821cd, 0x0594aabe, 0x21acfa85, 0x1e44f99d, 0x15702285,
+	0x14781ff3, 0x00640059, 0x0594aab3, 0x1c58f922, 0x2b4ef8ef, 0x19b8a746,
+	0x2f5ef9f3, 0x24d904b5, 0x0594081e, 0x1b24ab95, 0x1e00f98c, 0x248d041a,
+	0x17282c88, 0x142c1fde, 0x00580056, 0x18b430d7, 0x250d04c2, 0x287af83a,
+	0x05941cf8, 0x17302c8c, 0x0f781e95, 0x1be0f904, 0x28c6f84d, 0x108c1edd,
+	0x059c1dff, 0x2b8af8fe, 0x1ea4f9b5, 0x17142c7f, 0x0e901e5b, 0x2936f869,
+	0x0595d244, 0x11201f05, 0x186430ac, 0x1b44ab9d, 0x24c10427, 0x1dc0f97c,
+	0x1a18a77e, 0x1c34f919, 0x0db01e23, 0x059c1cdc, 0x16842c19, 0x05a81ce3,
+	0x0594a8e4, 0x0ee81e71, 0x2a3ef8ab, 0x24b50424, 0x2a9ef8c3, 0x1adcab83,
+	0x2f12f9e0, 0x20f8fa56, 0x2992f880, 0x27fef81b, 0x0dc41e28, 0x153c2262,
+	0x1d44f95d, 0x161424ce, 0x0595136a, 0x2451040b, 0x0fdc1eb1, 0x2b2ef8e7,
+	0x2d2af966, 0x158822af, 0x0d4c1e0a, 0x05941dc6, 0x1918a65c, 0x0595e947,
+	0x2b62f8f4, 0x229cfac1, 0x14901ffa, 0x0bb80e48, 0x1540226d, 0x0d941e1c,
+	0x1bf4f909, 0x059408de, 0x059420e7, 0x2110fa5c, 0x2de2f994, 0x28faf85a,
+	0x2fd2fa10, 0x2f22f9e4, 0x2390fb43, 0x2cdef953, 0x05942def, 0x11741f1c,
+	0x20e4fa51, 0x059ca92c, 0x17602ca4, 0x262d112e, 0x0b011446, 0x0595e013,
+	0x16942c1d, 0x2c7af93a, 0x0b6c0bca, 0x12241f4c, 0x059c08e3, 0x003c004f,
+	0x13041f8c, 0x1a04a76c, 0x0ff41eb7, 0x11401f0d, 0x19e4a75c, 0x2f26f9e5,
+	0x0b9c0d4b, 0x2214fa9f, 0x1e14f991, 0x2cb6f949, 0x2caef947, 0x24250400,
+	0x21c0fa8a, 0x10641ed3, 0x26a518b5, 0x1a34a790, 0x0cec1b3d, 0x2df6f999,
+	0x2dbef98b, 0x0b3c0a33, 0x26f5d1bc, 0x05942deb, 0x059c0859, 0x0fb01ea6,
+	0x05a820e5, 0x14581fe9, 0x151c220c, 0x059408dd, 0x0594a677, 0x18dc30fe,
+	0x25b90c99, 0x2318fb06, 0x2c3af92a, 0x2a86f8bd, 0x1d98f972, 0x2050fa2c,
+	0x129c1f70, 0x13c41fbe, 0x2f36f9e9, 0x11701f1b, 0x059408d9, 0x25c10c9b,
+	0x1924a662, 0x1f90f9f0, 0x2144fa69, 0x1b2cab97, 0x10e01ef2, 0x0ed41e6c,
+	0x0be00f7c, 0x2beaf916, 0x0e6c1e52, 0x2244faab, 0x0f281e81, 0x16f82c6d,
+	0x0f301e83, 0x2a2af8a6, 0x2e3af9aa, 0x19f8a766, 0x2d9ef983, 0x2f06f9dd,
+	0x05940f82, 0x05941dde, 0x29f2f898, 0x23c0ff22, 0x128c1f6c, 0x15dc24c0,
+	0x05941ab1, 0x059cfe2a, 0x2ee6f9d5, 0x1850307c, 0x0dd01e2b, 0x059420d7,
+	0x0594a8ee, 0x280ef81f, 0x2e2ef9a7, 0x2802f81c, 0x1c78f92a, 0x2fb6fa09,
+	0x1cc4f93d, 0x12f81f89, 0x1c8cf92f, 0x2eeef9d7, 0x13801fab, 0x0dc81e29,
+	0x133c1f9a, 0x1500219b, 0x0594193a, 0x0594fe21, 0x1a44a79a, 0x213cfa67,
+	0x059dd17f, 0x0595e004, 0x12881f6b, 0x1b9cabb3, 0x13441f9c, 0x0595e948,
+	0x2278fab8, 0x0594a8ed, 0x2c92f940, 0x14841ff7, 0x059c08f6, 0x0b042d7f,
+	0x1d0cf94f, 0x270de901, 0x0f101e7b, 0x0c5810b0, 0x0e601e4f, 0x281af822,
+	0x1ffcfa0b, 0x1a3ca796, 0x1fc4f9fd, 0x23c4ff23, 0x0595d1ac, 0x1f84f9ed,
+	0x00080042, 0x2e72f9b8, 0x11bc1f30, 0x2e7ef9bb, 0x1ee4f9c5, 0x1f8cf9ef,
+	0x0d981e1d, 0x23e4ff2b, 0x0ea41e60, 0x0bc00ecb, 0x154c2270, 0x05941dd8,
+	0x1f3cf9db, 0x226cfab5, 0x26b918ba, 0x1ed0f9c0, 0x170c2c75, 0x12841f6a,
+	0x2e32f9a8, 0x12181f49, 0x1d90f970, 0x0e9c1e5e, 0x2164fa73, 0x218cfa7d,
+	0x14301fdf, 0x1c48f91e, 0x282af826, 0x05a81ce5, 0x05a820da, 0x2705d1c0,
+	0x23d4ff27, 0x10b81ee8, 0x2fc6fa0d, 0x24bd0426, 0x0b041bf2, 0x2c32f928,
+	0x24350404, 0x17e02ceb, 0x141c1fd9, 0x14341fe0, 0x059c0fc6, 0x254904d1,
+	0x1d40f95c, 0x2b5ef8f3, 0x193ca680, 0x0b0510b9, 0x0595e946, 0x195ca690,
+	0x2354fb30, 0x286af836, 0x0594082b, 0x24a50420, 0x0d7c1e16, 0x1ebcf9bb,
+	0x173c2c92, 0x20acfa43, 0x05941dc1, 0x160424ca, 0x1fdcfa03, 0x059cfe2d,
+	0x0594a8ea, 0x14ac212a, 0x059c085a, 0x266518a5, 0x119c1f28, 0x059408dc,
+	0x26110caf, 0x0e141e3c, 0x2d96f981, 0x2d0ef95f, 0x0595e018, 0x2b7ef8fb,
+	0x0595e005, 0x05942cf1, 0x12b41f76, 0x2420ff3a, 0x05942cf0, 0x20b4fa45,
+	0x13241f94, 0x2b9af902, 0x1a38a792, 0x2bb6f909, 0x2cf6f959, 0x1b18ab92,
+	0x05940817, 0x2c12f920, 0x13f01fcc, 0x2a5af8b2, 0x1a6ca7ac, 0x25710c87,
+	0x059cfe27, 0x290af85e, 0x1814305c, 0x05940f86, 0x1e2cf997, 0x059420e9,
+	0x059c20ef, 0x0f341e84, 0x14f82183, 0x2c0af91e, 0x1d1cf953, 0x2e52f9b0,
+	0x05940f87, 0x0bb40e39, 0x2a1af8a2, 0x1ba8abb6, 0x16e82c64, 0x19cca750,
+	0x1bacabb7, 0x0f0c1e7a, 0x27e6f815, 0x0b051046, 0x0b040a4d, 0x2feafa16,
+	0x11d41f36, 0x25590c81, 0x0bb40e38, 0x059c1cdf, 0x24850418, 0x1f78f9ea,
+	0x059408d4, 0x1c9cf933, 0x05941dee, 0x0594fe2f, 0x10d41eef, 0x2725e907,
+	0x27eaf816, 0x2f42f9ec, 0x05942de6, 0x00100044, 0x14741ff2, 0x297ef87b,
+	0x0f381e85, 0x00240049, 0x1c68f926, 0x0bf40f78, 0x12281f4d, 0x16ec2c67,
+	0x0d841e18, 0x2f3ef9eb, 0x059dd17c, 0x238cfb41, 0x05941cdb, 0x115c1f14,
+	0x11081efe, 0x2370fb38, 0x2f76f9f9, 0x1facf9f7, 0x0d781e15, 0x20dcfa4f,
+	0x1e4cf99f, 0x0594fe20, 0x0bec0f75, 0x0e501e4b, 0x000c0043, 0x0b940ccb,
+	0x2459040d, 0x2731e90a, 0x0fb81ea8, 0x22c4facb, 0x0e781e55, 0x13741fa8,
+	0x0d741e14, 0x281ef823, 0x1b78abaa, 0x24650410, 0x12ac1f74, 0x1a08a76e,
+	0x2f2ef9e7, 0x24290401, 0x2398fb46, 0x177c2cb2, 0x1d68f966, 0x1cf4f949,
+	0x14e0216a, 0x269d18b3, 0x0edc1e6e, 0x1c94f931, 0x19fca768, 0x2d6ef977,
+	0x251104c3, 0x05941b6f, 0x2044fa26, 0x2e06f99d, 0x0b00093c, 0x259d0c92,
+	0x2e9af9c2, 0x27aef807, 0x1fa0f9f4, 0x244d040a, 0x10481ecc, 0x0f901e9b,
+	0x0c9410bf, 0x158022ad, 0x05941a76, 0x12c41f7a, 0x2785e91f, 0x2098fa3e,
+	0x1ac8ab7e, 0x2efef9db, 0x2d7af97a, 0x0d581e0d, 0x1c40f91c, 0x0b24095f,
+	0x24cd04b2, 0x1e1cf993, 0x0e541e4c, 0x0b1c095d, 0x2e5ef9b3, 0x18eca646,
+	0x112c1f08, 0x18403076, 0x252904c9, 0x0b0111ca, 0x0de81e31, 0x2348fb2d,
+	0x059420d4, 0x1ee8f9c6, 0x2976f879, 0x15182209, 0x10501ece, 0x17242c86,
+	0x1c60f924, 0x17202c84, 0x2c16f921, 0x2f9afa02, 0x2b1af8e2, 0x12d01f7d,
+	0x1f30f9d8, 0x2c46f92d, 0x05941b6e, 0x10c01eea, 0x2030fa1d, 0x05a9d167,
+	0x2bf2f918, 0x2d3af96a, 0x23bcff21, 0x10cc1eed, 0x0ba40dda, 0x22d4facf,
+	0x05940951, 0x0594a678, 0x1a78a7b0, 0x242d0402, 0x05942df9, 0x291ef863,
+	0x1920a660, 0x13d01fc3, 0x20c8fa4a, 0x0cd81b0a, 0x2004fa0d, 0x05a1d165,
+	0x2e76f9b9, 0x22e8fad4, 0x05941dd4, 0x0595e009, 0x10e41ef3, 0x1ef4f9c9,
+	0x0ee41e70, 0x252d04ca, 0x21b0fa86, 0x0b041b44, 0x0d6c1e12, 0x19f4a764,
+	0x2ffafa1a, 0x10181ec0, 0x1c6cf927, 0x059c08e6, 0x15f824c7, 0x0b041baa,
+	0x150421ae, 0x05956b35, 0x05941b6d, 0x2b7af8fa, 0x2fa2fa04, 0x005c0057,
+	0x059de8d3, 0x152c2244, 0x255d0c82, 0x0ee01e6f, 0x13781fa9, 0x0b500a5e,
+	0x05941b70, 0x294af86e, 0x1cb8f93a, 0x0bd80f69, 0x2b42f8ec, 0x0be00f80,
+	0x17682ca8, 0x12781f67, 0x0c8410bb, 0x0d381e05, 0x151021cf, 0x2034fa1e,
+	0x1c18f912, 0x0594a67c, 0x15a022eb, 0x14c02162, 0x0e2c1e42, 0x1de4f985,
+	0x16b42c25, 0x05941df3, 0x059408d8, 0x24b90425, 0x1b30ab98, 0x15ac2329,
+	0x0595e010, 0x1fecfa07, 0x1a24a784, 0x2495041c, 0x059caab4, 0x1ba0abb4,
+	0x17f0302e, 0x2088fa3a, 0x0ce01b0e, 0x00540055, 0x0b001037, 0x05941dc0,
+	0x1d74f969, 0x186830ae, 0x23d0ff26, 0x05951372, 0x1860309e, 0x1ca4f935,
+	0x0594a8e8, 0x2be6f915, 0x2a62f8b4, 0x1ec0f9bc, 0x14e8216c, 0x2eaaf9c6,
+	0x2dd2f990, 0x1a58a7a4, 0x1cacf937, 0x1aa8ab76, 0x1b38ab9a, 0x05a41dd0,
+	0x0e341e44, 0x17842cb6, 0x2769e918, 0x2064fa31, 0x14681fed, 0x05a9bc9e,
+	0x05941ab3, 0x0af80931, 0x24c504b0, 0x236cfb36, 0x26190cb1, 0x14e4216b,
+	0x24a90421, 0x05941dc9, 0x0595d187, 0x059c08ed, 0x14a02000, 0x059de8d0,
+	0x26f9d1bd, 0x05940820, 0x1908a654, 0x18203062, 0x2892f840, 0x0b041bf3,
+	0x2a22f8a4, 0x1b7cabab, 0x179c2cc2, 0x21d0fa8e, 0x10a41ee3, 0x0d8c1e1a,
+	0x12941f6e, 0x0cdc1b0c, 0x0b2809cb, 0x2260fab2, 0x11ec1f3c, 0x2d7ef97b,
+	0x19b4a744, 0x1d18f952, 0x24450408, 0x1e48f99e, 0x05941ddd, 0x14981ffc,
+	0x24f904bd, 0x2b32f8e8, 0x2946f86d, 0x059c08e9, 0x0f3c1e86, 0x2c9ef943,
+	0x298af87e, 0x1b50aba0, 0x109c1ee1, 0x0fe41eb3, 0x1ce8f946, 0x2a76f8b9,
+	0x2a36f8a9, 0x12681f63, 0x1f60f9e4, 0x0f981ea0, 0x15c424ba, 0x14dc2169,
+	0x1b60aba4, 0x21ecfa95, 0x0cf41b41, 0x25f90ca9, 0x0595d188, 0x2b8ef8ff,
+	0x0594aab0, 0x0c6c10b5, 0x0594aab7, 0x1928a664, 0x059c08ef, 0x2a9af8c2,
+	0x0b040f84, 0x2394fb44, 0x12581f5f, 0x0d3c1e06, 0x2340fb2b, 0x215cfa71,
+	0x0d141c86, 0x0fa01ea2, 0x14bc2161, 0x16682c12, 0x11141f02, 0x0c3810a8,
+	0x253104cb, 0x0b051c3f, 0x0594081c, 0x10ac1ee5, 0x0c2810a4, 0x2c72f938,
+	0x160824cb, 0x05942de8, 0x0ddc1e2e, 0x17942cbe, 0x2baaf906, 0x2410ff36,
+	0x22dcfad1, 0x00180046, 0x1eccf9bf, 0x18bc30da, 0x0bf00f76, 0x15542274,
+	0x2158fa70, 0x16442c09, 0x2d36f969, 0x0ed01e6b, 0x3006fa1d, 0x2876f839,
+	0x1d34f959, 0x1e34f999, 0x0ca410c3, 0x0594a675, 0x2b56f8f1, 0x2160fa72,
+	0x0dd81e2d, 0x1a74a7ae, 0x117c1f20, 0x187c30b8, 0x21fcfa99, 0x0ba80ddc,
+	0x27f2f818, 0x14d82168, 0x059dd182, 0x14c82164, 0x1d48f95e, 0x2ee2f9d4,
+	0x0f201e7f, 0x059408e0, 0x2789e920, 0x25790c89, 0x0b040d4d, 0x28d2f850,
+	0x0595e01b, 0x1a48a79c, 0x12981f6f, 0x1d24f955, 0x1930a668, 0x2134fa65,
+	0x1ed4f9c1, 0x15602279, 0x12041f42, 0x2f7ef9fb, 0x2916f861, 0x251d04c6,
+	0x0594a8ec, 0x1c74f929, 0x059c0f19, 0x10f81ef8, 0x17b02ccc, 0x05941b71,
+	0x0b0115c0, 0x1d5cf963, 0x254104cf, 0x200cfa12, 0x214cfa6b, 0x05a820e6,
+	0x1ae4ab85, 0x17f4304c, 0x2400ff32, 0x2749e910, 0x2792f800, 0x0b640b5d,
+	0x217cfa79, 0x225cfab1, 0x0db81e25, 0x2a92f8c0, 0x05941dcc, 0x059408db,
+	0x275de915, 0x0efc1e76, 0x0ccc13fd, 0x2962f874, 0x12801f69, 0x11881f23,
+	0x0ec01e67, 0x180c3058, 0x2ab2f8c8, 0x2ad6f8d1, 0x25e10ca3, 0x059d01fd,
+	0x11a01f29, 0x0fd01eae, 0x1bb4abb9, 0x0da41e20, 0x18b030d6, 0x21b4fa87,
+	0x2cfaf95a, 0x251504c4, 0x2f9efa03, 0x059c1ab8, 0x1a64a7aa, 0x2ce6f955,
+	0x12cc1f7c, 0x27c6f80d, 0x2124fa61, 0x1a84a7b3, 0x1d78f96a, 0x2100fa58,
+	0x1becf907, 0x0e641e50, 0x145c1fea, 0x1dccf97f, 0x23f4ff2f, 0x1fe0fa04,
+	0x17702cac, 0x05956b30, 0x11dc1f38, 0x188030ba, 0x1eecf9c7, 0x1b70aba8,
+	0x2932f868, 0x13601fa3, 0x2014fa16, 0x299ef883, 0x1cc8f93e, 0x2bb2f908,
+	0x0f7c1e96, 0x21ccfa8d, 0x2a6af8b6, 0x12f41f88, 0x10141ebf, 0x174c2c9a,
+	0x2328fb16, 0x0595d1ab, 0x28b6f849, 0x0e1c1e3e, 0x22b0fac6, 0x11301f09,
+	0x1fe4fa05, 0x05942de0, 0x2e16f9a1, 0x10201ec2, 0x21e0fa92, 0x05940954,
+	0x0b0116b7, 0x0595e02a, 0x001c0047, 0x2104fa59, 0x2f16f9e1, 0x05941de9,
+	0x0595e023, 0x1bbcabbb, 0x10801eda, 0x05941dc5, 0x2b26f8e5, 0x05a81ce8,
+	0x2942f86c, 0x26fdd1be, 0x0ff81eb8, 0x0cc813fc, 0x212cfa63, 0x0068005a,
+	0x1b88abae, 0x11c81f33, 0x1db0f978, 0x2faafa06, 0x05951367, 0x2ecef9cf,
+	0x18e0a640, 0x059c0f18, 0x17642ca6, 0x2751e912, 0x05941dd1, 0x0b011236,
+	0x1e90f9b0, 0x0595e026, 0x2b1ef8e3, 0x2060fa30, 0x1c14f911, 0x0b04abed,
+	0x1db4f979, 0x2d22f964, 0x2c02f91c, 0x25950c90, 0x05941a77, 0x265918a2,
+	0x291af862, 0x2e92f9c0, 0x2268fab4, 0x26090cad, 0x124c1f59, 0x18483079,
+	0x255104d3, 0x132c1f96, 0x2f0ef9df, 0x204cfa2b, 0x283af82a, 0x15a422ec,
+	0x29e6f895, 0x14a82126, 0x10041ebb, 0x2138fa66, 0x2d72f978, 0x25650c84,
+	0x20ccfa4b, 0x252104c7, 0x27baf80a, 0x0b040dca, 0x0b080958, 0x0594081b,
+	0x1ef8f9ca, 0x1934a66a, 0x227cfab9, 0x0e101e3b, 0x05941ab2, 0x17b82cd0,
+	0x2e46f9ad, 0x0f941e9e, 0x17182c80, 0x22e4fad3, 0x059408e1, 0x0bc00eca,
+	0x2cdaf952, 0x2872f838, 0x2c82f93c, 0x2d8af97e, 0x17b42cce, 0x0b540b48,
+	0x1960a692, 0x05941ddf, 0x2234faa7, 0x1a10a77b, 0x2020fa19, 0x1da0f974,
+	0x28e6f855, 0x1e10f990, 0x2194fa7f, 0x17542c9e, 0x2bcaf90e, 0x25f10ca7,
+	0x1f2cf9d7, 0x15582275, 0x13081f8d, 0x2721e906, 0x1a20a782, 0x2deef997,
+	0x1ba4abb5, 0x2f2af9e6, 0x0bf80f81, 0x123c1f54, 0x0c5c10b1, 0x2966f875,
+	0x27b6f809, 0x12401f55, 0x05951101, 0x19e8a75e, 0x0594135d, 0x00400050,
+	0x1a80a7b2, 0x18a430d1, 0x12081f43, 0x11b81f2f, 0x20e0fa50, 0x05956b32,
+	0x11d81f37, 0x05940f83, 0x2300fb00, 0x22ecfad5, 0x059417dd, 0x2715e903,
+	0x264514be, 0x271de905, 0x2b6ef8f7, 0x23f8ff30, 0x24dd04b6, 0x0c9010be,
+	0x1958a68e, 0x0bc40f43, 0x1c04f90d, 0x2986f87d, 0x2e4af9ae, 0x14b0212b,
+	0x0bcc0f52, 0x29a2f884, 0x1b08ab8e, 0x05941de5, 0x11981f27, 0x05942dfb,
+	0x1ae0ab84, 0x1ff0fa08, 0x14401fe3, 0x2f96fa01, 0x2a72f8b8, 0x17ec302a,
+	0x0595e01d, 0x29eef897, 0x21f0fa96, 0x2c0ef91f, 0x2e1ef9a3, 0x0594082c,
+};
+
+static const struct apfs_unidata apfs_unidata[] __aligned(64) = {
+	{0x0000, 0x0000,   0}, {0x0000, 0x0001,   0}, {0x0000, 0x0009,   0},
+	{0x0000, 0x0011,   0}, {0x0000, 0x0019,   0}, {0x0000, 0x0021,   0},
+	{0x0000, 0x0029,   0}, {0x0000, 0x0031,   0}, {0x0000, 0x0039,   0},
+	{0x0000, 0x0041,   0}, {0x0000, 0x0049,   0}, {0x0000, 0x0051,   0},
+	{0x0000, 0x0059,   0}, {0x0000, 0x0061,   0}, {0x0000, 0x0069,   0},
+	{0x0000, 0x0071,   0}, {0x0000, 0x0079,   0}, {0x0000, 0x0081,   0},
+	{0x0000, 0x0089,   0}, {0x0000, 0x0091,   0}, {0x0000, 0x0099,   0},
+	{0x0000, 0x00a1,   0}, {0x0000, 0x00a9,   0}, {0x0000, 0x00b1,   0},
+	{0x0000, 0x00b9,   0}, {0x0000, 0x00c1,   0}, {0x0000, 0x00c9,   0},
+	{0x0000, 0x00d1,   0}, {0x0002, 0x00da,   0}, {0x0012, 0x00ea,   0},
+	{0x0022, 0x00fa,   0}, {0x0032, 0x010a,   0}, {0x0042, 0x011a,   0},
+	{0x0052, 0x012a,   0}, {0x0000, 0x0139,   0}, {0x0062, 0x0142,   0},
+	{0x0072, 0x0152,   0}, {0x0082, 0x0162,   0}, {0x0092, 0x0172,   0},
+	{0x00a2, 0x0182,   0}, {0x00b2, 0x0192,   0}, {0x00c2, 0x01a2,   0},
+	{0x00d2, 0x01b2,   0}, {0x00e2, 0x01c2,   0}, {0x0000, 0x01d1,   0},
+	{0x00f2, 0x01da,   0}, {0x0102, 0x01ea,   0}, {0x0112, 0x01fa,   0},
+	{0x0122, 0x020a,   0}, {0x0132, 0x021a,   0}, {0x0142, 0x022a,   0},
+	{0x0000, 0x0239,   0}, {0x0152, 0x0242,   0}, {0x0162, 0x0252,   0},
+	{0x0172, 0x0262,   0}, {0x0182, 0x0272,   0}, {0x0192, 0x0282,   0},
+	{0x0000, 0x0291,   0}, {0x0000, 0x029a,   0}, {0x01a2, 0x02aa,   0},
+	{0x01b2, 0x02ba,   0}, {0x01c2, 0x02ca,   0}, {0x01d2, 0x02da,   0},
+	{0x01e2, 0x02ea,   0}, {0x01f2, 0x02fa,   0}, {0x0202, 0x030a,   0},
+	{0x0212, 0x031a,   0}, {0x0222, 0x032a,   0}, {0x0232, 0x033a,   0},
+	{0x0242, 0x034a,   0}, {0x0252, 0x035a,   0}, {0x0262, 0x036a,   0},
+	{0x0272, 0x037a,   0}, {0x0282, 0x038a,   0}, {0x0292, 0x039a,   0},
+	{0x02a2, 0x03aa,   0}, {0x02b2, 0x03ba,   0}, {0x02c2, 0x03ca,   0},
+	{0x02d2, 0x03da,   0}, {0x02e2, 0x03ea,   0}, {0x02f2, 0x03fa,   0},
+	{0x0302, 0x040a,   0}, {0x0312, 0x041a,   0}, {0x0322, 0x042a,   0},
+	{0x0332, 0x043a,   0}, {0x0342, 0x044a,   0}, {0x0352, 0x045a,   0},
+	{0x0362, 0x046a,   0}, {0x0372, 0x047a,   0}, {0x0382, 0x048a,   0},
+	{0x0392, 0x049a,   0}, {0x03a2, 0x04aa,   0}, {0x03b2, 0x04ba,   0},
+	{0x03c2, 0x04ca,   0}, {0x03d2, 0x04da,   0}, {0x03e2, 0x04ea,   0},
+	{0x03f2, 0x04fa,   0}, {0x0402, 0x050a,   0}, {0x0412, 0x051a,   0},
+	{0x0422, 0x052a,   0}, {0x0432, 0x053a,   0}, {0x0442, 0x054a,   0},
+	{0x0000, 0x0559,   0}, {0x0452, 0x0562,   0}, {0x0462, 0x0572,   0},
+	{0x0472, 0x0582,   0}, {0x0482, 0x0592,   0}, {0x0492, 0x05a2,   0},
+	{0x04a2, 0x05b2,   0}, {0x04b2, 0x05c2,   0}, {0x04c2, 0x05d2,   0},
+	{0x04d2, 0x05e2,   0}, {0x04e2, 0x05f2,   0}, {0x04f2, 0x0602,   0},
+	{0x0502, 0x0612,   0}, {0x0512, 0x0622,   0}, {0x0522, 0x0632,   0},
+	{0x0532, 0x0642,   0}, {0x0542, 0x0652,   0}, {0x0552, 0x0662,   0},
+	{0x0562, 0x0672,   0}, {0x0572, 0x0682,   0}, {0x0582, 0x0692,   0},
+	{0x0000, 0x06a1,   0}, {0x0592, 0x06aa,   0}, {0x05a2, 0x06ba,   0},
+	{0x05b2, 0x06ca,   0}, {0x05c2, 0x06da,   0}, {0x05d2, 0x06ea,   0},
+	{0x05e2, 0x06fa,   0}, {0x05f2, 0x070a,   0}, {0x0602, 0x071a,   0},
+	{0x0612, 0x072a,   0}, {0x0000, 0x0739,   0}, {0x0622, 0x0742,   0},
+	{0x0632, 0x0752,   0}, {0x0642, 0x0762,   0}, {0x0652, 0x0772,   0},
+	{0x0662, 0x0782,   0}, {0x0672, 0x0792,   0}, {0x0682, 0x07a2,   0},
+	{0x0692, 0x07b2,   0}, {0x06a2, 0x07c2,   0}, {0x06b2, 0x07d2,   0},
+	{0x0000, 0x07e1,   0}, {0x0000, 0x07e9,   0}, {0x06c2, 0x07f2,   0},
+	{0x06d2, 0x0802,   0}, {0x06e2, 0x0812,   0}, {0x06f2, 0x0822,   0},
+	{0x0702, 0x0832,   0}, {0x0712, 0x0842,   0}, {0x0000, 0x0852,   0},
+	{0x0000, 0x0861,   0}, {0x0722, 0x086a,   0}, {0x0732, 0x087a,   0},
+	{0x0742, 0x088a,   0}, {0x0752, 0x089a,   0}, {0x0762, 0x08aa,   0},
+	{0x0772, 0x08ba,   0}, {0x0000, 0x08c9,   0}, {0x0782, 0x08d2,   0},
+	{0x0792, 0x08e2,   0}, {0x07a2, 0x08f2,   0}, {0x07b2, 0x0902,   0},
+	{0x07c2, 0x0912,   0}, {0x07d2, 0x0922,   0}, {0x07e2, 0x0932,   0},
+	{0x07f2, 0x0942,   0}, {0x0802, 0x0952,   0}, {0x0812, 0x0962,   0},
+	{0x0822, 0x0972,   0}, {0x0832, 0x0982,   0}, {0x0842, 0x0992,   0},
+	{0x0852, 0x09a2,   0}, {0x0862, 0x09b2,   0}, {0x0872, 0x09c2,   0},
+	{0x0882, 0x09d2,   0}, {0x0892, 0x09e2,   0}, {0x0000, 0x09f1,   0},
+	{0x08a2, 0x09fa,   0}, {0x08b2, 0x0a0a,   0}, {0x08c2, 0x0a1a,   0},
+	{0x08d2, 0x0a2a,   0}, {0x08e2, 0x0a3a,   0}, {0x08f2, 0x0a4a,   0},
+	{0x0902, 0x0a5a,   0}, {0x0912, 0x0a6a,   0}, {0x0922, 0x0a7a,   0},
+	{0x0932, 0x0a8a,   0}, {0x0942, 0x0a9a,   0}, {0x0952, 0x0aaa,   0},
+	{0x0962, 0x0aba,   0}, {0x0972, 0x0aca,   0}, {0x0982, 0x0ada,   0},
+	{0x0992, 0x0aea,   0}, {0x09a2, 0x0afa,   0}, {0x09b2, 0x0b0a,   0},
+	{0x09c2, 0x0b1a,   0}, {0x09d2, 0x0b2a,   0}, {0x09e2, 0x0b3a,   0},
+	{0x09f2, 0x0b4a,   0}, {0x0a02, 0x0b5a,   0}, {0x0000, 0x0b69,   0},
+	{0x0000, 0x0b71,   0}, {0x0000, 0x0b79,   0}, {0x0000, 0x0b81,   0},
+	{0x0000, 0x0b89,   0}, {0x0000, 0x0b91,   0}, {0x0000, 0x0b99,   0},
+	{0x0000, 0x0ba1,   0}, {0x0000, 0x0ba9,   0}, {0x0000, 0x0bb1,   0},
+	{0x0000, 0x0bb9,   0}, {0x0000, 0x0bc1,   0}, {0x0000, 0x0bc9,   0},
+	{0x0000, 0x0bd1,   0}, {0x0000, 0x0bd9,   0}, {0x0000, 0x0be1,   0},
+	{0x0000, 0x0be9,   0}, {0x0000, 0x0bf1,   0}, {0x0000, 0x0bf9,   0},
+	{0x0000, 0x0c01,   0}, {0x0000, 0x0c09,   0}, {0x0a12, 0x0c12,   0},
+	{0x0a22, 0x0c22,   0}, {0x0000, 0x0c31,   0}, {0x0000, 0x0c39,   0},
+	{0x0000, 0x0c41,   0}, {0x0000, 0x0c49,   0}, {0x0000, 0x0c51,   0},
+	{0x0000, 0x0c59,   0}, {0x0000, 0x0c61,   0}, {0x0a32, 0x0c6a,   0},
+	{0x0a42, 0x0c7a,   0}, {0x0000, 0x0c89,   0}, {0x0000, 0x0c91,   0},
+	{0x0000, 0x0c99,   0}, {0x0000, 0x0ca1,   0}, {0x0000, 0x0ca9,   0},
+	{0x0000, 0x0cb1,   0}, {0x0000, 0x0cb9,   0}, {0x0000, 0x0cc1,   0},
+	{0x0000, 0x0cc9,   0}, {0x0000, 0x0cd1,   0}, {0x0000, 0x0cd9,   0},
+	{0x0000, 0x0ce1,   0}, {0x0000, 0x0ce9,   0}, {0x0a52, 0x0cf2,   0},
+	{0x0a62, 0x0d02,   0}, {0x0a72, 0x0d12,   0}, {0x0a82, 0x0d22,   0},
+	{0x0a92, 0x0d32,   0}, {0x0aa2, 0x0d42,   0}, {0x0ab2, 0x0d52,   0},
+	{0x0ac2, 0x0d62,   0}, {0x0ad3, 0x0d73,   0}, {0x0aeb, 0x0d8b,   0},
+	{0x0b03, 0x0da3,   0}, {0x0b1b, 0x0dbb,   0}, {0x0b33, 0x0dd3,   0},
+	{0x0b4b, 0x0deb,   0}, {0x0b63, 0x0e03,   0}, {0x0b7b, 0x0e1b,   0},
+	{0x0b93, 0x0e33,   0}, {0x0bab, 0x0e4b,   0}, {0x0bc3, 0x0e63,   0},
+	{0x0bdb, 0x0e7b,   0}, {0x0bf2, 0x0e92,   0}, {0x0c02, 0x0ea2,   0},
+	{0x0000, 0x0eb1,   0}, {0x0c12, 0x0eba,   0}, {0x0c22, 0x0eca,   0},
+	{0x0c32, 0x0eda,   0}, {0x0c42, 0x0eea,   0}, {0x0c52, 0x0efa,   0},
+	{0x0c62, 0x0f0a,   0}, {0x0c73, 0x0f1b,   0}, {0x0c8b, 0x0f33,   0},
+	{0x0ca2, 0x0f4a,   0}, {0x0cb2, 0x0f5a,   0}, {0x0cc2, 0x0f6a,   0},
+	{0x0000, 0x0f79,   0}, {0x0000, 0x0f81,   0}, {0x0cd2, 0x0f8a,   0},
+	{0x0ce2, 0x0f9a,   0}, {0x0000, 0x0fa9,   0}, {0x0000, 0x0fb1,   0},
+	{0x0cf2, 0x0fba,   0}, {0x0d02, 0x0fca,   0}, {0x0d13, 0x0fdb,   0},
+	{0x0d2b, 0x0ff3,   0}, {0x0d42, 0x100a,   0}, {0x0d52, 0x101a,   0},
+	{0x0d62, 0x102a,   0}, {0x0d72, 0x103a,   0}, {0x0d82, 0x104a,   0},
+	{0x0d92, 0x105a,   0}, {0x0da2, 0x106a,   0}, {0x0db2, 0x107a,   0},
+	{0x0dc2, 0x108a,   0}, {0x0dd2, 0x109a,   0}, {0x0de2, 0x10aa,   0},
+	{0x0df2, 0x10ba,   0}, {0x0e02, 0x10ca,   0}, {0x0e12, 0x10da,   0},
+	{0x0e22, 0x10ea,   0}, {0x0e32, 0x10fa,   0}, {0x0e42, 0x110a,   0},
+	{0x0e52, 0x111a,   0}, {0x0e62, 0x112a,   0}, {0x0e72, 0x113a,   0},
+	{0x0e82, 0x114a,   0}, {0x0e92, 0x115a,   0}, {0x0ea2, 0x116a,   0},
+	{0x0eb2, 0x117a,   0}, {0x0ec2, 0x118a,   0}, {0x0ed2, 0x119a,   0},
+	{0x0ee2, 0x11aa,   0}, {0x0ef2, 0x11ba,   0}, {0x0f02, 0x11ca,   0},
+	{0x0f12, 0x11da,   0}, {0x0f22, 0x11ea,   0}, {0x0f32, 0x11fa,   0},
+	{0x0000, 0x1209,   0}, {0x0f42, 0x1212,   0}, {0x0f52, 0x1222,   0},
+	{0x0000, 0x1231,   0}, {0x0000, 0x1239,   0}, {0x0000, 0x1241,   0},
+	{0x0f62, 0x124a,   0}, {0x0f72, 0x125a,   0}, {0x0f82, 0x126a,   0},
+	{0x0f92, 0x127a,   0}, {0x0fa3, 0x128b,   0}, {0x0fbb, 0x12a3,   0},
+	{0x0fd3, 0x12bb,   0}, {0x0feb, 0x12d3,   0}, {0x1002, 0x12ea,   0},
+	{0x1012, 0x12fa,   0}, {0x1023, 0x130b,   0}, {0x103b, 0x1323,   0},
+	{0x1052, 0x133a,   0}, {0x1062, 0x134a,   0}, {0x0000, 0x1359,   0},
+	{0x0000, 0x1361,   0}, {0x0000, 0x1369,   0}, {0x0000, 0x1371,   0},
+	{0x0000, 0x1379,   0}, {0x0000, 0x1381,   0}, {0x0000, 0x1389,   0},
+	{0x0000, 0x1391,   0}, {0x0000, 0x1399,   0}, {0x0000, 0x13a1,   0},
+	{0x0000, 0x13a9,   0}, {0x0000, 0x13b1,   0}, {0x0000, 0x13b9,   0},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 232}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 216}, {0x0000, 0x0000, 202}, {0x0000, 0x0000,   1},
+	{0x1071, 0x13c1, 230}, {0x1079, 0x13c9, 230}, {0x1081, 0x13d1, 230},
+	{0x108a, 0x13da, 230}, {0x0000, 0x13e9, 240}, {0x0000, 0x0000, 233},
+	{0x0000, 0x0000, 234}, {0x0000, 0x13f1,   0}, {0x0000, 0x13f9,   0},
+	{0x1099, 0x1401,   0}, {0x0000, 0x1409,   0}, {0x10a1, 0x1411,   0},
+	{0x0000, 0x1419,   0}, {0x10aa, 0x1422,   0}, {0x10ba, 0x1432,   0},
+	{0x10c9, 0x1441,   0}, {0x10d2, 0x144a,   0}, {0x10e2, 0x145a,   0},
+	{0x10f2, 0x146a,   0}, {0x1102, 0x147a,   0}, {0x1112, 0x148a,   0},
+	{0x1122, 0x149a,   0}, {0x1133, 0x14ab,   0}, {0x0000, 0x14c1,   0},
+	{0x0000, 0x14c9,   0}, {0x0000, 0x14d1,   0}, {0x0000, 0x14d9,   0},
+	{0x0000, 0x14e1,   0}, {0x0000, 0x14e9,   0}, {0x0000, 0x14f1,   0},
+	{0x0000, 0x14f9,   0}, {0x0000, 0x1501,   0}, {0x0000, 0x1509,   0},
+	{0x0000, 0x1511,   0}, {0x0000, 0x1519,   0}, {0x0000, 0x1521,   0},
+	{0x0000, 0x1529,   0}, {0x0000, 0x1531,   0}, {0x0000, 0x1539,   0},
+	{0x0000, 0x1541,   0}, {0x0000, 0x1549,   0}, {0x0000, 0x1551,   0},
+	{0x0000, 0x1559,   0}, {0x0000, 0x1561,   0}, {0x0000, 0x1569,   0},
+	{0x0000, 0x1571,   0}, {0x0000, 0x1579,   0}, {0x114a, 0x1582,   0},
+	{0x115a, 0x1592,   0}, {0x116a, 0x15a2,   0}, {0x117a, 0x15b2,   0},
+	{0x118a, 0x15c2,   0}, {0x119a, 0x15d2,   0}, {0x11ab, 0x15e3,   0},
+	{0x0000, 0x15f9,   0}, {0x11c2, 0x1602,   0}, {0x11d2, 0x1612,   0},
+	{0x11e2, 0x1622,   0}, {0x11f2, 0x1632,   0}, {0x1202, 0x1642,   0},
+	{0x0000, 0x1651,   0}, {0x0000, 0x1659,   0}, {0x0000, 0x1661,   0},
+	{0x1212, 0x166a,   0}, {0x1222, 0x167a,   0}, {0x0000, 0x1689,   0},
+	{0x0000, 0x1691,   0}, {0x0000, 0x1699,   0}, {0x0000, 0x16a1,   0},
+	{0x0000, 0x16a9,   0}, {0x0000, 0x16b1,   0}, {0x0000, 0x16b9,   0},
+	{0x0000, 0x16c1,   0}, {0x0000, 0x16c9,   0}, {0x0000, 0x16d1,   0},
+	{0x0000, 0x16d9,   0}, {0x0000, 0x16e1,   0}, {0x0000, 0x16e9,   0},
+	{0x0000, 0x16f1,   0}, {0x0000, 0x16f9,   0}, {0x0000, 0x1701,   0},
+	{0x0000, 0x1709,   0}, {0x0000, 0x1711,   0}, {0x0000, 0x1719,   0},
+	{0x0000, 0x1721,   0}, {0x0000, 0x1729,   0}, {0x0000, 0x1731,   0},
+	{0x0000, 0x1739,   0}, {0x0000, 0x1741,   0}, {0x1232, 0x174a,   0},
+	{0x1242, 0x175a,   0}, {0x0000, 0x1769,   0}, {0x1252, 0x1772,   0},
+	{0x0000, 0x1781,   0}, {0x0000, 0x1789,   0}, {0x0000, 0x1791,   0},
+	{0x1262, 0x179a,   0}, {0x0000, 0x17a9,   0}, {0x0000, 0x17b1,   0},
+	{0x0000, 0x17b9,   0}, {0x0000, 0x17c1,   0}, {0x1272, 0x17ca,   0},
+	{0x1282, 0x17da,   0}, {0x1292, 0x17ea,   0}, {0x0000, 0x17f9,   0},
+	{0x0000, 0x1801,   0}, {0x0000, 0x1809,   0}, {0x0000, 0x1811,   0},
+	{0x0000, 0x1819,   0}, {0x0000, 0x1821,   0}, {0x0000, 0x1829,   0},
+	{0x0000, 0x1831,   0}, {0x0000, 0x1839,   0}, {0x0000, 0x1841,   0},
+	{0x12a2, 0x184a,   0}, {0x0000, 0x1859,   0}, {0x0000, 0x1861,   0},
+	{0x0000, 0x1869,   0}, {0x0000, 0x1871,   0}, {0x0000, 0x1879,   0},
+	{0x0000, 0x1881,   0}, {0x0000, 0x1889,   0}, {0x0000, 0x1891,   0},
+	{0x0000, 0x1899,   0}, {0x0000, 0x18a1,   0}, {0x0000, 0x18a9,   0},
+	{0x0000, 0x18b1,   0}, {0x0000, 0x18b9,   0}, {0x0000, 0x18c1,   0},
+	{0x0000, 0x18c9,   0}, {0x0000, 0x18d1,   0}, {0x0000, 0x18d9,   0},
+	{0x0000, 0x18e1,   0}, {0x0000, 0x18e9,   0}, {0x0000, 0x18f1,   0},
+	{0x0000, 0x18f9,   0}, {0x0000, 0x1901,   0}, {0x12b2, 0x190a,   0},
+	{0x12c2, 0x191a,   0}, {0x12d2, 0x192a,   0}, {0x12e2, 0x193a,   0},
+	{0x12f2, 0x194a,   0}, {0x1302, 0x195a,   0}, {0x1312, 0x196a,   0},
+	{0x1322, 0x197a,   0}, {0x0000, 0x1989,   0}, {0x0000, 0x1991,   0},
+	{0x0000, 0x1999,   0}, {0x0000, 0x19a1,   0}, {0x0000, 0x19a9,   0},
+	{0x0000, 0x19b1,   0}, {0x0000, 0x19b9,   0}, {0x0000, 0x19c1,   0},
+	{0x0000, 0x19c9,   0}, {0x0000, 0x19d1,   0}, {0x0000, 0x19d9,   0},
+	{0x1332, 0x19e2,   0}, {0x1342, 0x19f2,   0}, {0x0000, 0x1a01,   0},
+	{0x0000, 0x1a09,   0}, {0x0000, 0x1a11,   0}, {0x0000, 0x1a19,   0},
+	{0x0000, 0x1a21,   0}, {0x0000, 0x1a29,   0}, {0x0000, 0x1a31,   0},
+	{0x0000, 0x1a39,   0}, {0x0000, 0x1a41,   0}, {0x0000, 0x1a49,   0},
+	{0x0000, 0x1a51,   0}, {0x0000, 0x1a59,   0}, {0x0000, 0x1a61,   0},
+	{0x0000, 0x1a69,   0}, {0x0000, 0x1a71,   0}, {0x0000, 0x1a79,   0},
+	{0x0000, 0x1a81,   0}, {0x0000, 0x1a89,   0}, {0x0000, 0x1a91,   0},
+	{0x0000, 0x1a99,   0}, {0x0000, 0x1aa1,   0}, {0x0000, 0x1aa9,   0},
+	{0x0000, 0x1ab1,   0}, {0x0000, 0x1ab9,   0}, {0x0000, 0x1ac1,   0},
+	{0x0000, 0x1ac9,   0}, {0x0000, 0x1ad1,   0}, {0x0000, 0x1ad9,   0},
+	{0x0000, 0x1ae1,   0}, {0x0000, 0x1ae9,   0}, {0x0000, 0x1af1,   0},
+	{0x0000, 0x1af9,   0}, {0x0000, 0x1b01,   0}, {0x1352, 0x1b0a,   0},
+	{0x1362, 0x1b1a,   0}, {0x0000, 0x1b29,   0}, {0x0000, 0x1b31,   0},
+	{0x0000, 0x1b39,   0}, {0x0000, 0x1b41,   0}, {0x0000, 0x1b49,   0},
+	{0x0000, 0x1b51,   0}, {0x1372, 0x1b5a,   0}, {0x1382, 0x1b6a,   0},
+	{0x1392, 0x1b7a,   0}, {0x13a2, 0x1b8a,   0}, {0x0000, 0x1b99,   0},
+	{0x13b2, 0x1ba2,   0}, {0x13c2, 0x1bb2,   0}, {0x0000, 0x1bc1,   0},
+	{0x13d2, 0x1bca,   0}, {0x13e2, 0x1bda,   0}, {0x13f2, 0x1bea,   0},
+	{0x1402, 0x1bfa,   0}, {0x1412, 0x1c0a,   0}, {0x1422, 0x1c1a,   0},
+	{0x0000, 0x1c29,   0}, {0x1432, 0x1c32,   0}, {0x1442, 0x1c42,   0},
+	{0x1452, 0x1c52,   0}, {0x1462, 0x1c62,   0}, {0x1472, 0x1c72,   0},
+	{0x1482, 0x1c82,   0}, {0x0000, 0x1c91,   0}, {0x1492, 0x1c9a,   0},
+	{0x14a2, 0x1caa,   0}, {0x14b2, 0x1cba,   0}, {0x14c2, 0x1cca,   0},
+	{0x14d2, 0x1cda,   0}, {0x14e2, 0x1cea,   0}, {0x14f2, 0x1cfa,   0},
+	{0x1502, 0x1d0a,   0}, {0x1512, 0x1d1a,   0}, {0x1522, 0x1d2a,   0},
+	{0x1532, 0x1d3a,   0}, {0x1542, 0x1d4a,   0}, {0x0000, 0x1d59,   0},
+	{0x1552, 0x1d62,   0}, {0x1562, 0x1d72,   0}, {0x0000, 0x1d81,   0},
+	{0x0000, 0x1d89,   0}, {0x0000, 0x1d91,   0}, {0x0000, 0x1d99,   0},
+	{0x0000, 0x1da1,   0}, {0x0000, 0x1da9,   0}, {0x0000, 0x1db1,   0},
+	{0x0000, 0x1db9,   0}, {0x0000, 0x1dc1,   0}, {0x0000, 0x1dc9,   0},
+	{0x0000, 0x1dd1,   0}, {0x0000, 0x1dd9,   0}, {0x0000, 0x1de1,   0},
+	{0x0000, 0x1de9,   0}, {0x0000, 0x1df1,   0}, {0x0000, 0x1df9,   0},
+	{0x0000, 0x1e01,   0}, {0x0000, 0x1e09,   0}, {0x0000, 0x1e11,   0},
+	{0x0000, 0x1e19,   0}, {0x0000, 0x1e21,   0}, {0x0000, 0x1e29,   0},
+	{0x0000, 0x1e31,   0}, {0x0000, 0x1e39,   0}, {0x0000, 0x1e41,   0},
+	{0x0000, 0x1e49,   0}, {0x0000, 0x1e51,   0}, {0x0000, 0x1e59,   0},
+	{0x0000, 0x1e61,   0}, {0x0000, 0x1e69,   0}, {0x0000, 0x1e71,   0},
+	{0x0000, 0x1e79,   0}, {0x0000, 0x1e81,   0}, {0x0000, 0x1e89,   0},
+	{0x0000, 0x1e91,   0}, {0x0000, 0x1e99,   0}, {0x0000, 0x1ea1,   0},
+	{0x0000, 0x1ea9,   0}, {0x0000, 0x1eb1,   0}, {0x0000, 0x1eb9,   0},
+	{0x0000, 0x1ec1,   0}, {0x0000, 0x1ec9,   0}, {0x0000, 0x1ed1,   0},
+	{0x0000, 0x1ed9,   0}, {0x0000, 0x1ee1,   0}, {0x0000, 0x1ee9,   0},
+	{0x0000, 0x1ef1,   0}, {0x0000, 0x1ef9,   0}, {0x0000, 0x1f01,   0},
+	{0x0000, 0x1f09,   0}, {0x0000, 0x1f11,   0}, {0x0000, 0x1f19,   0},
+	{0x0000, 0x1f21,   0}, {0x0000, 0x1f29,   0}, {0x0000, 0x1f31,   0},
+	{0x0000, 0x1f39,   0}, {0x0000, 0x1f41,   0}, {0x0000, 0x1f49,   0},
+	{0x0000, 0x1f51,   0}, {0x0000, 0x1f59,   0}, {0x0000, 0x1f61,   0},
+	{0x0000, 0x1f69,   0}, {0x0000, 0x1f71,   0}, {0x0000, 0x1f79,   0},
+	{0x0000, 0x1f81,   0}, {0x0000, 0x1f8a,   0}, {0x0000, 0x0000, 222},
+	{0x0000, 0x0000, 228}, {0x0000, 0x0000,  10}, {0x0000, 0x0000,  11},
+	{0x0000, 0x0000,  12}, {0x0000, 0x0000,  13}, {0x0000, 0x0000,  14},
+	{0x0000, 0x0000,  15}, {0x0000, 0x0000,  16}, {0x0000, 0x0000,  17},
+	{0x0000, 0x0000,  18}, {0x0000, 0x0000,  19}, {0x0000, 0x0000,  20},
+	{0x0000, 0x0000,  21}, {0x0000, 0x0000,  22}, {0x0000, 0x0000,  23},
+	{0x0000, 0x0000,  24}, {0x0000, 0x0000,  25}, {0x0000, 0x0000,  30},
+	{0x0000, 0x0000,  31}, {0x0000, 0x0000,  32}, {0x1572, 0x1f9a,   0},
+	{0x1582, 0x1faa,   0}, {0x1592, 0x1fba,   0}, {0x15a2, 0x1fca,   0},
+	{0x15b2, 0x1fda,   0}, {0x0000, 0x0000,  27}, {0x0000, 0x0000,  28},
+	{0x0000, 0x0000,  29}, {0x0000, 0x0000,  33}, {0x0000, 0x0000,  34},
+	{0x0000, 0x0000,  35}, {0x15c2, 0x1fea,   0}, {0x15d2, 0x1ffa,   0},
+	{0x15e2, 0x200a,   0}, {0x0000, 0x0000,  36}, {0x15f2, 0x201a,   0},
+	{0x1602, 0x202a,   0}, {0x1612, 0x203a,   0}, {0x0000, 0x0000,   7},
+	{0x0000, 0x0000,   9}, {0x1622, 0x204a,   0}, {0x1632, 0x205a,   0},
+	{0x1642, 0x206a,   0}, {0x1652, 0x207a,   0}, {0x1662, 0x208a,   0},
+	{0x1672, 0x209a,   0}, {0x1682, 0x20aa,   0}, {0x1692, 0x20ba,   0},
+	{0x16a2, 0x20ca,   0}, {0x16b2, 0x20da,   0}, {0x16c2, 0x20ea,   0},
+	{0x16d2, 0x20fa,   0}, {0x16e2, 0x210a,   0}, {0x16f2, 0x211a,   0},
+	{0x1702, 0x212a,   0}, {0x1712, 0x213a,   0}, {0x1722, 0x214a,   0},
+	{0x1732, 0x215a,   0}, {0x1742, 0x216a,   0}, {0x1752, 0x217a,   0},
+	{0x1762, 0x218a,   0}, {0x1772, 0x219a,   0}, {0x1782, 0x21aa,   0},
+	{0x1792, 0x21ba,   0}, {0x17a2, 0x21ca,   0}, {0x17b2, 0x21da,   0},
+	{0x17c2, 0x21ea,   0}, {0x17d2, 0x21fa,   0}, {0x17e2, 0x220a,   0},
+	{0x0000, 0x0000,  84}, {0x0000, 0x0000,  91}, {0x17f2, 0x221a,   0},
+	{0x1802, 0x222a,   0}, {0x1812, 0x223a,   0}, {0x1822, 0x224a,   0},
+	{0x1833, 0x225b,   0}, {0x184a, 0x2272,   0}, {0x185a, 0x2282,   0},
+	{0x186a, 0x2292,   0}, {0x187a, 0x22a2,   0}, {0x188a, 0x22b2,   0},
+	{0x189b, 0x22c3,   0}, {0x18b2, 0x22da,   0}, {0x0000, 0x0000, 103},
+	{0x0000, 0x0000, 107}, {0x0000, 0x0000, 118}, {0x0000, 0x0000, 122},
+	{0x18c2, 0x22ea,   0}, {0x18d2, 0x22fa,   0}, {0x18e2, 0x230a,   0},
+	{0x18f2, 0x231a,   0}, {0x1902, 0x232a,   0}, {0x1912, 0x233a,   0},
+	{0x0000, 0x0000, 129}, {0x0000, 0x0000, 130}, {0x1922, 0x234a,   0},
+	{0x0000, 0x0000, 132}, {0x1932, 0x235a,   0}, {0x1942, 0x236a,   0},
+	{0x1952, 0x237a,   0}, {0x1962, 0x238a,   0}, {0x1972, 0x239a,   0},
+	{0x1982, 0x23aa,   0}, {0x1992, 0x23ba,   0}, {0x19a2, 0x23ca,   0},
+	{0x19b2, 0x23da,   0}, {0x19c2, 0x23ea,   0}, {0x19d2, 0x23fa,   0},
+	{0x0000, 0x2409,   0}, {0x0000, 0x2411,   0}, {0x0000, 0x2419,   0},
+	{0x0000, 0x2421,   0}, {0x0000, 0x2429,   0}, {0x0000, 0x2431,   0},
+	{0x0000, 0x2439,   0}, {0x0000, 0x2441,   0}, {0x0000, 0x2449,   0},
+	{0x0000, 0x2451,   0}, {0x0000, 0x2459,   0}, {0x0000, 0x2461,   0},
+	{0x0000, 0x2469,   0}, {0x0000, 0x2471,   0}, {0x0000, 0x2479,   0},
+	{0x0000, 0x2481,   0}, {0x0000, 0x2489,   0}, {0x0000, 0x2491,   0},
+	{0x0000, 0x2499,   0}, {0x0000, 0x24a1,   0}, {0x0000, 0x24a9,   0},
+	{0x0000, 0x24b1,   0}, {0x0000, 0x24b9,   0}, {0x0000, 0x24c1,   0},
+	{0x0000, 0x24c9,   0}, {0x0000, 0x24d1,   0}, {0x0000, 0x24d9,   0},
+	{0x0000, 0x24e1,   0}, {0x0000, 0x24e9,   0}, {0x0000, 0x24f1,   0},
+	{0x0000, 0x24f9,   0}, {0x0000, 0x2501,   0}, {0x0000, 0x2509,   0},
+	{0x0000, 0x2511,   0}, {0x0000, 0x2519,   0}, {0x0000, 0x2521,   0},
+	{0x0000, 0x2529,   0}, {0x0000, 0x2531,   0}, {0x0000, 0x2539,   0},
+	{0x0000, 0x2541,   0}, {0x0000, 0x2549,   0}, {0x0000, 0x2551,   0},
+	{0x0000, 0x2559,   0}, {0x0000, 0x2561,   0}, {0x0000, 0x2569,   0},
+	{0x0000, 0x2571,   0}, {0x19e2, 0x257a,   0}, {0x19f2, 0x258a,   0},
+	{0x1a02, 0x259a,   0}, {0x1a12, 0x25aa,   0}, {0x1a22, 0x25ba,   0},
+	{0x1a32, 0x25ca,   0}, {0x1a42, 0x25da,   0}, {0x1a52, 0x25ea,   0},
+	{0x1a62, 0x25fa,   0}, {0x1a72, 0x260a,   0}, {0x1a82, 0x261a,   0},
+	{0x0000, 0x2629,   0}, {0x0000, 0x2631,   0}, {0x0000, 0x2639,   0},
+	{0x0000, 0x2641,   0}, {0x0000, 0x2649,   0}, {0x0000, 0x2651,   0},
+	{0x0000, 0x2659,   0}, {0x0000, 0x2661,   0}, {0x0000, 0x2669,   0},
+	{0x0000, 0x0000, 214}, {0x1a92, 0x2672,   0}, {0x1aa2, 0x2682,   0},
+	{0x1ab2, 0x2692,   0}, {0x1ac2, 0x26a2,   0}, {0x1ad2, 0x26b2,   0},
+	{0x1ae2, 0x26c2,   0}, {0x1af2, 0x26d2,   0}, {0x1b02, 0x26e2,   0},
+	{0x1b13, 0x26f3,   0}, {0x1b2b, 0x270b,   0}, {0x1b42, 0x2722,   0},
+	{0x1b52, 0x2732,   0}, {0x1b62, 0x2742,   0}, {0x1b72, 0x2752,   0},
+	{0x1b82, 0x2762,   0}, {0x1b92, 0x2772,   0}, {0x1ba2, 0x2782,   0},
+	{0x1bb2, 0x2792,   0}, {0x1bc2, 0x27a2,   0}, {0x1bd2, 0x27b2,   0},
+	{0x1be3, 0x27c3,   0}, {0x1bfb, 0x27db,   0}, {0x1c13, 0x27f3,   0},
+	{0x1c2b, 0x280b,   0}, {0x1c42, 0x2822,   0}, {0x1c52, 0x2832,   0},
+	{0x1c62, 0x2842,   0}, {0x1c72, 0x2852,   0}, {0x1c83, 0x2863,   0},
+	{0x1c9b, 0x287b,   0}, {0x1cb2, 0x2892,   0}, {0x1cc2, 0x28a2,   0},
+	{0x1cd2, 0x28b2,   0}, {0x1ce2, 0x28c2,   0}, {0x1cf2, 0x28d2,   0},
+	{0x1d02, 0x28e2,   0}, {0x1d12, 0x28f2,   0}, {0x1d22, 0x2902,   0},
+	{0x1d32, 0x2912,   0}, {0x1d42, 0x2922,   0}, {0x1d52, 0x2932,   0},
+	{0x1d62, 0x2942,   0}, {0x1d72, 0x2952,   0}, {0x1d82, 0x2962,   0},
+	{0x1d92, 0x2972,   0}, {0x1da2, 0x2982,   0}, {0x1db3, 0x2993,   0},
+	{0x1dcb, 0x29ab,   0}, {0x1de2, 0x29c2,   0}, {0x1df2, 0x29d2,   0},
+	{0x1e02, 0x29e2,   0}, {0x1e12, 0x29f2,   0}, {0x1e22, 0x2a02,   0},
+	{0x1e32, 0x2a12,   0}, {0x1e42, 0x2a22,   0}, {0x1e52, 0x2a32,   0},
+	{0x1e63, 0x2a43,   0}, {0x1e7b, 0x2a5b,   0}, {0x1e92, 0x2a72,   0},
+	{0x1ea2, 0x2a82,   0}, {0x1eb2, 0x2a92,   0}, {0x1ec2, 0x2aa2,   0},
+	{0x1ed2, 0x2ab2,   0}, {0x1ee2, 0x2ac2,   0}, {0x1ef2, 0x2ad2,   0},
+	{0x1f02, 0x2ae2,   0}, {0x1f12, 0x2af2,   0}, {0x1f22, 0x2b02,   0},
+	{0x1f32, 0x2b12,   0}, {0x1f42, 0x2b22,   0}, {0x1f52, 0x2b32,   0},
+	{0x1f62, 0x2b42,   0}, {0x1f72, 0x2b52,   0}, {0x1f82, 0x2b62,   0},
+	{0x1f92, 0x2b72,   0}, {0x1fa2, 0x2b82,   0}, {0x1fb3, 0x2b93,   0},
+	{0x1fcb, 0x2bab,   0}, {0x1fe3, 0x2bc3,   0}, {0x1ffb, 0x2bdb,   0},
+	{0x2013, 0x2bf3,   0}, {0x202b, 0x2c0b,   0}, {0x2043, 0x2c23,   0},
+	{0x205b, 0x2c3b,   0}, {0x2072, 0x2c52,   0}, {0x2082, 0x2c62,   0},
+	{0x2092, 0x2c72,   0}, {0x20a2, 0x2c82,   0}, {0x20b2, 0x2c92,   0},
+	{0x20c2, 0x2ca2,   0}, {0x20d2, 0x2cb2,   0}, {0x20e2, 0x2cc2,   0},
+	{0x20f3, 0x2cd3,   0}, {0x210b, 0x2ceb,   0}, {0x2122, 0x2d02,   0},
+	{0x2132, 0x2d12,   0}, {0x2142, 0x2d22,   0}, {0x2152, 0x2d32,   0},
+	{0x2162, 0x2d42,   0}, {0x2172, 0x2d52,   0}, {0x2183, 0x2d63,   0},
+	{0x219b, 0x2d7b,   0}, {0x21b3, 0x2d93,   0}, {0x21cb, 0x2dab,   0},
+	{0x21e3, 0x2dc3,   0}, {0x21fb, 0x2ddb,   0}, {0x2212, 0x2df2,   0},
+	{0x2222, 0x2e02,   0}, {0x2232, 0x2e12,   0}, {0x2242, 0x2e22,   0},
+	{0x2252, 0x2e32,   0}, {0x2262, 0x2e42,   0}, {0x2272, 0x2e52,   0},
+	{0x2282, 0x2e62,   0}, {0x2292, 0x2e72,   0}, {0x22a2, 0x2e82,   0},
+	{0x22b2, 0x2e92,   0}, {0x22c2, 0x2ea2,   0}, {0x22d2, 0x2eb2,   0},
+	{0x22e2, 0x2ec2,   0}, {0x22f3, 0x2ed3,   0}, {0x230b, 0x2eeb,   0},
+	{0x2323, 0x2f03,   0}, {0x233b, 0x2f1b,   0}, {0x2352, 0x2f32,   0},
+	{0x2362, 0x2f42,   0}, {0x2372, 0x2f52,   0}, {0x2382, 0x2f62,   0},
+	{0x2392, 0x2f72,   0}, {0x23a2, 0x2f82,   0}, {0x23b2, 0x2f92,   0},
+	{0x23c2, 0x2fa2,   0}, {0x23d2, 0x2fb2,   0}, {0x23e2, 0x2fc2,   0},
+	{0x23f2, 0x2fd2,   0}, {0x2402, 0x2fe2,   0}, {0x2412, 0x2ff2,   0},
+	{0x2422, 0x3002,   0}, {0x2432, 0x3012,   0}, {0x2442, 0x3022,   0},
+	{0x2452, 0x3032,   0}, {0x2462, 0x3042,   0}, {0x2472, 0x3052,   0},
+	{0x2482, 0x3062,   0}, {0x2492, 0x3072,   0}, {0x24a2, 0x3082,   0},
+	{0x24b2, 0x3092,   0}, {0x24c2, 0x30a2,   0}, {0x24d2, 0x30b2,   0},
+	{0x24e2, 0x30c2,   0}, {0x24f2, 0x30d2,   0}, {0x2502, 0x30e2,   0},
+	{0x2512, 0x30f2,   0}, {0x2522, 0x3102,   0}, {0x0000, 0x3112,   0},
+	{0x2532, 0x3122,   0}, {0x0000, 0x3132,   0}, {0x2542, 0x3142,   0},
+	{0x2552, 0x3152,   0}, {0x2562, 0x3162,   0}, {0x2572, 0x3172,   0},
+	{0x2583, 0x3183,   0}, {0x259b, 0x319b,   0}, {0x25b3, 0x31b3,   0},
+	{0x25cb, 0x31cb,   0}, {0x25e3, 0x31e3,   0}, {0x25fb, 0x31fb,   0},
+	{0x2613, 0x3213,   0}, {0x262b, 0x322b,   0}, {0x2643, 0x3243,   0},
+	{0x265b, 0x325b,   0}, {0x2673, 0x3273,   0}, {0x268b, 0x328b,   0},
+	{0x26a3, 0x32a3,   0}, {0x26bb, 0x32bb,   0}, {0x26d3, 0x32d3,   0},
+	{0x26eb, 0x32eb,   0}, {0x2703, 0x3303,   0}, {0x271b, 0x331b,   0},
+	{0x2733, 0x3333,   0}, {0x274b, 0x334b,   0}, {0x2762, 0x3362,   0},
+	{0x2772, 0x3372,   0}, {0x2782, 0x3382,   0}, {0x2792, 0x3392,   0},
+	{0x27a2, 0x33a2,   0}, {0x27b2, 0x33b2,   0}, {0x27c3, 0x33c3,   0},
+	{0x27db, 0x33db,   0}, {0x27f3, 0x33f3,   0}, {0x280b, 0x340b,   0},
+	{0x2823, 0x3423,   0}, {0x283b, 0x343b,   0}, {0x2853, 0x3453,   0},
+	{0x286b, 0x346b,   0}, {0x2883, 0x3483,   0}, {0x289b, 0x349b,   0},
+	{0x28b2, 0x34b2,   0}, {0x28c2, 0x34c2,   0}, {0x28d2, 0x34d2,   0},
+	{0x28e2, 0x34e2,   0}, {0x28f2, 0x34f2,   0}, {0x2902, 0x3502,   0},
+	{0x2912, 0x3512,   0}, {0x2922, 0x3522,   0}, {0x2933, 0x3533,   0},
+	{0x294b, 0x354b,   0}, {0x2963, 0x3563,   0}, {0x297b, 0x357b,   0},
+	{0x2993, 0x3593,   0}, {0x29ab, 0x35ab,   0}, {0x29c3, 0x35c3,   0},
+	{0x29db, 0x35db,   0}, {0x29f3, 0x35f3,   0}, {0x2a0b, 0x360b,   0},
+	{0x2a23, 0x3623,   0}, {0x2a3b, 0x363b,   0}, {0x2a53, 0x3653,   0},
+	{0x2a6b, 0x366b,   0}, {0x2a83, 0x3683,   0}, {0x2a9b, 0x369b,   0},
+	{0x2ab3, 0x36b3,   0}, {0x2acb, 0x36cb,   0}, {0x2ae3, 0x36e3,   0},
+	{0x2afb, 0x36fb,   0}, {0x2b12, 0x3712,   0}, {0x2b22, 0x3722,   0},
+	{0x2b32, 0x3732,   0}, {0x2b42, 0x3742,   0}, {0x2b53, 0x3753,   0},
+	{0x2b6b, 0x376b,   0}, {0x2b83, 0x3783,   0}, {0x2b9b, 0x379b,   0},
+	{0x2bb3, 0x37b3,   0}, {0x2bcb, 0x37cb,   0}, {0x2be3, 0x37e3,   0},
+	{0x2bfb, 0x37fb,   0}, {0x2c13, 0x3813,   0}, {0x2c2b, 0x382b,   0},
+	{0x2c42, 0x3842,   0}, {0x2c52, 0x3852,   0}, {0x2c62, 0x3862,   0},
+	{0x2c72, 0x3872,   0}, {0x2c82, 0x3882,   0}, {0x2c92, 0x3892,   0},
+	{0x2ca2, 0x38a2,   0}, {0x2cb2, 0x38b2,   0}, {0x0000, 0x38c1,   0},
+	{0x0000, 0x38c9,   0}, {0x0000, 0x38d1,   0}, {0x2cc2, 0x38da,   0},
+	{0x2cd2, 0x38ea,   0}, {0x2ce3, 0x38fb,   0}, {0x2cfb, 0x3913,   0},
+	{0x2d13, 0x392b,   0}, {0x2d2b, 0x3943,   0}, {0x2d43, 0x395b,   0},
+	{0x2d5b, 0x3973,   0}, {0x2d72, 0x398a,   0}, {0x2d82, 0x399a,   0},
+	{0x2d93, 0x39ab,   0}, {0x2dab, 0x39c3,   0}, {0x2dc3, 0x39db,   0},
+	{0x2ddb, 0x39f3,   0}, {0x2df3, 0x3a0b,   0}, {0x2e0b, 0x3a23,   0},
+	{0x2e22, 0x3a3a,   0}, {0x2e32, 0x3a4a,   0}, {0x2e43, 0x3a5b,   0},
+	{0x2e5b, 0x3a73,   0}, {0x2e73, 0x3a8b,   0}, {0x2e8b, 0x3aa3,   0},
+	{0x2ea2, 0x3aba,   0}, {0x2eb2, 0x3aca,   0}, {0x2ec3, 0x3adb,   0},
+	{0x2edb, 0x3af3,   0}, {0x2ef3, 0x3b0b,   0}, {0x2f0b, 0x3b23,   0},
+	{0x2f22, 0x3b3a,   0}, {0x2f32, 0x3b4a,   0}, {0x2f43, 0x3b5b,   0},
+	{0x2f5b, 0x3b73,   0}, {0x2f73, 0x3b8b,   0}, {0x2f8b, 0x3ba3,   0},
+	{0x2fa3, 0x3bbb,   0}, {0x2fbb, 0x3bd3,   0}, {0x2fd2, 0x3bea,   0},
+	{0x2fe2, 0x3bfa,   0}, {0x2ff3, 0x3c0b,   0}, {0x300b, 0x3c23,   0},
+	{0x3023, 0x3c3b,   0}, {0x303b, 0x3c53,   0}, {0x3053, 0x3c6b,   0},
+	{0x306b, 0x3c83,   0}, {0x3082, 0x3c9a,   0}, {0x3092, 0x3caa,   0},
+	{0x30a3, 0x3cbb,   0}, {0x30bb, 0x3cd3,   0}, {0x30d3, 0x3ceb,   0},
+	{0x30eb, 0x3d03,   0}, {0x3103, 0x3d1b,   0}, {0x311b, 0x3d33,   0},
+	{0x3132, 0x3d4a,   0}, {0x3142, 0x3d5a,   0}, {0x3153, 0x3d6b,   0},
+	{0x316b, 0x3d83,   0}, {0x3183, 0x3d9b,   0}, {0x319b, 0x3db3,   0},
+	{0x31b3, 0x3dcb,   0}, {0x31cb, 0x3de3,   0}, {0x31e2, 0x3dfa,   0},
+	{0x31f2, 0x3e0a,   0}, {0x3203, 0x3e1b,   0}, {0x321b, 0x3e33,   0},
+	{0x3233, 0x3e4b,   0}, {0x324b, 0x3e63,   0}, {0x3262, 0x3e7a,   0},
+	{0x3272, 0x3e8a,   0}, {0x3283, 0x3e9b,   0}, {0x329b, 0x3eb3,   0},
+	{0x32b3, 0x3ecb,   0}, {0x32cb, 0x3ee3,   0}, {0x32e2, 0x3efa,   0},
+	{0x32f2, 0x3f0a,   0}, {0x3303, 0x3f1b,   0}, {0x331b, 0x3f33,   0},
+	{0x3333, 0x3f4b,   0}, {0x334b, 0x3f63,   0}, {0x3363, 0x3f7b,   0},
+	{0x337b, 0x3f93,   0}, {0x3392, 0x3faa,   0}, {0x33a3, 0x3fbb,   0},
+	{0x33bb, 0x3fd3,   0}, {0x33d3, 0x3feb,   0}, {0x33ea, 0x4002,   0},
+	{0x33fa, 0x4012,   0}, {0x340b, 0x4023,   0}, {0x3423, 0x403b,   0},
+	{0x343b, 0x4053,   0}, {0x3453, 0x406b,   0}, {0x346b, 0x4083,   0},
+	{0x3483, 0x409b,   0}, {0x349a, 0x40b2,   0}, {0x34aa, 0x40c2,   0},
+	{0x34bb, 0x40d3,   0}, {0x34d3, 0x40eb,   0}, {0x34eb, 0x4103,   0},
+	{0x3503, 0x411b,   0}, {0x351b, 0x4133,   0}, {0x3533, 0x414b,   0},
+	{0x354a, 0x4162,   0}, {0x355a, 0x4172,   0}, {0x356a, 0x4182,   0},
+	{0x357a, 0x4192,   0}, {0x358a, 0x41a2,   0}, {0x359a, 0x41b2,   0},
+	{0x35aa, 0x41c2,   0}, {0x35ba, 0x41d2,   0}, {0x35ca, 0x41e2,   0},
+	{0x35da, 0x41f2,   0}, {0x35ea, 0x4202,   0}, {0x35fa, 0x4212,   0},
+	{0x360a, 0x4222,   0}, {0x361a, 0x4232,   0}, {0x362b, 0x4243,   0},
+	{0x3643, 0x425b,   0}, {0x365c, 0x4274,   0}, {0x367c, 0x4294,   0},
+	{0x369c, 0x42b4,   0}, {0x36bc, 0x42d4,   0}, {0x36dc, 0x42f4,   0},
+	{0x36fc, 0x4314,   0}, {0x371b, 0x4333,   0}, {0x3733, 0x434b,   0},
+	{0x374c, 0x4364,   0}, {0x376c, 0x4384,   0}, {0x378c, 0x43a4,   0},
+	{0x37ac, 0x43c4,   0}, {0x37cc, 0x43e4,   0}, {0x37ec, 0x4404,   0},
+	{0x380b, 0x4423,   0}, {0x3823, 0x443b,   0}, {0x383c, 0x4454,   0},
+	{0x385c, 0x4474,   0}, {0x387c, 0x4494,   0}, {0x389c, 0x44b4,   0},
+	{0x38bc, 0x44d4,   0}, {0x38dc, 0x44f4,   0}, {0x38fb, 0x4513,   0},
+	{0x3913, 0x452b,   0}, {0x392c, 0x4544,   0}, {0x394c, 0x4564,   0},
+	{0x396c, 0x4584,   0}, {0x398c, 0x45a4,   0}, {0x39ac, 0x45c4,   0},
+	{0x39cc, 0x45e4,   0}, {0x39eb, 0x4603,   0}, {0x3a03, 0x461b,   0},
+	{0x3a1c, 0x4634,   0}, {0x3a3c, 0x4654,   0}, {0x3a5c, 0x4674,   0},
+	{0x3a7c, 0x4694,   0}, {0x3a9c, 0x46b4,   0}, {0x3abc, 0x46d4,   0},
+	{0x3adb, 0x46f3,   0}, {0x3af3, 0x470b,   0}, {0x3b0c, 0x4724,   0},
+	{0x3b2c, 0x4744,   0}, {0x3b4c, 0x4764,   0}, {0x3b6c, 0x4784,   0},
+	{0x3b8c, 0x47a4,   0}, {0x3bac, 0x47c4,   0}, {0x3bca, 0x47e2,   0},
+	{0x3bda, 0x47f2,   0}, {0x3beb, 0x4803,   0}, {0x3c02, 0x481a,   0},
+	{0x3c13, 0x482b,   0}, {0x3c2a, 0x4842,   0}, {0x3c3b, 0x4853,   0},
+	{0x3c52, 0x486a,   0}, {0x3c62, 0x487a,   0}, {0x3c72, 0x488a,   0},
+	{0x3c82, 0x489a,   0}, {0x3c92, 0x48aa,   0}, {0x3ca1, 0x48b9,   0},
+	{0x3caa, 0x48c2,   0}, {0x3cbb, 0x48d3,   0}, {0x3cd2, 0x48ea,   0},
+	{0x3ce3, 0x48fb,   0}, {0x3cfa, 0x4912,   0}, {0x3d0b, 0x4923,   0},
+	{0x3d22, 0x493a,   0}, {0x3d32, 0x494a,   0}, {0x3d42, 0x495a,   0},
+	{0x3d52, 0x496a,   0}, {0x3d62, 0x497a,   0}, {0x3d72, 0x498a,   0},
+	{0x3d82, 0x499a,   0}, {0x3d92, 0x49aa,   0}, {0x3da2, 0x49ba,   0},
+	{0x3db2, 0x49ca,   0}, {0x3dc3, 0x49db,   0}, {0x3ddb, 0x49f3,   0},
+	{0x3df2, 0x4a0a,   0}, {0x3e03, 0x4a1b,   0}, {0x3e1a, 0x4a32,   0},
+	{0x3e2a, 0x4a42,   0}, {0x3e3a, 0x4a52,   0}, {0x3e4a, 0x4a62,   0},
+	{0x3e5a, 0x4a72,   0}, {0x3e6a, 0x4a82,   0}, {0x3e7a, 0x4a92,   0},
+	{0x3e8a, 0x4aa2,   0}, {0x3e9a, 0x4ab2,   0}, {0x3eab, 0x4ac3,   0},
+	{0x3ec3, 0x4adb,   0}, {0x3eda, 0x4af2,   0}, {0x3eea, 0x4b02,   0},
+	{0x3efa, 0x4b12,   0}, {0x3f0b, 0x4b23,   0}, {0x3f22, 0x4b3a,   0},
+	{0x3f32, 0x4b4a,   0}, {0x3f42, 0x4b5a,   0}, {0x3f52, 0x4b6a,   0},
+	{0x3f62, 0x4b7a,   0}, {0x3f72, 0x4b8a,   0}, {0x3f82, 0x4b9a,   0},
+	{0x3f91, 0x4ba9,   0}, {0x3f9b, 0x4bb3,   0}, {0x3fb2, 0x4bca,   0},
+	{0x3fc3, 0x4bdb,   0}, {0x3fda, 0x4bf2,   0}, {0x3feb, 0x4c03,   0},
+	{0x4002, 0x4c1a,   0}, {0x4012, 0x4c2a,   0}, {0x4022, 0x4c3a,   0},
+	{0x4032, 0x4c4a,   0}, {0x4042, 0x4c5a,   0}, {0x4051, 0x4c69,   0},
+	{0x4059, 0x4c71,   0}, {0x4061, 0x4c79,   0}, {0x4069, 0x4c81,   0},
+	{0x4071, 0x4c89,   0}, {0x407a, 0x4c92,   0}, {0x0000, 0x4ca1,   0},
+	{0x0000, 0x4ca9,   0}, {0x0000, 0x4cb1,   0}, {0x0000, 0x4cb9,   0},
+	{0x0000, 0x4cc1,   0}, {0x0000, 0x4cc9,   0}, {0x0000, 0x4cd1,   0},
+	{0x0000, 0x4cd9,   0}, {0x0000, 0x4ce1,   0}, {0x0000, 0x4ce9,   0},
+	{0x0000, 0x4cf1,   0}, {0x0000, 0x4cf9,   0}, {0x0000, 0x4d01,   0},
+	{0x0000, 0x4d09,   0}, {0x0000, 0x4d11,   0}, {0x0000, 0x4d19,   0},
+	{0x0000, 0x4d21,   0}, {0x0000, 0x4d29,   0}, {0x408a, 0x4d32,   0},
+	{0x409a, 0x4d42,   0}, {0x40aa, 0x4d52,   0}, {0x40ba, 0x4d62,   0},
+	{0x40ca, 0x4d72,   0}, {0x40da, 0x4d82,   0}, {0x40ea, 0x4d92,   0},
+	{0x40fa, 0x4da2,   0}, {0x410a, 0x4db2,   0}, {0x411a, 0x4dc2,   0},
+	{0x412a, 0x4dd2,   0}, {0x413a, 0x4de2,   0}, {0x414a, 0x4df2,   0},
+	{0x415a, 0x4e02,   0}, {0x416a, 0x4e12,   0}, {0x417a, 0x4e22,   0},
+	{0x418a, 0x4e32,   0}, {0x419a, 0x4e42,   0}, {0x41aa, 0x4e52,   0},
+	{0x41ba, 0x4e62,   0}, {0x41ca, 0x4e72,   0}, {0x41da, 0x4e82,   0},
+	{0x41ea, 0x4e92,   0}, {0x41fa, 0x4ea2,   0}, {0x420a, 0x4eb2,   0},
+	{0x421a, 0x4ec2,   0}, {0x422a, 0x4ed2,   0}, {0x423a, 0x4ee2,   0},
+	{0x424a, 0x4ef2,   0}, {0x425a, 0x4f02,   0}, {0x426a, 0x4f12,   0},
+	{0x427a, 0x4f22,   0}, {0x428a, 0x4f32,   0}, {0x429a, 0x4f42,   0},
+	{0x42aa, 0x4f52,   0}, {0x42ba, 0x4f62,   0}, {0x42ca, 0x4f72,   0},
+	{0x42da, 0x4f82,   0}, {0x42ea, 0x4f92,   0}, {0x42fa, 0x4fa2,   0},
+	{0x430a, 0x4fb2,   0}, {0x431a, 0x4fc2,   0}, {0x432a, 0x4fd2,   0},
+	{0x433a, 0x4fe2,   0}, {0x4349, 0x4ff1,   0}, {0x4351, 0x4ff9,   0},
+	{0x0000, 0x5001,   0}, {0x0000, 0x5009,   0}, {0x0000, 0x5011,   0},
+	{0x0000, 0x5019,   0}, {0x0000, 0x5021,   0}, {0x0000, 0x5029,   0},
+	{0x0000, 0x5031,   0}, {0x0000, 0x5039,   0}, {0x0000, 0x5041,   0},
+	{0x0000, 0x5049,   0}, {0x0000, 0x5051,   0}, {0x0000, 0x5059,   0},
+	{0x0000, 0x5061,   0}, {0x0000, 0x5069,   0}, {0x0000, 0x5071,   0},
+	{0x0000, 0x5079,   0}, {0x0000, 0x5081,   0}, {0x0000, 0x5089,   0},
+	{0x0000, 0x5091,   0}, {0x0000, 0x5099,   0}, {0x0000, 0x50a1,   0},
+	{0x0000, 0x50a9,   0}, {0x0000, 0x50b1,   0}, {0x0000, 0x50b9,   0},
+	{0x0000, 0x50c1,   0}, {0x0000, 0x50c9,   0}, {0x435a, 0x50d2,   0},
+	{0x0000, 0x50e1,   0}, {0x0000, 0x50e9,   0}, {0x0000, 0x50f1,   0},
+	{0x0000, 0x50f9,   0}, {0x0000, 0x5101,   0}, {0x0000, 0x5109,   0},
+	{0x0000, 0x5111,   0}, {0x0000, 0x5119,   0}, {0x0000, 0x5121,   0},
+	{0x0000, 0x5129,   0}, {0x0000, 0x5131,   0}, {0x0000, 0x5139,   0},
+	{0x0000, 0x5141,   0}, {0x0000, 0x5149,   0}, {0x0000, 0x5151,   0},
+	{0x0000, 0x5159,   0}, {0x0000, 0x5161,   0}, {0x0000, 0x5169,   0},
+	{0x0000, 0x5171,   0}, {0x0000, 0x5179,   0}, {0x0000, 0x5181,   0},
+	{0x0000, 0x5189,   0}, {0x0000, 0x5191,   0}, {0x0000, 0x5199,   0},
+	{0x0000, 0x51a1,   0}, {0x0000, 0x51a9,   0}, {0x0000, 0x51b1,   0},
+	{0x0000, 0x51b9,   0}, {0x0000, 0x51c1,   0}, {0x0000, 0x51c9,   0},
+	{0x0000, 0x51d1,   0}, {0x0000, 0x51d9,   0}, {0x0000, 0x51e1,   0},
+	{0x0000, 0x51e9,   0}, {0x0000, 0x51f1,   0}, {0x0000, 0x51f9,   0},
+	{0x0000, 0x5201,   0}, {0x0000, 0x5209,   0}, {0x0000, 0x5211,   0},
+	{0x0000, 0x5219,   0}, {0x0000, 0x5221,   0}, {0x0000, 0x5229,   0},
+	{0x0000, 0x5231,   0}, {0x0000, 0x5239,   0}, {0x0000, 0x5241,   0},
+	{0x0000, 0x5249,   0}, {0x0000, 0x5251,   0}, {0x0000, 0x5259,   0},
+	{0x0000, 0x5261,   0}, {0x0000, 0x5269,   0}, {0x0000, 0x5271,   0},
+	{0x0000, 0x5279,   0}, {0x0000, 0x5281,   0}, {0x0000, 0x5289,   0},
+	{0x0000, 0x5291,   0}, {0x0000, 0x5299,   0}, {0x0000, 0x52a1,   0},
+	{0x0000, 0x52a9,   0}, {0x0000, 0x52b1,   0}, {0x0000, 0x52b9,   0},
+	{0x0000, 0x52c1,   0}, {0x0000, 0x52c9,   0}, {0x0000, 0x52d1,   0},
+	{0x0000, 0x52d9,   0}, {0x0000, 0x52e1,   0}, {0x0000, 0x52e9,   0},
+	{0x0000, 0x52f1,   0}, {0x0000, 0x52f9,   0}, {0x0000, 0x5301,   0},
+	{0x0000, 0x5309,   0}, {0x0000, 0x5311,   0}, {0x0000, 0x5319,   0},
+	{0x0000, 0x5321,   0}, {0x0000, 0x5329,   0}, {0x0000, 0x5331,   0},
+	{0x0000, 0x5339,   0}, {0x0000, 0x5341,   0}, {0x0000, 0x5349,   0},
+	{0x0000, 0x5351,   0}, {0x0000, 0x5359,   0}, {0x0000, 0x5361,   0},
+	{0x0000, 0x5369,   0}, {0x0000, 0x5371,   0}, {0x0000, 0x5379,   0},
+	{0x0000, 0x5381,   0}, {0x0000, 0x5389,   0}, {0x0000, 0x5391,   0},
+	{0x0000, 0x5399,   0}, {0x0000, 0x53a1,   0}, {0x0000, 0x53a9,   0},
+	{0x0000, 0x53b1,   0}, {0x0000, 0x53b9,   0}, {0x0000, 0x53c1,   0},
+	{0x0000, 0x53c9,   0}, {0x0000, 0x53d1,   0}, {0x0000, 0x53d9,   0},
+	{0x0000, 0x53e1,   0}, {0x0000, 0x53e9,   0}, {0x0000, 0x53f1,   0},
+	{0x0000, 0x53f9,   0}, {0x0000, 0x5401,   0}, {0x0000, 0x5409,   0},
+	{0x0000, 0x5411,   0}, {0x0000, 0x5419,   0}, {0x0000, 0x5421,   0},
+	{0x0000, 0x5429,   0}, {0x0000, 0x5431,   0}, {0x0000, 0x5439,   0},
+	{0x0000, 0x5441,   0}, {0x0000, 0x5449,   0}, {0x0000, 0x5451,   0},
+	{0x0000, 0x5459,   0}, {0x0000, 0x5461,   0}, {0x0000, 0x5469,   0},
+	{0x0000, 0x5471,   0}, {0x0000, 0x0000, 218}, {0x0000, 0x0000, 224},
+	{0x436a, 0x547a,   0}, {0x437a, 0x548a,   0}, {0x438a, 0x549a,   0},
+	{0x439a, 0x54aa,   0}, {0x43aa, 0x54ba,   0}, {0x43ba, 0x54ca,   0},
+	{0x43ca, 0x54da,   0}, {0x43da, 0x54ea,   0}, {0x43ea, 0x54fa,   0},
+	{0x43fa, 0x550a,   0}, {0x440a, 0x551a,   0}, {0x441a, 0x552a,   0},
+	{0x442a, 0x553a,   0}, {0x443a, 0x554a,   0}, {0x444a, 0x555a,   0},
+	{0x445a, 0x556a,   0}, {0x446a, 0x557a,   0}, {0x447a, 0x558a,   0},
+	{0x448a, 0x559a,   0}, {0x449a, 0x55aa,   0}, {0x44aa, 0x55ba,   0},
+	{0x44ba, 0x55ca,   0}, {0x44ca, 0x55da,   0}, {0x44da, 0x55ea,   0},
+	{0x44ea, 0x55fa,   0}, {0x44fa, 0x560a,   0}, {0x0000, 0x0000,   8},
+	{0x450a, 0x561a,   0}, {0x451a, 0x562a,   0}, {0x452a, 0x563a,   0},
+	{0x453a, 0x564a,   0}, {0x454a, 0x565a,   0}, {0x455a, 0x566a,   0},
+	{0x456a, 0x567a,   0}, {0x457a, 0x568a,   0}, {0x458a, 0x569a,   0},
+	{0x459a, 0x56aa,   0}, {0x45aa, 0x56ba,   0}, {0x45ba, 0x56ca,   0},
+	{0x45ca, 0x56da,   0}, {0x45da, 0x56ea,   0}, {0x45ea, 0x56fa,   0},
+	{0x45fa, 0x570a,   0}, {0x460a, 0x571a,   0}, {0x461a, 0x572a,   0},
+	{0x462a, 0x573a,   0}, {0x463a, 0x574a,   0}, {0x464a, 0x575a,   0},
+	{0x465a, 0x576a,   0}, {0x466a, 0x577a,   0}, {0x467a, 0x578a,   0},
+	{0x468a, 0x579a,   0}, {0x469a, 0x57aa,   0}, {0x46aa, 0x57ba,   0},
+	{0x46ba, 0x57ca,   0}, {0x46ca, 0x57da,   0}, {0x46da, 0x57ea,   0},
+	{0x46ea, 0x57fa,   0}, {0x46fa, 0x580a,   0}, {0x0000, 0x5819,   0},
+	{0x0000, 0x5821,   0}, {0x0000, 0x5829,   0}, {0x0000, 0x5831,   0},
+	{0x0000, 0x5839,   0}, {0x0000, 0x5841,   0}, {0x0000, 0x5849,   0},
+	{0x0000, 0x5851,   0}, {0x0000, 0x5859,   0}, {0x0000, 0x5861,   0},
+	{0x0000, 0x5869,   0}, {0x0000, 0x5871,   0}, {0x0000, 0x5879,   0},
+	{0x0000, 0x5881,   0}, {0x0000, 0x5889,   0}, {0x0000, 0x5891,   0},
+	{0x0000, 0x5899,   0}, {0x0000, 0x58a1,   0}, {0x0000, 0x58a9,   0},
+	{0x0000, 0x58b1,   0}, {0x0000, 0x58b9,   0}, {0x0000, 0x58c1,   0},
+	{0x0000, 0x58c9,   0}, {0x0000, 0x58d1,   0}, {0x0000, 0x58d9,   0},
+	{0x0000, 0x58e1,   0}, {0x0000, 0x58e9,   0}, {0x0000, 0x58f1,   0},
+	{0x0000, 0x58f9,   0}, {0x0000, 0x5901,   0}, {0x0000, 0x5909,   0},
+	{0x0000, 0x5911,   0}, {0x0000, 0x5919,   0}, {0x0000, 0x5921,   0},
+	{0x0000, 0x5929,   0}, {0x0000, 0x5931,   0}, {0x0000, 0x5939,   0},
+	{0x0000, 0x5941,   0}, {0x0000, 0x5949,   0}, {0x0000, 0x5951,   0},
+	{0x0000, 0x5959,   0}, {0x0000, 0x5961,   0}, {0x0000, 0x5969,   0},
+	{0x0000, 0x5971,   0}, {0x0000, 0x5979,   0}, {0x0000, 0x5981,   0},
+	{0x0000, 0x5989,   0}, {0x0000, 0x5991,   0}, {0x0000, 0x5999,   0},
+	{0x0000, 0x59a1,   0}, {0x0000, 0x59a9,   0}, {0x0000, 0x59b1,   0},
+	{0x0000, 0x59b9,   0}, {0x0000, 0x59c1,   0}, {0x0000, 0x59c9,   0},
+	{0x0000, 0x59d1,   0}, {0x0000, 0x59d9,   0}, {0x0000, 0x59e1,   0},
+	{0x0000, 0x59e9,   0}, {0x0000, 0x59f1,   0}, {0x0000, 0x59f9,   0},
+	{0x0000, 0x5a01,   0}, {0x0000, 0x5a09,   0}, {0x0000, 0x5a11,   0},
+	{0x0000, 0x5a19,   0}, {0x0000, 0x5a21,   0}, {0x0000, 0x5a29,   0},
+	{0x0000, 0x5a31,   0}, {0x0000, 0x5a39,   0}, {0x0000, 0x5a41,   0},
+	{0x0000, 0x5a49,   0}, {0x0000, 0x5a51,   0}, {0x0000, 0x5a59,   0},
+	{0x0000, 0x5a61,   0}, {0x0000, 0x5a69,   0}, {0x0000, 0x5a71,   0},
+	{0x0000, 0x5a79,   0}, {0x0000, 0x5a81,   0}, {0x0000, 0x5a89,   0},
+	{0x0000, 0x5a91,   0}, {0x0000, 0x5a99,   0}, {0x0000, 0x5aa1,   0},
+	{0x0000, 0x5aa9,   0}, {0x0000, 0x5ab1,   0}, {0x0000, 0x5ab9,   0},
+	{0x0000, 0x5ac1,   0}, {0x0000, 0x5ac9,   0}, {0x0000, 0x5ad1,   0},
+	{0x0000, 0x5ad9,   0}, {0x0000, 0x5ae1,   0}, {0x0000, 0x5ae9,   0},
+	{0x0000, 0x5af1,   0}, {0x0000, 0x5af9,   0}, {0x0000, 0x5b01,   0},
+	{0x0000, 0x5b09,   0}, {0x0000, 0x5b11,   0}, {0x0000, 0x5b19,   0},
+	{0x0000, 0x5b21,   0}, {0x0000, 0x5b29,   0}, {0x0000, 0x5b31,   0},
+	{0x0000, 0x5b39,   0}, {0x0000, 0x5b41,   0}, {0x0000, 0x5b49,   0},
+	{0x0000, 0x5b51,   0}, {0x0000, 0x5b59,   0}, {0x0000, 0x5b61,   0},
+	{0x0000, 0x5b69,   0}, {0x0000, 0x5b71,   0}, {0x0000, 0x5b79,   0},
+	{0x0000, 0x5b81,   0}, {0x0000, 0x5b89,   0}, {0x0000, 0x5b91,   0},
+	{0x0000, 0x5b99,   0}, {0x0000, 0x5ba1,   0}, {0x0000, 0x5ba9,   0},
+	{0x0000, 0x5bb1,   0}, {0x0000, 0x5bb9,   0}, {0x0000, 0x5bc1,   0},
+	{0x0000, 0x5bc9,   0}, {0x0000, 0x5bd1,   0}, {0x0000, 0x5bd9,   0},
+	{0x0000, 0x5be1,   0}, {0x0000, 0x5be9,   0}, {0x0000, 0x5bf1,   0},
+	{0x0000, 0x5bf9,   0}, {0x0000, 0x5c01,   0}, {0x0000, 0x5c09,   0},
+	{0x0000, 0x5c11,   0}, {0x0000, 0x5c19,   0}, {0x0000, 0x5c21,   0},
+	{0x0000, 0x5c29,   0}, {0x0000, 0x5c31,   0}, {0x0000, 0x5c39,   0},
+	{0x0000, 0x5c41,   0}, {0x0000, 0x5c49,   0}, {0x0000, 0x5c51,   0},
+	{0x0000, 0x5c59,   0}, {0x0000, 0x5c61,   0}, {0x0000, 0x5c69,   0},
+	{0x0000, 0x5c71,   0}, {0x0000, 0x5c79,   0}, {0x0000, 0x5c81,   0},
+	{0x0000, 0x5c89,   0}, {0x0000, 0x5c91,   0}, {0x0000, 0x5c99,   0},
+	{0x0000, 0x5ca1,   0}, {0x0000, 0x5ca9,   0}, {0x0000, 0x5cb1,   0},
+	{0x0000, 0x5cb9,   0}, {0x0000, 0x5cc1,   0}, {0x0000, 0x5cc9,   0},
+	{0x0000, 0x5cd1,   0}, {0x0000, 0x5cd9,   0}, {0x0000, 0x5ce1,   0},
+	{0x0000, 0x5ce9,   0}, {0x0000, 0x5cf1,   0}, {0x0000, 0x5cf9,   0},
+	{0x0000, 0x5d01,   0}, {0x0000, 0x5d09,   0}, {0x0000, 0x5d11,   0},
+	{0x0000, 0x5d19,   0}, {0x0000, 0x5d21,   0}, {0x0000, 0x5d29,   0},
+	{0x0000, 0x5d31,   0}, {0x0000, 0x5d39,   0}, {0x0000, 0x5d41,   0},
+	{0x0000, 0x5d49,   0}, {0x0000, 0x5d51,   0}, {0x0000, 0x5d59,   0},
+	{0x0000, 0x5d61,   0}, {0x0000, 0x5d69,   0}, {0x0000, 0x5d71,   0},
+	{0x0000, 0x5d79,   0}, {0x0000, 0x5d81,   0}, {0x0000, 0x5d89,   0},
+	{0x0000, 0x5d91,   0}, {0x0000, 0x5d99,   0}, {0x0000, 0x5da1,   0},
+	{0x0000, 0x5da9,   0}, {0x0000, 0x5db1,   0}, {0x0000, 0x5db9,   0},
+	{0x0000, 0x5dc1,   0}, {0x0000, 0x5dc9,   0}, {0x0000, 0x5dd1,   0},
+	{0x0000, 0x5dd9,   0}, {0x0000, 0x5de1,   0}, {0x0000, 0x5de9,   0},
+	{0x0000, 0x5df1,   0}, {0x4709, 0x5df9,   0}, {0x4711, 0x5e01,   0},
+	{0x4719, 0x5e09,   0}, {0x4721, 0x5e11,   0}, {0x4729, 0x5e19,   0},
+	{0x4731, 0x5e21,   0}, {0x4739, 0x5e29,   0}, {0x4741, 0x5e31,   0},
+	{0x4749, 0x5e39,   0}, {0x4751, 0x5e41,   0}, {0x4759, 0x5e49,   0},
+	{0x4761, 0x5e51,   0}, {0x4769, 0x5e59,   0}, {0x4771, 0x5e61,   0},
+	{0x4779, 0x5e69,   0}, {0x4781, 0x5e71,   0}, {0x4789, 0x5e79,   0},
+	{0x4791, 0x5e81,   0}, {0x4799, 0x5e89,   0}, {0x47a1, 0x5e91,   0},
+	{0x47a9, 0x5e99,   0}, {0x47b1, 0x5ea1,   0}, {0x47b9, 0x5ea9,   0},
+	{0x47c1, 0x5eb1,   0}, {0x47c9, 0x5eb9,   0}, {0x47d1, 0x5ec1,   0},
+	{0x47d9, 0x5ec9,   0}, {0x47e1, 0x5ed1,   0}, {0x47e9, 0x5ed9,   0},
+	{0x47f1, 0x5ee1,   0}, {0x47f9, 0x5ee9,   0}, {0x4801, 0x5ef1,   0},
+	{0x4809, 0x5ef9,   0}, {0x4811, 0x5f01,   0}, {0x4819, 0x5f09,   0},
+	{0x4821, 0x5f11,   0}, {0x4829, 0x5f19,   0}, {0x4831, 0x5f21,   0},
+	{0x4839, 0x5f29,   0}, {0x4841, 0x5f31,   0}, {0x4849, 0x5f39,   0},
+	{0x4851, 0x5f41,   0}, {0x4859, 0x5f49,   0}, {0x4861, 0x5f51,   0},
+	{0x4869, 0x5f59,   0}, {0x4871, 0x5f61,   0}, {0x4879, 0x5f69,   0},
+	{0x4881, 0x5f71,   0}, {0x4889, 0x5f79,   0}, {0x4891, 0x5f81,   0},
+	{0x4899, 0x5f89,   0}, {0x48a1, 0x5f91,   0}, {0x48a9, 0x5f99,   0},
+	{0x48b1, 0x5fa1,   0}, {0x48b9, 0x5fa9,   0}, {0x48c1, 0x5fb1,   0},
+	{0x48c9, 0x5fb9,   0}, {0x48d1, 0x5fc1,   0}, {0x48d9, 0x5fc9,   0},
+	{0x48e1, 0x5fd1,   0}, {0x48e9, 0x5fd9,   0}, {0x48f1, 0x5fe1,   0},
+	{0x48f9, 0x5fe9,   0}, {0x4901, 0x5ff1,   0}, {0x4909, 0x5ff9,   0},
+	{0x4911, 0x6001,   0}, {0x4919, 0x6009,   0}, {0x4921, 0x6011,   0},
+	{0x4929, 0x6019,   0}, {0x4931, 0x6021,   0}, {0x4939, 0x6029,   0},
+	{0x4941, 0x6031,   0}, {0x4949, 0x6039,   0}, {0x4951, 0x6041,   0},
+	{0x4959, 0x6049,   0}, {0x4961, 0x6051,   0}, {0x4969, 0x6059,   0},
+	{0x4971, 0x6061,   0}, {0x4979, 0x6069,   0}, {0x4981, 0x6071,   0},
+	{0x4989, 0x6079,   0}, {0x4991, 0x6081,   0}, {0x4999, 0x6089,   0},
+	{0x49a1, 0x6091,   0}, {0x49a9, 0x6099,   0}, {0x49b1, 0x60a1,   0},
+	{0x49b9, 0x60a9,   0}, {0x49c1, 0x60b1,   0}, {0x49c9, 0x60b9,   0},
+	{0x49d1, 0x60c1,   0}, {0x49d9, 0x60c9,   0}, {0x49e1, 0x60d1,   0},
+	{0x49e9, 0x60d9,   0}, {0x49f1, 0x60e1,   0}, {0x49f9, 0x60e9,   0},
+	{0x4a01, 0x60f1,   0}, {0x4a09, 0x60f9,   0}, {0x4a11, 0x6101,   0},
+	{0x4a19, 0x6109,   0}, {0x4a21, 0x6111,   0}, {0x4a29, 0x6119,   0},
+	{0x4a31, 0x6121,   0}, {0x4a39, 0x6129,   0}, {0x4a41, 0x6131,   0},
+	{0x4a49, 0x6139,   0}, {0x4a51, 0x6141,   0}, {0x4a59, 0x6149,   0},
+	{0x4a61, 0x6151,   0}, {0x4a69, 0x6159,   0}, {0x4a71, 0x6161,   0},
+	{0x4a79, 0x6169,   0}, {0x4a81, 0x6171,   0}, {0x4a89, 0x6179,   0},
+	{0x4a91, 0x6181,   0}, {0x4a99, 0x6189,   0}, {0x4aa1, 0x6191,   0},
+	{0x4aa9, 0x6199,   0}, {0x4ab1, 0x61a1,   0}, {0x4ab9, 0x61a9,   0},
+	{0x4ac1, 0x61b1,   0}, {0x4ac9, 0x61b9,   0}, {0x4ad1, 0x61c1,   0},
+	{0x4ad9, 0x61c9,   0}, {0x4ae1, 0x61d1,   0}, {0x4ae9, 0x61d9,   0},
+	{0x4af1, 0x61e1,   0}, {0x4af9, 0x61e9,   0}, {0x4b01, 0x61f1,   0},
+	{0x4b09, 0x61f9,   0}, {0x4b11, 0x6201,   0}, {0x4b19, 0x6209,   0},
+	{0x4b21, 0x6211,   0}, {0x4b29, 0x6219,   0}, {0x4b31, 0x6221,   0},
+	{0x4b39, 0x6229,   0}, {0x4b41, 0x6231,   0}, {0x4b49, 0x6239,   0},
+	{0x4b51, 0x6241,   0}, {0x4b59, 0x6249,   0}, {0x4b61, 0x6251,   0},
+	{0x4b69, 0x6259,   0}, {0x4b71, 0x6261,   0}, {0x4b79, 0x6269,   0},
+	{0x4b81, 0x6271,   0}, {0x4b89, 0x6279,   0}, {0x4b91, 0x6281,   0},
+	{0x4b99, 0x6289,   0}, {0x4ba1, 0x6291,   0}, {0x4ba9, 0x6299,   0},
+	{0x4bb1, 0x62a1,   0}, {0x4bb9, 0x62a9,   0}, {0x4bc1, 0x62b1,   0},
+	{0x4bc9, 0x62b9,   0}, {0x4bd1, 0x62c1,   0}, {0x4bd9, 0x62c9,   0},
+	{0x4be1, 0x62d1,   0}, {0x4be9, 0x62d9,   0}, {0x4bf1, 0x62e1,   0},
+	{0x4bf9, 0x62e9,   0}, {0x4c01, 0x62f1,   0}, {0x4c09, 0x62f9,   0},
+	{0x4c11, 0x6301,   0}, {0x4c19, 0x6309,   0}, {0x4c21, 0x6311,   0},
+	{0x4c29, 0x6319,   0}, {0x4c31, 0x6321,   0}, {0x4c39, 0x6329,   0},
+	{0x4c41, 0x6331,   0}, {0x4c49, 0x6339,   0}, {0x4c51, 0x6341,   0},
+	{0x4c59, 0x6349,   0}, {0x4c61, 0x6351,   0}, {0x4c69, 0x6359,   0},
+	{0x4c71, 0x6361,   0}, {0x4c79, 0x6369,   0}, {0x4c81, 0x6371,   0},
+	{0x4c89, 0x6379,   0}, {0x4c91, 0x6381,   0}, {0x4c99, 0x6389,   0},
+	{0x4ca1, 0x6391,   0}, {0x4ca9, 0x6399,   0}, {0x4cb1, 0x63a1,   0},
+	{0x4cb9, 0x63a9,   0}, {0x4cc1, 0x63b1,   0}, {0x4cc9, 0x63b9,   0},
+	{0x4cd1, 0x63c1,   0}, {0x4cd9, 0x63c9,   0}, {0x4ce1, 0x63d1,   0},
+	{0x4ce9, 0x63d9,   0}, {0x4cf1, 0x63e1,   0}, {0x4cf9, 0x63e9,   0},
+	{0x4d01, 0x63f1,   0}, {0x4d09, 0x63f9,   0}, {0x4d11, 0x6401,   0},
+	{0x4d19, 0x6409,   0}, {0x4d21, 0x6411,   0}, {0x4d29, 0x6419,   0},
+	{0x4d31, 0x6421,   0}, {0x4d39, 0x6429,   0}, {0x4d41, 0x6431,   0},
+	{0x4d49, 0x6439,   0}, {0x4d51, 0x6441,   0}, {0x4d59, 0x6449,   0},
+	{0x4d61, 0x6451,   0}, {0x4d69, 0x6459,   0}, {0x4d71, 0x6461,   0},
+	{0x4d79, 0x6469,   0}, {0x4d81, 0x6471,   0}, {0x4d89, 0x6479,   0},
+	{0x4d91, 0x6481,   0}, {0x4d99, 0x6489,   0}, {0x4da1, 0x6491,   0},
+	{0x4da9, 0x6499,   0}, {0x4db1, 0x64a1,   0}, {0x4db9, 0x64a9,   0},
+	{0x4dc1, 0x64b1,   0}, {0x4dc9, 0x64b9,   0}, {0x4dd1, 0x64c1,   0},
+	{0x4dd9, 0x64c9,   0}, {0x4de1, 0x64d1,   0}, {0x4de9, 0x64d9,   0},
+	{0x4df1, 0x64e1,   0}, {0x4df9, 0x64e9,   0}, {0x4e01, 0x64f1,   0},
+	{0x4e09, 0x64f9,   0}, {0x4e11, 0x6501,   0}, {0x4e19, 0x6509,   0},
+	{0x4e21, 0x6511,   0}, {0x4e29, 0x6519,   0}, {0x4e31, 0x6521,   0},
+	{0x4e39, 0x6529,   0}, {0x4e41, 0x6531,   0}, {0x4e49, 0x6539,   0},
+	{0x4e51, 0x6541,   0}, {0x4e59, 0x6549,   0}, {0x4e61, 0x6551,   0},
+	{0x4e69, 0x6559,   0}, {0x4e71, 0x6561,   0}, {0x4e79, 0x6569,   0},
+	{0x4e81, 0x6571,   0}, {0x4e89, 0x6579,   0}, {0x4e91, 0x6581,   0},
+	{0x4e99, 0x6589,   0}, {0x4ea1, 0x6591,   0}, {0x4ea9, 0x6599,   0},
+	{0x4eb1, 0x65a1,   0}, {0x4eb9, 0x65a9,   0}, {0x4ec1, 0x65b1,   0},
+	{0x4ec9, 0x65b9,   0}, {0x4ed1, 0x65c1,   0}, {0x4ed9, 0x65c9,   0},
+	{0x4ee1, 0x65d1,   0}, {0x4ee9, 0x65d9,   0}, {0x4ef1, 0x65e1,   0},
+	{0x4ef9, 0x65e9,   0}, {0x4f01, 0x65f1,   0}, {0x4f09, 0x65f9,   0},
+	{0x4f11, 0x6601,   0}, {0x4f19, 0x6609,   0}, {0x4f21, 0x6611,   0},
+	{0x4f29, 0x6619,   0}, {0x4f31, 0x6621,   0}, {0x4f39, 0x6629,   0},
+	{0x4f41, 0x6631,   0}, {0x4f49, 0x6639,   0}, {0x4f51, 0x6641,   0},
+	{0x4f59, 0x6649,   0}, {0x4f61, 0x6651,   0}, {0x4f69, 0x6659,   0},
+	{0x4f71, 0x6661,   0}, {0x4f79, 0x6669,   0}, {0x4f81, 0x6671,   0},
+	{0x4f89, 0x6679,   0}, {0x4f91, 0x6681,   0}, {0x4f99, 0x6689,   0},
+	{0x4fa1, 0x6691,   0}, {0x4fa9, 0x6699,   0}, {0x4fb1, 0x66a1,   0},
+	{0x4fb9, 0x66a9,   0}, {0x4fc1, 0x66b1,   0}, {0x4fc9, 0x66b9,   0},
+	{0x4fd1, 0x66c1,   0}, {0x4fd9, 0x66c9,   0}, {0x4fe1, 0x66d1,   0},
+	{0x4fe9, 0x66d9,   0}, {0x4ff1, 0x66e1,   0}, {0x4ff9, 0x66e9,   0},
+	{0x5001, 0x66f1,   0}, {0x5009, 0x66f9,   0}, {0x5011, 0x6701,   0},
+	{0x5019, 0x6709,   0}, {0x5021, 0x6711,   0}, {0x5029, 0x6719,   0},
+	{0x5031, 0x6721,   0}, {0x5039, 0x6729,   0}, {0x5041, 0x6731,   0},
+	{0x5049, 0x6739,   0}, {0x5051, 0x6741,   0}, {0x5059, 0x6749,   0},
+	{0x5061, 0x6751,   0}, {0x5069, 0x6759,   0}, {0x5071, 0x6761,   0},
+	{0x5079, 0x6769,   0}, {0x5081, 0x6771,   0}, {0x5089, 0x6779,   0},
+	{0x5091, 0x6781,   0}, {0x5099, 0x6789,   0}, {0x50a1, 0x6791,   0},
+	{0x50a9, 0x6799,   0}, {0x50b1, 0x67a1,   0}, {0x50b9, 0x67a9,   0},
+	{0x50c1, 0x67b1,   0}, {0x50c9, 0x67b9,   0}, {0x50d1, 0x67c1,   0},
+	{0x50d9, 0x67c9,   0}, {0x50e1, 0x67d1,   0}, {0x50e9, 0x67d9,   0},
+	{0x50f1, 0x67e1,   0}, {0x50f9, 0x67e9,   0}, {0x5101, 0x67f1,   0},
+	{0x5109, 0x67f9,   0}, {0x5111, 0x6801,   0}, {0x5119, 0x6809,   0},
+	{0x5121, 0x6811,   0}, {0x5129, 0x6819,   0}, {0x5131, 0x6821,   0},
+	{0x5139, 0x6829,   0}, {0x5141, 0x6831,   0}, {0x5149, 0x6839,   0},
+	{0x5151, 0x6841,   0}, {0x5159, 0x6849,   0}, {0x5161, 0x6851,   0},
+	{0x5169, 0x6859,   0}, {0x5171, 0x6861,   0}, {0x5179, 0x6869,   0},
+	{0x5181, 0x6871,   0}, {0x5189, 0x6879,   0}, {0x5191, 0x6881,   0},
+	{0x5199, 0x6889,   0}, {0x51a1, 0x6891,   0}, {0x51a9, 0x6899,   0},
+	{0x51b1, 0x68a1,   0}, {0x51b9, 0x68a9,   0}, {0x51c1, 0x68b1,   0},
+	{0x51c9, 0x68b9,   0}, {0x51d1, 0x68c1,   0}, {0x51d9, 0x68c9,   0},
+	{0x51e1, 0x68d1,   0}, {0x51e9, 0x68d9,   0}, {0x51f1, 0x68e1,   0},
+	{0x51f9, 0x68e9,   0}, {0x5201, 0x68f1,   0}, {0x5209, 0x68f9,   0},
+	{0x5211, 0x6901,   0}, {0x5219, 0x6909,   0}, {0x5221, 0x6911,   0},
+	{0x5229, 0x6919,   0}, {0x5231, 0x6921,   0}, {0x5239, 0x6929,   0},
+	{0x5241, 0x6931,   0}, {0x5249, 0x6939,   0}, {0x5251, 0x6941,   0},
+	{0x5259, 0x6949,   0}, {0x5261, 0x6951,   0}, {0x5269, 0x6959,   0},
+	{0x5271, 0x6961,   0}, {0x5279, 0x6969,   0}, {0x5281, 0x6971,   0},
+	{0x5289, 0x6979,   0}, {0x5291, 0x6981,   0}, {0x5299, 0x6989,   0},
+	{0x52a1, 0x6991,   0}, {0x52a9, 0x6999,   0}, {0x52b1, 0x69a1,   0},
+	{0x52b9, 0x69a9,   0}, {0x52c1, 0x69b1,   0}, {0x52c9, 0x69b9,   0},
+	{0x52d1, 0x69c1,   0}, {0x52d9, 0x69c9,   0}, {0x52e1, 0x69d1,   0},
+	{0x52e9, 0x69d9,   0}, {0x52f1, 0x69e1,   0}, {0x52f9, 0x69e9,   0},
+	{0x5301, 0x69f1,   0}, {0x5309, 0x69f9,   0}, {0x5311, 0x6a01,   0},
+	{0x5319, 0x6a09,   0}, {0x5321, 0x6a11,   0}, {0x5329, 0x6a19,   0},
+	{0x5331, 0x6a21,   0}, {0x5339, 0x6a29,   0}, {0x5341, 0x6a31,   0},
+	{0x5349, 0x6a39,   0}, {0x5351, 0x6a41,   0}, {0x5359, 0x6a49,   0},
+	{0x5361, 0x6a51,   0}, {0x5369, 0x6a59,   0}, {0x5371, 0x6a61,   0},
+	{0x5379, 0x6a69,   0}, {0x5381, 0x6a71,   0}, {0x5389, 0x6a79,   0},
+	{0x5391, 0x6a81,   0}, {0x5399, 0x6a89,   0}, {0x53a1, 0x6a91,   0},
+	{0x53a9, 0x6a99,   0}, {0x53b1, 0x6aa1,   0}, {0x53b9, 0x6aa9,   0},
+	{0x53c1, 0x6ab1,   0}, {0x53c9, 0x6ab9,   0}, {0x53d1, 0x6ac1,   0},
+	{0x53d9, 0x6ac9,   0}, {0x53e1, 0x6ad1,   0}, {0x53e9, 0x6ad9,   0},
+	{0x53f1, 0x6ae1,   0}, {0x53f9, 0x6ae9,   0}, {0x5401, 0x6af1,   0},
+	{0x5409, 0x6af9,   0}, {0x5411, 0x6b01,   0}, {0x5419, 0x6b09,   0},
+	{0x5421, 0x6b11,   0}, {0x5429, 0x6b19,   0}, {0x5431, 0x6b21,   0},
+	{0x5439, 0x6b29,   0}, {0x5441, 0x6b31,   0}, {0x5449, 0x6b39,   0},
+	{0x5451, 0x6b41,   0}, {0x5459, 0x6b49,   0}, {0x5461, 0x6b51,   0},
+	{0x5469, 0x6b59,   0}, {0x5471, 0x6b61,   0}, {0x5479, 0x6b69,   0},
+	{0x5481, 0x6b71,   0}, {0x5489, 0x6b79,   0}, {0x5491, 0x6b81,   0},
+	{0x5499, 0x6b89,   0}, {0x54a1, 0x6b91,   0}, {0x54a9, 0x6b99,   0},
+	{0x54b1, 0x6ba1,   0}, {0x54b9, 0x6ba9,   0}, {0x54c1, 0x6bb1,   0},
+	{0x54c9, 0x6bb9,   0}, {0x54d1, 0x6bc1,   0}, {0x54d9, 0x6bc9,   0},
+	{0x54e1, 0x6bd1,   0}, {0x54e9, 0x6bd9,   0}, {0x54f1, 0x6be1,   0},
+	{0x54f9, 0x6be9,   0}, {0x5501, 0x6bf1,   0}, {0x5509, 0x6bf9,   0},
+	{0x5511, 0x6c01,   0}, {0x5519, 0x6c09,   0}, {0x5521, 0x6c11,   0},
+	{0x5529, 0x6c19,   0}, {0x5531, 0x6c21,   0}, {0x5539, 0x6c29,   0},
+	{0x5541, 0x6c31,   0}, {0x5549, 0x6c39,   0}, {0x5551, 0x6c41,   0},
+	{0x5559, 0x6c49,   0}, {0x5561, 0x6c51,   0}, {0x0000, 0x6c5a,   0},
+	{0x0000, 0x6c6a,   0}, {0x0000, 0x6c7a,   0}, {0x0000, 0x6c8b,   0},
+	{0x0000, 0x6ca3,   0}, {0x0000, 0x6cba,   0}, {0x0000, 0x6cca,   0},
+	{0x0000, 0x6cda,   0}, {0x0000, 0x6cea,   0}, {0x0000, 0x6cfa,   0},
+	{0x0000, 0x6d0a,   0}, {0x0000, 0x6d1a,   0}, {0x556a, 0x6d2a,   0},
+	{0x0000, 0x0000,  26}, {0x557a, 0x6d3a,   0}, {0x558a, 0x6d4a,   0},
+	{0x559a, 0x6d5a,   0}, {0x55ab, 0x6d6b,   0}, {0x55c3, 0x6d83,   0},
+	{0x55da, 0x6d9a,   0}, {0x55ea, 0x6daa,   0}, {0x55fa, 0x6dba,   0},
+	{0x560a, 0x6dca,   0}, {0x561a, 0x6dda,   0}, {0x562a, 0x6dea,   0},
+	{0x563a, 0x6dfa,   0}, {0x564a, 0x6e0a,   0}, {0x565a, 0x6e1a,   0},
+	{0x566a, 0x6e2a,   0}, {0x567a, 0x6e3a,   0}, {0x568a, 0x6e4a,   0},
+	{0x569a, 0x6e5a,   0}, {0x56aa, 0x6e6a,   0}, {0x56ba, 0x6e7a,   0},
+	{0x56ca, 0x6e8a,   0}, {0x56da, 0x6e9a,   0}, {0x56ea, 0x6eaa,   0},
+	{0x56fa, 0x6eba,   0}, {0x570a, 0x6eca,   0}, {0x571a, 0x6eda,   0},
+	{0x572a, 0x6eea,   0}, {0x573a, 0x6efa,   0}, {0x574a, 0x6f0a,   0},
+	{0x575a, 0x6f1a,   0}, {0x576a, 0x6f2a,   0}, {0x577a, 0x6f3a,   0},
+	{0x578a, 0x6f4a,   0}, {0x0000, 0x6f59,   0}, {0x0000, 0x6f61,   0},
+	{0x0000, 0x6f69,   0}, {0x0000, 0x6f71,   0}, {0x0000, 0x6f79,   0},
+	{0x0000, 0x6f81,   0}, {0x0000, 0x6f89,   0}, {0x0000, 0x6f91,   0},
+	{0x0000, 0x6f99,   0}, {0x0000, 0x6fa1,   0}, {0x0000, 0x6fa9,   0},
+	{0x0000, 0x6fb1,   0}, {0x0000, 0x6fb9,   0}, {0x0000, 0x6fc1,   0},
+	{0x0000, 0x6fc9,   0}, {0x0000, 0x6fd1,   0}, {0x0000, 0x6fd9,   0},
+	{0x0000, 0x6fe1,   0}, {0x0000, 0x6fe9,   0}, {0x0000, 0x6ff1,   0},
+	{0x0000, 0x6ff9,   0}, {0x0000, 0x7001,   0}, {0x0000, 0x7009,   0},
+	{0x0000, 0x7011,   0}, {0x0000, 0x7019,   0}, {0x0000, 0x7021,   0},
+	{0x0000, 0x7029,   0}, {0x0000, 0x7031,   0}, {0x0000, 0x7039,   0},
+	{0x0000, 0x7041,   0}, {0x0000, 0x7049,   0}, {0x0000, 0x7051,   0},
+	{0x0000, 0x7059,   0}, {0x0000, 0x7061,   0}, {0x0000, 0x7069,   0},
+	{0x0000, 0x7071,   0}, {0x0000, 0x7079,   0}, {0x0000, 0x7081,   0},
+	{0x0000, 0x7089,   0}, {0x0000, 0x7091,   0}, {0x0000, 0x7099,   0},
+	{0x0000, 0x70a1,   0}, {0x0000, 0x70a9,   0}, {0x0000, 0x70b1,   0},
+	{0x0000, 0x70b9,   0}, {0x0000, 0x70c1,   0}, {0x0000, 0x70c9,   0},
+	{0x0000, 0x70d1,   0}, {0x0000, 0x70d9,   0}, {0x0000, 0x70e1,   0},
+	{0x0000, 0x70e9,   0}, {0x0000, 0x70f1,   0}, {0x0000, 0x70f9,   0},
+	{0x0000, 0x7101,   0}, {0x0000, 0x7109,   0}, {0x0000, 0x7111,   0},
+	{0x0000, 0x7119,   0}, {0x0000, 0x7121,   0}, {0x0000, 0x7129,   0},
+	{0x0000, 0x7131,   0}, {0x0000, 0x7139,   0}, {0x0000, 0x7141,   0},
+	{0x0000, 0x7149,   0}, {0x0000, 0x7151,   0}, {0x0000, 0x7159,   0},
+	{0x0000, 0x7161,   0}, {0x0000, 0x7169,   0}, {0x0000, 0x7171,   0},
+	{0x0000, 0x7179,   0}, {0x0000, 0x7181,   0}, {0x0000, 0x7189,   0},
+	{0x0000, 0x7191,   0}, {0x0000, 0x7199,   0}, {0x0000, 0x71a1,   0},
+	{0x0000, 0x71a9,   0}, {0x0000, 0x71b1,   0}, {0x0000, 0x71b9,   0},
+	{0x0000, 0x71c1,   0}, {0x0000, 0x71c9,   0}, {0x0000, 0x71d1,   0},
+	{0x0000, 0x71d9,   0}, {0x0000, 0x71e1,   0}, {0x0000, 0x71e9,   0},
+	{0x0000, 0x71f1,   0}, {0x0000, 0x71f9,   0}, {0x0000, 0x7201,   0},
+	{0x0000, 0x7209,   0}, {0x0000, 0x7211,   0}, {0x0000, 0x7219,   0},
+	{0x0000, 0x7221,   0}, {0x0000, 0x7229,   0}, {0x0000, 0x7231,   0},
+	{0x0000, 0x7239,   0}, {0x0000, 0x7241,   0}, {0x0000, 0x7249,   0},
+	{0x0000, 0x7251,   0}, {0x0000, 0x7259,   0}, {0x0000, 0x7261,   0},
+	{0x0000, 0x7269,   0}, {0x0000, 0x7271,   0}, {0x0000, 0x7279,   0},
+	{0x0000, 0x7281,   0}, {0x0000, 0x7289,   0}, {0x0000, 0x7291,   0},
+	{0x0000, 0x7299,   0}, {0x0000, 0x72a1,   0}, {0x0000, 0x72a9,   0},
+	{0x0000, 0x72b1,   0}, {0x0000, 0x72b9,   0}, {0x0000, 0x72c1,   0},
+	{0x0000, 0x72c9,   0}, {0x0000, 0x72d1,   0}, {0x0000, 0x72d9,   0},
+	{0x0000, 0x72e1,   0}, {0x0000, 0x72e9,   0}, {0x0000, 0x72f1,   0},
+	{0x0000, 0x72f9,   0}, {0x0000, 0x7301,   0}, {0x0000, 0x7309,   0},
+	{0x0000, 0x7311,   0}, {0x0000, 0x7319,   0}, {0x0000, 0x7321,   0},
+	{0x0000, 0x7329,   0}, {0x0000, 0x7331,   0}, {0x0000, 0x7339,   0},
+	{0x0000, 0x7341,   0}, {0x0000, 0x7349,   0}, {0x0000, 0x7351,   0},
+	{0x0000, 0x7359,   0}, {0x0000, 0x7361,   0}, {0x0000, 0x7369,   0},
+	{0x0000, 0x7371,   0}, {0x0000, 0x7379,   0}, {0x0000, 0x7381,   0},
+	{0x0000, 0x7389,   0}, {0x0000, 0x7391,   0}, {0x0000, 0x7399,   0},
+	{0x0000, 0x73a1,   0}, {0x0000, 0x73a9,   0}, {0x0000, 0x73b1,   0},
+	{0x0000, 0x73b9,   0}, {0x0000, 0x73c1,   0}, {0x0000, 0x73c9,   0},
+	{0x0000, 0x73d1,   0}, {0x0000, 0x73d9,   0}, {0x0000, 0x73e1,   0},
+	{0x0000, 0x73e9,   0}, {0x0000, 0x73f1,   0}, {0x0000, 0x73f9,   0},
+	{0x0000, 0x7401,   0}, {0x0000, 0x7409,   0}, {0x0000, 0x7411,   0},
+	{0x0000, 0x7419,   0}, {0x579a, 0x7422,   0}, {0x57aa, 0x7432,   0},
+	{0x57ba, 0x7442,   0}, {0x57ca, 0x7452,   0}, {0x57da, 0x7462,   0},
+	{0x57ea, 0x7472,   0}, {0x57fa, 0x7482,   0}, {0x580a, 0x7492,   0},
+	{0x581a, 0x74a2,   0}, {0x582a, 0x74b2,   0}, {0x583a, 0x74c2,   0},
+	{0x584a, 0x74d2,   0}, {0x0000, 0x74e1,   0}, {0x0000, 0x74e9,   0},
+	{0x0000, 0x74f1,   0}, {0x0000, 0x74f9,   0}, {0x0000, 0x7501,   0},
+	{0x0000, 0x7509,   0}, {0x0000, 0x7511,   0}, {0x0000, 0x7519,   0},
+	{0x0000, 0x7521,   0}, {0x0000, 0x7529,   0}, {0x0000, 0x7531,   0},
+	{0x0000, 0x7539,   0}, {0x0000, 0x7541,   0}, {0x0000, 0x7549,   0},
+	{0x0000, 0x7551,   0}, {0x0000, 0x7559,   0}, {0x0000, 0x7561,   0},
+	{0x0000, 0x7569,   0}, {0x0000, 0x7571,   0}, {0x0000, 0x7579,   0},
+	{0x0000, 0x7581,   0}, {0x0000, 0x7589,   0}, {0x0000, 0x7591,   0},
+	{0x0000, 0x7599,   0}, {0x0000, 0x75a1,   0}, {0x0000, 0x75a9,   0},
+	{0x0000, 0x75b1,   0}, {0x0000, 0x75b9,   0}, {0x0000, 0x75c1,   0},
+	{0x0000, 0x75c9,   0}, {0x0000, 0x75d1,   0}, {0x0000, 0x75d9,   0},
+	{0x585a, 0x75e2,   0}, {0x586a, 0x75f2,   0}, {0x587b, 0x7603,   0},
+	{0x5893, 0x761b,   0}, {0x58ab, 0x7633,   0}, {0x58c3, 0x764b,   0},
+	{0x58db, 0x7663,   0}, {0x0000, 0x0000, 226}, {0x58f2, 0x767a,   0},
+	{0x5902, 0x768a,   0}, {0x5913, 0x769b,   0}, {0x592b, 0x76b3,   0},
+	{0x5943, 0x76cb,   0}, {0x595b, 0x76e3,   0}, {0x0000, 0x76f9,   0},
+	{0x0000, 0x7701,   0}, {0x0000, 0x7709,   0}, {0x0000, 0x7711,   0},
+	{0x0000, 0x7719,   0}, {0x0000, 0x7721,   0}, {0x0000, 0x7729,   0},
+	{0x0000, 0x7731,   0}, {0x0000, 0x7739,   0}, {0x0000, 0x7741,   0},
+	{0x0000, 0x7749,   0}, {0x0000, 0x7751,   0}, {0x0000, 0x7759,   0},
+	{0x0000, 0x7761,   0}, {0x0000, 0x7769,   0}, {0x0000, 0x7771,   0},
+	{0x0000, 0x7779,   0}, {0x0000, 0x7781,   0}, {0x0000, 0x7789,   0},
+	{0x0000, 0x7791,   0}, {0x0000, 0x7799,   0}, {0x0000, 0x77a1,   0},
+	{0x0000, 0x77a9,   0}, {0x0000, 0x77b1,   0}, {0x0000, 0x77b9,   0},
+	{0x0000, 0x77c1,   0}, {0x0000, 0x77c9,   0}, {0x0000, 0x77d1,   0},
+	{0x0000, 0x77d9,   0}, {0x0000, 0x77e1,   0}, {0x0000, 0x77e9,   0},
+	{0x0000, 0x77f1,   0}, {0x0000, 0x77f9,   0}, {0x0000, 0x7801,   0},
+	{0x5971, 0x7809,   0}, {0x5979, 0x7811,   0}, {0x5981, 0x7819,   0},
+	{0x5989, 0x7821,   0}, {0x5991, 0x7829,   0}, {0x5999, 0x7831,   0},
+	{0x59a1, 0x7839,   0}, {0x59a9, 0x7841,   0}, {0x59b1, 0x7849,   0},
+	{0x59b9, 0x7851,   0}, {0x59c1, 0x7859,   0}, {0x59c9, 0x7861,   0},
+	{0x59d1, 0x7869,   0}, {0x59d9, 0x7871,   0}, {0x59e1, 0x7879,   0},
+	{0x59e9, 0x7881,   0}, {0x59f1, 0x7889,   0}, {0x59f9, 0x7891,   0},
+	{0x5a01, 0x7899,   0}, {0x5a09, 0x78a1,   0}, {0x5a11, 0x78a9,   0},
+	{0x5a19, 0x78b1,   0}, {0x5a21, 0x78b9,   0}, {0x5a29, 0x78c1,   0},
+	{0x5a31, 0x78c9,   0}, {0x5a39, 0x78d1,   0}, {0x5a41, 0x78d9,   0},
+	{0x5a49, 0x78e1,   0}, {0x5a51, 0x78e9,   0}, {0x5a59, 0x78f1,   0},
+	{0x5a61, 0x78f9,   0}, {0x5a69, 0x7901,   0}, {0x5a71, 0x7909,   0},
+	{0x5a79, 0x7911,   0}, {0x5a81, 0x7919,   0}, {0x5a89, 0x7921,   0},
+	{0x5a91, 0x7929,   0}, {0x5a99, 0x7931,   0}, {0x5aa1, 0x7939,   0},
+	{0x5aa9, 0x7941,   0}, {0x5ab1, 0x7949,   0}, {0x5ab9, 0x7951,   0},
+	{0x5ac1, 0x7959,   0}, {0x5ac9, 0x7961,   0}, {0x5ad1, 0x7969,   0},
+	{0x5ad9, 0x7971,   0}, {0x5ae1, 0x7979,   0}, {0x5ae9, 0x7981,   0},
+	{0x5af1, 0x7989,   0}, {0x5af9, 0x7991,   0}, {0x5b01, 0x7999,   0},
+	{0x5b09, 0x79a1,   0}, {0x5b11, 0x79a9,   0}, {0x5b19, 0x79b1,   0},
+	{0x5b21, 0x79b9,   0}, {0x5b29, 0x79c1,   0}, {0x5b31, 0x79c9,   0},
+	{0x5b39, 0x79d1,   0}, {0x5b41, 0x79d9,   0}, {0x5b49, 0x79e1,   0},
+	{0x5b51, 0x79e9,   0}, {0x5b59, 0x79f1,   0}, {0x5b61, 0x79f9,   0},
+	{0x5b69, 0x7a01,   0}, {0x5b71, 0x7a09,   0}, {0x5b79, 0x7a11,   0},
+	{0x5b81, 0x7a19,   0}, {0x5b89, 0x7a21,   0}, {0x5b91, 0x7a29,   0},
+	{0x5b99, 0x7a31,   0}, {0x5ba1, 0x7a39,   0}, {0x5ba9, 0x7a41,   0},
+	{0x5bb1, 0x7a49,   0}, {0x5bb9, 0x7a51,   0}, {0x5bc1, 0x7a59,   0},
+	{0x5bc9, 0x7a61,   0}, {0x5bd1, 0x7a69,   0}, {0x5bd9, 0x7a71,   0},
+	{0x5be1, 0x7a79,   0}, {0x5be9, 0x7a81,   0}, {0x5bf1, 0x7a89,   0},
+	{0x5bf9, 0x7a91,   0}, {0x5c01, 0x7a99,   0}, {0x5c09, 0x7aa1,   0},
+	{0x5c11, 0x7aa9,   0}, {0x5c19, 0x7ab1,   0}, {0x5c21, 0x7ab9,   0},
+	{0x5c29, 0x7ac1,   0}, {0x5c31, 0x7ac9,   0}, {0x5c39, 0x7ad1,   0},
+	{0x5c41, 0x7ad9,   0}, {0x5c49, 0x7ae1,   0}, {0x5c51, 0x7ae9,   0},
+	{0x5c59, 0x7af1,   0}, {0x5c61, 0x7af9,   0}, {0x5c69, 0x7b01,   0},
+	{0x5c71, 0x7b09,   0}, {0x5c79, 0x7b11,   0}, {0x5c81, 0x7b19,   0},
+	{0x5c89, 0x7b21,   0}, {0x5c91, 0x7b29,   0}, {0x5c99, 0x7b31,   0},
+	{0x5ca1, 0x7b39,   0}, {0x5ca9, 0x7b41,   0}, {0x5cb1, 0x7b49,   0},
+	{0x5cb9, 0x7b51,   0}, {0x5cc1, 0x7b59,   0}, {0x5cc9, 0x7b61,   0},
+	{0x5cd1, 0x7b69,   0}, {0x5cd9, 0x7b71,   0}, {0x5ce1, 0x7b79,   0},
+	{0x5ce9, 0x7b81,   0}, {0x5cf1, 0x7b89,   0}, {0x5cf9, 0x7b91,   0},
+	{0x5d01, 0x7b99,   0}, {0x5d09, 0x7ba1,   0}, {0x5d11, 0x7ba9,   0},
+	{0x5d19, 0x7bb1,   0}, {0x5d21, 0x7bb9,   0}, {0x5d29, 0x7bc1,   0},
+	{0x5d31, 0x7bc9,   0}, {0x5d39, 0x7bd1,   0}, {0x5d41, 0x7bd9,   0},
+	{0x5d49, 0x7be1,   0}, {0x5d51, 0x7be9,   0}, {0x5d59, 0x7bf1,   0},
+	{0x5d61, 0x7bf9,   0}, {0x5d69, 0x7c01,   0}, {0x5d71, 0x7c09,   0},
+	{0x5d79, 0x7c11,   0}, {0x5d81, 0x7c19,   0}, {0x5d89, 0x7c21,   0},
+	{0x5d91, 0x7c29,   0}, {0x5d99, 0x7c31,   0}, {0x5da1, 0x7c39,   0},
+	{0x5da9, 0x7c41,   0}, {0x5db1, 0x7c49,   0}, {0x5db9, 0x7c51,   0},
+	{0x5dc1, 0x7c59,   0}, {0x5dc9, 0x7c61,   0}, {0x5dd1, 0x7c69,   0},
+	{0x5dd9, 0x7c71,   0}, {0x5de1, 0x7c79,   0}, {0x5de9, 0x7c81,   0},
+	{0x5df1, 0x7c89,   0}, {0x5df9, 0x7c91,   0}, {0x5e01, 0x7c99,   0},
+	{0x5e09, 0x7ca1,   0}, {0x5e11, 0x7ca9,   0}, {0x5e19, 0x7cb1,   0},
+	{0x5e21, 0x7cb9,   0}, {0x5e29, 0x7cc1,   0}, {0x5e31, 0x7cc9,   0},
+	{0x5e39, 0x7cd1,   0}, {0x5e41, 0x7cd9,   0}, {0x5e49, 0x7ce1,   0},
+	{0x5e51, 0x7ce9,   0}, {0x5e59, 0x7cf1,   0}, {0x5e61, 0x7cf9,   0},
+	{0x5e69, 0x7d01,   0}, {0x5e71, 0x7d09,   0}, {0x5e79, 0x7d11,   0},
+	{0x5e81, 0x7d19,   0}, {0x5e89, 0x7d21,   0}, {0x5e91, 0x7d29,   0},
+	{0x5e99, 0x7d31,   0}, {0x5ea1, 0x7d39,   0}, {0x5ea9, 0x7d41,   0},
+	{0x5eb1, 0x7d49,   0}, {0x5eb9, 0x7d51,   0}, {0x5ec1, 0x7d59,   0},
+	{0x5ec9, 0x7d61,   0}, {0x5ed1, 0x7d69,   0}, {0x5ed9, 0x7d71,   0},
+	{0x5ee1, 0x7d79,   0}, {0x5ee9, 0x7d81,   0}, {0x5ef1, 0x7d89,   0},
+	{0x5ef9, 0x7d91,   0}, {0x5f01, 0x7d99,   0}, {0x5f09, 0x7da1,   0},
+	{0x5f11, 0x7da9,   0}, {0x5f19, 0x7db1,   0}, {0x5f21, 0x7db9,   0},
+	{0x5f29, 0x7dc1,   0}, {0x5f31, 0x7dc9,   0}, {0x5f39, 0x7dd1,   0},
+	{0x5f41, 0x7dd9,   0}, {0x5f49, 0x7de1,   0}, {0x5f51, 0x7de9,   0},
+	{0x5f59, 0x7df1,   0}, {0x5f61, 0x7df9,   0}, {0x5f69, 0x7e01,   0},
+	{0x5f71, 0x7e09,   0}, {0x5f79, 0x7e11,   0}, {0x5f81, 0x7e19,   0},
+	{0x5f89, 0x7e21,   0}, {0x5f91, 0x7e29,   0}, {0x5f99, 0x7e31,   0},
+	{0x5fa1, 0x7e39,   0}, {0x5fa9, 0x7e41,   0}, {0x5fb1, 0x7e49,   0},
+	{0x5fb9, 0x7e51,   0}, {0x5fc1, 0x7e59,   0}, {0x5fc9, 0x7e61,   0},
+	{0x5fd1, 0x7e69,   0}, {0x5fd9, 0x7e71,   0}, {0x5fe1, 0x7e79,   0},
+	{0x5fe9, 0x7e81,   0}, {0x5ff1, 0x7e89,   0}, {0x5ff9, 0x7e91,   0},
+	{0x6001, 0x7e99,   0}, {0x6009, 0x7ea1,   0}, {0x6011, 0x7ea9,   0},
+	{0x6019, 0x7eb1,   0}, {0x6021, 0x7eb9,   0}, {0x6029, 0x7ec1,   0},
+	{0x6031, 0x7ec9,   0}, {0x6039, 0x7ed1,   0}, {0x6041, 0x7ed9,   0},
+	{0x6049, 0x7ee1,   0}, {0x6051, 0x7ee9,   0}, {0x6059, 0x7ef1,   0},
+	{0x6061, 0x7ef9,   0}, {0x6069, 0x7f01,   0}, {0x6071, 0x7f09,   0},
+	{0x6079, 0x7f11,   0}, {0x6081, 0x7f19,   0}, {0x6089, 0x7f21,   0},
+	{0x6091, 0x7f29,   0}, {0x6099, 0x7f31,   0}, {0x60a1, 0x7f39,   0},
+	{0x60a9, 0x7f41,   0}, {0x60b1, 0x7f49,   0}, {0x60b9, 0x7f51,   0},
+	{0x60c1, 0x7f59,   0}, {0x60c9, 0x7f61,   0}, {0x60d1, 0x7f69,   0},
+	{0x60d9, 0x7f71,   0}, {0x60e1, 0x7f79,   0}, {0x60e9, 0x7f81,   0},
+	{0x60f1, 0x7f89,   0}, {0x60f9, 0x7f91,   0}, {0x6101, 0x7f99,   0},
+	{0x6109, 0x7fa1,   0}, {0x6111, 0x7fa9,   0}, {0x6119, 0x7fb1,   0},
+	{0x6121, 0x7fb9,   0}, {0x6129, 0x7fc1,   0}, {0x6131, 0x7fc9,   0},
+	{0x6139, 0x7fd1,   0}, {0x6141, 0x7fd9,   0}, {0x6149, 0x7fe1,   0},
+	{0x6151, 0x7fe9,   0}, {0x6159, 0x7ff1,   0}, {0x6161, 0x7ff9,   0},
+	{0x6169, 0x8001,   0}, {0x6171, 0x8009,   0}, {0x6179, 0x8011,   0},
+	{0x6181, 0x8019,   0}, {0x6189, 0x8021,   0}, {0x6191, 0x8029,   0},
+	{0x6199, 0x8031,   0}, {0x61a1, 0x8039,   0}, {0x61a9, 0x8041,   0},
+	{0x61b1, 0x8049,   0}, {0x61b9, 0x8051,   0}, {0x61c1, 0x8059,   0},
+	{0x61c9, 0x8061,   0}, {0x61d1, 0x8069,   0}, {0x61d9, 0x8071,   0},
+	{0x61e1, 0x8079,   0}, {0x61e9, 0x8081,   0}, {0x61f1, 0x8089,   0},
+	{0x61f9, 0x8091,   0}, {0x6201, 0x8099,   0}, {0x6209, 0x80a1,   0},
+	{0x6211, 0x80a9,   0}, {0x6219, 0x80b1,   0}, {0x6221, 0x80b9,   0},
+	{0x6229, 0x80c1,   0}, {0x6231, 0x80c9,   0}, {0x6239, 0x80d1,   0},
+	{0x6241, 0x80d9,   0}, {0x6249, 0x80e1,   0}, {0x6251, 0x80e9,   0},
+	{0x6259, 0x80f1,   0}, {0x6261, 0x80f9,   0}, {0x6269, 0x8101,   0},
+	{0x6271, 0x8109,   0}, {0x6279, 0x8111,   0}, {0x6281, 0x8119,   0},
+	{0x6289, 0x8121,   0}, {0x6291, 0x8129,   0}, {0x6299, 0x8131,   0},
+	{0x62a1, 0x8139,   0}, {0x62a9, 0x8141,   0}, {0x62b1, 0x8149,   0},
+	{0x62b9, 0x8151,   0}, {0x62c1, 0x8159,   0}, {0x62c9, 0x8161,   0},
+	{0x62d1, 0x8169,   0}, {0x62d9, 0x8171,   0}, {0x62e1, 0x8179,   0},
+	{0x62e9, 0x8181,   0}, {0x62f1, 0x8189,   0}, {0x62f9, 0x8191,   0},
+	{0x6301, 0x8199,   0}, {0x6309, 0x81a1,   0}, {0x6311, 0x81a9,   0},
+	{0x6319, 0x81b1,   0}, {0x6321, 0x81b9,   0}, {0x6329, 0x81c1,   0},
+	{0x6331, 0x81c9,   0}, {0x6339, 0x81d1,   0}, {0x6341, 0x81d9,   0},
+	{0x6349, 0x81e1,   0}, {0x6351, 0x81e9,   0}, {0x6359, 0x81f1,   0},
+	{0x6361, 0x81f9,   0}, {0x6369, 0x8201,   0}, {0x6371, 0x8209,   0},
+	{0x6379, 0x8211,   0}, {0x6381, 0x8219,   0}, {0x6389, 0x8221,   0},
+	{0x6391, 0x8229,   0}, {0x6399, 0x8231,   0}, {0x63a1, 0x8239,   0},
+	{0x63a9, 0x8241,   0}, {0x63b1, 0x8249,   0}, {0x63b9, 0x8251,   0},
+	{0x63c1, 0x8259,   0}, {0x63c9, 0x8261,   0}, {0x63d1, 0x8269,   0},
+	{0x63d9, 0x8271,   0}, {0x63e1, 0x8279,   0}, {0x63e9, 0x8281,   0},
+	{0x63f1, 0x8289,   0}, {0x63f9, 0x8291,   0}, {0x6401, 0x8299,   0},
+	{0x6409, 0x82a1,   0}, {0x6411, 0x82a9,   0}, {0x6419, 0x82b1,   0},
+	{0x6421, 0x82b9,   0}, {0x6429, 0x82c1,   0}, {0x6431, 0x82c9,   0},
+	{0x6439, 0x82d1,   0}, {0x6441, 0x82d9,   0}, {0x6449, 0x82e1,   0},
+	{0x6451, 0x82e9,   0}, {0x6459, 0x82f1,   0}, {0x6461, 0x82f9,   0},
+	{0x6469, 0x8301,   0}, {0x6471, 0x8309,   0}, {0x6479, 0x8311,   0},
+	{0x6481, 0x8319,   0}, {0x6489, 0x8321,   0}, {0x6491, 0x8329,   0},
+	{0x6499, 0x8331,   0}, {0x64a1, 0x8339,   0}, {0x64a9, 0x8341,   0},
+	{0x64b1, 0x8349,   0}, {0x64b9, 0x8351,   0}, {0x64c1, 0x8359,   0},
+	{0x64c9, 0x8361,   0}, {0x64d1, 0x8369,   0}, {0x64d9, 0x8371,   0},
+	{0x64e1, 0x8379,   0}, {0x64e9, 0x8381,   0}, {0x64f1, 0x8389,   0},
+	{0x64f9, 0x8391,   0}, {0x6501, 0x8399,   0}, {0x6509, 0x83a1,   0},
+	{0x6511, 0x83a9,   0}, {0x6519, 0x83b1,   0}, {0x6521, 0x83b9,   0},
+	{0x6529, 0x83c1,   0}, {0x6531, 0x83c9,   0}, {0x6539, 0x83d1,   0},
+	{0x6541, 0x83d9,   0}, {0x6549, 0x83e1,   0}, {0x6551, 0x83e9,   0},
+	{0x6559, 0x83f1,   0}, {0x6561, 0x83f9,   0}, {0x6569, 0x8401,   0},
+	{0x6571, 0x8409,   0}, {0x6579, 0x8411,   0}, {0x6581, 0x8419,   0},
+	{0x6589, 0x8421,   0}, {0x6591, 0x8429,   0}, {0x6599, 0x8431,   0},
+	{0x65a1, 0x8439,   0}, {0x65a9, 0x8441,   0}, {0x65b1, 0x8449,   0},
+	{0x65b9, 0x8451,   0}, {0x65c1, 0x8459,   0}, {0x65c9, 0x8461,   0},
+	{0x65d1, 0x8469,   0}, {0x65d9, 0x8471,   0}, {0x65e1, 0x8479,   0},
+	{0x65e9, 0x8481,   0}, {0x65f1, 0x8489,   0}, {0x65f9, 0x8491,   0},
+	{0x6601, 0x8499,   0}, {0x6609, 0x84a1,   0}, {0x6611, 0x84a9,   0},
+	{0x6619, 0x84b1,   0}, {0x6621, 0x84b9,   0}, {0x6629, 0x84c1,   0},
+	{0x6631, 0x84c9,   0}, {0x6639, 0x84d1,   0}, {0x6641, 0x84d9,   0},
+	{0x6649, 0x84e1,   0}, {0x6651, 0x84e9,   0}, {0x6659, 0x84f1,   0},
+	{0x6661, 0x84f9,   0}, {0x6669, 0x8501,   0}, {0x6671, 0x8509,   0},
+	{0x6679, 0x8511,   0}, {0x6681, 0x8519,   0}, {0x6689, 0x8521,   0},
+	{0x6691, 0x8529,   0}, {0x6699, 0x8531,   0}, {0x66a1, 0x8539,   0},
+	{0x66a9, 0x8541,   0}, {0x66b1, 0x8549,   0}, {0x66b9, 0x8551,   0},
+	{0x66c1, 0x8559,   0}, {0x66c9, 0x8561,   0}, {0x66d1, 0x8569,   0},
+	{0x66d9, 0x8571,   0}, {0x66e1, 0x8579,   0}, {0x66e9, 0x8581,   0},
+	{0x66f1, 0x8589,   0}, {0x66f9, 0x8591,   0}, {0x6701, 0x8599,   0},
+	{0x6709, 0x85a1,   0}, {0x6711, 0x85a9,   0}, {0x6719, 0x85b1,   0},
+	{0x6721, 0x85b9,   0}, {0x6729, 0x85c1,   0}, {0x6731, 0x85c9,   0},
+	{0x6739, 0x85d1,   0}, {0x6741, 0x85d9,   0}, {0x6749, 0x85e1,   0},
+	{0x6751, 0x85e9,   0}, {0x6759, 0x85f1,   0}, {0x6761, 0x85f9,   0},
+	{0x6769, 0x8601,   0}, {0x6771, 0x8609,   0}, {0x6779, 0x8611,   0},
+	{0x6781, 0x8619,   0}, {0x6789, 0x8621,   0}, {0x6791, 0x8629,   0},
+	{0x6799, 0x8631,   0}, {0x67a1, 0x8639,   0}, {0x67a9, 0x8641,   0},
+	{0x67b1, 0x8649,   0}, {0x67b9, 0x8651,   0}, {0x67c1, 0x8659,   0},
+	{0x67c9, 0x8661,   0}, {0x67d1, 0x8669,   0}, {0x67d9, 0x8671,   0},
+	{0x67e1, 0x8679,   0}, {0x67e9, 0x8681,   0}, {0x67f1, 0x8689,   0},
+	{0x67f9, 0x8691,   0}, {0x6801, 0x8699,   0}, {0x6809, 0x86a1,   0},
+	{0x6811, 0x86a9,   0}, {0x6819, 0x86b1,   0}, {0x6821, 0x86b9,   0},
+	{0x6829, 0x86c1,   0}, {0x6831, 0x86c9,   0}, {0x6839, 0x86d1,   0},
+	{0x6841, 0x86d9,   0}, {0x6849, 0x86e1,   0}, {0x6851, 0x86e9,   0},
+	{0x6859, 0x86f1,   0}, {0x6861, 0x86f9,   0}, {0x6869, 0x8701,   0},
+	{0x6871, 0x8709,   0}, {0x6879, 0x8711,   0}, {0x6881, 0x8719,   0},
+	{0x6889, 0x8721,   0}, {0x6891, 0x8729,   0}, {0x6899, 0x8731,   0},
+	{0x68a1, 0x8739,   0}, {0x68a9, 0x8741,   0}, {0x68b1, 0x8749,   0},
+	{0x68b9, 0x8751,   0}, {0x68c1, 0x8759,   0}, {0x68c9, 0x8761,   0},
+	{0x68d1, 0x8769,   0}, {0x68d9, 0x8771,   0}, {0x68e1, 0x8779,   0},
+	{0x68e9, 0x8781,   0}, {0x68f1, 0x8789,   0}, {0x68f9, 0x8791,   0},
+	{0x6901, 0x8799,   0}, {0x6909, 0x87a1,   0}, {0x6911, 0x87a9,   0},
+	{0x6919, 0x87b1,   0}, {0x6921, 0x87b9,   0}, {0x6929, 0x87c1,   0},
+	{0x6931, 0x87c9,   0}, {0x6939, 0x87d1,   0}, {0x6941, 0x87d9,   0},
+	{0x6949, 0x87e1,   0}, {0x6951, 0x87e9,   0}, {0x6959, 0x87f1,   0},
+	{0x6961, 0x87f9,   0}, {0x6969, 0x8801,   0}, {0x6971, 0x8809,   0},
+	{0x6979, 0x8811,   0}, {0x6981, 0x8819,   0}, {0x6989, 0x8821,   0},
+	{0x6991, 0x8829,   0}, {0x6999, 0x8831,   0}, {0x69a1, 0x8839,   0},
+	{0x69a9, 0x8841,   0}, {0x69b1, 0x8849,   0}, {0x69b9, 0x8851,   0},
+	{0x69c1, 0x8859,   0}, {0x69c9, 0x8861,   0}, {0x69d1, 0x8869,   0},
+	{0x69d9, 0x8871,   0}, {0x69e1, 0x8879,   0}, {0x69e9, 0x8881,   0},
+	{0x69f1, 0x8889,   0}, {0x69f9, 0x8891,   0}, {0x6a01, 0x8899,   0},
+	{0x6a09, 0x88a1,   0}, {0x6a11, 0x88a9,   0}, {0x6a19, 0x88b1,   0},
+	{0x6a21, 0x88b9,   0}, {0x6a29, 0x88c1,   0}, {0x6a31, 0x88c9,   0},
+	{0x6a39, 0x88d1,   0}, {0x6a41, 0x88d9,   0}, {0x6a49, 0x88e1,   0},
+	{0x6a51, 0x88e9,   0}, {0x6a59, 0x88f1,   0},
+};
+
+static const struct apfs_unidata apfs_unidata_2byte[] __aligned(64) = {
+	/* Characters from 0x0080 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x00b0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x00d1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0002, 0x00da,   0}, {0x0012, 0x00ea,   0},
+	{0x0022, 0x00fa,   0}, {0x0032, 0x010a,   0}, {0x0042, 0x011a,   0},
+	{0x0052, 0x012a,   0}, {0x0000, 0x0139,   0}, {0x0062, 0x0142,   0},
+	{0x0072, 0x0152,   0}, {0x0082, 0x0162,   0}, {0x0092, 0x0172,   0},
+	{0x00a2, 0x0182,   0}, {0x00b2, 0x0192,   0}, {0x00c2, 0x01a2,   0},
+	{0x00d2, 0x01b2,   0}, {0x00e2, 0x01c2,   0}, {0x0000, 0x01d1,   0},
+	{0x00f2, 0x01da,   0}, {0x0102, 0x01ea,   0}, {0x0112, 0x01fa,   0},
+	{0x0122, 0x020a,   0}, {0x0132, 0x021a,   0}, {0x0142, 0x022a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0239,   0}, {0x0152, 0x0242,   0},
+	{0x0162, 0x0252,   0}, {0x0172, 0x0262,   0}, {0x0182, 0x0272,   0},
+	{0x0192, 0x0282,   0}, {0x0000, 0x0291,   0}, {0x0000, 0x029a,   0},
+	/* Characters from 0x00e0 */
+	{0x01a2, 0x02aa,   0}, {0x01b2, 0x02ba,   0}, {0x01c2, 0x02ca,   0},
+	{0x01d2, 0x02da,   0}, {0x01e2, 0x02ea,   0}, {0x01f2, 0x02fa,   0},
+	{0x0000, 0x0000,   0}, {0x0202, 0x030a,   0}, {0x0212, 0x031a,   0},
+	{0x0222, 0x032a,   0}, {0x0232, 0x033a,   0}, {0x0242, 0x034a,   0},
+	{0x0252, 0x035a,   0}, {0x0262, 0x036a,   0}, {0x0272, 0x037a,   0},
+	{0x0282, 0x038a,   0}, {0x0000, 0x0000,   0}, {0x0292, 0x039a,   0},
+	{0x02a2, 0x03aa,   0}, {0x02b2, 0x03ba,   0}, {0x02c2, 0x03ca,   0},
+	{0x02d2, 0x03da,   0}, {0x02e2, 0x03ea,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x02f2, 0x03fa,   0}, {0x0302, 0x040a,   0},
+	{0x0312, 0x041a,   0}, {0x0322, 0x042a,   0}, {0x0332, 0x043a,   0},
+	{0x0000, 0x0000,   0}, {0x0342, 0x044a,   0}, {0x0352, 0x045a,   0},
+	{0x0362, 0x046a,   0}, {0x0372, 0x047a,   0}, {0x0382, 0x048a,   0},
+	{0x0392, 0x049a,   0}, {0x03a2, 0x04aa,   0}, {0x03b2, 0x04ba,   0},
+	{0x03c2, 0x04ca,   0}, {0x03d2, 0x04da,   0}, {0x03e2, 0x04ea,   0},
+	{0x03f2, 0x04fa,   0}, {0x0402, 0x050a,   0}, {0x0412, 0x051a,   0},
+	{0x0422, 0x052a,   0}, {0x0432, 0x053a,   0}, {0x0442, 0x054a,   0},
+	/* Characters from 0x0110 */
+	{0x0000, 0x0559,   0}, {0x0000, 0x0000,   0}, {0x0452, 0x0562,   0},
+	{0x0462, 0x0572,   0}, {0x0472, 0x0582,   0}, {0x0482, 0x0592,   0},
+	{0x0492, 0x05a2,   0}, {0x04a2, 0x05b2,   0}, {0x04b2, 0x05c2,   0},
+	{0x04c2, 0x05d2,   0}, {0x04d2, 0x05e2,   0}, {0x04e2, 0x05f2,   0},
+	{0x04f2, 0x0602,   0}, {0x0502, 0x0612,   0}, {0x0512, 0x0622,   0},
+	{0x0522, 0x0632,   0}, {0x0532, 0x0642,   0}, {0x0542, 0x0652,   0},
+	{0x0552, 0x0662,   0}, {0x0562, 0x0672,   0}, {0x0572, 0x0682,   0},
+	{0x0582, 0x0692,   0}, {0x0000, 0x06a1,   0}, {0x0000, 0x0000,   0},
+	{0x0592, 0x06aa,   0}, {0x05a2, 0x06ba,   0}, {0x05b2, 0x06ca,   0},
+	{0x05c2, 0x06da,   0}, {0x05d2, 0x06ea,   0}, {0x05e2, 0x06fa,   0},
+	{0x05f2, 0x070a,   0}, {0x0602, 0x071a,   0}, {0x0612, 0x072a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0739,   0}, {0x0000, 0x0000,   0},
+	{0x0622, 0x0742,   0}, {0x0632, 0x0752,   0}, {0x0642, 0x0762,   0},
+	{0x0652, 0x0772,   0}, {0x0000, 0x0000,   0}, {0x0662, 0x0782,   0},
+	{0x0672, 0x0792,   0}, {0x0682, 0x07a2,   0}, {0x0692, 0x07b2,   0},
+	{0x06a2, 0x07c2,   0}, {0x06b2, 0x07d2,   0}, {0x0000, 0x07e1,   0},
+	/* Characters from 0x0140 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x07e9,   0}, {0x0000, 0x0000,   0},
+	{0x06c2, 0x07f2,   0}, {0x06d2, 0x0802,   0}, {0x06e2, 0x0812,   0},
+	{0x06f2, 0x0822,   0}, {0x0702, 0x0832,   0}, {0x0712, 0x0842,   0},
+	{0x0000, 0x0852,   0}, {0x0000, 0x0861,   0}, {0x0000, 0x0000,   0},
+	{0x0722, 0x086a,   0}, {0x0732, 0x087a,   0}, {0x0742, 0x088a,   0},
+	{0x0752, 0x089a,   0}, {0x0762, 0x08aa,   0}, {0x0772, 0x08ba,   0},
+	{0x0000, 0x08c9,   0}, {0x0000, 0x0000,   0}, {0x0782, 0x08d2,   0},
+	{0x0792, 0x08e2,   0}, {0x07a2, 0x08f2,   0}, {0x07b2, 0x0902,   0},
+	{0x07c2, 0x0912,   0}, {0x07d2, 0x0922,   0}, {0x07e2, 0x0932,   0},
+	{0x07f2, 0x0942,   0}, {0x0802, 0x0952,   0}, {0x0812, 0x0962,   0},
+	{0x0822, 0x0972,   0}, {0x0832, 0x0982,   0}, {0x0842, 0x0992,   0},
+	{0x0852, 0x09a2,   0}, {0x0862, 0x09b2,   0}, {0x0872, 0x09c2,   0},
+	{0x0882, 0x09d2,   0}, {0x0892, 0x09e2,   0}, {0x0000, 0x09f1,   0},
+	{0x0000, 0x0000,   0}, {0x08a2, 0x09fa,   0}, {0x08b2, 0x0a0a,   0},
+	{0x08c2, 0x0a1a,   0}, {0x08d2, 0x0a2a,   0}, {0x08e2, 0x0a3a,   0},
+	{0x08f2, 0x0a4a,   0}, {0x0902, 0x0a5a,   0}, {0x0912, 0x0a6a,   0},
+	/* Characters from 0x0170 */
+	{0x0922, 0x0a7a,   0}, {0x0932, 0x0a8a,   0}, {0x0942, 0x0a9a,   0},
+	{0x0952, 0x0aaa,   0}, {0x0962, 0x0aba,   0}, {0x0972, 0x0aca,   0},
+	{0x0982, 0x0ada,   0}, {0x0992, 0x0aea,   0}, {0x09a2, 0x0afa,   0},
+	{0x09b2, 0x0b0a,   0}, {0x09c2, 0x0b1a,   0}, {0x09d2, 0x0b2a,   0},
+	{0x09e2, 0x0b3a,   0}, {0x09f2, 0x0b4a,   0}, {0x0a02, 0x0b5a,   0},
+	{0x0000, 0x0b69,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0b71,   0},
+	{0x0000, 0x0b79,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0b81,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0b89,   0}, {0x0000, 0x0b91,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0b99,   0}, {0x0000, 0x0ba1,   0},
+	{0x0000, 0x0ba9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0bb1,   0}, {0x0000, 0x0bb9,   0}, {0x0000, 0x0bc1,   0},
+	{0x0000, 0x0bc9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0bd1,   0},
+	{0x0000, 0x0bd9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0be1,   0},
+	{0x0000, 0x0be9,   0}, {0x0000, 0x0bf1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0bf9,   0},
+	{0x0000, 0x0c01,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0c09,   0},
+	/* Characters from 0x01a0 */
+	{0x0a12, 0x0c12,   0}, {0x0a22, 0x0c22,   0}, {0x0000, 0x0c31,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0c39,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0c41,   0}, {0x0000, 0x0c49,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0c51,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0c59,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0c61,   0},
+	{0x0a32, 0x0c6a,   0}, {0x0a42, 0x0c7a,   0}, {0x0000, 0x0c89,   0},
+	{0x0000, 0x0c91,   0}, {0x0000, 0x0c99,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0ca1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0ca9,   0},
+	{0x0000, 0x0cb1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0cb9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0cc1,   0}, {0x0000, 0x0cc9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0cd1,   0}, {0x0000, 0x0cd9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0ce1,   0}, {0x0000, 0x0ce9,   0}, {0x0000, 0x0000,   0},
+	{0x0a52, 0x0cf2,   0}, {0x0a62, 0x0d02,   0}, {0x0a72, 0x0d12,   0},
+	/* Characters from 0x01d0 */
+	{0x0a82, 0x0d22,   0}, {0x0a92, 0x0d32,   0}, {0x0aa2, 0x0d42,   0},
+	{0x0ab2, 0x0d52,   0}, {0x0ac2, 0x0d62,   0}, {0x0ad3, 0x0d73,   0},
+	{0x0aeb, 0x0d8b,   0}, {0x0b03, 0x0da3,   0}, {0x0b1b, 0x0dbb,   0},
+	{0x0b33, 0x0dd3,   0}, {0x0b4b, 0x0deb,   0}, {0x0b63, 0x0e03,   0},
+	{0x0b7b, 0x0e1b,   0}, {0x0000, 0x0000,   0}, {0x0b93, 0x0e33,   0},
+	{0x0bab, 0x0e4b,   0}, {0x0bc3, 0x0e63,   0}, {0x0bdb, 0x0e7b,   0},
+	{0x0bf2, 0x0e92,   0}, {0x0c02, 0x0ea2,   0}, {0x0000, 0x0eb1,   0},
+	{0x0000, 0x0000,   0}, {0x0c12, 0x0eba,   0}, {0x0c22, 0x0eca,   0},
+	{0x0c32, 0x0eda,   0}, {0x0c42, 0x0eea,   0}, {0x0c52, 0x0efa,   0},
+	{0x0c62, 0x0f0a,   0}, {0x0c73, 0x0f1b,   0}, {0x0c8b, 0x0f33,   0},
+	{0x0ca2, 0x0f4a,   0}, {0x0cb2, 0x0f5a,   0}, {0x0cc2, 0x0f6a,   0},
+	{0x0000, 0x0f79,   0}, {0x0000, 0x0f81,   0}, {0x0000, 0x0000,   0},
+	{0x0cd2, 0x0f8a,   0}, {0x0ce2, 0x0f9a,   0}, {0x0000, 0x0fa9,   0},
+	{0x0000, 0x0fb1,   0}, {0x0cf2, 0x0fba,   0}, {0x0d02, 0x0fca,   0},
+	{0x0d13, 0x0fdb,   0}, {0x0d2b, 0x0ff3,   0}, {0x0d42, 0x100a,   0},
+	{0x0d52, 0x101a,   0}, {0x0d62, 0x102a,   0}, {0x0d72, 0x103a,   0},
+	/* Characters from 0x0200 */
+	{0x0d82, 0x104a,   0}, {0x0d92, 0x105a,   0}, {0x0da2, 0x106a,   0},
+	{0x0db2, 0x107a,   0}, {0x0dc2, 0x108a,   0}, {0x0dd2, 0x109a,   0},
+	{0x0de2, 0x10aa,   0}, {0x0df2, 0x10ba,   0}, {0x0e02, 0x10ca,   0},
+	{0x0e12, 0x10da,   0}, {0x0e22, 0x10ea,   0}, {0x0e32, 0x10fa,   0},
+	{0x0e42, 0x110a,   0}, {0x0e52, 0x111a,   0}, {0x0e62, 0x112a,   0},
+	{0x0e72, 0x113a,   0}, {0x0e82, 0x114a,   0}, {0x0e92, 0x115a,   0},
+	{0x0ea2, 0x116a,   0}, {0x0eb2, 0x117a,   0}, {0x0ec2, 0x118a,   0},
+	{0x0ed2, 0x119a,   0}, {0x0ee2, 0x11aa,   0}, {0x0ef2, 0x11ba,   0},
+	{0x0f02, 0x11ca,   0}, {0x0f12, 0x11da,   0}, {0x0f22, 0x11ea,   0},
+	{0x0f32, 0x11fa,   0}, {0x0000, 0x1209,   0}, {0x0000, 0x0000,   0},
+	{0x0f42, 0x1212,   0}, {0x0f52, 0x1222,   0}, {0x0000, 0x1231,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1239,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1241,   0}, {0x0000, 0x0000,   0}, {0x0f62, 0x124a,   0},
+	{0x0f72, 0x125a,   0}, {0x0f82, 0x126a,   0}, {0x0f92, 0x127a,   0},
+	{0x0fa3, 0x128b,   0}, {0x0fbb, 0x12a3,   0}, {0x0fd3, 0x12bb,   0},
+	{0x0feb, 0x12d3,   0}, {0x1002, 0x12ea,   0}, {0x1012, 0x12fa,   0},
+	/* Characters from 0x0230 */
+	{0x1023, 0x130b,   0}, {0x103b, 0x1323,   0}, {0x1052, 0x133a,   0},
+	{0x1062, 0x134a,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1359,   0}, {0x0000, 0x1361,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1369,   0}, {0x0000, 0x1371,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1379,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1381,   0}, {0x0000, 0x1389,   0},
+	{0x0000, 0x1391,   0}, {0x0000, 0x1399,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x13a1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x13a9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x13b1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x13b9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0260 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0290 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x02c0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x02f0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 232}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 232}, {0x0000, 0x0000, 216}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	/* Characters from 0x0320 */
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 202}, {0x0000, 0x0000, 202},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 202}, {0x0000, 0x0000, 202},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000,   1},
+	{0x0000, 0x0000,   1}, {0x0000, 0x0000,   1}, {0x0000, 0x0000,   1},
+	{0x0000, 0x0000,   1}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x1071, 0x13c1, 230},
+	{0x1079, 0x13c9, 230}, {0x0000, 0x0000, 230}, {0x1081, 0x13d1, 230},
+	{0x108a, 0x13da, 230}, {0x0000, 0x13e9, 240}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0350 */
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 232},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 233}, {0x0000, 0x0000, 234}, {0x0000, 0x0000, 234},
+	{0x0000, 0x0000, 233}, {0x0000, 0x0000, 234}, {0x0000, 0x0000, 234},
+	{0x0000, 0x0000, 233}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x13f1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x13f9,   0}, {0x0000, 0x0000,   0},
+	{0x1099, 0x1401,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1409,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x10a1, 0x1411,   0}, {0x0000, 0x1419,   0},
+	/* Characters from 0x0380 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x10aa, 0x1422,   0},
+	{0x10ba, 0x1432,   0}, {0x10c9, 0x1441,   0}, {0x10d2, 0x144a,   0},
+	{0x10e2, 0x145a,   0}, {0x10f2, 0x146a,   0}, {0x0000, 0x0000,   0},
+	{0x1102, 0x147a,   0}, {0x0000, 0x0000,   0}, {0x1112, 0x148a,   0},
+	{0x1122, 0x149a,   0}, {0x1133, 0x14ab,   0}, {0x0000, 0x14c1,   0},
+	{0x0000, 0x14c9,   0}, {0x0000, 0x14d1,   0}, {0x0000, 0x14d9,   0},
+	{0x0000, 0x14e1,   0}, {0x0000, 0x14e9,   0}, {0x0000, 0x14f1,   0},
+	{0x0000, 0x14f9,   0}, {0x0000, 0x1501,   0}, {0x0000, 0x1509,   0},
+	{0x0000, 0x1511,   0}, {0x0000, 0x1519,   0}, {0x0000, 0x1521,   0},
+	{0x0000, 0x1529,   0}, {0x0000, 0x1531,   0}, {0x0000, 0x1539,   0},
+	{0x0000, 0x1541,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1549,   0},
+	{0x0000, 0x1551,   0}, {0x0000, 0x1559,   0}, {0x0000, 0x1561,   0},
+	{0x0000, 0x1569,   0}, {0x0000, 0x1571,   0}, {0x0000, 0x1579,   0},
+	{0x114a, 0x1582,   0}, {0x115a, 0x1592,   0}, {0x116a, 0x15a2,   0},
+	{0x117a, 0x15b2,   0}, {0x118a, 0x15c2,   0}, {0x119a, 0x15d2,   0},
+	/* Characters from 0x03b0 */
+	{0x11ab, 0x15e3,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x15f9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x11c2, 0x1602,   0},
+	{0x11d2, 0x1612,   0}, {0x11e2, 0x1622,   0}, {0x11f2, 0x1632,   0},
+	{0x1202, 0x1642,   0}, {0x0000, 0x1651,   0}, {0x0000, 0x1659,   0},
+	{0x0000, 0x1661,   0}, {0x0000, 0x0000,   0}, {0x1212, 0x166a,   0},
+	{0x1222, 0x167a,   0}, {0x0000, 0x1689,   0}, {0x0000, 0x1691,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1699,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x16a1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x16a9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x16b1,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x03e0 */
+	{0x0000, 0x16b9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x16c1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x16c9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x16d1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x16d9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x16e1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x16e9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x16f1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x16f9,   0}, {0x0000, 0x1701,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1709,   0},
+	{0x0000, 0x1711,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1719,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1721,   0}, {0x0000, 0x1729,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1731,   0},
+	{0x0000, 0x1739,   0}, {0x0000, 0x1741,   0}, {0x1232, 0x174a,   0},
+	{0x1242, 0x175a,   0}, {0x0000, 0x1769,   0}, {0x1252, 0x1772,   0},
+	{0x0000, 0x1781,   0}, {0x0000, 0x1789,   0}, {0x0000, 0x1791,   0},
+	{0x1262, 0x179a,   0}, {0x0000, 0x17a9,   0}, {0x0000, 0x17b1,   0},
+	{0x0000, 0x17b9,   0}, {0x0000, 0x17c1,   0}, {0x1272, 0x17ca,   0},
+	{0x1282, 0x17da,   0}, {0x1292, 0x17ea,   0}, {0x0000, 0x17f9,   0},
+	/* Characters from 0x0410 */
+	{0x0000, 0x1801,   0}, {0x0000, 0x1809,   0}, {0x0000, 0x1811,   0},
+	{0x0000, 0x1819,   0}, {0x0000, 0x1821,   0}, {0x0000, 0x1829,   0},
+	{0x0000, 0x1831,   0}, {0x0000, 0x1839,   0}, {0x0000, 0x1841,   0},
+	{0x12a2, 0x184a,   0}, {0x0000, 0x1859,   0}, {0x0000, 0x1861,   0},
+	{0x0000, 0x1869,   0}, {0x0000, 0x1871,   0}, {0x0000, 0x1879,   0},
+	{0x0000, 0x1881,   0}, {0x0000, 0x1889,   0}, {0x0000, 0x1891,   0},
+	{0x0000, 0x1899,   0}, {0x0000, 0x18a1,   0}, {0x0000, 0x18a9,   0},
+	{0x0000, 0x18b1,   0}, {0x0000, 0x18b9,   0}, {0x0000, 0x18c1,   0},
+	{0x0000, 0x18c9,   0}, {0x0000, 0x18d1,   0}, {0x0000, 0x18d9,   0},
+	{0x0000, 0x18e1,   0}, {0x0000, 0x18e9,   0}, {0x0000, 0x18f1,   0},
+	{0x0000, 0x18f9,   0}, {0x0000, 0x1901,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x12b2, 0x190a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0440 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x12c2, 0x191a,   0}, {0x12d2, 0x192a,   0},
+	{0x0000, 0x0000,   0}, {0x12e2, 0x193a,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x12f2, 0x194a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x1302, 0x195a,   0}, {0x1312, 0x196a,   0},
+	{0x1322, 0x197a,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1989,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1991,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1999,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x19a1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x19a9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x19b1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x19b9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x19c1,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0470 */
+	{0x0000, 0x19c9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x19d1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x19d9,   0}, {0x0000, 0x0000,   0},
+	{0x1332, 0x19e2,   0}, {0x1342, 0x19f2,   0}, {0x0000, 0x1a01,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a09,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a11,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a19,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a21,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a29,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a31,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a39,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a41,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a49,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a51,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a59,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a61,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a69,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a71,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a79,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x04a0 */
+	{0x0000, 0x1a81,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a89,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a91,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a99,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1aa1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1aa9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1ab1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1ab9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1ac1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1ac9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1ad1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1ad9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1ae1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1ae9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1af1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1af9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1b01,   0},
+	{0x1352, 0x1b0a,   0}, {0x1362, 0x1b1a,   0}, {0x0000, 0x1b29,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1b31,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1b39,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1b41,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1b49,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1b51,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x04d0 */
+	{0x1372, 0x1b5a,   0}, {0x1382, 0x1b6a,   0}, {0x1392, 0x1b7a,   0},
+	{0x13a2, 0x1b8a,   0}, {0x0000, 0x1b99,   0}, {0x0000, 0x0000,   0},
+	{0x13b2, 0x1ba2,   0}, {0x13c2, 0x1bb2,   0}, {0x0000, 0x1bc1,   0},
+	{0x0000, 0x0000,   0}, {0x13d2, 0x1bca,   0}, {0x13e2, 0x1bda,   0},
+	{0x13f2, 0x1bea,   0}, {0x1402, 0x1bfa,   0}, {0x1412, 0x1c0a,   0},
+	{0x1422, 0x1c1a,   0}, {0x0000, 0x1c29,   0}, {0x0000, 0x0000,   0},
+	{0x1432, 0x1c32,   0}, {0x1442, 0x1c42,   0}, {0x1452, 0x1c52,   0},
+	{0x1462, 0x1c62,   0}, {0x1472, 0x1c72,   0}, {0x1482, 0x1c82,   0},
+	{0x0000, 0x1c91,   0}, {0x0000, 0x0000,   0}, {0x1492, 0x1c9a,   0},
+	{0x14a2, 0x1caa,   0}, {0x14b2, 0x1cba,   0}, {0x14c2, 0x1cca,   0},
+	{0x14d2, 0x1cda,   0}, {0x14e2, 0x1cea,   0}, {0x14f2, 0x1cfa,   0},
+	{0x1502, 0x1d0a,   0}, {0x1512, 0x1d1a,   0}, {0x1522, 0x1d2a,   0},
+	{0x1532, 0x1d3a,   0}, {0x1542, 0x1d4a,   0}, {0x0000, 0x1d59,   0},
+	{0x0000, 0x0000,   0}, {0x1552, 0x1d62,   0}, {0x1562, 0x1d72,   0},
+	{0x0000, 0x1d81,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1d89,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1d91,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0500 */
+	{0x0000, 0x1d99,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1da1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1da9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1db1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1db9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1dc1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1dc9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1dd1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1dd9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1de1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1de9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1df1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1df9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1e01,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e09,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1e11,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1e19,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e21,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1e29,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1e31,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e39,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1e41,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1e49,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e51,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0530 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e59,   0}, {0x0000, 0x1e61,   0},
+	{0x0000, 0x1e69,   0}, {0x0000, 0x1e71,   0}, {0x0000, 0x1e79,   0},
+	{0x0000, 0x1e81,   0}, {0x0000, 0x1e89,   0}, {0x0000, 0x1e91,   0},
+	{0x0000, 0x1e99,   0}, {0x0000, 0x1ea1,   0}, {0x0000, 0x1ea9,   0},
+	{0x0000, 0x1eb1,   0}, {0x0000, 0x1eb9,   0}, {0x0000, 0x1ec1,   0},
+	{0x0000, 0x1ec9,   0}, {0x0000, 0x1ed1,   0}, {0x0000, 0x1ed9,   0},
+	{0x0000, 0x1ee1,   0}, {0x0000, 0x1ee9,   0}, {0x0000, 0x1ef1,   0},
+	{0x0000, 0x1ef9,   0}, {0x0000, 0x1f01,   0}, {0x0000, 0x1f09,   0},
+	{0x0000, 0x1f11,   0}, {0x0000, 0x1f19,   0}, {0x0000, 0x1f21,   0},
+	{0x0000, 0x1f29,   0}, {0x0000, 0x1f31,   0}, {0x0000, 0x1f39,   0},
+	{0x0000, 0x1f41,   0}, {0x0000, 0x1f49,   0}, {0x0000, 0x1f51,   0},
+	{0x0000, 0x1f59,   0}, {0x0000, 0x1f61,   0}, {0x0000, 0x1f69,   0},
+	{0x0000, 0x1f71,   0}, {0x0000, 0x1f79,   0}, {0x0000, 0x1f81,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0560 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1f8a,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0590 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 222}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 222},
+	{0x0000, 0x0000, 228}, {0x0000, 0x0000, 230}, {0x0000, 0x0000,  10},
+	{0x0000, 0x0000,  11}, {0x0000, 0x0000,  12}, {0x0000, 0x0000,  13},
+	{0x0000, 0x0000,  14}, {0x0000, 0x0000,  15}, {0x0000, 0x0000,  16},
+	{0x0000, 0x0000,  17}, {0x0000, 0x0000,  18}, {0x0000, 0x0000,  19},
+	{0x0000, 0x0000,  19}, {0x0000, 0x0000,  20}, {0x0000, 0x0000,  21},
+	{0x0000, 0x0000,  22}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,  23},
+	/* Characters from 0x05c0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,  24}, {0x0000, 0x0000,  25},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,  18}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x05f0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000,  30}, {0x0000, 0x0000,  31},
+	{0x0000, 0x0000,  32}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0620 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x1572, 0x1f9a,   0},
+	{0x1582, 0x1faa,   0}, {0x1592, 0x1fba,   0}, {0x15a2, 0x1fca,   0},
+	{0x15b2, 0x1fda,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,  27}, {0x0000, 0x0000,  28},
+	{0x0000, 0x0000,  29}, {0x0000, 0x0000,  30}, {0x0000, 0x0000,  31},
+	/* Characters from 0x0650 */
+	{0x0000, 0x0000,  32}, {0x0000, 0x0000,  33}, {0x0000, 0x0000,  34},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,  35},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0680 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x06b0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x15c2, 0x1fea,   0}, {0x0000, 0x0000,   0},
+	{0x15d2, 0x1ffa,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x15e2, 0x200a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000, 230},
+	/* Characters from 0x06e0 */
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0710 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,  36}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	/* Characters from 0x0740 */
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0770 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x07a0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x07d0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+};
+
+static const u16 apfs_nfd[] __aligned(64) = {
+	0x0041, 0xd800, 0x0041, 0xd801, 0x0041, 0xd802, 0x0041, 0xd803,
+	0x0041, 0xd804, 0x0041, 0xd805, 0x0043, 0xd806, 0x0045, 0xd800,
+	0x0045, 0xd801, 0x0045, 0xd802, 0x0045, 0xd804, 0x0049, 0xd800,
+	0x0049, 0xd801, 0x0049, 0xd802, 0x0049, 0xd804, 0x004e, 0xd803,
+	0x004f, 0xd800, 0x004f, 0xd801, 0x004f, 0xd802, 0x004f, 0xd803,
+	0x004f, 0xd804, 0x0055, 0xd800, 0x0055, 0xd801, 0x0055, 0xd802,
+	0x0055, 0xd804, 0x0059, 0xd801, 0x0061, 0xd800, 0x0061, 0xd801,
+	0x0061, 0xd802, 0x0061, 0xd803, 0x0061, 0xd804, 0x0061, 0xd805,
+	0x0063, 0xd806, 0x0065, 0xd800, 0x0065, 0xd801, 0x0065, 0xd802,
+	0x0065, 0xd804, 0x0069, 0xd800, 0x0069, 0xd801, 0x0069, 0xd802,
+	0x0069, 0xd804, 0x006e, 0xd803, 0x006f, 0xd800, 0x006f, 0xd801,
+	0x006f, 0xd802, 0x006f, 0xd803, 0x006f, 0xd804, 0x0075, 0xd800,
+	0x0075, 0xd801, 0x0075, 0xd802, 0x0075, 0xd804, 0x0079, 0xd801,
+	0x0079, 0xd804, 0x0041, 0xd807, 0x0061, 0xd807, 0x0041, 0xd808,
+	0x0061, 0xd808, 0x0041, 0xd809, 0x0061, 0xd809, 0x0043, 0xd801,
+	0x0063, 0xd801, 0x0043, 0xd802, 0x0063, 0xd802, 0x0043, 0xd80a,
+	0x0063, 0xd80a, 0x0043, 0xd80b, 0x0063, 0xd80b, 0x0044, 0xd80b,
+	0x0064, 0xd80b, 0x0045, 0xd807, 0x0065, 0xd807, 0x0045, 0xd808,
+	0x0065, 0xd808, 0x0045, 0xd80a, 0x0065, 0xd80a, 0x0045, 0xd809,
+	0x0065, 0xd809, 0x0045, 0xd80b, 0x0065, 0xd80b, 0x0047, 0xd802,
+	0x0067, 0xd802, 0x0047, 0xd808, 0x0067, 0xd808, 0x0047, 0xd80a,
+	0x0067, 0xd80a, 0x0047, 0xd806, 0x0067, 0xd806, 0x0048, 0xd802,
+	0x0068, 0xd802, 0x0049, 0xd803, 0x0069, 0xd803, 0x0049, 0xd807,
+	0x0069, 0xd807, 0x0049, 0xd808, 0x0069, 0xd808, 0x0049, 0xd809,
+	0x0069, 0xd809, 0x0049, 0xd80a, 0x004a, 0xd802, 0x006a, 0xd802,
+	0x004b, 0xd806, 0x006b, 0xd806, 0x004c, 0xd801, 0x006c, 0xd801,
+	0x004c, 0xd806, 0x006c, 0xd806, 0x004c, 0xd80b, 0x006c, 0xd80b,
+	0x004e, 0xd801, 0x006e, 0xd801, 0x004e, 0xd806, 0x006e, 0xd806,
+	0x004e, 0xd80b, 0x006e, 0xd80b, 0x004f, 0xd807, 0x006f, 0xd807,
+	0x004f, 0xd808, 0x006f, 0xd808, 0x004f, 0xd80c, 0x006f, 0xd80c,
+	0x0052, 0xd801, 0x0072, 0xd801, 0x0052, 0xd806, 0x0072, 0xd806,
+	0x0052, 0xd80b, 0x0072, 0xd80b, 0x0053, 0xd801, 0x0073, 0xd801,
+	0x0053, 0xd802, 0x0073, 0xd802, 0x0053, 0xd806, 0x0073, 0xd806,
+	0x0053, 0xd80b, 0x0073, 0xd80b, 0x0054, 0xd806, 0x0074, 0xd806,
+	0x0054, 0xd80b, 0x0074, 0xd80b, 0x0055, 0xd803, 0x0075, 0xd803,
+	0x0055, 0xd807, 0x0075, 0xd807, 0x0055, 0xd808, 0x0075, 0xd808,
+	0x0055, 0xd805, 0x0075, 0xd805, 0x0055, 0xd80c, 0x0075, 0xd80c,
+	0x0055, 0xd809, 0x0075, 0xd809, 0x0057, 0xd802, 0x0077, 0xd802,
+	0x0059, 0xd802, 0x0079, 0xd802, 0x0059, 0xd804, 0x005a, 0xd801,
+	0x007a, 0xd801, 0x005a, 0xd80a, 0x007a, 0xd80a, 0x005a, 0xd80b,
+	0x007a, 0xd80b, 0x004f, 0xd80d, 0x006f, 0xd80d, 0x0055, 0xd80d,
+	0x0075, 0xd80d, 0x0041, 0xd80b, 0x0061, 0xd80b, 0x0049, 0xd80b,
+	0x0069, 0xd80b, 0x004f, 0xd80b, 0x006f, 0xd80b, 0x0055, 0xd80b,
+	0x0075, 0xd80b, 0x0055, 0xd804, 0xd807, 0x0075, 0xd804, 0xd807,
+	0x0055, 0xd804, 0xd801, 0x0075, 0xd804, 0xd801, 0x0055, 0xd804,
+	0xd80b, 0x0075, 0xd804, 0xd80b, 0x0055, 0xd804, 0xd800, 0x0075,
+	0xd804, 0xd800, 0x0041, 0xd804, 0xd807, 0x0061, 0xd804, 0xd807,
+	0x0041, 0xd80a, 0xd807, 0x0061, 0xd80a, 0xd807, 0x00c6, 0xd807,
+	0x00e6, 0xd807, 0x0047, 0xd80b, 0x0067, 0xd80b, 0x004b, 0xd80b,
+	0x006b, 0xd80b, 0x004f, 0xd809, 0x006f, 0xd809, 0x004f, 0xd809,
+	0xd807, 0x006f, 0xd809, 0xd807, 0x01b7, 0xd80b, 0x0292, 0xd80b,
+	0x006a, 0xd80b, 0x0047, 0xd801, 0x0067, 0xd801, 0x004e, 0xd800,
+	0x006e, 0xd800, 0x0041, 0xd805, 0xd801, 0x0061, 0xd805, 0xd801,
+	0x00c6, 0xd801, 0x00e6, 0xd801, 0x00d8, 0xd801, 0x00f8, 0xd801,
+	0x0041, 0xd80e, 0x0061, 0xd80e, 0x0041, 0xd80f, 0x0061, 0xd80f,
+	0x0045, 0xd80e, 0x0065, 0xd80e, 0x0045, 0xd80f, 0x0065, 0xd80f,
+	0x0049, 0xd80e, 0x0069, 0xd80e, 0x0049, 0xd80f, 0x0069, 0xd80f,
+	0x004f, 0xd80e, 0x006f, 0xd80e, 0x004f, 0xd80f, 0x006f, 0xd80f,
+	0x0052, 0xd80e, 0x0072, 0xd80e, 0x0052, 0xd80f, 0x0072, 0xd80f,
+	0x0055, 0xd80e, 0x0075, 0xd80e, 0x0055, 0xd80f, 0x0075, 0xd80f,
+	0x0053, 0xd810, 0x0073, 0xd810, 0x0054, 0xd810, 0x0074, 0xd810,
+	0x0048, 0xd80b, 0x0068, 0xd80b, 0x0041, 0xd80a, 0x0061, 0xd80a,
+	0x0045, 0xd806, 0x0065, 0xd806, 0x004f, 0xd804, 0xd807, 0x006f,
+	0xd804, 0xd807, 0x004f, 0xd803, 0xd807, 0x006f, 0xd803, 0xd807,
+	0x004f, 0xd80a, 0x006f, 0xd80a, 0x004f, 0xd80a, 0xd807, 0x006f,
+	0xd80a, 0xd807, 0x0059, 0xd807, 0x0079, 0xd807, 0xd800, 0xd801,
+	0xd811, 0xd804, 0xd801, 0x02b9, 0x003b, 0x00a8, 0xd801, 0x0391,
+	0xd801, 0x00b7, 0x0395, 0xd801, 0x0397, 0xd801, 0x0399, 0xd801,
+	0x039f, 0xd801, 0x03a5, 0xd801, 0x03a9, 0xd801, 0x03b9, 0xd804,
+	0xd801, 0x0399, 0xd804, 0x03a5, 0xd804, 0x03b1, 0xd801, 0x03b5,
+	0xd801, 0x03b7, 0xd801, 0x03b9, 0xd801, 0x03c5, 0xd804, 0xd801,
+	0x03b9, 0xd804, 0x03c5, 0xd804, 0x03bf, 0xd801, 0x03c5, 0xd801,
+	0x03c9, 0xd801, 0x03d2, 0xd801, 0x03d2, 0xd804, 0x0415, 0xd800,
+	0x0415, 0xd804, 0x0413, 0xd801, 0x0406, 0xd804, 0x041a, 0xd801,
+	0x0418, 0xd800, 0x0423, 0xd808, 0x0418, 0xd808, 0x0438, 0xd808,
+	0x0435, 0xd800, 0x0435, 0xd804, 0x0433, 0xd801, 0x0456, 0xd804,
+	0x043a, 0xd801, 0x0438, 0xd800, 0x0443, 0xd808, 0x0474, 0xd80e,
+	0x0475, 0xd80e, 0x0416, 0xd808, 0x0436, 0xd808, 0x0410, 0xd808,
+	0x0430, 0xd808, 0x0410, 0xd804, 0x0430, 0xd804, 0x0415, 0xd808,
+	0x0435, 0xd808, 0x04d8, 0xd804, 0x04d9, 0xd804, 0x0416, 0xd804,
+	0x0436, 0xd804, 0x0417, 0xd804, 0x0437, 0xd804, 0x0418, 0xd807,
+	0x0438, 0xd807, 0x0418, 0xd804, 0x0438, 0xd804, 0x041e, 0xd804,
+	0x043e, 0xd804, 0x04e8, 0xd804, 0x04e9, 0xd804, 0x042d, 0xd804,
+	0x044d, 0xd804, 0x0423, 0xd807, 0x0443, 0xd807, 0x0423, 0xd804,
+	0x0443, 0xd804, 0x0423, 0xd80c, 0x0443, 0xd80c, 0x0427, 0xd804,
+	0x0447, 0xd804, 0x042b, 0xd804, 0x044b, 0xd804, 0x0627, 0xd812,
+	0x0627, 0xd813, 0x0648, 0xd813, 0x0627, 0xd814, 0x064a, 0xd813,
+	0x06d5, 0xd813, 0x06c1, 0xd813, 0x06d2, 0xd813, 0x0928, 0xd815,
+	0x0930, 0xd815, 0x0933, 0xd815, 0x0915, 0xd815, 0x0916, 0xd815,
+	0x0917, 0xd815, 0x091c, 0xd815, 0x0921, 0xd815, 0x0922, 0xd815,
+	0x092b, 0xd815, 0x092f, 0xd815, 0x09c7, 0x09be, 0x09c7, 0x09d7,
+	0x09a1, 0xd816, 0x09a2, 0xd816, 0x09af, 0xd816, 0x0a32, 0xd817,
+	0x0a38, 0xd817, 0x0a16, 0xd817, 0x0a17, 0xd817, 0x0a1c, 0xd817,
+	0x0a2b, 0xd817, 0x0b47, 0x0b56, 0x0b47, 0x0b3e, 0x0b47, 0x0b57,
+	0x0b21, 0xd818, 0x0b22, 0xd818, 0x0b92, 0x0bd7, 0x0bc6, 0x0bbe,
+	0x0bc7, 0x0bbe, 0x0bc6, 0x0bd7, 0x0c46, 0xd819, 0x0cbf, 0x0cd5,
+	0x0cc6, 0x0cd5, 0x0cc6, 0x0cd6, 0x0cc6, 0x0cc2, 0x0cc6, 0x0cc2,
+	0x0cd5, 0x0d46, 0x0d3e, 0x0d47, 0x0d3e, 0x0d46, 0x0d57, 0x0dd9,
+	0xd81a, 0x0dd9, 0x0dcf, 0x0dd9, 0x0dcf, 0xd81a, 0x0dd9, 0x0ddf,
+	0x0f42, 0x0fb7, 0x0f4c, 0x0fb7, 0x0f51, 0x0fb7, 0x0f56, 0x0fb7,
+	0x0f5b, 0x0fb7, 0x0f40, 0x0fb5, 0xd81b, 0xd81c, 0xd81b, 0xd81d,
+	0x0fb2, 0xd81e, 0x0fb3, 0xd81e, 0xd81b, 0xd81e, 0x0f92, 0x0fb7,
+	0x0f9c, 0x0fb7, 0x0fa1, 0x0fb7, 0x0fa6, 0x0fb7, 0x0fab, 0x0fb7,
+	0x0f90, 0x0fb5, 0x1025, 0x102e, 0x1b05, 0x1b35, 0x1b07, 0x1b35,
+	0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35,
+	0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f, 0x1b35,
+	0x1b42, 0x1b35, 0x0041, 0xd81f, 0x0061, 0xd81f, 0x0042, 0xd80a,
+	0x0062, 0xd80a, 0x0042, 0xd820, 0x0062, 0xd820, 0x0042, 0xd821,
+	0x0062, 0xd821, 0x0043, 0xd806, 0xd801, 0x0063, 0xd806, 0xd801,
+	0x0044, 0xd80a, 0x0064, 0xd80a, 0x0044, 0xd820, 0x0064, 0xd820,
+	0x0044, 0xd821, 0x0064, 0xd821, 0x0044, 0xd806, 0x0064, 0xd806,
+	0x0044, 0xd822, 0x0064, 0xd822, 0x0045, 0xd807, 0xd800, 0x0065,
+	0xd807, 0xd800, 0x0045, 0xd807, 0xd801, 0x0065, 0xd807, 0xd801,
+	0x0045, 0xd822, 0x0065, 0xd822, 0x0045, 0xd823, 0x0065, 0xd823,
+	0x0045, 0xd806, 0xd808, 0x0065, 0xd806, 0xd808, 0x0046, 0xd80a,
+	0x0066, 0xd80a, 0x0047, 0xd807, 0x0067, 0xd807, 0x0048, 0xd80a,
+	0x0068, 0xd80a, 0x0048, 0xd820, 0x0068, 0xd820, 0x0048, 0xd804,
+	0x0068, 0xd804, 0x0048, 0xd806, 0x0068, 0xd806, 0x0048, 0xd824,
+	0x0068, 0xd824, 0x0049, 0xd823, 0x0069, 0xd823, 0x0049, 0xd804,
+	0xd801, 0x0069, 0xd804, 0xd801, 0x004b, 0xd801, 0x006b, 0xd801,
+	0x004b, 0xd820, 0x006b, 0xd820, 0x004b, 0xd821, 0x006b, 0xd821,
+	0x004c, 0xd820, 0x006c, 0xd820, 0x004c, 0xd820, 0xd807, 0x006c,
+	0xd820, 0xd807, 0x004c, 0xd821, 0x006c, 0xd821, 0x004c, 0xd822,
+	0x006c, 0xd822, 0x004d, 0xd801, 0x006d, 0xd801, 0x004d, 0xd80a,
+	0x006d, 0xd80a, 0x004d, 0xd820, 0x006d, 0xd820, 0x004e, 0xd80a,
+	0x006e, 0xd80a, 0x004e, 0xd820, 0x006e, 0xd820, 0x004e, 0xd821,
+	0x006e, 0xd821, 0x004e, 0xd822, 0x006e, 0xd822, 0x004f, 0xd803,
+	0xd801, 0x006f, 0xd803, 0xd801, 0x004f, 0xd803, 0xd804, 0x006f,
+	0xd803, 0xd804, 0x004f, 0xd807, 0xd800, 0x006f, 0xd807, 0xd800,
+	0x004f, 0xd807, 0xd801, 0x006f, 0xd807, 0xd801, 0x0050, 0xd801,
+	0x0070, 0xd801, 0x0050, 0xd80a, 0x0070, 0xd80a, 0x0052, 0xd80a,
+	0x0072, 0xd80a, 0x0052, 0xd820, 0x0072, 0xd820, 0x0052, 0xd820,
+	0xd807, 0x0072, 0xd820, 0xd807, 0x0052, 0xd821, 0x0072, 0xd821,
+	0x0053, 0xd80a, 0x0073, 0xd80a, 0x0053, 0xd820, 0x0073, 0xd820,
+	0x0053, 0xd801, 0xd80a, 0x0073, 0xd801, 0xd80a, 0x0053, 0xd80b,
+	0xd80a, 0x0073, 0xd80b, 0xd80a, 0x0053, 0xd820, 0xd80a, 0x0073,
+	0xd820, 0xd80a, 0x0054, 0xd80a, 0x0074, 0xd80a, 0x0054, 0xd820,
+	0x0074, 0xd820, 0x0054, 0xd821, 0x0074, 0xd821, 0x0054, 0xd822,
+	0x0074, 0xd822, 0x0055, 0xd825, 0x0075, 0xd825, 0x0055, 0xd823,
+	0x0075, 0xd823, 0x0055, 0xd822, 0x0075, 0xd822, 0x0055, 0xd803,
+	0xd801, 0x0075, 0xd803, 0xd801, 0x0055, 0xd807, 0xd804, 0x0075,
+	0xd807, 0xd804, 0x0056, 0xd803, 0x0076, 0xd803, 0x0056, 0xd820,
+	0x0076, 0xd820, 0x0057, 0xd800, 0x0077, 0xd800, 0x0057, 0xd801,
+	0x0077, 0xd801, 0x0057, 0xd804, 0x0077, 0xd804, 0x0057, 0xd80a,
+	0x0077, 0xd80a, 0x0057, 0xd820, 0x0077, 0xd820, 0x0058, 0xd80a,
+	0x0078, 0xd80a, 0x0058, 0xd804, 0x0078, 0xd804, 0x0059, 0xd80a,
+	0x0079, 0xd80a, 0x005a, 0xd802, 0x007a, 0xd802, 0x005a, 0xd820,
+	0x007a, 0xd820, 0x005a, 0xd821, 0x007a, 0xd821, 0x0068, 0xd821,
+	0x0074, 0xd804, 0x0077, 0xd805, 0x0079, 0xd805, 0x017f, 0xd80a,
+	0x0041, 0xd820, 0x0061, 0xd820, 0x0041, 0xd826, 0x0061, 0xd826,
+	0x0041, 0xd802, 0xd801, 0x0061, 0xd802, 0xd801, 0x0041, 0xd802,
+	0xd800, 0x0061, 0xd802, 0xd800, 0x0041, 0xd802, 0xd826, 0x0061,
+	0xd802, 0xd826, 0x0041, 0xd802, 0xd803, 0x0061, 0xd802, 0xd803,
+	0x0041, 0xd820, 0xd802, 0x0061, 0xd820, 0xd802, 0x0041, 0xd808,
+	0xd801, 0x0061, 0xd808, 0xd801, 0x0041, 0xd808, 0xd800, 0x0061,
+	0xd808, 0xd800, 0x0041, 0xd808, 0xd826, 0x0061, 0xd808, 0xd826,
+	0x0041, 0xd808, 0xd803, 0x0061, 0xd808, 0xd803, 0x0041, 0xd820,
+	0xd808, 0x0061, 0xd820, 0xd808, 0x0045, 0xd820, 0x0065, 0xd820,
+	0x0045, 0xd826, 0x0065, 0xd826, 0x0045, 0xd803, 0x0065, 0xd803,
+	0x0045, 0xd802, 0xd801, 0x0065, 0xd802, 0xd801, 0x0045, 0xd802,
+	0xd800, 0x0065, 0xd802, 0xd800, 0x0045, 0xd802, 0xd826, 0x0065,
+	0xd802, 0xd826, 0x0045, 0xd802, 0xd803, 0x0065, 0xd802, 0xd803,
+	0x0045, 0xd820, 0xd802, 0x0065, 0xd820, 0xd802, 0x0049, 0xd826,
+	0x0069, 0xd826, 0x0049, 0xd820, 0x0069, 0xd820, 0x004f, 0xd820,
+	0x006f, 0xd820, 0x004f, 0xd826, 0x006f, 0xd826, 0x004f, 0xd802,
+	0xd801, 0x006f, 0xd802, 0xd801, 0x004f, 0xd802, 0xd800, 0x006f,
+	0xd802, 0xd800, 0x004f, 0xd802, 0xd826, 0x006f, 0xd802, 0xd826,
+	0x004f, 0xd802, 0xd803, 0x006f, 0xd802, 0xd803, 0x004f, 0xd820,
+	0xd802, 0x006f, 0xd820, 0xd802, 0x004f, 0xd80d, 0xd801, 0x006f,
+	0xd80d, 0xd801, 0x004f, 0xd80d, 0xd800, 0x006f, 0xd80d, 0xd800,
+	0x004f, 0xd80d, 0xd826, 0x006f, 0xd80d, 0xd826, 0x004f, 0xd80d,
+	0xd803, 0x006f, 0xd80d, 0xd803, 0x004f, 0xd80d, 0xd820, 0x006f,
+	0xd80d, 0xd820, 0x0055, 0xd820, 0x0075, 0xd820, 0x0055, 0xd826,
+	0x0075, 0xd826, 0x0055, 0xd80d, 0xd801, 0x0075, 0xd80d, 0xd801,
+	0x0055, 0xd80d, 0xd800, 0x0075, 0xd80d, 0xd800, 0x0055, 0xd80d,
+	0xd826, 0x0075, 0xd80d, 0xd826, 0x0055, 0xd80d, 0xd803, 0x0075,
+	0xd80d, 0xd803, 0x0055, 0xd80d, 0xd820, 0x0075, 0xd80d, 0xd820,
+	0x0059, 0xd800, 0x0079, 0xd800, 0x0059, 0xd820, 0x0079, 0xd820,
+	0x0059, 0xd826, 0x0079, 0xd826, 0x0059, 0xd803, 0x0079, 0xd803,
+	0x03b1, 0xd811, 0x03b1, 0xd827, 0x03b1, 0xd811, 0xd800, 0x03b1,
+	0xd827, 0xd800, 0x03b1, 0xd811, 0xd801, 0x03b1, 0xd827, 0xd801,
+	0x03b1, 0xd811, 0xd828, 0x03b1, 0xd827, 0xd828, 0x0391, 0xd811,
+	0x0391, 0xd827, 0x0391, 0xd811, 0xd800, 0x0391, 0xd827, 0xd800,
+	0x0391, 0xd811, 0xd801, 0x0391, 0xd827, 0xd801, 0x0391, 0xd811,
+	0xd828, 0x0391, 0xd827, 0xd828, 0x03b5, 0xd811, 0x03b5, 0xd827,
+	0x03b5, 0xd811, 0xd800, 0x03b5, 0xd827, 0xd800, 0x03b5, 0xd811,
+	0xd801, 0x03b5, 0xd827, 0xd801, 0x0395, 0xd811, 0x0395, 0xd827,
+	0x0395, 0xd811, 0xd800, 0x0395, 0xd827, 0xd800, 0x0395, 0xd811,
+	0xd801, 0x0395, 0xd827, 0xd801, 0x03b7, 0xd811, 0x03b7, 0xd827,
+	0x03b7, 0xd811, 0xd800, 0x03b7, 0xd827, 0xd800, 0x03b7, 0xd811,
+	0xd801, 0x03b7, 0xd827, 0xd801, 0x03b7, 0xd811, 0xd828, 0x03b7,
+	0xd827, 0xd828, 0x0397, 0xd811, 0x0397, 0xd827, 0x0397, 0xd811,
+	0xd800, 0x0397, 0xd827, 0xd800, 0x0397, 0xd811, 0xd801, 0x0397,
+	0xd827, 0xd801, 0x0397, 0xd811, 0xd828, 0x0397, 0xd827, 0xd828,
+	0x03b9, 0xd811, 0x03b9, 0xd827, 0x03b9, 0xd811, 0xd800, 0x03b9,
+	0xd827, 0xd800, 0x03b9, 0xd811, 0xd801, 0x03b9, 0xd827, 0xd801,
+	0x03b9, 0xd811, 0xd828, 0x03b9, 0xd827, 0xd828, 0x0399, 0xd811,
+	0x0399, 0xd827, 0x0399, 0xd811, 0xd800, 0x0399, 0xd827, 0xd800,
+	0x0399, 0xd811, 0xd801, 0x0399, 0xd827, 0xd801, 0x0399, 0xd811,
+	0xd828, 0x0399, 0xd827, 0xd828, 0x03bf, 0xd811, 0x03bf, 0xd827,
+	0x03bf, 0xd811, 0xd800, 0x03bf, 0xd827, 0xd800, 0x03bf, 0xd811,
+	0xd801, 0x03bf, 0xd827, 0xd801, 0x039f, 0xd811, 0x039f, 0xd827,
+	0x039f, 0xd811, 0xd800, 0x039f, 0xd827, 0xd800, 0x039f, 0xd811,
+	0xd801, 0x039f, 0xd827, 0xd801, 0x03c5, 0xd811, 0x03c5, 0xd827,
+	0x03c5, 0xd811, 0xd800, 0x03c5, 0xd827, 0xd800, 0x03c5, 0xd811,
+	0xd801, 0x03c5, 0xd827, 0xd801, 0x03c5, 0xd811, 0xd828, 0x03c5,
+	0xd827, 0xd828, 0x03a5, 0xd827, 0x03a5, 0xd827, 0xd800, 0x03a5,
+	0xd827, 0xd801, 0x03a5, 0xd827, 0xd828, 0x03c9, 0xd811, 0x03c9,
+	0xd827, 0x03c9, 0xd811, 0xd800, 0x03c9, 0xd827, 0xd800, 0x03c9,
+	0xd811, 0xd801, 0x03c9, 0xd827, 0xd801, 0x03c9, 0xd811, 0xd828,
+	0x03c9, 0xd827, 0xd828, 0x03a9, 0xd811, 0x03a9, 0xd827, 0x03a9,
+	0xd811, 0xd800, 0x03a9, 0xd827, 0xd800, 0x03a9, 0xd811, 0xd801,
+	0x03a9, 0xd827, 0xd801, 0x03a9, 0xd811, 0xd828, 0x03a9, 0xd827,
+	0xd828, 0x03b1, 0xd800, 0x03b1, 0xd801, 0x03b5, 0xd800, 0x03b5,
+	0xd801, 0x03b7, 0xd800, 0x03b7, 0xd801, 0x03b9, 0xd800, 0x03b9,
+	0xd801, 0x03bf, 0xd800, 0x03bf, 0xd801, 0x03c5, 0xd800, 0x03c5,
+	0xd801, 0x03c9, 0xd800, 0x03c9, 0xd801, 0x03b1, 0xd811, 0xd829,
+	0x03b1, 0xd827, 0xd829, 0x03b1, 0xd811, 0xd800, 0xd829, 0x03b1,
+	0xd827, 0xd800, 0xd829, 0x03b1, 0xd811, 0xd801, 0xd829, 0x03b1,
+	0xd827, 0xd801, 0xd829, 0x03b1, 0xd811, 0xd828, 0xd829, 0x03b1,
+	0xd827, 0xd828, 0xd829, 0x0391, 0xd811, 0xd829, 0x0391, 0xd827,
+	0xd829, 0x0391, 0xd811, 0xd800, 0xd829, 0x0391, 0xd827, 0xd800,
+	0xd829, 0x0391, 0xd811, 0xd801, 0xd829, 0x0391, 0xd827, 0xd801,
+	0xd829, 0x0391, 0xd811, 0xd828, 0xd829, 0x0391, 0xd827, 0xd828,
+	0xd829, 0x03b7, 0xd811, 0xd829, 0x03b7, 0xd827, 0xd829, 0x03b7,
+	0xd811, 0xd800, 0xd829, 0x03b7, 0xd827, 0xd800, 0xd829, 0x03b7,
+	0xd811, 0xd801, 0xd829, 0x03b7, 0xd827, 0xd801, 0xd829, 0x03b7,
+	0xd811, 0xd828, 0xd829, 0x03b7, 0xd827, 0xd828, 0xd829, 0x0397,
+	0xd811, 0xd829, 0x0397, 0xd827, 0xd829, 0x0397, 0xd811, 0xd800,
+	0xd829, 0x0397, 0xd827, 0xd800, 0xd829, 0x0397, 0xd811, 0xd801,
+	0xd829, 0x0397, 0xd827, 0xd801, 0xd829, 0x0397, 0xd811, 0xd828,
+	0xd829, 0x0397, 0xd827, 0xd828, 0xd829, 0x03c9, 0xd811, 0xd829,
+	0x03c9, 0xd827, 0xd829, 0x03c9, 0xd811, 0xd800, 0xd829, 0x03c9,
+	0xd827, 0xd800, 0xd829, 0x03c9, 0xd811, 0xd801, 0xd829, 0x03c9,
+	0xd827, 0xd801, 0xd829, 0x03c9, 0xd811, 0xd828, 0xd829, 0x03c9,
+	0xd827, 0xd828, 0xd829, 0x03a9, 0xd811, 0xd829, 0x03a9, 0xd827,
+	0xd829, 0x03a9, 0xd811, 0xd800, 0xd829, 0x03a9, 0xd827, 0xd800,
+	0xd829, 0x03a9, 0xd811, 0xd801, 0xd829, 0x03a9, 0xd827, 0xd801,
+	0xd829, 0x03a9, 0xd811, 0xd828, 0xd829, 0x03a9, 0xd827, 0xd828,
+	0xd829, 0x03b1, 0xd808, 0x03b1, 0xd807, 0x03b1, 0xd800, 0xd829,
+	0x03b1, 0xd829, 0x03b1, 0xd801, 0xd829, 0x03b1, 0xd828, 0x03b1,
+	0xd828, 0xd829, 0x0391, 0xd808, 0x0391, 0xd807, 0x0391, 0xd800,
+	0x0391, 0xd801, 0x0391, 0xd829, 0x03b9, 0x00a8, 0xd828, 0x03b7,
+	0xd800, 0xd829, 0x03b7, 0xd829, 0x03b7, 0xd801, 0xd829, 0x03b7,
+	0xd828, 0x03b7, 0xd828, 0xd829, 0x0395, 0xd800, 0x0395, 0xd801,
+	0x0397, 0xd800, 0x0397, 0xd801, 0x0397, 0xd829, 0x1fbf, 0xd800,
+	0x1fbf, 0xd801, 0x1fbf, 0xd828, 0x03b9, 0xd808, 0x03b9, 0xd807,
+	0x03b9, 0xd804, 0xd800, 0x03b9, 0xd804, 0xd801, 0x03b9, 0xd828,
+	0x03b9, 0xd804, 0xd828, 0x0399, 0xd808, 0x0399, 0xd807, 0x0399,
+	0xd800, 0x0399, 0xd801, 0x1ffe, 0xd800, 0x1ffe, 0xd801, 0x1ffe,
+	0xd828, 0x03c5, 0xd808, 0x03c5, 0xd807, 0x03c5, 0xd804, 0xd800,
+	0x03c5, 0xd804, 0xd801, 0x03c1, 0xd811, 0x03c1, 0xd827, 0x03c5,
+	0xd828, 0x03c5, 0xd804, 0xd828, 0x03a5, 0xd808, 0x03a5, 0xd807,
+	0x03a5, 0xd800, 0x03a5, 0xd801, 0x03a1, 0xd827, 0x00a8, 0xd800,
+	0x00a8, 0xd801, 0x0060, 0x03c9, 0xd800, 0xd829, 0x03c9, 0xd829,
+	0x03c9, 0xd801, 0xd829, 0x03c9, 0xd828, 0x03c9, 0xd828, 0xd829,
+	0x039f, 0xd800, 0x039f, 0xd801, 0x03a9, 0xd800, 0x03a9, 0xd801,
+	0x03a9, 0xd829, 0x00b4, 0x2002, 0x2003, 0x03a9, 0x004b, 0x0041,
+	0xd805, 0x2190, 0xd82a, 0x2192, 0xd82a, 0x2194, 0xd82a, 0x21d0,
+	0xd82a, 0x21d4, 0xd82a, 0x21d2, 0xd82a, 0x2203, 0xd82a, 0x2208,
+	0xd82a, 0x220b, 0xd82a, 0x2223, 0xd82a, 0x2225, 0xd82a, 0x223c,
+	0xd82a, 0x2243, 0xd82a, 0x2245, 0xd82a, 0x2248, 0xd82a, 0x003d,
+	0xd82a, 0x2261, 0xd82a, 0x224d, 0xd82a, 0x003c, 0xd82a, 0x003e,
+	0xd82a, 0x2264, 0xd82a, 0x2265, 0xd82a, 0x2272, 0xd82a, 0x2273,
+	0xd82a, 0x2276, 0xd82a, 0x2277, 0xd82a, 0x227a, 0xd82a, 0x227b,
+	0xd82a, 0x2282, 0xd82a, 0x2283, 0xd82a, 0x2286, 0xd82a, 0x2287,
+	0xd82a, 0x22a2, 0xd82a, 0x22a8, 0xd82a, 0x22a9, 0xd82a, 0x22ab,
+	0xd82a, 0x227c, 0xd82a, 0x227d, 0xd82a, 0x2291, 0xd82a, 0x2292,
+	0xd82a, 0x22b2, 0xd82a, 0x22b3, 0xd82a, 0x22b4, 0xd82a, 0x22b5,
+	0xd82a, 0x3008, 0x3009, 0x2add, 0xd82a, 0x304b, 0xd82b, 0x304d,
+	0xd82b, 0x304f, 0xd82b, 0x3051, 0xd82b, 0x3053, 0xd82b, 0x3055,
+	0xd82b, 0x3057, 0xd82b, 0x3059, 0xd82b, 0x305b, 0xd82b, 0x305d,
+	0xd82b, 0x305f, 0xd82b, 0x3061, 0xd82b, 0x3064, 0xd82b, 0x3066,
+	0xd82b, 0x3068, 0xd82b, 0x306f, 0xd82b, 0x306f, 0xd82c, 0x3072,
+	0xd82b, 0x3072, 0xd82c, 0x3075, 0xd82b, 0x3075, 0xd82c, 0x3078,
+	0xd82b, 0x3078, 0xd82c, 0x307b, 0xd82b, 0x307b, 0xd82c, 0x3046,
+	0xd82b, 0x309d, 0xd82b, 0x30ab, 0xd82b, 0x30ad, 0xd82b, 0x30af,
+	0xd82b, 0x30b1, 0xd82b, 0x30b3, 0xd82b, 0x30b5, 0xd82b, 0x30b7,
+	0xd82b, 0x30b9, 0xd82b, 0x30bb, 0xd82b, 0x30bd, 0xd82b, 0x30bf,
+	0xd82b, 0x30c1, 0xd82b, 0x30c4, 0xd82b, 0x30c6, 0xd82b, 0x30c8,
+	0xd82b, 0x30cf, 0xd82b, 0x30cf, 0xd82c, 0x30d2, 0xd82b, 0x30d2,
+	0xd82c, 0x30d5, 0xd82b, 0x30d5, 0xd82c, 0x30d8, 0xd82b, 0x30d8,
+	0xd82c, 0x30db, 0xd82b, 0x30db, 0xd82c, 0x30a6, 0xd82b, 0x30ef,
+	0xd82b, 0x30f0, 0xd82b, 0x30f1, 0xd82b, 0x30f2, 0xd82b, 0x30fd,
+	0xd82b, 0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5,
+	0x9f9c, 0x9f9c, 0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669,
+	0x7f85, 0x863f, 0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9,
+	0x73de, 0x843d, 0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04, 0x721b,
+	0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8,
+	0x881f, 0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7,
+	0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c,
+	0x8def, 0x9732, 0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9,
+	0x9304, 0x9e7f, 0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e, 0x7262,
+	0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f,
+	0x7d2f, 0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c,
+	0x7dbe, 0x83f1, 0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39,
+	0x5be7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9,
+	0x4e0d, 0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449,
+	0x8aaa, 0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565,
+	0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf,
+	0x52f5, 0x5442, 0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad,
+	0x9a6a, 0x9e97, 0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74,
+	0x6190, 0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4,
+	0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd,
+	0x70c8, 0x88c2, 0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e,
+	0x7375, 0x4ee4, 0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469,
+	0x7f9a, 0x8046, 0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae,
+	0x91b4, 0x96b8, 0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f, 0x6599,
+	0x6a02, 0x71ce, 0x7642, 0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e,
+	0x5289, 0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b,
+	0x7d10, 0x985e, 0x516d, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea,
+	0x8f2a, 0x5f8b, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f,
+	0x5c65, 0x6613, 0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2, 0x7f79,
+	0x88cf, 0x88e1, 0x91cc, 0x96e2, 0x533f, 0x6eba, 0x541d, 0x71d0,
+	0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8,
+	0x7acb, 0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336,
+	0x523a, 0x5207, 0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4,
+	0x8f3b, 0x884c, 0x964d, 0x898b, 0x5ed3, 0x5140, 0x55c0, 0x585a,
+	0x6674, 0x51de, 0x732a, 0x76ca, 0x793c, 0x795e, 0x7965, 0x798f,
+	0x9756, 0x7cbe, 0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef,
+	0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d,
+	0x52c9, 0x52e4, 0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8,
+	0x5c64, 0x5c6e, 0x6094, 0x6168, 0x618e, 0x61f2, 0x654f, 0x65e2,
+	0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22, 0x716e, 0x722b, 0x7422,
+	0x7891, 0x793e, 0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d,
+	0x798e, 0x7a40, 0x7a81, 0x7bc0, 0x7df4, 0x7e09, 0x7e41, 0x7f72,
+	0x8005, 0x81ed, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01,
+	0x8b39, 0x8cd3, 0x8d08, 0x8fb6, 0x9038, 0x96e3, 0x97ff, 0x983b,
+	0x6075, 0xd82d, 0x8218, 0x4e26, 0x51b5, 0x5168, 0x4f80, 0x5145,
+	0x5180, 0x52c7, 0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2, 0x585a,
+	0x58b3, 0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69,
+	0x5fad, 0x60d8, 0x614e, 0x6108, 0x618e, 0x6160, 0x61f2, 0x6234,
+	0x63c4, 0x641c, 0x6452, 0x6556, 0x6674, 0x6717, 0x671b, 0x6756,
+	0x6b79, 0x6bba, 0x6d41, 0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e,
+	0x77a7, 0x7235, 0x72af, 0x732a, 0x7471, 0x7506, 0x753b, 0x761d,
+	0x761f, 0x76ca, 0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1,
+	0x7bc0, 0x7c7b, 0x7d5b, 0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef,
+	0x8779, 0x8941, 0x8986, 0x8996, 0x8abf, 0x8af8, 0x8acb, 0x8b01,
+	0x8afe, 0x8aed, 0x8b39, 0x8b8a, 0x8d08, 0x8f38, 0x9072, 0x9199,
+	0x9276, 0x967c, 0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b,
+	0x9b12, 0x9f9c, 0xd82e, 0xd82f, 0xd830, 0x3b9d, 0x4018, 0x4039,
+	0xd831, 0xd832, 0xd833, 0x9f43, 0x9f8e, 0x05d9, 0xd834, 0x05f2,
+	0xd835, 0x05e9, 0xd836, 0x05e9, 0xd837, 0x05e9, 0xd838, 0xd836,
+	0x05e9, 0xd838, 0xd837, 0x05d0, 0xd835, 0x05d0, 0xd839, 0x05d0,
+	0xd838, 0x05d1, 0xd838, 0x05d2, 0xd838, 0x05d3, 0xd838, 0x05d4,
+	0xd838, 0x05d5, 0xd838, 0x05d6, 0xd838, 0x05d8, 0xd838, 0x05d9,
+	0xd838, 0x05da, 0xd838, 0x05db, 0xd838, 0x05dc, 0xd838, 0x05de,
+	0xd838, 0x05e0, 0xd838, 0x05e1, 0xd838, 0x05e3, 0xd838, 0x05e4,
+	0xd838, 0x05e6, 0xd838, 0x05e7, 0xd838, 0x05e8, 0xd838, 0x05e9,
+	0xd838, 0x05ea, 0xd838, 0x05d5, 0xd83a, 0x05d1, 0xd83b, 0x05db,
+	0xd83b, 0x05e4, 0xd83b, 0xd83c, 0xd83d, 0xd83e, 0xd83d, 0xd83f,
+	0xd83d, 0xd840, 0xd841, 0xd842, 0xd841, 0xd843, 0xd844, 0xd843,
+	0xd845, 0xd846, 0xd847, 0xd846, 0xd848, 0xd846, 0xd849, 0xd84a,
+	0xd84b, 0xd84c, 0xd84b, 0xd84d, 0xd84e, 0xd84f, 0xd84e, 0xd84f,
+	0xd84e, 0xd850, 0xd84f, 0xd84e, 0xd851, 0xd84f, 0xd84e, 0xd852,
+	0xd84f, 0xd84e, 0xd853, 0xd84f, 0xd84e, 0xd854, 0xd855, 0xd84e,
+	0xd856, 0xd84e, 0xd855, 0xd84e, 0xd850, 0xd856, 0xd84e, 0xd850,
+	0xd855, 0xd84e, 0xd851, 0xd856, 0xd84e, 0xd851, 0x4e3d, 0x4e38,
+	0x4e41, 0xd857, 0x4f60, 0x4fae, 0x4fbb, 0x5002, 0x507a, 0x5099,
+	0x50e7, 0x50cf, 0x349e, 0xd858, 0x514d, 0x5154, 0x5164, 0x5177,
+	0xd859, 0x34b9, 0x5167, 0x518d, 0xd85a, 0x5197, 0x51a4, 0x4ecc,
+	0x51ac, 0x51b5, 0xd85b, 0x51f5, 0x5203, 0x34df, 0x523b, 0x5246,
+	0x5272, 0x5277, 0x3515, 0x52c7, 0x52c9, 0x52e4, 0x52fa, 0x5305,
+	0x5306, 0x5317, 0x5349, 0x5351, 0x535a, 0x5373, 0x537d, 0x537f,
+	0x537f, 0x537f, 0xd85c, 0x7070, 0x53ca, 0x53df, 0xd85d, 0x53eb,
+	0x53f1, 0x5406, 0x549e, 0x5438, 0x5448, 0x5468, 0x54a2, 0x54f6,
+	0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55ab, 0x55b3,
+	0x55c2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58ee,
+	0x57ce, 0x57f4, 0x580d, 0x578b, 0x5832, 0x5831, 0x58ac, 0xd85e,
+	0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922, 0x5962, 0xd85f, 0xd860,
+	0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66, 0x36ee, 0x36fc, 0x5b08,
+	0x5b3e, 0x5b3e, 0xd861, 0x5bc3, 0x5bd8, 0x5be7, 0x5bf3, 0xd862,
+	0x5bff, 0x5c06, 0x5f53, 0x5c22, 0x3781, 0x5c60, 0x5c6e, 0x5cc0,
+	0x5c8d, 0xd863, 0x5d43, 0xd864, 0x5d6e, 0x5d6b, 0x5d7c, 0x5de1,
+	0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69, 0x3862, 0xd865,
+	0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca, 0xd866, 0x5efe, 0xd867,
+	0xd867, 0x8201, 0x5f22, 0x5f22, 0x38c7, 0xd868, 0xd869, 0x5f62,
+	0x5f6b, 0x38e3, 0x5f9a, 0x5fcd, 0x5fd7, 0x5ff9, 0x6081, 0x393a,
+	0x391c, 0x6094, 0xd86a, 0x60c7, 0x6148, 0x614c, 0x614e, 0x614c,
+	0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af, 0x61de, 0x61f2, 0x61f6,
+	0x6210, 0x621b, 0x625d, 0x62b1, 0x62d4, 0x6350, 0xd86b, 0x633d,
+	0x62fc, 0x6368, 0x6383, 0x63e4, 0xd86c, 0x6422, 0x63c5, 0x63a9,
+	0x3a2e, 0x6469, 0x647e, 0x649d, 0x6477, 0x3a6c, 0x654f, 0x656c,
+	0xd86d, 0x65e3, 0x66f8, 0x6649, 0x3b19, 0x6691, 0x3b08, 0x3ae4,
+	0x5192, 0x5195, 0x6700, 0x669c, 0x80ad, 0x43d9, 0x6717, 0x671b,
+	0x6721, 0x675e, 0x6753, 0xd86e, 0x3b49, 0x67fa, 0x6785, 0x6852,
+	0x6885, 0xd86f, 0x688e, 0x681f, 0x6914, 0x3b9d, 0x6942, 0x69a3,
+	0x69ea, 0x6aa8, 0xd870, 0x6adb, 0x3c18, 0x6b21, 0xd871, 0x6b54,
+	0x3c4e, 0x6b72, 0x6b9f, 0x6bba, 0x6bbb, 0xd872, 0xd873, 0xd874,
+	0x6c4e, 0xd875, 0x6cbf, 0x6ccd, 0x6c67, 0x6d16, 0x6d3e, 0x6d77,
+	0x6d41, 0x6d69, 0x6d78, 0x6d85, 0xd876, 0x6d34, 0x6e2f, 0x6e6e,
+	0x3d33, 0x6ecb, 0x6ec7, 0xd877, 0x6df9, 0x6f6e, 0xd878, 0xd879,
+	0x6fc6, 0x7039, 0x701e, 0x701b, 0x3d96, 0x704a, 0x707d, 0x7077,
+	0x70ad, 0xd87a, 0x7145, 0xd87b, 0x719c, 0xd87c, 0x7228, 0x7235,
+	0x7250, 0xd87d, 0x7280, 0x7295, 0xd87e, 0xd87f, 0x737a, 0x738b,
+	0x3eac, 0x73a5, 0x3eb8, 0x3eb8, 0x7447, 0x745c, 0x7471, 0x7485,
+	0x74ca, 0x3f1b, 0x7524, 0xd880, 0x753e, 0xd881, 0x7570, 0xd882,
+	0x7610, 0xd883, 0xd884, 0xd885, 0x3ffc, 0x4008, 0x76f4, 0xd886,
+	0xd887, 0xd888, 0xd889, 0x771e, 0x771f, 0x771f, 0x774a, 0x4039,
+	0x778b, 0x4046, 0x4096, 0xd88a, 0x784e, 0x788c, 0x78cc, 0x40e3,
+	0xd88b, 0x7956, 0xd88c, 0xd88d, 0x798f, 0x79eb, 0x412f, 0x7a40,
+	0x7a4a, 0x7a4f, 0xd88e, 0xd88f, 0xd88f, 0x7aee, 0x4202, 0xd890,
+	0x7bc6, 0x7bc9, 0x4227, 0xd891, 0x7cd2, 0x42a0, 0x7ce8, 0x7ce3,
+	0x7d00, 0xd892, 0x7d63, 0x4301, 0x7dc7, 0x7e02, 0x7e45, 0x4334,
+	0xd893, 0xd894, 0x4359, 0xd895, 0x7f7a, 0xd896, 0x7f95, 0x7ffa,
+	0x8005, 0xd897, 0xd898, 0x8060, 0xd899, 0x8070, 0xd89a, 0x43d5,
+	0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5, 0xd89b, 0xd89c, 0xd89d,
+	0xd89e, 0x8201, 0x8204, 0x8f9e, 0x446b, 0x8291, 0x828b, 0x829d,
+	0x52b3, 0x82b1, 0x82b3, 0x82bd, 0x82e6, 0xd89f, 0x82e5, 0x831d,
+	0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7, 0x8457, 0x8353, 0x83ca,
+	0x83cc, 0x83dc, 0xd8a0, 0xd8a1, 0xd8a2, 0x452b, 0x84f1, 0x84f3,
+	0x8516, 0xd8a3, 0x8564, 0xd8a4, 0x455d, 0x4561, 0xd8a5, 0xd8a6,
+	0x456b, 0x8650, 0x865c, 0x8667, 0x8669, 0x86a9, 0x8688, 0x870e,
+	0x86e2, 0x8779, 0x8728, 0x876b, 0x8786, 0x45d7, 0x87e1, 0x8801,
+	0x45f9, 0x8860, 0x8863, 0xd8a7, 0x88d7, 0x88de, 0x4635, 0x88fa,
+	0x34bb, 0xd8a8, 0xd8a9, 0x46be, 0x46c7, 0x8aa0, 0x8aed, 0x8b8a,
+	0x8c55, 0xd8aa, 0x8cab, 0x8cc1, 0x8d1b, 0x8d77, 0xd8ab, 0xd8ac,
+	0x8dcb, 0x8dbc, 0x8df0, 0xd8ad, 0x8ed4, 0x8f38, 0xd8ae, 0xd8af,
+	0x9094, 0x90f1, 0x9111, 0xd8b0, 0x911b, 0x9238, 0x92d7, 0x92d8,
+	0x927c, 0x93f9, 0x9415, 0xd8b1, 0x958b, 0x4995, 0x95b7, 0xd8b2,
+	0x49e6, 0x96c3, 0x5db2, 0x9723, 0xd8b3, 0xd8b4, 0x4a6e, 0x4a76,
+	0x97e0, 0xd8b5, 0x4ab2, 0xd8b6, 0x980b, 0x980b, 0x9829, 0xd8b7,
+	0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2, 0x99fe, 0x4bce, 0xd8b8,
+	0x9b12, 0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67, 0xd8b9, 0x4cf8,
+	0xd8ba, 0xd8bb, 0xd8bc, 0x9ebb, 0x4d56, 0x9ef9, 0x9efe, 0x9f05,
+	0x9f0f, 0x9f16, 0x9f3b, 0xd8bd,
+};
+
+static const u32 apfs_nfd_esc[] __aligned(64) = {
+	0x00000000,
+};
+
+static const u16 apfs_nfdcf[] __aligned(64) = {
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+	0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070,
+	0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+	0x0079, 0x007a, 0x03bc, 0x0061, 0xd800, 0x0061, 0xd801, 0x0061,
+	0xd802, 0x0061, 0xd803, 0x0061, 0xd804, 0x0061, 0xd805, 0x00e6,
+	0x0063, 0xd806, 0x0065, 0xd800, 0x0065, 0xd801, 0x0065, 0xd802,
+	0x0065, 0xd804, 0x0069, 0xd800, 0x0069, 0xd801, 0x0069, 0xd802,
+	0x0069, 0xd804, 0x00f0, 0x006e, 0xd803, 0x006f, 0xd800, 0x006f,
+	0xd801, 0x006f, 0xd802, 0x006f, 0xd803, 0x006f, 0xd804, 0x00f8,
+	0x0075, 0xd800, 0x0075, 0xd801, 0x0075, 0xd802, 0x0075, 0xd804,
+	0x0079, 0xd801, 0x00fe, 0x0073, 0x0073, 0x0061, 0xd800, 0x0061,
+	0xd801, 0x0061, 0xd802, 0x0061, 0xd803, 0x0061, 0xd804, 0x0061,
+	0xd805, 0x0063, 0xd806, 0x0065, 0xd800, 0x0065, 0xd801, 0x0065,
+	0xd802, 0x0065, 0xd804, 0x0069, 0xd800, 0x0069, 0xd801, 0x0069,
+	0xd802, 0x0069, 0xd804, 0x006e, 0xd803, 0x006f, 0xd800, 0x006f,
+	0xd801, 0x006f, 0xd802, 0x006f, 0xd803, 0x006f, 0xd804, 0x0075,
+	0xd800, 0x0075, 0xd801, 0x0075, 0xd802, 0x0075, 0xd804, 0x0079,
+	0xd801, 0x0079, 0xd804, 0x0061, 0xd807, 0x0061, 0xd807, 0x0061,
+	0xd808, 0x0061, 0xd808, 0x0061, 0xd809, 0x0061, 0xd809, 0x0063,
+	0xd801, 0x0063, 0xd801, 0x0063, 0xd802, 0x0063, 0xd802, 0x0063,
+	0xd80a, 0x0063, 0xd80a, 0x0063, 0xd80b, 0x0063, 0xd80b, 0x0064,
+	0xd80b, 0x0064, 0xd80b, 0x0111, 0x0065, 0xd807, 0x0065, 0xd807,
+	0x0065, 0xd808, 0x0065, 0xd808, 0x0065, 0xd80a, 0x0065, 0xd80a,
+	0x0065, 0xd809, 0x0065, 0xd809, 0x0065, 0xd80b, 0x0065, 0xd80b,
+	0x0067, 0xd802, 0x0067, 0xd802, 0x0067, 0xd808, 0x0067, 0xd808,
+	0x0067, 0xd80a, 0x0067, 0xd80a, 0x0067, 0xd806, 0x0067, 0xd806,
+	0x0068, 0xd802, 0x0068, 0xd802, 0x0127, 0x0069, 0xd803, 0x0069,
+	0xd803, 0x0069, 0xd807, 0x0069, 0xd807, 0x0069, 0xd808, 0x0069,
+	0xd808, 0x0069, 0xd809, 0x0069, 0xd809, 0x0069, 0xd80a, 0x0133,
+	0x006a, 0xd802, 0x006a, 0xd802, 0x006b, 0xd806, 0x006b, 0xd806,
+	0x006c, 0xd801, 0x006c, 0xd801, 0x006c, 0xd806, 0x006c, 0xd806,
+	0x006c, 0xd80b, 0x006c, 0xd80b, 0x0140, 0x0142, 0x006e, 0xd801,
+	0x006e, 0xd801, 0x006e, 0xd806, 0x006e, 0xd806, 0x006e, 0xd80b,
+	0x006e, 0xd80b, 0x02bc, 0x006e, 0x014b, 0x006f, 0xd807, 0x006f,
+	0xd807, 0x006f, 0xd808, 0x006f, 0xd808, 0x006f, 0xd80c, 0x006f,
+	0xd80c, 0x0153, 0x0072, 0xd801, 0x0072, 0xd801, 0x0072, 0xd806,
+	0x0072, 0xd806, 0x0072, 0xd80b, 0x0072, 0xd80b, 0x0073, 0xd801,
+	0x0073, 0xd801, 0x0073, 0xd802, 0x0073, 0xd802, 0x0073, 0xd806,
+	0x0073, 0xd806, 0x0073, 0xd80b, 0x0073, 0xd80b, 0x0074, 0xd806,
+	0x0074, 0xd806, 0x0074, 0xd80b, 0x0074, 0xd80b, 0x0167, 0x0075,
+	0xd803, 0x0075, 0xd803, 0x0075, 0xd807, 0x0075, 0xd807, 0x0075,
+	0xd808, 0x0075, 0xd808, 0x0075, 0xd805, 0x0075, 0xd805, 0x0075,
+	0xd80c, 0x0075, 0xd80c, 0x0075, 0xd809, 0x0075, 0xd809, 0x0077,
+	0xd802, 0x0077, 0xd802, 0x0079, 0xd802, 0x0079, 0xd802, 0x0079,
+	0xd804, 0x007a, 0xd801, 0x007a, 0xd801, 0x007a, 0xd80a, 0x007a,
+	0xd80a, 0x007a, 0xd80b, 0x007a, 0xd80b, 0x0073, 0x0253, 0x0183,
+	0x0185, 0x0254, 0x0188, 0x0256, 0x0257, 0x018c, 0x01dd, 0x0259,
+	0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f,
+	0x0272, 0x0275, 0x006f, 0xd80d, 0x006f, 0xd80d, 0x01a3, 0x01a5,
+	0x0280, 0x01a8, 0x0283, 0x01ad, 0x0288, 0x0075, 0xd80d, 0x0075,
+	0xd80d, 0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292, 0x01b9, 0x01bd,
+	0x01c6, 0x01c6, 0x01c9, 0x01c9, 0x01cc, 0x01cc, 0x0061, 0xd80b,
+	0x0061, 0xd80b, 0x0069, 0xd80b, 0x0069, 0xd80b, 0x006f, 0xd80b,
+	0x006f, 0xd80b, 0x0075, 0xd80b, 0x0075, 0xd80b, 0x0075, 0xd804,
+	0xd807, 0x0075, 0xd804, 0xd807, 0x0075, 0xd804, 0xd801, 0x0075,
+	0xd804, 0xd801, 0x0075, 0xd804, 0xd80b, 0x0075, 0xd804, 0xd80b,
+	0x0075, 0xd804, 0xd800, 0x0075, 0xd804, 0xd800, 0x0061, 0xd804,
+	0xd807, 0x0061, 0xd804, 0xd807, 0x0061, 0xd80a, 0xd807, 0x0061,
+	0xd80a, 0xd807, 0x00e6, 0xd807, 0x00e6, 0xd807, 0x01e5, 0x0067,
+	0xd80b, 0x0067, 0xd80b, 0x006b, 0xd80b, 0x006b, 0xd80b, 0x006f,
+	0xd809, 0x006f, 0xd809, 0x006f, 0xd809, 0xd807, 0x006f, 0xd809,
+	0xd807, 0x0292, 0xd80b, 0x0292, 0xd80b, 0x006a, 0xd80b, 0x01f3,
+	0x01f3, 0x0067, 0xd801, 0x0067, 0xd801, 0x0195, 0x01bf, 0x006e,
+	0xd800, 0x006e, 0xd800, 0x0061, 0xd805, 0xd801, 0x0061, 0xd805,
+	0xd801, 0x00e6, 0xd801, 0x00e6, 0xd801, 0x00f8, 0xd801, 0x00f8,
+	0xd801, 0x0061, 0xd80e, 0x0061, 0xd80e, 0x0061, 0xd80f, 0x0061,
+	0xd80f, 0x0065, 0xd80e, 0x0065, 0xd80e, 0x0065, 0xd80f, 0x0065,
+	0xd80f, 0x0069, 0xd80e, 0x0069, 0xd80e, 0x0069, 0xd80f, 0x0069,
+	0xd80f, 0x006f, 0xd80e, 0x006f, 0xd80e, 0x006f, 0xd80f, 0x006f,
+	0xd80f, 0x0072, 0xd80e, 0x0072, 0xd80e, 0x0072, 0xd80f, 0x0072,
+	0xd80f, 0x0075, 0xd80e, 0x0075, 0xd80e, 0x0075, 0xd80f, 0x0075,
+	0xd80f, 0x0073, 0xd810, 0x0073, 0xd810, 0x0074, 0xd810, 0x0074,
+	0xd810, 0x021d, 0x0068, 0xd80b, 0x0068, 0xd80b, 0x019e, 0x0223,
+	0x0225, 0x0061, 0xd80a, 0x0061, 0xd80a, 0x0065, 0xd806, 0x0065,
+	0xd806, 0x006f, 0xd804, 0xd807, 0x006f, 0xd804, 0xd807, 0x006f,
+	0xd803, 0xd807, 0x006f, 0xd803, 0xd807, 0x006f, 0xd80a, 0x006f,
+	0xd80a, 0x006f, 0xd80a, 0xd807, 0x006f, 0xd80a, 0xd807, 0x0079,
+	0xd807, 0x0079, 0xd807, 0x2c65, 0x023c, 0x019a, 0x2c66, 0x0242,
+	0x0180, 0x0289, 0x028c, 0x0247, 0x0249, 0x024b, 0x024d, 0x024f,
+	0xd800, 0xd801, 0xd811, 0xd804, 0xd801, 0x03b9, 0x0371, 0x0373,
+	0x02b9, 0x0377, 0x003b, 0x03f3, 0x00a8, 0xd801, 0x03b1, 0xd801,
+	0x00b7, 0x03b5, 0xd801, 0x03b7, 0xd801, 0x03b9, 0xd801, 0x03bf,
+	0xd801, 0x03c5, 0xd801, 0x03c9, 0xd801, 0x03b9, 0xd804, 0xd801,
+	0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8,
+	0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0,
+	0x03c1, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9,
+	0x03b9, 0xd804, 0x03c5, 0xd804, 0x03b1, 0xd801, 0x03b5, 0xd801,
+	0x03b7, 0xd801, 0x03b9, 0xd801, 0x03c5, 0xd804, 0xd801, 0x03c3,
+	0x03b9, 0xd804, 0x03c5, 0xd804, 0x03bf, 0xd801, 0x03c5, 0xd801,
+	0x03c9, 0xd801, 0x03d7, 0x03b2, 0x03b8, 0x03d2, 0xd801, 0x03d2,
+	0xd804, 0x03c6, 0x03c0, 0x03d9, 0x03db, 0x03dd, 0x03df, 0x03e1,
+	0x03e3, 0x03e5, 0x03e7, 0x03e9, 0x03eb, 0x03ed, 0x03ef, 0x03ba,
+	0x03c1, 0x03b8, 0x03b5, 0x03f8, 0x03f2, 0x03fb, 0x037b, 0x037c,
+	0x037d, 0x0435, 0xd800, 0x0435, 0xd804, 0x0452, 0x0433, 0xd801,
+	0x0454, 0x0455, 0x0456, 0x0456, 0xd804, 0x0458, 0x0459, 0x045a,
+	0x045b, 0x043a, 0xd801, 0x0438, 0xd800, 0x0443, 0xd808, 0x045f,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+	0x0438, 0x0438, 0xd808, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e,
+	0x043f, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446,
+	0x0447, 0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e,
+	0x044f, 0x0438, 0xd808, 0x0435, 0xd800, 0x0435, 0xd804, 0x0433,
+	0xd801, 0x0456, 0xd804, 0x043a, 0xd801, 0x0438, 0xd800, 0x0443,
+	0xd808, 0x0461, 0x0463, 0x0465, 0x0467, 0x0469, 0x046b, 0x046d,
+	0x046f, 0x0471, 0x0473, 0x0475, 0x0475, 0xd80e, 0x0475, 0xd80e,
+	0x0479, 0x047b, 0x047d, 0x047f, 0x0481, 0x048b, 0x048d, 0x048f,
+	0x0491, 0x0493, 0x0495, 0x0497, 0x0499, 0x049b, 0x049d, 0x049f,
+	0x04a1, 0x04a3, 0x04a5, 0x04a7, 0x04a9, 0x04ab, 0x04ad, 0x04af,
+	0x04b1, 0x04b3, 0x04b5, 0x04b7, 0x04b9, 0x04bb, 0x04bd, 0x04bf,
+	0x04cf, 0x0436, 0xd808, 0x0436, 0xd808, 0x04c4, 0x04c6, 0x04c8,
+	0x04ca, 0x04cc, 0x04ce, 0x0430, 0xd808, 0x0430, 0xd808, 0x0430,
+	0xd804, 0x0430, 0xd804, 0x04d5, 0x0435, 0xd808, 0x0435, 0xd808,
+	0x04d9, 0x04d9, 0xd804, 0x04d9, 0xd804, 0x0436, 0xd804, 0x0436,
+	0xd804, 0x0437, 0xd804, 0x0437, 0xd804, 0x04e1, 0x0438, 0xd807,
+	0x0438, 0xd807, 0x0438, 0xd804, 0x0438, 0xd804, 0x043e, 0xd804,
+	0x043e, 0xd804, 0x04e9, 0x04e9, 0xd804, 0x04e9, 0xd804, 0x044d,
+	0xd804, 0x044d, 0xd804, 0x0443, 0xd807, 0x0443, 0xd807, 0x0443,
+	0xd804, 0x0443, 0xd804, 0x0443, 0xd80c, 0x0443, 0xd80c, 0x0447,
+	0xd804, 0x0447, 0xd804, 0x04f7, 0x044b, 0xd804, 0x044b, 0xd804,
+	0x04fb, 0x04fd, 0x04ff, 0x0501, 0x0503, 0x0505, 0x0507, 0x0509,
+	0x050b, 0x050d, 0x050f, 0x0511, 0x0513, 0x0515, 0x0517, 0x0519,
+	0x051b, 0x051d, 0x051f, 0x0521, 0x0523, 0x0525, 0x0527, 0x0529,
+	0x052b, 0x052d, 0x052f, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565,
+	0x0566, 0x0567, 0x0568, 0x0569, 0x056a, 0x056b, 0x056c, 0x056d,
+	0x056e, 0x056f, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575,
+	0x0576, 0x0577, 0x0578, 0x0579, 0x057a, 0x057b, 0x057c, 0x057d,
+	0x057e, 0x057f, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585,
+	0x0586, 0x0565, 0x0582, 0x0627, 0xd812, 0x0627, 0xd813, 0x0648,
+	0xd813, 0x0627, 0xd814, 0x064a, 0xd813, 0x06d5, 0xd813, 0x06c1,
+	0xd813, 0x06d2, 0xd813, 0x0928, 0xd815, 0x0930, 0xd815, 0x0933,
+	0xd815, 0x0915, 0xd815, 0x0916, 0xd815, 0x0917, 0xd815, 0x091c,
+	0xd815, 0x0921, 0xd815, 0x0922, 0xd815, 0x092b, 0xd815, 0x092f,
+	0xd815, 0x09c7, 0x09be, 0x09c7, 0x09d7, 0x09a1, 0xd816, 0x09a2,
+	0xd816, 0x09af, 0xd816, 0x0a32, 0xd817, 0x0a38, 0xd817, 0x0a16,
+	0xd817, 0x0a17, 0xd817, 0x0a1c, 0xd817, 0x0a2b, 0xd817, 0x0b47,
+	0x0b56, 0x0b47, 0x0b3e, 0x0b47, 0x0b57, 0x0b21, 0xd818, 0x0b22,
+	0xd818, 0x0b92, 0x0bd7, 0x0bc6, 0x0bbe, 0x0bc7, 0x0bbe, 0x0bc6,
+	0x0bd7, 0x0c46, 0xd819, 0x0cbf, 0x0cd5, 0x0cc6, 0x0cd5, 0x0cc6,
+	0x0cd6, 0x0cc6, 0x0cc2, 0x0cc6, 0x0cc2, 0x0cd5, 0x0d46, 0x0d3e,
+	0x0d47, 0x0d3e, 0x0d46, 0x0d57, 0x0dd9, 0xd81a, 0x0dd9, 0x0dcf,
+	0x0dd9, 0x0dcf, 0xd81a, 0x0dd9, 0x0ddf, 0x0f42, 0x0fb7, 0x0f4c,
+	0x0fb7, 0x0f51, 0x0fb7, 0x0f56, 0x0fb7, 0x0f5b, 0x0fb7, 0x0f40,
+	0x0fb5, 0xd81b, 0xd81c, 0xd81b, 0xd81d, 0x0fb2, 0xd81e, 0x0fb3,
+	0xd81e, 0xd81b, 0xd81e, 0x0f92, 0x0fb7, 0x0f9c, 0x0fb7, 0x0fa1,
+	0x0fb7, 0x0fa6, 0x0fb7, 0x0fab, 0x0fb7, 0x0f90, 0x0fb5, 0x1025,
+	0x102e, 0x2d00, 0x2d01, 0x2d02, 0x2d03, 0x2d04, 0x2d05, 0x2d06,
+	0x2d07, 0x2d08, 0x2d09, 0x2d0a, 0x2d0b, 0x2d0c, 0x2d0d, 0x2d0e,
+	0x2d0f, 0x2d10, 0x2d11, 0x2d12, 0x2d13, 0x2d14, 0x2d15, 0x2d16,
+	0x2d17, 0x2d18, 0x2d19, 0x2d1a, 0x2d1b, 0x2d1c, 0x2d1d, 0x2d1e,
+	0x2d1f, 0x2d20, 0x2d21, 0x2d22, 0x2d23, 0x2d24, 0x2d25, 0x2d27,
+	0x2d2d, 0x13f0, 0x13f1, 0x13f2, 0x13f3, 0x13f4, 0x13f5, 0x1b05,
+	0x1b35, 0x1b07, 0x1b35, 0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d,
+	0x1b35, 0x1b11, 0x1b35, 0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e,
+	0x1b35, 0x1b3f, 0x1b35, 0x1b42, 0x1b35, 0x0432, 0x0434, 0x043e,
+	0x0441, 0x0442, 0x0442, 0x044a, 0x0463, 0xa64b, 0x0061, 0xd81f,
+	0x0061, 0xd81f, 0x0062, 0xd80a, 0x0062, 0xd80a, 0x0062, 0xd820,
+	0x0062, 0xd820, 0x0062, 0xd821, 0x0062, 0xd821, 0x0063, 0xd806,
+	0xd801, 0x0063, 0xd806, 0xd801, 0x0064, 0xd80a, 0x0064, 0xd80a,
+	0x0064, 0xd820, 0x0064, 0xd820, 0x0064, 0xd821, 0x0064, 0xd821,
+	0x0064, 0xd806, 0x0064, 0xd806, 0x0064, 0xd822, 0x0064, 0xd822,
+	0x0065, 0xd807, 0xd800, 0x0065, 0xd807, 0xd800, 0x0065, 0xd807,
+	0xd801, 0x0065, 0xd807, 0xd801, 0x0065, 0xd822, 0x0065, 0xd822,
+	0x0065, 0xd823, 0x0065, 0xd823, 0x0065, 0xd806, 0xd808, 0x0065,
+	0xd806, 0xd808, 0x0066, 0xd80a, 0x0066, 0xd80a, 0x0067, 0xd807,
+	0x0067, 0xd807, 0x0068, 0xd80a, 0x0068, 0xd80a, 0x0068, 0xd820,
+	0x0068, 0xd820, 0x0068, 0xd804, 0x0068, 0xd804, 0x0068, 0xd806,
+	0x0068, 0xd806, 0x0068, 0xd824, 0x0068, 0xd824, 0x0069, 0xd823,
+	0x0069, 0xd823, 0x0069, 0xd804, 0xd801, 0x0069, 0xd804, 0xd801,
+	0x006b, 0xd801, 0x006b, 0xd801, 0x006b, 0xd820, 0x006b, 0xd820,
+	0x006b, 0xd821, 0x006b, 0xd821, 0x006c, 0xd820, 0x006c, 0xd820,
+	0x006c, 0xd820, 0xd807, 0x006c, 0xd820, 0xd807, 0x006c, 0xd821,
+	0x006c, 0xd821, 0x006c, 0xd822, 0x006c, 0xd822, 0x006d, 0xd801,
+	0x006d, 0xd801, 0x006d, 0xd80a, 0x006d, 0xd80a, 0x006d, 0xd820,
+	0x006d, 0xd820, 0x006e, 0xd80a, 0x006e, 0xd80a, 0x006e, 0xd820,
+	0x006e, 0xd820, 0x006e, 0xd821, 0x006e, 0xd821, 0x006e, 0xd822,
+	0x006e, 0xd822, 0x006f, 0xd803, 0xd801, 0x006f, 0xd803, 0xd801,
+	0x006f, 0xd803, 0xd804, 0x006f, 0xd803, 0xd804, 0x006f, 0xd807,
+	0xd800, 0x006f, 0xd807, 0xd800, 0x006f, 0xd807, 0xd801, 0x006f,
+	0xd807, 0xd801, 0x0070, 0xd801, 0x0070, 0xd801, 0x0070, 0xd80a,
+	0x0070, 0xd80a, 0x0072, 0xd80a, 0x0072, 0xd80a, 0x0072, 0xd820,
+	0x0072, 0xd820, 0x0072, 0xd820, 0xd807, 0x0072, 0xd820, 0xd807,
+	0x0072, 0xd821, 0x0072, 0xd821, 0x0073, 0xd80a, 0x0073, 0xd80a,
+	0x0073, 0xd820, 0x0073, 0xd820, 0x0073, 0xd801, 0xd80a, 0x0073,
+	0xd801, 0xd80a, 0x0073, 0xd80b, 0xd80a, 0x0073, 0xd80b, 0xd80a,
+	0x0073, 0xd820, 0xd80a, 0x0073, 0xd820, 0xd80a, 0x0074, 0xd80a,
+	0x0074, 0xd80a, 0x0074, 0xd820, 0x0074, 0xd820, 0x0074, 0xd821,
+	0x0074, 0xd821, 0x0074, 0xd822, 0x0074, 0xd822, 0x0075, 0xd825,
+	0x0075, 0xd825, 0x0075, 0xd823, 0x0075, 0xd823, 0x0075, 0xd822,
+	0x0075, 0xd822, 0x0075, 0xd803, 0xd801, 0x0075, 0xd803, 0xd801,
+	0x0075, 0xd807, 0xd804, 0x0075, 0xd807, 0xd804, 0x0076, 0xd803,
+	0x0076, 0xd803, 0x0076, 0xd820, 0x0076, 0xd820, 0x0077, 0xd800,
+	0x0077, 0xd800, 0x0077, 0xd801, 0x0077, 0xd801, 0x0077, 0xd804,
+	0x0077, 0xd804, 0x0077, 0xd80a, 0x0077, 0xd80a, 0x0077, 0xd820,
+	0x0077, 0xd820, 0x0078, 0xd80a, 0x0078, 0xd80a, 0x0078, 0xd804,
+	0x0078, 0xd804, 0x0079, 0xd80a, 0x0079, 0xd80a, 0x007a, 0xd802,
+	0x007a, 0xd802, 0x007a, 0xd820, 0x007a, 0xd820, 0x007a, 0xd821,
+	0x007a, 0xd821, 0x0068, 0xd821, 0x0074, 0xd804, 0x0077, 0xd805,
+	0x0079, 0xd805, 0x0061, 0x02be, 0x0073, 0xd80a, 0x0073, 0x0073,
+	0x0061, 0xd820, 0x0061, 0xd820, 0x0061, 0xd826, 0x0061, 0xd826,
+	0x0061, 0xd802, 0xd801, 0x0061, 0xd802, 0xd801, 0x0061, 0xd802,
+	0xd800, 0x0061, 0xd802, 0xd800, 0x0061, 0xd802, 0xd826, 0x0061,
+	0xd802, 0xd826, 0x0061, 0xd802, 0xd803, 0x0061, 0xd802, 0xd803,
+	0x0061, 0xd820, 0xd802, 0x0061, 0xd820, 0xd802, 0x0061, 0xd808,
+	0xd801, 0x0061, 0xd808, 0xd801, 0x0061, 0xd808, 0xd800, 0x0061,
+	0xd808, 0xd800, 0x0061, 0xd808, 0xd826, 0x0061, 0xd808, 0xd826,
+	0x0061, 0xd808, 0xd803, 0x0061, 0xd808, 0xd803, 0x0061, 0xd820,
+	0xd808, 0x0061, 0xd820, 0xd808, 0x0065, 0xd820, 0x0065, 0xd820,
+	0x0065, 0xd826, 0x0065, 0xd826, 0x0065, 0xd803, 0x0065, 0xd803,
+	0x0065, 0xd802, 0xd801, 0x0065, 0xd802, 0xd801, 0x0065, 0xd802,
+	0xd800, 0x0065, 0xd802, 0xd800, 0x0065, 0xd802, 0xd826, 0x0065,
+	0xd802, 0xd826, 0x0065, 0xd802, 0xd803, 0x0065, 0xd802, 0xd803,
+	0x0065, 0xd820, 0xd802, 0x0065, 0xd820, 0xd802, 0x0069, 0xd826,
+	0x0069, 0xd826, 0x0069, 0xd820, 0x0069, 0xd820, 0x006f, 0xd820,
+	0x006f, 0xd820, 0x006f, 0xd826, 0x006f, 0xd826, 0x006f, 0xd802,
+	0xd801, 0x006f, 0xd802, 0xd801, 0x006f, 0xd802, 0xd800, 0x006f,
+	0xd802, 0xd800, 0x006f, 0xd802, 0xd826, 0x006f, 0xd802, 0xd826,
+	0x006f, 0xd802, 0xd803, 0x006f, 0xd802, 0xd803, 0x006f, 0xd820,
+	0xd802, 0x006f, 0xd820, 0xd802, 0x006f, 0xd80d, 0xd801, 0x006f,
+	0xd80d, 0xd801, 0x006f, 0xd80d, 0xd800, 0x006f, 0xd80d, 0xd800,
+	0x006f, 0xd80d, 0xd826, 0x006f, 0xd80d, 0xd826, 0x006f, 0xd80d,
+	0xd803, 0x006f, 0xd80d, 0xd803, 0x006f, 0xd80d, 0xd820, 0x006f,
+	0xd80d, 0xd820, 0x0075, 0xd820, 0x0075, 0xd820, 0x0075, 0xd826,
+	0x0075, 0xd826, 0x0075, 0xd80d, 0xd801, 0x0075, 0xd80d, 0xd801,
+	0x0075, 0xd80d, 0xd800, 0x0075, 0xd80d, 0xd800, 0x0075, 0xd80d,
+	0xd826, 0x0075, 0xd80d, 0xd826, 0x0075, 0xd80d, 0xd803, 0x0075,
+	0xd80d, 0xd803, 0x0075, 0xd80d, 0xd820, 0x0075, 0xd80d, 0xd820,
+	0x0079, 0xd800, 0x0079, 0xd800, 0x0079, 0xd820, 0x0079, 0xd820,
+	0x0079, 0xd826, 0x0079, 0xd826, 0x0079, 0xd803, 0x0079, 0xd803,
+	0x1efb, 0x1efd, 0x1eff, 0x03b1, 0xd811, 0x03b1, 0xd827, 0x03b1,
+	0xd811, 0xd800, 0x03b1, 0xd827, 0xd800, 0x03b1, 0xd811, 0xd801,
+	0x03b1, 0xd827, 0xd801, 0x03b1, 0xd811, 0xd828, 0x03b1, 0xd827,
+	0xd828, 0x03b1, 0xd811, 0x03b1, 0xd827, 0x03b1, 0xd811, 0xd800,
+	0x03b1, 0xd827, 0xd800, 0x03b1, 0xd811, 0xd801, 0x03b1, 0xd827,
+	0xd801, 0x03b1, 0xd811, 0xd828, 0x03b1, 0xd827, 0xd828, 0x03b5,
+	0xd811, 0x03b5, 0xd827, 0x03b5, 0xd811, 0xd800, 0x03b5, 0xd827,
+	0xd800, 0x03b5, 0xd811, 0xd801, 0x03b5, 0xd827, 0xd801, 0x03b5,
+	0xd811, 0x03b5, 0xd827, 0x03b5, 0xd811, 0xd800, 0x03b5, 0xd827,
+	0xd800, 0x03b5, 0xd811, 0xd801, 0x03b5, 0xd827, 0xd801, 0x03b7,
+	0xd811, 0x03b7, 0xd827, 0x03b7, 0xd811, 0xd800, 0x03b7, 0xd827,
+	0xd800, 0x03b7, 0xd811, 0xd801, 0x03b7, 0xd827, 0xd801, 0x03b7,
+	0xd811, 0xd828, 0x03b7, 0xd827, 0xd828, 0x03b7, 0xd811, 0x03b7,
+	0xd827, 0x03b7, 0xd811, 0xd800, 0x03b7, 0xd827, 0xd800, 0x03b7,
+	0xd811, 0xd801, 0x03b7, 0xd827, 0xd801, 0x03b7, 0xd811, 0xd828,
+	0x03b7, 0xd827, 0xd828, 0x03b9, 0xd811, 0x03b9, 0xd827, 0x03b9,
+	0xd811, 0xd800, 0x03b9, 0xd827, 0xd800, 0x03b9, 0xd811, 0xd801,
+	0x03b9, 0xd827, 0xd801, 0x03b9, 0xd811, 0xd828, 0x03b9, 0xd827,
+	0xd828, 0x03b9, 0xd811, 0x03b9, 0xd827, 0x03b9, 0xd811, 0xd800,
+	0x03b9, 0xd827, 0xd800, 0x03b9, 0xd811, 0xd801, 0x03b9, 0xd827,
+	0xd801, 0x03b9, 0xd811, 0xd828, 0x03b9, 0xd827, 0xd828, 0x03bf,
+	0xd811, 0x03bf, 0xd827, 0x03bf, 0xd811, 0xd800, 0x03bf, 0xd827,
+	0xd800, 0x03bf, 0xd811, 0xd801, 0x03bf, 0xd827, 0xd801, 0x03bf,
+	0xd811, 0x03bf, 0xd827, 0x03bf, 0xd811, 0xd800, 0x03bf, 0xd827,
+	0xd800, 0x03bf, 0xd811, 0xd801, 0x03bf, 0xd827, 0xd801, 0x03c5,
+	0xd811, 0x03c5, 0xd827, 0x03c5, 0xd811, 0xd800, 0x03c5, 0xd827,
+	0xd800, 0x03c5, 0xd811, 0xd801, 0x03c5, 0xd827, 0xd801, 0x03c5,
+	0xd811, 0xd828, 0x03c5, 0xd827, 0xd828, 0x03c5, 0xd827, 0x03c5,
+	0xd827, 0xd800, 0x03c5, 0xd827, 0xd801, 0x03c5, 0xd827, 0xd828,
+	0x03c9, 0xd811, 0x03c9, 0xd827, 0x03c9, 0xd811, 0xd800, 0x03c9,
+	0xd827, 0xd800, 0x03c9, 0xd811, 0xd801, 0x03c9, 0xd827, 0xd801,
+	0x03c9, 0xd811, 0xd828, 0x03c9, 0xd827, 0xd828, 0x03c9, 0xd811,
+	0x03c9, 0xd827, 0x03c9, 0xd811, 0xd800, 0x03c9, 0xd827, 0xd800,
+	0x03c9, 0xd811, 0xd801, 0x03c9, 0xd827, 0xd801, 0x03c9, 0xd811,
+	0xd828, 0x03c9, 0xd827, 0xd828, 0x03b1, 0xd800, 0x03b1, 0xd801,
+	0x03b5, 0xd800, 0x03b5, 0xd801, 0x03b7, 0xd800, 0x03b7, 0xd801,
+	0x03b9, 0xd800, 0x03b9, 0xd801, 0x03bf, 0xd800, 0x03bf, 0xd801,
+	0x03c5, 0xd800, 0x03c5, 0xd801, 0x03c9, 0xd800, 0x03c9, 0xd801,
+	0x03b1, 0xd811, 0x03b9, 0x03b1, 0xd827, 0x03b9, 0x03b1, 0xd811,
+	0xd800, 0x03b9, 0x03b1, 0xd827, 0xd800, 0x03b9, 0x03b1, 0xd811,
+	0xd801, 0x03b9, 0x03b1, 0xd827, 0xd801, 0x03b9, 0x03b1, 0xd811,
+	0xd828, 0x03b9, 0x03b1, 0xd827, 0xd828, 0x03b9, 0x03b1, 0xd811,
+	0x03b9, 0x03b1, 0xd827, 0x03b9, 0x03b1, 0xd811, 0xd800, 0x03b9,
+	0x03b1, 0xd827, 0xd800, 0x03b9, 0x03b1, 0xd811, 0xd801, 0x03b9,
+	0x03b1, 0xd827, 0xd801, 0x03b9, 0x03b1, 0xd811, 0xd828, 0x03b9,
+	0x03b1, 0xd827, 0xd828, 0x03b9, 0x03b7, 0xd811, 0x03b9, 0x03b7,
+	0xd827, 0x03b9, 0x03b7, 0xd811, 0xd800, 0x03b9, 0x03b7, 0xd827,
+	0xd800, 0x03b9, 0x03b7, 0xd811, 0xd801, 0x03b9, 0x03b7, 0xd827,
+	0xd801, 0x03b9, 0x03b7, 0xd811, 0xd828, 0x03b9, 0x03b7, 0xd827,
+	0xd828, 0x03b9, 0x03b7, 0xd811, 0x03b9, 0x03b7, 0xd827, 0x03b9,
+	0x03b7, 0xd811, 0xd800, 0x03b9, 0x03b7, 0xd827, 0xd800, 0x03b9,
+	0x03b7, 0xd811, 0xd801, 0x03b9, 0x03b7, 0xd827, 0xd801, 0x03b9,
+	0x03b7, 0xd811, 0xd828, 0x03b9, 0x03b7, 0xd827, 0xd828, 0x03b9,
+	0x03c9, 0xd811, 0x03b9, 0x03c9, 0xd827, 0x03b9, 0x03c9, 0xd811,
+	0xd800, 0x03b9, 0x03c9, 0xd827, 0xd800, 0x03b9, 0x03c9, 0xd811,
+	0xd801, 0x03b9, 0x03c9, 0xd827, 0xd801, 0x03b9, 0x03c9, 0xd811,
+	0xd828, 0x03b9, 0x03c9, 0xd827, 0xd828, 0x03b9, 0x03c9, 0xd811,
+	0x03b9, 0x03c9, 0xd827, 0x03b9, 0x03c9, 0xd811, 0xd800, 0x03b9,
+	0x03c9, 0xd827, 0xd800, 0x03b9, 0x03c9, 0xd811, 0xd801, 0x03b9,
+	0x03c9, 0xd827, 0xd801, 0x03b9, 0x03c9, 0xd811, 0xd828, 0x03b9,
+	0x03c9, 0xd827, 0xd828, 0x03b9, 0x03b1, 0xd808, 0x03b1, 0xd807,
+	0x03b1, 0xd800, 0x03b9, 0x03b1, 0x03b9, 0x03b1, 0xd801, 0x03b9,
+	0x03b1, 0xd828, 0x03b1, 0xd828, 0x03b9, 0x03b1, 0xd808, 0x03b1,
+	0xd807, 0x03b1, 0xd800, 0x03b1, 0xd801, 0x03b1, 0x03b9, 0x03b9,
+	0x00a8, 0xd828, 0x03b7, 0xd800, 0x03b9, 0x03b7, 0x03b9, 0x03b7,
+	0xd801, 0x03b9, 0x03b7, 0xd828, 0x03b7, 0xd828, 0x03b9, 0x03b5,
+	0xd800, 0x03b5, 0xd801, 0x03b7, 0xd800, 0x03b7, 0xd801, 0x03b7,
+	0x03b9, 0x1fbf, 0xd800, 0x1fbf, 0xd801, 0x1fbf, 0xd828, 0x03b9,
+	0xd808, 0x03b9, 0xd807, 0x03b9, 0xd804, 0xd800, 0x03b9, 0xd804,
+	0xd801, 0x03b9, 0xd828, 0x03b9, 0xd804, 0xd828, 0x03b9, 0xd808,
+	0x03b9, 0xd807, 0x03b9, 0xd800, 0x03b9, 0xd801, 0x1ffe, 0xd800,
+	0x1ffe, 0xd801, 0x1ffe, 0xd828, 0x03c5, 0xd808, 0x03c5, 0xd807,
+	0x03c5, 0xd804, 0xd800, 0x03c5, 0xd804, 0xd801, 0x03c1, 0xd811,
+	0x03c1, 0xd827, 0x03c5, 0xd828, 0x03c5, 0xd804, 0xd828, 0x03c5,
+	0xd808, 0x03c5, 0xd807, 0x03c5, 0xd800, 0x03c5, 0xd801, 0x03c1,
+	0xd827, 0x00a8, 0xd800, 0x00a8, 0xd801, 0x0060, 0x03c9, 0xd800,
+	0x03b9, 0x03c9, 0x03b9, 0x03c9, 0xd801, 0x03b9, 0x03c9, 0xd828,
+	0x03c9, 0xd828, 0x03b9, 0x03bf, 0xd800, 0x03bf, 0xd801, 0x03c9,
+	0xd800, 0x03c9, 0xd801, 0x03c9, 0x03b9, 0x00b4, 0x2002, 0x2003,
+	0x03c9, 0x006b, 0x0061, 0xd805, 0x214e, 0x2170, 0x2171, 0x2172,
+	0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217a,
+	0x217b, 0x217c, 0x217d, 0x217e, 0x217f, 0x2184, 0x2190, 0xd82a,
+	0x2192, 0xd82a, 0x2194, 0xd82a, 0x21d0, 0xd82a, 0x21d4, 0xd82a,
+	0x21d2, 0xd82a, 0x2203, 0xd82a, 0x2208, 0xd82a, 0x220b, 0xd82a,
+	0x2223, 0xd82a, 0x2225, 0xd82a, 0x223c, 0xd82a, 0x2243, 0xd82a,
+	0x2245, 0xd82a, 0x2248, 0xd82a, 0x003d, 0xd82a, 0x2261, 0xd82a,
+	0x224d, 0xd82a, 0x003c, 0xd82a, 0x003e, 0xd82a, 0x2264, 0xd82a,
+	0x2265, 0xd82a, 0x2272, 0xd82a, 0x2273, 0xd82a, 0x2276, 0xd82a,
+	0x2277, 0xd82a, 0x227a, 0xd82a, 0x227b, 0xd82a, 0x2282, 0xd82a,
+	0x2283, 0xd82a, 0x2286, 0xd82a, 0x2287, 0xd82a, 0x22a2, 0xd82a,
+	0x22a8, 0xd82a, 0x22a9, 0xd82a, 0x22ab, 0xd82a, 0x227c, 0xd82a,
+	0x227d, 0xd82a, 0x2291, 0xd82a, 0x2292, 0xd82a, 0x22b2, 0xd82a,
+	0x22b3, 0xd82a, 0x22b4, 0xd82a, 0x22b5, 0xd82a, 0x3008, 0x3009,
+	0x24d0, 0x24d1, 0x24d2, 0x24d3, 0x24d4, 0x24d5, 0x24d6, 0x24d7,
+	0x24d8, 0x24d9, 0x24da, 0x24db, 0x24dc, 0x24dd, 0x24de, 0x24df,
+	0x24e0, 0x24e1, 0x24e2, 0x24e3, 0x24e4, 0x24e5, 0x24e6, 0x24e7,
+	0x24e8, 0x24e9, 0x2add, 0xd82a, 0x2c30, 0x2c31, 0x2c32, 0x2c33,
+	0x2c34, 0x2c35, 0x2c36, 0x2c37, 0x2c38, 0x2c39, 0x2c3a, 0x2c3b,
+	0x2c3c, 0x2c3d, 0x2c3e, 0x2c3f, 0x2c40, 0x2c41, 0x2c42, 0x2c43,
+	0x2c44, 0x2c45, 0x2c46, 0x2c47, 0x2c48, 0x2c49, 0x2c4a, 0x2c4b,
+	0x2c4c, 0x2c4d, 0x2c4e, 0x2c4f, 0x2c50, 0x2c51, 0x2c52, 0x2c53,
+	0x2c54, 0x2c55, 0x2c56, 0x2c57, 0x2c58, 0x2c59, 0x2c5a, 0x2c5b,
+	0x2c5c, 0x2c5d, 0x2c5e, 0x2c61, 0x026b, 0x1d7d, 0x027d, 0x2c68,
+	0x2c6a, 0x2c6c, 0x0251, 0x0271, 0x0250, 0x0252, 0x2c73, 0x2c76,
+	0x023f, 0x0240, 0x2c81, 0x2c83, 0x2c85, 0x2c87, 0x2c89, 0x2c8b,
+	0x2c8d, 0x2c8f, 0x2c91, 0x2c93, 0x2c95, 0x2c97, 0x2c99, 0x2c9b,
+	0x2c9d, 0x2c9f, 0x2ca1, 0x2ca3, 0x2ca5, 0x2ca7, 0x2ca9, 0x2cab,
+	0x2cad, 0x2caf, 0x2cb1, 0x2cb3, 0x2cb5, 0x2cb7, 0x2cb9, 0x2cbb,
+	0x2cbd, 0x2cbf, 0x2cc1, 0x2cc3, 0x2cc5, 0x2cc7, 0x2cc9, 0x2ccb,
+	0x2ccd, 0x2ccf, 0x2cd1, 0x2cd3, 0x2cd5, 0x2cd7, 0x2cd9, 0x2cdb,
+	0x2cdd, 0x2cdf, 0x2ce1, 0x2ce3, 0x2cec, 0x2cee, 0x2cf3, 0x304b,
+	0xd82b, 0x304d, 0xd82b, 0x304f, 0xd82b, 0x3051, 0xd82b, 0x3053,
+	0xd82b, 0x3055, 0xd82b, 0x3057, 0xd82b, 0x3059, 0xd82b, 0x305b,
+	0xd82b, 0x305d, 0xd82b, 0x305f, 0xd82b, 0x3061, 0xd82b, 0x3064,
+	0xd82b, 0x3066, 0xd82b, 0x3068, 0xd82b, 0x306f, 0xd82b, 0x306f,
+	0xd82c, 0x3072, 0xd82b, 0x3072, 0xd82c, 0x3075, 0xd82b, 0x3075,
+	0xd82c, 0x3078, 0xd82b, 0x3078, 0xd82c, 0x307b, 0xd82b, 0x307b,
+	0xd82c, 0x3046, 0xd82b, 0x309d, 0xd82b, 0x30ab, 0xd82b, 0x30ad,
+	0xd82b, 0x30af, 0xd82b, 0x30b1, 0xd82b, 0x30b3, 0xd82b, 0x30b5,
+	0xd82b, 0x30b7, 0xd82b, 0x30b9, 0xd82b, 0x30bb, 0xd82b, 0x30bd,
+	0xd82b, 0x30bf, 0xd82b, 0x30c1, 0xd82b, 0x30c4, 0xd82b, 0x30c6,
+	0xd82b, 0x30c8, 0xd82b, 0x30cf, 0xd82b, 0x30cf, 0xd82c, 0x30d2,
+	0xd82b, 0x30d2, 0xd82c, 0x30d5, 0xd82b, 0x30d5, 0xd82c, 0x30d8,
+	0xd82b, 0x30d8, 0xd82c, 0x30db, 0xd82b, 0x30db, 0xd82c, 0x30a6,
+	0xd82b, 0x30ef, 0xd82b, 0x30f0, 0xd82b, 0x30f1, 0xd82b, 0x30f2,
+	0xd82b, 0x30fd, 0xd82b, 0xa641, 0xa643, 0xa645, 0xa647, 0xa649,
+	0xa64b, 0xa64d, 0xa64f, 0xa651, 0xa653, 0xa655, 0xa657, 0xa659,
+	0xa65b, 0xa65d, 0xa65f, 0xa661, 0xa663, 0xa665, 0xa667, 0xa669,
+	0xa66b, 0xa66d, 0xa681, 0xa683, 0xa685, 0xa687, 0xa689, 0xa68b,
+	0xa68d, 0xa68f, 0xa691, 0xa693, 0xa695, 0xa697, 0xa699, 0xa69b,
+	0xa723, 0xa725, 0xa727, 0xa729, 0xa72b, 0xa72d, 0xa72f, 0xa733,
+	0xa735, 0xa737, 0xa739, 0xa73b, 0xa73d, 0xa73f, 0xa741, 0xa743,
+	0xa745, 0xa747, 0xa749, 0xa74b, 0xa74d, 0xa74f, 0xa751, 0xa753,
+	0xa755, 0xa757, 0xa759, 0xa75b, 0xa75d, 0xa75f, 0xa761, 0xa763,
+	0xa765, 0xa767, 0xa769, 0xa76b, 0xa76d, 0xa76f, 0xa77a, 0xa77c,
+	0x1d79, 0xa77f, 0xa781, 0xa783, 0xa785, 0xa787, 0xa78c, 0x0265,
+	0xa791, 0xa793, 0xa797, 0xa799, 0xa79b, 0xa79d, 0xa79f, 0xa7a1,
+	0xa7a3, 0xa7a5, 0xa7a7, 0xa7a9, 0x0266, 0x025c, 0x0261, 0x026c,
+	0x026a, 0x029e, 0x0287, 0x029d, 0xab53, 0xa7b5, 0xa7b7, 0x13a0,
+	0x13a1, 0x13a2, 0x13a3, 0x13a4, 0x13a5, 0x13a6, 0x13a7, 0x13a8,
+	0x13a9, 0x13aa, 0x13ab, 0x13ac, 0x13ad, 0x13ae, 0x13af, 0x13b0,
+	0x13b1, 0x13b2, 0x13b3, 0x13b4, 0x13b5, 0x13b6, 0x13b7, 0x13b8,
+	0x13b9, 0x13ba, 0x13bb, 0x13bc, 0x13bd, 0x13be, 0x13bf, 0x13c0,
+	0x13c1, 0x13c2, 0x13c3, 0x13c4, 0x13c5, 0x13c6, 0x13c7, 0x13c8,
+	0x13c9, 0x13ca, 0x13cb, 0x13cc, 0x13cd, 0x13ce, 0x13cf, 0x13d0,
+	0x13d1, 0x13d2, 0x13d3, 0x13d4, 0x13d5, 0x13d6, 0x13d7, 0x13d8,
+	0x13d9, 0x13da, 0x13db, 0x13dc, 0x13dd, 0x13de, 0x13df, 0x13e0,
+	0x13e1, 0x13e2, 0x13e3, 0x13e4, 0x13e5, 0x13e6, 0x13e7, 0x13e8,
+	0x13e9, 0x13ea, 0x13eb, 0x13ec, 0x13ed, 0x13ee, 0x13ef, 0x8c48,
+	0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5, 0x9f9c, 0x9f9c,
+	0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85, 0x863f,
+	0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9, 0x73de, 0x843d,
+	0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04, 0x721b, 0x862d, 0x9e1e,
+	0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8, 0x881f, 0x5eca,
+	0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7, 0x52de, 0x64c4,
+	0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c, 0x8def, 0x9732,
+	0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304, 0x9e7f,
+	0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e, 0x7262, 0x78ca, 0x8cc2,
+	0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f, 0x7d2f, 0x7e37,
+	0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c, 0x7dbe, 0x83f1,
+	0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39, 0x5be7, 0x6012,
+	0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9, 0x4e0d, 0x6ccc,
+	0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449, 0x8aaa, 0x6bba,
+	0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565, 0x4eae, 0x5169,
+	0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf, 0x52f5, 0x5442,
+	0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a, 0x9e97,
+	0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74, 0x6190, 0x6200,
+	0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4, 0x806f, 0x8f26,
+	0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd, 0x70c8, 0x88c2,
+	0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e, 0x7375, 0x4ee4,
+	0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046,
+	0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8,
+	0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f, 0x6599, 0x6a02, 0x71ce,
+	0x7642, 0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e, 0x5289, 0x677b,
+	0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b, 0x7d10, 0x985e,
+	0x516d, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a, 0x5f8b,
+	0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f, 0x5c65, 0x6613,
+	0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2, 0x7f79, 0x88cf, 0x88e1,
+	0x91cc, 0x96e2, 0x533f, 0x6eba, 0x541d, 0x71d0, 0x7498, 0x85fa,
+	0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8, 0x7acb, 0x7b20,
+	0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a, 0x5207,
+	0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b, 0x884c,
+	0x964d, 0x898b, 0x5ed3, 0x5140, 0x55c0, 0x585a, 0x6674, 0x51de,
+	0x732a, 0x76ca, 0x793c, 0x795e, 0x7965, 0x798f, 0x9756, 0x7cbe,
+	0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef, 0x98fc, 0x9928,
+	0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d, 0x52c9, 0x52e4,
+	0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8, 0x5c64, 0x5c6e,
+	0x6094, 0x6168, 0x618e, 0x61f2, 0x654f, 0x65e2, 0x6691, 0x6885,
+	0x6d77, 0x6e1a, 0x6f22, 0x716e, 0x722b, 0x7422, 0x7891, 0x793e,
+	0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d, 0x798e, 0x7a40,
+	0x7a81, 0x7bc0, 0x7df4, 0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed,
+	0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3,
+	0x8d08, 0x8fb6, 0x9038, 0x96e3, 0x97ff, 0x983b, 0x6075, 0xd82d,
+	0x8218, 0x4e26, 0x51b5, 0x5168, 0x4f80, 0x5145, 0x5180, 0x52c7,
+	0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2, 0x585a, 0x58b3, 0x5944,
+	0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad, 0x60d8,
+	0x614e, 0x6108, 0x618e, 0x6160, 0x61f2, 0x6234, 0x63c4, 0x641c,
+	0x6452, 0x6556, 0x6674, 0x6717, 0x671b, 0x6756, 0x6b79, 0x6bba,
+	0x6d41, 0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e, 0x77a7, 0x7235,
+	0x72af, 0x732a, 0x7471, 0x7506, 0x753b, 0x761d, 0x761f, 0x76ca,
+	0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1, 0x7bc0, 0x7c7b,
+	0x7d5b, 0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef, 0x8779, 0x8941,
+	0x8986, 0x8996, 0x8abf, 0x8af8, 0x8acb, 0x8b01, 0x8afe, 0x8aed,
+	0x8b39, 0x8b8a, 0x8d08, 0x8f38, 0x9072, 0x9199, 0x9276, 0x967c,
+	0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b, 0x9b12, 0x9f9c,
+	0xd82e, 0xd82f, 0xd830, 0x3b9d, 0x4018, 0x4039, 0xd831, 0xd832,
+	0xd833, 0x9f43, 0x9f8e, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066,
+	0x006c, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006c, 0x0073,
+	0x0074, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574,
+	0x056b, 0x057e, 0x0576, 0x0574, 0x056d, 0x05d9, 0xd834, 0x05f2,
+	0xd835, 0x05e9, 0xd836, 0x05e9, 0xd837, 0x05e9, 0xd838, 0xd836,
+	0x05e9, 0xd838, 0xd837, 0x05d0, 0xd835, 0x05d0, 0xd839, 0x05d0,
+	0xd838, 0x05d1, 0xd838, 0x05d2, 0xd838, 0x05d3, 0xd838, 0x05d4,
+	0xd838, 0x05d5, 0xd838, 0x05d6, 0xd838, 0x05d8, 0xd838, 0x05d9,
+	0xd838, 0x05da, 0xd838, 0x05db, 0xd838, 0x05dc, 0xd838, 0x05de,
+	0xd838, 0x05e0, 0xd838, 0x05e1, 0xd838, 0x05e3, 0xd838, 0x05e4,
+	0xd838, 0x05e6, 0xd838, 0x05e7, 0xd838, 0x05e8, 0xd838, 0x05e9,
+	0xd838, 0x05ea, 0xd838, 0x05d5, 0xd83a, 0x05d1, 0xd83b, 0x05db,
+	0xd83b, 0x05e4, 0xd83b, 0xff41, 0xff42, 0xff43, 0xff44, 0xff45,
+	0xff46, 0xff47, 0xff48, 0xff49, 0xff4a, 0xff4b, 0xff4c, 0xff4d,
+	0xff4e, 0xff4f, 0xff50, 0xff51, 0xff52, 0xff53, 0xff54, 0xff55,
+	0xff56, 0xff57, 0xff58, 0xff59, 0xff5a, 0xd8be, 0xd8bf, 0xd8c0,
+	0xd8c1, 0xd8c2, 0xd8c3, 0xd8c4, 0xd8c5, 0xd8c6, 0xd8c7, 0xd8c8,
+	0xd8c9, 0xd8ca, 0xd8cb, 0xd8cc, 0xd8cd, 0xd8ce, 0xd8cf, 0xd8d0,
+	0xd8d1, 0xd8d2, 0xd8d3, 0xd8d4, 0xd8d5, 0xd8d6, 0xd8d7, 0xd8d8,
+	0xd8d9, 0xd8da, 0xd8db, 0xd8dc, 0xd8dd, 0xd8de, 0xd8df, 0xd8e0,
+	0xd8e1, 0xd8e2, 0xd8e3, 0xd8e4, 0xd8e5, 0xd8e6, 0xd8e7, 0xd8e8,
+	0xd8e9, 0xd8ea, 0xd8eb, 0xd8ec, 0xd8ed, 0xd8ee, 0xd8ef, 0xd8f0,
+	0xd8f1, 0xd8f2, 0xd8f3, 0xd8f4, 0xd8f5, 0xd8f6, 0xd8f7, 0xd8f8,
+	0xd8f9, 0xd8fa, 0xd8fb, 0xd8fc, 0xd8fd, 0xd8fe, 0xd8ff, 0xd900,
+	0xd901, 0xd902, 0xd903, 0xd904, 0xd905, 0xd906, 0xd907, 0xd908,
+	0xd909, 0xd90a, 0xd90b, 0xd90c, 0xd90d, 0xd90e, 0xd90f, 0xd910,
+	0xd911, 0xd912, 0xd913, 0xd914, 0xd915, 0xd916, 0xd917, 0xd918,
+	0xd919, 0xd91a, 0xd91b, 0xd91c, 0xd91d, 0xd91e, 0xd91f, 0xd920,
+	0xd921, 0xd922, 0xd923, 0xd924, 0xd925, 0xd926, 0xd927, 0xd928,
+	0xd929, 0xd92a, 0xd92b, 0xd92c, 0xd92d, 0xd92e, 0xd92f, 0xd930,
+	0xd931, 0xd932, 0xd933, 0xd934, 0xd935, 0xd936, 0xd937, 0xd938,
+	0xd939, 0xd93a, 0xd93b, 0xd93c, 0xd83c, 0xd83d, 0xd83e, 0xd83d,
+	0xd83f, 0xd83d, 0xd840, 0xd841, 0xd842, 0xd841, 0xd843, 0xd844,
+	0xd843, 0xd845, 0xd846, 0xd847, 0xd846, 0xd848, 0xd846, 0xd849,
+	0xd84a, 0xd84b, 0xd84c, 0xd84b, 0xd93d, 0xd93e, 0xd93f, 0xd940,
+	0xd941, 0xd942, 0xd943, 0xd944, 0xd945, 0xd946, 0xd947, 0xd948,
+	0xd949, 0xd94a, 0xd94b, 0xd94c, 0xd94d, 0xd94e, 0xd94f, 0xd950,
+	0xd951, 0xd952, 0xd953, 0xd954, 0xd955, 0xd956, 0xd957, 0xd958,
+	0xd959, 0xd95a, 0xd95b, 0xd95c, 0xd84d, 0xd84e, 0xd84f, 0xd84e,
+	0xd84f, 0xd84e, 0xd850, 0xd84f, 0xd84e, 0xd851, 0xd84f, 0xd84e,
+	0xd852, 0xd84f, 0xd84e, 0xd853, 0xd84f, 0xd84e, 0xd854, 0xd855,
+	0xd84e, 0xd856, 0xd84e, 0xd855, 0xd84e, 0xd850, 0xd856, 0xd84e,
+	0xd850, 0xd855, 0xd84e, 0xd851, 0xd856, 0xd84e, 0xd851, 0xd95d,
+	0xd95e, 0xd95f, 0xd960, 0xd961, 0xd962, 0xd963, 0xd964, 0xd965,
+	0xd966, 0xd967, 0xd968, 0xd969, 0xd96a, 0xd96b, 0xd96c, 0xd96d,
+	0xd96e, 0xd96f, 0xd970, 0xd971, 0xd972, 0xd973, 0xd974, 0xd975,
+	0xd976, 0xd977, 0xd978, 0xd979, 0xd97a, 0xd97b, 0xd97c, 0xd97d,
+	0xd97e, 0x4e3d, 0x4e38, 0x4e41, 0xd857, 0x4f60, 0x4fae, 0x4fbb,
+	0x5002, 0x507a, 0x5099, 0x50e7, 0x50cf, 0x349e, 0xd858, 0x514d,
+	0x5154, 0x5164, 0x5177, 0xd859, 0x34b9, 0x5167, 0x518d, 0xd85a,
+	0x5197, 0x51a4, 0x4ecc, 0x51ac, 0x51b5, 0xd85b, 0x51f5, 0x5203,
+	0x34df, 0x523b, 0x5246, 0x5272, 0x5277, 0x3515, 0x52c7, 0x52c9,
+	0x52e4, 0x52fa, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535a,
+	0x5373, 0x537d, 0x537f, 0x537f, 0x537f, 0xd85c, 0x7070, 0x53ca,
+	0x53df, 0xd85d, 0x53eb, 0x53f1, 0x5406, 0x549e, 0x5438, 0x5448,
+	0x5468, 0x54a2, 0x54f6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584,
+	0x5599, 0x55ab, 0x55b3, 0x55c2, 0x5716, 0x5606, 0x5717, 0x5651,
+	0x5674, 0x5207, 0x58ee, 0x57ce, 0x57f4, 0x580d, 0x578b, 0x5832,
+	0x5831, 0x58ac, 0xd85e, 0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922,
+	0x5962, 0xd85f, 0xd860, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66,
+	0x36ee, 0x36fc, 0x5b08, 0x5b3e, 0x5b3e, 0xd861, 0x5bc3, 0x5bd8,
+	0x5be7, 0x5bf3, 0xd862, 0x5bff, 0x5c06, 0x5f53, 0x5c22, 0x3781,
+	0x5c60, 0x5c6e, 0x5cc0, 0x5c8d, 0xd863, 0x5d43, 0xd864, 0x5d6e,
+	0x5d6b, 0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d,
+	0x5e69, 0x3862, 0xd865, 0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca,
+	0xd866, 0x5efe, 0xd867, 0xd867, 0x8201, 0x5f22, 0x5f22, 0x38c7,
+	0xd868, 0xd869, 0x5f62, 0x5f6b, 0x38e3, 0x5f9a, 0x5fcd, 0x5fd7,
+	0x5ff9, 0x6081, 0x393a, 0x391c, 0x6094, 0xd86a, 0x60c7, 0x6148,
+	0x614c, 0x614e, 0x614c, 0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af,
+	0x61de, 0x61f2, 0x61f6, 0x6210, 0x621b, 0x625d, 0x62b1, 0x62d4,
+	0x6350, 0xd86b, 0x633d, 0x62fc, 0x6368, 0x6383, 0x63e4, 0xd86c,
+	0x6422, 0x63c5, 0x63a9, 0x3a2e, 0x6469, 0x647e, 0x649d, 0x6477,
+	0x3a6c, 0x654f, 0x656c, 0xd86d, 0x65e3, 0x66f8, 0x6649, 0x3b19,
+	0x6691, 0x3b08, 0x3ae4, 0x5192, 0x5195, 0x6700, 0x669c, 0x80ad,
+	0x43d9, 0x6717, 0x671b, 0x6721, 0x675e, 0x6753, 0xd86e, 0x3b49,
+	0x67fa, 0x6785, 0x6852, 0x6885, 0xd86f, 0x688e, 0x681f, 0x6914,
+	0x3b9d, 0x6942, 0x69a3, 0x69ea, 0x6aa8, 0xd870, 0x6adb, 0x3c18,
+	0x6b21, 0xd871, 0x6b54, 0x3c4e, 0x6b72, 0x6b9f, 0x6bba, 0x6bbb,
+	0xd872, 0xd873, 0xd874, 0x6c4e, 0xd875, 0x6cbf, 0x6ccd, 0x6c67,
+	0x6d16, 0x6d3e, 0x6d77, 0x6d41, 0x6d69, 0x6d78, 0x6d85, 0xd876,
+	0x6d34, 0x6e2f, 0x6e6e, 0x3d33, 0x6ecb, 0x6ec7, 0xd877, 0x6df9,
+	0x6f6e, 0xd878, 0xd879, 0x6fc6, 0x7039, 0x701e, 0x701b, 0x3d96,
+	0x704a, 0x707d, 0x7077, 0x70ad, 0xd87a, 0x7145, 0xd87b, 0x719c,
+	0xd87c, 0x7228, 0x7235, 0x7250, 0xd87d, 0x7280, 0x7295, 0xd87e,
+	0xd87f, 0x737a, 0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x3eb8, 0x7447,
+	0x745c, 0x7471, 0x7485, 0x74ca, 0x3f1b, 0x7524, 0xd880, 0x753e,
+	0xd881, 0x7570, 0xd882, 0x7610, 0xd883, 0xd884, 0xd885, 0x3ffc,
+	0x4008, 0x76f4, 0xd886, 0xd887, 0xd888, 0xd889, 0x771e, 0x771f,
+	0x771f, 0x774a, 0x4039, 0x778b, 0x4046, 0x4096, 0xd88a, 0x784e,
+	0x788c, 0x78cc, 0x40e3, 0xd88b, 0x7956, 0xd88c, 0xd88d, 0x798f,
+	0x79eb, 0x412f, 0x7a40, 0x7a4a, 0x7a4f, 0xd88e, 0xd88f, 0xd88f,
+	0x7aee, 0x4202, 0xd890, 0x7bc6, 0x7bc9, 0x4227, 0xd891, 0x7cd2,
+	0x42a0, 0x7ce8, 0x7ce3, 0x7d00, 0xd892, 0x7d63, 0x4301, 0x7dc7,
+	0x7e02, 0x7e45, 0x4334, 0xd893, 0xd894, 0x4359, 0xd895, 0x7f7a,
+	0xd896, 0x7f95, 0x7ffa, 0x8005, 0xd897, 0xd898, 0x8060, 0xd899,
+	0x8070, 0xd89a, 0x43d5, 0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5,
+	0xd89b, 0xd89c, 0xd89d, 0xd89e, 0x8201, 0x8204, 0x8f9e, 0x446b,
+	0x8291, 0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3, 0x82bd, 0x82e6,
+	0xd89f, 0x82e5, 0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7,
+	0x8457, 0x8353, 0x83ca, 0x83cc, 0x83dc, 0xd8a0, 0xd8a1, 0xd8a2,
+	0x452b, 0x84f1, 0x84f3, 0x8516, 0xd8a3, 0x8564, 0xd8a4, 0x455d,
+	0x4561, 0xd8a5, 0xd8a6, 0x456b, 0x8650, 0x865c, 0x8667, 0x8669,
+	0x86a9, 0x8688, 0x870e, 0x86e2, 0x8779, 0x8728, 0x876b, 0x8786,
+	0x45d7, 0x87e1, 0x8801, 0x45f9, 0x8860, 0x8863, 0xd8a7, 0x88d7,
+	0x88de, 0x4635, 0x88fa, 0x34bb, 0xd8a8, 0xd8a9, 0x46be, 0x46c7,
+	0x8aa0, 0x8aed, 0x8b8a, 0x8c55, 0xd8aa, 0x8cab, 0x8cc1, 0x8d1b,
+	0x8d77, 0xd8ab, 0xd8ac, 0x8dcb, 0x8dbc, 0x8df0, 0xd8ad, 0x8ed4,
+	0x8f38, 0xd8ae, 0xd8af, 0x9094, 0x90f1, 0x9111, 0xd8b0, 0x911b,
+	0x9238, 0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0xd8b1, 0x958b,
+	0x4995, 0x95b7, 0xd8b2, 0x49e6, 0x96c3, 0x5db2, 0x9723, 0xd8b3,
+	0xd8b4, 0x4a6e, 0x4a76, 0x97e0, 0xd8b5, 0x4ab2, 0xd8b6, 0x980b,
+	0x980b, 0x9829, 0xd8b7, 0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2,
+	0x99fe, 0x4bce, 0xd8b8, 0x9b12, 0x9c40, 0x9cfd, 0x4cce, 0x4ced,
+	0x9d67, 0xd8b9, 0x4cf8, 0xd8ba, 0xd8bb, 0xd8bc, 0x9ebb, 0x4d56,
+	0x9ef9, 0x9efe, 0x9f05, 0x9f0f, 0x9f16, 0x9f3b, 0xd8bd,
+};
+
+static const u32 apfs_nfdcf_esc[] __aligned(64) = {
+	0x00000000,
+};
+
+static const u32 apfs_value_wide[] __aligned(64) = {
+	0xe6000300, 0xe6000301, 0xe6000302, 0xe6000303, 0xe6000308, 0xe600030a,
+	0xca000327, 0xe6000304, 0xe6000306, 0xca000328, 0xe6000307, 0xe600030c,
+	0xe600030b, 0xd800031b, 0xe600030f, 0xe6000311, 0xdc000326, 0xe6000313,
+	0xe6000653, 0xe6000654, 0xdc000655, 0x0700093c, 0x070009bc, 0x07000a3c,
+	0x07000b3c, 0x5b000c56, 0x09000dca, 0x81000f71, 0x82000f72, 0x84000f74,
+	0x82000f80, 0xdc000325, 0xdc000323, 0xdc000331, 0xdc00032d, 0xdc000330,
+	0xdc00032e, 0xdc000324, 0xe6000309, 0xe6000314, 0xe6000342, 0xf0000345,
+	0x01000338, 0x08003099, 0x0800309a, 0x000242ee, 0x0002284a, 0x00022844,
+	0x000233d5, 0x00025249, 0x00025cd0, 0x00027ed3, 0x0e0005b4, 0x110005b7,
+	0x180005c1, 0x190005c2, 0x150005bc, 0x120005b8, 0x130005b9, 0x170005bf,
+	0x00011099, 0x070110ba, 0x0001109b, 0x000110a5, 0x00011131, 0x00011127,
+	0x00011132, 0x00011347, 0x0001133e, 0x00011357, 0x000114b9, 0x000114ba,
+	0x000114b0, 0x000114bd, 0x000115b8, 0x000115af, 0x000115b9, 0x0001d157,
+	0xd801d165, 0x0001d158, 0xd801d16e, 0xd801d16f, 0xd801d170, 0xd801d171,
+	0xd801d172, 0x0001d1b9, 0x0001d1ba, 0x00020122, 0x0002063a, 0x0002051c,
+	0x0002054b, 0x000291df, 0x00020a2c, 0x00020b63, 0x000214e4, 0x000216a8,
+	0x000216ea, 0x000219c8, 0x00021b18, 0x00021de4, 0x00021de6, 0x00022183,
+	0x0002a392, 0x00022331, 0x000232b8, 0x000261da, 0x000226d4, 0x00022b0c,
+	0x00022bf1, 0x0002300a, 0x000233c3, 0x0002346d, 0x000236a3, 0x000238a7,
+	0x00023a8d, 0x00021d0b, 0x00023afa, 0x00023cbc, 0x00023d1e, 0x00023ed1,
+	0x00023f5e, 0x00023f8e, 0x00020525, 0x00024263, 0x000243ab, 0x00024608,
+	0x00024735, 0x00024814, 0x00024c36, 0x00024c92, 0x0002219f, 0x00024fa1,
+	0x00024fb8, 0x00025044, 0x000250f3, 0x000250f2, 0x00025119, 0x00025133,
+	0x0002541d, 0x00025626, 0x0002569a, 0x000256c5, 0x0002597c, 0x00025aa7,
+	0x00025bab, 0x00025c80, 0x00025f86, 0x00026228, 0x00026247, 0x000262d9,
+	0x0002633e, 0x000264da, 0x00026523, 0x000265a8, 0x0002335f, 0x000267a7,
+	0x000267b5, 0x00023393, 0x0002339c, 0x00026b3c, 0x00026c36, 0x00026d6b,
+	0x00026cd5, 0x000273ca, 0x00026f2c, 0x00026fb1, 0x000270d2, 0x00027667,
+	0x000278ae, 0x00027966, 0x00027ca8, 0x00027f2f, 0x00020804, 0x000208de,
+	0x000285d2, 0x000285ed, 0x0002872e, 0x00028bfa, 0x00028d77, 0x00029145,
+	0x0002921a, 0x0002940a, 0x00029496, 0x000295b6, 0x00029b30, 0x0002a0ce,
+	0x0002a105, 0x0002a20e, 0x0002a291, 0x0002a600, 0x00010428, 0x00010429,
+	0x0001042a, 0x0001042b, 0x0001042c, 0x0001042d, 0x0001042e, 0x0001042f,
+	0x00010430, 0x00010431, 0x00010432, 0x00010433, 0x00010434, 0x00010435,
+	0x00010436, 0x00010437, 0x00010438, 0x00010439, 0x0001043a, 0x0001043b,
+	0x0001043c, 0x0001043d, 0x0001043e, 0x0001043f, 0x00010440, 0x00010441,
+	0x00010442, 0x00010443, 0x00010444, 0x00010445, 0x00010446, 0x00010447,
+	0x00010448, 0x00010449, 0x0001044a, 0x0001044b, 0x0001044c, 0x0001044d,
+	0x0001044e, 0x0001044f, 0x000104d8, 0x000104d9, 0x000104da, 0x000104db,
+	0x000104dc, 0x000104dd, 0x000104de, 0x000104df, 0x000104e0, 0x000104e1,
+	0x000104e2, 0x000104e3, 0x000104e4, 0x000104e5, 0x000104e6, 0x000104e7,
+	0x000104e8, 0x000104e9, 0x000104ea, 0x000104eb, 0x000104ec, 0x000104ed,
+	0x000104ee, 0x000104ef, 0x000104f0, 0x000104f1, 0x000104f2, 0x000104f3,
+	0x000104f4, 0x000104f5, 0x000104f6, 0x000104f7, 0x000104f8, 0x000104f9,
+	0x000104fa, 0x000104fb, 0x00010cc0, 0x00010cc1, 0x00010cc2, 0x00010cc3,
+	0x00010cc4, 0x00010cc5, 0x00010cc6, 0x00010cc7, 0x00010cc8, 0x00010cc9,
+	0x00010cca, 0x00010ccb, 0x00010ccc, 0x00010ccd, 0x00010cce, 0x00010ccf,
+	0x00010cd0, 0x00010cd1, 0x00010cd2, 0x00010cd3, 0x00010cd4, 0x00010cd5,
+	0x00010cd6, 0x00010cd7, 0x00010cd8, 0x00010cd9, 0x00010cda, 0x00010cdb,
+	0x00010cdc, 0x00010cdd, 0x00010cde, 0x00010cdf, 0x00010ce0, 0x00010ce1,
+	0x00010ce2, 0x00010ce3, 0x00010ce4, 0x00010ce5, 0x00010ce6, 0x00010ce7,
+	0x00010ce8, 0x00010ce9, 0x00010cea, 0x00010ceb, 0x00010cec, 0x00010ced,
+	0x00010cee, 0x00010cef, 0x00010cf0, 0x00010cf1, 0x00010cf2, 0x000118c0,
+	0x000118c1, 0x000118c2, 0x000118c3, 0x000118c4, 0x000118c5, 0x000118c6,
+	0x000118c7, 0x000118c8, 0x000118c9, 0x000118ca, 0x000118cb, 0x000118cc,
+	0x000118cd, 0x000118ce, 0x000118cf, 0x000118d0, 0x000118d1, 0x000118d2,
+	0x000118d3, 0x000118d4, 0x000118d5, 0x000118d6, 0x000118d7, 0x000118d8,
+	0x000118d9, 0x000118da, 0x000118db, 0x000118dc, 0x000118dd, 0x000118de,
+	0x000118df, 0x0001e922, 0x0001e923, 0x0001e924, 0x0001e925, 0x0001e926,
+	0x0001e927, 0x0001e928, 0x0001e929, 0x0001e92a, 0x0001e92b, 0x0001e92c,
+	0x0001e92d, 0x0001e92e, 0x0001e92f, 0x0001e930, 0x0001e931, 0x0001e932,
+	0x0001e933, 0x0001e934, 0x0001e935, 0x0001e936, 0x0001e937, 0x0001e938,
+	0x0001e939, 0x0001e93a, 0x0001e93b, 0x0001e93c, 0x0001e93d, 0x0001e93e,
+	0x0001e93f, 0x0001e940, 0x0001e941, 0x0001e942, 0x0001e943,
+};
+
+static const u8 apfs_qc_planes[] __aligned(64) = {
+	0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const u8 apfs_qc_blocks[][256] __aligned(64) = {
+	{
+		  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+		 16,  17,  17,  18,  17,  17,  17,  19,  20,  21,  22,  23,  24,  25,  26,  27,
+		 28,  29,  30,  31,  32,  17,  17,  17,  17,  17,  33,  17,  34,  35,  17,  17,
+		 36,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  37,  38,  39,  40,  41,  42,  43,  43,  43,  43,
+		 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+		 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+		 43,  43,  43,  43,  43,  43,  43,  44,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  43,  45,  46,  17,  17,  47,  48,
+	},
+	{
+		 17,  49,  50,  51,  52,  17,  17,  17,  17,  17,  53,  17,  54,  17,  17,  17,
+		 55,  56,  57,  58,  59,  60,  61,  62,  63,  17,  17,  17,  64,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  65,  66,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  67,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  68,  69,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 70,  17,  17,  17,  17,  17,  17,  17,  71,  72,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+	},
+	{
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  43,  43,  73,  17,  17,  17,  17,  17,
+	},
+	{
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+	},
+};
+
+static const u32 apfs_qc_leaves[][16] __aligned(64) = {
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0x55555557, 0xffd55555, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfffff7ff,
+		0x00001000, 0x5001c001, 0x00003000, 0x3003c003,
+	},
+	{
+		0x00000000, 0x0000000d, 0x0000d000, 0x400300dc,
+		0x00d40037, 0x000000d0, 0x0000d000, 0x40000000,
+		0x5f575dd7, 0x75fd5d75, 0x1df75dd0, 0xfdfd7754,
+		0x035d75ff, 0x0c000000, 0x00000d00, 0x000050d4,
+	},
+	{
+		0x00000000, 0x0d000000, 0x00000ddd, 0xd75fff00,
+		0xddddd577, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xc0000000, 0x00000000, 0x00000000, 0x4fffdcdd,
+		0x0cc003ff, 0x55555554, 0x00055575, 0xfffffffc,
+		0x400fffdf, 0xddddd435, 0xdddddddd, 0x57d775f5,
+	},
+	{
+		0x40551510, 0x55515555, 0x55555555, 0xfff3ffff,
+		0xffffffff, 0xc0ff3f30, 0xdddddddd, 0xdddd0ddd,
+		0xdddf003d, 0xdddddddd, 0xdddddddd, 0xdddddddd,
+		0xf7777741, 0x000d0d00, 0x000d000d, 0xddd0d000,
+	},
+	{
+		0xdddddddd, 0xdddddddd, 0xdddddddd, 0x55555557,
+		0x55555555, 0xffffd555, 0xffffffff, 0xffffffff,
+		0xffff7fff, 0x00000003, 0x00000000, 0x30000000,
+		0xffff30c3, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffc00000, 0xffffc00f, 0xffffffff,
+		0x003fffff, 0x00000000, 0xffffffff, 0xfffffffc,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffcc, 0x3c000f3f, 0xf00c3c00, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xfffffff3, 0xffffffff, 0x00000000,
+		0xffc00000, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0x003fffff, 0xffffff00,
+	},
+	{
+		0xffffffff, 0x00300fff, 0xf0030300, 0xffffffff,
+		0xffffffff, 0xff03ffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0x000000ff, 0x00000030, 0x00000000,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xfff3ffff, 0xfcfffcf3,
+		0xf3ffffff, 0x0000fc03, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf03fffff, 0x30ffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffcf3f,
+		0xf3ffffff, 0xcf03ffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf3ffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf03cffff, 0xf0ffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xfffffcff, 0xffffffff, 0xffffffff,
+		0xf00fffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xf3fcffff, 0xffffc3ff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf30c3ffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xf00fffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffcfffff, 0xc0cfffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffc0ffff,
+		0xff00ffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfff0ffff,
+		0xff00ffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xfff0ffff, 0xffffffff, 0xfff333ff,
+		0xf3ffff3f, 0xfcff3fcf, 0xfff3ffff, 0xf00cc003,
+		0xffff0c00, 0xf3ffff3f, 0xfcff3fcf, 0xfff3ffff,
+		0xffffcfff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffcfff, 0xffc33fff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xf3ffffff, 0xffffffff, 0x55555555, 0x55555555,
+		0xf7ff7555, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0x03ffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xf555ffff,
+	},
+	{
+		0xffffffff, 0xfffffcff, 0xffffffff, 0xfffffcff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xf3ffffcf, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xfff3ffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xff03ffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xfffc3fff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xfffffffc, 0x3c0003ff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xf0000000,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xcccccfff, 0xffffffcf, 0xffffffff, 0xf33ffcff,
+		0xfffffc30, 0xffffffff, 0x003fffff, 0xffffff00,
+		0xffffffff, 0xffffffff, 0xff0fffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffcfff, 0xffffff0f,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffff3fff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xfffd5555, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0x000000c0, 0xf3fc000c, 0xfff0fcff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0x00000000, 0x00000000, 0x00000000, 0x003ff000,
+	},
+	{
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0xdf100000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0xddd00000,
+	},
+	{
+		0x00000000, 0xf000f000, 0x00000000, 0x00000000,
+		0xf000f000, 0x33330000, 0x00000000, 0xf0000000,
+		0x00000000, 0x00000000, 0x00000000, 0xcc000c00,
+		0x00000c03, 0x03000f00, 0x00000000, 0xf0000c0f,
+	},
+	{
+		0xfffffff0, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xfc000000, 0x000003f3, 0xfffffffc,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xff0fcfff, 0xffffffdf,
+		0xffffffff, 0xffffffff, 0x55555555, 0xffffffff,
+		0xffffff7f, 0xff0fffff, 0xcfffffff, 0xffffffff,
+		0x03ffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xfcf3fcff, 0xffffffff, 0xffffccff, 0xffffffff,
+		0xfff33cf3, 0xffffffff, 0x03ffffcc, 0xfff0f0f0,
+		0xfff0f0f0, 0xffffffff, 0x00ffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xf00fff00, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffc3ffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x55555fff,
+		0x55555555, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x55555555, 0x55555555, 0xd5555555, 0xffffffff,
+		0xffffffff, 0xffffffff, 0x57777d5d, 0x5ffff7dd,
+		0xdddddddd, 0xdddddddd, 0xdddddddd, 0xdddddddd,
+		0xdddddddd, 0xdddddddd, 0x377fffdd, 0xffffffd0,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+	},
+	{
+		0xffffffff, 0xffffffff, 0x000fffff, 0xffffffff,
+		0xccffffff, 0xcccccccc, 0xfff333cc, 0xf0c30c30,
+		0xffffffff, 0xcfc3fcff, 0xccffffff, 0xcccccccc,
+		0xfff333cc, 0xf0c30c30, 0xffffffff, 0xcfc03cff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xdddddddd, 0xdddddddd, 0x3ddddddd, 0xf00000ff,
+		0xdddddddd, 0x0fdddddd, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfffffff0,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xdddddddf, 0xdddddddf,
+		0xdddddddd, 0xdddddddd, 0xdddddddd, 0xd777ffff,
+		0xf77fdddd, 0xdddddfdd, 0xd55ddddd, 0xffffdd55,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffcfff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xfffffcff, 0xffffffff, 0x00000000, 0xfffffff0,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xf03fffff, 0xffffffff,
+		0xffffffff, 0xffffff3f, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffff3f,
+		0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x0ffc3c0c,
+		0xfffffff3, 0xffffffff, 0xffffffff, 0xffffcfff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x55555555,
+		0x55555555, 0x55555555, 0x55555555, 0x55555555,
+		0xffffffff, 0xffffffff, 0xf3ffffff, 0xffffffff,
+	},
+	{
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	},
+	{
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0xffffff00, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xf0000000, 0xc00003cc, 0x000fc3cc, 0x00000000,
+		0x00000000, 0x00000000, 0xf0000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0xfff00000, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffd555, 0x03ff557f, 0x000fffff, 0xcc00c000,
+		0xc0000c30, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0x00000000, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0x55555557, 0xffd55555,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xf3ffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xfffffffc, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffc00fff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x55555555, 0x55555555, 0xffff5555, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x55555555,
+		0x55555555, 0xffffff55, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x33ffffff, 0xffffffff, 0xffffffff, 0x3fc0ffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffc3ff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0x55555555, 0x55555555, 0x55555555, 0xffffffd5,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffcfff, 0xffffffff, 0xffffffff, 0x3fffffff,
+		0xffffffff, 0xfccfffff, 0xff3fffff, 0xffc3ffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffc0, 0xffffffff, 0x0fffffff, 0xfffffc3f,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffff3f,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffcffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffc3ff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffc3ffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf03fffff, 0xffffffff, 0xfc000fff, 0xfffffc00,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffcfcf, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xcc3fffff,
+		0xffffff0f, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x3f0fffff,
+		0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffff0fff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xff3fffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0x55555555, 0x55555555,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfffffc00,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffc000,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xcfffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0x0fffffff, 0x03f00000, 0x003fffc0,
+		0xff0003c0, 0xffffffff, 0xf00fffff, 0x003fffff,
+		0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xfffffc0f, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x0000c000, 0x003c0000, 0xffc00c30, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffc000, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x55555555, 0x55555555, 0xfffffff5, 0xffffffff,
+		0xffc000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x00000000, 0xf0000000, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+};
@@ -0,0 +1,7384 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+#include "unicode.h"
+
+#define ENOMEM 1
+#define EINVAL 2
+#define EIO 3
+
+typedef uint16_t u16;
+
+typedef uint32_t __le32;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define cpu_to_le32(x)	((__le32)(x))
+#else
+#define cpu_to_le32(x)	((__le32)__builtin_bswap32(x))
+#endif
+
+#define likely(x)	__builtin_expect(!!(x), 1)
+#define unlikely(x)	__builtin_expect(!!(x), 0)
+#define __aligned(x)	__attribute__((aligned(x)))
+#define prefetch(x)	__builtin_prefetch(x)
+
+#define swap(a, b) \
+	do { typeof(a) __tmp = (a); (a) = (b); (b) = __tmp; } while (0)
+
+#define isascii(c) (((unsigned char)(c))<=0x7f)
+#define tolower(c) (((c) >= 'A' && (c) <= 'Z') ? (c) + 'a' - 'A' : (c))
+
+static inline int fls(unsigned int x)
+{
+	return x ? 32 - __builtin_clz(x) : 0;
+}
+
+#ifdef APFS_UNICODE_STATS
+/* There are no per-cpu variables in user space, so count per thread */
+static __thread struct apfs_unistats apfs_unistats;
+#define APFS_COUNT_ADD(counter, n)	(apfs_unistats.counter += (n))
+
+/* Copy the counters of the calling thread to @stats */
+void apfs_get_unistats(struct apfs_unistats *stats)
+{
+	*stats = apfs_unistats;
+}
+#else
+#define APFS_COUNT_ADD(counter, n)	do {} while (0)
+#endif
+#define APFS_COUNT(counter)		APFS_COUNT_ADD(counter, 1)
+
+static inline void kfree(void *ptr)
+{
+	free(ptr);
+}
+
+#define GFP_KERNEL 0
+
+/* The flags are just ignored */
+static inline void *kmalloc(size_t size, unsigned int flags)
+{
+	return malloc(size);
+}
+
+/* Don't bother protecting against overflow, this is only used once, safely */
+static inline void *kmalloc_array(size_t n, size_t size, unsigned int flags)
+{
+	return kmalloc(n * size, flags);
+}
+
+/*
+ * Replacement for the kernel's crc32c(): the CRC32C of a buffer, starting from
+ * @crc and without a final inversion. The kernel picks the fastest version it
+ * has at runtime; here it's decided at build time.
+ */
+#if defined(__SSE4_2__)
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	const u8 *p = address;
+
+#ifdef __x86_64__
+	for (; length >= 8; length -= 8, p += 8) {
+		uint64_t word;
+
+		memcpy(&word, p, sizeof(word));
+		crc = _mm_crc32_u64(crc, word);
+	}
+#endif
+	for (; length; --length)
+		crc = _mm_crc32_u8(crc, *p++);
+	return crc;
+}
+
+#elif defined(__ARM_FEATURE_CRC32)
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	const u8 *p = address;
+
+	for (; length >= 8; length -= 8, p += 8) {
+		uint64_t word;
+
+		memcpy(&word, p, sizeof(word));
+		crc = __crc32cd(crc, word);
+	}
+	for (; length; --length)
+		crc = __crc32cb(crc, *p++);
+	return crc;
+}
+
+#else /* Slice-by-8 */
+
+#define CRC32C_POLY_LE	0x82f63b78
+
+static u32 crc32c_table[8][256];
+
+/* Filled before main(), so that threads never see a partial table */
+static void __attribute__((constructor)) crc32c_init_table(void)
+{
+	int i, j;
+
+	for (i = 0; i < 256; ++i) {
+		u32 crc = i;
+
+		for (j = 0; j < 8; ++j)
+			crc = (crc >> 1) ^ (crc & 1 ? CRC32C_POLY_LE : 0);
+		crc32c_table[0][i] = crc;
+	}
+	for (i = 0; i < 256; ++i) {
+		for (j = 1; j < 8; ++j)
+			crc32c_table[j][i] = (crc32c_table[j - 1][i] >> 8) ^
+				crc32c_table[0][crc32c_table[j - 1][i] & 0xff];
+	}
+}
+
+static inline u32 crc32c_load_le(const u8 *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (u32)p[3] << 24;
+}
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	u32 (*t)[256] = crc32c_table;
+	const u8 *p = address;
+
+	for (; length >= 8; length -= 8, p += 8) {
+		u32 lo = crc32c_load_le(p) ^ crc;
+		u32 hi = crc32c_load_le(p + 4);
+
+		crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+		      t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+		      t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+		      t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+	}
+	for (; length; --length)
+		crc = t[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+	return crc;
+}
+
+#endif
+
+/*
+ * Sample implementation from Unicode home page.
+ * http://www.stonehand.com/unicode/standard/fss-utf.html
+ */
+struct utf8_table {
+	int     cmask;
+	int     cval;
+	int     shift;
+	long    lmask;
+	long    lval;
+};
+
+static const struct utf8_table utf8_table[] =
+{
+    {0x80,  0x00,   0*6,    0x7F,           0,         /* 1 byte sequence */},
+    {0xE0,  0xC0,   1*6,    0x7FF,          0x80,      /* 2 byte sequence */},
+    {0xF0,  0xE0,   2*6,    0xFFFF,         0x800,     /* 3 byte sequence */},
+    {0xF8,  0xF0,   3*6,    0x1FFFFF,       0x10000,   /* 4 byte sequence */},
+    {0xFC,  0xF8,   4*6,    0x3FFFFFF,      0x200000,  /* 5 byte sequence */},
+    {0xFE,  0xFC,   5*6,    0x7FFFFFFF,     0x4000000, /* 6 byte sequence */},
+    {0,						       /* end of table    */}
+};
+
+#define UNICODE_MAX	0x0010ffff
+#define PLANE_SIZE	0x00010000
+
+#define SURROGATE_MASK	0xfffff800
+#define SURROGATE_PAIR	0x0000d800
+#define SURROGATE_LOW	0x00000400
+#define SURROGATE_BITS	0x000003ff
+
+static int utf8_to_utf32(const u8 *s, int inlen, unicode_t *pu)
+{
+	unsigned long l;
+	int c0, c, nc;
+	const struct utf8_table *t;
+
+	nc = 0;
+	c0 = *s;
+	l = c0;
+	for (t = utf8_table; t->cmask; t++) {
+		nc++;
+		if ((c0 & t->cmask) == t->cval) {
+			l &= t->lmask;
+			if (l < t->lval || l > UNICODE_MAX ||
+					(l & SURROGATE_MASK) == SURROGATE_PAIR)
+				return -1;
+			*pu = (unicode_t) l;
+			return nc;
+		}
+		if (inlen <= nc)
+			return -1;
+		s++;
+		c = (*s ^ 0x80) & 0xFF;
+		if (c & 0xC0)
+			return -1;
+		l = (l << 6) | c;
+	}
+	return -1;
+}
+
+int utf32_to_utf8(unicode_t u, u8 *s, int maxout)
+{
+	unsigned long l;
+	int c, nc;
+	const struct utf8_table *t;
+
+	if (!s)
+		return 0;
+
+	l = u;
+	if (l > UNICODE_MAX || (l & SURROGATE_MASK) == SURROGATE_PAIR)
+		return -1;
+
+	nc = 0;
+	for (t = utf8_table; t->cmask && maxout; t++, maxout--) {
+		nc++;
+		if (l <= t->lmask) {
+			c = t->shift;
+			*s = (u8) (t->cval | (l >> c));
+			while (c > 0) {
+				c -= 6;
+				s++;
+				*s = (u8) (0x80 | ((l >> c) & 0x3F));
+			}
+			return nc;
+		}
+	}
+	return -1;
+}
+/* Key bits for each level of apfs_trie, from the root down */
+#define TRIE_HEIGHT		3
+#define TRIE_LEVEL_BITS		{ 12, 5, 4, }
+#define TRIE_LEVEL_SHIFT	{ 9, 4, 0, }
+
+/* Position of row zero for each level of the trie */
+#define TRIE_LEVEL_BASE		{ 0, 4064, 5552, }
+
+/*
+ * Normalization data for a single character. The nfd field holds the position
+ * and length of the character's decomposition in apfs_nfd, and nfdcf holds
+ * those of the case folding of its decomposition in apfs_nfdcf; they are zero
+ * if the character maps to itself.
+ */
+struct apfs_unidata {
+	u16 nfd;
+	u16 nfdcf;
+	u8 ccc;
+};
+
+/* The arrays of unicode data are defined at the bottom of the file */
+#ifdef APFS_UNIDATA_HASH
+static const u16 apfs_hash_disp[];
+static const u32 apfs_hash_slots[];
+#else
+static const u16 apfs_trie[];
+#endif
+static const struct apfs_unidata apfs_unidata[];
+static const struct apfs_unidata apfs_unidata_2byte[];
+static const u16 apfs_nfd[];
+static const u16 apfs_nfdcf[];
+static const u32 apfs_value_wide[];
+static const u32 apfs_nfd_esc[];
+static const u32 apfs_nfdcf_esc[];
+static const u8 apfs_qc_planes[];
+static const u8 apfs_qc_blocks[][256];
+static const u32 apfs_qc_leaves[][16];
+
+#ifndef APFS_UNIDATA_HASH
+/*
+ * The shape of the trie is chosen by mktrie, which defines TRIE_HEIGHT and
+ * the key bits, shift and array position for each level, from the root down.
+ * Every node on a level has one child for each possible value of its bits.
+ */
+static const u8 apfs_trie_bits[TRIE_HEIGHT] = TRIE_LEVEL_BITS;
+static const u8 apfs_trie_shift[TRIE_HEIGHT] = TRIE_LEVEL_SHIFT;
+static const int apfs_trie_base[TRIE_HEIGHT] = TRIE_LEVEL_BASE;
+#endif
+
+#ifdef APFS_LOADABLE_TABLES
+/*
+ * In user space the tables may also come from a file built by mktrie, which
+ * is mapped and used in place; see apfs_load_unitables(). The lookups reach
+ * them through apfs_tables, which points to the built-in arrays by default.
+ */
+#define APFS_UNITABLES_MAX_HEIGHT	8
+
+struct apfs_unitables {
+	const u16 *trie;
+	const struct apfs_unidata *unidata;
+	const struct apfs_unidata *unidata_2byte;
+	const u16 *nfd;
+	const u16 *nfdcf;
+	const u32 *value_wide;
+	const u32 *nfd_esc;
+	const u32 *nfdcf_esc;
+	const u8 *qc_planes;
+	const u8 (*qc_blocks)[256];
+	const u32 (*qc_leaves)[16];
+	int trie_height;
+	const u8 *trie_bits;
+	const u8 *trie_shift;
+	const int *trie_base;
+	const u16 *hash_disp;
+	const u32 *hash_slots;
+	u32 hash_buckets;
+	u32 hash_size;
+};
+
+/* Only the lookup method that was selected by mktrie is built in */
+static const struct apfs_unitables apfs_builtin_tables = {
+	.unidata	= apfs_unidata,
+	.unidata_2byte	= apfs_unidata_2byte,
+	.nfd		= apfs_nfd,
+	.nfdcf		= apfs_nfdcf,
+	.value_wide	= apfs_value_wide,
+	.nfd_esc	= apfs_nfd_esc,
+	.nfdcf_esc	= apfs_nfdcf_esc,
+	.qc_planes	= apfs_qc_planes,
+	.qc_blocks	= apfs_qc_blocks,
+	.qc_leaves	= apfs_qc_leaves,
+#ifdef APFS_UNIDATA_HASH
+	.hash_disp	= apfs_hash_disp,
+	.hash_slots	= apfs_hash_slots,
+	.hash_buckets	= HASH_BUCKETS,
+	.hash_size	= HASH_SLOTS,
+#else
+	.trie		= apfs_trie,
+	.trie_height	= TRIE_HEIGHT,
+	.trie_bits	= apfs_trie_bits,
+	.trie_shift	= apfs_trie_shift,
+	.trie_base	= apfs_trie_base,
+#endif
+};
+
+static const struct apfs_unitables *apfs_tables = &apfs_builtin_tables;
+
+#define APFS_TABLE(name)	(apfs_tables->name)
+#define APFS_TRIE_HEIGHT	(apfs_tables->trie_height)
+#define APFS_HASH_BUCKETS	(apfs_tables->hash_buckets)
+#define APFS_HASH_SLOTS		(apfs_tables->hash_size)
+#else
+#define APFS_TABLE(name)	(apfs_##name)
+#define APFS_TRIE_HEIGHT	TRIE_HEIGHT
+#define APFS_HASH_BUCKETS	HASH_BUCKETS
+#define APFS_HASH_SLOTS		HASH_SLOTS
+#endif	/* APFS_LOADABLE_TABLES */
+
+/* A trie value length is stored in the last three bits of its position */
+#define TRIE_POS_SHIFT		3
+#define TRIE_SIZE_MASK		((1 << TRIE_POS_SHIFT) - 1)
+
+/*
+ * Values that are too long or too far into their array for that encoding
+ * have a length of zero. Their position is then an index into the escape
+ * array for the table, which has the length in the low byte of each entry
+ * and the real position above it.
+ */
+#define ESC_POS_SHIFT		8
+#define ESC_SIZE_MASK		((1 << ESC_POS_SHIFT) - 1)
+
+/*
+ * The value arrays have 16-bit entries. Starters from the BMP are stored as
+ * they are, and the other characters as a surrogate code point, which gives
+ * their position in apfs_value_wide.
+ */
+#define VALUE_WIDE_FIRST	0xd800
+#define VALUE_WIDE_COUNT	0x800
+
+/* Each wide value, and each normalized character, has its ccc on top */
+#define VALUE_CCC_SHIFT		24
+#define VALUE_CHAR_MASK		((1 << VALUE_CCC_SHIFT) - 1)
+
+/* Longest normalization of a single character */
+#define APFS_VALUE_MAX_LEN	8
+
+/*
+ * Each slot of the perfect hash holds a character, in its low bits, and the
+ * index of its record above them.
+ */
+#define HASH_KEY_BITS		18
+#define HASH_KEY_MASK		((1 << HASH_KEY_BITS) - 1)
+
+#ifdef APFS_UNIDATA_HASH
+/*
+ * The hash functions must be the same ones that mktrie used to build the
+ * tables. This is an integer hash with full avalanche, so that every key bit
+ * counts.
+ */
+static inline u32 apfs_hash_mix(u32 x)
+{
+	x ^= x >> 16;
+	x *= 0x7feb352d;
+	x ^= x >> 15;
+	x *= 0x846ca68b;
+	x ^= x >> 16;
+	return x;
+}
+
+/* Map a hash to the range [0, @n), without a division */
+static inline u32 apfs_hash_range(u32 hash, u32 n)
+{
+	return ((u64)hash * n) >> 32;
+}
+
+/* Position of the displacement for a hashed key */
+static inline u32 apfs_hash_bucket(u32 hash)
+{
+	return apfs_hash_range(hash, APFS_HASH_BUCKETS);
+}
+
+/* Position of the slot for a hashed key, given its displacement */
+static inline u32 apfs_hash_slot(u32 hash, u16 disp)
+{
+	return apfs_hash_range(apfs_hash_mix(hash + disp), APFS_HASH_SLOTS);
+}
+
+/* Index of the record in slot @entry, if it belongs to @key, or else zero */
+static inline int apfs_hash_index(u32 entry, unicode_t key)
+{
+	if ((entry & HASH_KEY_MASK) != key) {
+		APFS_COUNT(hash_misses);
+		return 0;
+	}
+	return entry >> HASH_KEY_BITS;
+}
+
+/**
+ * apfs_hash_find - Look up the normalization data for a character
+ * @key:	search key (a unicode character)
+ *
+ * Every character with a record, outside the two-byte range, has its own
+ * slot in the perfect hash; the others land on the slot of some other key,
+ * and the check sends them to the first record, which is all zeroes. This
+ * takes two loads before the record, however sparse the data is around @key.
+ */
+static const struct apfs_unidata *apfs_hash_find(unicode_t key)
+{
+	u32 hash = apfs_hash_mix(key);
+	u16 disp = APFS_TABLE(hash_disp)[apfs_hash_bucket(hash)];
+	u32 entry = APFS_TABLE(hash_slots)[apfs_hash_slot(hash, disp)];
+
+	APFS_COUNT(hash_probes);
+	return &APFS_TABLE(unidata)[apfs_hash_index(entry, key)];
+}
+#else
+/**
+ * apfs_trie_find - Look up the normalization data for a character
+ * @key:	search key (a unicode character)
+ *
+ * Returns the data record for @key; the first record is all zeroes, and it's
+ * used for all characters that don't require any changes.
+ */
+static const struct apfs_unidata *apfs_trie_find(unicode_t key)
+{
+	int node = 0;
+	int h;
+
+	APFS_COUNT(trie_walks);
+	for (h = 0; h < APFS_TRIE_HEIGHT; ++h) {
+		int bits = APFS_TABLE(trie_bits)[h];
+		int shift = APFS_TABLE(trie_shift)[h];
+		int child = (key >> shift) & ((1 << bits) - 1);
+		int child_index = APFS_TABLE(trie_base)[h] + (node << bits) +
+				  child;
+
+		node = APFS_TABLE(trie)[child_index];
+		if (node == 0) {
+			APFS_COUNT(trie_misses[h < APFS_STATS_LEVELS ? h :
+					       APFS_STATS_LEVELS - 1]);
+			break;
+		}
+	}
+
+	/* On the last level, the node is the index of the record */
+	return &APFS_TABLE(unidata)[node];
+}
+#endif	/* APFS_UNIDATA_HASH */
+
+/* Characters with a two-byte UTF-8 encoding have their own flat table */
+#define UTF8_2BYTE_FIRST	0x80
+#define UTF8_2BYTE_LAST		0x7ff
+
+/**
+ * apfs_unidata_find - Get the normalization data for a character
+ * @key:	the character
+ *
+ * Most non-ASCII names are written in scripts from the two-byte UTF-8 range,
+ * so those characters skip the trie walk and use a direct table lookup.
+ */
+static inline const struct apfs_unidata *apfs_unidata_find(unicode_t key)
+{
+	APFS_COUNT(lookups);
+	if (key - UTF8_2BYTE_FIRST <= UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST)
+		return &APFS_TABLE(unidata_2byte)[key - UTF8_2BYTE_FIRST];
+#ifdef APFS_UNIDATA_HASH
+	return apfs_hash_find(key);
+#else
+	return apfs_trie_find(key);
+#endif
+}
+
+/* Number of characters that apfs_unicursor_fill() decodes at a time */
+#define APFS_UNICURSOR_BATCH	8
+
+/**
+ * apfs_unidata_find_batch - Look up the normalization data for several keys
+ * @keys:	search keys, none of them in the two-byte range
+ * @count:	number of keys, up to APFS_UNICURSOR_BATCH
+ * @data:	on return, the data record for each key
+ *
+ * Each lookup in the trie is a chain of dependent loads, so when they are
+ * done one after the other, every cache miss waits for the one before it.
+ * Here the walks for all the keys go down the trie together, one level at a
+ * time, so that their misses overlap; the row of the next level, or the
+ * record, is prefetched as soon as its position is known. The perfect hash
+ * is handled the same way: the displacements, then the slots, and then the
+ * records are read for all the keys in turn.
+ */
+#ifdef APFS_UNIDATA_HASH
+static void apfs_unidata_find_batch(const unicode_t *keys, int count,
+				    const struct apfs_unidata **data)
+{
+	u32 hash[APFS_UNICURSOR_BATCH], slot[APFS_UNICURSOR_BATCH];
+	int i;
+
+	APFS_COUNT_ADD(lookups, count);
+	APFS_COUNT_ADD(hash_probes, count);
+	for (i = 0; i < count; ++i) {
+		hash[i] = apfs_hash_mix(keys[i]);
+		prefetch(&APFS_TABLE(hash_disp)[apfs_hash_bucket(hash[i])]);
+	}
+	for (i = 0; i < count; ++i) {
+		u16 disp = APFS_TABLE(hash_disp)[apfs_hash_bucket(hash[i])];
+
+		slot[i] = apfs_hash_slot(hash[i], disp);
+		prefetch(&APFS_TABLE(hash_slots)[slot[i]]);
+	}
+	for (i = 0; i < count; ++i) {
+		u32 entry = APFS_TABLE(hash_slots)[slot[i]];
+
+		data[i] = &APFS_TABLE(unidata)[apfs_hash_index(entry, keys[i])];
+		prefetch(data[i]);
+	}
+}
+#else
+static void apfs_unidata_find_batch(const unicode_t *keys, int count,
+				    const struct apfs_unidata **data)
+{
+	int node[APFS_UNICURSOR_BATCH] = {0};
+	int h, i;
+
+	APFS_COUNT_ADD(lookups, count);
+	APFS_COUNT_ADD(trie_walks, count);
+	for (h = 0; h < APFS_TRIE_HEIGHT; ++h) {
+		int bits = APFS_TABLE(trie_bits)[h];
+		int shift = APFS_TABLE(trie_shift)[h];
+		int base = APFS_TABLE(trie_base)[h];
+		bool last = h == APFS_TRIE_HEIGHT - 1;
+		int next_base = 0, next_bits = 0;
+
+		if (!last) {
+			next_base = APFS_TABLE(trie_base)[h + 1];
+			next_bits = APFS_TABLE(trie_bits)[h + 1];
+		}
+		for (i = 0; i < count; ++i) {
+			int child = (keys[i] >> shift) & ((1 << bits) - 1);
+
+			/* Empty children are never walked, so they stay 0 */
+			if (h && !node[i])
+				continue;
+			node[i] = APFS_TABLE(trie)[base + (node[i] << bits) +
+						   child];
+			if (!node[i])
+				APFS_COUNT(trie_misses[h < APFS_STATS_LEVELS ?
+						h : APFS_STATS_LEVELS - 1]);
+			else if (!last)
+				prefetch(&APFS_TABLE(trie)[next_base +
+						(node[i] << next_bits)]);
+			else
+				prefetch(&APFS_TABLE(unidata)[node[i]]);
+		}
+	}
+
+	/* On the last level, the node is the index of the record */
+	for (i = 0; i < count; ++i)
+		data[i] = &APFS_TABLE(unidata)[node[i]];
+}
+#endif	/* APFS_UNIDATA_HASH */
+
+/**
+ * apfs_init_unicursor_len - Initialize a cursor for a string of known length
+ * @cursor:	cursor to initialize
+ * @utf8str:	string to normalize, not necessarily NUL-terminated
+ * @len:	length of @utf8str; a NUL byte also ends the string
+ *
+ * Names read from disk can be normalized in place this way, without copying
+ * them to a NUL-terminated buffer first.
+ */
+void apfs_init_unicursor_len(struct apfs_unicursor *cursor,
+			     const char *utf8str, int len)
+{
+	cursor->utf8curr = utf8str;
+	cursor->utf8end = utf8str + len;
+	cursor->buf_len = 0;
+	cursor->buf_pos = 0;
+	cursor->more = false;
+	cursor->stream_safe = APFS_STREAM_SAFE_OFF;
+	cursor->nonstarters = 0;
+	cursor->segs = NULL;
+}
+
+/**
+ * apfs_init_unicursor_segs - Initialize a cursor for a segmented string
+ * @cursor:	cursor to initialize
+ * @state:	room for the state of the cursor across segments
+ * @segs:	pieces of the string to normalize, in order
+ * @count:	number of pieces; must be at least one
+ *
+ * For strings that are not contiguous in memory, like a name that crosses
+ * the boundary between two blocks. The segments are read in place, and
+ * @segs and @state must remain valid while the cursor is in use. A NUL byte
+ * in any of them ends the string.
+ *
+ * The few bytes around each boundary get copied to @state, so that a
+ * substring can be decoded across it. A substring longer than that buffer
+ * (which is not possible in a valid name, or in Stream-Safe text) is rejected
+ * like invalid UTF-8 if it crosses a boundary.
+ */
+void apfs_init_unicursor_segs(struct apfs_unicursor *cursor,
+			      struct apfs_unisegs *state,
+			      const struct apfs_unisegment *segs, int count)
+{
+	apfs_init_unicursor_len(cursor, segs->ptr, segs->len);
+	state->next = segs + 1;
+	state->count = count - 1;
+	state->off = 0;
+	cursor->segs = state;
+}
+
+/**
+ * apfs_init_unicursor - Initialize an apfs_unicursor structure
+ * @cursor:	cursor to initialize
+ * @utf8str:	string to normalize
+ */
+void apfs_init_unicursor(struct apfs_unicursor *cursor, const char *utf8str)
+{
+	apfs_init_unicursor_len(cursor, utf8str, strlen(utf8str));
+}
+
+/* Longest run of non-starters allowed by the Stream-Safe Text Format */
+#define STREAM_SAFE_MAX		30
+/* COMBINING GRAPHEME JOINER, the starter that breaks up longer runs */
+#define UNICODE_CGJ		0x034f
+
+/**
+ * apfs_unicursor_stream_safe - Set how a cursor handles long mark sequences
+ * @cursor:	cursor to set, before its first use
+ * @mode:	APFS_STREAM_SAFE to insert a CGJ before a character that would
+ *		make a run of more than 30 non-starters, as in UAX #15, or
+ *		APFS_STREAM_SAFE_STRICT to stop before it as if it were invalid
+ *
+ * The non-starters are counted in the normalized string. Without a limit,
+ * the work to reorder a run of them grows with its length, so a single name
+ * made of thousands of combining marks can keep the cpu busy; in either mode
+ * no substring has more than 30 non-starters. The output of APFS_STREAM_SAFE
+ * is not the plain normalization of such names, so their hashes will not
+ * match those computed by other implementations.
+ */
+void apfs_unicursor_stream_safe(struct apfs_unicursor *cursor, int mode)
+{
+	cursor->stream_safe = mode;
+}
+
+#define HANGUL_S_BASE	0xac00
+#define HANGUL_L_BASE	0x1100
+#define HANGUL_V_BASE	0x1161
+#define HANGUL_T_BASE	0x11a7
+#define HANGUL_L_COUNT	19
+#define HANGUL_V_COUNT	21
+#define HANGUL_T_COUNT	28
+#define HANGUL_N_COUNT	(HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT	(HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+/**
+ * apfs_is_precomposed_hangul - Check if a character is a Hangul syllable
+ * @utf32char:	character to check
+ *
+ * This function was adapted from sample code in section 3.12 of the
+ * Unicode Standard, version 9.0.
+ *
+ * Copyright (C) 1991-2018 Unicode, Inc.  All rights reserved.  Distributed
+ * under the Terms of Use in http://www.unicode.org/copyright.html.
+ */
+static bool apfs_is_precomposed_hangul(unicode_t utf32char)
+{
+	int index;
+
+	index = utf32char - HANGUL_S_BASE;
+	return (index >= 0 && index < HANGUL_S_COUNT);
+}
+
+/**
+ * apfs_decompose_hangul - Decompose a Hangul syllable
+ * @utf32char:	Hangul syllable to decompose
+ * @buf:	on return, the decomposition of @utf32char
+ *
+ * Returns the length of the decomposition.
+ *
+ * This function was adapted from sample code in section 3.12 of the
+ * Unicode Standard, version 9.0.
+ *
+ * Copyright (C) 1991-2018 Unicode, Inc.  All rights reserved.  Distributed
+ * under the Terms of Use in http://www.unicode.org/copyright.html.
+ */
+static int apfs_decompose_hangul(unicode_t utf32char, unicode_t *buf)
+{
+	int index;
+	int t;
+
+	index = utf32char - HANGUL_S_BASE;
+
+	buf[0] = HANGUL_L_BASE + index / HANGUL_N_COUNT;
+	buf[1] = HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+
+	t = HANGUL_T_BASE + index % HANGUL_T_COUNT;
+	if (t == HANGUL_T_BASE)
+		return 2;
+	buf[2] = t;
+	return 3;
+}
+
+/**
+ * apfs_normalize_char - Normalize a unicode character
+ * @utf32char:	character to normalize
+ * @data:	normalization data for @utf32char, or NULL for ASCII and
+ *		Hangul syllables, which have none
+ * @case_fold:	case fold the char?
+ * @norm:	on return, the normalization of @utf32char; there must be room
+ *		for APFS_VALUE_MAX_LEN characters
+ *
+ * Every character of the normalization has its canonical combining class in
+ * the top byte, like the entries of the wide value array.
+ *
+ * Returns the length of the normalization.
+ */
+static int apfs_normalize_char(unicode_t utf32char,
+			       const struct apfs_unidata *data, bool case_fold,
+			       unicode_t *norm)
+{
+	const u16 *values;
+	unsigned int pos, len, i;
+
+	if (!data) {
+		if (apfs_is_precomposed_hangul(utf32char)) /* No case */
+			return apfs_decompose_hangul(utf32char, norm);
+		norm[0] = case_fold ? tolower(utf32char) : utf32char;
+		return 1;
+	}
+
+	pos = case_fold ? data->nfdcf : data->nfd;
+	if (!pos) {
+		/* The normalization is just the same character */
+		norm[0] = utf32char | (unicode_t)data->ccc << VALUE_CCC_SHIFT;
+		return 1;
+	}
+
+	len = pos & TRIE_SIZE_MASK;
+	pos >>= TRIE_POS_SHIFT;
+	if (unlikely(!len)) {
+		u32 esc = (case_fold ? APFS_TABLE(nfdcf_esc) :
+				       APFS_TABLE(nfd_esc))[pos];
+
+		len = esc & ESC_SIZE_MASK;
+		pos = esc >> ESC_POS_SHIFT;
+	}
+	values = &(case_fold ? APFS_TABLE(nfdcf) : APFS_TABLE(nfd))[pos];
+	for (i = 0; i < len; ++i) {
+		unsigned int wide = (u16)(values[i] - VALUE_WIDE_FIRST);
+
+		if (wide < VALUE_WIDE_COUNT)
+			norm[i] = APFS_TABLE(value_wide)[wide];
+		else
+			norm[i] = values[i];
+	}
+	return len;
+}
+
+/* Are there more segments after the current one? */
+static inline bool apfs_unicursor_more_segs(struct apfs_unicursor *cursor)
+{
+	return unlikely(cursor->segs) && cursor->segs->count;
+}
+
+/**
+ * apfs_unicursor_next_seg - Move the cursor to the start of the next segment
+ * @cursor:	unicode cursor for the string, at the end of a segment
+ *
+ * Returns false if there are no more segments.
+ */
+static bool apfs_unicursor_next_seg(struct apfs_unicursor *cursor)
+{
+	struct apfs_unisegs *state = cursor->segs;
+	const struct apfs_unisegment *seg;
+
+	do {
+		if (!apfs_unicursor_more_segs(cursor))
+			return false;
+		seg = state->next++;
+		state->count--;
+		cursor->utf8curr = seg->ptr + state->off;
+		cursor->utf8end = seg->ptr + seg->len;
+		state->off = 0;
+	} while (cursor->utf8curr == cursor->utf8end);
+	return true;
+}
+
+/**
+ * apfs_unicursor_carry - Join the end of a segment with the following ones
+ * @cursor:	unicode cursor for the string, near the end of a segment
+ *
+ * The rest of the current segment, from @cursor->utf8curr, is moved to the
+ * carry buffer of the segment state, and as much of the following segments
+ * as fits is copied after it. The cursor then reads from the carry buffer,
+ * and moves on to the rest of the segments when it's done with it.
+ *
+ * Returns 0 on success, or -EINVAL if the substring at @cursor->utf8curr is
+ * too long for the carry buffer.
+ */
+static int apfs_unicursor_carry(struct apfs_unicursor *cursor)
+{
+	struct apfs_unisegs *state = cursor->segs;
+	int len = cursor->utf8end - cursor->utf8curr;
+
+	if (len >= APFS_UNICURSOR_CARRY)
+		return -EINVAL;
+	memmove(state->carry, cursor->utf8curr, len);
+
+	while (len < APFS_UNICURSOR_CARRY && state->count) {
+		const struct apfs_unisegment *seg = state->next;
+		int copy = seg->len - state->off;
+
+		if (copy > APFS_UNICURSOR_CARRY - len)
+			copy = APFS_UNICURSOR_CARRY - len;
+		memcpy(state->carry + len, seg->ptr + state->off, copy);
+		len += copy;
+		state->off += copy;
+		if (state->off == seg->len) {
+			state->next++;
+			state->count--;
+			state->off = 0;
+		}
+	}
+
+	cursor->utf8curr = state->carry;
+	cursor->utf8end = state->carry + len;
+	return 0;
+}
+
+/**
+ * apfs_unicursor_stopped - Check if a cursor stopped before the end
+ * @cursor:	unicode cursor, after apfs_normalize_next() returned 0
+ *
+ * Returns true if the cursor stopped at a substring with invalid UTF-8,
+ * false if it got to the end of the string.
+ */
+bool apfs_unicursor_stopped(struct apfs_unicursor *cursor)
+{
+	if (cursor->utf8curr == cursor->utf8end)
+		return apfs_unicursor_more_segs(cursor);
+	return *cursor->utf8curr != 0;
+}
+
+/* Characters decoded ahead by apfs_unicursor_fill(), with their data */
+struct apfs_unibatch {
+	int count;
+	unicode_t chars[APFS_UNICURSOR_BATCH];
+	u8 lens[APFS_UNICURSOR_BATCH];	/* Length of each one in UTF-8 */
+	const struct apfs_unidata *data[APFS_UNICURSOR_BATCH];
+};
+
+/**
+ * apfs_unicursor_decode - Decode the next few characters of a string
+ * @cursor:	unicode cursor for the string
+ * @utf8str:	position of the first character, not at the end
+ * @max:	maximum number of characters, up to APFS_UNICURSOR_BATCH
+ * @batch:	on return, the characters and their normalization data
+ *
+ * Up to @max characters are decoded, and then looked up all together.
+ * Decoding stops early at the end of the string, at invalid UTF-8, near the
+ * end of a segment that is followed by others, and after an ASCII character,
+ * so that the ASCII fast paths get to handle the rest of the run.
+ * ASCII and Hangul syllables have no normalization data, so they get NULL.
+ *
+ * Returns the number of characters decoded, which is zero only if the first
+ * one is invalid.
+ */
+static int apfs_unicursor_decode(struct apfs_unicursor *cursor,
+				 const char *utf8str, int max,
+				 struct apfs_unibatch *batch)
+{
+	unicode_t keys[APFS_UNICURSOR_BATCH];
+	const struct apfs_unidata *data[APFS_UNICURSOR_BATCH];
+	int count, lookups = 0;
+	int i, j;
+
+	for (count = 0; count < max; ++count) {
+		unicode_t utf32char;
+		int utf8len;
+
+		if (count && ((apfs_unicursor_more_segs(cursor) &&
+			       cursor->utf8end - utf8str < 4) ||
+			      utf8str == cursor->utf8end || !*utf8str))
+			break;
+		APFS_COUNT(decodes);
+		utf8len = utf8_to_utf32(utf8str, cursor->utf8end - utf8str,
+					&utf32char);
+		if (utf8len < 0)
+			break;
+		batch->chars[count] = utf32char;
+		batch->lens[count] = utf8len;
+		batch->data[count] = NULL;
+		utf8str += utf8len;
+
+		if (utf32char < 0x80) {
+			count++;
+			break;
+		}
+		if (utf32char <= UTF8_2BYTE_LAST)
+			batch->data[count] = apfs_unidata_find(utf32char);
+		else if (!apfs_is_precomposed_hangul(utf32char))
+			keys[lookups++] = utf32char;
+	}
+
+	/* Only the characters that need a trie walk are left */
+	apfs_unidata_find_batch(keys, lookups, data);
+	for (i = 0, j = 0; j < lookups; ++i) {
+		if (batch->chars[i] > UTF8_2BYTE_LAST &&
+		    !apfs_is_precomposed_hangul(batch->chars[i]))
+			batch->data[i] = data[j++];
+	}
+	batch->count = count;
+	return count;
+}
+
+/*
+ * Characters of a substring are ordered by the number of starters that come
+ * before them (other than the first character), then by canonical combining
+ * class, then by position. Starters never move, and runs of non-starters get
+ * a stable sort by their ccc.
+ */
+#define KEY_GROUP_SHIFT		40
+#define KEY_CCC_SHIFT		32
+
+/**
+ * apfs_unicursor_fill - Decompose and reorder the next substrings of a string
+ * @cursor:	unicode cursor for the string
+ * @case_fold:	case fold the string?
+ *
+ * A substring begins at @cursor->utf8curr and ends before the next character
+ * whose normalization begins with a starter. Its normalized characters are
+ * decoded once and put in canonical order in the cursor buffer. Substrings
+ * that don't fit get buffered in several batches, each with the lowest sort
+ * keys that were not returned yet; @cursor->utf8curr only moves on when the
+ * last batch is buffered.
+ *
+ * The characters are decoded and looked up a few at a time, so the following
+ * substrings are also buffered while there is room, up to the next ASCII
+ * character; the work already done for them is not thrown away. If one of
+ * them can't be finished, because it doesn't fit, has invalid UTF-8 or goes
+ * on in the next segment, the buffer ends before it and it's left for the
+ * next call.
+ *
+ * In the Stream-Safe modes, the run of non-starters is counted as they get
+ * buffered. A CGJ that gets inserted is a starter, so it begins a new
+ * substring; if the fill ends there, the length of the run is kept in the
+ * cursor so that the next fill inserts it again.
+ *
+ * Returns the number of characters buffered, 0 at the end of the string, or
+ * -EINVAL if the substring has invalid UTF-8, or too many non-starters for
+ * APFS_STREAM_SAFE_STRICT.
+ */
+static int apfs_unicursor_fill(struct apfs_unicursor *cursor, bool case_fold)
+{
+	u64 keys[APFS_UNICURSOR_BUFSIZE];
+	/* Room for a CGJ before the normalization of each char */
+	unicode_t norm[APFS_VALUE_MAX_LEN + 1] = {0};
+	struct apfs_unibatch batch;
+	const char *utf8str, *boundary;
+	bool resume = cursor->more;
+	bool marks, cgj;
+	int group, pos, count, next, max, boundary_count, run;
+
+	APFS_COUNT(fills);
+restart:
+	utf8str = cursor->utf8curr;
+	group = pos = count = 0;
+	boundary = NULL;
+	boundary_count = 0;
+	marks = false;
+	run = cursor->nonstarters;
+	batch.count = next = 0;
+	cursor->more = false;
+	while (1) {
+		unicode_t utf32char, *chars;
+		int norm_len, i;
+
+		cgj = false;
+		if (next == batch.count) {
+			/* The substring may go on in the next segment */
+			if (apfs_unicursor_more_segs(cursor) &&
+			    cursor->utf8end - utf8str < 4) {
+				if (boundary_count)
+					goto stop_early;
+				if (apfs_unicursor_carry(cursor))
+					return -EINVAL;
+				goto restart;
+			}
+			if (utf8str == cursor->utf8end || !*utf8str)
+				break;
+			/*
+			 * Once there are combining marks, the fill ends with
+			 * the substring, so don't decode past it.
+			 */
+			max = marks ? 1 : APFS_UNICURSOR_BATCH;
+			next = 0;
+			if (!apfs_unicursor_decode(cursor, utf8str, max,
+						   &batch)) {
+				if (boundary_count)
+					goto stop_early;
+				/* Invalid unicode; don't normalize anything */
+				return -EINVAL;
+			}
+		}
+
+		utf32char = batch.chars[next];
+		chars = norm + 1;
+		norm_len = apfs_normalize_char(utf32char, batch.data[next],
+					       case_fold, chars);
+		if (cursor->stream_safe) {
+			for (i = 0; i < norm_len; ++i) {
+				if (!(chars[i] >> VALUE_CCC_SHIFT))
+					break;
+			}
+			if (run + i > STREAM_SAFE_MAX) {
+				if (cursor->stream_safe ==
+				    APFS_STREAM_SAFE_STRICT) {
+					if (boundary_count)
+						goto stop_early;
+					return -EINVAL;
+				}
+				*--chars = UNICODE_CGJ;
+				norm_len++;
+				cgj = true;
+			}
+		}
+		if (pos && !(chars[0] >> VALUE_CCC_SHIFT)) {
+			/*
+			 * Reached the next substring. Keep going if it was
+			 * just starters, and there's still room.
+			 */
+			if (count && (resume || marks || utf32char < 0x80 ||
+				      count > APFS_UNICURSOR_BUFSIZE -
+					      APFS_UNICURSOR_BATCH))
+				break;
+			boundary = utf8str;
+			boundary_count = count;
+		}
+
+		for (i = 0; i < norm_len; ++i, ++pos) {
+			u64 ccc = chars[i] >> VALUE_CCC_SHIFT;
+			u64 key;
+			int j;
+
+			if (pos && !ccc)
+				group++;
+			marks |= ccc != 0;
+			key = (u64)group << KEY_GROUP_SHIFT |
+			      ccc << KEY_CCC_SHIFT | pos;
+			if (resume && key <= cursor->last_key)
+				continue; /* Returned in an earlier batch */
+
+			if (count == APFS_UNICURSOR_BUFSIZE) {
+				/* Only a lone substring is split in batches */
+				if (boundary_count)
+					goto stop_early;
+				cursor->more = true;
+				if (key > keys[count - 1])
+					continue;
+				count--; /* Leave the highest key for later */
+			}
+
+			/* Insertion sort; the buffer is almost always tiny */
+			for (j = count; j > 0 && keys[j - 1] > key; --j) {
+				keys[j] = keys[j - 1];
+				cursor->buf[j] = cursor->buf[j - 1];
+			}
+			keys[j] = key;
+			cursor->buf[j] = chars[i];
+			count++;
+		}
+		if (cursor->stream_safe) {
+			/* The run goes on only if there was no starter */
+			for (i = norm_len; i > 0; --i) {
+				if (!(chars[i - 1] >> VALUE_CCC_SHIFT))
+					break;
+			}
+			run = i ? norm_len - i : run + norm_len;
+		}
+		utf8str += batch.lens[next++];
+	}
+
+	if (cursor->more) {
+		cursor->last_key = keys[count - 1];
+	} else {
+		cursor->utf8curr = utf8str;
+		cursor->nonstarters = cgj ? run : 0;
+		if (pos)
+			APFS_COUNT(substrings[fls(pos) <= APFS_STATS_SUBSTR ?
+					      fls(pos) - 1 :
+					      APFS_STATS_SUBSTR - 1]);
+	}
+	cursor->buf_len = count;
+	cursor->buf_pos = 0;
+	return count;
+
+stop_early:
+	/*
+	 * The keys of the last substring are higher than all the others, so
+	 * the buffer only needs to be cut where it begins.
+	 */
+	cursor->more = false;
+	cursor->nonstarters = 0;
+	cursor->utf8curr = boundary;
+	cursor->buf_len = boundary_count;
+	cursor->buf_pos = 0;
+	return boundary_count;
+}
+
+/* Word-at-a-time helpers, for when there is no SIMD to scan ASCII runs */
+#define REPEAT_BYTE(x)	((~0ul / 0xff) * (x))
+#define HAS_ZERO(w)	(((w) - REPEAT_BYTE(0x01)) & ~(w) & REPEAT_BYTE(0x80))
+
+/**
+ * apfs_ascii_len - Measure a run of ASCII characters
+ * @s:		string to scan
+ * @len:	maximum length of the run
+ *
+ * Returns the number of bytes at the start of @s that are ASCII characters
+ * other than NUL, up to @len.
+ */
+static int apfs_ascii_len(const u8 *s, int len)
+{
+	int i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+		__m256i nul = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+		u32 stop = _mm256_movemask_epi8(_mm256_or_si256(v, nul));
+
+		if (stop)
+			return i + __builtin_ctz(stop);
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+		__m128i nul = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+		u32 stop = _mm_movemask_epi8(_mm_or_si128(v, nul));
+
+		if (stop)
+			return i + __builtin_ctz(stop);
+	}
+#else
+	for (; i + sizeof(unsigned long) <= len; i += sizeof(unsigned long)) {
+		unsigned long w;
+
+		memcpy(&w, s + i, sizeof(w));
+		if ((w & REPEAT_BYTE(0x80)) || HAS_ZERO(w))
+			break;
+	}
+#endif
+	for (; i < len; ++i) {
+		if (!s[i] || !isascii(s[i]))
+			break;
+	}
+	return i;
+}
+
+/**
+ * apfs_ascii_fold - Copy a run of ASCII characters, in lower case
+ * @dst:	destination buffer
+ * @src:	ASCII characters to copy, from apfs_ascii_len()
+ * @len:	number of characters
+ */
+static void apfs_ascii_fold(u8 *dst, const u8 *src, int len)
+{
+	int i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+		__m256i upper = _mm256_and_si256(
+			_mm256_cmpgt_epi8(v, _mm256_set1_epi8('A' - 1)),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), v));
+
+		v = _mm256_or_si256(v, _mm256_and_si256(upper,
+						_mm256_set1_epi8(0x20)));
+		_mm256_storeu_si256((__m256i *)(dst + i), v);
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i upper = _mm_and_si128(
+			_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+			_mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+
+		v = _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+		_mm_storeu_si128((__m128i *)(dst + i), v);
+	}
+#else
+	for (; i + sizeof(unsigned long) <= len; i += sizeof(unsigned long)) {
+		unsigned long w, above_z, from_a;
+
+		/* All bytes are ASCII, so no carries between them */
+		memcpy(&w, src + i, sizeof(w));
+		from_a = w + REPEAT_BYTE(0x80 - 'A');
+		above_z = w + REPEAT_BYTE(0x7f - 'Z');
+		w |= ((from_a ^ above_z) & REPEAT_BYTE(0x80)) >> 2;
+		memcpy(dst + i, &w, sizeof(w));
+	}
+#endif
+	for (; i < len; ++i)
+		dst[i] = tolower(src[i]);
+}
+
+/**
+ * apfs_normalize_ascii - Return a run of normalized ASCII characters
+ * @cursor:	unicode cursor for the string
+ * @buf:	buffer for the normalized characters
+ * @buflen:	size of @buf
+ * @case_fold:	case fold the string?
+ *
+ * ASCII characters are starters and are never changed by normalization,
+ * other than by case folding, so a whole run of them can be consumed at once.
+ * Copies the run that begins at @cursor->utf8curr to @buf, up to @buflen
+ * characters, and moves the cursor past it.
+ *
+ * Returns the number of characters copied, which is 0 if the cursor is not
+ * at the start of an ASCII run; apfs_normalize_next() must be called then.
+ */
+int apfs_normalize_ascii(struct apfs_unicursor *cursor, u8 *buf, int buflen,
+			 bool case_fold)
+{
+	const u8 *utf8str = (const u8 *)cursor->utf8curr;
+	int len;
+
+	/* In the middle of a substring */
+	if (cursor->buf_pos < cursor->buf_len || cursor->more)
+		return 0;
+
+	len = cursor->utf8end - cursor->utf8curr;
+	len = apfs_ascii_len(utf8str, len < buflen ? len : buflen);
+	if (case_fold)
+		apfs_ascii_fold(buf, utf8str, len);
+	else
+		memcpy(buf, utf8str, len);
+
+	cursor->utf8curr += len;
+	APFS_COUNT_ADD(ascii_chars, len);
+	return len;
+}
+
+/**
+ * apfs_normalize_next - Return the next normalized character from a string
+ * @cursor:	unicode cursor for the string
+ * @case_fold:	case fold the string?
+ *
+ * Returns a single normalized character, taken from the cursor buffer, which
+ * gets refilled with the next substring as needed. Returns 0 at the end of
+ * the string, or if the substring has invalid UTF-8.
+ */
+unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
+{
+	const char *utf8str = cursor->utf8curr;
+
+	APFS_COUNT(next_calls);
+	if (cursor->buf_pos < cursor->buf_len) {
+		APFS_COUNT(next_chars);
+		return cursor->buf[cursor->buf_pos++] & VALUE_CHAR_MASK;
+	}
+	if (cursor->more)
+		goto fill;
+
+	if (utf8str == cursor->utf8end) {
+		if (!apfs_unicursor_next_seg(cursor))
+			return 0;
+		utf8str = cursor->utf8curr;
+	}
+	if (!*utf8str)
+		return 0;
+	if (likely(isascii(*utf8str))) {
+		cursor->utf8curr = utf8str + 1;
+		APFS_COUNT(next_chars);
+		APFS_COUNT(ascii_chars);
+		if (case_fold)
+			return tolower(*utf8str);
+		return *utf8str;
+	}
+
+	/*
+	 * A two-byte character that is a starter and normalizes to itself can
+	 * also be returned right away, without looking at the rest of the
+	 * substring. Overlong encodings are left for utf8_to_utf32() to reject.
+	 */
+	if (cursor->utf8end - utf8str >= 2 &&
+	    ((u8)utf8str[0] & 0xe0) == 0xc0 &&
+	    ((u8)utf8str[1] & 0xc0) == 0x80) {
+		unicode_t utf32char = ((utf8str[0] & 0x1f) << 6) |
+				      (utf8str[1] & 0x3f);
+		const struct apfs_unidata *data;
+
+		if (utf32char >= UTF8_2BYTE_FIRST) {
+			data = &APFS_TABLE(unidata_2byte)[utf32char -
+							  UTF8_2BYTE_FIRST];
+			if (!data->ccc &&
+			    !(case_fold ? data->nfdcf : data->nfd)) {
+				cursor->utf8curr = utf8str + 2;
+				APFS_COUNT(next_chars);
+				APFS_COUNT(twobyte_chars);
+				return utf32char;
+			}
+		}
+	}
+
+fill:
+	if (apfs_unicursor_fill(cursor, case_fold) <= 0)
+		return 0;
+	APFS_COUNT(next_chars);
+	return cursor->buf[cursor->buf_pos++] & VALUE_CHAR_MASK;
+}
+
+/**
+ * apfs_qc_stable - Check the quick check bitmap for a character
+ * @utf32char:	the character, a valid code point
+ * @case_fold:	check the case folding too?
+ *
+ * Returns true if @utf32char is a starter that normalizes to itself, and
+ * also case folds to itself if @case_fold is set. A false return means that
+ * the normalization data must be looked up to know.
+ */
+static inline bool apfs_qc_stable(unicode_t utf32char, bool case_fold)
+{
+	int block = APFS_TABLE(qc_planes)[utf32char >> 16];
+	int leaf = APFS_TABLE(qc_blocks)[block][(utf32char >> 8) & 0xff];
+	u32 word = APFS_TABLE(qc_leaves)[leaf][(utf32char >> 4) & 0xf];
+
+	return (word >> (((utf32char & 0xf) << 1) + case_fold)) & 1;
+}
+
+/*
+ * The work of apfs_is_normalized(), which only adds the counters. With
+ * @stream_safe set, a run of more than 30 non-starters also fails the check.
+ */
+static bool apfs_quick_check(const char *name, int len, bool case_fold,
+			     bool stream_safe)
+{
+	const u8 *curr = (const u8 *)name;
+	const u8 *end = curr + len;
+	u8 last_ccc = 0;
+	int run = 0;
+
+	while (curr < end && *curr) {
+		const struct apfs_unidata *data;
+		unicode_t utf32char;
+		int runlen, charlen;
+
+		runlen = apfs_ascii_len(curr, end - curr);
+		if (runlen) {
+			if (case_fold) {
+				int i;
+
+				for (i = 0; i < runlen; ++i) {
+					if (curr[i] >= 'A' && curr[i] <= 'Z')
+						return false;
+				}
+			}
+			curr += runlen;
+			last_ccc = run = 0;
+			continue;
+		}
+
+		charlen = utf8_to_utf32(curr, end - curr, &utf32char);
+		if (charlen < 0)
+			return false;
+		APFS_COUNT(decodes);
+		curr += charlen;
+
+		if (apfs_qc_stable(utf32char, case_fold)) {
+			last_ccc = run = 0;
+			continue;
+		}
+		if (apfs_is_precomposed_hangul(utf32char))
+			return false;
+		data = apfs_unidata_find(utf32char);
+		if (case_fold ? data->nfdcf : data->nfd)
+			return false;
+		if (data->ccc && data->ccc < last_ccc)
+			return false;
+		run = data->ccc ? run + 1 : 0;
+		if (stream_safe && run > STREAM_SAFE_MAX)
+			return false;
+		last_ccc = data->ccc;
+	}
+	return true;
+}
+
+/* Run the quick check, and count its result */
+static bool __apfs_is_normalized(const char *name, int len, bool case_fold,
+				 bool stream_safe)
+{
+	bool ret = apfs_quick_check(name, len, case_fold, stream_safe);
+
+	if (ret)
+		APFS_COUNT(quick_yes);
+	else
+		APFS_COUNT(quick_no);
+	return ret;
+}
+
+/**
+ * apfs_is_normalized - Check if a string is its own normalization
+ * @name:	UTF-8 string to check, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	check against the case folded normalization?
+ *
+ * Most names are already normalized, and for those the input bytes can be
+ * used as they are. Each character is only decoded and checked against the
+ * quick check bitmap; the normalization data is looked up just for the few
+ * characters that the bitmap doesn't cover, to confirm that they map to
+ * themselves and that the combining marks are in canonical order.
+ *
+ * Returns true if the normalization of @name is identical to @name, false
+ * if it isn't, or if @name has invalid UTF-8.
+ */
+bool apfs_is_normalized(const char *name, int len, bool case_fold)
+{
+	return __apfs_is_normalized(name, len, case_fold,
+				    false /* stream_safe */);
+}
+
+/**
+ * apfs_put_char - Append a character to the output of a bulk normalization
+ * @dst:	output buffer
+ * @dstlen:	size of @dst in bytes
+ * @pos:	position in @dst for the character
+ * @utf32char:	character to append
+ * @utf8:	encode the character as UTF-8 instead of UTF-32?
+ *
+ * The character is only written if it fits in the buffer. Returns its size.
+ */
+static int apfs_put_char(u8 *dst, int dstlen, int pos, unicode_t utf32char,
+			 bool utf8)
+{
+	u8 utf8buf[4];
+	int len;
+
+	if (!utf8) {
+		if (pos + (int)sizeof(utf32char) <= dstlen)
+			memcpy(dst + pos, &utf32char, sizeof(utf32char));
+		return sizeof(utf32char);
+	}
+
+	len = utf32_to_utf8(utf32char, utf8buf, sizeof(utf8buf));
+	if (pos + len <= dstlen)
+		memcpy(dst + pos, utf8buf, len);
+	return len;
+}
+
+/**
+ * apfs_normalize_string - Normalize a whole string into a buffer
+ * @src:	UTF-8 string to normalize, not necessarily NUL-terminated
+ * @len:	length of @src; a NUL byte also ends the string
+ * @dst:	output buffer
+ * @dstlen:	size of @dst in bytes
+ * @flags:	APFS_NORM_CASE_FOLD to case fold the string, APFS_NORM_UTF8
+ *		to encode the output as UTF-8 instead of an array of unicode_t,
+ *		and APFS_NORM_STREAM_SAFE or APFS_NORM_STREAM_STRICT to limit
+ *		the runs of non-starters, see apfs_unicursor_stream_safe()
+ *
+ * The output is not NUL-terminated. If it doesn't fit in @dstlen bytes, @dst
+ * only holds part of it; the return value is still the full size, so the
+ * caller can retry with a bigger buffer. A NULL @dst with a @dstlen of zero
+ * may be used to just get the size.
+ *
+ * Returns the size of the normalized string in bytes, or -EINVAL if @src is
+ * not valid UTF-8, or is rejected by APFS_NORM_STREAM_STRICT.
+ */
+int apfs_normalize_string(const char *src, int len, void *dst, int dstlen,
+			  unsigned int flags)
+{
+	struct apfs_unicursor cursor;
+	bool case_fold = flags & APFS_NORM_CASE_FOLD;
+	bool utf8 = flags & APFS_NORM_UTF8;
+	bool stream_safe = flags & (APFS_NORM_STREAM_SAFE |
+				    APFS_NORM_STREAM_STRICT);
+	u8 *out = dst;
+	int size = 0;
+
+	/* Already normalized UTF-8 needs no work at all */
+	if (utf8 && __apfs_is_normalized(src, len, case_fold, stream_safe)) {
+		size = strnlen(src, len);
+		if (dstlen)
+			memcpy(dst, src, size < dstlen ? size : dstlen);
+		return size;
+	}
+
+	apfs_init_unicursor_len(&cursor, src, len);
+	if (flags & APFS_NORM_STREAM_STRICT)
+		apfs_unicursor_stream_safe(&cursor, APFS_STREAM_SAFE_STRICT);
+	else if (flags & APFS_NORM_STREAM_SAFE)
+		apfs_unicursor_stream_safe(&cursor, APFS_STREAM_SAFE);
+	while (1) {
+		unicode_t utf32char;
+		u8 run[64];
+		int runlen, i;
+
+		if (utf8 && size < dstlen) {
+			/* ASCII goes straight to the output buffer */
+			runlen = apfs_normalize_ascii(&cursor, out + size,
+						      dstlen - size,
+						      case_fold);
+			size += runlen;
+			if (runlen)
+				continue;
+		}
+
+		runlen = apfs_normalize_ascii(&cursor, run, sizeof(run),
+					      case_fold);
+		for (i = 0; i < runlen; ++i)
+			size += apfs_put_char(out, dstlen, size, run[i], utf8);
+		if (runlen)
+			continue;
+
+		utf32char = apfs_normalize_next(&cursor, case_fold);
+		if (!utf32char)
+			break;
+		size += apfs_put_char(out, dstlen, size, utf32char, utf8);
+	}
+
+	/* The cursor stops early on invalid UTF-8 */
+	if (apfs_unicursor_stopped(&cursor))
+		return -EINVAL;
+	return size;
+}
+
+/* Number of normalized characters hashed at a time */
+#define HASH_CHUNK	16
+
+/* Size of @utf32char in UTF-8, which must be a valid code point */
+static inline int apfs_utf8_size(unicode_t utf32char)
+{
+	if (utf32char < 0x80)
+		return 1;
+	if (utf32char < 0x800)
+		return 2;
+	return utf32char < 0x10000 ? 3 : 4;
+}
+
+/**
+ * apfs_normalize_hash_size - Hash the normalization of a string, and size it
+ * @name:	UTF-8 string to hash, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	case fold the string?
+ * @hash:	on return, the hash of the normalized string
+ *
+ * Computes the CRC32C of the normalized string, as an array of little-endian
+ * UTF-32 characters, without ever holding more than a few of them. The seed
+ * is ~0 and there is no final inversion, so the result matches a crc32c() of
+ * the characters returned by apfs_normalize_next(), one at a time. Like the
+ * cursor, the hash stops before the first substring with invalid UTF-8.
+ *
+ * Returns the size of the normalized string in UTF-8, like the return value
+ * of apfs_normalize_string() with APFS_NORM_UTF8, or -EINVAL if @name is not
+ * valid UTF-8. @hash is set in both cases.
+ */
+int apfs_normalize_hash_size(const char *name, int len, bool case_fold,
+			     u32 *hash)
+{
+	struct apfs_unicursor cursor;
+	__le32 chunk[HASH_CHUNK];
+	u32 crc = ~0;
+	int count = 0, size = 0;
+
+	/*
+	 * The characters of a normalized string are hashed as they are, so
+	 * they only need to be decoded.
+	 */
+	if (apfs_is_normalized(name, len, case_fold)) {
+		const u8 *curr = (const u8 *)name;
+		const u8 *end = curr + len;
+
+		while (curr < end && *curr) {
+			unicode_t utf32char;
+
+			if (count == HASH_CHUNK) {
+				crc = crc32c(crc, chunk, sizeof(chunk));
+				count = 0;
+			}
+			curr += utf8_to_utf32(curr, end - curr, &utf32char);
+			chunk[count++] = cpu_to_le32(utf32char);
+		}
+		*hash = crc32c(crc, chunk, count * sizeof(*chunk));
+		return curr - (const u8 *)name;
+	}
+
+	apfs_init_unicursor_len(&cursor, name, len);
+	while (1) {
+		unicode_t utf32char;
+		u8 run[HASH_CHUNK];
+		int runlen, i;
+
+		if (count == HASH_CHUNK) {
+			crc = crc32c(crc, chunk, sizeof(chunk));
+			count = 0;
+		}
+
+		runlen = apfs_normalize_ascii(&cursor, run, HASH_CHUNK - count,
+					      case_fold);
+		for (i = 0; i < runlen; ++i)
+			chunk[count++] = cpu_to_le32(run[i]);
+		size += runlen;
+		if (runlen)
+			continue;
+
+		utf32char = apfs_normalize_next(&cursor, case_fold);
+		if (!utf32char)
+			break;
+		chunk[count++] = cpu_to_le32(utf32char);
+		size += apfs_utf8_size(utf32char);
+	}
+	*hash = crc32c(crc, chunk, count * sizeof(*chunk));
+
+	/* The cursor stops early on invalid UTF-8 */
+	if (apfs_unicursor_stopped(&cursor))
+		return -EINVAL;
+	return size;
+}
+
+/**
+ * apfs_normalize_hash - Hash the normalization of a string
+ * @name:	UTF-8 string to hash, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	case fold the string?
+ *
+ * Returns the same hash as apfs_normalize_hash_size().
+ */
+u32 apfs_normalize_hash(const char *name, int len, bool case_fold)
+{
+	u32 hash;
+
+	apfs_normalize_hash_size(name, len, case_fold, &hash);
+	return hash;
+}
+
+/**
+ * apfs_normalized_cmp - Compare the normalizations of two strings
+ * @a:		first UTF-8 string, NUL-terminated
+ * @b:		second UTF-8 string, NUL-terminated
+ * @case_fold:	compare the case folded normalizations instead?
+ *
+ * The normalized strings are compared one UTF-32 character at a time, and
+ * only as far as needed to find the first difference. If either string has
+ * invalid UTF-8, the bytes after the last valid substring are compared too,
+ * so that two different invalid names never match.
+ *
+ * Returns 0 if the normalizations are equal; otherwise a negative or positive
+ * value, depending on which string sorts first.
+ */
+int apfs_normalized_cmp(const char *a, const char *b, bool case_fold)
+{
+	struct apfs_unicursor cursor_a, cursor_b;
+	unicode_t char_a, char_b;
+	int len_a, len_b;
+
+	/*
+	 * ASCII characters are starters, so the normalization of an identical
+	 * ASCII prefix is the same on both sides and can be skipped.
+	 */
+	while (*a == *b && *a && isascii(*a)) {
+		a++;
+		b++;
+	}
+
+	/* Keep going with ASCII while it lasts, since it needs no lookups */
+	while (*a && *b && isascii(*a) && isascii(*b)) {
+		char_a = case_fold ? tolower(*a) : *a;
+		char_b = case_fold ? tolower(*b) : *b;
+		if (char_a != char_b)
+			return char_a < char_b ? -1 : 1;
+		a++;
+		b++;
+	}
+	if (!*a || !*b)
+		return (u8)*a - (u8)*b;
+
+	/*
+	 * UTF-8 sorts like the code points, so normalized names need no work.
+	 * The quick check must get the real lengths: it reads whole words,
+	 * and would run past the end of the names.
+	 */
+	len_a = strlen(a);
+	len_b = strlen(b);
+	if (apfs_is_normalized(a, len_a, case_fold) &&
+	    apfs_is_normalized(b, len_b, case_fold))
+		return strcmp(a, b);
+
+	apfs_init_unicursor_len(&cursor_a, a, len_a);
+	apfs_init_unicursor_len(&cursor_b, b, len_b);
+	do {
+		char_a = apfs_normalize_next(&cursor_a, case_fold);
+		char_b = apfs_normalize_next(&cursor_b, case_fold);
+		if (char_a != char_b)
+			return char_a < char_b ? -1 : 1;
+	} while (char_a);
+
+	/* Both cursors stopped, at the end or at some invalid UTF-8 */
+	return strcmp(cursor_a.utf8curr, cursor_b.utf8curr);
+}
+
+#ifdef APFS_LOADABLE_TABLES
+/*
+ * Layout of the binary tables written by "mktrie -o", see the comment there.
+ * The tables are used in place, so the fields are little-endian like the host.
+ */
+#define APFS_UNITABLES_MAGIC	0x42544e55	/* "UNTB" */
+#define APFS_UNITABLES_VERSION	4
+#define APFS_UNITABLES_ALIGN	64
+
+enum {
+	APFS_UNITABLES_TRIE,
+	APFS_UNITABLES_UNIDATA,
+	APFS_UNITABLES_UNIDATA_2BYTE,
+	APFS_UNITABLES_NFD,
+	APFS_UNITABLES_NFDCF,
+	APFS_UNITABLES_QC_PLANES,
+	APFS_UNITABLES_QC_BLOCKS,
+	APFS_UNITABLES_QC_LEAVES,
+	APFS_UNITABLES_NFD_ESC,
+	APFS_UNITABLES_NFDCF_ESC,
+	APFS_UNITABLES_HASH_DISP,
+	APFS_UNITABLES_HASH_SLOTS,
+	APFS_UNITABLES_VALUE_WIDE,
+	APFS_UNITABLES_COUNT
+};
+
+struct apfs_unitables_header {
+	u32 magic;
+	u32 version;
+	u32 size;		/* Size of the whole file */
+	u32 checksum;		/* CRC32C, computed with this field zeroed */
+	u32 trie_height;
+	u8 trie_bits[APFS_UNITABLES_MAX_HEIGHT];
+	u8 trie_shift[APFS_UNITABLES_MAX_HEIGHT];
+	int trie_base[APFS_UNITABLES_MAX_HEIGHT];
+	struct {
+		u32 offset;
+		u32 size;
+	} tables[APFS_UNITABLES_COUNT];
+};
+
+/* Number of planes, and so of entries in the qc_planes table */
+#define APFS_QC_PLANES		17
+
+/* The tables from a file, when apfs_tables points to them */
+static struct apfs_unitables apfs_loaded_tables;
+
+/* The mapping of the file, if it was made by apfs_load_unitables() */
+static void *apfs_unitables_map;
+static size_t apfs_unitables_map_size;
+
+/**
+ * apfs_unitables_find - Find one of the tables in a binary table file
+ * @blob:	contents of the file
+ * @table:	index of the table in the header
+ * @elem_size:	size of each element of the table
+ * @count:	on return, the number of elements
+ *
+ * Returns a pointer to the table, or NULL if it's out of bounds or not made
+ * of whole elements.
+ */
+static const void *apfs_unitables_find(const u8 *blob, int table,
+				       size_t elem_size, long *count)
+{
+	const struct apfs_unitables_header *hdr = (const void *)blob;
+	u32 offset = hdr->tables[table].offset;
+	u32 size = hdr->tables[table].size;
+
+	if (offset % APFS_UNITABLES_ALIGN || offset < sizeof(*hdr) ||
+	    offset > hdr->size || size > hdr->size - offset ||
+	    size % elem_size)
+		return NULL;
+	*count = size / elem_size;
+	return blob + offset;
+}
+
+/*
+ * Check that every lookup that goes through the row of @node, on trie level
+ * @level, stays inside the trie and ends on an existing record.
+ */
+static bool apfs_unitables_walk(const struct apfs_unitables *tables,
+				long trie_count, long unidata_count,
+				int level, long node)
+{
+	int bits = tables->trie_bits[level];
+	long start = tables->trie_base[level] + (node << bits);
+	int i;
+
+	if (start < 0 || start + (1 << bits) > trie_count)
+		return false;
+	for (i = 0; i < 1 << bits; ++i) {
+		long child = tables->trie[start + i];
+
+		if (level == tables->trie_height - 1) {
+			if (child >= unidata_count)
+				return false;
+		} else if (child && !apfs_unitables_walk(tables, trie_count,
+							 unidata_count,
+							 level + 1, child)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+ * Check that the entries of an escape array point inside the value array, and
+ * that the values fit the buffers of the runtime code.
+ */
+static bool apfs_escapes_valid(const u32 *esc, long esc_count, long count)
+{
+	long i;
+
+	/* The first entry is never used */
+	for (i = 1; i < esc_count; ++i) {
+		long pos = esc[i] >> ESC_POS_SHIFT;
+		long len = esc[i] & ESC_SIZE_MASK;
+
+		if (len > APFS_VALUE_MAX_LEN || pos + len > count)
+			return false;
+	}
+	return true;
+}
+
+/* Check that an encoded value points inside its value or escape array */
+static bool apfs_value_valid(u16 value, long count, long esc_count)
+{
+	long pos = value >> TRIE_POS_SHIFT;
+	long len = value & TRIE_SIZE_MASK;
+
+	if (value && !len)
+		return pos < esc_count;
+	return pos + len <= count;
+}
+
+/*
+ * Check that all entries of a value array are characters, or point inside the
+ * wide value array.
+ */
+static bool apfs_values_valid(const u16 *values, long count, long wide_count)
+{
+	long i;
+
+	for (i = 0; i < count; ++i) {
+		u16 wide = values[i] - VALUE_WIDE_FIRST;
+
+		if (!values[i] ||
+		    (wide < VALUE_WIDE_COUNT && wide >= wide_count))
+			return false;
+	}
+	return true;
+}
+
+/* Check that all entries of the wide value array are characters */
+static bool apfs_wide_valid(const u32 *wide, long wide_count)
+{
+	long i;
+
+	for (i = 0; i < wide_count; ++i) {
+		unicode_t utf32char = wide[i] & VALUE_CHAR_MASK;
+
+		if (!utf32char || utf32char > 0x10ffff)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * apfs_unitables_parse - Check a binary table file, and find its tables
+ * @blob:	contents of the file
+ * @size:	size of @blob
+ * @tables:	on return, the tables inside @blob
+ *
+ * Besides the checksum, every index stored in the tables is checked against
+ * the size of the table it points to, so that the lookups can never read out
+ * of bounds, even if the file was not built by mktrie.
+ *
+ * Returns 0 on success, or -EINVAL if @blob is not valid.
+ */
+static int apfs_unitables_parse(const u8 *blob, size_t size,
+				struct apfs_unitables *tables)
+{
+	const struct apfs_unitables_header *hdr = (const void *)blob;
+	struct apfs_unitables_header copy;
+	long trie_count = 0, unidata_count = 0, twobyte_count = 0;
+	long nfd_count = 0, nfdcf_count = 0, wide_count = 0;
+	long nfd_esc_count = 0, nfdcf_esc_count = 0;
+	long disp_count = 0, slot_count = 0;
+	long plane_count = 0, block_count = 0, leaf_count = 0;
+	long i;
+	int bits, h;
+	u32 crc;
+
+	if (cpu_to_le32(1) != 1)
+		return -EINVAL;
+	if ((unsigned long)blob % APFS_UNITABLES_ALIGN || size < sizeof(*hdr))
+		return -EINVAL;
+	if (hdr->magic != APFS_UNITABLES_MAGIC ||
+	    hdr->version != APFS_UNITABLES_VERSION ||
+	    hdr->size < sizeof(*hdr) || hdr->size > size)
+		return -EINVAL;
+
+	memcpy(&copy, hdr, sizeof(copy));
+	copy.checksum = 0;
+	crc = crc32c(~0, &copy, sizeof(copy));
+	crc = crc32c(crc, blob + sizeof(copy), hdr->size - sizeof(copy));
+	if (crc != hdr->checksum)
+		return -EINVAL;
+
+	/* The levels must split the bits of the characters among them */
+	if (hdr->trie_height < 1 ||
+	    hdr->trie_height > APFS_UNITABLES_MAX_HEIGHT)
+		return -EINVAL;
+	bits = 0;
+	for (h = hdr->trie_height - 1; h >= 0; --h) {
+		if (!hdr->trie_bits[h] || hdr->trie_shift[h] != bits)
+			return -EINVAL;
+		bits += hdr->trie_bits[h];
+	}
+	if (bits != 21)
+		return -EINVAL;
+	tables->trie_height = hdr->trie_height;
+	tables->trie_bits = hdr->trie_bits;
+	tables->trie_shift = hdr->trie_shift;
+	tables->trie_base = hdr->trie_base;
+
+	tables->trie = apfs_unitables_find(blob, APFS_UNITABLES_TRIE,
+					   sizeof(*tables->trie), &trie_count);
+	tables->unidata = apfs_unitables_find(blob, APFS_UNITABLES_UNIDATA,
+					      sizeof(*tables->unidata),
+					      &unidata_count);
+	tables->unidata_2byte = apfs_unitables_find(blob,
+					APFS_UNITABLES_UNIDATA_2BYTE,
+					sizeof(*tables->unidata_2byte),
+					&twobyte_count);
+	tables->nfd = apfs_unitables_find(blob, APFS_UNITABLES_NFD,
+					  sizeof(*tables->nfd), &nfd_count);
+	tables->nfdcf = apfs_unitables_find(blob, APFS_UNITABLES_NFDCF,
+					    sizeof(*tables->nfdcf),
+					    &nfdcf_count);
+	tables->nfd_esc = apfs_unitables_find(blob, APFS_UNITABLES_NFD_ESC,
+					      sizeof(*tables->nfd_esc),
+					      &nfd_esc_count);
+	tables->nfdcf_esc = apfs_unitables_find(blob, APFS_UNITABLES_NFDCF_ESC,
+						sizeof(*tables->nfdcf_esc),
+						&nfdcf_esc_count);
+	tables->qc_planes = apfs_unitables_find(blob, APFS_UNITABLES_QC_PLANES,
+						sizeof(*tables->qc_planes),
+						&plane_count);
+	tables->qc_blocks = apfs_unitables_find(blob, APFS_UNITABLES_QC_BLOCKS,
+						sizeof(*tables->qc_blocks),
+						&block_count);
+	tables->qc_leaves = apfs_unitables_find(blob, APFS_UNITABLES_QC_LEAVES,
+						sizeof(*tables->qc_leaves),
+						&leaf_count);
+	tables->hash_disp = apfs_unitables_find(blob, APFS_UNITABLES_HASH_DISP,
+						sizeof(*tables->hash_disp),
+						&disp_count);
+	tables->hash_slots = apfs_unitables_find(blob,
+						 APFS_UNITABLES_HASH_SLOTS,
+						 sizeof(*tables->hash_slots),
+						 &slot_count);
+	tables->value_wide = apfs_unitables_find(blob,
+						 APFS_UNITABLES_VALUE_WIDE,
+						 sizeof(*tables->value_wide),
+						 &wide_count);
+	if (!tables->trie || !tables->unidata || !tables->unidata_2byte ||
+	    !tables->nfd || !tables->nfdcf || !tables->nfd_esc ||
+	    !tables->nfdcf_esc || !tables->qc_planes ||
+	    !tables->qc_blocks || !tables->qc_leaves ||
+	    !tables->hash_disp || !tables->hash_slots || !tables->value_wide)
+		return -EINVAL;
+	if (twobyte_count != UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST + 1 ||
+	    plane_count != APFS_QC_PLANES || !unidata_count ||
+	    !disp_count || !slot_count)
+		return -EINVAL;
+	tables->hash_buckets = disp_count;
+	tables->hash_size = slot_count;
+
+	if (!apfs_unitables_walk(tables, trie_count, unidata_count, 0, 0))
+		return -EINVAL;
+	for (i = 0; i < slot_count; ++i) {
+		if (tables->hash_slots[i] >> HASH_KEY_BITS >= unidata_count)
+			return -EINVAL;
+	}
+	if (!apfs_escapes_valid(tables->nfd_esc, nfd_esc_count, nfd_count) ||
+	    !apfs_escapes_valid(tables->nfdcf_esc, nfdcf_esc_count,
+				nfdcf_count))
+		return -EINVAL;
+	for (i = 0; i < unidata_count + twobyte_count; ++i) {
+		const struct apfs_unidata *data = i < unidata_count ?
+			&tables->unidata[i] :
+			&tables->unidata_2byte[i - unidata_count];
+
+		if (!apfs_value_valid(data->nfd, nfd_count, nfd_esc_count) ||
+		    !apfs_value_valid(data->nfdcf, nfdcf_count,
+				      nfdcf_esc_count))
+			return -EINVAL;
+	}
+	if (!apfs_values_valid(tables->nfd, nfd_count, wide_count) ||
+	    !apfs_values_valid(tables->nfdcf, nfdcf_count, wide_count) ||
+	    !apfs_wide_valid(tables->value_wide, wide_count))
+		return -EINVAL;
+
+	for (i = 0; i < plane_count; ++i) {
+		if (tables->qc_planes[i] >= block_count)
+			return -EINVAL;
+	}
+	for (i = 0; i < block_count * 256; ++i) {
+		if (tables->qc_blocks[i / 256][i % 256] >= leaf_count)
+			return -EINVAL;
+	}
+	return 0;
+}
+
+/**
+ * apfs_use_unitables - Switch to the tables in a binary table file
+ * @blob:	contents of the file, aligned to a cache line
+ * @size:	size of @blob
+ *
+ * The tables are checked and then used in place, without copying, so @blob
+ * must remain valid until they are replaced. The tables can only be switched
+ * while no normalization is running on any thread.
+ *
+ * Returns 0 on success, or -EINVAL if @blob is not a valid table file; the
+ * tables in use are left alone in that case.
+ */
+int apfs_use_unitables(const void *blob, size_t size)
+{
+	struct apfs_unitables tables;
+	int err;
+
+	err = apfs_unitables_parse(blob, size, &tables);
+	if (err)
+		return err;
+	apfs_unload_unitables();
+	apfs_loaded_tables = tables;
+	apfs_tables = &apfs_loaded_tables;
+	return 0;
+}
+
+/**
+ * apfs_load_unitables - Map a binary table file and switch to its tables
+ * @path:	path to the file, written by "mktrie -o"
+ *
+ * The file is mapped read-only and shared, so all processes that load the
+ * same file also share a single copy of the tables in the page cache. Like
+ * apfs_use_unitables(), this may only be called while no normalization is
+ * running on any thread.
+ *
+ * Returns 0 on success, -EIO if the file can't be mapped, or -EINVAL if it's
+ * not a valid table file; the tables in use are left alone on failure.
+ */
+int apfs_load_unitables(const char *path)
+{
+	struct stat st;
+	void *map;
+	int fd, err;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return -EIO;
+	if (fstat(fd, &st) || st.st_size <= 0) {
+		close(fd);
+		return -EIO;
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return -EIO;
+
+	err = apfs_use_unitables(map, st.st_size);
+	if (err) {
+		munmap(map, st.st_size);
+		return err;
+	}
+	apfs_unitables_map = map;
+	apfs_unitables_map_size = st.st_size;
+	return 0;
+}
+
+/**
+ * apfs_unload_unitables - Go back to the built-in tables
+ *
+ * If the tables in use were mapped by apfs_load_unitables(), the mapping is
+ * removed. No normalization may be running on any thread.
+ */
+void apfs_unload_unitables(void)
+{
+	apfs_tables = &apfs_builtin_tables;
+	if (apfs_unitables_map)
+		munmap(apfs_unitables_map, apfs_unitables_map_size);
+	apfs_unitables_map = NULL;
+	apfs_unitables_map_size = 0;
+}
+#endif	/* APFS_LOADABLE_TABLES */
+
+/*
+ * The following arrays were built with data provided by the Unicode Standard,
+ * version 9.0.
+ *
+ * Copyright (C) 1991-2018 Unicode, Inc.  All rights reserved.  Distributed
+ * under the Terms of Use in http://www.unicode.org/copyright.html.
+ */
+
+static const u16 apfs_trie[] __aligned(64) = {
+	/* Node for range 0x000000-0x1fffff */
+	0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008,
+	0x0009, 0x000a, 0x0000, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0000, 0x0000, 0x0013, 0x0014, 0x0000,
+	0x0015, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0016, 0x0017, 0x0018, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0019, 0x001a, 0x0000, 0x001b,
+	0x001c, 0x001d, 0x001e, 0x0000, 0x0000, 0x001f, 0x0020, 0x0000,
+	0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0000, 0x0026, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0027, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0028, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0029, 0x002a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x002b, 0x0000, 0x0000, 0x0000, 0x002c, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x002e, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000000-0x0001ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	/* Node for range 0x000200-0x0003ff */
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+	0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c,
+	/* Node for range 0x000400-0x0005ff */
+	0x002d, 0x002e, 0x002f, 0x0030, 0x0000, 0x0031, 0x0032, 0x0033,
+	0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b,
+	0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0000, 0x0000,
+	0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000600-0x0007ff */
+	0x0000, 0x0047, 0x0048, 0x0000, 0x0049, 0x004a, 0x0000, 0x004b,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x004c, 0x004d, 0x004e, 0x0000,
+	0x0000, 0x004f, 0x0000, 0x0050, 0x0051, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0052, 0x0053,
+	/* Node for range 0x000800-0x0009ff */
+	0x0000, 0x0054, 0x0055, 0x0000, 0x0000, 0x0056, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0057, 0x0058, 0x0059,
+	0x0000, 0x0000, 0x005a, 0x005b, 0x005c, 0x005d, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x005e, 0x005f, 0x0060, 0x0000, 0x0000,
+	/* Node for range 0x000a00-0x000bff */
+	0x0000, 0x0000, 0x0000, 0x0061, 0x005c, 0x0062, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x005e, 0x005c, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x005e, 0x0063, 0x0064, 0x0000, 0x0000,
+	0x0000, 0x0065, 0x0000, 0x0000, 0x0066, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000c00-0x000dff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0067, 0x0068, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x005e, 0x0069, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x006a, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x006b, 0x006c, 0x0000, 0x0000,
+	/* Node for range 0x000e00-0x000fff */
+	0x0000, 0x0000, 0x0000, 0x006d, 0x006e, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x006f, 0x0070, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0071, 0x0000, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+	0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001000-0x0011ff */
+	0x0000, 0x0000, 0x007c, 0x007d, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x007e, 0x0000, 0x007f, 0x0080, 0x0081, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001200-0x0013ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0083,
+	/* Node for range 0x001600-0x0017ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0084, 0x0000, 0x0084, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0085, 0x0000, 0x0000,
+	/* Node for range 0x001800-0x0019ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0087, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001a00-0x001bff */
+	0x0000, 0x0088, 0x0000, 0x0000, 0x0000, 0x0000, 0x0089, 0x008a,
+	0x0000, 0x0000, 0x0000, 0x008b, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x008c, 0x008d, 0x0000, 0x008e, 0x008f, 0x0000, 0x0090, 0x0091,
+	0x0000, 0x0000, 0x0092, 0x0000, 0x0000, 0x0000, 0x0093, 0x0094,
+	/* Node for range 0x001c00-0x001dff */
+	0x0000, 0x0000, 0x0000, 0x0095, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0096, 0x0000, 0x0000, 0x0000, 0x0000, 0x0097, 0x0098, 0x0099,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x009a, 0x009b, 0x001d, 0x009c,
+	/* Node for range 0x001e00-0x001fff */
+	0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4,
+	0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac,
+	0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4,
+	0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc,
+	/* Node for range 0x002000-0x0021ff */
+	0x00bd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00be, 0x00bf, 0x00c0,
+	0x0000, 0x0000, 0x00c1, 0x00c2, 0x0000, 0x0000, 0x00c3, 0x0000,
+	0x00c4, 0x00c5, 0x00c6, 0x0000, 0x00c7, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002200-0x0023ff */
+	0x00c8, 0x0000, 0x00c9, 0x0000, 0x00ca, 0x0000, 0x00cb, 0x00cc,
+	0x00cd, 0x0000, 0x00ce, 0x0000, 0x0000, 0x0000, 0x00cf, 0x0000,
+	0x0000, 0x0000, 0x00d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002400-0x0025ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x00d1, 0x00d2, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002a00-0x002bff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00d3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002c00-0x002dff */
+	0x00d4, 0x00d5, 0x00d6, 0x0000, 0x0000, 0x0000, 0x00d7, 0x00d8,
+	0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e1,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001d, 0x001d,
+	/* Node for range 0x003000-0x0031ff */
+	0x0000, 0x0000, 0x00e2, 0x0000, 0x00e3, 0x00e4, 0x00e5, 0x00e6,
+	0x0000, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x0000, 0x00ec,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00a600-0x00a7ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x00ed, 0x00ee, 0x00ef, 0x00f0,
+	0x00f1, 0x00f2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00f3,
+	0x0000, 0x0000, 0x00f4, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9,
+	0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00a800-0x00a9ff */
+	0x00fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0084, 0x0000, 0x001d, 0x00f3,
+	0x0000, 0x0000, 0x00ff, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0101, 0x0089, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00aa00-0x00abff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0102, 0x0103, 0x0000, 0x0000, 0x00fe,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0104,
+	0x0105, 0x0106, 0x0107, 0x0108, 0x0000, 0x0000, 0x005c, 0x0000,
+	/* Node for range 0x00f800-0x00f9ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0109, 0x010a, 0x010b, 0x010c, 0x010d, 0x010e, 0x010f, 0x0110,
+	0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118,
+	/* Node for range 0x00fa00-0x00fbff */
+	0x0119, 0x011a, 0x011b, 0x011c, 0x011d, 0x011e, 0x011f, 0x0120,
+	0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0000, 0x0000,
+	0x0127, 0x0128, 0x0129, 0x012a, 0x012b, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00fe00-0x00ffff */
+	0x0000, 0x0000, 0x012c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x012d, 0x012e, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x010000-0x0101ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e,
+	/* Node for range 0x010200-0x0103ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012f, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0130,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x010400-0x0105ff */
+	0x0131, 0x0132, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0134, 0x0135, 0x0136, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x010a00-0x010bff */
+	0x0137, 0x0000, 0x0000, 0x0138, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0139, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x010c00-0x010dff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x013a, 0x013b, 0x013c, 0x013d, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011000-0x0111ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x0000, 0x0000, 0x00e1,
+	0x0000, 0x013e, 0x013f, 0x0140, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0141, 0x0000, 0x0142, 0x0143, 0x0000, 0x0000, 0x0000, 0x0101,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0144, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011200-0x0113ff */
+	0x0000, 0x0000, 0x0000, 0x0145, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0146, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x005e, 0x0147, 0x0000, 0x0148, 0x0149,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011400-0x0115ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x014a, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x014b, 0x014c, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x014d, 0x014e, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011600-0x0117ff */
+	0x0000, 0x0000, 0x0000, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x014f, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0150, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011800-0x0119ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0151, 0x0152, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011c00-0x011dff */
+	0x0000, 0x0000, 0x0000, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x016a00-0x016bff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0153,
+	0x0000, 0x0000, 0x0000, 0x0154, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01bc00-0x01bdff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0155, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01d000-0x01d1ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0156, 0x0157, 0x0158,
+	0x0159, 0x0000, 0x015a, 0x015b, 0x015c, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01d200-0x01d3ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x015d, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01e000-0x01e1ff */
+	0x015e, 0x015f, 0x0160, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01e800-0x01e9ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0161, 0x0000, 0x0000,
+	0x0162, 0x0163, 0x0164, 0x0000, 0x0165, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x02f800-0x02f9ff */
+	0x0166, 0x0167, 0x0168, 0x0169, 0x016a, 0x016b, 0x016c, 0x016d,
+	0x016e, 0x016f, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174, 0x0175,
+	0x0176, 0x0177, 0x0178, 0x0179, 0x017a, 0x017b, 0x017c, 0x017d,
+	0x017e, 0x017f, 0x0180, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185,
+	/* Node for range 0x02fa00-0x02fbff */
+	0x0186, 0x0187, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000040-0x00004f */
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	/* Node for range 0x000050-0x00005f */
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0000b0-0x0000bf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001b, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0000c0-0x0000cf */
+	0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023,
+	0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+	/* Node for range 0x0000d0-0x0000df */
+	0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0000,
+	0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a,
+	/* Node for range 0x0000e0-0x0000ef */
+	0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0000, 0x0041,
+	0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+	/* Node for range 0x0000f0-0x0000ff */
+	0x0000, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0000,
+	0x0000, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0000, 0x0055,
+	/* Node for range 0x000100-0x00010f */
+	0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d,
+	0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	/* Node for range 0x000110-0x00011f */
+	0x0066, 0x0000, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c,
+	0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074,
+	/* Node for range 0x000120-0x00012f */
+	0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x0000,
+	0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083,
+	/* Node for range 0x000130-0x00013f */
+	0x0084, 0x0000, 0x0085, 0x0000, 0x0086, 0x0087, 0x0088, 0x0089,
+	0x0000, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090,
+	/* Node for range 0x000140-0x00014f */
+	0x0000, 0x0091, 0x0000, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096,
+	0x0097, 0x0098, 0x0099, 0x0000, 0x009a, 0x009b, 0x009c, 0x009d,
+	/* Node for range 0x000150-0x00015f */
+	0x009e, 0x009f, 0x00a0, 0x0000, 0x00a1, 0x00a2, 0x00a3, 0x00a4,
+	0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac,
+	/* Node for range 0x000160-0x00016f */
+	0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x0000,
+	0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb,
+	/* Node for range 0x000170-0x00017f */
+	0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3,
+	0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb,
+	/* Node for range 0x000180-0x00018f */
+	0x0000, 0x00cc, 0x00cd, 0x0000, 0x00ce, 0x0000, 0x00cf, 0x00d0,
+	0x0000, 0x00d1, 0x00d2, 0x00d3, 0x0000, 0x0000, 0x00d4, 0x00d5,
+	/* Node for range 0x000190-0x00019f */
+	0x00d6, 0x00d7, 0x0000, 0x00d8, 0x00d9, 0x0000, 0x00da, 0x00db,
+	0x00dc, 0x0000, 0x0000, 0x0000, 0x00dd, 0x00de, 0x0000, 0x00df,
+	/* Node for range 0x0001a0-0x0001af */
+	0x00e0, 0x00e1, 0x00e2, 0x0000, 0x00e3, 0x0000, 0x00e4, 0x00e5,
+	0x0000, 0x00e6, 0x0000, 0x0000, 0x00e7, 0x0000, 0x00e8, 0x00e9,
+	/* Node for range 0x0001b0-0x0001bf */
+	0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x0000, 0x00ee, 0x0000, 0x00ef,
+	0x00f0, 0x0000, 0x0000, 0x0000, 0x00f1, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0001c0-0x0001cf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x00f2, 0x00f3, 0x0000, 0x00f4,
+	0x00f5, 0x0000, 0x00f6, 0x00f7, 0x0000, 0x00f8, 0x00f9, 0x00fa,
+	/* Node for range 0x0001d0-0x0001df */
+	0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0101, 0x0102,
+	0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0000, 0x0108, 0x0109,
+	/* Node for range 0x0001e0-0x0001ef */
+	0x010a, 0x010b, 0x010c, 0x010d, 0x010e, 0x0000, 0x010f, 0x0110,
+	0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118,
+	/* Node for range 0x0001f0-0x0001ff */
+	0x0119, 0x011a, 0x011b, 0x0000, 0x011c, 0x011d, 0x011e, 0x011f,
+	0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127,
+	/* Node for range 0x000200-0x00020f */
+	0x0128, 0x0129, 0x012a, 0x012b, 0x012c, 0x012d, 0x012e, 0x012f,
+	0x0130, 0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137,
+	/* Node for range 0x000210-0x00021f */
+	0x0138, 0x0139, 0x013a, 0x013b, 0x013c, 0x013d, 0x013e, 0x013f,
+	0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0000, 0x0145, 0x0146,
+	/* Node for range 0x000220-0x00022f */
+	0x0147, 0x0000, 0x0148, 0x0000, 0x0149, 0x0000, 0x014a, 0x014b,
+	0x014c, 0x014d, 0x014e, 0x014f, 0x0150, 0x0151, 0x0152, 0x0153,
+	/* Node for range 0x000230-0x00023f */
+	0x0154, 0x0155, 0x0156, 0x0157, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0158, 0x0159, 0x0000, 0x015a, 0x015b, 0x0000,
+	/* Node for range 0x000240-0x00024f */
+	0x0000, 0x015c, 0x0000, 0x015d, 0x015e, 0x015f, 0x0160, 0x0000,
+	0x0161, 0x0000, 0x0162, 0x0000, 0x0163, 0x0000, 0x0164, 0x0000,
+	/* Node for range 0x000300-0x00030f and 4 more */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x000310-0x00031f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0166, 0x0167, 0x0167,
+	0x0167, 0x0167, 0x0166, 0x0168, 0x0167, 0x0167, 0x0167, 0x0167,
+	/* Node for range 0x000320-0x00032f */
+	0x0167, 0x0169, 0x0169, 0x0167, 0x0167, 0x0167, 0x0167, 0x0169,
+	0x0169, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167,
+	/* Node for range 0x000330-0x00033f */
+	0x0167, 0x0167, 0x0167, 0x0167, 0x016a, 0x016a, 0x016a, 0x016a,
+	0x016a, 0x0167, 0x0167, 0x0167, 0x0167, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x000340-0x00034f */
+	0x016b, 0x016c, 0x0165, 0x016d, 0x016e, 0x016f, 0x0165, 0x0167,
+	0x0167, 0x0167, 0x0165, 0x0165, 0x0165, 0x0167, 0x0167, 0x0000,
+	/* Node for range 0x000350-0x00035f */
+	0x0165, 0x0165, 0x0165, 0x0167, 0x0167, 0x0167, 0x0167, 0x0165,
+	0x0166, 0x0167, 0x0167, 0x0165, 0x0170, 0x0171, 0x0171, 0x0170,
+	/* Node for range 0x000360-0x00036f */
+	0x0171, 0x0171, 0x0170, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x000370-0x00037f */
+	0x0172, 0x0000, 0x0173, 0x0000, 0x0174, 0x0000, 0x0175, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0176, 0x0177,
+	/* Node for range 0x000380-0x00038f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0178, 0x0179, 0x017a,
+	0x017b, 0x017c, 0x017d, 0x0000, 0x017e, 0x0000, 0x017f, 0x0180,
+	/* Node for range 0x000390-0x00039f */
+	0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 0x0186, 0x0187, 0x0188,
+	0x0189, 0x018a, 0x018b, 0x018c, 0x018d, 0x018e, 0x018f, 0x0190,
+	/* Node for range 0x0003a0-0x0003af */
+	0x0191, 0x0192, 0x0000, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197,
+	0x0198, 0x0199, 0x019a, 0x019b, 0x019c, 0x019d, 0x019e, 0x019f,
+	/* Node for range 0x0003b0-0x0003bf */
+	0x01a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0003c0-0x0003cf */
+	0x0000, 0x0000, 0x01a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x01a2, 0x01a3, 0x01a4, 0x01a5, 0x01a6, 0x01a7,
+	/* Node for range 0x0003d0-0x0003df */
+	0x01a8, 0x01a9, 0x0000, 0x01aa, 0x01ab, 0x01ac, 0x01ad, 0x0000,
+	0x01ae, 0x0000, 0x01af, 0x0000, 0x01b0, 0x0000, 0x01b1, 0x0000,
+	/* Node for range 0x0003e0-0x0003ef */
+	0x01b2, 0x0000, 0x01b3, 0x0000, 0x01b4, 0x0000, 0x01b5, 0x0000,
+	0x01b6, 0x0000, 0x01b7, 0x0000, 0x01b8, 0x0000, 0x01b9, 0x0000,
+	/* Node for range 0x0003f0-0x0003ff */
+	0x01ba, 0x01bb, 0x0000, 0x0000, 0x01bc, 0x01bd, 0x0000, 0x01be,
+	0x0000, 0x01bf, 0x01c0, 0x0000, 0x0000, 0x01c1, 0x01c2, 0x01c3,
+	/* Node for range 0x000400-0x00040f */
+	0x01c4, 0x01c5, 0x01c6, 0x01c7, 0x01c8, 0x01c9, 0x01ca, 0x01cb,
+	0x01cc, 0x01cd, 0x01ce, 0x01cf, 0x01d0, 0x01d1, 0x01d2, 0x01d3,
+	/* Node for range 0x000410-0x00041f */
+	0x01d4, 0x01d5, 0x01d6, 0x01d7, 0x01d8, 0x01d9, 0x01da, 0x01db,
+	0x01dc, 0x01dd, 0x01de, 0x01df, 0x01e0, 0x01e1, 0x01e2, 0x01e3,
+	/* Node for range 0x000420-0x00042f */
+	0x01e4, 0x01e5, 0x01e6, 0x01e7, 0x01e8, 0x01e9, 0x01ea, 0x01eb,
+	0x01ec, 0x01ed, 0x01ee, 0x01ef, 0x01f0, 0x01f1, 0x01f2, 0x01f3,
+	/* Node for range 0x000430-0x00043f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x01f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000450-0x00045f */
+	0x01f5, 0x01f6, 0x0000, 0x01f7, 0x0000, 0x0000, 0x0000, 0x01f8,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x01f9, 0x01fa, 0x01fb, 0x0000,
+	/* Node for range 0x000460-0x00046f */
+	0x01fc, 0x0000, 0x01fd, 0x0000, 0x01fe, 0x0000, 0x01ff, 0x0000,
+	0x0200, 0x0000, 0x0201, 0x0000, 0x0202, 0x0000, 0x0203, 0x0000,
+	/* Node for range 0x000470-0x00047f */
+	0x0204, 0x0000, 0x0205, 0x0000, 0x0206, 0x0000, 0x0207, 0x0208,
+	0x0209, 0x0000, 0x020a, 0x0000, 0x020b, 0x0000, 0x020c, 0x0000,
+	/* Node for range 0x000480-0x00048f */
+	0x020d, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0000, 0x0000, 0x020e, 0x0000, 0x020f, 0x0000, 0x0210, 0x0000,
+	/* Node for range 0x000490-0x00049f */
+	0x0211, 0x0000, 0x0212, 0x0000, 0x0213, 0x0000, 0x0214, 0x0000,
+	0x0215, 0x0000, 0x0216, 0x0000, 0x0217, 0x0000, 0x0218, 0x0000,
+	/* Node for range 0x0004a0-0x0004af */
+	0x0219, 0x0000, 0x021a, 0x0000, 0x021b, 0x0000, 0x021c, 0x0000,
+	0x021d, 0x0000, 0x021e, 0x0000, 0x021f, 0x0000, 0x0220, 0x0000,
+	/* Node for range 0x0004b0-0x0004bf */
+	0x0221, 0x0000, 0x0222, 0x0000, 0x0223, 0x0000, 0x0224, 0x0000,
+	0x0225, 0x0000, 0x0226, 0x0000, 0x0227, 0x0000, 0x0228, 0x0000,
+	/* Node for range 0x0004c0-0x0004cf */
+	0x0229, 0x022a, 0x022b, 0x022c, 0x0000, 0x022d, 0x0000, 0x022e,
+	0x0000, 0x022f, 0x0000, 0x0230, 0x0000, 0x0231, 0x0000, 0x0000,
+	/* Node for range 0x0004d0-0x0004df */
+	0x0232, 0x0233, 0x0234, 0x0235, 0x0236, 0x0000, 0x0237, 0x0238,
+	0x0239, 0x0000, 0x023a, 0x023b, 0x023c, 0x023d, 0x023e, 0x023f,
+	/* Node for range 0x0004e0-0x0004ef */
+	0x0240, 0x0000, 0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246,
+	0x0247, 0x0000, 0x0248, 0x0249, 0x024a, 0x024b, 0x024c, 0x024d,
+	/* Node for range 0x0004f0-0x0004ff */
+	0x024e, 0x024f, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0000,
+	0x0255, 0x0256, 0x0257, 0x0000, 0x0258, 0x0000, 0x0259, 0x0000,
+	/* Node for range 0x000500-0x00050f */
+	0x025a, 0x0000, 0x025b, 0x0000, 0x025c, 0x0000, 0x025d, 0x0000,
+	0x025e, 0x0000, 0x025f, 0x0000, 0x0260, 0x0000, 0x0261, 0x0000,
+	/* Node for range 0x000510-0x00051f */
+	0x0262, 0x0000, 0x0263, 0x0000, 0x0264, 0x0000, 0x0265, 0x0000,
+	0x0266, 0x0000, 0x0267, 0x0000, 0x0268, 0x0000, 0x0269, 0x0000,
+	/* Node for range 0x000520-0x00052f */
+	0x026a, 0x0000, 0x026b, 0x0000, 0x026c, 0x0000, 0x026d, 0x0000,
+	0x026e, 0x0000, 0x026f, 0x0000, 0x0270, 0x0000, 0x0271, 0x0000,
+	/* Node for range 0x000530-0x00053f */
+	0x0000, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278,
+	0x0279, 0x027a, 0x027b, 0x027c, 0x027d, 0x027e, 0x027f, 0x0280,
+	/* Node for range 0x000540-0x00054f */
+	0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286, 0x0287, 0x0288,
+	0x0289, 0x028a, 0x028b, 0x028c, 0x028d, 0x028e, 0x028f, 0x0290,
+	/* Node for range 0x000550-0x00055f */
+	0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000580-0x00058f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0298,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000590-0x00059f */
+	0x0000, 0x0167, 0x0165, 0x0165, 0x0165, 0x0165, 0x0167, 0x0165,
+	0x0165, 0x0165, 0x0299, 0x0167, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x0005a0-0x0005af */
+	0x0165, 0x0165, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167,
+	0x0165, 0x0165, 0x0167, 0x0165, 0x0165, 0x0299, 0x029a, 0x0165,
+	/* Node for range 0x0005b0-0x0005bf */
+	0x029b, 0x029c, 0x029d, 0x029e, 0x029f, 0x02a0, 0x02a1, 0x02a2,
+	0x02a3, 0x02a4, 0x02a4, 0x02a5, 0x02a6, 0x02a7, 0x0000, 0x02a8,
+	/* Node for range 0x0005c0-0x0005cf */
+	0x0000, 0x02a9, 0x02aa, 0x0000, 0x0165, 0x0167, 0x0000, 0x02a3,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000610-0x00061f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x02ab, 0x02ac, 0x02ad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000620-0x00062f */
+	0x0000, 0x0000, 0x02ae, 0x02af, 0x02b0, 0x02b1, 0x02b2, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000640-0x00064f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x02b3, 0x02b4, 0x02b5, 0x02ab, 0x02ac,
+	/* Node for range 0x000650-0x00065f */
+	0x02ad, 0x02b6, 0x02b7, 0x0165, 0x0165, 0x0167, 0x0167, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0167, 0x0165, 0x0165, 0x0167,
+	/* Node for range 0x000670-0x00067f */
+	0x02b8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0006c0-0x0006cf */
+	0x02b9, 0x0000, 0x02ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0006d0-0x0006df */
+	0x0000, 0x0000, 0x0000, 0x02bb, 0x0000, 0x0000, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0165,
+	/* Node for range 0x0006e0-0x0006ef */
+	0x0165, 0x0165, 0x0165, 0x0167, 0x0165, 0x0000, 0x0000, 0x0165,
+	0x0165, 0x0000, 0x0167, 0x0165, 0x0165, 0x0167, 0x0000, 0x0000,
+	/* Node for range 0x000710-0x00071f */
+	0x0000, 0x02bc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000730-0x00073f */
+	0x0165, 0x0167, 0x0165, 0x0165, 0x0167, 0x0165, 0x0165, 0x0167,
+	0x0167, 0x0167, 0x0165, 0x0167, 0x0167, 0x0165, 0x0167, 0x0165,
+	/* Node for range 0x000740-0x00074f */
+	0x0165, 0x0165, 0x0167, 0x0165, 0x0167, 0x0165, 0x0167, 0x0165,
+	0x0167, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0007e0-0x0007ef */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x0007f0-0x0007ff */
+	0x0165, 0x0165, 0x0167, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000810-0x00081f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0000, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x000820-0x00082f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0165, 0x0165, 0x0165,
+	0x0000, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000,
+	/* Node for range 0x000850-0x00085f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0167, 0x0167, 0x0167, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0008d0-0x0008df */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x0008e0-0x0008ef */
+	0x0165, 0x0165, 0x0000, 0x0167, 0x0165, 0x0165, 0x0167, 0x0165,
+	0x0165, 0x0167, 0x0165, 0x0165, 0x0165, 0x0167, 0x0167, 0x0167,
+	/* Node for range 0x0008f0-0x0008ff */
+	0x02b3, 0x02b4, 0x02b5, 0x0165, 0x0165, 0x0165, 0x0167, 0x0165,
+	0x0165, 0x0167, 0x0167, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x000920-0x00092f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x02bd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000930-0x00093f */
+	0x0000, 0x02be, 0x0000, 0x0000, 0x02bf, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02c0, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000940-0x00094f and 3 more */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c1, 0x0000, 0x0000,
+	/* Node for range 0x000950-0x00095f */
+	0x0000, 0x0165, 0x0167, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000,
+	0x02c2, 0x02c3, 0x02c4, 0x02c5, 0x02c6, 0x02c7, 0x02c8, 0x02c9,
+	/* Node for range 0x0009b0-0x0009bf and 4 more */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02c0, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0009c0-0x0009cf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x02ca, 0x02cb, 0x02c1, 0x0000, 0x0000,
+	/* Node for range 0x0009d0-0x0009df */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02cc, 0x02cd, 0x0000, 0x02ce,
+	/* Node for range 0x000a30-0x000a3f */
+	0x0000, 0x0000, 0x0000, 0x02cf, 0x0000, 0x0000, 0x02d0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02c0, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000a50-0x000a5f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x02d1, 0x02d2, 0x02d3, 0x0000, 0x0000, 0x02d4, 0x0000,
+	/* Node for range 0x000b40-0x000b4f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x02d5, 0x0000, 0x0000, 0x02d6, 0x02d7, 0x02c1, 0x0000, 0x0000,
+	/* Node for range 0x000b50-0x000b5f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02d8, 0x02d9, 0x0000, 0x0000,
+	/* Node for range 0x000b90-0x000b9f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02da, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000bc0-0x000bcf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x02db, 0x02dc, 0x02dd, 0x02c1, 0x0000, 0x0000,
+	/* Node for range 0x000c40-0x000c4f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x02de, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c1, 0x0000, 0x0000,
+	/* Node for range 0x000c50-0x000c5f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02df, 0x02e0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000cc0-0x000ccf */
+	0x02e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02e2,
+	0x02e3, 0x0000, 0x02e4, 0x02e5, 0x0000, 0x02c1, 0x0000, 0x0000,
+	/* Node for range 0x000d40-0x000d4f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x02e6, 0x02e7, 0x02e8, 0x02c1, 0x0000, 0x0000,
+	/* Node for range 0x000dc0-0x000dcf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000dd0-0x000ddf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x02e9, 0x0000, 0x02ea, 0x02eb, 0x02ec, 0x0000,
+	/* Node for range 0x000e30-0x000e3f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x02ed, 0x02ed, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000e40-0x000e4f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x02ee, 0x02ee, 0x02ee, 0x02ee, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000eb0-0x000ebf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x02ef, 0x02ef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000ec0-0x000ecf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000f10-0x000f1f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0167, 0x0167, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000f30-0x000f3f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0167, 0x0000, 0x0167,
+	0x0000, 0x0168, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000f40-0x000f4f */
+	0x0000, 0x0000, 0x0000, 0x02f1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f2, 0x0000, 0x0000,
+	/* Node for range 0x000f50-0x000f5f */
+	0x0000, 0x0000, 0x02f3, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02f5, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000f60-0x000f6f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x02f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000f70-0x000f7f */
+	0x0000, 0x02f7, 0x02f8, 0x02f9, 0x02fa, 0x02fb, 0x02fc, 0x0000,
+	0x02fd, 0x0000, 0x02f8, 0x02f8, 0x02f8, 0x02f8, 0x0000, 0x0000,
+	/* Node for range 0x000f80-0x000f8f */
+	0x02f8, 0x02fe, 0x0165, 0x0165, 0x02c1, 0x0000, 0x0165, 0x0165,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000f90-0x000f9f */
+	0x0000, 0x0000, 0x0000, 0x02ff, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000,
+	/* Node for range 0x000fa0-0x000faf */
+	0x0000, 0x0000, 0x0301, 0x0000, 0x0000, 0x0000, 0x0000, 0x0302,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0303, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000fb0-0x000fbf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0304, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x000fc0-0x000fcf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0167, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001020-0x00102f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0305, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001030-0x00103f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c0,
+	0x0000, 0x02c1, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001080-0x00108f and 1 more */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0167, 0x0000, 0x0000,
+	/* Node for range 0x0010a0-0x0010af */
+	0x0306, 0x0307, 0x0308, 0x0309, 0x030a, 0x030b, 0x030c, 0x030d,
+	0x030e, 0x030f, 0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315,
+	/* Node for range 0x0010b0-0x0010bf */
+	0x0316, 0x0317, 0x0318, 0x0319, 0x031a, 0x031b, 0x031c, 0x031d,
+	0x031e, 0x031f, 0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325,
+	/* Node for range 0x0010c0-0x0010cf */
+	0x0326, 0x0327, 0x0328, 0x0329, 0x032a, 0x032b, 0x0000, 0x032c,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x032d, 0x0000, 0x0000,
+	/* Node for range 0x001350-0x00135f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x0013f0-0x0013ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x032e, 0x032f, 0x0330, 0x0331, 0x0332, 0x0333, 0x0000, 0x0000,
+	/* Node for range 0x001710-0x00171f and 2 more */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02c1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0017d0-0x0017df */
+	0x0000, 0x0000, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0000, 0x0000,
+	/* Node for range 0x0018a0-0x0018af */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x029a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001930-0x00193f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0299, 0x0165, 0x0167, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001a10-0x001a1f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165,
+	0x0167, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001a60-0x001a6f and 1 more */
+	0x02c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001a70-0x001a7f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0167,
+	/* Node for range 0x001ab0-0x001abf */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0167, 0x0167, 0x0167,
+	0x0167, 0x0167, 0x0167, 0x0165, 0x0165, 0x0167, 0x0000, 0x0000,
+	/* Node for range 0x001b00-0x001b0f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0334, 0x0000,
+	0x0335, 0x0000, 0x0336, 0x0000, 0x0337, 0x0000, 0x0338, 0x0000,
+	/* Node for range 0x001b10-0x001b1f */
+	0x0000, 0x0000, 0x0339, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001b30-0x001b3f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x02c0, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x033a, 0x0000, 0x033b, 0x0000, 0x0000,
+	/* Node for range 0x001b40-0x001b4f */
+	0x033c, 0x033d, 0x0000, 0x033e, 0x02c1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001b60-0x001b6f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0165, 0x0167, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x001b70-0x001b7f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001ba0-0x001baf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x02c1, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001be0-0x001bef */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001bf0-0x001bff */
+	0x0000, 0x0000, 0x02c1, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001c30-0x001c3f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001c80-0x001c8f */
+	0x033f, 0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346,
+	0x0347, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001cd0-0x001cdf */
+	0x0165, 0x0165, 0x0165, 0x0000, 0x016a, 0x0167, 0x0167, 0x0167,
+	0x0167, 0x0167, 0x0165, 0x0165, 0x0167, 0x0167, 0x0167, 0x0167,
+	/* Node for range 0x001ce0-0x001cef */
+	0x0165, 0x0000, 0x016a, 0x016a, 0x016a, 0x016a, 0x016a, 0x016a,
+	0x016a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0167, 0x0000, 0x0000,
+	/* Node for range 0x001cf0-0x001cff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0000, 0x0000, 0x0000,
+	0x0165, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x001dc0-0x001dcf */
+	0x0165, 0x0165, 0x0167, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0167, 0x0165, 0x0165, 0x0171, 0x0348, 0x0167,
+	/* Node for range 0x001dd0-0x001ddf */
+	0x0169, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x001df0-0x001dff */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0165, 0x0170, 0x0167, 0x0165, 0x0167,
+	/* Node for range 0x001e00-0x001e0f */
+	0x0349, 0x034a, 0x034b, 0x034c, 0x034d, 0x034e, 0x034f, 0x0350,
+	0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356, 0x0357, 0x0358,
+	/* Node for range 0x001e10-0x001e1f */
+	0x0359, 0x035a, 0x035b, 0x035c, 0x035d, 0x035e, 0x035f, 0x0360,
+	0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367, 0x0368,
+	/* Node for range 0x001e20-0x001e2f */
+	0x0369, 0x036a, 0x036b, 0x036c, 0x036d, 0x036e, 0x036f, 0x0370,
+	0x0371, 0x0372, 0x0373, 0x0374, 0x0375, 0x0376, 0x0377, 0x0378,
+	/* Node for range 0x001e30-0x001e3f */
+	0x0379, 0x037a, 0x037b, 0x037c, 0x037d, 0x037e, 0x037f, 0x0380,
+	0x0381, 0x0382, 0x0383, 0x0384, 0x0385, 0x0386, 0x0387, 0x0388,
+	/* Node for range 0x001e40-0x001e4f */
+	0x0389, 0x038a, 0x038b, 0x038c, 0x038d, 0x038e, 0x038f, 0x0390,
+	0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398,
+	/* Node for range 0x001e50-0x001e5f */
+	0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0,
+	0x03a1, 0x03a2, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8,
+	/* Node for range 0x001e60-0x001e6f */
+	0x03a9, 0x03aa, 0x03ab, 0x03ac, 0x03ad, 0x03ae, 0x03af, 0x03b0,
+	0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8,
+	/* Node for range 0x001e70-0x001e7f */
+	0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0,
+	0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8,
+	/* Node for range 0x001e80-0x001e8f */
+	0x03c9, 0x03ca, 0x03cb, 0x03cc, 0x03cd, 0x03ce, 0x03cf, 0x03d0,
+	0x03d1, 0x03d2, 0x03d3, 0x03d4, 0x03d5, 0x03d6, 0x03d7, 0x03d8,
+	/* Node for range 0x001e90-0x001e9f */
+	0x03d9, 0x03da, 0x03db, 0x03dc, 0x03dd, 0x03de, 0x03df, 0x03e0,
+	0x03e1, 0x03e2, 0x03e3, 0x03e4, 0x0000, 0x0000, 0x03e5, 0x0000,
+	/* Node for range 0x001ea0-0x001eaf */
+	0x03e6, 0x03e7, 0x03e8, 0x03e9, 0x03ea, 0x03eb, 0x03ec, 0x03ed,
+	0x03ee, 0x03ef, 0x03f0, 0x03f1, 0x03f2, 0x03f3, 0x03f4, 0x03f5,
+	/* Node for range 0x001eb0-0x001ebf */
+	0x03f6, 0x03f7, 0x03f8, 0x03f9, 0x03fa, 0x03fb, 0x03fc, 0x03fd,
+	0x03fe, 0x03ff, 0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405,
+	/* Node for range 0x001ec0-0x001ecf */
+	0x0406, 0x0407, 0x0408, 0x0409, 0x040a, 0x040b, 0x040c, 0x040d,
+	0x040e, 0x040f, 0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415,
+	/* Node for range 0x001ed0-0x001edf */
+	0x0416, 0x0417, 0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d,
+	0x041e, 0x041f, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425,
+	/* Node for range 0x001ee0-0x001eef */
+	0x0426, 0x0427, 0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d,
+	0x042e, 0x042f, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435,
+	/* Node for range 0x001ef0-0x001eff */
+	0x0436, 0x0437, 0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d,
+	0x043e, 0x043f, 0x0440, 0x0000, 0x0441, 0x0000, 0x0442, 0x0000,
+	/* Node for range 0x001f00-0x001f0f */
+	0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044a,
+	0x044b, 0x044c, 0x044d, 0x044e, 0x044f, 0x0450, 0x0451, 0x0452,
+	/* Node for range 0x001f10-0x001f1f */
+	0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0000, 0x0000,
+	0x0459, 0x045a, 0x045b, 0x045c, 0x045d, 0x045e, 0x0000, 0x0000,
+	/* Node for range 0x001f20-0x001f2f */
+	0x045f, 0x0460, 0x0461, 0x0462, 0x0463, 0x0464, 0x0465, 0x0466,
+	0x0467, 0x0468, 0x0469, 0x046a, 0x046b, 0x046c, 0x046d, 0x046e,
+	/* Node for range 0x001f30-0x001f3f */
+	0x046f, 0x0470, 0x0471, 0x0472, 0x0473, 0x0474, 0x0475, 0x0476,
+	0x0477, 0x0478, 0x0479, 0x047a, 0x047b, 0x047c, 0x047d, 0x047e,
+	/* Node for range 0x001f40-0x001f4f */
+	0x047f, 0x0480, 0x0481, 0x0482, 0x0483, 0x0484, 0x0000, 0x0000,
+	0x0485, 0x0486, 0x0487, 0x0488, 0x0489, 0x048a, 0x0000, 0x0000,
+	/* Node for range 0x001f50-0x001f5f */
+	0x048b, 0x048c, 0x048d, 0x048e, 0x048f, 0x0490, 0x0491, 0x0492,
+	0x0000, 0x0493, 0x0000, 0x0494, 0x0000, 0x0495, 0x0000, 0x0496,
+	/* Node for range 0x001f60-0x001f6f */
+	0x0497, 0x0498, 0x0499, 0x049a, 0x049b, 0x049c, 0x049d, 0x049e,
+	0x049f, 0x04a0, 0x04a1, 0x04a2, 0x04a3, 0x04a4, 0x04a5, 0x04a6,
+	/* Node for range 0x001f70-0x001f7f */
+	0x04a7, 0x04a8, 0x04a9, 0x04aa, 0x04ab, 0x04ac, 0x04ad, 0x04ae,
+	0x04af, 0x04b0, 0x04b1, 0x04b2, 0x04b3, 0x04b4, 0x0000, 0x0000,
+	/* Node for range 0x001f80-0x001f8f */
+	0x04b5, 0x04b6, 0x04b7, 0x04b8, 0x04b9, 0x04ba, 0x04bb, 0x04bc,
+	0x04bd, 0x04be, 0x04bf, 0x04c0, 0x04c1, 0x04c2, 0x04c3, 0x04c4,
+	/* Node for range 0x001f90-0x001f9f */
+	0x04c5, 0x04c6, 0x04c7, 0x04c8, 0x04c9, 0x04ca, 0x04cb, 0x04cc,
+	0x04cd, 0x04ce, 0x04cf, 0x04d0, 0x04d1, 0x04d2, 0x04d3, 0x04d4,
+	/* Node for range 0x001fa0-0x001faf */
+	0x04d5, 0x04d6, 0x04d7, 0x04d8, 0x04d9, 0x04da, 0x04db, 0x04dc,
+	0x04dd, 0x04de, 0x04df, 0x04e0, 0x04e1, 0x04e2, 0x04e3, 0x04e4,
+	/* Node for range 0x001fb0-0x001fbf */
+	0x04e5, 0x04e6, 0x04e7, 0x04e8, 0x04e9, 0x0000, 0x04ea, 0x04eb,
+	0x04ec, 0x04ed, 0x04ee, 0x04ef, 0x04f0, 0x0000, 0x04f1, 0x0000,
+	/* Node for range 0x001fc0-0x001fcf */
+	0x0000, 0x04f2, 0x04f3, 0x04f4, 0x04f5, 0x0000, 0x04f6, 0x04f7,
+	0x04f8, 0x04f9, 0x04fa, 0x04fb, 0x04fc, 0x04fd, 0x04fe, 0x04ff,
+	/* Node for range 0x001fd0-0x001fdf */
+	0x0500, 0x0501, 0x0502, 0x0503, 0x0000, 0x0000, 0x0504, 0x0505,
+	0x0506, 0x0507, 0x0508, 0x0509, 0x0000, 0x050a, 0x050b, 0x050c,
+	/* Node for range 0x001fe0-0x001fef */
+	0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0512, 0x0513, 0x0514,
+	0x0515, 0x0516, 0x0517, 0x0518, 0x0519, 0x051a, 0x051b, 0x051c,
+	/* Node for range 0x001ff0-0x001fff */
+	0x0000, 0x0000, 0x051d, 0x051e, 0x051f, 0x0000, 0x0520, 0x0521,
+	0x0522, 0x0523, 0x0524, 0x0525, 0x0526, 0x0527, 0x0000, 0x0000,
+	/* Node for range 0x002000-0x00200f */
+	0x0528, 0x0529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0020d0-0x0020df */
+	0x0165, 0x0165, 0x016a, 0x016a, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x016a, 0x016a, 0x016a, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0020e0-0x0020ef */
+	0x0000, 0x0165, 0x0000, 0x0000, 0x0000, 0x016a, 0x016a, 0x0165,
+	0x0167, 0x0165, 0x016a, 0x016a, 0x0167, 0x0167, 0x0167, 0x0167,
+	/* Node for range 0x0020f0-0x0020ff */
+	0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002120-0x00212f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x052a, 0x0000,
+	0x0000, 0x0000, 0x052b, 0x052c, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002130-0x00213f */
+	0x0000, 0x0000, 0x052d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002160-0x00216f */
+	0x052e, 0x052f, 0x0530, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535,
+	0x0536, 0x0537, 0x0538, 0x0539, 0x053a, 0x053b, 0x053c, 0x053d,
+	/* Node for range 0x002180-0x00218f */
+	0x0000, 0x0000, 0x0000, 0x053e, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002190-0x00219f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x053f, 0x0540, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0021a0-0x0021af */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0541, 0x0000,
+	/* Node for range 0x0021c0-0x0021cf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0542, 0x0543, 0x0544,
+	/* Node for range 0x002200-0x00220f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0545, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0546, 0x0000, 0x0000, 0x0547, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002220-0x00222f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0548, 0x0000, 0x0549, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002240-0x00224f */
+	0x0000, 0x054a, 0x0000, 0x0000, 0x054b, 0x0000, 0x0000, 0x054c,
+	0x0000, 0x054d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002260-0x00226f */
+	0x054e, 0x0000, 0x054f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0550, 0x0551, 0x0552,
+	/* Node for range 0x002270-0x00227f */
+	0x0553, 0x0554, 0x0000, 0x0000, 0x0555, 0x0556, 0x0000, 0x0000,
+	0x0557, 0x0558, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002280-0x00228f */
+	0x0559, 0x055a, 0x0000, 0x0000, 0x055b, 0x055c, 0x0000, 0x0000,
+	0x055d, 0x055e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0022a0-0x0022af */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x055f, 0x0560, 0x0561, 0x0562,
+	/* Node for range 0x0022e0-0x0022ef */
+	0x0563, 0x0564, 0x0565, 0x0566, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0567, 0x0568, 0x0569, 0x056a, 0x0000, 0x0000,
+	/* Node for range 0x002320-0x00232f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x056b, 0x056c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0024b0-0x0024bf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x056d, 0x056e,
+	0x056f, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576,
+	/* Node for range 0x0024c0-0x0024cf */
+	0x0577, 0x0578, 0x0579, 0x057a, 0x057b, 0x057c, 0x057d, 0x057e,
+	0x057f, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586,
+	/* Node for range 0x002ad0-0x002adf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0587, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002c00-0x002c0f */
+	0x0588, 0x0589, 0x058a, 0x058b, 0x058c, 0x058d, 0x058e, 0x058f,
+	0x0590, 0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597,
+	/* Node for range 0x002c10-0x002c1f */
+	0x0598, 0x0599, 0x059a, 0x059b, 0x059c, 0x059d, 0x059e, 0x059f,
+	0x05a0, 0x05a1, 0x05a2, 0x05a3, 0x05a4, 0x05a5, 0x05a6, 0x05a7,
+	/* Node for range 0x002c20-0x002c2f */
+	0x05a8, 0x05a9, 0x05aa, 0x05ab, 0x05ac, 0x05ad, 0x05ae, 0x05af,
+	0x05b0, 0x05b1, 0x05b2, 0x05b3, 0x05b4, 0x05b5, 0x05b6, 0x0000,
+	/* Node for range 0x002c60-0x002c6f */
+	0x05b7, 0x0000, 0x05b8, 0x05b9, 0x05ba, 0x0000, 0x0000, 0x05bb,
+	0x0000, 0x05bc, 0x0000, 0x05bd, 0x0000, 0x05be, 0x05bf, 0x05c0,
+	/* Node for range 0x002c70-0x002c7f */
+	0x05c1, 0x0000, 0x05c2, 0x0000, 0x0000, 0x05c3, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05c4, 0x05c5,
+	/* Node for range 0x002c80-0x002c8f */
+	0x05c6, 0x0000, 0x05c7, 0x0000, 0x05c8, 0x0000, 0x05c9, 0x0000,
+	0x05ca, 0x0000, 0x05cb, 0x0000, 0x05cc, 0x0000, 0x05cd, 0x0000,
+	/* Node for range 0x002c90-0x002c9f */
+	0x05ce, 0x0000, 0x05cf, 0x0000, 0x05d0, 0x0000, 0x05d1, 0x0000,
+	0x05d2, 0x0000, 0x05d3, 0x0000, 0x05d4, 0x0000, 0x05d5, 0x0000,
+	/* Node for range 0x002ca0-0x002caf */
+	0x05d6, 0x0000, 0x05d7, 0x0000, 0x05d8, 0x0000, 0x05d9, 0x0000,
+	0x05da, 0x0000, 0x05db, 0x0000, 0x05dc, 0x0000, 0x05dd, 0x0000,
+	/* Node for range 0x002cb0-0x002cbf */
+	0x05de, 0x0000, 0x05df, 0x0000, 0x05e0, 0x0000, 0x05e1, 0x0000,
+	0x05e2, 0x0000, 0x05e3, 0x0000, 0x05e4, 0x0000, 0x05e5, 0x0000,
+	/* Node for range 0x002cc0-0x002ccf */
+	0x05e6, 0x0000, 0x05e7, 0x0000, 0x05e8, 0x0000, 0x05e9, 0x0000,
+	0x05ea, 0x0000, 0x05eb, 0x0000, 0x05ec, 0x0000, 0x05ed, 0x0000,
+	/* Node for range 0x002cd0-0x002cdf */
+	0x05ee, 0x0000, 0x05ef, 0x0000, 0x05f0, 0x0000, 0x05f1, 0x0000,
+	0x05f2, 0x0000, 0x05f3, 0x0000, 0x05f4, 0x0000, 0x05f5, 0x0000,
+	/* Node for range 0x002ce0-0x002cef */
+	0x05f6, 0x0000, 0x05f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x05f8, 0x0000, 0x05f9, 0x0000, 0x0165,
+	/* Node for range 0x002cf0-0x002cff */
+	0x0165, 0x0165, 0x05fa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x002d70-0x002d7f and 3 more */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c1,
+	/* Node for range 0x003020-0x00302f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x05fb, 0x029a, 0x0166, 0x0299, 0x05fc, 0x05fc,
+	/* Node for range 0x003040-0x00304f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x05fd, 0x0000, 0x05fe, 0x0000,
+	/* Node for range 0x003050-0x00305f */
+	0x05ff, 0x0000, 0x0600, 0x0000, 0x0601, 0x0000, 0x0602, 0x0000,
+	0x0603, 0x0000, 0x0604, 0x0000, 0x0605, 0x0000, 0x0606, 0x0000,
+	/* Node for range 0x003060-0x00306f */
+	0x0607, 0x0000, 0x0608, 0x0000, 0x0000, 0x0609, 0x0000, 0x060a,
+	0x0000, 0x060b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x003070-0x00307f */
+	0x060c, 0x060d, 0x0000, 0x060e, 0x060f, 0x0000, 0x0610, 0x0611,
+	0x0000, 0x0612, 0x0613, 0x0000, 0x0614, 0x0615, 0x0000, 0x0000,
+	/* Node for range 0x003090-0x00309f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0616, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0617, 0x0617, 0x0000, 0x0000, 0x0000, 0x0618, 0x0000,
+	/* Node for range 0x0030a0-0x0030af */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0619, 0x0000, 0x061a, 0x0000,
+	/* Node for range 0x0030b0-0x0030bf */
+	0x061b, 0x0000, 0x061c, 0x0000, 0x061d, 0x0000, 0x061e, 0x0000,
+	0x061f, 0x0000, 0x0620, 0x0000, 0x0621, 0x0000, 0x0622, 0x0000,
+	/* Node for range 0x0030c0-0x0030cf */
+	0x0623, 0x0000, 0x0624, 0x0000, 0x0000, 0x0625, 0x0000, 0x0626,
+	0x0000, 0x0627, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0030d0-0x0030df */
+	0x0628, 0x0629, 0x0000, 0x062a, 0x062b, 0x0000, 0x062c, 0x062d,
+	0x0000, 0x062e, 0x062f, 0x0000, 0x0630, 0x0631, 0x0000, 0x0000,
+	/* Node for range 0x0030f0-0x0030ff */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0632, 0x0000, 0x0000, 0x0633,
+	0x0634, 0x0635, 0x0636, 0x0000, 0x0000, 0x0000, 0x0637, 0x0000,
+	/* Node for range 0x00a640-0x00a64f */
+	0x0638, 0x0000, 0x0639, 0x0000, 0x063a, 0x0000, 0x063b, 0x0000,
+	0x063c, 0x0000, 0x063d, 0x0000, 0x063e, 0x0000, 0x063f, 0x0000,
+	/* Node for range 0x00a650-0x00a65f */
+	0x0640, 0x0000, 0x0641, 0x0000, 0x0642, 0x0000, 0x0643, 0x0000,
+	0x0644, 0x0000, 0x0645, 0x0000, 0x0646, 0x0000, 0x0647, 0x0000,
+	/* Node for range 0x00a660-0x00a66f */
+	0x0648, 0x0000, 0x0649, 0x0000, 0x064a, 0x0000, 0x064b, 0x0000,
+	0x064c, 0x0000, 0x064d, 0x0000, 0x064e, 0x0000, 0x0000, 0x0165,
+	/* Node for range 0x00a670-0x00a67f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000,
+	/* Node for range 0x00a680-0x00a68f */
+	0x064f, 0x0000, 0x0650, 0x0000, 0x0651, 0x0000, 0x0652, 0x0000,
+	0x0653, 0x0000, 0x0654, 0x0000, 0x0655, 0x0000, 0x0656, 0x0000,
+	/* Node for range 0x00a690-0x00a69f */
+	0x0657, 0x0000, 0x0658, 0x0000, 0x0659, 0x0000, 0x065a, 0x0000,
+	0x065b, 0x0000, 0x065c, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165,
+	/* Node for range 0x00a6f0-0x00a6ff and 1 more */
+	0x0165, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00a720-0x00a72f */
+	0x0000, 0x0000, 0x065d, 0x0000, 0x065e, 0x0000, 0x065f, 0x0000,
+	0x0660, 0x0000, 0x0661, 0x0000, 0x0662, 0x0000, 0x0663, 0x0000,
+	/* Node for range 0x00a730-0x00a73f */
+	0x0000, 0x0000, 0x0664, 0x0000, 0x0665, 0x0000, 0x0666, 0x0000,
+	0x0667, 0x0000, 0x0668, 0x0000, 0x0669, 0x0000, 0x066a, 0x0000,
+	/* Node for range 0x00a740-0x00a74f */
+	0x066b, 0x0000, 0x066c, 0x0000, 0x066d, 0x0000, 0x066e, 0x0000,
+	0x066f, 0x0000, 0x0670, 0x0000, 0x0671, 0x0000, 0x0672, 0x0000,
+	/* Node for range 0x00a750-0x00a75f */
+	0x0673, 0x0000, 0x0674, 0x0000, 0x0675, 0x0000, 0x0676, 0x0000,
+	0x0677, 0x0000, 0x0678, 0x0000, 0x0679, 0x0000, 0x067a, 0x0000,
+	/* Node for range 0x00a760-0x00a76f */
+	0x067b, 0x0000, 0x067c, 0x0000, 0x067d, 0x0000, 0x067e, 0x0000,
+	0x067f, 0x0000, 0x0680, 0x0000, 0x0681, 0x0000, 0x0682, 0x0000,
+	/* Node for range 0x00a770-0x00a77f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0683, 0x0000, 0x0684, 0x0000, 0x0685, 0x0686, 0x0000,
+	/* Node for range 0x00a780-0x00a78f */
+	0x0687, 0x0000, 0x0688, 0x0000, 0x0689, 0x0000, 0x068a, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x068b, 0x0000, 0x068c, 0x0000, 0x0000,
+	/* Node for range 0x00a790-0x00a79f */
+	0x068d, 0x0000, 0x068e, 0x0000, 0x0000, 0x0000, 0x068f, 0x0000,
+	0x0690, 0x0000, 0x0691, 0x0000, 0x0692, 0x0000, 0x0693, 0x0000,
+	/* Node for range 0x00a7a0-0x00a7af */
+	0x0694, 0x0000, 0x0695, 0x0000, 0x0696, 0x0000, 0x0697, 0x0000,
+	0x0698, 0x0000, 0x0699, 0x069a, 0x069b, 0x069c, 0x069d, 0x0000,
+	/* Node for range 0x00a7b0-0x00a7bf */
+	0x069e, 0x069f, 0x06a0, 0x06a1, 0x06a2, 0x0000, 0x06a3, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00a800-0x00a80f and 2 more */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c1, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00a920-0x00a92f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0167, 0x0167, 0x0167, 0x0000, 0x0000,
+	/* Node for range 0x00a950-0x00a95f */
+	0x0000, 0x0000, 0x0000, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00a9b0-0x00a9bf and 1 more */
+	0x0000, 0x0000, 0x0000, 0x02c0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00aab0-0x00aabf */
+	0x0165, 0x0000, 0x0165, 0x0165, 0x0167, 0x0000, 0x0000, 0x0165,
+	0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165,
+	/* Node for range 0x00aac0-0x00aacf */
+	0x0000, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00ab70-0x00ab7f */
+	0x06a4, 0x06a5, 0x06a6, 0x06a7, 0x06a8, 0x06a9, 0x06aa, 0x06ab,
+	0x06ac, 0x06ad, 0x06ae, 0x06af, 0x06b0, 0x06b1, 0x06b2, 0x06b3,
+	/* Node for range 0x00ab80-0x00ab8f */
+	0x06b4, 0x06b5, 0x06b6, 0x06b7, 0x06b8, 0x06b9, 0x06ba, 0x06bb,
+	0x06bc, 0x06bd, 0x06be, 0x06bf, 0x06c0, 0x06c1, 0x06c2, 0x06c3,
+	/* Node for range 0x00ab90-0x00ab9f */
+	0x06c4, 0x06c5, 0x06c6, 0x06c7, 0x06c8, 0x06c9, 0x06ca, 0x06cb,
+	0x06cc, 0x06cd, 0x06ce, 0x06cf, 0x06d0, 0x06d1, 0x06d2, 0x06d3,
+	/* Node for range 0x00aba0-0x00abaf */
+	0x06d4, 0x06d5, 0x06d6, 0x06d7, 0x06d8, 0x06d9, 0x06da, 0x06db,
+	0x06dc, 0x06dd, 0x06de, 0x06df, 0x06e0, 0x06e1, 0x06e2, 0x06e3,
+	/* Node for range 0x00abb0-0x00abbf */
+	0x06e4, 0x06e5, 0x06e6, 0x06e7, 0x06e8, 0x06e9, 0x06ea, 0x06eb,
+	0x06ec, 0x06ed, 0x06ee, 0x06ef, 0x06f0, 0x06f1, 0x06f2, 0x06f3,
+	/* Node for range 0x00f900-0x00f90f */
+	0x06f4, 0x06f5, 0x06f6, 0x06f7, 0x06f8, 0x06f9, 0x06fa, 0x06fb,
+	0x06fc, 0x06fd, 0x06fe, 0x06ff, 0x0700, 0x0701, 0x0702, 0x0703,
+	/* Node for range 0x00f910-0x00f91f */
+	0x0704, 0x0705, 0x0706, 0x0707, 0x0708, 0x0709, 0x070a, 0x070b,
+	0x070c, 0x070d, 0x070e, 0x070f, 0x0710, 0x0711, 0x0712, 0x0713,
+	/* Node for range 0x00f920-0x00f92f */
+	0x0714, 0x0715, 0x0716, 0x0717, 0x0718, 0x0719, 0x071a, 0x071b,
+	0x071c, 0x071d, 0x071e, 0x071f, 0x0720, 0x0721, 0x0722, 0x0723,
+	/* Node for range 0x00f930-0x00f93f */
+	0x0724, 0x0725, 0x0726, 0x0727, 0x0728, 0x0729, 0x072a, 0x072b,
+	0x072c, 0x072d, 0x072e, 0x072f, 0x0730, 0x0731, 0x0732, 0x0733,
+	/* Node for range 0x00f940-0x00f94f */
+	0x0734, 0x0735, 0x0736, 0x0737, 0x0738, 0x0739, 0x073a, 0x073b,
+	0x073c, 0x073d, 0x073e, 0x073f, 0x0740, 0x0741, 0x0742, 0x0743,
+	/* Node for range 0x00f950-0x00f95f */
+	0x0744, 0x0745, 0x0746, 0x0747, 0x0748, 0x0749, 0x074a, 0x074b,
+	0x074c, 0x074d, 0x074e, 0x074f, 0x0750, 0x0751, 0x0752, 0x0753,
+	/* Node for range 0x00f960-0x00f96f */
+	0x0754, 0x0755, 0x0756, 0x0757, 0x0758, 0x0759, 0x075a, 0x075b,
+	0x075c, 0x075d, 0x075e, 0x075f, 0x0760, 0x0761, 0x0762, 0x0763,
+	/* Node for range 0x00f970-0x00f97f */
+	0x0764, 0x0765, 0x0766, 0x0767, 0x0768, 0x0769, 0x076a, 0x076b,
+	0x076c, 0x076d, 0x076e, 0x076f, 0x0770, 0x0771, 0x0772, 0x0773,
+	/* Node for range 0x00f980-0x00f98f */
+	0x0774, 0x0775, 0x0776, 0x0777, 0x0778, 0x0779, 0x077a, 0x077b,
+	0x077c, 0x077d, 0x077e, 0x077f, 0x0780, 0x0781, 0x0782, 0x0783,
+	/* Node for range 0x00f990-0x00f99f */
+	0x0784, 0x0785, 0x0786, 0x0787, 0x0788, 0x0789, 0x078a, 0x078b,
+	0x078c, 0x078d, 0x078e, 0x078f, 0x0790, 0x0791, 0x0792, 0x0793,
+	/* Node for range 0x00f9a0-0x00f9af */
+	0x0794, 0x0795, 0x0796, 0x0797, 0x0798, 0x0799, 0x079a, 0x079b,
+	0x079c, 0x079d, 0x079e, 0x079f, 0x07a0, 0x07a1, 0x07a2, 0x07a3,
+	/* Node for range 0x00f9b0-0x00f9bf */
+	0x07a4, 0x07a5, 0x07a6, 0x07a7, 0x07a8, 0x07a9, 0x07aa, 0x07ab,
+	0x07ac, 0x07ad, 0x07ae, 0x07af, 0x07b0, 0x07b1, 0x07b2, 0x07b3,
+	/* Node for range 0x00f9c0-0x00f9cf */
+	0x07b4, 0x07b5, 0x07b6, 0x07b7, 0x07b8, 0x07b9, 0x07ba, 0x07bb,
+	0x07bc, 0x07bd, 0x07be, 0x07bf, 0x07c0, 0x07c1, 0x07c2, 0x07c3,
+	/* Node for range 0x00f9d0-0x00f9df */
+	0x07c4, 0x07c5, 0x07c6, 0x07c7, 0x07c8, 0x07c9, 0x07ca, 0x07cb,
+	0x07cc, 0x07cd, 0x07ce, 0x07cf, 0x07d0, 0x07d1, 0x07d2, 0x07d3,
+	/* Node for range 0x00f9e0-0x00f9ef */
+	0x07d4, 0x07d5, 0x07d6, 0x07d7, 0x07d8, 0x07d9, 0x07da, 0x07db,
+	0x07dc, 0x07dd, 0x07de, 0x07df, 0x07e0, 0x07e1, 0x07e2, 0x07e3,
+	/* Node for range 0x00f9f0-0x00f9ff */
+	0x07e4, 0x07e5, 0x07e6, 0x07e7, 0x07e8, 0x07e9, 0x07ea, 0x07eb,
+	0x07ec, 0x07ed, 0x07ee, 0x07ef, 0x07f0, 0x07f1, 0x07f2, 0x07f3,
+	/* Node for range 0x00fa00-0x00fa0f */
+	0x07f4, 0x07f5, 0x07f6, 0x07f7, 0x07f8, 0x07f9, 0x07fa, 0x07fb,
+	0x07fc, 0x07fd, 0x07fe, 0x07ff, 0x0800, 0x0801, 0x0000, 0x0000,
+	/* Node for range 0x00fa10-0x00fa1f */
+	0x0802, 0x0000, 0x0803, 0x0000, 0x0000, 0x0804, 0x0805, 0x0806,
+	0x0807, 0x0808, 0x0809, 0x080a, 0x080b, 0x080c, 0x080d, 0x0000,
+	/* Node for range 0x00fa20-0x00fa2f */
+	0x080e, 0x0000, 0x080f, 0x0000, 0x0000, 0x0810, 0x0811, 0x0000,
+	0x0000, 0x0000, 0x0812, 0x0813, 0x0814, 0x0815, 0x0816, 0x0817,
+	/* Node for range 0x00fa30-0x00fa3f */
+	0x0818, 0x0819, 0x081a, 0x081b, 0x081c, 0x081d, 0x081e, 0x081f,
+	0x0820, 0x0821, 0x0822, 0x0823, 0x0824, 0x0825, 0x0826, 0x0827,
+	/* Node for range 0x00fa40-0x00fa4f */
+	0x0828, 0x0829, 0x082a, 0x082b, 0x082c, 0x082d, 0x082e, 0x082f,
+	0x0830, 0x0831, 0x0832, 0x0833, 0x0834, 0x0835, 0x0836, 0x0837,
+	/* Node for range 0x00fa50-0x00fa5f */
+	0x0838, 0x0839, 0x083a, 0x083b, 0x083c, 0x083d, 0x083e, 0x083f,
+	0x0840, 0x0841, 0x0842, 0x0843, 0x0844, 0x0845, 0x0846, 0x0847,
+	/* Node for range 0x00fa60-0x00fa6f */
+	0x0848, 0x0849, 0x084a, 0x084b, 0x084c, 0x084d, 0x084e, 0x084f,
+	0x0850, 0x0851, 0x0852, 0x0853, 0x0854, 0x0855, 0x0000, 0x0000,
+	/* Node for range 0x00fa70-0x00fa7f */
+	0x0856, 0x0857, 0x0858, 0x0859, 0x085a, 0x085b, 0x085c, 0x085d,
+	0x085e, 0x085f, 0x0860, 0x0861, 0x0862, 0x0863, 0x0864, 0x0865,
+	/* Node for range 0x00fa80-0x00fa8f */
+	0x0866, 0x0867, 0x0868, 0x0869, 0x086a, 0x086b, 0x086c, 0x086d,
+	0x086e, 0x086f, 0x0870, 0x0871, 0x0872, 0x0873, 0x0874, 0x0875,
+	/* Node for range 0x00fa90-0x00fa9f */
+	0x0876, 0x0877, 0x0878, 0x0879, 0x087a, 0x087b, 0x087c, 0x087d,
+	0x087e, 0x087f, 0x0880, 0x0881, 0x0882, 0x0883, 0x0884, 0x0885,
+	/* Node for range 0x00faa0-0x00faaf */
+	0x0886, 0x0887, 0x0888, 0x0889, 0x088a, 0x088b, 0x088c, 0x088d,
+	0x088e, 0x088f, 0x0890, 0x0891, 0x0892, 0x0893, 0x0894, 0x0895,
+	/* Node for range 0x00fab0-0x00fabf */
+	0x0896, 0x0897, 0x0898, 0x0899, 0x089a, 0x089b, 0x089c, 0x089d,
+	0x089e, 0x089f, 0x08a0, 0x08a1, 0x08a2, 0x08a3, 0x08a4, 0x08a5,
+	/* Node for range 0x00fac0-0x00facf */
+	0x08a6, 0x08a7, 0x08a8, 0x08a9, 0x08aa, 0x08ab, 0x08ac, 0x08ad,
+	0x08ae, 0x08af, 0x08b0, 0x08b1, 0x08b2, 0x08b3, 0x08b4, 0x08b5,
+	/* Node for range 0x00fad0-0x00fadf */
+	0x08b6, 0x08b7, 0x08b8, 0x08b9, 0x08ba, 0x08bb, 0x08bc, 0x08bd,
+	0x08be, 0x08bf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00fb00-0x00fb0f */
+	0x08c0, 0x08c1, 0x08c2, 0x08c3, 0x08c4, 0x08c5, 0x08c6, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x00fb10-0x00fb1f */
+	0x0000, 0x0000, 0x0000, 0x08c7, 0x08c8, 0x08c9, 0x08ca, 0x08cb,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08cc, 0x08cd, 0x08ce,
+	/* Node for range 0x00fb20-0x00fb2f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x08cf, 0x08d0, 0x08d1, 0x08d2, 0x08d3, 0x08d4,
+	/* Node for range 0x00fb30-0x00fb3f */
+	0x08d5, 0x08d6, 0x08d7, 0x08d8, 0x08d9, 0x08da, 0x08db, 0x0000,
+	0x08dc, 0x08dd, 0x08de, 0x08df, 0x08e0, 0x0000, 0x08e1, 0x0000,
+	/* Node for range 0x00fb40-0x00fb4f */
+	0x08e2, 0x08e3, 0x0000, 0x08e4, 0x08e5, 0x0000, 0x08e6, 0x08e7,
+	0x08e8, 0x08e9, 0x08ea, 0x08eb, 0x08ec, 0x08ed, 0x08ee, 0x0000,
+	/* Node for range 0x00fe20-0x00fe2f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0167,
+	0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0165, 0x0165,
+	/* Node for range 0x00ff20-0x00ff2f */
+	0x0000, 0x08ef, 0x08f0, 0x08f1, 0x08f2, 0x08f3, 0x08f4, 0x08f5,
+	0x08f6, 0x08f7, 0x08f8, 0x08f9, 0x08fa, 0x08fb, 0x08fc, 0x08fd,
+	/* Node for range 0x00ff30-0x00ff3f */
+	0x08fe, 0x08ff, 0x0900, 0x0901, 0x0902, 0x0903, 0x0904, 0x0905,
+	0x0906, 0x0907, 0x0908, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0102e0-0x0102ef */
+	0x0167, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x010370-0x01037f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x010400-0x01040f */
+	0x0909, 0x090a, 0x090b, 0x090c, 0x090d, 0x090e, 0x090f, 0x0910,
+	0x0911, 0x0912, 0x0913, 0x0914, 0x0915, 0x0916, 0x0917, 0x0918,
+	/* Node for range 0x010410-0x01041f */
+	0x0919, 0x091a, 0x091b, 0x091c, 0x091d, 0x091e, 0x091f, 0x0920,
+	0x0921, 0x0922, 0x0923, 0x0924, 0x0925, 0x0926, 0x0927, 0x0928,
+	/* Node for range 0x010420-0x01042f */
+	0x0929, 0x092a, 0x092b, 0x092c, 0x092d, 0x092e, 0x092f, 0x0930,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0104b0-0x0104bf */
+	0x0931, 0x0932, 0x0933, 0x0934, 0x0935, 0x0936, 0x0937, 0x0938,
+	0x0939, 0x093a, 0x093b, 0x093c, 0x093d, 0x093e, 0x093f, 0x0940,
+	/* Node for range 0x0104c0-0x0104cf */
+	0x0941, 0x0942, 0x0943, 0x0944, 0x0945, 0x0946, 0x0947, 0x0948,
+	0x0949, 0x094a, 0x094b, 0x094c, 0x094d, 0x094e, 0x094f, 0x0950,
+	/* Node for range 0x0104d0-0x0104df */
+	0x0951, 0x0952, 0x0953, 0x0954, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x010a00-0x010a0f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0167, 0x0000, 0x0165,
+	/* Node for range 0x010a30-0x010a3f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0165, 0x016a, 0x0167, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c1,
+	/* Node for range 0x010ae0-0x010aef */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0167, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x010c80-0x010c8f */
+	0x0955, 0x0956, 0x0957, 0x0958, 0x0959, 0x095a, 0x095b, 0x095c,
+	0x095d, 0x095e, 0x095f, 0x0960, 0x0961, 0x0962, 0x0963, 0x0964,
+	/* Node for range 0x010c90-0x010c9f */
+	0x0965, 0x0966, 0x0967, 0x0968, 0x0969, 0x096a, 0x096b, 0x096c,
+	0x096d, 0x096e, 0x096f, 0x0970, 0x0971, 0x0972, 0x0973, 0x0974,
+	/* Node for range 0x010ca0-0x010caf */
+	0x0975, 0x0976, 0x0977, 0x0978, 0x0979, 0x097a, 0x097b, 0x097c,
+	0x097d, 0x097e, 0x097f, 0x0980, 0x0981, 0x0982, 0x0983, 0x0984,
+	/* Node for range 0x010cb0-0x010cbf */
+	0x0985, 0x0986, 0x0987, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011090-0x01109f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0988, 0x0000, 0x0989, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0110a0-0x0110af */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x098a, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0110b0-0x0110bf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x02c1, 0x02c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011100-0x01110f */
+	0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011120-0x01112f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x098b, 0x098c,
+	/* Node for range 0x011130-0x01113f */
+	0x0000, 0x0000, 0x0000, 0x02c1, 0x02c1, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0111c0-0x0111cf */
+	0x02c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x02c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011230-0x01123f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c1, 0x02c0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0112e0-0x0112ef */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x02c0, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011340-0x01134f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x098d, 0x098e, 0x02c1, 0x0000, 0x0000,
+	/* Node for range 0x011360-0x01136f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011370-0x01137f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011440-0x01144f */
+	0x0000, 0x0000, 0x02c1, 0x0000, 0x0000, 0x0000, 0x02c0, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0114b0-0x0114bf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x098f, 0x0990, 0x0000, 0x0991, 0x0000,
+	/* Node for range 0x0114c0-0x0114cf */
+	0x0000, 0x0000, 0x02c1, 0x02c0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0115b0-0x0115bf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0992, 0x0993, 0x0000, 0x0000, 0x0000, 0x02c1,
+	/* Node for range 0x0115c0-0x0115cf */
+	0x02c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0116b0-0x0116bf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c1, 0x02c0,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x011720-0x01172f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x02c1, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x0118a0-0x0118af */
+	0x0994, 0x0995, 0x0996, 0x0997, 0x0998, 0x0999, 0x099a, 0x099b,
+	0x099c, 0x099d, 0x099e, 0x099f, 0x09a0, 0x09a1, 0x09a2, 0x09a3,
+	/* Node for range 0x0118b0-0x0118bf */
+	0x09a4, 0x09a5, 0x09a6, 0x09a7, 0x09a8, 0x09a9, 0x09aa, 0x09ab,
+	0x09ac, 0x09ad, 0x09ae, 0x09af, 0x09b0, 0x09b1, 0x09b2, 0x09b3,
+	/* Node for range 0x016af0-0x016aff */
+	0x016a, 0x016a, 0x016a, 0x016a, 0x016a, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x016b30-0x016b3f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01bc90-0x01bc9f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x016a, 0x0000,
+	/* Node for range 0x01d150-0x01d15f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09b4, 0x09b5,
+	/* Node for range 0x01d160-0x01d16f */
+	0x09b6, 0x09b7, 0x09b8, 0x09b9, 0x09ba, 0x0168, 0x0168, 0x016a,
+	0x016a, 0x016a, 0x0000, 0x0000, 0x0000, 0x09bb, 0x0168, 0x0168,
+	/* Node for range 0x01d170-0x01d17f */
+	0x0168, 0x0168, 0x0168, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167,
+	/* Node for range 0x01d180-0x01d18f */
+	0x0167, 0x0167, 0x0167, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0167, 0x0167, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01d1a0-0x01d1af */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000,
+	/* Node for range 0x01d1b0-0x01d1bf */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x09bc, 0x09bd, 0x09be, 0x09bf, 0x09c0,
+	/* Node for range 0x01d1c0-0x01d1cf */
+	0x09c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01d240-0x01d24f */
+	0x0000, 0x0000, 0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01e000-0x01e00f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0000,
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x01e010-0x01e01f */
+	0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165, 0x0165, 0x0165,
+	/* Node for range 0x01e020-0x01e02f */
+	0x0165, 0x0165, 0x0000, 0x0165, 0x0165, 0x0000, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x0165, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01e8d0-0x01e8df */
+	0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01e900-0x01e90f */
+	0x09c2, 0x09c3, 0x09c4, 0x09c5, 0x09c6, 0x09c7, 0x09c8, 0x09c9,
+	0x09ca, 0x09cb, 0x09cc, 0x09cd, 0x09ce, 0x09cf, 0x09d0, 0x09d1,
+	/* Node for range 0x01e910-0x01e91f */
+	0x09d2, 0x09d3, 0x09d4, 0x09d5, 0x09d6, 0x09d7, 0x09d8, 0x09d9,
+	0x09da, 0x09db, 0x09dc, 0x09dd, 0x09de, 0x09df, 0x09e0, 0x09e1,
+	/* Node for range 0x01e920-0x01e92f */
+	0x09e2, 0x09e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x01e940-0x01e94f */
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0165, 0x0165, 0x0165, 0x0165,
+	0x0165, 0x0165, 0x02c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	/* Node for range 0x02f800-0x02f80f */
+	0x09e4, 0x09e5, 0x09e6, 0x09e7, 0x09e8, 0x09e9, 0x09ea, 0x09eb,
+	0x09ec, 0x09ed, 0x09ee, 0x09ef, 0x09f0, 0x09f1, 0x09f2, 0x09f3,
+	/* Node for range 0x02f810-0x02f81f */
+	0x09f4, 0x09f5, 0x09f6, 0x09f7, 0x09f8, 0x09f9, 0x09fa, 0x09fb,
+	0x09fc, 0x09fd, 0x09fe, 0x09ff, 0x0a00, 0x0a01, 0x0a02, 0x0a03,
+	/* Node for range 0x02f820-0x02f82f */
+	0x0a04, 0x0a05, 0x0a06, 0x0a07, 0x0a08, 0x0a09, 0x0a0a, 0x0a0b,
+	0x0a0c, 0x0a0d, 0x0a0e, 0x0a0f, 0x0a10, 0x0a11, 0x0a12, 0x0a13,
+	/* Node for range 0x02f830-0x02f83f */
+	0x0a14, 0x0a15, 0x0a16, 0x0a17, 0x0a18, 0x0a19, 0x0a1a, 0x0a1b,
+	0x0a1c, 0x0a1d, 0x0a1e, 0x0a1f, 0x0a20, 0x0a21, 0x0a22, 0x0a23,
+	/* Node for range 0x02f840-0x02f84f */
+	0x0a24, 0x0a25, 0x0a26, 0x0a27, 0x0a28, 0x0a29, 0x0a2a, 0x0a2b,
+	0x0a2c, 0x0a2d, 0x0a2e, 0x0a2f, 0x0a30, 0x0a31, 0x0a32, 0x0a33,
+	/* Node for range 0x02f850-0x02f85f */
+	0x0a34, 0x0a35, 0x0a36, 0x0a37, 0x0a38, 0x0a39, 0x0a3a, 0x0a3b,
+	0x0a3c, 0x0a3d, 0x0a3e, 0x0a3f, 0x0a40, 0x0a41, 0x0a42, 0x0a43,
+	/* Node for range 0x02f860-0x02f86f */
+	0x0a44, 0x0a45, 0x0a46, 0x0a47, 0x0a48, 0x0a49, 0x0a4a, 0x0a4b,
+	0x0a4c, 0x0a4d, 0x0a4e, 0x0a4f, 0x0a50, 0x0a51, 0x0a52, 0x0a53,
+	/* Node for range 0x02f870-0x02f87f */
+	0x0a54, 0x0a55, 0x0a56, 0x0a57, 0x0a58, 0x0a59, 0x0a5a, 0x0a5b,
+	0x0a5c, 0x0a5d, 0x0a5e, 0x0a5f, 0x0a60, 0x0a61, 0x0a62, 0x0a63,
+	/* Node for range 0x02f880-0x02f88f */
+	0x0a64, 0x0a65, 0x0a66, 0x0a67, 0x0a68, 0x0a69, 0x0a6a, 0x0a6b,
+	0x0a6c, 0x0a6d, 0x0a6e, 0x0a6f, 0x0a70, 0x0a71, 0x0a72, 0x0a73,
+	/* Node for range 0x02f890-0x02f89f */
+	0x0a74, 0x0a75, 0x0a76, 0x0a77, 0x0a78, 0x0a79, 0x0a7a, 0x0a7b,
+	0x0a7c, 0x0a7d, 0x0a7e, 0x0a7f, 0x0a80, 0x0a81, 0x0a82, 0x0a83,
+	/* Node for range 0x02f8a0-0x02f8af */
+	0x0a84, 0x0a85, 0x0a86, 0x0a87, 0x0a88, 0x0a89, 0x0a8a, 0x0a8b,
+	0x0a8c, 0x0a8d, 0x0a8e, 0x0a8f, 0x0a90, 0x0a91, 0x0a92, 0x0a93,
+	/* Node for range 0x02f8b0-0x02f8bf */
+	0x0a94, 0x0a95, 0x0a96, 0x0a97, 0x0a98, 0x0a99, 0x0a9a, 0x0a9b,
+	0x0a9c, 0x0a9d, 0x0a9e, 0x0a9f, 0x0aa0, 0x0aa1, 0x0aa2, 0x0aa3,
+	/* Node for range 0x02f8c0-0x02f8cf */
+	0x0aa4, 0x0aa5, 0x0aa6, 0x0aa7, 0x0aa8, 0x0aa9, 0x0aaa, 0x0aab,
+	0x0aac, 0x0aad, 0x0aae, 0x0aaf, 0x0ab0, 0x0ab1, 0x0ab2, 0x0ab3,
+	/* Node for range 0x02f8d0-0x02f8df */
+	0x0ab4, 0x0ab5, 0x0ab6, 0x0ab7, 0x0ab8, 0x0ab9, 0x0aba, 0x0abb,
+	0x0abc, 0x0abd, 0x0abe, 0x0abf, 0x0ac0, 0x0ac1, 0x0ac2, 0x0ac3,
+	/* Node for range 0x02f8e0-0x02f8ef */
+	0x0ac4, 0x0ac5, 0x0ac6, 0x0ac7, 0x0ac8, 0x0ac9, 0x0aca, 0x0acb,
+	0x0acc, 0x0acd, 0x0ace, 0x0acf, 0x0ad0, 0x0ad1, 0x0ad2, 0x0ad3,
+	/* Node for range 0x02f8f0-0x02f8ff */
+	0x0ad4, 0x0ad5, 0x0ad6, 0x0ad7, 0x0ad8, 0x0ad9, 0x0ada, 0x0adb,
+	0x0adc, 0x0add, 0x0ade, 0x0adf, 0x0ae0, 0x0ae1, 0x0ae2, 0x0ae3,
+	/* Node for range 0x02f900-0x02f90f */
+	0x0ae4, 0x0ae5, 0x0ae6, 0x0ae7, 0x0ae8, 0x0ae9, 0x0aea, 0x0aeb,
+	0x0aec, 0x0aed, 0x0aee, 0x0aef, 0x0af0, 0x0af1, 0x0af2, 0x0af3,
+	/* Node for range 0x02f910-0x02f91f */
+	0x0af4, 0x0af5, 0x0af6, 0x0af7, 0x0af8, 0x0af9, 0x0afa, 0x0afb,
+	0x0afc, 0x0afd, 0x0afe, 0x0aff, 0x0b00, 0x0b01, 0x0b02, 0x0b03,
+	/* Node for range 0x02f920-0x02f92f */
+	0x0b04, 0x0b05, 0x0b06, 0x0b07, 0x0b08, 0x0b09, 0x0b0a, 0x0b0b,
+	0x0b0c, 0x0b0d, 0x0b0e, 0x0b0f, 0x0b10, 0x0b11, 0x0b12, 0x0b13,
+	/* Node for range 0x02f930-0x02f93f */
+	0x0b14, 0x0b15, 0x0b16, 0x0b17, 0x0b18, 0x0b19, 0x0b1a, 0x0b1b,
+	0x0b1c, 0x0b1d, 0x0b1e, 0x0b1f, 0x0b20, 0x0b21, 0x0b22, 0x0b23,
+	/* Node for range 0x02f940-0x02f94f */
+	0x0b24, 0x0b25, 0x0b26, 0x0b27, 0x0b28, 0x0b29, 0x0b2a, 0x0b2b,
+	0x0b2c, 0x0b2d, 0x0b2e, 0x0b2f, 0x0b30, 0x0b31, 0x0b32, 0x0b33,
+	/* Node for range 0x02f950-0x02f95f */
+	0x0b34, 0x0b35, 0x0b36, 0x0b37, 0x0b38, 0x0b39, 0x0b3a, 0x0b3b,
+	0x0b3c, 0x0b3d, 0x0b3e, 0x0b3f, 0x0b40, 0x0b41, 0x0b42, 0x0b43,
+	/* Node for range 0x02f960-0x02f96f */
+	0x0b44, 0x0b45, 0x0b46, 0x0b47, 0x0b48, 0x0b49, 0x0b4a, 0x0b4b,
+	0x0b4c, 0x0b4d, 0x0b4e, 0x0b4f, 0x0b50, 0x0b51, 0x0b52, 0x0b53,
+	/* Node for range 0x02f970-0x02f97f */
+	0x0b54, 0x0b55, 0x0b56, 0x0b57, 0x0b58, 0x0b59, 0x0b5a, 0x0b5b,
+	0x0b5c, 0x0b5d, 0x0b5e, 0x0b5f, 0x0b60, 0x0b61, 0x0b62, 0x0b63,
+	/* Node for range 0x02f980-0x02f98f */
+	0x0b64, 0x0b65, 0x0b66, 0x0b67, 0x0b68, 0x0b69, 0x0b6a, 0x0b6b,
+	0x0b6c, 0x0b6d, 0x0b6e, 0x0b6f, 0x0b70, 0x0b71, 0x0b72, 0x0b73,
+	/* Node for range 0x02f990-0x02f99f */
+	0x0b74, 0x0b75, 0x0b76, 0x0b77, 0x0b78, 0x0b79, 0x0b7a, 0x0b7b,
+	0x0b7c, 0x0b7d, 0x0b7e, 0x0b7f, 0x0b80, 0x0b81, 0x0b82, 0x0b83,
+	/* Node for range 0x02f9a0-0x02f9af */
+	0x0b84, 0x0b85, 0x0b86, 0x0b87, 0x0b88, 0x0b89, 0x0b8a, 0x0b8b,
+	0x0b8c, 0x0b8d, 0x0b8e, 0x0b8f, 0x0b90, 0x0b91, 0x0b92, 0x0b93,
+	/* Node for range 0x02f9b0-0x02f9bf */
+	0x0b94, 0x0b95, 0x0b96, 0x0b97, 0x0b98, 0x0b99, 0x0b9a, 0x0b9b,
+	0x0b9c, 0x0b9d, 0x0b9e, 0x0b9f, 0x0ba0, 0x0ba1, 0x0ba2, 0x0ba3,
+	/* Node for range 0x02f9c0-0x02f9cf */
+	0x0ba4, 0x0ba5, 0x0ba6, 0x0ba7, 0x0ba8, 0x0ba9, 0x0baa, 0x0bab,
+	0x0bac, 0x0bad, 0x0bae, 0x0baf, 0x0bb0, 0x0bb1, 0x0bb2, 0x0bb3,
+	/* Node for range 0x02f9d0-0x02f9df */
+	0x0bb4, 0x0bb5, 0x0bb6, 0x0bb7, 0x0bb8, 0x0bb9, 0x0bba, 0x0bbb,
+	0x0bbc, 0x0bbd, 0x0bbe, 0x0bbf, 0x0bc0, 0x0bc1, 0x0bc2, 0x0bc3,
+	/* Node for range 0x02f9e0-0x02f9ef */
+	0x0bc4, 0x0bc5, 0x0bc6, 0x0bc7, 0x0bc8, 0x0bc9, 0x0bca, 0x0bcb,
+	0x0bcc, 0x0bcd, 0x0bce, 0x0bcf, 0x0bd0, 0x0bd1, 0x0bd2, 0x0bd3,
+	/* Node for range 0x02f9f0-0x02f9ff */
+	0x0bd4, 0x0bd5, 0x0bd6, 0x0bd7, 0x0bd8, 0x0bd9, 0x0bda, 0x0bdb,
+	0x0bdc, 0x0bdd, 0x0bde, 0x0bdf, 0x0be0, 0x0be1, 0x0be2, 0x0be3,
+	/* Node for range 0x02fa00-0x02fa0f */
+	0x0be4, 0x0be5, 0x0be6, 0x0be7, 0x0be8, 0x0be9, 0x0bea, 0x0beb,
+	0x0bec, 0x0bed, 0x0bee, 0x0bef, 0x0bf0, 0x0bf1, 0x0bf2, 0x0bf3,
+	/* Node for range 0x02fa10-0x02fa1f */
+	0x0bf4, 0x0bf5, 0x0bf6, 0x0bf7, 0x0bf8, 0x0bf9, 0x0bfa, 0x0bfb,
+	0x0bfc, 0x0bfd, 0x0bfe, 0x0bff, 0x0c00, 0x0c01, 0x0000, 0x0000,
+};
+
+static const struct apfs_unidata apfs_unidata[] __aligned(64) = {
+	{0x0000, 0x0000,   0}, {0x0000, 0x0001,   0}, {0x0000, 0x0009,   0},
+	{0x0000, 0x0011,   0}, {0x0000, 0x0019,   0}, {0x0000, 0x0021,   0},
+	{0x0000, 0x0029,   0}, {0x0000, 0x0031,   0}, {0x0000, 0x0039,   0},
+	{0x0000, 0x0041,   0}, {0x0000, 0x0049,   0}, {0x0000, 0x0051,   0},
+	{0x0000, 0x0059,   0}, {0x0000, 0x0061,   0}, {0x0000, 0x0069,   0},
+	{0x0000, 0x0071,   0}, {0x0000, 0x0079,   0}, {0x0000, 0x0081,   0},
+	{0x0000, 0x0089,   0}, {0x0000, 0x0091,   0}, {0x0000, 0x0099,   0},
+	{0x0000, 0x00a1,   0}, {0x0000, 0x00a9,   0}, {0x0000, 0x00b1,   0},
+	{0x0000, 0x00b9,   0}, {0x0000, 0x00c1,   0}, {0x0000, 0x00c9,   0},
+	{0x0000, 0x00d1,   0}, {0x0002, 0x00da,   0}, {0x0012, 0x00ea,   0},
+	{0x0022, 0x00fa,   0}, {0x0032, 0x010a,   0}, {0x0042, 0x011a,   0},
+	{0x0052, 0x012a,   0}, {0x0000, 0x0139,   0}, {0x0062, 0x0142,   0},
+	{0x0072, 0x0152,   0}, {0x0082, 0x0162,   0}, {0x0092, 0x0172,   0},
+	{0x00a2, 0x0182,   0}, {0x00b2, 0x0192,   0}, {0x00c2, 0x01a2,   0},
+	{0x00d2, 0x01b2,   0}, {0x00e2, 0x01c2,   0}, {0x0000, 0x01d1,   0},
+	{0x00f2, 0x01da,   0}, {0x0102, 0x01ea,   0}, {0x0112, 0x01fa,   0},
+	{0x0122, 0x020a,   0}, {0x0132, 0x021a,   0}, {0x0142, 0x022a,   0},
+	{0x0000, 0x0239,   0}, {0x0152, 0x0242,   0}, {0x0162, 0x0252,   0},
+	{0x0172, 0x0262,   0}, {0x0182, 0x0272,   0}, {0x0192, 0x0282,   0},
+	{0x0000, 0x0291,   0}, {0x0000, 0x029a,   0}, {0x01a2, 0x02aa,   0},
+	{0x01b2, 0x02ba,   0}, {0x01c2, 0x02ca,   0}, {0x01d2, 0x02da,   0},
+	{0x01e2, 0x02ea,   0}, {0x01f2, 0x02fa,   0}, {0x0202, 0x030a,   0},
+	{0x0212, 0x031a,   0}, {0x0222, 0x032a,   0}, {0x0232, 0x033a,   0},
+	{0x0242, 0x034a,   0}, {0x0252, 0x035a,   0}, {0x0262, 0x036a,   0},
+	{0x0272, 0x037a,   0}, {0x0282, 0x038a,   0}, {0x0292, 0x039a,   0},
+	{0x02a2, 0x03aa,   0}, {0x02b2, 0x03ba,   0}, {0x02c2, 0x03ca,   0},
+	{0x02d2, 0x03da,   0}, {0x02e2, 0x03ea,   0}, {0x02f2, 0x03fa,   0},
+	{0x0302, 0x040a,   0}, {0x0312, 0x041a,   0}, {0x0322, 0x042a,   0},
+	{0x0332, 0x043a,   0}, {0x0342, 0x044a,   0}, {0x0352, 0x045a,   0},
+	{0x0362, 0x046a,   0}, {0x0372, 0x047a,   0}, {0x0382, 0x048a,   0},
+	{0x0392, 0x049a,   0}, {0x03a2, 0x04aa,   0}, {0x03b2, 0x04ba,   0},
+	{0x03c2, 0x04ca,   0}, {0x03d2, 0x04da,   0}, {0x03e2, 0x04ea,   0},
+	{0x03f2, 0x04fa,   0}, {0x0402, 0x050a,   0}, {0x0412, 0x051a,   0},
+	{0x0422, 0x052a,   0}, {0x0432, 0x053a,   0}, {0x0442, 0x054a,   0},
+	{0x0000, 0x0559,   0}, {0x0452, 0x0562,   0}, {0x0462, 0x0572,   0},
+	{0x0472, 0x0582,   0}, {0x0482, 0x0592,   0}, {0x0492, 0x05a2,   0},
+	{0x04a2, 0x05b2,   0}, {0x04b2, 0x05c2,   0}, {0x04c2, 0x05d2,   0},
+	{0x04d2, 0x05e2,   0}, {0x04e2, 0x05f2,   0}, {0x04f2, 0x0602,   0},
+	{0x0502, 0x0612,   0}, {0x0512, 0x0622,   0}, {0x0522, 0x0632,   0},
+	{0x0532, 0x0642,   0}, {0x0542, 0x0652,   0}, {0x0552, 0x0662,   0},
+	{0x0562, 0x0672,   0}, {0x0572, 0x0682,   0}, {0x0582, 0x0692,   0},
+	{0x0000, 0x06a1,   0}, {0x0592, 0x06aa,   0}, {0x05a2, 0x06ba,   0},
+	{0x05b2, 0x06ca,   0}, {0x05c2, 0x06da,   0}, {0x05d2, 0x06ea,   0},
+	{0x05e2, 0x06fa,   0}, {0x05f2, 0x070a,   0}, {0x0602, 0x071a,   0},
+	{0x0612, 0x072a,   0}, {0x0000, 0x0739,   0}, {0x0622, 0x0742,   0},
+	{0x0632, 0x0752,   0}, {0x0642, 0x0762,   0}, {0x0652, 0x0772,   0},
+	{0x0662, 0x0782,   0}, {0x0672, 0x0792,   0}, {0x0682, 0x07a2,   0},
+	{0x0692, 0x07b2,   0}, {0x06a2, 0x07c2,   0}, {0x06b2, 0x07d2,   0},
+	{0x0000, 0x07e1,   0}, {0x0000, 0x07e9,   0}, {0x06c2, 0x07f2,   0},
+	{0x06d2, 0x0802,   0}, {0x06e2, 0x0812,   0}, {0x06f2, 0x0822,   0},
+	{0x0702, 0x0832,   0}, {0x0712, 0x0842,   0}, {0x0000, 0x0852,   0},
+	{0x0000, 0x0861,   0}, {0x0722, 0x086a,   0}, {0x0732, 0x087a,   0},
+	{0x0742, 0x088a,   0}, {0x0752, 0x089a,   0}, {0x0762, 0x08aa,   0},
+	{0x0772, 0x08ba,   0}, {0x0000, 0x08c9,   0}, {0x0782, 0x08d2,   0},
+	{0x0792, 0x08e2,   0}, {0x07a2, 0x08f2,   0}, {0x07b2, 0x0902,   0},
+	{0x07c2, 0x0912,   0}, {0x07d2, 0x0922,   0}, {0x07e2, 0x0932,   0},
+	{0x07f2, 0x0942,   0}, {0x0802, 0x0952,   0}, {0x0812, 0x0962,   0},
+	{0x0822, 0x0972,   0}, {0x0832, 0x0982,   0}, {0x0842, 0x0992,   0},
+	{0x0852, 0x09a2,   0}, {0x0862, 0x09b2,   0}, {0x0872, 0x09c2,   0},
+	{0x0882, 0x09d2,   0}, {0x0892, 0x09e2,   0}, {0x0000, 0x09f1,   0},
+	{0x08a2, 0x09fa,   0}, {0x08b2, 0x0a0a,   0}, {0x08c2, 0x0a1a,   0},
+	{0x08d2, 0x0a2a,   0}, {0x08e2, 0x0a3a,   0}, {0x08f2, 0x0a4a,   0},
+	{0x0902, 0x0a5a,   0}, {0x0912, 0x0a6a,   0}, {0x0922, 0x0a7a,   0},
+	{0x0932, 0x0a8a,   0}, {0x0942, 0x0a9a,   0}, {0x0952, 0x0aaa,   0},
+	{0x0962, 0x0aba,   0}, {0x0972, 0x0aca,   0}, {0x0982, 0x0ada,   0},
+	{0x0992, 0x0aea,   0}, {0x09a2, 0x0afa,   0}, {0x09b2, 0x0b0a,   0},
+	{0x09c2, 0x0b1a,   0}, {0x09d2, 0x0b2a,   0}, {0x09e2, 0x0b3a,   0},
+	{0x09f2, 0x0b4a,   0}, {0x0a02, 0x0b5a,   0}, {0x0000, 0x0b69,   0},
+	{0x0000, 0x0b71,   0}, {0x0000, 0x0b79,   0}, {0x0000, 0x0b81,   0},
+	{0x0000, 0x0b89,   0}, {0x0000, 0x0b91,   0}, {0x0000, 0x0b99,   0},
+	{0x0000, 0x0ba1,   0}, {0x0000, 0x0ba9,   0}, {0x0000, 0x0bb1,   0},
+	{0x0000, 0x0bb9,   0}, {0x0000, 0x0bc1,   0}, {0x0000, 0x0bc9,   0},
+	{0x0000, 0x0bd1,   0}, {0x0000, 0x0bd9,   0}, {0x0000, 0x0be1,   0},
+	{0x0000, 0x0be9,   0}, {0x0000, 0x0bf1,   0}, {0x0000, 0x0bf9,   0},
+	{0x0000, 0x0c01,   0}, {0x0000, 0x0c09,   0}, {0x0a12, 0x0c12,   0},
+	{0x0a22, 0x0c22,   0}, {0x0000, 0x0c31,   0}, {0x0000, 0x0c39,   0},
+	{0x0000, 0x0c41,   0}, {0x0000, 0x0c49,   0}, {0x0000, 0x0c51,   0},
+	{0x0000, 0x0c59,   0}, {0x0000, 0x0c61,   0}, {0x0a32, 0x0c6a,   0},
+	{0x0a42, 0x0c7a,   0}, {0x0000, 0x0c89,   0}, {0x0000, 0x0c91,   0},
+	{0x0000, 0x0c99,   0}, {0x0000, 0x0ca1,   0}, {0x0000, 0x0ca9,   0},
+	{0x0000, 0x0cb1,   0}, {0x0000, 0x0cb9,   0}, {0x0000, 0x0cc1,   0},
+	{0x0000, 0x0cc9,   0}, {0x0000, 0x0cd1,   0}, {0x0000, 0x0cd9,   0},
+	{0x0000, 0x0ce1,   0}, {0x0000, 0x0ce9,   0}, {0x0a52, 0x0cf2,   0},
+	{0x0a62, 0x0d02,   0}, {0x0a72, 0x0d12,   0}, {0x0a82, 0x0d22,   0},
+	{0x0a92, 0x0d32,   0}, {0x0aa2, 0x0d42,   0}, {0x0ab2, 0x0d52,   0},
+	{0x0ac2, 0x0d62,   0}, {0x0ad3, 0x0d73,   0}, {0x0aeb, 0x0d8b,   0},
+	{0x0b03, 0x0da3,   0}, {0x0b1b, 0x0dbb,   0}, {0x0b33, 0x0dd3,   0},
+	{0x0b4b, 0x0deb,   0}, {0x0b63, 0x0e03,   0}, {0x0b7b, 0x0e1b,   0},
+	{0x0b93, 0x0e33,   0}, {0x0bab, 0x0e4b,   0}, {0x0bc3, 0x0e63,   0},
+	{0x0bdb, 0x0e7b,   0}, {0x0bf2, 0x0e92,   0}, {0x0c02, 0x0ea2,   0},
+	{0x0000, 0x0eb1,   0}, {0x0c12, 0x0eba,   0}, {0x0c22, 0x0eca,   0},
+	{0x0c32, 0x0eda,   0}, {0x0c42, 0x0eea,   0}, {0x0c52, 0x0efa,   0},
+	{0x0c62, 0x0f0a,   0}, {0x0c73, 0x0f1b,   0}, {0x0c8b, 0x0f33,   0},
+	{0x0ca2, 0x0f4a,   0}, {0x0cb2, 0x0f5a,   0}, {0x0cc2, 0x0f6a,   0},
+	{0x0000, 0x0f79,   0}, {0x0000, 0x0f81,   0}, {0x0cd2, 0x0f8a,   0},
+	{0x0ce2, 0x0f9a,   0}, {0x0000, 0x0fa9,   0}, {0x0000, 0x0fb1,   0},
+	{0x0cf2, 0x0fba,   0}, {0x0d02, 0x0fca,   0}, {0x0d13, 0x0fdb,   0},
+	{0x0d2b, 0x0ff3,   0}, {0x0d42, 0x100a,   0}, {0x0d52, 0x101a,   0},
+	{0x0d62, 0x102a,   0}, {0x0d72, 0x103a,   0}, {0x0d82, 0x104a,   0},
+	{0x0d92, 0x105a,   0}, {0x0da2, 0x106a,   0}, {0x0db2, 0x107a,   0},
+	{0x0dc2, 0x108a,   0}, {0x0dd2, 0x109a,   0}, {0x0de2, 0x10aa,   0},
+	{0x0df2, 0x10ba,   0}, {0x0e02, 0x10ca,   0}, {0x0e12, 0x10da,   0},
+	{0x0e22, 0x10ea,   0}, {0x0e32, 0x10fa,   0}, {0x0e42, 0x110a,   0},
+	{0x0e52, 0x111a,   0}, {0x0e62, 0x112a,   0}, {0x0e72, 0x113a,   0},
+	{0x0e82, 0x114a,   0}, {0x0e92, 0x115a,   0}, {0x0ea2, 0x116a,   0},
+	{0x0eb2, 0x117a,   0}, {0x0ec2, 0x118a,   0}, {0x0ed2, 0x119a,   0},
+	{0x0ee2, 0x11aa,   0}, {0x0ef2, 0x11ba,   0}, {0x0f02, 0x11ca,   0},
+	{0x0f12, 0x11da,   0}, {0x0f22, 0x11ea,   0}, {0x0f32, 0x11fa,   0},
+	{0x0000, 0x1209,   0}, {0x0f42, 0x1212,   0}, {0x0f52, 0x1222,   0},
+	{0x0000, 0x1231,   0}, {0x0000, 0x1239,   0}, {0x0000, 0x1241,   0},
+	{0x0f62, 0x124a,   0}, {0x0f72, 0x125a,   0}, {0x0f82, 0x126a,   0},
+	{0x0f92, 0x127a,   0}, {0x0fa3, 0x128b,   0}, {0x0fbb, 0x12a3,   0},
+	{0x0fd3, 0x12bb,   0}, {0x0feb, 0x12d3,   0}, {0x1002, 0x12ea,   0},
+	{0x1012, 0x12fa,   0}, {0x1023, 0x130b,   0}, {0x103b, 0x1323,   0},
+	{0x1052, 0x133a,   0}, {0x1062, 0x134a,   0}, {0x0000, 0x1359,   0},
+	{0x0000, 0x1361,   0}, {0x0000, 0x1369,   0}, {0x0000, 0x1371,   0},
+	{0x0000, 0x1379,   0}, {0x0000, 0x1381,   0}, {0x0000, 0x1389,   0},
+	{0x0000, 0x1391,   0}, {0x0000, 0x1399,   0}, {0x0000, 0x13a1,   0},
+	{0x0000, 0x13a9,   0}, {0x0000, 0x13b1,   0}, {0x0000, 0x13b9,   0},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 232}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 216}, {0x0000, 0x0000, 202}, {0x0000, 0x0000,   1},
+	{0x1071, 0x13c1, 230}, {0x1079, 0x13c9, 230}, {0x1081, 0x13d1, 230},
+	{0x108a, 0x13da, 230}, {0x0000, 0x13e9, 240}, {0x0000, 0x0000, 233},
+	{0x0000, 0x0000, 234}, {0x0000, 0x13f1,   0}, {0x0000, 0x13f9,   0},
+	{0x1099, 0x1401,   0}, {0x0000, 0x1409,   0}, {0x10a1, 0x1411,   0},
+	{0x0000, 0x1419,   0}, {0x10aa, 0x1422,   0}, {0x10ba, 0x1432,   0},
+	{0x10c9, 0x1441,   0}, {0x10d2, 0x144a,   0}, {0x10e2, 0x145a,   0},
+	{0x10f2, 0x146a,   0}, {0x1102, 0x147a,   0}, {0x1112, 0x148a,   0},
+	{0x1122, 0x149a,   0}, {0x1133, 0x14ab,   0}, {0x0000, 0x14c1,   0},
+	{0x0000, 0x14c9,   0}, {0x0000, 0x14d1,   0}, {0x0000, 0x14d9,   0},
+	{0x0000, 0x14e1,   0}, {0x0000, 0x14e9,   0}, {0x0000, 0x14f1,   0},
+	{0x0000, 0x14f9,   0}, {0x0000, 0x1501,   0}, {0x0000, 0x1509,   0},
+	{0x0000, 0x1511,   0}, {0x0000, 0x1519,   0}, {0x0000, 0x1521,   0},
+	{0x0000, 0x1529,   0}, {0x0000, 0x1531,   0}, {0x0000, 0x1539,   0},
+	{0x0000, 0x1541,   0}, {0x0000, 0x1549,   0}, {0x0000, 0x1551,   0},
+	{0x0000, 0x1559,   0}, {0x0000, 0x1561,   0}, {0x0000, 0x1569,   0},
+	{0x0000, 0x1571,   0}, {0x0000, 0x1579,   0}, {0x114a, 0x1582,   0},
+	{0x115a, 0x1592,   0}, {0x116a, 0x15a2,   0}, {0x117a, 0x15b2,   0},
+	{0x118a, 0x15c2,   0}, {0x119a, 0x15d2,   0}, {0x11ab, 0x15e3,   0},
+	{0x0000, 0x15f9,   0}, {0x11c2, 0x1602,   0}, {0x11d2, 0x1612,   0},
+	{0x11e2, 0x1622,   0}, {0x11f2, 0x1632,   0}, {0x1202, 0x1642,   0},
+	{0x0000, 0x1651,   0}, {0x0000, 0x1659,   0}, {0x0000, 0x1661,   0},
+	{0x1212, 0x166a,   0}, {0x1222, 0x167a,   0}, {0x0000, 0x1689,   0},
+	{0x0000, 0x1691,   0}, {0x0000, 0x1699,   0}, {0x0000, 0x16a1,   0},
+	{0x0000, 0x16a9,   0}, {0x0000, 0x16b1,   0}, {0x0000, 0x16b9,   0},
+	{0x0000, 0x16c1,   0}, {0x0000, 0x16c9,   0}, {0x0000, 0x16d1,   0},
+	{0x0000, 0x16d9,   0}, {0x0000, 0x16e1,   0}, {0x0000, 0x16e9,   0},
+	{0x0000, 0x16f1,   0}, {0x0000, 0x16f9,   0}, {0x0000, 0x1701,   0},
+	{0x0000, 0x1709,   0}, {0x0000, 0x1711,   0}, {0x0000, 0x1719,   0},
+	{0x0000, 0x1721,   0}, {0x0000, 0x1729,   0}, {0x0000, 0x1731,   0},
+	{0x0000, 0x1739,   0}, {0x0000, 0x1741,   0}, {0x1232, 0x174a,   0},
+	{0x1242, 0x175a,   0}, {0x0000, 0x1769,   0}, {0x1252, 0x1772,   0},
+	{0x0000, 0x1781,   0}, {0x0000, 0x1789,   0}, {0x0000, 0x1791,   0},
+	{0x1262, 0x179a,   0}, {0x0000, 0x17a9,   0}, {0x0000, 0x17b1,   0},
+	{0x0000, 0x17b9,   0}, {0x0000, 0x17c1,   0}, {0x1272, 0x17ca,   0},
+	{0x1282, 0x17da,   0}, {0x1292, 0x17ea,   0}, {0x0000, 0x17f9,   0},
+	{0x0000, 0x1801,   0}, {0x0000, 0x1809,   0}, {0x0000, 0x1811,   0},
+	{0x0000, 0x1819,   0}, {0x0000, 0x1821,   0}, {0x0000, 0x1829,   0},
+	{0x0000, 0x1831,   0}, {0x0000, 0x1839,   0}, {0x0000, 0x1841,   0},
+	{0x12a2, 0x184a,   0}, {0x0000, 0x1859,   0}, {0x0000, 0x1861,   0},
+	{0x0000, 0x1869,   0}, {0x0000, 0x1871,   0}, {0x0000, 0x1879,   0},
+	{0x0000, 0x1881,   0}, {0x0000, 0x1889,   0}, {0x0000, 0x1891,   0},
+	{0x0000, 0x1899,   0}, {0x0000, 0x18a1,   0}, {0x0000, 0x18a9,   0},
+	{0x0000, 0x18b1,   0}, {0x0000, 0x18b9,   0}, {0x0000, 0x18c1,   0},
+	{0x0000, 0x18c9,   0}, {0x0000, 0x18d1,   0}, {0x0000, 0x18d9,   0},
+	{0x0000, 0x18e1,   0}, {0x0000, 0x18e9,   0}, {0x0000, 0x18f1,   0},
+	{0x0000, 0x18f9,   0}, {0x0000, 0x1901,   0}, {0x12b2, 0x190a,   0},
+	{0x12c2, 0x191a,   0}, {0x12d2, 0x192a,   0}, {0x12e2, 0x193a,   0},
+	{0x12f2, 0x194a,   0}, {0x1302, 0x195a,   0}, {0x1312, 0x196a,   0},
+	{0x1322, 0x197a,   0}, {0x0000, 0x1989,   0}, {0x0000, 0x1991,   0},
+	{0x0000, 0x1999,   0}, {0x0000, 0x19a1,   0}, {0x0000, 0x19a9,   0},
+	{0x0000, 0x19b1,   0}, {0x0000, 0x19b9,   0}, {0x0000, 0x19c1,   0},
+	{0x0000, 0x19c9,   0}, {0x0000, 0x19d1,   0}, {0x0000, 0x19d9,   0},
+	{0x1332, 0x19e2,   0}, {0x1342, 0x19f2,   0}, {0x0000, 0x1a01,   0},
+	{0x0000, 0x1a09,   0}, {0x0000, 0x1a11,   0}, {0x0000, 0x1a19,   0},
+	{0x0000, 0x1a21,   0}, {0x0000, 0x1a29,   0}, {0x0000, 0x1a31,   0},
+	{0x0000, 0x1a39,   0}, {0x0000, 0x1a41,   0}, {0x0000, 0x1a49,   0},
+	{0x0000, 0x1a51,   0}, {0x0000, 0x1a59,   0}, {0x0000, 0x1a61,   0},
+	{0x0000, 0x1a69,   0}, {0x0000, 0x1a71,   0}, {0x0000, 0x1a79,   0},
+	{0x0000, 0x1a81,   0}, {0x0000, 0x1a89,   0}, {0x0000, 0x1a91,   0},
+	{0x0000, 0x1a99,   0}, {0x0000, 0x1aa1,   0}, {0x0000, 0x1aa9,   0},
+	{0x0000, 0x1ab1,   0}, {0x0000, 0x1ab9,   0}, {0x0000, 0x1ac1,   0},
+	{0x0000, 0x1ac9,   0}, {0x0000, 0x1ad1,   0}, {0x0000, 0x1ad9,   0},
+	{0x0000, 0x1ae1,   0}, {0x0000, 0x1ae9,   0}, {0x0000, 0x1af1,   0},
+	{0x0000, 0x1af9,   0}, {0x0000, 0x1b01,   0}, {0x1352, 0x1b0a,   0},
+	{0x1362, 0x1b1a,   0}, {0x0000, 0x1b29,   0}, {0x0000, 0x1b31,   0},
+	{0x0000, 0x1b39,   0}, {0x0000, 0x1b41,   0}, {0x0000, 0x1b49,   0},
+	{0x0000, 0x1b51,   0}, {0x1372, 0x1b5a,   0}, {0x1382, 0x1b6a,   0},
+	{0x1392, 0x1b7a,   0}, {0x13a2, 0x1b8a,   0}, {0x0000, 0x1b99,   0},
+	{0x13b2, 0x1ba2,   0}, {0x13c2, 0x1bb2,   0}, {0x0000, 0x1bc1,   0},
+	{0x13d2, 0x1bca,   0}, {0x13e2, 0x1bda,   0}, {0x13f2, 0x1bea,   0},
+	{0x1402, 0x1bfa,   0}, {0x1412, 0x1c0a,   0}, {0x1422, 0x1c1a,   0},
+	{0x0000, 0x1c29,   0}, {0x1432, 0x1c32,   0}, {0x1442, 0x1c42,   0},
+	{0x1452, 0x1c52,   0}, {0x1462, 0x1c62,   0}, {0x1472, 0x1c72,   0},
+	{0x1482, 0x1c82,   0}, {0x0000, 0x1c91,   0}, {0x1492, 0x1c9a,   0},
+	{0x14a2, 0x1caa,   0}, {0x14b2, 0x1cba,   0}, {0x14c2, 0x1cca,   0},
+	{0x14d2, 0x1cda,   0}, {0x14e2, 0x1cea,   0}, {0x14f2, 0x1cfa,   0},
+	{0x1502, 0x1d0a,   0}, {0x1512, 0x1d1a,   0}, {0x1522, 0x1d2a,   0},
+	{0x1532, 0x1d3a,   0}, {0x1542, 0x1d4a,   0}, {0x0000, 0x1d59,   0},
+	{0x1552, 0x1d62,   0}, {0x1562, 0x1d72,   0}, {0x0000, 0x1d81,   0},
+	{0x0000, 0x1d89,   0}, {0x0000, 0x1d91,   0}, {0x0000, 0x1d99,   0},
+	{0x0000, 0x1da1,   0}, {0x0000, 0x1da9,   0}, {0x0000, 0x1db1,   0},
+	{0x0000, 0x1db9,   0}, {0x0000, 0x1dc1,   0}, {0x0000, 0x1dc9,   0},
+	{0x0000, 0x1dd1,   0}, {0x0000, 0x1dd9,   0}, {0x0000, 0x1de1,   0},
+	{0x0000, 0x1de9,   0}, {0x0000, 0x1df1,   0}, {0x0000, 0x1df9,   0},
+	{0x0000, 0x1e01,   0}, {0x0000, 0x1e09,   0}, {0x0000, 0x1e11,   0},
+	{0x0000, 0x1e19,   0}, {0x0000, 0x1e21,   0}, {0x0000, 0x1e29,   0},
+	{0x0000, 0x1e31,   0}, {0x0000, 0x1e39,   0}, {0x0000, 0x1e41,   0},
+	{0x0000, 0x1e49,   0}, {0x0000, 0x1e51,   0}, {0x0000, 0x1e59,   0},
+	{0x0000, 0x1e61,   0}, {0x0000, 0x1e69,   0}, {0x0000, 0x1e71,   0},
+	{0x0000, 0x1e79,   0}, {0x0000, 0x1e81,   0}, {0x0000, 0x1e89,   0},
+	{0x0000, 0x1e91,   0}, {0x0000, 0x1e99,   0}, {0x0000, 0x1ea1,   0},
+	{0x0000, 0x1ea9,   0}, {0x0000, 0x1eb1,   0}, {0x0000, 0x1eb9,   0},
+	{0x0000, 0x1ec1,   0}, {0x0000, 0x1ec9,   0}, {0x0000, 0x1ed1,   0},
+	{0x0000, 0x1ed9,   0}, {0x0000, 0x1ee1,   0}, {0x0000, 0x1ee9,   0},
+	{0x0000, 0x1ef1,   0}, {0x0000, 0x1ef9,   0}, {0x0000, 0x1f01,   0},
+	{0x0000, 0x1f09,   0}, {0x0000, 0x1f11,   0}, {0x0000, 0x1f19,   0},
+	{0x0000, 0x1f21,   0}, {0x0000, 0x1f29,   0}, {0x0000, 0x1f31,   0},
+	{0x0000, 0x1f39,   0}, {0x0000, 0x1f41,   0}, {0x0000, 0x1f49,   0},
+	{0x0000, 0x1f51,   0}, {0x0000, 0x1f59,   0}, {0x0000, 0x1f61,   0},
+	{0x0000, 0x1f69,   0}, {0x0000, 0x1f71,   0}, {0x0000, 0x1f79,   0},
+	{0x0000, 0x1f81,   0}, {0x0000, 0x1f8a,   0}, {0x0000, 0x0000, 222},
+	{0x0000, 0x0000, 228}, {0x0000, 0x0000,  10}, {0x0000, 0x0000,  11},
+	{0x0000, 0x0000,  12}, {0x0000, 0x0000,  13}, {0x0000, 0x0000,  14},
+	{0x0000, 0x0000,  15}, {0x0000, 0x0000,  16}, {0x0000, 0x0000,  17},
+	{0x0000, 0x0000,  18}, {0x0000, 0x0000,  19}, {0x0000, 0x0000,  20},
+	{0x0000, 0x0000,  21}, {0x0000, 0x0000,  22}, {0x0000, 0x0000,  23},
+	{0x0000, 0x0000,  24}, {0x0000, 0x0000,  25}, {0x0000, 0x0000,  30},
+	{0x0000, 0x0000,  31}, {0x0000, 0x0000,  32}, {0x1572, 0x1f9a,   0},
+	{0x1582, 0x1faa,   0}, {0x1592, 0x1fba,   0}, {0x15a2, 0x1fca,   0},
+	{0x15b2, 0x1fda,   0}, {0x0000, 0x0000,  27}, {0x0000, 0x0000,  28},
+	{0x0000, 0x0000,  29}, {0x0000, 0x0000,  33}, {0x0000, 0x0000,  34},
+	{0x0000, 0x0000,  35}, {0x15c2, 0x1fea,   0}, {0x15d2, 0x1ffa,   0},
+	{0x15e2, 0x200a,   0}, {0x0000, 0x0000,  36}, {0x15f2, 0x201a,   0},
+	{0x1602, 0x202a,   0}, {0x1612, 0x203a,   0}, {0x0000, 0x0000,   7},
+	{0x0000, 0x0000,   9}, {0x1622, 0x204a,   0}, {0x1632, 0x205a,   0},
+	{0x1642, 0x206a,   0}, {0x1652, 0x207a,   0}, {0x1662, 0x208a,   0},
+	{0x1672, 0x209a,   0}, {0x1682, 0x20aa,   0}, {0x1692, 0x20ba,   0},
+	{0x16a2, 0x20ca,   0}, {0x16b2, 0x20da,   0}, {0x16c2, 0x20ea,   0},
+	{0x16d2, 0x20fa,   0}, {0x16e2, 0x210a,   0}, {0x16f2, 0x211a,   0},
+	{0x1702, 0x212a,   0}, {0x1712, 0x213a,   0}, {0x1722, 0x214a,   0},
+	{0x1732, 0x215a,   0}, {0x1742, 0x216a,   0}, {0x1752, 0x217a,   0},
+	{0x1762, 0x218a,   0}, {0x1772, 0x219a,   0}, {0x1782, 0x21aa,   0},
+	{0x1792, 0x21ba,   0}, {0x17a2, 0x21ca,   0}, {0x17b2, 0x21da,   0},
+	{0x17c2, 0x21ea,   0}, {0x17d2, 0x21fa,   0}, {0x17e2, 0x220a,   0},
+	{0x0000, 0x0000,  84}, {0x0000, 0x0000,  91}, {0x17f2, 0x221a,   0},
+	{0x1802, 0x222a,   0}, {0x1812, 0x223a,   0}, {0x1822, 0x224a,   0},
+	{0x1833, 0x225b,   0}, {0x184a, 0x2272,   0}, {0x185a, 0x2282,   0},
+	{0x186a, 0x2292,   0}, {0x187a, 0x22a2,   0}, {0x188a, 0x22b2,   0},
+	{0x189b, 0x22c3,   0}, {0x18b2, 0x22da,   0}, {0x0000, 0x0000, 103},
+	{0x0000, 0x0000, 107}, {0x0000, 0x0000, 118}, {0x0000, 0x0000, 122},
+	{0x18c2, 0x22ea,   0}, {0x18d2, 0x22fa,   0}, {0x18e2, 0x230a,   0},
+	{0x18f2, 0x231a,   0}, {0x1902, 0x232a,   0}, {0x1912, 0x233a,   0},
+	{0x0000, 0x0000, 129}, {0x0000, 0x0000, 130}, {0x1922, 0x234a,   0},
+	{0x0000, 0x0000, 132}, {0x1932, 0x235a,   0}, {0x1942, 0x236a,   0},
+	{0x1952, 0x237a,   0}, {0x1962, 0x238a,   0}, {0x1972, 0x239a,   0},
+	{0x1982, 0x23aa,   0}, {0x1992, 0x23ba,   0}, {0x19a2, 0x23ca,   0},
+	{0x19b2, 0x23da,   0}, {0x19c2, 0x23ea,   0}, {0x19d2, 0x23fa,   0},
+	{0x0000, 0x2409,   0}, {0x0000, 0x2411,   0}, {0x0000, 0x2419,   0},
+	{0x0000, 0x2421,   0}, {0x0000, 0x2429,   0}, {0x0000, 0x2431,   0},
+	{0x0000, 0x2439,   0}, {0x0000, 0x2441,   0}, {0x0000, 0x2449,   0},
+	{0x0000, 0x2451,   0}, {0x0000, 0x2459,   0}, {0x0000, 0x2461,   0},
+	{0x0000, 0x2469,   0}, {0x0000, 0x2471,   0}, {0x0000, 0x2479,   0},
+	{0x0000, 0x2481,   0}, {0x0000, 0x2489,   0}, {0x0000, 0x2491,   0},
+	{0x0000, 0x2499,   0}, {0x0000, 0x24a1,   0}, {0x0000, 0x24a9,   0},
+	{0x0000, 0x24b1,   0}, {0x0000, 0x24b9,   0}, {0x0000, 0x24c1,   0},
+	{0x0000, 0x24c9,   0}, {0x0000, 0x24d1,   0}, {0x0000, 0x24d9,   0},
+	{0x0000, 0x24e1,   0}, {0x0000, 0x24e9,   0}, {0x0000, 0x24f1,   0},
+	{0x0000, 0x24f9,   0}, {0x0000, 0x2501,   0}, {0x0000, 0x2509,   0},
+	{0x0000, 0x2511,   0}, {0x0000, 0x2519,   0}, {0x0000, 0x2521,   0},
+	{0x0000, 0x2529,   0}, {0x0000, 0x2531,   0}, {0x0000, 0x2539,   0},
+	{0x0000, 0x2541,   0}, {0x0000, 0x2549,   0}, {0x0000, 0x2551,   0},
+	{0x0000, 0x2559,   0}, {0x0000, 0x2561,   0}, {0x0000, 0x2569,   0},
+	{0x0000, 0x2571,   0}, {0x19e2, 0x257a,   0}, {0x19f2, 0x258a,   0},
+	{0x1a02, 0x259a,   0}, {0x1a12, 0x25aa,   0}, {0x1a22, 0x25ba,   0},
+	{0x1a32, 0x25ca,   0}, {0x1a42, 0x25da,   0}, {0x1a52, 0x25ea,   0},
+	{0x1a62, 0x25fa,   0}, {0x1a72, 0x260a,   0}, {0x1a82, 0x261a,   0},
+	{0x0000, 0x2629,   0}, {0x0000, 0x2631,   0}, {0x0000, 0x2639,   0},
+	{0x0000, 0x2641,   0}, {0x0000, 0x2649,   0}, {0x0000, 0x2651,   0},
+	{0x0000, 0x2659,   0}, {0x0000, 0x2661,   0}, {0x0000, 0x2669,   0},
+	{0x0000, 0x0000, 214}, {0x1a92, 0x2672,   0}, {0x1aa2, 0x2682,   0},
+	{0x1ab2, 0x2692,   0}, {0x1ac2, 0x26a2,   0}, {0x1ad2, 0x26b2,   0},
+	{0x1ae2, 0x26c2,   0}, {0x1af2, 0x26d2,   0}, {0x1b02, 0x26e2,   0},
+	{0x1b13, 0x26f3,   0}, {0x1b2b, 0x270b,   0}, {0x1b42, 0x2722,   0},
+	{0x1b52, 0x2732,   0}, {0x1b62, 0x2742,   0}, {0x1b72, 0x2752,   0},
+	{0x1b82, 0x2762,   0}, {0x1b92, 0x2772,   0}, {0x1ba2, 0x2782,   0},
+	{0x1bb2, 0x2792,   0}, {0x1bc2, 0x27a2,   0}, {0x1bd2, 0x27b2,   0},
+	{0x1be3, 0x27c3,   0}, {0x1bfb, 0x27db,   0}, {0x1c13, 0x27f3,   0},
+	{0x1c2b, 0x280b,   0}, {0x1c42, 0x2822,   0}, {0x1c52, 0x2832,   0},
+	{0x1c62, 0x2842,   0}, {0x1c72, 0x2852,   0}, {0x1c83, 0x2863,   0},
+	{0x1c9b, 0x287b,   0}, {0x1cb2, 0x2892,   0}, {0x1cc2, 0x28a2,   0},
+	{0x1cd2, 0x28b2,   0}, {0x1ce2, 0x28c2,   0}, {0x1cf2, 0x28d2,   0},
+	{0x1d02, 0x28e2,   0}, {0x1d12, 0x28f2,   0}, {0x1d22, 0x2902,   0},
+	{0x1d32, 0x2912,   0}, {0x1d42, 0x2922,   0}, {0x1d52, 0x2932,   0},
+	{0x1d62, 0x2942,   0}, {0x1d72, 0x2952,   0}, {0x1d82, 0x2962,   0},
+	{0x1d92, 0x2972,   0}, {0x1da2, 0x2982,   0}, {0x1db3, 0x2993,   0},
+	{0x1dcb, 0x29ab,   0}, {0x1de2, 0x29c2,   0}, {0x1df2, 0x29d2,   0},
+	{0x1e02, 0x29e2,   0}, {0x1e12, 0x29f2,   0}, {0x1e22, 0x2a02,   0},
+	{0x1e32, 0x2a12,   0}, {0x1e42, 0x2a22,   0}, {0x1e52, 0x2a32,   0},
+	{0x1e63, 0x2a43,   0}, {0x1e7b, 0x2a5b,   0}, {0x1e92, 0x2a72,   0},
+	{0x1ea2, 0x2a82,   0}, {0x1eb2, 0x2a92,   0}, {0x1ec2, 0x2aa2,   0},
+	{0x1ed2, 0x2ab2,   0}, {0x1ee2, 0x2ac2,   0}, {0x1ef2, 0x2ad2,   0},
+	{0x1f02, 0x2ae2,   0}, {0x1f12, 0x2af2,   0}, {0x1f22, 0x2b02,   0},
+	{0x1f32, 0x2b12,   0}, {0x1f42, 0x2b22,   0}, {0x1f52, 0x2b32,   0},
+	{0x1f62, 0x2b42,   0}, {0x1f72, 0x2b52,   0}, {0x1f82, 0x2b62,   0},
+	{0x1f92, 0x2b72,   0}, {0x1fa2, 0x2b82,   0}, {0x1fb3, 0x2b93,   0},
+	{0x1fcb, 0x2bab,   0}, {0x1fe3, 0x2bc3,   0}, {0x1ffb, 0x2bdb,   0},
+	{0x2013, 0x2bf3,   0}, {0x202b, 0x2c0b,   0}, {0x2043, 0x2c23,   0},
+	{0x205b, 0x2c3b,   0}, {0x2072, 0x2c52,   0}, {0x2082, 0x2c62,   0},
+	{0x2092, 0x2c72,   0}, {0x20a2, 0x2c82,   0}, {0x20b2, 0x2c92,   0},
+	{0x20c2, 0x2ca2,   0}, {0x20d2, 0x2cb2,   0}, {0x20e2, 0x2cc2,   0},
+	{0x20f3, 0x2cd3,   0}, {0x210b, 0x2ceb,   0}, {0x2122, 0x2d02,   0},
+	{0x2132, 0x2d12,   0}, {0x2142, 0x2d22,   0}, {0x2152, 0x2d32,   0},
+	{0x2162, 0x2d42,   0}, {0x2172, 0x2d52,   0}, {0x2183, 0x2d63,   0},
+	{0x219b, 0x2d7b,   0}, {0x21b3, 0x2d93,   0}, {0x21cb, 0x2dab,   0},
+	{0x21e3, 0x2dc3,   0}, {0x21fb, 0x2ddb,   0}, {0x2212, 0x2df2,   0},
+	{0x2222, 0x2e02,   0}, {0x2232, 0x2e12,   0}, {0x2242, 0x2e22,   0},
+	{0x2252, 0x2e32,   0}, {0x2262, 0x2e42,   0}, {0x2272, 0x2e52,   0},
+	{0x2282, 0x2e62,   0}, {0x2292, 0x2e72,   0}, {0x22a2, 0x2e82,   0},
+	{0x22b2, 0x2e92,   0}, {0x22c2, 0x2ea2,   0}, {0x22d2, 0x2eb2,   0},
+	{0x22e2, 0x2ec2,   0}, {0x22f3, 0x2ed3,   0}, {0x230b, 0x2eeb,   0},
+	{0x2323, 0x2f03,   0}, {0x233b, 0x2f1b,   0}, {0x2352, 0x2f32,   0},
+	{0x2362, 0x2f42,   0}, {0x2372, 0x2f52,   0}, {0x2382, 0x2f62,   0},
+	{0x2392, 0x2f72,   0}, {0x23a2, 0x2f82,   0}, {0x23b2, 0x2f92,   0},
+	{0x23c2, 0x2fa2,   0}, {0x23d2, 0x2fb2,   0}, {0x23e2, 0x2fc2,   0},
+	{0x23f2, 0x2fd2,   0}, {0x2402, 0x2fe2,   0}, {0x2412, 0x2ff2,   0},
+	{0x2422, 0x3002,   0}, {0x2432, 0x3012,   0}, {0x2442, 0x3022,   0},
+	{0x2452, 0x3032,   0}, {0x2462, 0x3042,   0}, {0x2472, 0x3052,   0},
+	{0x2482, 0x3062,   0}, {0x2492, 0x3072,   0}, {0x24a2, 0x3082,   0},
+	{0x24b2, 0x3092,   0}, {0x24c2, 0x30a2,   0}, {0x24d2, 0x30b2,   0},
+	{0x24e2, 0x30c2,   0}, {0x24f2, 0x30d2,   0}, {0x2502, 0x30e2,   0},
+	{0x2512, 0x30f2,   0}, {0x2522, 0x3102,   0}, {0x0000, 0x3112,   0},
+	{0x2532, 0x3122,   0}, {0x0000, 0x3132,   0}, {0x2542, 0x3142,   0},
+	{0x2552, 0x3152,   0}, {0x2562, 0x3162,   0}, {0x2572, 0x3172,   0},
+	{0x2583, 0x3183,   0}, {0x259b, 0x319b,   0}, {0x25b3, 0x31b3,   0},
+	{0x25cb, 0x31cb,   0}, {0x25e3, 0x31e3,   0}, {0x25fb, 0x31fb,   0},
+	{0x2613, 0x3213,   0}, {0x262b, 0x322b,   0}, {0x2643, 0x3243,   0},
+	{0x265b, 0x325b,   0}, {0x2673, 0x3273,   0}, {0x268b, 0x328b,   0},
+	{0x26a3, 0x32a3,   0}, {0x26bb, 0x32bb,   0}, {0x26d3, 0x32d3,   0},
+	{0x26eb, 0x32eb,   0}, {0x2703, 0x3303,   0}, {0x271b, 0x331b,   0},
+	{0x2733, 0x3333,   0}, {0x274b, 0x334b,   0}, {0x2762, 0x3362,   0},
+	{0x2772, 0x3372,   0}, {0x2782, 0x3382,   0}, {0x2792, 0x3392,   0},
+	{0x27a2, 0x33a2,   0}, {0x27b2, 0x33b2,   0}, {0x27c3, 0x33c3,   0},
+	{0x27db, 0x33db,   0}, {0x27f3, 0x33f3,   0}, {0x280b, 0x340b,   0},
+	{0x2823, 0x3423,   0}, {0x283b, 0x343b,   0}, {0x2853, 0x3453,   0},
+	{0x286b, 0x346b,   0}, {0x2883, 0x3483,   0}, {0x289b, 0x349b,   0},
+	{0x28b2, 0x34b2,   0}, {0x28c2, 0x34c2,   0}, {0x28d2, 0x34d2,   0},
+	{0x28e2, 0x34e2,   0}, {0x28f2, 0x34f2,   0}, {0x2902, 0x3502,   0},
+	{0x2912, 0x3512,   0}, {0x2922, 0x3522,   0}, {0x2933, 0x3533,   0},
+	{0x294b, 0x354b,   0}, {0x2963, 0x3563,   0}, {0x297b, 0x357b,   0},
+	{0x2993, 0x3593,   0}, {0x29ab, 0x35ab,   0}, {0x29c3, 0x35c3,   0},
+	{0x29db, 0x35db,   0}, {0x29f3, 0x35f3,   0}, {0x2a0b, 0x360b,   0},
+	{0x2a23, 0x3623,   0}, {0x2a3b, 0x363b,   0}, {0x2a53, 0x3653,   0},
+	{0x2a6b, 0x366b,   0}, {0x2a83, 0x3683,   0}, {0x2a9b, 0x369b,   0},
+	{0x2ab3, 0x36b3,   0}, {0x2acb, 0x36cb,   0}, {0x2ae3, 0x36e3,   0},
+	{0x2afb, 0x36fb,   0}, {0x2b12, 0x3712,   0}, {0x2b22, 0x3722,   0},
+	{0x2b32, 0x3732,   0}, {0x2b42, 0x3742,   0}, {0x2b53, 0x3753,   0},
+	{0x2b6b, 0x376b,   0}, {0x2b83, 0x3783,   0}, {0x2b9b, 0x379b,   0},
+	{0x2bb3, 0x37b3,   0}, {0x2bcb, 0x37cb,   0}, {0x2be3, 0x37e3,   0},
+	{0x2bfb, 0x37fb,   0}, {0x2c13, 0x3813,   0}, {0x2c2b, 0x382b,   0},
+	{0x2c42, 0x3842,   0}, {0x2c52, 0x3852,   0}, {0x2c62, 0x3862,   0},
+	{0x2c72, 0x3872,   0}, {0x2c82, 0x3882,   0}, {0x2c92, 0x3892,   0},
+	{0x2ca2, 0x38a2,   0}, {0x2cb2, 0x38b2,   0}, {0x0000, 0x38c1,   0},
+	{0x0000, 0x38c9,   0}, {0x0000, 0x38d1,   0}, {0x2cc2, 0x38da,   0},
+	{0x2cd2, 0x38ea,   0}, {0x2ce3, 0x38fb,   0}, {0x2cfb, 0x3913,   0},
+	{0x2d13, 0x392b,   0}, {0x2d2b, 0x3943,   0}, {0x2d43, 0x395b,   0},
+	{0x2d5b, 0x3973,   0}, {0x2d72, 0x398a,   0}, {0x2d82, 0x399a,   0},
+	{0x2d93, 0x39ab,   0}, {0x2dab, 0x39c3,   0}, {0x2dc3, 0x39db,   0},
+	{0x2ddb, 0x39f3,   0}, {0x2df3, 0x3a0b,   0}, {0x2e0b, 0x3a23,   0},
+	{0x2e22, 0x3a3a,   0}, {0x2e32, 0x3a4a,   0}, {0x2e43, 0x3a5b,   0},
+	{0x2e5b, 0x3a73,   0}, {0x2e73, 0x3a8b,   0}, {0x2e8b, 0x3aa3,   0},
+	{0x2ea2, 0x3aba,   0}, {0x2eb2, 0x3aca,   0}, {0x2ec3, 0x3adb,   0},
+	{0x2edb, 0x3af3,   0}, {0x2ef3, 0x3b0b,   0}, {0x2f0b, 0x3b23,   0},
+	{0x2f22, 0x3b3a,   0}, {0x2f32, 0x3b4a,   0}, {0x2f43, 0x3b5b,   0},
+	{0x2f5b, 0x3b73,   0}, {0x2f73, 0x3b8b,   0}, {0x2f8b, 0x3ba3,   0},
+	{0x2fa3, 0x3bbb,   0}, {0x2fbb, 0x3bd3,   0}, {0x2fd2, 0x3bea,   0},
+	{0x2fe2, 0x3bfa,   0}, {0x2ff3, 0x3c0b,   0}, {0x300b, 0x3c23,   0},
+	{0x3023, 0x3c3b,   0}, {0x303b, 0x3c53,   0}, {0x3053, 0x3c6b,   0},
+	{0x306b, 0x3c83,   0}, {0x3082, 0x3c9a,   0}, {0x3092, 0x3caa,   0},
+	{0x30a3, 0x3cbb,   0}, {0x30bb, 0x3cd3,   0}, {0x30d3, 0x3ceb,   0},
+	{0x30eb, 0x3d03,   0}, {0x3103, 0x3d1b,   0}, {0x311b, 0x3d33,   0},
+	{0x3132, 0x3d4a,   0}, {0x3142, 0x3d5a,   0}, {0x3153, 0x3d6b,   0},
+	{0x316b, 0x3d83,   0}, {0x3183, 0x3d9b,   0}, {0x319b, 0x3db3,   0},
+	{0x31b3, 0x3dcb,   0}, {0x31cb, 0x3de3,   0}, {0x31e2, 0x3dfa,   0},
+	{0x31f2, 0x3e0a,   0}, {0x3203, 0x3e1b,   0}, {0x321b, 0x3e33,   0},
+	{0x3233, 0x3e4b,   0}, {0x324b, 0x3e63,   0}, {0x3262, 0x3e7a,   0},
+	{0x3272, 0x3e8a,   0}, {0x3283, 0x3e9b,   0}, {0x329b, 0x3eb3,   0},
+	{0x32b3, 0x3ecb,   0}, {0x32cb, 0x3ee3,   0}, {0x32e2, 0x3efa,   0},
+	{0x32f2, 0x3f0a,   0}, {0x3303, 0x3f1b,   0}, {0x331b, 0x3f33,   0},
+	{0x3333, 0x3f4b,   0}, {0x334b, 0x3f63,   0}, {0x3363, 0x3f7b,   0},
+	{0x337b, 0x3f93,   0}, {0x3392, 0x3faa,   0}, {0x33a3, 0x3fbb,   0},
+	{0x33bb, 0x3fd3,   0}, {0x33d3, 0x3feb,   0}, {0x33ea, 0x4002,   0},
+	{0x33fa, 0x4012,   0}, {0x340b, 0x4023,   0}, {0x3423, 0x403b,   0},
+	{0x343b, 0x4053,   0}, {0x3453, 0x406b,   0}, {0x346b, 0x4083,   0},
+	{0x3483, 0x409b,   0}, {0x349a, 0x40b2,   0}, {0x34aa, 0x40c2,   0},
+	{0x34bb, 0x40d3,   0}, {0x34d3, 0x40eb,   0}, {0x34eb, 0x4103,   0},
+	{0x3503, 0x411b,   0}, {0x351b, 0x4133,   0}, {0x3533, 0x414b,   0},
+	{0x354a, 0x4162,   0}, {0x355a, 0x4172,   0}, {0x356a, 0x4182,   0},
+	{0x357a, 0x4192,   0}, {0x358a, 0x41a2,   0}, {0x359a, 0x41b2,   0},
+	{0x35aa, 0x41c2,   0}, {0x35ba, 0x41d2,   0}, {0x35ca, 0x41e2,   0},
+	{0x35da, 0x41f2,   0}, {0x35ea, 0x4202,   0}, {0x35fa, 0x4212,   0},
+	{0x360a, 0x4222,   0}, {0x361a, 0x4232,   0}, {0x362b, 0x4243,   0},
+	{0x3643, 0x425b,   0}, {0x365c, 0x4274,   0}, {0x367c, 0x4294,   0},
+	{0x369c, 0x42b4,   0}, {0x36bc, 0x42d4,   0}, {0x36dc, 0x42f4,   0},
+	{0x36fc, 0x4314,   0}, {0x371b, 0x4333,   0}, {0x3733, 0x434b,   0},
+	{0x374c, 0x4364,   0}, {0x376c, 0x4384,   0}, {0x378c, 0x43a4,   0},
+	{0x37ac, 0x43c4,   0}, {0x37cc, 0x43e4,   0}, {0x37ec, 0x4404,   0},
+	{0x380b, 0x4423,   0}, {0x3823, 0x443b,   0}, {0x383c, 0x4454,   0},
+	{0x385c, 0x4474,   0}, {0x387c, 0x4494,   0}, {0x389c, 0x44b4,   0},
+	{0x38bc, 0x44d4,   0}, {0x38dc, 0x44f4,   0}, {0x38fb, 0x4513,   0},
+	{0x3913, 0x452b,   0}, {0x392c, 0x4544,   0}, {0x394c, 0x4564,   0},
+	{0x396c, 0x4584,   0}, {0x398c, 0x45a4,   0}, {0x39ac, 0x45c4,   0},
+	{0x39cc, 0x45e4,   0}, {0x39eb, 0x4603,   0}, {0x3a03, 0x461b,   0},
+	{0x3a1c, 0x4634,   0}, {0x3a3c, 0x4654,   0}, {0x3a5c, 0x4674,   0},
+	{0x3a7c, 0x4694,   0}, {0x3a9c, 0x46b4,   0}, {0x3abc, 0x46d4,   0},
+	{0x3adb, 0x46f3,   0}, {0x3af3, 0x470b,   0}, {0x3b0c, 0x4724,   0},
+	{0x3b2c, 0x4744,   0}, {0x3b4c, 0x4764,   0}, {0x3b6c, 0x4784,   0},
+	{0x3b8c, 0x47a4,   0}, {0x3bac, 0x47c4,   0}, {0x3bca, 0x47e2,   0},
+	{0x3bda, 0x47f2,   0}, {0x3beb, 0x4803,   0}, {0x3c02, 0x481a,   0},
+	{0x3c13, 0x482b,   0}, {0x3c2a, 0x4842,   0}, {0x3c3b, 0x4853,   0},
+	{0x3c52, 0x486a,   0}, {0x3c62, 0x487a,   0}, {0x3c72, 0x488a,   0},
+	{0x3c82, 0x489a,   0}, {0x3c92, 0x48aa,   0}, {0x3ca1, 0x48b9,   0},
+	{0x3caa, 0x48c2,   0}, {0x3cbb, 0x48d3,   0}, {0x3cd2, 0x48ea,   0},
+	{0x3ce3, 0x48fb,   0}, {0x3cfa, 0x4912,   0}, {0x3d0b, 0x4923,   0},
+	{0x3d22, 0x493a,   0}, {0x3d32, 0x494a,   0}, {0x3d42, 0x495a,   0},
+	{0x3d52, 0x496a,   0}, {0x3d62, 0x497a,   0}, {0x3d72, 0x498a,   0},
+	{0x3d82, 0x499a,   0}, {0x3d92, 0x49aa,   0}, {0x3da2, 0x49ba,   0},
+	{0x3db2, 0x49ca,   0}, {0x3dc3, 0x49db,   0}, {0x3ddb, 0x49f3,   0},
+	{0x3df2, 0x4a0a,   0}, {0x3e03, 0x4a1b,   0}, {0x3e1a, 0x4a32,   0},
+	{0x3e2a, 0x4a42,   0}, {0x3e3a, 0x4a52,   0}, {0x3e4a, 0x4a62,   0},
+	{0x3e5a, 0x4a72,   0}, {0x3e6a, 0x4a82,   0}, {0x3e7a, 0x4a92,   0},
+	{0x3e8a, 0x4aa2,   0}, {0x3e9a, 0x4ab2,   0}, {0x3eab, 0x4ac3,   0},
+	{0x3ec3, 0x4adb,   0}, {0x3eda, 0x4af2,   0}, {0x3eea, 0x4b02,   0},
+	{0x3efa, 0x4b12,   0}, {0x3f0b, 0x4b23,   0}, {0x3f22, 0x4b3a,   0},
+	{0x3f32, 0x4b4a,   0}, {0x3f42, 0x4b5a,   0}, {0x3f52, 0x4b6a,   0},
+	{0x3f62, 0x4b7a,   0}, {0x3f72, 0x4b8a,   0}, {0x3f82, 0x4b9a,   0},
+	{0x3f91, 0x4ba9,   0}, {0x3f9b, 0x4bb3,   0}, {0x3fb2, 0x4bca,   0},
+	{0x3fc3, 0x4bdb,   0}, {0x3fda, 0x4bf2,   0}, {0x3feb, 0x4c03,   0},
+	{0x4002, 0x4c1a,   0}, {0x4012, 0x4c2a,   0}, {0x4022, 0x4c3a,   0},
+	{0x4032, 0x4c4a,   0}, {0x4042, 0x4c5a,   0}, {0x4051, 0x4c69,   0},
+	{0x4059, 0x4c71,   0}, {0x4061, 0x4c79,   0}, {0x4069, 0x4c81,   0},
+	{0x4071, 0x4c89,   0}, {0x407a, 0x4c92,   0}, {0x0000, 0x4ca1,   0},
+	{0x0000, 0x4ca9,   0}, {0x0000, 0x4cb1,   0}, {0x0000, 0x4cb9,   0},
+	{0x0000, 0x4cc1,   0}, {0x0000, 0x4cc9,   0}, {0x0000, 0x4cd1,   0},
+	{0x0000, 0x4cd9,   0}, {0x0000, 0x4ce1,   0}, {0x0000, 0x4ce9,   0},
+	{0x0000, 0x4cf1,   0}, {0x0000, 0x4cf9,   0}, {0x0000, 0x4d01,   0},
+	{0x0000, 0x4d09,   0}, {0x0000, 0x4d11,   0}, {0x0000, 0x4d19,   0},
+	{0x0000, 0x4d21,   0}, {0x0000, 0x4d29,   0}, {0x408a, 0x4d32,   0},
+	{0x409a, 0x4d42,   0}, {0x40aa, 0x4d52,   0}, {0x40ba, 0x4d62,   0},
+	{0x40ca, 0x4d72,   0}, {0x40da, 0x4d82,   0}, {0x40ea, 0x4d92,   0},
+	{0x40fa, 0x4da2,   0}, {0x410a, 0x4db2,   0}, {0x411a, 0x4dc2,   0},
+	{0x412a, 0x4dd2,   0}, {0x413a, 0x4de2,   0}, {0x414a, 0x4df2,   0},
+	{0x415a, 0x4e02,   0}, {0x416a, 0x4e12,   0}, {0x417a, 0x4e22,   0},
+	{0x418a, 0x4e32,   0}, {0x419a, 0x4e42,   0}, {0x41aa, 0x4e52,   0},
+	{0x41ba, 0x4e62,   0}, {0x41ca, 0x4e72,   0}, {0x41da, 0x4e82,   0},
+	{0x41ea, 0x4e92,   0}, {0x41fa, 0x4ea2,   0}, {0x420a, 0x4eb2,   0},
+	{0x421a, 0x4ec2,   0}, {0x422a, 0x4ed2,   0}, {0x423a, 0x4ee2,   0},
+	{0x424a, 0x4ef2,   0}, {0x425a, 0x4f02,   0}, {0x426a, 0x4f12,   0},
+	{0x427a, 0x4f22,   0}, {0x428a, 0x4f32,   0}, {0x429a, 0x4f42,   0},
+	{0x42aa, 0x4f52,   0}, {0x42ba, 0x4f62,   0}, {0x42ca, 0x4f72,   0},
+	{0x42da, 0x4f82,   0}, {0x42ea, 0x4f92,   0}, {0x42fa, 0x4fa2,   0},
+	{0x430a, 0x4fb2,   0}, {0x431a, 0x4fc2,   0}, {0x432a, 0x4fd2,   0},
+	{0x433a, 0x4fe2,   0}, {0x4349, 0x4ff1,   0}, {0x4351, 0x4ff9,   0},
+	{0x0000, 0x5001,   0}, {0x0000, 0x5009,   0}, {0x0000, 0x5011,   0},
+	{0x0000, 0x5019,   0}, {0x0000, 0x5021,   0}, {0x0000, 0x5029,   0},
+	{0x0000, 0x5031,   0}, {0x0000, 0x5039,   0}, {0x0000, 0x5041,   0},
+	{0x0000, 0x5049,   0}, {0x0000, 0x5051,   0}, {0x0000, 0x5059,   0},
+	{0x0000, 0x5061,   0}, {0x0000, 0x5069,   0}, {0x0000, 0x5071,   0},
+	{0x0000, 0x5079,   0}, {0x0000, 0x5081,   0}, {0x0000, 0x5089,   0},
+	{0x0000, 0x5091,   0}, {0x0000, 0x5099,   0}, {0x0000, 0x50a1,   0},
+	{0x0000, 0x50a9,   0}, {0x0000, 0x50b1,   0}, {0x0000, 0x50b9,   0},
+	{0x0000, 0x50c1,   0}, {0x0000, 0x50c9,   0}, {0x435a, 0x50d2,   0},
+	{0x0000, 0x50e1,   0}, {0x0000, 0x50e9,   0}, {0x0000, 0x50f1,   0},
+	{0x0000, 0x50f9,   0}, {0x0000, 0x5101,   0}, {0x0000, 0x5109,   0},
+	{0x0000, 0x5111,   0}, {0x0000, 0x5119,   0}, {0x0000, 0x5121,   0},
+	{0x0000, 0x5129,   0}, {0x0000, 0x5131,   0}, {0x0000, 0x5139,   0},
+	{0x0000, 0x5141,   0}, {0x0000, 0x5149,   0}, {0x0000, 0x5151,   0},
+	{0x0000, 0x5159,   0}, {0x0000, 0x5161,   0}, {0x0000, 0x5169,   0},
+	{0x0000, 0x5171,   0}, {0x0000, 0x5179,   0}, {0x0000, 0x5181,   0},
+	{0x0000, 0x5189,   0}, {0x0000, 0x5191,   0}, {0x0000, 0x5199,   0},
+	{0x0000, 0x51a1,   0}, {0x0000, 0x51a9,   0}, {0x0000, 0x51b1,   0},
+	{0x0000, 0x51b9,   0}, {0x0000, 0x51c1,   0}, {0x0000, 0x51c9,   0},
+	{0x0000, 0x51d1,   0}, {0x0000, 0x51d9,   0}, {0x0000, 0x51e1,   0},
+	{0x0000, 0x51e9,   0}, {0x0000, 0x51f1,   0}, {0x0000, 0x51f9,   0},
+	{0x0000, 0x5201,   0}, {0x0000, 0x5209,   0}, {0x0000, 0x5211,   0},
+	{0x0000, 0x5219,   0}, {0x0000, 0x5221,   0}, {0x0000, 0x5229,   0},
+	{0x0000, 0x5231,   0}, {0x0000, 0x5239,   0}, {0x0000, 0x5241,   0},
+	{0x0000, 0x5249,   0}, {0x0000, 0x5251,   0}, {0x0000, 0x5259,   0},
+	{0x0000, 0x5261,   0}, {0x0000, 0x5269,   0}, {0x0000, 0x5271,   0},
+	{0x0000, 0x5279,   0}, {0x0000, 0x5281,   0}, {0x0000, 0x5289,   0},
+	{0x0000, 0x5291,   0}, {0x0000, 0x5299,   0}, {0x0000, 0x52a1,   0},
+	{0x0000, 0x52a9,   0}, {0x0000, 0x52b1,   0}, {0x0000, 0x52b9,   0},
+	{0x0000, 0x52c1,   0}, {0x0000, 0x52c9,   0}, {0x0000, 0x52d1,   0},
+	{0x0000, 0x52d9,   0}, {0x0000, 0x52e1,   0}, {0x0000, 0x52e9,   0},
+	{0x0000, 0x52f1,   0}, {0x0000, 0x52f9,   0}, {0x0000, 0x5301,   0},
+	{0x0000, 0x5309,   0}, {0x0000, 0x5311,   0}, {0x0000, 0x5319,   0},
+	{0x0000, 0x5321,   0}, {0x0000, 0x5329,   0}, {0x0000, 0x5331,   0},
+	{0x0000, 0x5339,   0}, {0x0000, 0x5341,   0}, {0x0000, 0x5349,   0},
+	{0x0000, 0x5351,   0}, {0x0000, 0x5359,   0}, {0x0000, 0x5361,   0},
+	{0x0000, 0x5369,   0}, {0x0000, 0x5371,   0}, {0x0000, 0x5379,   0},
+	{0x0000, 0x5381,   0}, {0x0000, 0x5389,   0}, {0x0000, 0x5391,   0},
+	{0x0000, 0x5399,   0}, {0x0000, 0x53a1,   0}, {0x0000, 0x53a9,   0},
+	{0x0000, 0x53b1,   0}, {0x0000, 0x53b9,   0}, {0x0000, 0x53c1,   0},
+	{0x0000, 0x53c9,   0}, {0x0000, 0x53d1,   0}, {0x0000, 0x53d9,   0},
+	{0x0000, 0x53e1,   0}, {0x0000, 0x53e9,   0}, {0x0000, 0x53f1,   0},
+	{0x0000, 0x53f9,   0}, {0x0000, 0x5401,   0}, {0x0000, 0x5409,   0},
+	{0x0000, 0x5411,   0}, {0x0000, 0x5419,   0}, {0x0000, 0x5421,   0},
+	{0x0000, 0x5429,   0}, {0x0000, 0x5431,   0}, {0x0000, 0x5439,   0},
+	{0x0000, 0x5441,   0}, {0x0000, 0x5449,   0}, {0x0000, 0x5451,   0},
+	{0x0000, 0x5459,   0}, {0x0000, 0x5461,   0}, {0x0000, 0x5469,   0},
+	{0x0000, 0x5471,   0}, {0x0000, 0x0000, 218}, {0x0000, 0x0000, 224},
+	{0x436a, 0x547a,   0}, {0x437a, 0x548a,   0}, {0x438a, 0x549a,   0},
+	{0x439a, 0x54aa,   0}, {0x43aa, 0x54ba,   0}, {0x43ba, 0x54ca,   0},
+	{0x43ca, 0x54da,   0}, {0x43da, 0x54ea,   0}, {0x43ea, 0x54fa,   0},
+	{0x43fa, 0x550a,   0}, {0x440a, 0x551a,   0}, {0x441a, 0x552a,   0},
+	{0x442a, 0x553a,   0}, {0x443a, 0x554a,   0}, {0x444a, 0x555a,   0},
+	{0x445a, 0x556a,   0}, {0x446a, 0x557a,   0}, {0x447a, 0x558a,   0},
+	{0x448a, 0x559a,   0}, {0x449a, 0x55aa,   0}, {0x44aa, 0x55ba,   0},
+	{0x44ba, 0x55ca,   0}, {0x44ca, 0x55da,   0}, {0x44da, 0x55ea,   0},
+	{0x44ea, 0x55fa,   0}, {0x44fa, 0x560a,   0}, {0x0000, 0x0000,   8},
+	{0x450a, 0x561a,   0}, {0x451a, 0x562a,   0}, {0x452a, 0x563a,   0},
+	{0x453a, 0x564a,   0}, {0x454a, 0x565a,   0}, {0x455a, 0x566a,   0},
+	{0x456a, 0x567a,   0}, {0x457a, 0x568a,   0}, {0x458a, 0x569a,   0},
+	{0x459a, 0x56aa,   0}, {0x45aa, 0x56ba,   0}, {0x45ba, 0x56ca,   0},
+	{0x45ca, 0x56da,   0}, {0x45da, 0x56ea,   0}, {0x45ea, 0x56fa,   0},
+	{0x45fa, 0x570a,   0}, {0x460a, 0x571a,   0}, {0x461a, 0x572a,   0},
+	{0x462a, 0x573a,   0}, {0x463a, 0x574a,   0}, {0x464a, 0x575a,   0},
+	{0x465a, 0x576a,   0}, {0x466a, 0x577a,   0}, {0x467a, 0x578a,   0},
+	{0x468a, 0x579a,   0}, {0x469a, 0x57aa,   0}, {0x46aa, 0x57ba,   0},
+	{0x46ba, 0x57ca,   0}, {0x46ca, 0x57da,   0}, {0x46da, 0x57ea,   0},
+	{0x46ea, 0x57fa,   0}, {0x46fa, 0x580a,   0}, {0x0000, 0x5819,   0},
+	{0x0000, 0x5821,   0}, {0x0000, 0x5829,   0}, {0x0000, 0x5831,   0},
+	{0x0000, 0x5839,   0}, {0x0000, 0x5841,   0}, {0x0000, 0x5849,   0},
+	{0x0000, 0x5851,   0}, {0x0000, 0x5859,   0}, {0x0000, 0x5861,   0},
+	{0x0000, 0x5869,   0}, {0x0000, 0x5871,   0}, {0x0000, 0x5879,   0},
+	{0x0000, 0x5881,   0}, {0x0000, 0x5889,   0}, {0x0000, 0x5891,   0},
+	{0x0000, 0x5899,   0}, {0x0000, 0x58a1,   0}, {0x0000, 0x58a9,   0},
+	{0x0000, 0x58b1,   0}, {0x0000, 0x58b9,   0}, {0x0000, 0x58c1,   0},
+	{0x0000, 0x58c9,   0}, {0x0000, 0x58d1,   0}, {0x0000, 0x58d9,   0},
+	{0x0000, 0x58e1,   0}, {0x0000, 0x58e9,   0}, {0x0000, 0x58f1,   0},
+	{0x0000, 0x58f9,   0}, {0x0000, 0x5901,   0}, {0x0000, 0x5909,   0},
+	{0x0000, 0x5911,   0}, {0x0000, 0x5919,   0}, {0x0000, 0x5921,   0},
+	{0x0000, 0x5929,   0}, {0x0000, 0x5931,   0}, {0x0000, 0x5939,   0},
+	{0x0000, 0x5941,   0}, {0x0000, 0x5949,   0}, {0x0000, 0x5951,   0},
+	{0x0000, 0x5959,   0}, {0x0000, 0x5961,   0}, {0x0000, 0x5969,   0},
+	{0x0000, 0x5971,   0}, {0x0000, 0x5979,   0}, {0x0000, 0x5981,   0},
+	{0x0000, 0x5989,   0}, {0x0000, 0x5991,   0}, {0x0000, 0x5999,   0},
+	{0x0000, 0x59a1,   0}, {0x0000, 0x59a9,   0}, {0x0000, 0x59b1,   0},
+	{0x0000, 0x59b9,   0}, {0x0000, 0x59c1,   0}, {0x0000, 0x59c9,   0},
+	{0x0000, 0x59d1,   0}, {0x0000, 0x59d9,   0}, {0x0000, 0x59e1,   0},
+	{0x0000, 0x59e9,   0}, {0x0000, 0x59f1,   0}, {0x0000, 0x59f9,   0},
+	{0x0000, 0x5a01,   0}, {0x0000, 0x5a09,   0}, {0x0000, 0x5a11,   0},
+	{0x0000, 0x5a19,   0}, {0x0000, 0x5a21,   0}, {0x0000, 0x5a29,   0},
+	{0x0000, 0x5a31,   0}, {0x0000, 0x5a39,   0}, {0x0000, 0x5a41,   0},
+	{0x0000, 0x5a49,   0}, {0x0000, 0x5a51,   0}, {0x0000, 0x5a59,   0},
+	{0x0000, 0x5a61,   0}, {0x0000, 0x5a69,   0}, {0x0000, 0x5a71,   0},
+	{0x0000, 0x5a79,   0}, {0x0000, 0x5a81,   0}, {0x0000, 0x5a89,   0},
+	{0x0000, 0x5a91,   0}, {0x0000, 0x5a99,   0}, {0x0000, 0x5aa1,   0},
+	{0x0000, 0x5aa9,   0}, {0x0000, 0x5ab1,   0}, {0x0000, 0x5ab9,   0},
+	{0x0000, 0x5ac1,   0}, {0x0000, 0x5ac9,   0}, {0x0000, 0x5ad1,   0},
+	{0x0000, 0x5ad9,   0}, {0x0000, 0x5ae1,   0}, {0x0000, 0x5ae9,   0},
+	{0x0000, 0x5af1,   0}, {0x0000, 0x5af9,   0}, {0x0000, 0x5b01,   0},
+	{0x0000, 0x5b09,   0}, {0x0000, 0x5b11,   0}, {0x0000, 0x5b19,   0},
+	{0x0000, 0x5b21,   0}, {0x0000, 0x5b29,   0}, {0x0000, 0x5b31,   0},
+	{0x0000, 0x5b39,   0}, {0x0000, 0x5b41,   0}, {0x0000, 0x5b49,   0},
+	{0x0000, 0x5b51,   0}, {0x0000, 0x5b59,   0}, {0x0000, 0x5b61,   0},
+	{0x0000, 0x5b69,   0}, {0x0000, 0x5b71,   0}, {0x0000, 0x5b79,   0},
+	{0x0000, 0x5b81,   0}, {0x0000, 0x5b89,   0}, {0x0000, 0x5b91,   0},
+	{0x0000, 0x5b99,   0}, {0x0000, 0x5ba1,   0}, {0x0000, 0x5ba9,   0},
+	{0x0000, 0x5bb1,   0}, {0x0000, 0x5bb9,   0}, {0x0000, 0x5bc1,   0},
+	{0x0000, 0x5bc9,   0}, {0x0000, 0x5bd1,   0}, {0x0000, 0x5bd9,   0},
+	{0x0000, 0x5be1,   0}, {0x0000, 0x5be9,   0}, {0x0000, 0x5bf1,   0},
+	{0x0000, 0x5bf9,   0}, {0x0000, 0x5c01,   0}, {0x0000, 0x5c09,   0},
+	{0x0000, 0x5c11,   0}, {0x0000, 0x5c19,   0}, {0x0000, 0x5c21,   0},
+	{0x0000, 0x5c29,   0}, {0x0000, 0x5c31,   0}, {0x0000, 0x5c39,   0},
+	{0x0000, 0x5c41,   0}, {0x0000, 0x5c49,   0}, {0x0000, 0x5c51,   0},
+	{0x0000, 0x5c59,   0}, {0x0000, 0x5c61,   0}, {0x0000, 0x5c69,   0},
+	{0x0000, 0x5c71,   0}, {0x0000, 0x5c79,   0}, {0x0000, 0x5c81,   0},
+	{0x0000, 0x5c89,   0}, {0x0000, 0x5c91,   0}, {0x0000, 0x5c99,   0},
+	{0x0000, 0x5ca1,   0}, {0x0000, 0x5ca9,   0}, {0x0000, 0x5cb1,   0},
+	{0x0000, 0x5cb9,   0}, {0x0000, 0x5cc1,   0}, {0x0000, 0x5cc9,   0},
+	{0x0000, 0x5cd1,   0}, {0x0000, 0x5cd9,   0}, {0x0000, 0x5ce1,   0},
+	{0x0000, 0x5ce9,   0}, {0x0000, 0x5cf1,   0}, {0x0000, 0x5cf9,   0},
+	{0x0000, 0x5d01,   0}, {0x0000, 0x5d09,   0}, {0x0000, 0x5d11,   0},
+	{0x0000, 0x5d19,   0}, {0x0000, 0x5d21,   0}, {0x0000, 0x5d29,   0},
+	{0x0000, 0x5d31,   0}, {0x0000, 0x5d39,   0}, {0x0000, 0x5d41,   0},
+	{0x0000, 0x5d49,   0}, {0x0000, 0x5d51,   0}, {0x0000, 0x5d59,   0},
+	{0x0000, 0x5d61,   0}, {0x0000, 0x5d69,   0}, {0x0000, 0x5d71,   0},
+	{0x0000, 0x5d79,   0}, {0x0000, 0x5d81,   0}, {0x0000, 0x5d89,   0},
+	{0x0000, 0x5d91,   0}, {0x0000, 0x5d99,   0}, {0x0000, 0x5da1,   0},
+	{0x0000, 0x5da9,   0}, {0x0000, 0x5db1,   0}, {0x0000, 0x5db9,   0},
+	{0x0000, 0x5dc1,   0}, {0x0000, 0x5dc9,   0}, {0x0000, 0x5dd1,   0},
+	{0x0000, 0x5dd9,   0}, {0x0000, 0x5de1,   0}, {0x0000, 0x5de9,   0},
+	{0x0000, 0x5df1,   0}, {0x4709, 0x5df9,   0}, {0x4711, 0x5e01,   0},
+	{0x4719, 0x5e09,   0}, {0x4721, 0x5e11,   0}, {0x4729, 0x5e19,   0},
+	{0x4731, 0x5e21,   0}, {0x4739, 0x5e29,   0}, {0x4741, 0x5e31,   0},
+	{0x4749, 0x5e39,   0}, {0x4751, 0x5e41,   0}, {0x4759, 0x5e49,   0},
+	{0x4761, 0x5e51,   0}, {0x4769, 0x5e59,   0}, {0x4771, 0x5e61,   0},
+	{0x4779, 0x5e69,   0}, {0x4781, 0x5e71,   0}, {0x4789, 0x5e79,   0},
+	{0x4791, 0x5e81,   0}, {0x4799, 0x5e89,   0}, {0x47a1, 0x5e91,   0},
+	{0x47a9, 0x5e99,   0}, {0x47b1, 0x5ea1,   0}, {0x47b9, 0x5ea9,   0},
+	{0x47c1, 0x5eb1,   0}, {0x47c9, 0x5eb9,   0}, {0x47d1, 0x5ec1,   0},
+	{0x47d9, 0x5ec9,   0}, {0x47e1, 0x5ed1,   0}, {0x47e9, 0x5ed9,   0},
+	{0x47f1, 0x5ee1,   0}, {0x47f9, 0x5ee9,   0}, {0x4801, 0x5ef1,   0},
+	{0x4809, 0x5ef9,   0}, {0x4811, 0x5f01,   0}, {0x4819, 0x5f09,   0},
+	{0x4821, 0x5f11,   0}, {0x4829, 0x5f19,   0}, {0x4831, 0x5f21,   0},
+	{0x4839, 0x5f29,   0}, {0x4841, 0x5f31,   0}, {0x4849, 0x5f39,   0},
+	{0x4851, 0x5f41,   0}, {0x4859, 0x5f49,   0}, {0x4861, 0x5f51,   0},
+	{0x4869, 0x5f59,   0}, {0x4871, 0x5f61,   0}, {0x4879, 0x5f69,   0},
+	{0x4881, 0x5f71,   0}, {0x4889, 0x5f79,   0}, {0x4891, 0x5f81,   0},
+	{0x4899, 0x5f89,   0}, {0x48a1, 0x5f91,   0}, {0x48a9, 0x5f99,   0},
+	{0x48b1, 0x5fa1,   0}, {0x48b9, 0x5fa9,   0}, {0x48c1, 0x5fb1,   0},
+	{0x48c9, 0x5fb9,   0}, {0x48d1, 0x5fc1,   0}, {0x48d9, 0x5fc9,   0},
+	{0x48e1, 0x5fd1,   0}, {0x48e9, 0x5fd9,   0}, {0x48f1, 0x5fe1,   0},
+	{0x48f9, 0x5fe9,   0}, {0x4901, 0x5ff1,   0}, {0x4909, 0x5ff9,   0},
+	{0x4911, 0x6001,   0}, {0x4919, 0x6009,   0}, {0x4921, 0x6011,   0},
+	{0x4929, 0x6019,   0}, {0x4931, 0x6021,   0}, {0x4939, 0x6029,   0},
+	{0x4941, 0x6031,   0}, {0x4949, 0x6039,   0}, {0x4951, 0x6041,   0},
+	{0x4959, 0x6049,   0}, {0x4961, 0x6051,   0}, {0x4969, 0x6059,   0},
+	{0x4971, 0x6061,   0}, {0x4979, 0x6069,   0}, {0x4981, 0x6071,   0},
+	{0x4989, 0x6079,   0}, {0x4991, 0x6081,   0}, {0x4999, 0x6089,   0},
+	{0x49a1, 0x6091,   0}, {0x49a9, 0x6099,   0}, {0x49b1, 0x60a1,   0},
+	{0x49b9, 0x60a9,   0}, {0x49c1, 0x60b1,   0}, {0x49c9, 0x60b9,   0},
+	{0x49d1, 0x60c1,   0}, {0x49d9, 0x60c9,   0}, {0x49e1, 0x60d1,   0},
+	{0x49e9, 0x60d9,   0}, {0x49f1, 0x60e1,   0}, {0x49f9, 0x60e9,   0},
+	{0x4a01, 0x60f1,   0}, {0x4a09, 0x60f9,   0}, {0x4a11, 0x6101,   0},
+	{0x4a19, 0x6109,   0}, {0x4a21, 0x6111,   0}, {0x4a29, 0x6119,   0},
+	{0x4a31, 0x6121,   0}, {0x4a39, 0x6129,   0}, {0x4a41, 0x6131,   0},
+	{0x4a49, 0x6139,   0}, {0x4a51, 0x6141,   0}, {0x4a59, 0x6149,   0},
+	{0x4a61, 0x6151,   0}, {0x4a69, 0x6159,   0}, {0x4a71, 0x6161,   0},
+	{0x4a79, 0x6169,   0}, {0x4a81, 0x6171,   0}, {0x4a89, 0x6179,   0},
+	{0x4a91, 0x6181,   0}, {0x4a99, 0x6189,   0}, {0x4aa1, 0x6191,   0},
+	{0x4aa9, 0x6199,   0}, {0x4ab1, 0x61a1,   0}, {0x4ab9, 0x61a9,   0},
+	{0x4ac1, 0x61b1,   0}, {0x4ac9, 0x61b9,   0}, {0x4ad1, 0x61c1,   0},
+	{0x4ad9, 0x61c9,   0}, {0x4ae1, 0x61d1,   0}, {0x4ae9, 0x61d9,   0},
+	{0x4af1, 0x61e1,   0}, {0x4af9, 0x61e9,   0}, {0x4b01, 0x61f1,   0},
+	{0x4b09, 0x61f9,   0}, {0x4b11, 0x6201,   0}, {0x4b19, 0x6209,   0},
+	{0x4b21, 0x6211,   0}, {0x4b29, 0x6219,   0}, {0x4b31, 0x6221,   0},
+	{0x4b39, 0x6229,   0}, {0x4b41, 0x6231,   0}, {0x4b49, 0x6239,   0},
+	{0x4b51, 0x6241,   0}, {0x4b59, 0x6249,   0}, {0x4b61, 0x6251,   0},
+	{0x4b69, 0x6259,   0}, {0x4b71, 0x6261,   0}, {0x4b79, 0x6269,   0},
+	{0x4b81, 0x6271,   0}, {0x4b89, 0x6279,   0}, {0x4b91, 0x6281,   0},
+	{0x4b99, 0x6289,   0}, {0x4ba1, 0x6291,   0}, {0x4ba9, 0x6299,   0},
+	{0x4bb1, 0x62a1,   0}, {0x4bb9, 0x62a9,   0}, {0x4bc1, 0x62b1,   0},
+	{0x4bc9, 0x62b9,   0}, {0x4bd1, 0x62c1,   0}, {0x4bd9, 0x62c9,   0},
+	{0x4be1, 0x62d1,   0}, {0x4be9, 0x62d9,   0}, {0x4bf1, 0x62e1,   0},
+	{0x4bf9, 0x62e9,   0}, {0x4c01, 0x62f1,   0}, {0x4c09, 0x62f9,   0},
+	{0x4c11, 0x6301,   0}, {0x4c19, 0x6309,   0}, {0x4c21, 0x6311,   0},
+	{0x4c29, 0x6319,   0}, {0x4c31, 0x6321,   0}, {0x4c39, 0x6329,   0},
+	{0x4c41, 0x6331,   0}, {0x4c49, 0x6339,   0}, {0x4c51, 0x6341,   0},
+	{0x4c59, 0x6349,   0}, {0x4c61, 0x6351,   0}, {0x4c69, 0x6359,   0},
+	{0x4c71, 0x6361,   0}, {0x4c79, 0x6369,   0}, {0x4c81, 0x6371,   0},
+	{0x4c89, 0x6379,   0}, {0x4c91, 0x6381,   0}, {0x4c99, 0x6389,   0},
+	{0x4ca1, 0x6391,   0}, {0x4ca9, 0x6399,   0}, {0x4cb1, 0x63a1,   0},
+	{0x4cb9, 0x63a9,   0}, {0x4cc1, 0x63b1,   0}, {0x4cc9, 0x63b9,   0},
+	{0x4cd1, 0x63c1,   0}, {0x4cd9, 0x63c9,   0}, {0x4ce1, 0x63d1,   0},
+	{0x4ce9, 0x63d9,   0}, {0x4cf1, 0x63e1,   0}, {0x4cf9, 0x63e9,   0},
+	{0x4d01, 0x63f1,   0}, {0x4d09, 0x63f9,   0}, {0x4d11, 0x6401,   0},
+	{0x4d19, 0x6409,   0}, {0x4d21, 0x6411,   0}, {0x4d29, 0x6419,   0},
+	{0x4d31, 0x6421,   0}, {0x4d39, 0x6429,   0}, {0x4d41, 0x6431,   0},
+	{0x4d49, 0x6439,   0}, {0x4d51, 0x6441,   0}, {0x4d59, 0x6449,   0},
+	{0x4d61, 0x6451,   0}, {0x4d69, 0x6459,   0}, {0x4d71, 0x6461,   0},
+	{0x4d79, 0x6469,   0}, {0x4d81, 0x6471,   0}, {0x4d89, 0x6479,   0},
+	{0x4d91, 0x6481,   0}, {0x4d99, 0x6489,   0}, {0x4da1, 0x6491,   0},
+	{0x4da9, 0x6499,   0}, {0x4db1, 0x64a1,   0}, {0x4db9, 0x64a9,   0},
+	{0x4dc1, 0x64b1,   0}, {0x4dc9, 0x64b9,   0}, {0x4dd1, 0x64c1,   0},
+	{0x4dd9, 0x64c9,   0}, {0x4de1, 0x64d1,   0}, {0x4de9, 0x64d9,   0},
+	{0x4df1, 0x64e1,   0}, {0x4df9, 0x64e9,   0}, {0x4e01, 0x64f1,   0},
+	{0x4e09, 0x64f9,   0}, {0x4e11, 0x6501,   0}, {0x4e19, 0x6509,   0},
+	{0x4e21, 0x6511,   0}, {0x4e29, 0x6519,   0}, {0x4e31, 0x6521,   0},
+	{0x4e39, 0x6529,   0}, {0x4e41, 0x6531,   0}, {0x4e49, 0x6539,   0},
+	{0x4e51, 0x6541,   0}, {0x4e59, 0x6549,   0}, {0x4e61, 0x6551,   0},
+	{0x4e69, 0x6559,   0}, {0x4e71, 0x6561,   0}, {0x4e79, 0x6569,   0},
+	{0x4e81, 0x6571,   0}, {0x4e89, 0x6579,   0}, {0x4e91, 0x6581,   0},
+	{0x4e99, 0x6589,   0}, {0x4ea1, 0x6591,   0}, {0x4ea9, 0x6599,   0},
+	{0x4eb1, 0x65a1,   0}, {0x4eb9, 0x65a9,   0}, {0x4ec1, 0x65b1,   0},
+	{0x4ec9, 0x65b9,   0}, {0x4ed1, 0x65c1,   0}, {0x4ed9, 0x65c9,   0},
+	{0x4ee1, 0x65d1,   0}, {0x4ee9, 0x65d9,   0}, {0x4ef1, 0x65e1,   0},
+	{0x4ef9, 0x65e9,   0}, {0x4f01, 0x65f1,   0}, {0x4f09, 0x65f9,   0},
+	{0x4f11, 0x6601,   0}, {0x4f19, 0x6609,   0}, {0x4f21, 0x6611,   0},
+	{0x4f29, 0x6619,   0}, {0x4f31, 0x6621,   0}, {0x4f39, 0x6629,   0},
+	{0x4f41, 0x6631,   0}, {0x4f49, 0x6639,   0}, {0x4f51, 0x6641,   0},
+	{0x4f59, 0x6649,   0}, {0x4f61, 0x6651,   0}, {0x4f69, 0x6659,   0},
+	{0x4f71, 0x6661,   0}, {0x4f79, 0x6669,   0}, {0x4f81, 0x6671,   0},
+	{0x4f89, 0x6679,   0}, {0x4f91, 0x6681,   0}, {0x4f99, 0x6689,   0},
+	{0x4fa1, 0x6691,   0}, {0x4fa9, 0x6699,   0}, {0x4fb1, 0x66a1,   0},
+	{0x4fb9, 0x66a9,   0}, {0x4fc1, 0x66b1,   0}, {0x4fc9, 0x66b9,   0},
+	{0x4fd1, 0x66c1,   0}, {0x4fd9, 0x66c9,   0}, {0x4fe1, 0x66d1,   0},
+	{0x4fe9, 0x66d9,   0}, {0x4ff1, 0x66e1,   0}, {0x4ff9, 0x66e9,   0},
+	{0x5001, 0x66f1,   0}, {0x5009, 0x66f9,   0}, {0x5011, 0x6701,   0},
+	{0x5019, 0x6709,   0}, {0x5021, 0x6711,   0}, {0x5029, 0x6719,   0},
+	{0x5031, 0x6721,   0}, {0x5039, 0x6729,   0}, {0x5041, 0x6731,   0},
+	{0x5049, 0x6739,   0}, {0x5051, 0x6741,   0}, {0x5059, 0x6749,   0},
+	{0x5061, 0x6751,   0}, {0x5069, 0x6759,   0}, {0x5071, 0x6761,   0},
+	{0x5079, 0x6769,   0}, {0x5081, 0x6771,   0}, {0x5089, 0x6779,   0},
+	{0x5091, 0x6781,   0}, {0x5099, 0x6789,   0}, {0x50a1, 0x6791,   0},
+	{0x50a9, 0x6799,   0}, {0x50b1, 0x67a1,   0}, {0x50b9, 0x67a9,   0},
+	{0x50c1, 0x67b1,   0}, {0x50c9, 0x67b9,   0}, {0x50d1, 0x67c1,   0},
+	{0x50d9, 0x67c9,   0}, {0x50e1, 0x67d1,   0}, {0x50e9, 0x67d9,   0},
+	{0x50f1, 0x67e1,   0}, {0x50f9, 0x67e9,   0}, {0x5101, 0x67f1,   0},
+	{0x5109, 0x67f9,   0}, {0x5111, 0x6801,   0}, {0x5119, 0x6809,   0},
+	{0x5121, 0x6811,   0}, {0x5129, 0x6819,   0}, {0x5131, 0x6821,   0},
+	{0x5139, 0x6829,   0}, {0x5141, 0x6831,   0}, {0x5149, 0x6839,   0},
+	{0x5151, 0x6841,   0}, {0x5159, 0x6849,   0}, {0x5161, 0x6851,   0},
+	{0x5169, 0x6859,   0}, {0x5171, 0x6861,   0}, {0x5179, 0x6869,   0},
+	{0x5181, 0x6871,   0}, {0x5189, 0x6879,   0}, {0x5191, 0x6881,   0},
+	{0x5199, 0x6889,   0}, {0x51a1, 0x6891,   0}, {0x51a9, 0x6899,   0},
+	{0x51b1, 0x68a1,   0}, {0x51b9, 0x68a9,   0}, {0x51c1, 0x68b1,   0},
+	{0x51c9, 0x68b9,   0}, {0x51d1, 0x68c1,   0}, {0x51d9, 0x68c9,   0},
+	{0x51e1, 0x68d1,   0}, {0x51e9, 0x68d9,   0}, {0x51f1, 0x68e1,   0},
+	{0x51f9, 0x68e9,   0}, {0x5201, 0x68f1,   0}, {0x5209, 0x68f9,   0},
+	{0x5211, 0x6901,   0}, {0x5219, 0x6909,   0}, {0x5221, 0x6911,   0},
+	{0x5229, 0x6919,   0}, {0x5231, 0x6921,   0}, {0x5239, 0x6929,   0},
+	{0x5241, 0x6931,   0}, {0x5249, 0x6939,   0}, {0x5251, 0x6941,   0},
+	{0x5259, 0x6949,   0}, {0x5261, 0x6951,   0}, {0x5269, 0x6959,   0},
+	{0x5271, 0x6961,   0}, {0x5279, 0x6969,   0}, {0x5281, 0x6971,   0},
+	{0x5289, 0x6979,   0}, {0x5291, 0x6981,   0}, {0x5299, 0x6989,   0},
+	{0x52a1, 0x6991,   0}, {0x52a9, 0x6999,   0}, {0x52b1, 0x69a1,   0},
+	{0x52b9, 0x69a9,   0}, {0x52c1, 0x69b1,   0}, {0x52c9, 0x69b9,   0},
+	{0x52d1, 0x69c1,   0}, {0x52d9, 0x69c9,   0}, {0x52e1, 0x69d1,   0},
+	{0x52e9, 0x69d9,   0}, {0x52f1, 0x69e1,   0}, {0x52f9, 0x69e9,   0},
+	{0x5301, 0x69f1,   0}, {0x5309, 0x69f9,   0}, {0x5311, 0x6a01,   0},
+	{0x5319, 0x6a09,   0}, {0x5321, 0x6a11,   0}, {0x5329, 0x6a19,   0},
+	{0x5331, 0x6a21,   0}, {0x5339, 0x6a29,   0}, {0x5341, 0x6a31,   0},
+	{0x5349, 0x6a39,   0}, {0x5351, 0x6a41,   0}, {0x5359, 0x6a49,   0},
+	{0x5361, 0x6a51,   0}, {0x5369, 0x6a59,   0}, {0x5371, 0x6a61,   0},
+	{0x5379, 0x6a69,   0}, {0x5381, 0x6a71,   0}, {0x5389, 0x6a79,   0},
+	{0x5391, 0x6a81,   0}, {0x5399, 0x6a89,   0}, {0x53a1, 0x6a91,   0},
+	{0x53a9, 0x6a99,   0}, {0x53b1, 0x6aa1,   0}, {0x53b9, 0x6aa9,   0},
+	{0x53c1, 0x6ab1,   0}, {0x53c9, 0x6ab9,   0}, {0x53d1, 0x6ac1,   0},
+	{0x53d9, 0x6ac9,   0}, {0x53e1, 0x6ad1,   0}, {0x53e9, 0x6ad9,   0},
+	{0x53f1, 0x6ae1,   0}, {0x53f9, 0x6ae9,   0}, {0x5401, 0x6af1,   0},
+	{0x5409, 0x6af9,   0}, {0x5411, 0x6b01,   0}, {0x5419, 0x6b09,   0},
+	{0x5421, 0x6b11,   0}, {0x5429, 0x6b19,   0}, {0x5431, 0x6b21,   0},
+	{0x5439, 0x6b29,   0}, {0x5441, 0x6b31,   0}, {0x5449, 0x6b39,   0},
+	{0x5451, 0x6b41,   0}, {0x5459, 0x6b49,   0}, {0x5461, 0x6b51,   0},
+	{0x5469, 0x6b59,   0}, {0x5471, 0x6b61,   0}, {0x5479, 0x6b69,   0},
+	{0x5481, 0x6b71,   0}, {0x5489, 0x6b79,   0}, {0x5491, 0x6b81,   0},
+	{0x5499, 0x6b89,   0}, {0x54a1, 0x6b91,   0}, {0x54a9, 0x6b99,   0},
+	{0x54b1, 0x6ba1,   0}, {0x54b9, 0x6ba9,   0}, {0x54c1, 0x6bb1,   0},
+	{0x54c9, 0x6bb9,   0}, {0x54d1, 0x6bc1,   0}, {0x54d9, 0x6bc9,   0},
+	{0x54e1, 0x6bd1,   0}, {0x54e9, 0x6bd9,   0}, {0x54f1, 0x6be1,   0},
+	{0x54f9, 0x6be9,   0}, {0x5501, 0x6bf1,   0}, {0x5509, 0x6bf9,   0},
+	{0x5511, 0x6c01,   0}, {0x5519, 0x6c09,   0}, {0x5521, 0x6c11,   0},
+	{0x5529, 0x6c19,   0}, {0x5531, 0x6c21,   0}, {0x5539, 0x6c29,   0},
+	{0x5541, 0x6c31,   0}, {0x5549, 0x6c39,   0}, {0x5551, 0x6c41,   0},
+	{0x5559, 0x6c49,   0}, {0x5561, 0x6c51,   0}, {0x0000, 0x6c5a,   0},
+	{0x0000, 0x6c6a,   0}, {0x0000, 0x6c7a,   0}, {0x0000, 0x6c8b,   0},
+	{0x0000, 0x6ca3,   0}, {0x0000, 0x6cba,   0}, {0x0000, 0x6cca,   0},
+	{0x0000, 0x6cda,   0}, {0x0000, 0x6cea,   0}, {0x0000, 0x6cfa,   0},
+	{0x0000, 0x6d0a,   0}, {0x0000, 0x6d1a,   0}, {0x556a, 0x6d2a,   0},
+	{0x0000, 0x0000,  26}, {0x557a, 0x6d3a,   0}, {0x558a, 0x6d4a,   0},
+	{0x559a, 0x6d5a,   0}, {0x55ab, 0x6d6b,   0}, {0x55c3, 0x6d83,   0},
+	{0x55da, 0x6d9a,   0}, {0x55ea, 0x6daa,   0}, {0x55fa, 0x6dba,   0},
+	{0x560a, 0x6dca,   0}, {0x561a, 0x6dda,   0}, {0x562a, 0x6dea,   0},
+	{0x563a, 0x6dfa,   0}, {0x564a, 0x6e0a,   0}, {0x565a, 0x6e1a,   0},
+	{0x566a, 0x6e2a,   0}, {0x567a, 0x6e3a,   0}, {0x568a, 0x6e4a,   0},
+	{0x569a, 0x6e5a,   0}, {0x56aa, 0x6e6a,   0}, {0x56ba, 0x6e7a,   0},
+	{0x56ca, 0x6e8a,   0}, {0x56da, 0x6e9a,   0}, {0x56ea, 0x6eaa,   0},
+	{0x56fa, 0x6eba,   0}, {0x570a, 0x6eca,   0}, {0x571a, 0x6eda,   0},
+	{0x572a, 0x6eea,   0}, {0x573a, 0x6efa,   0}, {0x574a, 0x6f0a,   0},
+	{0x575a, 0x6f1a,   0}, {0x576a, 0x6f2a,   0}, {0x577a, 0x6f3a,   0},
+	{0x578a, 0x6f4a,   0}, {0x0000, 0x6f59,   0}, {0x0000, 0x6f61,   0},
+	{0x0000, 0x6f69,   0}, {0x0000, 0x6f71,   0}, {0x0000, 0x6f79,   0},
+	{0x0000, 0x6f81,   0}, {0x0000, 0x6f89,   0}, {0x0000, 0x6f91,   0},
+	{0x0000, 0x6f99,   0}, {0x0000, 0x6fa1,   0}, {0x0000, 0x6fa9,   0},
+	{0x0000, 0x6fb1,   0}, {0x0000, 0x6fb9,   0}, {0x0000, 0x6fc1,   0},
+	{0x0000, 0x6fc9,   0}, {0x0000, 0x6fd1,   0}, {0x0000, 0x6fd9,   0},
+	{0x0000, 0x6fe1,   0}, {0x0000, 0x6fe9,   0}, {0x0000, 0x6ff1,   0},
+	{0x0000, 0x6ff9,   0}, {0x0000, 0x7001,   0}, {0x0000, 0x7009,   0},
+	{0x0000, 0x7011,   0}, {0x0000, 0x7019,   0}, {0x0000, 0x7021,   0},
+	{0x0000, 0x7029,   0}, {0x0000, 0x7031,   0}, {0x0000, 0x7039,   0},
+	{0x0000, 0x7041,   0}, {0x0000, 0x7049,   0}, {0x0000, 0x7051,   0},
+	{0x0000, 0x7059,   0}, {0x0000, 0x7061,   0}, {0x0000, 0x7069,   0},
+	{0x0000, 0x7071,   0}, {0x0000, 0x7079,   0}, {0x0000, 0x7081,   0},
+	{0x0000, 0x7089,   0}, {0x0000, 0x7091,   0}, {0x0000, 0x7099,   0},
+	{0x0000, 0x70a1,   0}, {0x0000, 0x70a9,   0}, {0x0000, 0x70b1,   0},
+	{0x0000, 0x70b9,   0}, {0x0000, 0x70c1,   0}, {0x0000, 0x70c9,   0},
+	{0x0000, 0x70d1,   0}, {0x0000, 0x70d9,   0}, {0x0000, 0x70e1,   0},
+	{0x0000, 0x70e9,   0}, {0x0000, 0x70f1,   0}, {0x0000, 0x70f9,   0},
+	{0x0000, 0x7101,   0}, {0x0000, 0x7109,   0}, {0x0000, 0x7111,   0},
+	{0x0000, 0x7119,   0}, {0x0000, 0x7121,   0}, {0x0000, 0x7129,   0},
+	{0x0000, 0x7131,   0}, {0x0000, 0x7139,   0}, {0x0000, 0x7141,   0},
+	{0x0000, 0x7149,   0}, {0x0000, 0x7151,   0}, {0x0000, 0x7159,   0},
+	{0x0000, 0x7161,   0}, {0x0000, 0x7169,   0}, {0x0000, 0x7171,   0},
+	{0x0000, 0x7179,   0}, {0x0000, 0x7181,   0}, {0x0000, 0x7189,   0},
+	{0x0000, 0x7191,   0}, {0x0000, 0x7199,   0}, {0x0000, 0x71a1,   0},
+	{0x0000, 0x71a9,   0}, {0x0000, 0x71b1,   0}, {0x0000, 0x71b9,   0},
+	{0x0000, 0x71c1,   0}, {0x0000, 0x71c9,   0}, {0x0000, 0x71d1,   0},
+	{0x0000, 0x71d9,   0}, {0x0000, 0x71e1,   0}, {0x0000, 0x71e9,   0},
+	{0x0000, 0x71f1,   0}, {0x0000, 0x71f9,   0}, {0x0000, 0x7201,   0},
+	{0x0000, 0x7209,   0}, {0x0000, 0x7211,   0}, {0x0000, 0x7219,   0},
+	{0x0000, 0x7221,   0}, {0x0000, 0x7229,   0}, {0x0000, 0x7231,   0},
+	{0x0000, 0x7239,   0}, {0x0000, 0x7241,   0}, {0x0000, 0x7249,   0},
+	{0x0000, 0x7251,   0}, {0x0000, 0x7259,   0}, {0x0000, 0x7261,   0},
+	{0x0000, 0x7269,   0}, {0x0000, 0x7271,   0}, {0x0000, 0x7279,   0},
+	{0x0000, 0x7281,   0}, {0x0000, 0x7289,   0}, {0x0000, 0x7291,   0},
+	{0x0000, 0x7299,   0}, {0x0000, 0x72a1,   0}, {0x0000, 0x72a9,   0},
+	{0x0000, 0x72b1,   0}, {0x0000, 0x72b9,   0}, {0x0000, 0x72c1,   0},
+	{0x0000, 0x72c9,   0}, {0x0000, 0x72d1,   0}, {0x0000, 0x72d9,   0},
+	{0x0000, 0x72e1,   0}, {0x0000, 0x72e9,   0}, {0x0000, 0x72f1,   0},
+	{0x0000, 0x72f9,   0}, {0x0000, 0x7301,   0}, {0x0000, 0x7309,   0},
+	{0x0000, 0x7311,   0}, {0x0000, 0x7319,   0}, {0x0000, 0x7321,   0},
+	{0x0000, 0x7329,   0}, {0x0000, 0x7331,   0}, {0x0000, 0x7339,   0},
+	{0x0000, 0x7341,   0}, {0x0000, 0x7349,   0}, {0x0000, 0x7351,   0},
+	{0x0000, 0x7359,   0}, {0x0000, 0x7361,   0}, {0x0000, 0x7369,   0},
+	{0x0000, 0x7371,   0}, {0x0000, 0x7379,   0}, {0x0000, 0x7381,   0},
+	{0x0000, 0x7389,   0}, {0x0000, 0x7391,   0}, {0x0000, 0x7399,   0},
+	{0x0000, 0x73a1,   0}, {0x0000, 0x73a9,   0}, {0x0000, 0x73b1,   0},
+	{0x0000, 0x73b9,   0}, {0x0000, 0x73c1,   0}, {0x0000, 0x73c9,   0},
+	{0x0000, 0x73d1,   0}, {0x0000, 0x73d9,   0}, {0x0000, 0x73e1,   0},
+	{0x0000, 0x73e9,   0}, {0x0000, 0x73f1,   0}, {0x0000, 0x73f9,   0},
+	{0x0000, 0x7401,   0}, {0x0000, 0x7409,   0}, {0x0000, 0x7411,   0},
+	{0x0000, 0x7419,   0}, {0x579a, 0x7422,   0}, {0x57aa, 0x7432,   0},
+	{0x57ba, 0x7442,   0}, {0x57ca, 0x7452,   0}, {0x57da, 0x7462,   0},
+	{0x57ea, 0x7472,   0}, {0x57fa, 0x7482,   0}, {0x580a, 0x7492,   0},
+	{0x581a, 0x74a2,   0}, {0x582a, 0x74b2,   0}, {0x583a, 0x74c2,   0},
+	{0x584a, 0x74d2,   0}, {0x0000, 0x74e1,   0}, {0x0000, 0x74e9,   0},
+	{0x0000, 0x74f1,   0}, {0x0000, 0x74f9,   0}, {0x0000, 0x7501,   0},
+	{0x0000, 0x7509,   0}, {0x0000, 0x7511,   0}, {0x0000, 0x7519,   0},
+	{0x0000, 0x7521,   0}, {0x0000, 0x7529,   0}, {0x0000, 0x7531,   0},
+	{0x0000, 0x7539,   0}, {0x0000, 0x7541,   0}, {0x0000, 0x7549,   0},
+	{0x0000, 0x7551,   0}, {0x0000, 0x7559,   0}, {0x0000, 0x7561,   0},
+	{0x0000, 0x7569,   0}, {0x0000, 0x7571,   0}, {0x0000, 0x7579,   0},
+	{0x0000, 0x7581,   0}, {0x0000, 0x7589,   0}, {0x0000, 0x7591,   0},
+	{0x0000, 0x7599,   0}, {0x0000, 0x75a1,   0}, {0x0000, 0x75a9,   0},
+	{0x0000, 0x75b1,   0}, {0x0000, 0x75b9,   0}, {0x0000, 0x75c1,   0},
+	{0x0000, 0x75c9,   0}, {0x0000, 0x75d1,   0}, {0x0000, 0x75d9,   0},
+	{0x585a, 0x75e2,   0}, {0x586a, 0x75f2,   0}, {0x587b, 0x7603,   0},
+	{0x5893, 0x761b,   0}, {0x58ab, 0x7633,   0}, {0x58c3, 0x764b,   0},
+	{0x58db, 0x7663,   0}, {0x0000, 0x0000, 226}, {0x58f2, 0x767a,   0},
+	{0x5902, 0x768a,   0}, {0x5913, 0x769b,   0}, {0x592b, 0x76b3,   0},
+	{0x5943, 0x76cb,   0}, {0x595b, 0x76e3,   0}, {0x0000, 0x76f9,   0},
+	{0x0000, 0x7701,   0}, {0x0000, 0x7709,   0}, {0x0000, 0x7711,   0},
+	{0x0000, 0x7719,   0}, {0x0000, 0x7721,   0}, {0x0000, 0x7729,   0},
+	{0x0000, 0x7731,   0}, {0x0000, 0x7739,   0}, {0x0000, 0x7741,   0},
+	{0x0000, 0x7749,   0}, {0x0000, 0x7751,   0}, {0x0000, 0x7759,   0},
+	{0x0000, 0x7761,   0}, {0x0000, 0x7769,   0}, {0x0000, 0x7771,   0},
+	{0x0000, 0x7779,   0}, {0x0000, 0x7781,   0}, {0x0000, 0x7789,   0},
+	{0x0000, 0x7791,   0}, {0x0000, 0x7799,   0}, {0x0000, 0x77a1,   0},
+	{0x0000, 0x77a9,   0}, {0x0000, 0x77b1,   0}, {0x0000, 0x77b9,   0},
+	{0x0000, 0x77c1,   0}, {0x0000, 0x77c9,   0}, {0x0000, 0x77d1,   0},
+	{0x0000, 0x77d9,   0}, {0x0000, 0x77e1,   0}, {0x0000, 0x77e9,   0},
+	{0x0000, 0x77f1,   0}, {0x0000, 0x77f9,   0}, {0x0000, 0x7801,   0},
+	{0x5971, 0x7809,   0}, {0x5979, 0x7811,   0}, {0x5981, 0x7819,   0},
+	{0x5989, 0x7821,   0}, {0x5991, 0x7829,   0}, {0x5999, 0x7831,   0},
+	{0x59a1, 0x7839,   0}, {0x59a9, 0x7841,   0}, {0x59b1, 0x7849,   0},
+	{0x59b9, 0x7851,   0}, {0x59c1, 0x7859,   0}, {0x59c9, 0x7861,   0},
+	{0x59d1, 0x7869,   0}, {0x59d9, 0x7871,   0}, {0x59e1, 0x7879,   0},
+	{0x59e9, 0x7881,   0}, {0x59f1, 0x7889,   0}, {0x59f9, 0x7891,   0},
+	{0x5a01, 0x7899,   0}, {0x5a09, 0x78a1,   0}, {0x5a11, 0x78a9,   0},
+	{0x5a19, 0x78b1,   0}, {0x5a21, 0x78b9,   0}, {0x5a29, 0x78c1,   0},
+	{0x5a31, 0x78c9,   0}, {0x5a39, 0x78d1,   0}, {0x5a41, 0x78d9,   0},
+	{0x5a49, 0x78e1,   0}, {0x5a51, 0x78e9,   0}, {0x5a59, 0x78f1,   0},
+	{0x5a61, 0x78f9,   0}, {0x5a69, 0x7901,   0}, {0x5a71, 0x7909,   0},
+	{0x5a79, 0x7911,   0}, {0x5a81, 0x7919,   0}, {0x5a89, 0x7921,   0},
+	{0x5a91, 0x7929,   0}, {0x5a99, 0x7931,   0}, {0x5aa1, 0x7939,   0},
+	{0x5aa9, 0x7941,   0}, {0x5ab1, 0x7949,   0}, {0x5ab9, 0x7951,   0},
+	{0x5ac1, 0x7959,   0}, {0x5ac9, 0x7961,   0}, {0x5ad1, 0x7969,   0},
+	{0x5ad9, 0x7971,   0}, {0x5ae1, 0x7979,   0}, {0x5ae9, 0x7981,   0},
+	{0x5af1, 0x7989,   0}, {0x5af9, 0x7991,   0}, {0x5b01, 0x7999,   0},
+	{0x5b09, 0x79a1,   0}, {0x5b11, 0x79a9,   0}, {0x5b19, 0x79b1,   0},
+	{0x5b21, 0x79b9,   0}, {0x5b29, 0x79c1,   0}, {0x5b31, 0x79c9,   0},
+	{0x5b39, 0x79d1,   0}, {0x5b41, 0x79d9,   0}, {0x5b49, 0x79e1,   0},
+	{0x5b51, 0x79e9,   0}, {0x5b59, 0x79f1,   0}, {0x5b61, 0x79f9,   0},
+	{0x5b69, 0x7a01,   0}, {0x5b71, 0x7a09,   0}, {0x5b79, 0x7a11,   0},
+	{0x5b81, 0x7a19,   0}, {0x5b89, 0x7a21,   0}, {0x5b91, 0x7a29,   0},
+	{0x5b99, 0x7a31,   0}, {0x5ba1, 0x7a39,   0}, {0x5ba9, 0x7a41,   0},
+	{0x5bb1, 0x7a49,   0}, {0x5bb9, 0x7a51,   0}, {0x5bc1, 0x7a59,   0},
+	{0x5bc9, 0x7a61,   0}, {0x5bd1, 0x7a69,   0}, {0x5bd9, 0x7a71,   0},
+	{0x5be1, 0x7a79,   0}, {0x5be9, 0x7a81,   0}, {0x5bf1, 0x7a89,   0},
+	{0x5bf9, 0x7a91,   0}, {0x5c01, 0x7a99,   0}, {0x5c09, 0x7aa1,   0},
+	{0x5c11, 0x7aa9,   0}, {0x5c19, 0x7ab1,   0}, {0x5c21, 0x7ab9,   0},
+	{0x5c29, 0x7ac1,   0}, {0x5c31, 0x7ac9,   0}, {0x5c39, 0x7ad1,   0},
+	{0x5c41, 0x7ad9,   0}, {0x5c49, 0x7ae1,   0}, {0x5c51, 0x7ae9,   0},
+	{0x5c59, 0x7af1,   0}, {0x5c61, 0x7af9,   0}, {0x5c69, 0x7b01,   0},
+	{0x5c71, 0x7b09,   0}, {0x5c79, 0x7b11,   0}, {0x5c81, 0x7b19,   0},
+	{0x5c89, 0x7b21,   0}, {0x5c91, 0x7b29,   0}, {0x5c99, 0x7b31,   0},
+	{0x5ca1, 0x7b39,   0}, {0x5ca9, 0x7b41,   0}, {0x5cb1, 0x7b49,   0},
+	{0x5cb9, 0x7b51,   0}, {0x5cc1, 0x7b59,   0}, {0x5cc9, 0x7b61,   0},
+	{0x5cd1, 0x7b69,   0}, {0x5cd9, 0x7b71,   0}, {0x5ce1, 0x7b79,   0},
+	{0x5ce9, 0x7b81,   0}, {0x5cf1, 0x7b89,   0}, {0x5cf9, 0x7b91,   0},
+	{0x5d01, 0x7b99,   0}, {0x5d09, 0x7ba1,   0}, {0x5d11, 0x7ba9,   0},
+	{0x5d19, 0x7bb1,   0}, {0x5d21, 0x7bb9,   0}, {0x5d29, 0x7bc1,   0},
+	{0x5d31, 0x7bc9,   0}, {0x5d39, 0x7bd1,   0}, {0x5d41, 0x7bd9,   0},
+	{0x5d49, 0x7be1,   0}, {0x5d51, 0x7be9,   0}, {0x5d59, 0x7bf1,   0},
+	{0x5d61, 0x7bf9,   0}, {0x5d69, 0x7c01,   0}, {0x5d71, 0x7c09,   0},
+	{0x5d79, 0x7c11,   0}, {0x5d81, 0x7c19,   0}, {0x5d89, 0x7c21,   0},
+	{0x5d91, 0x7c29,   0}, {0x5d99, 0x7c31,   0}, {0x5da1, 0x7c39,   0},
+	{0x5da9, 0x7c41,   0}, {0x5db1, 0x7c49,   0}, {0x5db9, 0x7c51,   0},
+	{0x5dc1, 0x7c59,   0}, {0x5dc9, 0x7c61,   0}, {0x5dd1, 0x7c69,   0},
+	{0x5dd9, 0x7c71,   0}, {0x5de1, 0x7c79,   0}, {0x5de9, 0x7c81,   0},
+	{0x5df1, 0x7c89,   0}, {0x5df9, 0x7c91,   0}, {0x5e01, 0x7c99,   0},
+	{0x5e09, 0x7ca1,   0}, {0x5e11, 0x7ca9,   0}, {0x5e19, 0x7cb1,   0},
+	{0x5e21, 0x7cb9,   0}, {0x5e29, 0x7cc1,   0}, {0x5e31, 0x7cc9,   0},
+	{0x5e39, 0x7cd1,   0}, {0x5e41, 0x7cd9,   0}, {0x5e49, 0x7ce1,   0},
+	{0x5e51, 0x7ce9,   0}, {0x5e59, 0x7cf1,   0}, {0x5e61, 0x7cf9,   0},
+	{0x5e69, 0x7d01,   0}, {0x5e71, 0x7d09,   0}, {0x5e79, 0x7d11,   0},
+	{0x5e81, 0x7d19,   0}, {0x5e89, 0x7d21,   0}, {0x5e91, 0x7d29,   0},
+	{0x5e99, 0x7d31,   0}, {0x5ea1, 0x7d39,   0}, {0x5ea9, 0x7d41,   0},
+	{0x5eb1, 0x7d49,   0}, {0x5eb9, 0x7d51,   0}, {0x5ec1, 0x7d59,   0},
+	{0x5ec9, 0x7d61,   0}, {0x5ed1, 0x7d69,   0}, {0x5ed9, 0x7d71,   0},
+	{0x5ee1, 0x7d79,   0}, {0x5ee9, 0x7d81,   0}, {0x5ef1, 0x7d89,   0},
+	{0x5ef9, 0x7d91,   0}, {0x5f01, 0x7d99,   0}, {0x5f09, 0x7da1,   0},
+	{0x5f11, 0x7da9,   0}, {0x5f19, 0x7db1,   0}, {0x5f21, 0x7db9,   0},
+	{0x5f29, 0x7dc1,   0}, {0x5f31, 0x7dc9,   0}, {0x5f39, 0x7dd1,   0},
+	{0x5f41, 0x7dd9,   0}, {0x5f49, 0x7de1,   0}, {0x5f51, 0x7de9,   0},
+	{0x5f59, 0x7df1,   0}, {0x5f61, 0x7df9,   0}, {0x5f69, 0x7e01,   0},
+	{0x5f71, 0x7e09,   0}, {0x5f79, 0x7e11,   0}, {0x5f81, 0x7e19,   0},
+	{0x5f89, 0x7e21,   0}, {0x5f91, 0x7e29,   0}, {0x5f99, 0x7e31,   0},
+	{0x5fa1, 0x7e39,   0}, {0x5fa9, 0x7e41,   0}, {0x5fb1, 0x7e49,   0},
+	{0x5fb9, 0x7e51,   0}, {0x5fc1, 0x7e59,   0}, {0x5fc9, 0x7e61,   0},
+	{0x5fd1, 0x7e69,   0}, {0x5fd9, 0x7e71,   0}, {0x5fe1, 0x7e79,   0},
+	{0x5fe9, 0x7e81,   0}, {0x5ff1, 0x7e89,   0}, {0x5ff9, 0x7e91,   0},
+	{0x6001, 0x7e99,   0}, {0x6009, 0x7ea1,   0}, {0x6011, 0x7ea9,   0},
+	{0x6019, 0x7eb1,   0}, {0x6021, 0x7eb9,   0}, {0x6029, 0x7ec1,   0},
+	{0x6031, 0x7ec9,   0}, {0x6039, 0x7ed1,   0}, {0x6041, 0x7ed9,   0},
+	{0x6049, 0x7ee1,   0}, {0x6051, 0x7ee9,   0}, {0x6059, 0x7ef1,   0},
+	{0x6061, 0x7ef9,   0}, {0x6069, 0x7f01,   0}, {0x6071, 0x7f09,   0},
+	{0x6079, 0x7f11,   0}, {0x6081, 0x7f19,   0}, {0x6089, 0x7f21,   0},
+	{0x6091, 0x7f29,   0}, {0x6099, 0x7f31,   0}, {0x60a1, 0x7f39,   0},
+	{0x60a9, 0x7f41,   0}, {0x60b1, 0x7f49,   0}, {0x60b9, 0x7f51,   0},
+	{0x60c1, 0x7f59,   0}, {0x60c9, 0x7f61,   0}, {0x60d1, 0x7f69,   0},
+	{0x60d9, 0x7f71,   0}, {0x60e1, 0x7f79,   0}, {0x60e9, 0x7f81,   0},
+	{0x60f1, 0x7f89,   0}, {0x60f9, 0x7f91,   0}, {0x6101, 0x7f99,   0},
+	{0x6109, 0x7fa1,   0}, {0x6111, 0x7fa9,   0}, {0x6119, 0x7fb1,   0},
+	{0x6121, 0x7fb9,   0}, {0x6129, 0x7fc1,   0}, {0x6131, 0x7fc9,   0},
+	{0x6139, 0x7fd1,   0}, {0x6141, 0x7fd9,   0}, {0x6149, 0x7fe1,   0},
+	{0x6151, 0x7fe9,   0}, {0x6159, 0x7ff1,   0}, {0x6161, 0x7ff9,   0},
+	{0x6169, 0x8001,   0}, {0x6171, 0x8009,   0}, {0x6179, 0x8011,   0},
+	{0x6181, 0x8019,   0}, {0x6189, 0x8021,   0}, {0x6191, 0x8029,   0},
+	{0x6199, 0x8031,   0}, {0x61a1, 0x8039,   0}, {0x61a9, 0x8041,   0},
+	{0x61b1, 0x8049,   0}, {0x61b9, 0x8051,   0}, {0x61c1, 0x8059,   0},
+	{0x61c9, 0x8061,   0}, {0x61d1, 0x8069,   0}, {0x61d9, 0x8071,   0},
+	{0x61e1, 0x8079,   0}, {0x61e9, 0x8081,   0}, {0x61f1, 0x8089,   0},
+	{0x61f9, 0x8091,   0}, {0x6201, 0x8099,   0}, {0x6209, 0x80a1,   0},
+	{0x6211, 0x80a9,   0}, {0x6219, 0x80b1,   0}, {0x6221, 0x80b9,   0},
+	{0x6229, 0x80c1,   0}, {0x6231, 0x80c9,   0}, {0x6239, 0x80d1,   0},
+	{0x6241, 0x80d9,   0}, {0x6249, 0x80e1,   0}, {0x6251, 0x80e9,   0},
+	{0x6259, 0x80f1,   0}, {0x6261, 0x80f9,   0}, {0x6269, 0x8101,   0},
+	{0x6271, 0x8109,   0}, {0x6279, 0x8111,   0}, {0x6281, 0x8119,   0},
+	{0x6289, 0x8121,   0}, {0x6291, 0x8129,   0}, {0x6299, 0x8131,   0},
+	{0x62a1, 0x8139,   0}, {0x62a9, 0x8141,   0}, {0x62b1, 0x8149,   0},
+	{0x62b9, 0x8151,   0}, {0x62c1, 0x8159,   0}, {0x62c9, 0x8161,   0},
+	{0x62d1, 0x8169,   0}, {0x62d9, 0x8171,   0}, {0x62e1, 0x8179,   0},
+	{0x62e9, 0x8181,   0}, {0x62f1, 0x8189,   0}, {0x62f9, 0x8191,   0},
+	{0x6301, 0x8199,   0}, {0x6309, 0x81a1,   0}, {0x6311, 0x81a9,   0},
+	{0x6319, 0x81b1,   0}, {0x6321, 0x81b9,   0}, {0x6329, 0x81c1,   0},
+	{0x6331, 0x81c9,   0}, {0x6339, 0x81d1,   0}, {0x6341, 0x81d9,   0},
+	{0x6349, 0x81e1,   0}, {0x6351, 0x81e9,   0}, {0x6359, 0x81f1,   0},
+	{0x6361, 0x81f9,   0}, {0x6369, 0x8201,   0}, {0x6371, 0x8209,   0},
+	{0x6379, 0x8211,   0}, {0x6381, 0x8219,   0}, {0x6389, 0x8221,   0},
+	{0x6391, 0x8229,   0}, {0x6399, 0x8231,   0}, {0x63a1, 0x8239,   0},
+	{0x63a9, 0x8241,   0}, {0x63b1, 0x8249,   0}, {0x63b9, 0x8251,   0},
+	{0x63c1, 0x8259,   0}, {0x63c9, 0x8261,   0}, {0x63d1, 0x8269,   0},
+	{0x63d9, 0x8271,   0}, {0x63e1, 0x8279,   0}, {0x63e9, 0x8281,   0},
+	{0x63f1, 0x8289,   0}, {0x63f9, 0x8291,   0}, {0x6401, 0x8299,   0},
+	{0x6409, 0x82a1,   0}, {0x6411, 0x82a9,   0}, {0x6419, 0x82b1,   0},
+	{0x6421, 0x82b9,   0}, {0x6429, 0x82c1,   0}, {0x6431, 0x82c9,   0},
+	{0x6439, 0x82d1,   0}, {0x6441, 0x82d9,   0}, {0x6449, 0x82e1,   0},
+	{0x6451, 0x82e9,   0}, {0x6459, 0x82f1,   0}, {0x6461, 0x82f9,   0},
+	{0x6469, 0x8301,   0}, {0x6471, 0x8309,   0}, {0x6479, 0x8311,   0},
+	{0x6481, 0x8319,   0}, {0x6489, 0x8321,   0}, {0x6491, 0x8329,   0},
+	{0x6499, 0x8331,   0}, {0x64a1, 0x8339,   0}, {0x64a9, 0x8341,   0},
+	{0x64b1, 0x8349,   0}, {0x64b9, 0x8351,   0}, {0x64c1, 0x8359,   0},
+	{0x64c9, 0x8361,   0}, {0x64d1, 0x8369,   0}, {0x64d9, 0x8371,   0},
+	{0x64e1, 0x8379,   0}, {0x64e9, 0x8381,   0}, {0x64f1, 0x8389,   0},
+	{0x64f9, 0x8391,   0}, {0x6501, 0x8399,   0}, {0x6509, 0x83a1,   0},
+	{0x6511, 0x83a9,   0}, {0x6519, 0x83b1,   0}, {0x6521, 0x83b9,   0},
+	{0x6529, 0x83c1,   0}, {0x6531, 0x83c9,   0}, {0x6539, 0x83d1,   0},
+	{0x6541, 0x83d9,   0}, {0x6549, 0x83e1,   0}, {0x6551, 0x83e9,   0},
+	{0x6559, 0x83f1,   0}, {0x6561, 0x83f9,   0}, {0x6569, 0x8401,   0},
+	{0x6571, 0x8409,   0}, {0x6579, 0x8411,   0}, {0x6581, 0x8419,   0},
+	{0x6589, 0x8421,   0}, {0x6591, 0x8429,   0}, {0x6599, 0x8431,   0},
+	{0x65a1, 0x8439,   0}, {0x65a9, 0x8441,   0}, {0x65b1, 0x8449,   0},
+	{0x65b9, 0x8451,   0}, {0x65c1, 0x8459,   0}, {0x65c9, 0x8461,   0},
+	{0x65d1, 0x8469,   0}, {0x65d9, 0x8471,   0}, {0x65e1, 0x8479,   0},
+	{0x65e9, 0x8481,   0}, {0x65f1, 0x8489,   0}, {0x65f9, 0x8491,   0},
+	{0x6601, 0x8499,   0}, {0x6609, 0x84a1,   0}, {0x6611, 0x84a9,   0},
+	{0x6619, 0x84b1,   0}, {0x6621, 0x84b9,   0}, {0x6629, 0x84c1,   0},
+	{0x6631, 0x84c9,   0}, {0x6639, 0x84d1,   0}, {0x6641, 0x84d9,   0},
+	{0x6649, 0x84e1,   0}, {0x6651, 0x84e9,   0}, {0x6659, 0x84f1,   0},
+	{0x6661, 0x84f9,   0}, {0x6669, 0x8501,   0}, {0x6671, 0x8509,   0},
+	{0x6679, 0x8511,   0}, {0x6681, 0x8519,   0}, {0x6689, 0x8521,   0},
+	{0x6691, 0x8529,   0}, {0x6699, 0x8531,   0}, {0x66a1, 0x8539,   0},
+	{0x66a9, 0x8541,   0}, {0x66b1, 0x8549,   0}, {0x66b9, 0x8551,   0},
+	{0x66c1, 0x8559,   0}, {0x66c9, 0x8561,   0}, {0x66d1, 0x8569,   0},
+	{0x66d9, 0x8571,   0}, {0x66e1, 0x8579,   0}, {0x66e9, 0x8581,   0},
+	{0x66f1, 0x8589,   0}, {0x66f9, 0x8591,   0}, {0x6701, 0x8599,   0},
+	{0x6709, 0x85a1,   0}, {0x6711, 0x85a9,   0}, {0x6719, 0x85b1,   0},
+	{0x6721, 0x85b9,   0}, {0x6729, 0x85c1,   0}, {0x6731, 0x85c9,   0},
+	{0x6739, 0x85d1,   0}, {0x6741, 0x85d9,   0}, {0x6749, 0x85e1,   0},
+	{0x6751, 0x85e9,   0}, {0x6759, 0x85f1,   0}, {0x6761, 0x85f9,   0},
+	{0x6769, 0x8601,   0}, {0x6771, 0x8609,   0}, {0x6779, 0x8611,   0},
+	{0x6781, 0x8619,   0}, {0x6789, 0x8621,   0}, {0x6791, 0x8629,   0},
+	{0x6799, 0x8631,   0}, {0x67a1, 0x8639,   0}, {0x67a9, 0x8641,   0},
+	{0x67b1, 0x8649,   0}, {0x67b9, 0x8651,   0}, {0x67c1, 0x8659,   0},
+	{0x67c9, 0x8661,   0}, {0x67d1, 0x8669,   0}, {0x67d9, 0x8671,   0},
+	{0x67e1, 0x8679,   0}, {0x67e9, 0x8681,   0}, {0x67f1, 0x8689,   0},
+	{0x67f9, 0x8691,   0}, {0x6801, 0x8699,   0}, {0x6809, 0x86a1,   0},
+	{0x6811, 0x86a9,   0}, {0x6819, 0x86b1,   0}, {0x6821, 0x86b9,   0},
+	{0x6829, 0x86c1,   0}, {0x6831, 0x86c9,   0}, {0x6839, 0x86d1,   0},
+	{0x6841, 0x86d9,   0}, {0x6849, 0x86e1,   0}, {0x6851, 0x86e9,   0},
+	{0x6859, 0x86f1,   0}, {0x6861, 0x86f9,   0}, {0x6869, 0x8701,   0},
+	{0x6871, 0x8709,   0}, {0x6879, 0x8711,   0}, {0x6881, 0x8719,   0},
+	{0x6889, 0x8721,   0}, {0x6891, 0x8729,   0}, {0x6899, 0x8731,   0},
+	{0x68a1, 0x8739,   0}, {0x68a9, 0x8741,   0}, {0x68b1, 0x8749,   0},
+	{0x68b9, 0x8751,   0}, {0x68c1, 0x8759,   0}, {0x68c9, 0x8761,   0},
+	{0x68d1, 0x8769,   0}, {0x68d9, 0x8771,   0}, {0x68e1, 0x8779,   0},
+	{0x68e9, 0x8781,   0}, {0x68f1, 0x8789,   0}, {0x68f9, 0x8791,   0},
+	{0x6901, 0x8799,   0}, {0x6909, 0x87a1,   0}, {0x6911, 0x87a9,   0},
+	{0x6919, 0x87b1,   0}, {0x6921, 0x87b9,   0}, {0x6929, 0x87c1,   0},
+	{0x6931, 0x87c9,   0}, {0x6939, 0x87d1,   0}, {0x6941, 0x87d9,   0},
+	{0x6949, 0x87e1,   0}, {0x6951, 0x87e9,   0}, {0x6959, 0x87f1,   0},
+	{0x6961, 0x87f9,   0}, {0x6969, 0x8801,   0}, {0x6971, 0x8809,   0},
+	{0x6979, 0x8811,   0}, {0x6981, 0x8819,   0}, {0x6989, 0x8821,   0},
+	{0x6991, 0x8829,   0}, {0x6999, 0x8831,   0}, {0x69a1, 0x8839,   0},
+	{0x69a9, 0x8841,   0}, {0x69b1, 0x8849,   0}, {0x69b9, 0x8851,   0},
+	{0x69c1, 0x8859,   0}, {0x69c9, 0x8861,   0}, {0x69d1, 0x8869,   0},
+	{0x69d9, 0x8871,   0}, {0x69e1, 0x8879,   0}, {0x69e9, 0x8881,   0},
+	{0x69f1, 0x8889,   0}, {0x69f9, 0x8891,   0}, {0x6a01, 0x8899,   0},
+	{0x6a09, 0x88a1,   0}, {0x6a11, 0x88a9,   0}, {0x6a19, 0x88b1,   0},
+	{0x6a21, 0x88b9,   0}, {0x6a29, 0x88c1,   0}, {0x6a31, 0x88c9,   0},
+	{0x6a39, 0x88d1,   0}, {0x6a41, 0x88d9,   0}, {0x6a49, 0x88e1,   0},
+	{0x6a51, 0x88e9,   0}, {0x6a59, 0x88f1,   0},
+};
+
+static const struct apfs_unidata apfs_unidata_2byte[] __aligned(64) = {
+	/* Characters from 0x0080 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x00b0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x00d1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0002, 0x00da,   0}, {0x0012, 0x00ea,   0},
+	{0x0022, 0x00fa,   0}, {0x0032, 0x010a,   0}, {0x0042, 0x011a,   0},
+	{0x0052, 0x012a,   0}, {0x0000, 0x0139,   0}, {0x0062, 0x0142,   0},
+	{0x0072, 0x0152,   0}, {0x0082, 0x0162,   0}, {0x0092, 0x0172,   0},
+	{0x00a2, 0x0182,   0}, {0x00b2, 0x0192,   0}, {0x00c2, 0x01a2,   0},
+	{0x00d2, 0x01b2,   0}, {0x00e2, 0x01c2,   0}, {0x0000, 0x01d1,   0},
+	{0x00f2, 0x01da,   0}, {0x0102, 0x01ea,   0}, {0x0112, 0x01fa,   0},
+	{0x0122, 0x020a,   0}, {0x0132, 0x021a,   0}, {0x0142, 0x022a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0239,   0}, {0x0152, 0x0242,   0},
+	{0x0162, 0x0252,   0}, {0x0172, 0x0262,   0}, {0x0182, 0x0272,   0},
+	{0x0192, 0x0282,   0}, {0x0000, 0x0291,   0}, {0x0000, 0x029a,   0},
+	/* Characters from 0x00e0 */
+	{0x01a2, 0x02aa,   0}, {0x01b2, 0x02ba,   0}, {0x01c2, 0x02ca,   0},
+	{0x01d2, 0x02da,   0}, {0x01e2, 0x02ea,   0}, {0x01f2, 0x02fa,   0},
+	{0x0000, 0x0000,   0}, {0x0202, 0x030a,   0}, {0x0212, 0x031a,   0},
+	{0x0222, 0x032a,   0}, {0x0232, 0x033a,   0}, {0x0242, 0x034a,   0},
+	{0x0252, 0x035a,   0}, {0x0262, 0x036a,   0}, {0x0272, 0x037a,   0},
+	{0x0282, 0x038a,   0}, {0x0000, 0x0000,   0}, {0x0292, 0x039a,   0},
+	{0x02a2, 0x03aa,   0}, {0x02b2, 0x03ba,   0}, {0x02c2, 0x03ca,   0},
+	{0x02d2, 0x03da,   0}, {0x02e2, 0x03ea,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x02f2, 0x03fa,   0}, {0x0302, 0x040a,   0},
+	{0x0312, 0x041a,   0}, {0x0322, 0x042a,   0}, {0x0332, 0x043a,   0},
+	{0x0000, 0x0000,   0}, {0x0342, 0x044a,   0}, {0x0352, 0x045a,   0},
+	{0x0362, 0x046a,   0}, {0x0372, 0x047a,   0}, {0x0382, 0x048a,   0},
+	{0x0392, 0x049a,   0}, {0x03a2, 0x04aa,   0}, {0x03b2, 0x04ba,   0},
+	{0x03c2, 0x04ca,   0}, {0x03d2, 0x04da,   0}, {0x03e2, 0x04ea,   0},
+	{0x03f2, 0x04fa,   0}, {0x0402, 0x050a,   0}, {0x0412, 0x051a,   0},
+	{0x0422, 0x052a,   0}, {0x0432, 0x053a,   0}, {0x0442, 0x054a,   0},
+	/* Characters from 0x0110 */
+	{0x0000, 0x0559,   0}, {0x0000, 0x0000,   0}, {0x0452, 0x0562,   0},
+	{0x0462, 0x0572,   0}, {0x0472, 0x0582,   0}, {0x0482, 0x0592,   0},
+	{0x0492, 0x05a2,   0}, {0x04a2, 0x05b2,   0}, {0x04b2, 0x05c2,   0},
+	{0x04c2, 0x05d2,   0}, {0x04d2, 0x05e2,   0}, {0x04e2, 0x05f2,   0},
+	{0x04f2, 0x0602,   0}, {0x0502, 0x0612,   0}, {0x0512, 0x0622,   0},
+	{0x0522, 0x0632,   0}, {0x0532, 0x0642,   0}, {0x0542, 0x0652,   0},
+	{0x0552, 0x0662,   0}, {0x0562, 0x0672,   0}, {0x0572, 0x0682,   0},
+	{0x0582, 0x0692,   0}, {0x0000, 0x06a1,   0}, {0x0000, 0x0000,   0},
+	{0x0592, 0x06aa,   0}, {0x05a2, 0x06ba,   0}, {0x05b2, 0x06ca,   0},
+	{0x05c2, 0x06da,   0}, {0x05d2, 0x06ea,   0}, {0x05e2, 0x06fa,   0},
+	{0x05f2, 0x070a,   0}, {0x0602, 0x071a,   0}, {0x0612, 0x072a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0739,   0}, {0x0000, 0x0000,   0},
+	{0x0622, 0x0742,   0}, {0x0632, 0x0752,   0}, {0x0642, 0x0762,   0},
+	{0x0652, 0x0772,   0}, {0x0000, 0x0000,   0}, {0x0662, 0x0782,   0},
+	{0x0672, 0x0792,   0}, {0x0682, 0x07a2,   0}, {0x0692, 0x07b2,   0},
+	{0x06a2, 0x07c2,   0}, {0x06b2, 0x07d2,   0}, {0x0000, 0x07e1,   0},
+	/* Characters from 0x0140 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x07e9,   0}, {0x0000, 0x0000,   0},
+	{0x06c2, 0x07f2,   0}, {0x06d2, 0x0802,   0}, {0x06e2, 0x0812,   0},
+	{0x06f2, 0x0822,   0}, {0x0702, 0x0832,   0}, {0x0712, 0x0842,   0},
+	{0x0000, 0x0852,   0}, {0x0000, 0x0861,   0}, {0x0000, 0x0000,   0},
+	{0x0722, 0x086a,   0}, {0x0732, 0x087a,   0}, {0x0742, 0x088a,   0},
+	{0x0752, 0x089a,   0}, {0x0762, 0x08aa,   0}, {0x0772, 0x08ba,   0},
+	{0x0000, 0x08c9,   0}, {0x0000, 0x0000,   0}, {0x0782, 0x08d2,   0},
+	{0x0792, 0x08e2,   0}, {0x07a2, 0x08f2,   0}, {0x07b2, 0x0902,   0},
+	{0x07c2, 0x0912,   0}, {0x07d2, 0x0922,   0}, {0x07e2, 0x0932,   0},
+	{0x07f2, 0x0942,   0}, {0x0802, 0x0952,   0}, {0x0812, 0x0962,   0},
+	{0x0822, 0x0972,   0}, {0x0832, 0x0982,   0}, {0x0842, 0x0992,   0},
+	{0x0852, 0x09a2,   0}, {0x0862, 0x09b2,   0}, {0x0872, 0x09c2,   0},
+	{0x0882, 0x09d2,   0}, {0x0892, 0x09e2,   0}, {0x0000, 0x09f1,   0},
+	{0x0000, 0x0000,   0}, {0x08a2, 0x09fa,   0}, {0x08b2, 0x0a0a,   0},
+	{0x08c2, 0x0a1a,   0}, {0x08d2, 0x0a2a,   0}, {0x08e2, 0x0a3a,   0},
+	{0x08f2, 0x0a4a,   0}, {0x0902, 0x0a5a,   0}, {0x0912, 0x0a6a,   0},
+	/* Characters from 0x0170 */
+	{0x0922, 0x0a7a,   0}, {0x0932, 0x0a8a,   0}, {0x0942, 0x0a9a,   0},
+	{0x0952, 0x0aaa,   0}, {0x0962, 0x0aba,   0}, {0x0972, 0x0aca,   0},
+	{0x0982, 0x0ada,   0}, {0x0992, 0x0aea,   0}, {0x09a2, 0x0afa,   0},
+	{0x09b2, 0x0b0a,   0}, {0x09c2, 0x0b1a,   0}, {0x09d2, 0x0b2a,   0},
+	{0x09e2, 0x0b3a,   0}, {0x09f2, 0x0b4a,   0}, {0x0a02, 0x0b5a,   0},
+	{0x0000, 0x0b69,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0b71,   0},
+	{0x0000, 0x0b79,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0b81,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0b89,   0}, {0x0000, 0x0b91,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0b99,   0}, {0x0000, 0x0ba1,   0},
+	{0x0000, 0x0ba9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0bb1,   0}, {0x0000, 0x0bb9,   0}, {0x0000, 0x0bc1,   0},
+	{0x0000, 0x0bc9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0bd1,   0},
+	{0x0000, 0x0bd9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0be1,   0},
+	{0x0000, 0x0be9,   0}, {0x0000, 0x0bf1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0bf9,   0},
+	{0x0000, 0x0c01,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0c09,   0},
+	/* Characters from 0x01a0 */
+	{0x0a12, 0x0c12,   0}, {0x0a22, 0x0c22,   0}, {0x0000, 0x0c31,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0c39,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0c41,   0}, {0x0000, 0x0c49,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0c51,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0c59,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0c61,   0},
+	{0x0a32, 0x0c6a,   0}, {0x0a42, 0x0c7a,   0}, {0x0000, 0x0c89,   0},
+	{0x0000, 0x0c91,   0}, {0x0000, 0x0c99,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0ca1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0ca9,   0},
+	{0x0000, 0x0cb1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0cb9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0cc1,   0}, {0x0000, 0x0cc9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0cd1,   0}, {0x0000, 0x0cd9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0ce1,   0}, {0x0000, 0x0ce9,   0}, {0x0000, 0x0000,   0},
+	{0x0a52, 0x0cf2,   0}, {0x0a62, 0x0d02,   0}, {0x0a72, 0x0d12,   0},
+	/* Characters from 0x01d0 */
+	{0x0a82, 0x0d22,   0}, {0x0a92, 0x0d32,   0}, {0x0aa2, 0x0d42,   0},
+	{0x0ab2, 0x0d52,   0}, {0x0ac2, 0x0d62,   0}, {0x0ad3, 0x0d73,   0},
+	{0x0aeb, 0x0d8b,   0}, {0x0b03, 0x0da3,   0}, {0x0b1b, 0x0dbb,   0},
+	{0x0b33, 0x0dd3,   0}, {0x0b4b, 0x0deb,   0}, {0x0b63, 0x0e03,   0},
+	{0x0b7b, 0x0e1b,   0}, {0x0000, 0x0000,   0}, {0x0b93, 0x0e33,   0},
+	{0x0bab, 0x0e4b,   0}, {0x0bc3, 0x0e63,   0}, {0x0bdb, 0x0e7b,   0},
+	{0x0bf2, 0x0e92,   0}, {0x0c02, 0x0ea2,   0}, {0x0000, 0x0eb1,   0},
+	{0x0000, 0x0000,   0}, {0x0c12, 0x0eba,   0}, {0x0c22, 0x0eca,   0},
+	{0x0c32, 0x0eda,   0}, {0x0c42, 0x0eea,   0}, {0x0c52, 0x0efa,   0},
+	{0x0c62, 0x0f0a,   0}, {0x0c73, 0x0f1b,   0}, {0x0c8b, 0x0f33,   0},
+	{0x0ca2, 0x0f4a,   0}, {0x0cb2, 0x0f5a,   0}, {0x0cc2, 0x0f6a,   0},
+	{0x0000, 0x0f79,   0}, {0x0000, 0x0f81,   0}, {0x0000, 0x0000,   0},
+	{0x0cd2, 0x0f8a,   0}, {0x0ce2, 0x0f9a,   0}, {0x0000, 0x0fa9,   0},
+	{0x0000, 0x0fb1,   0}, {0x0cf2, 0x0fba,   0}, {0x0d02, 0x0fca,   0},
+	{0x0d13, 0x0fdb,   0}, {0x0d2b, 0x0ff3,   0}, {0x0d42, 0x100a,   0},
+	{0x0d52, 0x101a,   0}, {0x0d62, 0x102a,   0}, {0x0d72, 0x103a,   0},
+	/* Characters from 0x0200 */
+	{0x0d82, 0x104a,   0}, {0x0d92, 0x105a,   0}, {0x0da2, 0x106a,   0},
+	{0x0db2, 0x107a,   0}, {0x0dc2, 0x108a,   0}, {0x0dd2, 0x109a,   0},
+	{0x0de2, 0x10aa,   0}, {0x0df2, 0x10ba,   0}, {0x0e02, 0x10ca,   0},
+	{0x0e12, 0x10da,   0}, {0x0e22, 0x10ea,   0}, {0x0e32, 0x10fa,   0},
+	{0x0e42, 0x110a,   0}, {0x0e52, 0x111a,   0}, {0x0e62, 0x112a,   0},
+	{0x0e72, 0x113a,   0}, {0x0e82, 0x114a,   0}, {0x0e92, 0x115a,   0},
+	{0x0ea2, 0x116a,   0}, {0x0eb2, 0x117a,   0}, {0x0ec2, 0x118a,   0},
+	{0x0ed2, 0x119a,   0}, {0x0ee2, 0x11aa,   0}, {0x0ef2, 0x11ba,   0},
+	{0x0f02, 0x11ca,   0}, {0x0f12, 0x11da,   0}, {0x0f22, 0x11ea,   0},
+	{0x0f32, 0x11fa,   0}, {0x0000, 0x1209,   0}, {0x0000, 0x0000,   0},
+	{0x0f42, 0x1212,   0}, {0x0f52, 0x1222,   0}, {0x0000, 0x1231,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1239,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1241,   0}, {0x0000, 0x0000,   0}, {0x0f62, 0x124a,   0},
+	{0x0f72, 0x125a,   0}, {0x0f82, 0x126a,   0}, {0x0f92, 0x127a,   0},
+	{0x0fa3, 0x128b,   0}, {0x0fbb, 0x12a3,   0}, {0x0fd3, 0x12bb,   0},
+	{0x0feb, 0x12d3,   0}, {0x1002, 0x12ea,   0}, {0x1012, 0x12fa,   0},
+	/* Characters from 0x0230 */
+	{0x1023, 0x130b,   0}, {0x103b, 0x1323,   0}, {0x1052, 0x133a,   0},
+	{0x1062, 0x134a,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1359,   0}, {0x0000, 0x1361,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1369,   0}, {0x0000, 0x1371,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1379,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1381,   0}, {0x0000, 0x1389,   0},
+	{0x0000, 0x1391,   0}, {0x0000, 0x1399,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x13a1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x13a9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x13b1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x13b9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0260 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0290 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x02c0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x02f0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 232}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 232}, {0x0000, 0x0000, 216}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	/* Characters from 0x0320 */
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 202}, {0x0000, 0x0000, 202},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 202}, {0x0000, 0x0000, 202},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000,   1},
+	{0x0000, 0x0000,   1}, {0x0000, 0x0000,   1}, {0x0000, 0x0000,   1},
+	{0x0000, 0x0000,   1}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x1071, 0x13c1, 230},
+	{0x1079, 0x13c9, 230}, {0x0000, 0x0000, 230}, {0x1081, 0x13d1, 230},
+	{0x108a, 0x13da, 230}, {0x0000, 0x13e9, 240}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0350 */
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 232},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 233}, {0x0000, 0x0000, 234}, {0x0000, 0x0000, 234},
+	{0x0000, 0x0000, 233}, {0x0000, 0x0000, 234}, {0x0000, 0x0000, 234},
+	{0x0000, 0x0000, 233}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x13f1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x13f9,   0}, {0x0000, 0x0000,   0},
+	{0x1099, 0x1401,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1409,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x10a1, 0x1411,   0}, {0x0000, 0x1419,   0},
+	/* Characters from 0x0380 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x10aa, 0x1422,   0},
+	{0x10ba, 0x1432,   0}, {0x10c9, 0x1441,   0}, {0x10d2, 0x144a,   0},
+	{0x10e2, 0x145a,   0}, {0x10f2, 0x146a,   0}, {0x0000, 0x0000,   0},
+	{0x1102, 0x147a,   0}, {0x0000, 0x0000,   0}, {0x1112, 0x148a,   0},
+	{0x1122, 0x149a,   0}, {0x1133, 0x14ab,   0}, {0x0000, 0x14c1,   0},
+	{0x0000, 0x14c9,   0}, {0x0000, 0x14d1,   0}, {0x0000, 0x14d9,   0},
+	{0x0000, 0x14e1,   0}, {0x0000, 0x14e9,   0}, {0x0000, 0x14f1,   0},
+	{0x0000, 0x14f9,   0}, {0x0000, 0x1501,   0}, {0x0000, 0x1509,   0},
+	{0x0000, 0x1511,   0}, {0x0000, 0x1519,   0}, {0x0000, 0x1521,   0},
+	{0x0000, 0x1529,   0}, {0x0000, 0x1531,   0}, {0x0000, 0x1539,   0},
+	{0x0000, 0x1541,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1549,   0},
+	{0x0000, 0x1551,   0}, {0x0000, 0x1559,   0}, {0x0000, 0x1561,   0},
+	{0x0000, 0x1569,   0}, {0x0000, 0x1571,   0}, {0x0000, 0x1579,   0},
+	{0x114a, 0x1582,   0}, {0x115a, 0x1592,   0}, {0x116a, 0x15a2,   0},
+	{0x117a, 0x15b2,   0}, {0x118a, 0x15c2,   0}, {0x119a, 0x15d2,   0},
+	/* Characters from 0x03b0 */
+	{0x11ab, 0x15e3,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x15f9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x11c2, 0x1602,   0},
+	{0x11d2, 0x1612,   0}, {0x11e2, 0x1622,   0}, {0x11f2, 0x1632,   0},
+	{0x1202, 0x1642,   0}, {0x0000, 0x1651,   0}, {0x0000, 0x1659,   0},
+	{0x0000, 0x1661,   0}, {0x0000, 0x0000,   0}, {0x1212, 0x166a,   0},
+	{0x1222, 0x167a,   0}, {0x0000, 0x1689,   0}, {0x0000, 0x1691,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1699,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x16a1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x16a9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x16b1,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x03e0 */
+	{0x0000, 0x16b9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x16c1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x16c9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x16d1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x16d9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x16e1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x16e9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x16f1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x16f9,   0}, {0x0000, 0x1701,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1709,   0},
+	{0x0000, 0x1711,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1719,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1721,   0}, {0x0000, 0x1729,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1731,   0},
+	{0x0000, 0x1739,   0}, {0x0000, 0x1741,   0}, {0x1232, 0x174a,   0},
+	{0x1242, 0x175a,   0}, {0x0000, 0x1769,   0}, {0x1252, 0x1772,   0},
+	{0x0000, 0x1781,   0}, {0x0000, 0x1789,   0}, {0x0000, 0x1791,   0},
+	{0x1262, 0x179a,   0}, {0x0000, 0x17a9,   0}, {0x0000, 0x17b1,   0},
+	{0x0000, 0x17b9,   0}, {0x0000, 0x17c1,   0}, {0x1272, 0x17ca,   0},
+	{0x1282, 0x17da,   0}, {0x1292, 0x17ea,   0}, {0x0000, 0x17f9,   0},
+	/* Characters from 0x0410 */
+	{0x0000, 0x1801,   0}, {0x0000, 0x1809,   0}, {0x0000, 0x1811,   0},
+	{0x0000, 0x1819,   0}, {0x0000, 0x1821,   0}, {0x0000, 0x1829,   0},
+	{0x0000, 0x1831,   0}, {0x0000, 0x1839,   0}, {0x0000, 0x1841,   0},
+	{0x12a2, 0x184a,   0}, {0x0000, 0x1859,   0}, {0x0000, 0x1861,   0},
+	{0x0000, 0x1869,   0}, {0x0000, 0x1871,   0}, {0x0000, 0x1879,   0},
+	{0x0000, 0x1881,   0}, {0x0000, 0x1889,   0}, {0x0000, 0x1891,   0},
+	{0x0000, 0x1899,   0}, {0x0000, 0x18a1,   0}, {0x0000, 0x18a9,   0},
+	{0x0000, 0x18b1,   0}, {0x0000, 0x18b9,   0}, {0x0000, 0x18c1,   0},
+	{0x0000, 0x18c9,   0}, {0x0000, 0x18d1,   0}, {0x0000, 0x18d9,   0},
+	{0x0000, 0x18e1,   0}, {0x0000, 0x18e9,   0}, {0x0000, 0x18f1,   0},
+	{0x0000, 0x18f9,   0}, {0x0000, 0x1901,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x12b2, 0x190a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0440 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x12c2, 0x191a,   0}, {0x12d2, 0x192a,   0},
+	{0x0000, 0x0000,   0}, {0x12e2, 0x193a,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x12f2, 0x194a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x1302, 0x195a,   0}, {0x1312, 0x196a,   0},
+	{0x1322, 0x197a,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1989,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1991,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1999,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x19a1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x19a9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x19b1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x19b9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x19c1,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0470 */
+	{0x0000, 0x19c9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x19d1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x19d9,   0}, {0x0000, 0x0000,   0},
+	{0x1332, 0x19e2,   0}, {0x1342, 0x19f2,   0}, {0x0000, 0x1a01,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a09,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a11,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a19,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a21,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a29,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a31,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a39,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a41,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a49,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a51,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a59,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a61,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a69,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a71,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a79,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x04a0 */
+	{0x0000, 0x1a81,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1a89,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1a91,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1a99,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1aa1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1aa9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1ab1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1ab9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1ac1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1ac9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1ad1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1ad9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1ae1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1ae9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1af1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1af9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1b01,   0},
+	{0x1352, 0x1b0a,   0}, {0x1362, 0x1b1a,   0}, {0x0000, 0x1b29,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1b31,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1b39,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1b41,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1b49,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1b51,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x04d0 */
+	{0x1372, 0x1b5a,   0}, {0x1382, 0x1b6a,   0}, {0x1392, 0x1b7a,   0},
+	{0x13a2, 0x1b8a,   0}, {0x0000, 0x1b99,   0}, {0x0000, 0x0000,   0},
+	{0x13b2, 0x1ba2,   0}, {0x13c2, 0x1bb2,   0}, {0x0000, 0x1bc1,   0},
+	{0x0000, 0x0000,   0}, {0x13d2, 0x1bca,   0}, {0x13e2, 0x1bda,   0},
+	{0x13f2, 0x1bea,   0}, {0x1402, 0x1bfa,   0}, {0x1412, 0x1c0a,   0},
+	{0x1422, 0x1c1a,   0}, {0x0000, 0x1c29,   0}, {0x0000, 0x0000,   0},
+	{0x1432, 0x1c32,   0}, {0x1442, 0x1c42,   0}, {0x1452, 0x1c52,   0},
+	{0x1462, 0x1c62,   0}, {0x1472, 0x1c72,   0}, {0x1482, 0x1c82,   0},
+	{0x0000, 0x1c91,   0}, {0x0000, 0x0000,   0}, {0x1492, 0x1c9a,   0},
+	{0x14a2, 0x1caa,   0}, {0x14b2, 0x1cba,   0}, {0x14c2, 0x1cca,   0},
+	{0x14d2, 0x1cda,   0}, {0x14e2, 0x1cea,   0}, {0x14f2, 0x1cfa,   0},
+	{0x1502, 0x1d0a,   0}, {0x1512, 0x1d1a,   0}, {0x1522, 0x1d2a,   0},
+	{0x1532, 0x1d3a,   0}, {0x1542, 0x1d4a,   0}, {0x0000, 0x1d59,   0},
+	{0x0000, 0x0000,   0}, {0x1552, 0x1d62,   0}, {0x1562, 0x1d72,   0},
+	{0x0000, 0x1d81,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1d89,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1d91,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0500 */
+	{0x0000, 0x1d99,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1da1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1da9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1db1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1db9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1dc1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1dc9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1dd1,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1dd9,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1de1,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1de9,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1df1,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1df9,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1e01,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e09,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1e11,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1e19,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e21,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1e29,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1e31,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e39,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1e41,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x1e49,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e51,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0530 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x1e59,   0}, {0x0000, 0x1e61,   0},
+	{0x0000, 0x1e69,   0}, {0x0000, 0x1e71,   0}, {0x0000, 0x1e79,   0},
+	{0x0000, 0x1e81,   0}, {0x0000, 0x1e89,   0}, {0x0000, 0x1e91,   0},
+	{0x0000, 0x1e99,   0}, {0x0000, 0x1ea1,   0}, {0x0000, 0x1ea9,   0},
+	{0x0000, 0x1eb1,   0}, {0x0000, 0x1eb9,   0}, {0x0000, 0x1ec1,   0},
+	{0x0000, 0x1ec9,   0}, {0x0000, 0x1ed1,   0}, {0x0000, 0x1ed9,   0},
+	{0x0000, 0x1ee1,   0}, {0x0000, 0x1ee9,   0}, {0x0000, 0x1ef1,   0},
+	{0x0000, 0x1ef9,   0}, {0x0000, 0x1f01,   0}, {0x0000, 0x1f09,   0},
+	{0x0000, 0x1f11,   0}, {0x0000, 0x1f19,   0}, {0x0000, 0x1f21,   0},
+	{0x0000, 0x1f29,   0}, {0x0000, 0x1f31,   0}, {0x0000, 0x1f39,   0},
+	{0x0000, 0x1f41,   0}, {0x0000, 0x1f49,   0}, {0x0000, 0x1f51,   0},
+	{0x0000, 0x1f59,   0}, {0x0000, 0x1f61,   0}, {0x0000, 0x1f69,   0},
+	{0x0000, 0x1f71,   0}, {0x0000, 0x1f79,   0}, {0x0000, 0x1f81,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0560 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x1f8a,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0590 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 222}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 222},
+	{0x0000, 0x0000, 228}, {0x0000, 0x0000, 230}, {0x0000, 0x0000,  10},
+	{0x0000, 0x0000,  11}, {0x0000, 0x0000,  12}, {0x0000, 0x0000,  13},
+	{0x0000, 0x0000,  14}, {0x0000, 0x0000,  15}, {0x0000, 0x0000,  16},
+	{0x0000, 0x0000,  17}, {0x0000, 0x0000,  18}, {0x0000, 0x0000,  19},
+	{0x0000, 0x0000,  19}, {0x0000, 0x0000,  20}, {0x0000, 0x0000,  21},
+	{0x0000, 0x0000,  22}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,  23},
+	/* Characters from 0x05c0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,  24}, {0x0000, 0x0000,  25},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,  18}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x05f0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000,  30}, {0x0000, 0x0000,  31},
+	{0x0000, 0x0000,  32}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0620 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x1572, 0x1f9a,   0},
+	{0x1582, 0x1faa,   0}, {0x1592, 0x1fba,   0}, {0x15a2, 0x1fca,   0},
+	{0x15b2, 0x1fda,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,  27}, {0x0000, 0x0000,  28},
+	{0x0000, 0x0000,  29}, {0x0000, 0x0000,  30}, {0x0000, 0x0000,  31},
+	/* Characters from 0x0650 */
+	{0x0000, 0x0000,  32}, {0x0000, 0x0000,  33}, {0x0000, 0x0000,  34},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,  35},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0680 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x06b0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x15c2, 0x1fea,   0}, {0x0000, 0x0000,   0},
+	{0x15d2, 0x1ffa,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x15e2, 0x200a,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000, 230},
+	/* Characters from 0x06e0 */
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0710 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,  36}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	/* Characters from 0x0740 */
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 220}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 220},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x0770 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x07a0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	/* Characters from 0x07d0 */
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 230}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000, 230}, {0x0000, 0x0000, 220}, {0x0000, 0x0000, 230},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+	{0x0000, 0x0000,   0}, {0x0000, 0x0000,   0}, {0x0000, 0x0000,   0},
+};
+
+static const u16 apfs_nfd[] __aligned(64) = {
+	0x0041, 0xd800, 0x0041, 0xd801, 0x0041, 0xd802, 0x0041, 0xd803,
+	0x0041, 0xd804, 0x0041, 0xd805, 0x0043, 0xd806, 0x0045, 0xd800,
+	0x0045, 0xd801, 0x0045, 0xd802, 0x0045, 0xd804, 0x0049, 0xd800,
+	0x0049, 0xd801, 0x0049, 0xd802, 0x0049, 0xd804, 0x004e, 0xd803,
+	0x004f, 0xd800, 0x004f, 0xd801, 0x004f, 0xd802, 0x004f, 0xd803,
+	0x004f, 0xd804, 0x0055, 0xd800, 0x0055, 0xd801, 0x0055, 0xd802,
+	0x0055, 0xd804, 0x0059, 0xd801, 0x0061, 0xd800, 0x0061, 0xd801,
+	0x0061, 0xd802, 0x0061, 0xd803, 0x0061, 0xd804, 0x0061, 0xd805,
+	0x0063, 0xd806, 0x0065, 0xd800, 0x0065, 0xd801, 0x0065, 0xd802,
+	0x0065, 0xd804, 0x0069, 0xd800, 0x0069, 0xd801, 0x0069, 0xd802,
+	0x0069, 0xd804, 0x006e, 0xd803, 0x006f, 0xd800, 0x006f, 0xd801,
+	0x006f, 0xd802, 0x006f, 0xd803, 0x006f, 0xd804, 0x0075, 0xd800,
+	0x0075, 0xd801, 0x0075, 0xd802, 0x0075, 0xd804, 0x0079, 0xd801,
+	0x0079, 0xd804, 0x0041, 0xd807, 0x0061, 0xd807, 0x0041, 0xd808,
+	0x0061, 0xd808, 0x0041, 0xd809, 0x0061, 0xd809, 0x0043, 0xd801,
+	0x0063, 0xd801, 0x0043, 0xd802, 0x0063, 0xd802, 0x0043, 0xd80a,
+	0x0063, 0xd80a, 0x0043, 0xd80b, 0x0063, 0xd80b, 0x0044, 0xd80b,
+	0x0064, 0xd80b, 0x0045, 0xd807, 0x0065, 0xd807, 0x0045, 0xd808,
+	0x0065, 0xd808, 0x0045, 0xd80a, 0x0065, 0xd80a, 0x0045, 0xd809,
+	0x0065, 0xd809, 0x0045, 0xd80b, 0x0065, 0xd80b, 0x0047, 0xd802,
+	0x0067, 0xd802, 0x0047, 0xd808, 0x0067, 0xd808, 0x0047, 0xd80a,
+	0x0067, 0xd80a, 0x0047, 0xd806, 0x0067, 0xd806, 0x0048, 0xd802,
+	0x0068, 0xd802, 0x0049, 0xd803, 0x0069, 0xd803, 0x0049, 0xd807,
+	0x0069, 0xd807, 0x0049, 0xd808, 0x0069, 0xd808, 0x0049, 0xd809,
+	0x0069, 0xd809, 0x0049, 0xd80a, 0x004a, 0xd802, 0x006a, 0xd802,
+	0x004b, 0xd806, 0x006b, 0xd806, 0x004c, 0xd801, 0x006c, 0xd801,
+	0x004c, 0xd806, 0x006c, 0xd806, 0x004c, 0xd80b, 0x006c, 0xd80b,
+	0x004e, 0xd801, 0x006e, 0xd801, 0x004e, 0xd806, 0x006e, 0xd806,
+	0x004e, 0xd80b, 0x006e, 0xd80b, 0x004f, 0xd807, 0x006f, 0xd807,
+	0x004f, 0xd808, 0x006f, 0xd808, 0x004f, 0xd80c, 0x006f, 0xd80c,
+	0x0052, 0xd801, 0x0072, 0xd801, 0x0052, 0xd806, 0x0072, 0xd806,
+	0x0052, 0xd80b, 0x0072, 0xd80b, 0x0053, 0xd801, 0x0073, 0xd801,
+	0x0053, 0xd802, 0x0073, 0xd802, 0x0053, 0xd806, 0x0073, 0xd806,
+	0x0053, 0xd80b, 0x0073, 0xd80b, 0x0054, 0xd806, 0x0074, 0xd806,
+	0x0054, 0xd80b, 0x0074, 0xd80b, 0x0055, 0xd803, 0x0075, 0xd803,
+	0x0055, 0xd807, 0x0075, 0xd807, 0x0055, 0xd808, 0x0075, 0xd808,
+	0x0055, 0xd805, 0x0075, 0xd805, 0x0055, 0xd80c, 0x0075, 0xd80c,
+	0x0055, 0xd809, 0x0075, 0xd809, 0x0057, 0xd802, 0x0077, 0xd802,
+	0x0059, 0xd802, 0x0079, 0xd802, 0x0059, 0xd804, 0x005a, 0xd801,
+	0x007a, 0xd801, 0x005a, 0xd80a, 0x007a, 0xd80a, 0x005a, 0xd80b,
+	0x007a, 0xd80b, 0x004f, 0xd80d, 0x006f, 0xd80d, 0x0055, 0xd80d,
+	0x0075, 0xd80d, 0x0041, 0xd80b, 0x0061, 0xd80b, 0x0049, 0xd80b,
+	0x0069, 0xd80b, 0x004f, 0xd80b, 0x006f, 0xd80b, 0x0055, 0xd80b,
+	0x0075, 0xd80b, 0x0055, 0xd804, 0xd807, 0x0075, 0xd804, 0xd807,
+	0x0055, 0xd804, 0xd801, 0x0075, 0xd804, 0xd801, 0x0055, 0xd804,
+	0xd80b, 0x0075, 0xd804, 0xd80b, 0x0055, 0xd804, 0xd800, 0x0075,
+	0xd804, 0xd800, 0x0041, 0xd804, 0xd807, 0x0061, 0xd804, 0xd807,
+	0x0041, 0xd80a, 0xd807, 0x0061, 0xd80a, 0xd807, 0x00c6, 0xd807,
+	0x00e6, 0xd807, 0x0047, 0xd80b, 0x0067, 0xd80b, 0x004b, 0xd80b,
+	0x006b, 0xd80b, 0x004f, 0xd809, 0x006f, 0xd809, 0x004f, 0xd809,
+	0xd807, 0x006f, 0xd809, 0xd807, 0x01b7, 0xd80b, 0x0292, 0xd80b,
+	0x006a, 0xd80b, 0x0047, 0xd801, 0x0067, 0xd801, 0x004e, 0xd800,
+	0x006e, 0xd800, 0x0041, 0xd805, 0xd801, 0x0061, 0xd805, 0xd801,
+	0x00c6, 0xd801, 0x00e6, 0xd801, 0x00d8, 0xd801, 0x00f8, 0xd801,
+	0x0041, 0xd80e, 0x0061, 0xd80e, 0x0041, 0xd80f, 0x0061, 0xd80f,
+	0x0045, 0xd80e, 0x0065, 0xd80e, 0x0045, 0xd80f, 0x0065, 0xd80f,
+	0x0049, 0xd80e, 0x0069, 0xd80e, 0x0049, 0xd80f, 0x0069, 0xd80f,
+	0x004f, 0xd80e, 0x006f, 0xd80e, 0x004f, 0xd80f, 0x006f, 0xd80f,
+	0x0052, 0xd80e, 0x0072, 0xd80e, 0x0052, 0xd80f, 0x0072, 0xd80f,
+	0x0055, 0xd80e, 0x0075, 0xd80e, 0x0055, 0xd80f, 0x0075, 0xd80f,
+	0x0053, 0xd810, 0x0073, 0xd810, 0x0054, 0xd810, 0x0074, 0xd810,
+	0x0048, 0xd80b, 0x0068, 0xd80b, 0x0041, 0xd80a, 0x0061, 0xd80a,
+	0x0045, 0xd806, 0x0065, 0xd806, 0x004f, 0xd804, 0xd807, 0x006f,
+	0xd804, 0xd807, 0x004f, 0xd803, 0xd807, 0x006f, 0xd803, 0xd807,
+	0x004f, 0xd80a, 0x006f, 0xd80a, 0x004f, 0xd80a, 0xd807, 0x006f,
+	0xd80a, 0xd807, 0x0059, 0xd807, 0x0079, 0xd807, 0xd800, 0xd801,
+	0xd811, 0xd804, 0xd801, 0x02b9, 0x003b, 0x00a8, 0xd801, 0x0391,
+	0xd801, 0x00b7, 0x0395, 0xd801, 0x0397, 0xd801, 0x0399, 0xd801,
+	0x039f, 0xd801, 0x03a5, 0xd801, 0x03a9, 0xd801, 0x03b9, 0xd804,
+	0xd801, 0x0399, 0xd804, 0x03a5, 0xd804, 0x03b1, 0xd801, 0x03b5,
+	0xd801, 0x03b7, 0xd801, 0x03b9, 0xd801, 0x03c5, 0xd804, 0xd801,
+	0x03b9, 0xd804, 0x03c5, 0xd804, 0x03bf, 0xd801, 0x03c5, 0xd801,
+	0x03c9, 0xd801, 0x03d2, 0xd801, 0x03d2, 0xd804, 0x0415, 0xd800,
+	0x0415, 0xd804, 0x0413, 0xd801, 0x0406, 0xd804, 0x041a, 0xd801,
+	0x0418, 0xd800, 0x0423, 0xd808, 0x0418, 0xd808, 0x0438, 0xd808,
+	0x0435, 0xd800, 0x0435, 0xd804, 0x0433, 0xd801, 0x0456, 0xd804,
+	0x043a, 0xd801, 0x0438, 0xd800, 0x0443, 0xd808, 0x0474, 0xd80e,
+	0x0475, 0xd80e, 0x0416, 0xd808, 0x0436, 0xd808, 0x0410, 0xd808,
+	0x0430, 0xd808, 0x0410, 0xd804, 0x0430, 0xd804, 0x0415, 0xd808,
+	0x0435, 0xd808, 0x04d8, 0xd804, 0x04d9, 0xd804, 0x0416, 0xd804,
+	0x0436, 0xd804, 0x0417, 0xd804, 0x0437, 0xd804, 0x0418, 0xd807,
+	0x0438, 0xd807, 0x0418, 0xd804, 0x0438, 0xd804, 0x041e, 0xd804,
+	0x043e, 0xd804, 0x04e8, 0xd804, 0x04e9, 0xd804, 0x042d, 0xd804,
+	0x044d, 0xd804, 0x0423, 0xd807, 0x0443, 0xd807, 0x0423, 0xd804,
+	0x0443, 0xd804, 0x0423, 0xd80c, 0x0443, 0xd80c, 0x0427, 0xd804,
+	0x0447, 0xd804, 0x042b, 0xd804, 0x044b, 0xd804, 0x0627, 0xd812,
+	0x0627, 0xd813, 0x0648, 0xd813, 0x0627, 0xd814, 0x064a, 0xd813,
+	0x06d5, 0xd813, 0x06c1, 0xd813, 0x06d2, 0xd813, 0x0928, 0xd815,
+	0x0930, 0xd815, 0x0933, 0xd815, 0x0915, 0xd815, 0x0916, 0xd815,
+	0x0917, 0xd815, 0x091c, 0xd815, 0x0921, 0xd815, 0x0922, 0xd815,
+	0x092b, 0xd815, 0x092f, 0xd815, 0x09c7, 0x09be, 0x09c7, 0x09d7,
+	0x09a1, 0xd816, 0x09a2, 0xd816, 0x09af, 0xd816, 0x0a32, 0xd817,
+	0x0a38, 0xd817, 0x0a16, 0xd817, 0x0a17, 0xd817, 0x0a1c, 0xd817,
+	0x0a2b, 0xd817, 0x0b47, 0x0b56, 0x0b47, 0x0b3e, 0x0b47, 0x0b57,
+	0x0b21, 0xd818, 0x0b22, 0xd818, 0x0b92, 0x0bd7, 0x0bc6, 0x0bbe,
+	0x0bc7, 0x0bbe, 0x0bc6, 0x0bd7, 0x0c46, 0xd819, 0x0cbf, 0x0cd5,
+	0x0cc6, 0x0cd5, 0x0cc6, 0x0cd6, 0x0cc6, 0x0cc2, 0x0cc6, 0x0cc2,
+	0x0cd5, 0x0d46, 0x0d3e, 0x0d47, 0x0d3e, 0x0d46, 0x0d57, 0x0dd9,
+	0xd81a, 0x0dd9, 0x0dcf, 0x0dd9, 0x0dcf, 0xd81a, 0x0dd9, 0x0ddf,
+	0x0f42, 0x0fb7, 0x0f4c, 0x0fb7, 0x0f51, 0x0fb7, 0x0f56, 0x0fb7,
+	0x0f5b, 0x0fb7, 0x0f40, 0x0fb5, 0xd81b, 0xd81c, 0xd81b, 0xd81d,
+	0x0fb2, 0xd81e, 0x0fb3, 0xd81e, 0xd81b, 0xd81e, 0x0f92, 0x0fb7,
+	0x0f9c, 0x0fb7, 0x0fa1, 0x0fb7, 0x0fa6, 0x0fb7, 0x0fab, 0x0fb7,
+	0x0f90, 0x0fb5, 0x1025, 0x102e, 0x1b05, 0x1b35, 0x1b07, 0x1b35,
+	0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35,
+	0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f, 0x1b35,
+	0x1b42, 0x1b35, 0x0041, 0xd81f, 0x0061, 0xd81f, 0x0042, 0xd80a,
+	0x0062, 0xd80a, 0x0042, 0xd820, 0x0062, 0xd820, 0x0042, 0xd821,
+	0x0062, 0xd821, 0x0043, 0xd806, 0xd801, 0x0063, 0xd806, 0xd801,
+	0x0044, 0xd80a, 0x0064, 0xd80a, 0x0044, 0xd820, 0x0064, 0xd820,
+	0x0044, 0xd821, 0x0064, 0xd821, 0x0044, 0xd806, 0x0064, 0xd806,
+	0x0044, 0xd822, 0x0064, 0xd822, 0x0045, 0xd807, 0xd800, 0x0065,
+	0xd807, 0xd800, 0x0045, 0xd807, 0xd801, 0x0065, 0xd807, 0xd801,
+	0x0045, 0xd822, 0x0065, 0xd822, 0x0045, 0xd823, 0x0065, 0xd823,
+	0x0045, 0xd806, 0xd808, 0x0065, 0xd806, 0xd808, 0x0046, 0xd80a,
+	0x0066, 0xd80a, 0x0047, 0xd807, 0x0067, 0xd807, 0x0048, 0xd80a,
+	0x0068, 0xd80a, 0x0048, 0xd820, 0x0068, 0xd820, 0x0048, 0xd804,
+	0x0068, 0xd804, 0x0048, 0xd806, 0x0068, 0xd806, 0x0048, 0xd824,
+	0x0068, 0xd824, 0x0049, 0xd823, 0x0069, 0xd823, 0x0049, 0xd804,
+	0xd801, 0x0069, 0xd804, 0xd801, 0x004b, 0xd801, 0x006b, 0xd801,
+	0x004b, 0xd820, 0x006b, 0xd820, 0x004b, 0xd821, 0x006b, 0xd821,
+	0x004c, 0xd820, 0x006c, 0xd820, 0x004c, 0xd820, 0xd807, 0x006c,
+	0xd820, 0xd807, 0x004c, 0xd821, 0x006c, 0xd821, 0x004c, 0xd822,
+	0x006c, 0xd822, 0x004d, 0xd801, 0x006d, 0xd801, 0x004d, 0xd80a,
+	0x006d, 0xd80a, 0x004d, 0xd820, 0x006d, 0xd820, 0x004e, 0xd80a,
+	0x006e, 0xd80a, 0x004e, 0xd820, 0x006e, 0xd820, 0x004e, 0xd821,
+	0x006e, 0xd821, 0x004e, 0xd822, 0x006e, 0xd822, 0x004f, 0xd803,
+	0xd801, 0x006f, 0xd803, 0xd801, 0x004f, 0xd803, 0xd804, 0x006f,
+	0xd803, 0xd804, 0x004f, 0xd807, 0xd800, 0x006f, 0xd807, 0xd800,
+	0x004f, 0xd807, 0xd801, 0x006f, 0xd807, 0xd801, 0x0050, 0xd801,
+	0x0070, 0xd801, 0x0050, 0xd80a, 0x0070, 0xd80a, 0x0052, 0xd80a,
+	0x0072, 0xd80a, 0x0052, 0xd820, 0x0072, 0xd820, 0x0052, 0xd820,
+	0xd807, 0x0072, 0xd820, 0xd807, 0x0052, 0xd821, 0x0072, 0xd821,
+	0x0053, 0xd80a, 0x0073, 0xd80a, 0x0053, 0xd820, 0x0073, 0xd820,
+	0x0053, 0xd801, 0xd80a, 0x0073, 0xd801, 0xd80a, 0x0053, 0xd80b,
+	0xd80a, 0x0073, 0xd80b, 0xd80a, 0x0053, 0xd820, 0xd80a, 0x0073,
+	0xd820, 0xd80a, 0x0054, 0xd80a, 0x0074, 0xd80a, 0x0054, 0xd820,
+	0x0074, 0xd820, 0x0054, 0xd821, 0x0074, 0xd821, 0x0054, 0xd822,
+	0x0074, 0xd822, 0x0055, 0xd825, 0x0075, 0xd825, 0x0055, 0xd823,
+	0x0075, 0xd823, 0x0055, 0xd822, 0x0075, 0xd822, 0x0055, 0xd803,
+	0xd801, 0x0075, 0xd803, 0xd801, 0x0055, 0xd807, 0xd804, 0x0075,
+	0xd807, 0xd804, 0x0056, 0xd803, 0x0076, 0xd803, 0x0056, 0xd820,
+	0x0076, 0xd820, 0x0057, 0xd800, 0x0077, 0xd800, 0x0057, 0xd801,
+	0x0077, 0xd801, 0x0057, 0xd804, 0x0077, 0xd804, 0x0057, 0xd80a,
+	0x0077, 0xd80a, 0x0057, 0xd820, 0x0077, 0xd820, 0x0058, 0xd80a,
+	0x0078, 0xd80a, 0x0058, 0xd804, 0x0078, 0xd804, 0x0059, 0xd80a,
+	0x0079, 0xd80a, 0x005a, 0xd802, 0x007a, 0xd802, 0x005a, 0xd820,
+	0x007a, 0xd820, 0x005a, 0xd821, 0x007a, 0xd821, 0x0068, 0xd821,
+	0x0074, 0xd804, 0x0077, 0xd805, 0x0079, 0xd805, 0x017f, 0xd80a,
+	0x0041, 0xd820, 0x0061, 0xd820, 0x0041, 0xd826, 0x0061, 0xd826,
+	0x0041, 0xd802, 0xd801, 0x0061, 0xd802, 0xd801, 0x0041, 0xd802,
+	0xd800, 0x0061, 0xd802, 0xd800, 0x0041, 0xd802, 0xd826, 0x0061,
+	0xd802, 0xd826, 0x0041, 0xd802, 0xd803, 0x0061, 0xd802, 0xd803,
+	0x0041, 0xd820, 0xd802, 0x0061, 0xd820, 0xd802, 0x0041, 0xd808,
+	0xd801, 0x0061, 0xd808, 0xd801, 0x0041, 0xd808, 0xd800, 0x0061,
+	0xd808, 0xd800, 0x0041, 0xd808, 0xd826, 0x0061, 0xd808, 0xd826,
+	0x0041, 0xd808, 0xd803, 0x0061, 0xd808, 0xd803, 0x0041, 0xd820,
+	0xd808, 0x0061, 0xd820, 0xd808, 0x0045, 0xd820, 0x0065, 0xd820,
+	0x0045, 0xd826, 0x0065, 0xd826, 0x0045, 0xd803, 0x0065, 0xd803,
+	0x0045, 0xd802, 0xd801, 0x0065, 0xd802, 0xd801, 0x0045, 0xd802,
+	0xd800, 0x0065, 0xd802, 0xd800, 0x0045, 0xd802, 0xd826, 0x0065,
+	0xd802, 0xd826, 0x0045, 0xd802, 0xd803, 0x0065, 0xd802, 0xd803,
+	0x0045, 0xd820, 0xd802, 0x0065, 0xd820, 0xd802, 0x0049, 0xd826,
+	0x0069, 0xd826, 0x0049, 0xd820, 0x0069, 0xd820, 0x004f, 0xd820,
+	0x006f, 0xd820, 0x004f, 0xd826, 0x006f, 0xd826, 0x004f, 0xd802,
+	0xd801, 0x006f, 0xd802, 0xd801, 0x004f, 0xd802, 0xd800, 0x006f,
+	0xd802, 0xd800, 0x004f, 0xd802, 0xd826, 0x006f, 0xd802, 0xd826,
+	0x004f, 0xd802, 0xd803, 0x006f, 0xd802, 0xd803, 0x004f, 0xd820,
+	0xd802, 0x006f, 0xd820, 0xd802, 0x004f, 0xd80d, 0xd801, 0x006f,
+	0xd80d, 0xd801, 0x004f, 0xd80d, 0xd800, 0x006f, 0xd80d, 0xd800,
+	0x004f, 0xd80d, 0xd826, 0x006f, 0xd80d, 0xd826, 0x004f, 0xd80d,
+	0xd803, 0x006f, 0xd80d, 0xd803, 0x004f, 0xd80d, 0xd820, 0x006f,
+	0xd80d, 0xd820, 0x0055, 0xd820, 0x0075, 0xd820, 0x0055, 0xd826,
+	0x0075, 0xd826, 0x0055, 0xd80d, 0xd801, 0x0075, 0xd80d, 0xd801,
+	0x0055, 0xd80d, 0xd800, 0x0075, 0xd80d, 0xd800, 0x0055, 0xd80d,
+	0xd826, 0x0075, 0xd80d, 0xd826, 0x0055, 0xd80d, 0xd803, 0x0075,
+	0xd80d, 0xd803, 0x0055, 0xd80d, 0xd820, 0x0075, 0xd80d, 0xd820,
+	0x0059, 0xd800, 0x0079, 0xd800, 0x0059, 0xd820, 0x0079, 0xd820,
+	0x0059, 0xd826, 0x0079, 0xd826, 0x0059, 0xd803, 0x0079, 0xd803,
+	0x03b1, 0xd811, 0x03b1, 0xd827, 0x03b1, 0xd811, 0xd800, 0x03b1,
+	0xd827, 0xd800, 0x03b1, 0xd811, 0xd801, 0x03b1, 0xd827, 0xd801,
+	0x03b1, 0xd811, 0xd828, 0x03b1, 0xd827, 0xd828, 0x0391, 0xd811,
+	0x0391, 0xd827, 0x0391, 0xd811, 0xd800, 0x0391, 0xd827, 0xd800,
+	0x0391, 0xd811, 0xd801, 0x0391, 0xd827, 0xd801, 0x0391, 0xd811,
+	0xd828, 0x0391, 0xd827, 0xd828, 0x03b5, 0xd811, 0x03b5, 0xd827,
+	0x03b5, 0xd811, 0xd800, 0x03b5, 0xd827, 0xd800, 0x03b5, 0xd811,
+	0xd801, 0x03b5, 0xd827, 0xd801, 0x0395, 0xd811, 0x0395, 0xd827,
+	0x0395, 0xd811, 0xd800, 0x0395, 0xd827, 0xd800, 0x0395, 0xd811,
+	0xd801, 0x0395, 0xd827, 0xd801, 0x03b7, 0xd811, 0x03b7, 0xd827,
+	0x03b7, 0xd811, 0xd800, 0x03b7, 0xd827, 0xd800, 0x03b7, 0xd811,
+	0xd801, 0x03b7, 0xd827, 0xd801, 0x03b7, 0xd811, 0xd828, 0x03b7,
+	0xd827, 0xd828, 0x0397, 0xd811, 0x0397, 0xd827, 0x0397, 0xd811,
+	0xd800, 0x0397, 0xd827, 0xd800, 0x0397, 0xd811, 0xd801, 0x0397,
+	0xd827, 0xd801, 0x0397, 0xd811, 0xd828, 0x0397, 0xd827, 0xd828,
+	0x03b9, 0xd811, 0x03b9, 0xd827, 0x03b9, 0xd811, 0xd800, 0x03b9,
+	0xd827, 0xd800, 0x03b9, 0xd811, 0xd801, 0x03b9, 0xd827, 0xd801,
+	0x03b9, 0xd811, 0xd828, 0x03b9, 0xd827, 0xd828, 0x0399, 0xd811,
+	0x0399, 0xd827, 0x0399, 0xd811, 0xd800, 0x0399, 0xd827, 0xd800,
+	0x0399, 0xd811, 0xd801, 0x0399, 0xd827, 0xd801, 0x0399, 0xd811,
+	0xd828, 0x0399, 0xd827, 0xd828, 0x03bf, 0xd811, 0x03bf, 0xd827,
+	0x03bf, 0xd811, 0xd800, 0x03bf, 0xd827, 0xd800, 0x03bf, 0xd811,
+	0xd801, 0x03bf, 0xd827, 0xd801, 0x039f, 0xd811, 0x039f, 0xd827,
+	0x039f, 0xd811, 0xd800, 0x039f, 0xd827, 0xd800, 0x039f, 0xd811,
+	0xd801, 0x039f, 0xd827, 0xd801, 0x03c5, 0xd811, 0x03c5, 0xd827,
+	0x03c5, 0xd811, 0xd800, 0x03c5, 0xd827, 0xd800, 0x03c5, 0xd811,
+	0xd801, 0x03c5, 0xd827, 0xd801, 0x03c5, 0xd811, 0xd828, 0x03c5,
+	0xd827, 0xd828, 0x03a5, 0xd827, 0x03a5, 0xd827, 0xd800, 0x03a5,
+	0xd827, 0xd801, 0x03a5, 0xd827, 0xd828, 0x03c9, 0xd811, 0x03c9,
+	0xd827, 0x03c9, 0xd811, 0xd800, 0x03c9, 0xd827, 0xd800, 0x03c9,
+	0xd811, 0xd801, 0x03c9, 0xd827, 0xd801, 0x03c9, 0xd811, 0xd828,
+	0x03c9, 0xd827, 0xd828, 0x03a9, 0xd811, 0x03a9, 0xd827, 0x03a9,
+	0xd811, 0xd800, 0x03a9, 0xd827, 0xd800, 0x03a9, 0xd811, 0xd801,
+	0x03a9, 0xd827, 0xd801, 0x03a9, 0xd811, 0xd828, 0x03a9, 0xd827,
+	0xd828, 0x03b1, 0xd800, 0x03b1, 0xd801, 0x03b5, 0xd800, 0x03b5,
+	0xd801, 0x03b7, 0xd800, 0x03b7, 0xd801, 0x03b9, 0xd800, 0x03b9,
+	0xd801, 0x03bf, 0xd800, 0x03bf, 0xd801, 0x03c5, 0xd800, 0x03c5,
+	0xd801, 0x03c9, 0xd800, 0x03c9, 0xd801, 0x03b1, 0xd811, 0xd829,
+	0x03b1, 0xd827, 0xd829, 0x03b1, 0xd811, 0xd800, 0xd829, 0x03b1,
+	0xd827, 0xd800, 0xd829, 0x03b1, 0xd811, 0xd801, 0xd829, 0x03b1,
+	0xd827, 0xd801, 0xd829, 0x03b1, 0xd811, 0xd828, 0xd829, 0x03b1,
+	0xd827, 0xd828, 0xd829, 0x0391, 0xd811, 0xd829, 0x0391, 0xd827,
+	0xd829, 0x0391, 0xd811, 0xd800, 0xd829, 0x0391, 0xd827, 0xd800,
+	0xd829, 0x0391, 0xd811, 0xd801, 0xd829, 0x0391, 0xd827, 0xd801,
+	0xd829, 0x0391, 0xd811, 0xd828, 0xd829, 0x0391, 0xd827, 0xd828,
+	0xd829, 0x03b7, 0xd811, 0xd829, 0x03b7, 0xd827, 0xd829, 0x03b7,
+	0xd811, 0xd800, 0xd829, 0x03b7, 0xd827, 0xd800, 0xd829, 0x03b7,
+	0xd811, 0xd801, 0xd829, 0x03b7, 0xd827, 0xd801, 0xd829, 0x03b7,
+	0xd811, 0xd828, 0xd829, 0x03b7, 0xd827, 0xd828, 0xd829, 0x0397,
+	0xd811, 0xd829, 0x0397, 0xd827, 0xd829, 0x0397, 0xd811, 0xd800,
+	0xd829, 0x0397, 0xd827, 0xd800, 0xd829, 0x0397, 0xd811, 0xd801,
+	0xd829, 0x0397, 0xd827, 0xd801, 0xd829, 0x0397, 0xd811, 0xd828,
+	0xd829, 0x0397, 0xd827, 0xd828, 0xd829, 0x03c9, 0xd811, 0xd829,
+	0x03c9, 0xd827, 0xd829, 0x03c9, 0xd811, 0xd800, 0xd829, 0x03c9,
+	0xd827, 0xd800, 0xd829, 0x03c9, 0xd811, 0xd801, 0xd829, 0x03c9,
+	0xd827, 0xd801, 0xd829, 0x03c9, 0xd811, 0xd828, 0xd829, 0x03c9,
+	0xd827, 0xd828, 0xd829, 0x03a9, 0xd811, 0xd829, 0x03a9, 0xd827,
+	0xd829, 0x03a9, 0xd811, 0xd800, 0xd829, 0x03a9, 0xd827, 0xd800,
+	0xd829, 0x03a9, 0xd811, 0xd801, 0xd829, 0x03a9, 0xd827, 0xd801,
+	0xd829, 0x03a9, 0xd811, 0xd828, 0xd829, 0x03a9, 0xd827, 0xd828,
+	0xd829, 0x03b1, 0xd808, 0x03b1, 0xd807, 0x03b1, 0xd800, 0xd829,
+	0x03b1, 0xd829, 0x03b1, 0xd801, 0xd829, 0x03b1, 0xd828, 0x03b1,
+	0xd828, 0xd829, 0x0391, 0xd808, 0x0391, 0xd807, 0x0391, 0xd800,
+	0x0391, 0xd801, 0x0391, 0xd829, 0x03b9, 0x00a8, 0xd828, 0x03b7,
+	0xd800, 0xd829, 0x03b7, 0xd829, 0x03b7, 0xd801, 0xd829, 0x03b7,
+	0xd828, 0x03b7, 0xd828, 0xd829, 0x0395, 0xd800, 0x0395, 0xd801,
+	0x0397, 0xd800, 0x0397, 0xd801, 0x0397, 0xd829, 0x1fbf, 0xd800,
+	0x1fbf, 0xd801, 0x1fbf, 0xd828, 0x03b9, 0xd808, 0x03b9, 0xd807,
+	0x03b9, 0xd804, 0xd800, 0x03b9, 0xd804, 0xd801, 0x03b9, 0xd828,
+	0x03b9, 0xd804, 0xd828, 0x0399, 0xd808, 0x0399, 0xd807, 0x0399,
+	0xd800, 0x0399, 0xd801, 0x1ffe, 0xd800, 0x1ffe, 0xd801, 0x1ffe,
+	0xd828, 0x03c5, 0xd808, 0x03c5, 0xd807, 0x03c5, 0xd804, 0xd800,
+	0x03c5, 0xd804, 0xd801, 0x03c1, 0xd811, 0x03c1, 0xd827, 0x03c5,
+	0xd828, 0x03c5, 0xd804, 0xd828, 0x03a5, 0xd808, 0x03a5, 0xd807,
+	0x03a5, 0xd800, 0x03a5, 0xd801, 0x03a1, 0xd827, 0x00a8, 0xd800,
+	0x00a8, 0xd801, 0x0060, 0x03c9, 0xd800, 0xd829, 0x03c9, 0xd829,
+	0x03c9, 0xd801, 0xd829, 0x03c9, 0xd828, 0x03c9, 0xd828, 0xd829,
+	0x039f, 0xd800, 0x039f, 0xd801, 0x03a9, 0xd800, 0x03a9, 0xd801,
+	0x03a9, 0xd829, 0x00b4, 0x2002, 0x2003, 0x03a9, 0x004b, 0x0041,
+	0xd805, 0x2190, 0xd82a, 0x2192, 0xd82a, 0x2194, 0xd82a, 0x21d0,
+	0xd82a, 0x21d4, 0xd82a, 0x21d2, 0xd82a, 0x2203, 0xd82a, 0x2208,
+	0xd82a, 0x220b, 0xd82a, 0x2223, 0xd82a, 0x2225, 0xd82a, 0x223c,
+	0xd82a, 0x2243, 0xd82a, 0x2245, 0xd82a, 0x2248, 0xd82a, 0x003d,
+	0xd82a, 0x2261, 0xd82a, 0x224d, 0xd82a, 0x003c, 0xd82a, 0x003e,
+	0xd82a, 0x2264, 0xd82a, 0x2265, 0xd82a, 0x2272, 0xd82a, 0x2273,
+	0xd82a, 0x2276, 0xd82a, 0x2277, 0xd82a, 0x227a, 0xd82a, 0x227b,
+	0xd82a, 0x2282, 0xd82a, 0x2283, 0xd82a, 0x2286, 0xd82a, 0x2287,
+	0xd82a, 0x22a2, 0xd82a, 0x22a8, 0xd82a, 0x22a9, 0xd82a, 0x22ab,
+	0xd82a, 0x227c, 0xd82a, 0x227d, 0xd82a, 0x2291, 0xd82a, 0x2292,
+	0xd82a, 0x22b2, 0xd82a, 0x22b3, 0xd82a, 0x22b4, 0xd82a, 0x22b5,
+	0xd82a, 0x3008, 0x3009, 0x2add, 0xd82a, 0x304b, 0xd82b, 0x304d,
+	0xd82b, 0x304f, 0xd82b, 0x3051, 0xd82b, 0x3053, 0xd82b, 0x3055,
+	0xd82b, 0x3057, 0xd82b, 0x3059, 0xd82b, 0x305b, 0xd82b, 0x305d,
+	0xd82b, 0x305f, 0xd82b, 0x3061, 0xd82b, 0x3064, 0xd82b, 0x3066,
+	0xd82b, 0x3068, 0xd82b, 0x306f, 0xd82b, 0x306f, 0xd82c, 0x3072,
+	0xd82b, 0x3072, 0xd82c, 0x3075, 0xd82b, 0x3075, 0xd82c, 0x3078,
+	0xd82b, 0x3078, 0xd82c, 0x307b, 0xd82b, 0x307b, 0xd82c, 0x3046,
+	0xd82b, 0x309d, 0xd82b, 0x30ab, 0xd82b, 0x30ad, 0xd82b, 0x30af,
+	0xd82b, 0x30b1, 0xd82b, 0x30b3, 0xd82b, 0x30b5, 0xd82b, 0x30b7,
+	0xd82b, 0x30b9, 0xd82b, 0x30bb, 0xd82b, 0x30bd, 0xd82b, 0x30bf,
+	0xd82b, 0x30c1, 0xd82b, 0x30c4, 0xd82b, 0x30c6, 0xd82b, 0x30c8,
+	0xd82b, 0x30cf, 0xd82b, 0x30cf, 0xd82c, 0x30d2, 0xd82b, 0x30d2,
+	0xd82c, 0x30d5, 0xd82b, 0x30d5, 0xd82c, 0x30d8, 0xd82b, 0x30d8,
+	0xd82c, 0x30db, 0xd82b, 0x30db, 0xd82c, 0x30a6, 0xd82b, 0x30ef,
+	0xd82b, 0x30f0, 0xd82b, 0x30f1, 0xd82b, 0x30f2, 0xd82b, 0x30fd,
+	0xd82b, 0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5,
+	0x9f9c, 0x9f9c, 0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669,
+	0x7f85, 0x863f, 0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9,
+	0x73de, 0x843d, 0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04, 0x721b,
+	0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8,
+	0x881f, 0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7,
+	0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c,
+	0x8def, 0x9732, 0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9,
+	0x9304, 0x9e7f, 0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e, 0x7262,
+	0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f,
+	0x7d2f, 0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c,
+	0x7dbe, 0x83f1, 0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39,
+	0x5be7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9,
+	0x4e0d, 0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449,
+	0x8aaa, 0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565,
+	0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf,
+	0x52f5, 0x5442, 0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad,
+	0x9a6a, 0x9e97, 0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74,
+	0x6190, 0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4,
+	0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd,
+	0x70c8, 0x88c2, 0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e,
+	0x7375, 0x4ee4, 0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469,
+	0x7f9a, 0x8046, 0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae,
+	0x91b4, 0x96b8, 0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f, 0x6599,
+	0x6a02, 0x71ce, 0x7642, 0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e,
+	0x5289, 0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b,
+	0x7d10, 0x985e, 0x516d, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea,
+	0x8f2a, 0x5f8b, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f,
+	0x5c65, 0x6613, 0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2, 0x7f79,
+	0x88cf, 0x88e1, 0x91cc, 0x96e2, 0x533f, 0x6eba, 0x541d, 0x71d0,
+	0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8,
+	0x7acb, 0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336,
+	0x523a, 0x5207, 0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4,
+	0x8f3b, 0x884c, 0x964d, 0x898b, 0x5ed3, 0x5140, 0x55c0, 0x585a,
+	0x6674, 0x51de, 0x732a, 0x76ca, 0x793c, 0x795e, 0x7965, 0x798f,
+	0x9756, 0x7cbe, 0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef,
+	0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d,
+	0x52c9, 0x52e4, 0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8,
+	0x5c64, 0x5c6e, 0x6094, 0x6168, 0x618e, 0x61f2, 0x654f, 0x65e2,
+	0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22, 0x716e, 0x722b, 0x7422,
+	0x7891, 0x793e, 0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d,
+	0x798e, 0x7a40, 0x7a81, 0x7bc0, 0x7df4, 0x7e09, 0x7e41, 0x7f72,
+	0x8005, 0x81ed, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01,
+	0x8b39, 0x8cd3, 0x8d08, 0x8fb6, 0x9038, 0x96e3, 0x97ff, 0x983b,
+	0x6075, 0xd82d, 0x8218, 0x4e26, 0x51b5, 0x5168, 0x4f80, 0x5145,
+	0x5180, 0x52c7, 0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2, 0x585a,
+	0x58b3, 0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69,
+	0x5fad, 0x60d8, 0x614e, 0x6108, 0x618e, 0x6160, 0x61f2, 0x6234,
+	0x63c4, 0x641c, 0x6452, 0x6556, 0x6674, 0x6717, 0x671b, 0x6756,
+	0x6b79, 0x6bba, 0x6d41, 0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e,
+	0x77a7, 0x7235, 0x72af, 0x732a, 0x7471, 0x7506, 0x753b, 0x761d,
+	0x761f, 0x76ca, 0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1,
+	0x7bc0, 0x7c7b, 0x7d5b, 0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef,
+	0x8779, 0x8941, 0x8986, 0x8996, 0x8abf, 0x8af8, 0x8acb, 0x8b01,
+	0x8afe, 0x8aed, 0x8b39, 0x8b8a, 0x8d08, 0x8f38, 0x9072, 0x9199,
+	0x9276, 0x967c, 0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b,
+	0x9b12, 0x9f9c, 0xd82e, 0xd82f, 0xd830, 0x3b9d, 0x4018, 0x4039,
+	0xd831, 0xd832, 0xd833, 0x9f43, 0x9f8e, 0x05d9, 0xd834, 0x05f2,
+	0xd835, 0x05e9, 0xd836, 0x05e9, 0xd837, 0x05e9, 0xd838, 0xd836,
+	0x05e9, 0xd838, 0xd837, 0x05d0, 0xd835, 0x05d0, 0xd839, 0x05d0,
+	0xd838, 0x05d1, 0xd838, 0x05d2, 0xd838, 0x05d3, 0xd838, 0x05d4,
+	0xd838, 0x05d5, 0xd838, 0x05d6, 0xd838, 0x05d8, 0xd838, 0x05d9,
+	0xd838, 0x05da, 0xd838, 0x05db, 0xd838, 0x05dc, 0xd838, 0x05de,
+	0xd838, 0x05e0, 0xd838, 0x05e1, 0xd838, 0x05e3, 0xd838, 0x05e4,
+	0xd838, 0x05e6, 0xd838, 0x05e7, 0xd838, 0x05e8, 0xd838, 0x05e9,
+	0xd838, 0x05ea, 0xd838, 0x05d5, 0xd83a, 0x05d1, 0xd83b, 0x05db,
+	0xd83b, 0x05e4, 0xd83b, 0xd83c, 0xd83d, 0xd83e, 0xd83d, 0xd83f,
+	0xd83d, 0xd840, 0xd841, 0xd842, 0xd841, 0xd843, 0xd844, 0xd843,
+	0xd845, 0xd846, 0xd847, 0xd846, 0xd848, 0xd846, 0xd849, 0xd84a,
+	0xd84b, 0xd84c, 0xd84b, 0xd84d, 0xd84e, 0xd84f, 0xd84e, 0xd84f,
+	0xd84e, 0xd850, 0xd84f, 0xd84e, 0xd851, 0xd84f, 0xd84e, 0xd852,
+	0xd84f, 0xd84e, 0xd853, 0xd84f, 0xd84e, 0xd854, 0xd855, 0xd84e,
+	0xd856, 0xd84e, 0xd855, 0xd84e, 0xd850, 0xd856, 0xd84e, 0xd850,
+	0xd855, 0xd84e, 0xd851, 0xd856, 0xd84e, 0xd851, 0x4e3d, 0x4e38,
+	0x4e41, 0xd857, 0x4f60, 0x4fae, 0x4fbb, 0x5002, 0x507a, 0x5099,
+	0x50e7, 0x50cf, 0x349e, 0xd858, 0x514d, 0x5154, 0x5164, 0x5177,
+	0xd859, 0x34b9, 0x5167, 0x518d, 0xd85a, 0x5197, 0x51a4, 0x4ecc,
+	0x51ac, 0x51b5, 0xd85b, 0x51f5, 0x5203, 0x34df, 0x523b, 0x5246,
+	0x5272, 0x5277, 0x3515, 0x52c7, 0x52c9, 0x52e4, 0x52fa, 0x5305,
+	0x5306, 0x5317, 0x5349, 0x5351, 0x535a, 0x5373, 0x537d, 0x537f,
+	0x537f, 0x537f, 0xd85c, 0x7070, 0x53ca, 0x53df, 0xd85d, 0x53eb,
+	0x53f1, 0x5406, 0x549e, 0x5438, 0x5448, 0x5468, 0x54a2, 0x54f6,
+	0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55ab, 0x55b3,
+	0x55c2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58ee,
+	0x57ce, 0x57f4, 0x580d, 0x578b, 0x5832, 0x5831, 0x58ac, 0xd85e,
+	0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922, 0x5962, 0xd85f, 0xd860,
+	0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66, 0x36ee, 0x36fc, 0x5b08,
+	0x5b3e, 0x5b3e, 0xd861, 0x5bc3, 0x5bd8, 0x5be7, 0x5bf3, 0xd862,
+	0x5bff, 0x5c06, 0x5f53, 0x5c22, 0x3781, 0x5c60, 0x5c6e, 0x5cc0,
+	0x5c8d, 0xd863, 0x5d43, 0xd864, 0x5d6e, 0x5d6b, 0x5d7c, 0x5de1,
+	0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69, 0x3862, 0xd865,
+	0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca, 0xd866, 0x5efe, 0xd867,
+	0xd867, 0x8201, 0x5f22, 0x5f22, 0x38c7, 0xd868, 0xd869, 0x5f62,
+	0x5f6b, 0x38e3, 0x5f9a, 0x5fcd, 0x5fd7, 0x5ff9, 0x6081, 0x393a,
+	0x391c, 0x6094, 0xd86a, 0x60c7, 0x6148, 0x614c, 0x614e, 0x614c,
+	0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af, 0x61de, 0x61f2, 0x61f6,
+	0x6210, 0x621b, 0x625d, 0x62b1, 0x62d4, 0x6350, 0xd86b, 0x633d,
+	0x62fc, 0x6368, 0x6383, 0x63e4, 0xd86c, 0x6422, 0x63c5, 0x63a9,
+	0x3a2e, 0x6469, 0x647e, 0x649d, 0x6477, 0x3a6c, 0x654f, 0x656c,
+	0xd86d, 0x65e3, 0x66f8, 0x6649, 0x3b19, 0x6691, 0x3b08, 0x3ae4,
+	0x5192, 0x5195, 0x6700, 0x669c, 0x80ad, 0x43d9, 0x6717, 0x671b,
+	0x6721, 0x675e, 0x6753, 0xd86e, 0x3b49, 0x67fa, 0x6785, 0x6852,
+	0x6885, 0xd86f, 0x688e, 0x681f, 0x6914, 0x3b9d, 0x6942, 0x69a3,
+	0x69ea, 0x6aa8, 0xd870, 0x6adb, 0x3c18, 0x6b21, 0xd871, 0x6b54,
+	0x3c4e, 0x6b72, 0x6b9f, 0x6bba, 0x6bbb, 0xd872, 0xd873, 0xd874,
+	0x6c4e, 0xd875, 0x6cbf, 0x6ccd, 0x6c67, 0x6d16, 0x6d3e, 0x6d77,
+	0x6d41, 0x6d69, 0x6d78, 0x6d85, 0xd876, 0x6d34, 0x6e2f, 0x6e6e,
+	0x3d33, 0x6ecb, 0x6ec7, 0xd877, 0x6df9, 0x6f6e, 0xd878, 0xd879,
+	0x6fc6, 0x7039, 0x701e, 0x701b, 0x3d96, 0x704a, 0x707d, 0x7077,
+	0x70ad, 0xd87a, 0x7145, 0xd87b, 0x719c, 0xd87c, 0x7228, 0x7235,
+	0x7250, 0xd87d, 0x7280, 0x7295, 0xd87e, 0xd87f, 0x737a, 0x738b,
+	0x3eac, 0x73a5, 0x3eb8, 0x3eb8, 0x7447, 0x745c, 0x7471, 0x7485,
+	0x74ca, 0x3f1b, 0x7524, 0xd880, 0x753e, 0xd881, 0x7570, 0xd882,
+	0x7610, 0xd883, 0xd884, 0xd885, 0x3ffc, 0x4008, 0x76f4, 0xd886,
+	0xd887, 0xd888, 0xd889, 0x771e, 0x771f, 0x771f, 0x774a, 0x4039,
+	0x778b, 0x4046, 0x4096, 0xd88a, 0x784e, 0x788c, 0x78cc, 0x40e3,
+	0xd88b, 0x7956, 0xd88c, 0xd88d, 0x798f, 0x79eb, 0x412f, 0x7a40,
+	0x7a4a, 0x7a4f, 0xd88e, 0xd88f, 0xd88f, 0x7aee, 0x4202, 0xd890,
+	0x7bc6, 0x7bc9, 0x4227, 0xd891, 0x7cd2, 0x42a0, 0x7ce8, 0x7ce3,
+	0x7d00, 0xd892, 0x7d63, 0x4301, 0x7dc7, 0x7e02, 0x7e45, 0x4334,
+	0xd893, 0xd894, 0x4359, 0xd895, 0x7f7a, 0xd896, 0x7f95, 0x7ffa,
+	0x8005, 0xd897, 0xd898, 0x8060, 0xd899, 0x8070, 0xd89a, 0x43d5,
+	0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5, 0xd89b, 0xd89c, 0xd89d,
+	0xd89e, 0x8201, 0x8204, 0x8f9e, 0x446b, 0x8291, 0x828b, 0x829d,
+	0x52b3, 0x82b1, 0x82b3, 0x82bd, 0x82e6, 0xd89f, 0x82e5, 0x831d,
+	0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7, 0x8457, 0x8353, 0x83ca,
+	0x83cc, 0x83dc, 0xd8a0, 0xd8a1, 0xd8a2, 0x452b, 0x84f1, 0x84f3,
+	0x8516, 0xd8a3, 0x8564, 0xd8a4, 0x455d, 0x4561, 0xd8a5, 0xd8a6,
+	0x456b, 0x8650, 0x865c, 0x8667, 0x8669, 0x86a9, 0x8688, 0x870e,
+	0x86e2, 0x8779, 0x8728, 0x876b, 0x8786, 0x45d7, 0x87e1, 0x8801,
+	0x45f9, 0x8860, 0x8863, 0xd8a7, 0x88d7, 0x88de, 0x4635, 0x88fa,
+	0x34bb, 0xd8a8, 0xd8a9, 0x46be, 0x46c7, 0x8aa0, 0x8aed, 0x8b8a,
+	0x8c55, 0xd8aa, 0x8cab, 0x8cc1, 0x8d1b, 0x8d77, 0xd8ab, 0xd8ac,
+	0x8dcb, 0x8dbc, 0x8df0, 0xd8ad, 0x8ed4, 0x8f38, 0xd8ae, 0xd8af,
+	0x9094, 0x90f1, 0x9111, 0xd8b0, 0x911b, 0x9238, 0x92d7, 0x92d8,
+	0x927c, 0x93f9, 0x9415, 0xd8b1, 0x958b, 0x4995, 0x95b7, 0xd8b2,
+	0x49e6, 0x96c3, 0x5db2, 0x9723, 0xd8b3, 0xd8b4, 0x4a6e, 0x4a76,
+	0x97e0, 0xd8b5, 0x4ab2, 0xd8b6, 0x980b, 0x980b, 0x9829, 0xd8b7,
+	0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2, 0x99fe, 0x4bce, 0xd8b8,
+	0x9b12, 0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67, 0xd8b9, 0x4cf8,
+	0xd8ba, 0xd8bb, 0xd8bc, 0x9ebb, 0x4d56, 0x9ef9, 0x9efe, 0x9f05,
+	0x9f0f, 0x9f16, 0x9f3b, 0xd8bd,
+};
+
+static const u32 apfs_nfd_esc[] __aligned(64) = {
+	0x00000000,
+};
+
+static const u16 apfs_nfdcf[] __aligned(64) = {
+	0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+	0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070,
+	0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+	0x0079, 0x007a, 0x03bc, 0x0061, 0xd800, 0x0061, 0xd801, 0x0061,
+	0xd802, 0x0061, 0xd803, 0x0061, 0xd804, 0x0061, 0xd805, 0x00e6,
+	0x0063, 0xd806, 0x0065, 0xd800, 0x0065, 0xd801, 0x0065, 0xd802,
+	0x0065, 0xd804, 0x0069, 0xd800, 0x0069, 0xd801, 0x0069, 0xd802,
+	0x0069, 0xd804, 0x00f0, 0x006e, 0xd803, 0x006f, 0xd800, 0x006f,
+	0xd801, 0x006f, 0xd802, 0x006f, 0xd803, 0x006f, 0xd804, 0x00f8,
+	0x0075, 0xd800, 0x0075, 0xd801, 0x0075, 0xd802, 0x0075, 0xd804,
+	0x0079, 0xd801, 0x00fe, 0x0073, 0x0073, 0x0061, 0xd800, 0x0061,
+	0xd801, 0x0061, 0xd802, 0x0061, 0xd803, 0x0061, 0xd804, 0x0061,
+	0xd805, 0x0063, 0xd806, 0x0065, 0xd800, 0x0065, 0xd801, 0x0065,
+	0xd802, 0x0065, 0xd804, 0x0069, 0xd800, 0x0069, 0xd801, 0x0069,
+	0xd802, 0x0069, 0xd804, 0x006e, 0xd803, 0x006f, 0xd800, 0x006f,
+	0xd801, 0x006f, 0xd802, 0x006f, 0xd803, 0x006f, 0xd804, 0x0075,
+	0xd800, 0x0075, 0xd801, 0x0075, 0xd802, 0x0075, 0xd804, 0x0079,
+	0xd801, 0x0079, 0xd804, 0x0061, 0xd807, 0x0061, 0xd807, 0x0061,
+	0xd808, 0x0061, 0xd808, 0x0061, 0xd809, 0x0061, 0xd809, 0x0063,
+	0xd801, 0x0063, 0xd801, 0x0063, 0xd802, 0x0063, 0xd802, 0x0063,
+	0xd80a, 0x0063, 0xd80a, 0x0063, 0xd80b, 0x0063, 0xd80b, 0x0064,
+	0xd80b, 0x0064, 0xd80b, 0x0111, 0x0065, 0xd807, 0x0065, 0xd807,
+	0x0065, 0xd808, 0x0065, 0xd808, 0x0065, 0xd80a, 0x0065, 0xd80a,
+	0x0065, 0xd809, 0x0065, 0xd809, 0x0065, 0xd80b, 0x0065, 0xd80b,
+	0x0067, 0xd802, 0x0067, 0xd802, 0x0067, 0xd808, 0x0067, 0xd808,
+	0x0067, 0xd80a, 0x0067, 0xd80a, 0x0067, 0xd806, 0x0067, 0xd806,
+	0x0068, 0xd802, 0x0068, 0xd802, 0x0127, 0x0069, 0xd803, 0x0069,
+	0xd803, 0x0069, 0xd807, 0x0069, 0xd807, 0x0069, 0xd808, 0x0069,
+	0xd808, 0x0069, 0xd809, 0x0069, 0xd809, 0x0069, 0xd80a, 0x0133,
+	0x006a, 0xd802, 0x006a, 0xd802, 0x006b, 0xd806, 0x006b, 0xd806,
+	0x006c, 0xd801, 0x006c, 0xd801, 0x006c, 0xd806, 0x006c, 0xd806,
+	0x006c, 0xd80b, 0x006c, 0xd80b, 0x0140, 0x0142, 0x006e, 0xd801,
+	0x006e, 0xd801, 0x006e, 0xd806, 0x006e, 0xd806, 0x006e, 0xd80b,
+	0x006e, 0xd80b, 0x02bc, 0x006e, 0x014b, 0x006f, 0xd807, 0x006f,
+	0xd807, 0x006f, 0xd808, 0x006f, 0xd808, 0x006f, 0xd80c, 0x006f,
+	0xd80c, 0x0153, 0x0072, 0xd801, 0x0072, 0xd801, 0x0072, 0xd806,
+	0x0072, 0xd806, 0x0072, 0xd80b, 0x0072, 0xd80b, 0x0073, 0xd801,
+	0x0073, 0xd801, 0x0073, 0xd802, 0x0073, 0xd802, 0x0073, 0xd806,
+	0x0073, 0xd806, 0x0073, 0xd80b, 0x0073, 0xd80b, 0x0074, 0xd806,
+	0x0074, 0xd806, 0x0074, 0xd80b, 0x0074, 0xd80b, 0x0167, 0x0075,
+	0xd803, 0x0075, 0xd803, 0x0075, 0xd807, 0x0075, 0xd807, 0x0075,
+	0xd808, 0x0075, 0xd808, 0x0075, 0xd805, 0x0075, 0xd805, 0x0075,
+	0xd80c, 0x0075, 0xd80c, 0x0075, 0xd809, 0x0075, 0xd809, 0x0077,
+	0xd802, 0x0077, 0xd802, 0x0079, 0xd802, 0x0079, 0xd802, 0x0079,
+	0xd804, 0x007a, 0xd801, 0x007a, 0xd801, 0x007a, 0xd80a, 0x007a,
+	0xd80a, 0x007a, 0xd80b, 0x007a, 0xd80b, 0x0073, 0x0253, 0x0183,
+	0x0185, 0x0254, 0x0188, 0x0256, 0x0257, 0x018c, 0x01dd, 0x0259,
+	0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f,
+	0x0272, 0x0275, 0x006f, 0xd80d, 0x006f, 0xd80d, 0x01a3, 0x01a5,
+	0x0280, 0x01a8, 0x0283, 0x01ad, 0x0288, 0x0075, 0xd80d, 0x0075,
+	0xd80d, 0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292, 0x01b9, 0x01bd,
+	0x01c6, 0x01c6, 0x01c9, 0x01c9, 0x01cc, 0x01cc, 0x0061, 0xd80b,
+	0x0061, 0xd80b, 0x0069, 0xd80b, 0x0069, 0xd80b, 0x006f, 0xd80b,
+	0x006f, 0xd80b, 0x0075, 0xd80b, 0x0075, 0xd80b, 0x0075, 0xd804,
+	0xd807, 0x0075, 0xd804, 0xd807, 0x0075, 0xd804, 0xd801, 0x0075,
+	0xd804, 0xd801, 0x0075, 0xd804, 0xd80b, 0x0075, 0xd804, 0xd80b,
+	0x0075, 0xd804, 0xd800, 0x0075, 0xd804, 0xd800, 0x0061, 0xd804,
+	0xd807, 0x0061, 0xd804, 0xd807, 0x0061, 0xd80a, 0xd807, 0x0061,
+	0xd80a, 0xd807, 0x00e6, 0xd807, 0x00e6, 0xd807, 0x01e5, 0x0067,
+	0xd80b, 0x0067, 0xd80b, 0x006b, 0xd80b, 0x006b, 0xd80b, 0x006f,
+	0xd809, 0x006f, 0xd809, 0x006f, 0xd809, 0xd807, 0x006f, 0xd809,
+	0xd807, 0x0292, 0xd80b, 0x0292, 0xd80b, 0x006a, 0xd80b, 0x01f3,
+	0x01f3, 0x0067, 0xd801, 0x0067, 0xd801, 0x0195, 0x01bf, 0x006e,
+	0xd800, 0x006e, 0xd800, 0x0061, 0xd805, 0xd801, 0x0061, 0xd805,
+	0xd801, 0x00e6, 0xd801, 0x00e6, 0xd801, 0x00f8, 0xd801, 0x00f8,
+	0xd801, 0x0061, 0xd80e, 0x0061, 0xd80e, 0x0061, 0xd80f, 0x0061,
+	0xd80f, 0x0065, 0xd80e, 0x0065, 0xd80e, 0x0065, 0xd80f, 0x0065,
+	0xd80f, 0x0069, 0xd80e, 0x0069, 0xd80e, 0x0069, 0xd80f, 0x0069,
+	0xd80f, 0x006f, 0xd80e, 0x006f, 0xd80e, 0x006f, 0xd80f, 0x006f,
+	0xd80f, 0x0072, 0xd80e, 0x0072, 0xd80e, 0x0072, 0xd80f, 0x0072,
+	0xd80f, 0x0075, 0xd80e, 0x0075, 0xd80e, 0x0075, 0xd80f, 0x0075,
+	0xd80f, 0x0073, 0xd810, 0x0073, 0xd810, 0x0074, 0xd810, 0x0074,
+	0xd810, 0x021d, 0x0068, 0xd80b, 0x0068, 0xd80b, 0x019e, 0x0223,
+	0x0225, 0x0061, 0xd80a, 0x0061, 0xd80a, 0x0065, 0xd806, 0x0065,
+	0xd806, 0x006f, 0xd804, 0xd807, 0x006f, 0xd804, 0xd807, 0x006f,
+	0xd803, 0xd807, 0x006f, 0xd803, 0xd807, 0x006f, 0xd80a, 0x006f,
+	0xd80a, 0x006f, 0xd80a, 0xd807, 0x006f, 0xd80a, 0xd807, 0x0079,
+	0xd807, 0x0079, 0xd807, 0x2c65, 0x023c, 0x019a, 0x2c66, 0x0242,
+	0x0180, 0x0289, 0x028c, 0x0247, 0x0249, 0x024b, 0x024d, 0x024f,
+	0xd800, 0xd801, 0xd811, 0xd804, 0xd801, 0x03b9, 0x0371, 0x0373,
+	0x02b9, 0x0377, 0x003b, 0x03f3, 0x00a8, 0xd801, 0x03b1, 0xd801,
+	0x00b7, 0x03b5, 0xd801, 0x03b7, 0xd801, 0x03b9, 0xd801, 0x03bf,
+	0xd801, 0x03c5, 0xd801, 0x03c9, 0xd801, 0x03b9, 0xd804, 0xd801,
+	0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8,
+	0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0,
+	0x03c1, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9,
+	0x03b9, 0xd804, 0x03c5, 0xd804, 0x03b1, 0xd801, 0x03b5, 0xd801,
+	0x03b7, 0xd801, 0x03b9, 0xd801, 0x03c5, 0xd804, 0xd801, 0x03c3,
+	0x03b9, 0xd804, 0x03c5, 0xd804, 0x03bf, 0xd801, 0x03c5, 0xd801,
+	0x03c9, 0xd801, 0x03d7, 0x03b2, 0x03b8, 0x03d2, 0xd801, 0x03d2,
+	0xd804, 0x03c6, 0x03c0, 0x03d9, 0x03db, 0x03dd, 0x03df, 0x03e1,
+	0x03e3, 0x03e5, 0x03e7, 0x03e9, 0x03eb, 0x03ed, 0x03ef, 0x03ba,
+	0x03c1, 0x03b8, 0x03b5, 0x03f8, 0x03f2, 0x03fb, 0x037b, 0x037c,
+	0x037d, 0x0435, 0xd800, 0x0435, 0xd804, 0x0452, 0x0433, 0xd801,
+	0x0454, 0x0455, 0x0456, 0x0456, 0xd804, 0x0458, 0x0459, 0x045a,
+	0x045b, 0x043a, 0xd801, 0x0438, 0xd800, 0x0443, 0xd808, 0x045f,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+	0x0438, 0x0438, 0xd808, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e,
+	0x043f, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446,
+	0x0447, 0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e,
+	0x044f, 0x0438, 0xd808, 0x0435, 0xd800, 0x0435, 0xd804, 0x0433,
+	0xd801, 0x0456, 0xd804, 0x043a, 0xd801, 0x0438, 0xd800, 0x0443,
+	0xd808, 0x0461, 0x0463, 0x0465, 0x0467, 0x0469, 0x046b, 0x046d,
+	0x046f, 0x0471, 0x0473, 0x0475, 0x0475, 0xd80e, 0x0475, 0xd80e,
+	0x0479, 0x047b, 0x047d, 0x047f, 0x0481, 0x048b, 0x048d, 0x048f,
+	0x0491, 0x0493, 0x0495, 0x0497, 0x0499, 0x049b, 0x049d, 0x049f,
+	0x04a1, 0x04a3, 0x04a5, 0x04a7, 0x04a9, 0x04ab, 0x04ad, 0x04af,
+	0x04b1, 0x04b3, 0x04b5, 0x04b7, 0x04b9, 0x04bb, 0x04bd, 0x04bf,
+	0x04cf, 0x0436, 0xd808, 0x0436, 0xd808, 0x04c4, 0x04c6, 0x04c8,
+	0x04ca, 0x04cc, 0x04ce, 0x0430, 0xd808, 0x0430, 0xd808, 0x0430,
+	0xd804, 0x0430, 0xd804, 0x04d5, 0x0435, 0xd808, 0x0435, 0xd808,
+	0x04d9, 0x04d9, 0xd804, 0x04d9, 0xd804, 0x0436, 0xd804, 0x0436,
+	0xd804, 0x0437, 0xd804, 0x0437, 0xd804, 0x04e1, 0x0438, 0xd807,
+	0x0438, 0xd807, 0x0438, 0xd804, 0x0438, 0xd804, 0x043e, 0xd804,
+	0x043e, 0xd804, 0x04e9, 0x04e9, 0xd804, 0x04e9, 0xd804, 0x044d,
+	0xd804, 0x044d, 0xd804, 0x0443, 0xd807, 0x0443, 0xd807, 0x0443,
+	0xd804, 0x0443, 0xd804, 0x0443, 0xd80c, 0x0443, 0xd80c, 0x0447,
+	0xd804, 0x0447, 0xd804, 0x04f7, 0x044b, 0xd804, 0x044b, 0xd804,
+	0x04fb, 0x04fd, 0x04ff, 0x0501, 0x0503, 0x0505, 0x0507, 0x0509,
+	0x050b, 0x050d, 0x050f, 0x0511, 0x0513, 0x0515, 0x0517, 0x0519,
+	0x051b, 0x051d, 0x051f, 0x0521, 0x0523, 0x0525, 0x0527, 0x0529,
+	0x052b, 0x052d, 0x052f, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565,
+	0x0566, 0x0567, 0x0568, 0x0569, 0x056a, 0x056b, 0x056c, 0x056d,
+	0x056e, 0x056f, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575,
+	0x0576, 0x0577, 0x0578, 0x0579, 0x057a, 0x057b, 0x057c, 0x057d,
+	0x057e, 0x057f, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585,
+	0x0586, 0x0565, 0x0582, 0x0627, 0xd812, 0x0627, 0xd813, 0x0648,
+	0xd813, 0x0627, 0xd814, 0x064a, 0xd813, 0x06d5, 0xd813, 0x06c1,
+	0xd813, 0x06d2, 0xd813, 0x0928, 0xd815, 0x0930, 0xd815, 0x0933,
+	0xd815, 0x0915, 0xd815, 0x0916, 0xd815, 0x0917, 0xd815, 0x091c,
+	0xd815, 0x0921, 0xd815, 0x0922, 0xd815, 0x092b, 0xd815, 0x092f,
+	0xd815, 0x09c7, 0x09be, 0x09c7, 0x09d7, 0x09a1, 0xd816, 0x09a2,
+	0xd816, 0x09af, 0xd816, 0x0a32, 0xd817, 0x0a38, 0xd817, 0x0a16,
+	0xd817, 0x0a17, 0xd817, 0x0a1c, 0xd817, 0x0a2b, 0xd817, 0x0b47,
+	0x0b56, 0x0b47, 0x0b3e, 0x0b47, 0x0b57, 0x0b21, 0xd818, 0x0b22,
+	0xd818, 0x0b92, 0x0bd7, 0x0bc6, 0x0bbe, 0x0bc7, 0x0bbe, 0x0bc6,
+	0x0bd7, 0x0c46, 0xd819, 0x0cbf, 0x0cd5, 0x0cc6, 0x0cd5, 0x0cc6,
+	0x0cd6, 0x0cc6, 0x0cc2, 0x0cc6, 0x0cc2, 0x0cd5, 0x0d46, 0x0d3e,
+	0x0d47, 0x0d3e, 0x0d46, 0x0d57, 0x0dd9, 0xd81a, 0x0dd9, 0x0dcf,
+	0x0dd9, 0x0dcf, 0xd81a, 0x0dd9, 0x0ddf, 0x0f42, 0x0fb7, 0x0f4c,
+	0x0fb7, 0x0f51, 0x0fb7, 0x0f56, 0x0fb7, 0x0f5b, 0x0fb7, 0x0f40,
+	0x0fb5, 0xd81b, 0xd81c, 0xd81b, 0xd81d, 0x0fb2, 0xd81e, 0x0fb3,
+	0xd81e, 0xd81b, 0xd81e, 0x0f92, 0x0fb7, 0x0f9c, 0x0fb7, 0x0fa1,
+	0x0fb7, 0x0fa6, 0x0fb7, 0x0fab, 0x0fb7, 0x0f90, 0x0fb5, 0x1025,
+	0x102e, 0x2d00, 0x2d01, 0x2d02, 0x2d03, 0x2d04, 0x2d05, 0x2d06,
+	0x2d07, 0x2d08, 0x2d09, 0x2d0a, 0x2d0b, 0x2d0c, 0x2d0d, 0x2d0e,
+	0x2d0f, 0x2d10, 0x2d11, 0x2d12, 0x2d13, 0x2d14, 0x2d15, 0x2d16,
+	0x2d17, 0x2d18, 0x2d19, 0x2d1a, 0x2d1b, 0x2d1c, 0x2d1d, 0x2d1e,
+	0x2d1f, 0x2d20, 0x2d21, 0x2d22, 0x2d23, 0x2d24, 0x2d25, 0x2d27,
+	0x2d2d, 0x13f0, 0x13f1, 0x13f2, 0x13f3, 0x13f4, 0x13f5, 0x1b05,
+	0x1b35, 0x1b07, 0x1b35, 0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d,
+	0x1b35, 0x1b11, 0x1b35, 0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e,
+	0x1b35, 0x1b3f, 0x1b35, 0x1b42, 0x1b35, 0x0432, 0x0434, 0x043e,
+	0x0441, 0x0442, 0x0442, 0x044a, 0x0463, 0xa64b, 0x0061, 0xd81f,
+	0x0061, 0xd81f, 0x0062, 0xd80a, 0x0062, 0xd80a, 0x0062, 0xd820,
+	0x0062, 0xd820, 0x0062, 0xd821, 0x0062, 0xd821, 0x0063, 0xd806,
+	0xd801, 0x0063, 0xd806, 0xd801, 0x0064, 0xd80a, 0x0064, 0xd80a,
+	0x0064, 0xd820, 0x0064, 0xd820, 0x0064, 0xd821, 0x0064, 0xd821,
+	0x0064, 0xd806, 0x0064, 0xd806, 0x0064, 0xd822, 0x0064, 0xd822,
+	0x0065, 0xd807, 0xd800, 0x0065, 0xd807, 0xd800, 0x0065, 0xd807,
+	0xd801, 0x0065, 0xd807, 0xd801, 0x0065, 0xd822, 0x0065, 0xd822,
+	0x0065, 0xd823, 0x0065, 0xd823, 0x0065, 0xd806, 0xd808, 0x0065,
+	0xd806, 0xd808, 0x0066, 0xd80a, 0x0066, 0xd80a, 0x0067, 0xd807,
+	0x0067, 0xd807, 0x0068, 0xd80a, 0x0068, 0xd80a, 0x0068, 0xd820,
+	0x0068, 0xd820, 0x0068, 0xd804, 0x0068, 0xd804, 0x0068, 0xd806,
+	0x0068, 0xd806, 0x0068, 0xd824, 0x0068, 0xd824, 0x0069, 0xd823,
+	0x0069, 0xd823, 0x0069, 0xd804, 0xd801, 0x0069, 0xd804, 0xd801,
+	0x006b, 0xd801, 0x006b, 0xd801, 0x006b, 0xd820, 0x006b, 0xd820,
+	0x006b, 0xd821, 0x006b, 0xd821, 0x006c, 0xd820, 0x006c, 0xd820,
+	0x006c, 0xd820, 0xd807, 0x006c, 0xd820, 0xd807, 0x006c, 0xd821,
+	0x006c, 0xd821, 0x006c, 0xd822, 0x006c, 0xd822, 0x006d, 0xd801,
+	0x006d, 0xd801, 0x006d, 0xd80a, 0x006d, 0xd80a, 0x006d, 0xd820,
+	0x006d, 0xd820, 0x006e, 0xd80a, 0x006e, 0xd80a, 0x006e, 0xd820,
+	0x006e, 0xd820, 0x006e, 0xd821, 0x006e, 0xd821, 0x006e, 0xd822,
+	0x006e, 0xd822, 0x006f, 0xd803, 0xd801, 0x006f, 0xd803, 0xd801,
+	0x006f, 0xd803, 0xd804, 0x006f, 0xd803, 0xd804, 0x006f, 0xd807,
+	0xd800, 0x006f, 0xd807, 0xd800, 0x006f, 0xd807, 0xd801, 0x006f,
+	0xd807, 0xd801, 0x0070, 0xd801, 0x0070, 0xd801, 0x0070, 0xd80a,
+	0x0070, 0xd80a, 0x0072, 0xd80a, 0x0072, 0xd80a, 0x0072, 0xd820,
+	0x0072, 0xd820, 0x0072, 0xd820, 0xd807, 0x0072, 0xd820, 0xd807,
+	0x0072, 0xd821, 0x0072, 0xd821, 0x0073, 0xd80a, 0x0073, 0xd80a,
+	0x0073, 0xd820, 0x0073, 0xd820, 0x0073, 0xd801, 0xd80a, 0x0073,
+	0xd801, 0xd80a, 0x0073, 0xd80b, 0xd80a, 0x0073, 0xd80b, 0xd80a,
+	0x0073, 0xd820, 0xd80a, 0x0073, 0xd820, 0xd80a, 0x0074, 0xd80a,
+	0x0074, 0xd80a, 0x0074, 0xd820, 0x0074, 0xd820, 0x0074, 0xd821,
+	0x0074, 0xd821, 0x0074, 0xd822, 0x0074, 0xd822, 0x0075, 0xd825,
+	0x0075, 0xd825, 0x0075, 0xd823, 0x0075, 0xd823, 0x0075, 0xd822,
+	0x0075, 0xd822, 0x0075, 0xd803, 0xd801, 0x0075, 0xd803, 0xd801,
+	0x0075, 0xd807, 0xd804, 0x0075, 0xd807, 0xd804, 0x0076, 0xd803,
+	0x0076, 0xd803, 0x0076, 0xd820, 0x0076, 0xd820, 0x0077, 0xd800,
+	0x0077, 0xd800, 0x0077, 0xd801, 0x0077, 0xd801, 0x0077, 0xd804,
+	0x0077, 0xd804, 0x0077, 0xd80a, 0x0077, 0xd80a, 0x0077, 0xd820,
+	0x0077, 0xd820, 0x0078, 0xd80a, 0x0078, 0xd80a, 0x0078, 0xd804,
+	0x0078, 0xd804, 0x0079, 0xd80a, 0x0079, 0xd80a, 0x007a, 0xd802,
+	0x007a, 0xd802, 0x007a, 0xd820, 0x007a, 0xd820, 0x007a, 0xd821,
+	0x007a, 0xd821, 0x0068, 0xd821, 0x0074, 0xd804, 0x0077, 0xd805,
+	0x0079, 0xd805, 0x0061, 0x02be, 0x0073, 0xd80a, 0x0073, 0x0073,
+	0x0061, 0xd820, 0x0061, 0xd820, 0x0061, 0xd826, 0x0061, 0xd826,
+	0x0061, 0xd802, 0xd801, 0x0061, 0xd802, 0xd801, 0x0061, 0xd802,
+	0xd800, 0x0061, 0xd802, 0xd800, 0x0061, 0xd802, 0xd826, 0x0061,
+	0xd802, 0xd826, 0x0061, 0xd802, 0xd803, 0x0061, 0xd802, 0xd803,
+	0x0061, 0xd820, 0xd802, 0x0061, 0xd820, 0xd802, 0x0061, 0xd808,
+	0xd801, 0x0061, 0xd808, 0xd801, 0x0061, 0xd808, 0xd800, 0x0061,
+	0xd808, 0xd800, 0x0061, 0xd808, 0xd826, 0x0061, 0xd808, 0xd826,
+	0x0061, 0xd808, 0xd803, 0x0061, 0xd808, 0xd803, 0x0061, 0xd820,
+	0xd808, 0x0061, 0xd820, 0xd808, 0x0065, 0xd820, 0x0065, 0xd820,
+	0x0065, 0xd826, 0x0065, 0xd826, 0x0065, 0xd803, 0x0065, 0xd803,
+	0x0065, 0xd802, 0xd801, 0x0065, 0xd802, 0xd801, 0x0065, 0xd802,
+	0xd800, 0x0065, 0xd802, 0xd800, 0x0065, 0xd802, 0xd826, 0x0065,
+	0xd802, 0xd826, 0x0065, 0xd802, 0xd803, 0x0065, 0xd802, 0xd803,
+	0x0065, 0xd820, 0xd802, 0x0065, 0xd820, 0xd802, 0x0069, 0xd826,
+	0x0069, 0xd826, 0x0069, 0xd820, 0x0069, 0xd820, 0x006f, 0xd820,
+	0x006f, 0xd820, 0x006f, 0xd826, 0x006f, 0xd826, 0x006f, 0xd802,
+	0xd801, 0x006f, 0xd802, 0xd801, 0x006f, 0xd802, 0xd800, 0x006f,
+	0xd802, 0xd800, 0x006f, 0xd802, 0xd826, 0x006f, 0xd802, 0xd826,
+	0x006f, 0xd802, 0xd803, 0x006f, 0xd802, 0xd803, 0x006f, 0xd820,
+	0xd802, 0x006f, 0xd820, 0xd802, 0x006f, 0xd80d, 0xd801, 0x006f,
+	0xd80d, 0xd801, 0x006f, 0xd80d, 0xd800, 0x006f, 0xd80d, 0xd800,
+	0x006f, 0xd80d, 0xd826, 0x006f, 0xd80d, 0xd826, 0x006f, 0xd80d,
+	0xd803, 0x006f, 0xd80d, 0xd803, 0x006f, 0xd80d, 0xd820, 0x006f,
+	0xd80d, 0xd820, 0x0075, 0xd820, 0x0075, 0xd820, 0x0075, 0xd826,
+	0x0075, 0xd826, 0x0075, 0xd80d, 0xd801, 0x0075, 0xd80d, 0xd801,
+	0x0075, 0xd80d, 0xd800, 0x0075, 0xd80d, 0xd800, 0x0075, 0xd80d,
+	0xd826, 0x0075, 0xd80d, 0xd826, 0x0075, 0xd80d, 0xd803, 0x0075,
+	0xd80d, 0xd803, 0x0075, 0xd80d, 0xd820, 0x0075, 0xd80d, 0xd820,
+	0x0079, 0xd800, 0x0079, 0xd800, 0x0079, 0xd820, 0x0079, 0xd820,
+	0x0079, 0xd826, 0x0079, 0xd826, 0x0079, 0xd803, 0x0079, 0xd803,
+	0x1efb, 0x1efd, 0x1eff, 0x03b1, 0xd811, 0x03b1, 0xd827, 0x03b1,
+	0xd811, 0xd800, 0x03b1, 0xd827, 0xd800, 0x03b1, 0xd811, 0xd801,
+	0x03b1, 0xd827, 0xd801, 0x03b1, 0xd811, 0xd828, 0x03b1, 0xd827,
+	0xd828, 0x03b1, 0xd811, 0x03b1, 0xd827, 0x03b1, 0xd811, 0xd800,
+	0x03b1, 0xd827, 0xd800, 0x03b1, 0xd811, 0xd801, 0x03b1, 0xd827,
+	0xd801, 0x03b1, 0xd811, 0xd828, 0x03b1, 0xd827, 0xd828, 0x03b5,
+	0xd811, 0x03b5, 0xd827, 0x03b5, 0xd811, 0xd800, 0x03b5, 0xd827,
+	0xd800, 0x03b5, 0xd811, 0xd801, 0x03b5, 0xd827, 0xd801, 0x03b5,
+	0xd811, 0x03b5, 0xd827, 0x03b5, 0xd811, 0xd800, 0x03b5, 0xd827,
+	0xd800, 0x03b5, 0xd811, 0xd801, 0x03b5, 0xd827, 0xd801, 0x03b7,
+	0xd811, 0x03b7, 0xd827, 0x03b7, 0xd811, 0xd800, 0x03b7, 0xd827,
+	0xd800, 0x03b7, 0xd811, 0xd801, 0x03b7, 0xd827, 0xd801, 0x03b7,
+	0xd811, 0xd828, 0x03b7, 0xd827, 0xd828, 0x03b7, 0xd811, 0x03b7,
+	0xd827, 0x03b7, 0xd811, 0xd800, 0x03b7, 0xd827, 0xd800, 0x03b7,
+	0xd811, 0xd801, 0x03b7, 0xd827, 0xd801, 0x03b7, 0xd811, 0xd828,
+	0x03b7, 0xd827, 0xd828, 0x03b9, 0xd811, 0x03b9, 0xd827, 0x03b9,
+	0xd811, 0xd800, 0x03b9, 0xd827, 0xd800, 0x03b9, 0xd811, 0xd801,
+	0x03b9, 0xd827, 0xd801, 0x03b9, 0xd811, 0xd828, 0x03b9, 0xd827,
+	0xd828, 0x03b9, 0xd811, 0x03b9, 0xd827, 0x03b9, 0xd811, 0xd800,
+	0x03b9, 0xd827, 0xd800, 0x03b9, 0xd811, 0xd801, 0x03b9, 0xd827,
+	0xd801, 0x03b9, 0xd811, 0xd828, 0x03b9, 0xd827, 0xd828, 0x03bf,
+	0xd811, 0x03bf, 0xd827, 0x03bf, 0xd811, 0xd800, 0x03bf, 0xd827,
+	0xd800, 0x03bf, 0xd811, 0xd801, 0x03bf, 0xd827, 0xd801, 0x03bf,
+	0xd811, 0x03bf, 0xd827, 0x03bf, 0xd811, 0xd800, 0x03bf, 0xd827,
+	0xd800, 0x03bf, 0xd811, 0xd801, 0x03bf, 0xd827, 0xd801, 0x03c5,
+	0xd811, 0x03c5, 0xd827, 0x03c5, 0xd811, 0xd800, 0x03c5, 0xd827,
+	0xd800, 0x03c5, 0xd811, 0xd801, 0x03c5, 0xd827, 0xd801, 0x03c5,
+	0xd811, 0xd828, 0x03c5, 0xd827, 0xd828, 0x03c5, 0xd827, 0x03c5,
+	0xd827, 0xd800, 0x03c5, 0xd827, 0xd801, 0x03c5, 0xd827, 0xd828,
+	0x03c9, 0xd811, 0x03c9, 0xd827, 0x03c9, 0xd811, 0xd800, 0x03c9,
+	0xd827, 0xd800, 0x03c9, 0xd811, 0xd801, 0x03c9, 0xd827, 0xd801,
+	0x03c9, 0xd811, 0xd828, 0x03c9, 0xd827, 0xd828, 0x03c9, 0xd811,
+	0x03c9, 0xd827, 0x03c9, 0xd811, 0xd800, 0x03c9, 0xd827, 0xd800,
+	0x03c9, 0xd811, 0xd801, 0x03c9, 0xd827, 0xd801, 0x03c9, 0xd811,
+	0xd828, 0x03c9, 0xd827, 0xd828, 0x03b1, 0xd800, 0x03b1, 0xd801,
+	0x03b5, 0xd800, 0x03b5, 0xd801, 0x03b7, 0xd800, 0x03b7, 0xd801,
+	0x03b9, 0xd800, 0x03b9, 0xd801, 0x03bf, 0xd800, 0x03bf, 0xd801,
+	0x03c5, 0xd800, 0x03c5, 0xd801, 0x03c9, 0xd800, 0x03c9, 0xd801,
+	0x03b1, 0xd811, 0x03b9, 0x03b1, 0xd827, 0x03b9, 0x03b1, 0xd811,
+	0xd800, 0x03b9, 0x03b1, 0xd827, 0xd800, 0x03b9, 0x03b1, 0xd811,
+	0xd801, 0x03b9, 0x03b1, 0xd827, 0xd801, 0x03b9, 0x03b1, 0xd811,
+	0xd828, 0x03b9, 0x03b1, 0xd827, 0xd828, 0x03b9, 0x03b1, 0xd811,
+	0x03b9, 0x03b1, 0xd827, 0x03b9, 0x03b1, 0xd811, 0xd800, 0x03b9,
+	0x03b1, 0xd827, 0xd800, 0x03b9, 0x03b1, 0xd811, 0xd801, 0x03b9,
+	0x03b1, 0xd827, 0xd801, 0x03b9, 0x03b1, 0xd811, 0xd828, 0x03b9,
+	0x03b1, 0xd827, 0xd828, 0x03b9, 0x03b7, 0xd811, 0x03b9, 0x03b7,
+	0xd827, 0x03b9, 0x03b7, 0xd811, 0xd800, 0x03b9, 0x03b7, 0xd827,
+	0xd800, 0x03b9, 0x03b7, 0xd811, 0xd801, 0x03b9, 0x03b7, 0xd827,
+	0xd801, 0x03b9, 0x03b7, 0xd811, 0xd828, 0x03b9, 0x03b7, 0xd827,
+	0xd828, 0x03b9, 0x03b7, 0xd811, 0x03b9, 0x03b7, 0xd827, 0x03b9,
+	0x03b7, 0xd811, 0xd800, 0x03b9, 0x03b7, 0xd827, 0xd800, 0x03b9,
+	0x03b7, 0xd811, 0xd801, 0x03b9, 0x03b7, 0xd827, 0xd801, 0x03b9,
+	0x03b7, 0xd811, 0xd828, 0x03b9, 0x03b7, 0xd827, 0xd828, 0x03b9,
+	0x03c9, 0xd811, 0x03b9, 0x03c9, 0xd827, 0x03b9, 0x03c9, 0xd811,
+	0xd800, 0x03b9, 0x03c9, 0xd827, 0xd800, 0x03b9, 0x03c9, 0xd811,
+	0xd801, 0x03b9, 0x03c9, 0xd827, 0xd801, 0x03b9, 0x03c9, 0xd811,
+	0xd828, 0x03b9, 0x03c9, 0xd827, 0xd828, 0x03b9, 0x03c9, 0xd811,
+	0x03b9, 0x03c9, 0xd827, 0x03b9, 0x03c9, 0xd811, 0xd800, 0x03b9,
+	0x03c9, 0xd827, 0xd800, 0x03b9, 0x03c9, 0xd811, 0xd801, 0x03b9,
+	0x03c9, 0xd827, 0xd801, 0x03b9, 0x03c9, 0xd811, 0xd828, 0x03b9,
+	0x03c9, 0xd827, 0xd828, 0x03b9, 0x03b1, 0xd808, 0x03b1, 0xd807,
+	0x03b1, 0xd800, 0x03b9, 0x03b1, 0x03b9, 0x03b1, 0xd801, 0x03b9,
+	0x03b1, 0xd828, 0x03b1, 0xd828, 0x03b9, 0x03b1, 0xd808, 0x03b1,
+	0xd807, 0x03b1, 0xd800, 0x03b1, 0xd801, 0x03b1, 0x03b9, 0x03b9,
+	0x00a8, 0xd828, 0x03b7, 0xd800, 0x03b9, 0x03b7, 0x03b9, 0x03b7,
+	0xd801, 0x03b9, 0x03b7, 0xd828, 0x03b7, 0xd828, 0x03b9, 0x03b5,
+	0xd800, 0x03b5, 0xd801, 0x03b7, 0xd800, 0x03b7, 0xd801, 0x03b7,
+	0x03b9, 0x1fbf, 0xd800, 0x1fbf, 0xd801, 0x1fbf, 0xd828, 0x03b9,
+	0xd808, 0x03b9, 0xd807, 0x03b9, 0xd804, 0xd800, 0x03b9, 0xd804,
+	0xd801, 0x03b9, 0xd828, 0x03b9, 0xd804, 0xd828, 0x03b9, 0xd808,
+	0x03b9, 0xd807, 0x03b9, 0xd800, 0x03b9, 0xd801, 0x1ffe, 0xd800,
+	0x1ffe, 0xd801, 0x1ffe, 0xd828, 0x03c5, 0xd808, 0x03c5, 0xd807,
+	0x03c5, 0xd804, 0xd800, 0x03c5, 0xd804, 0xd801, 0x03c1, 0xd811,
+	0x03c1, 0xd827, 0x03c5, 0xd828, 0x03c5, 0xd804, 0xd828, 0x03c5,
+	0xd808, 0x03c5, 0xd807, 0x03c5, 0xd800, 0x03c5, 0xd801, 0x03c1,
+	0xd827, 0x00a8, 0xd800, 0x00a8, 0xd801, 0x0060, 0x03c9, 0xd800,
+	0x03b9, 0x03c9, 0x03b9, 0x03c9, 0xd801, 0x03b9, 0x03c9, 0xd828,
+	0x03c9, 0xd828, 0x03b9, 0x03bf, 0xd800, 0x03bf, 0xd801, 0x03c9,
+	0xd800, 0x03c9, 0xd801, 0x03c9, 0x03b9, 0x00b4, 0x2002, 0x2003,
+	0x03c9, 0x006b, 0x0061, 0xd805, 0x214e, 0x2170, 0x2171, 0x2172,
+	0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217a,
+	0x217b, 0x217c, 0x217d, 0x217e, 0x217f, 0x2184, 0x2190, 0xd82a,
+	0x2192, 0xd82a, 0x2194, 0xd82a, 0x21d0, 0xd82a, 0x21d4, 0xd82a,
+	0x21d2, 0xd82a, 0x2203, 0xd82a, 0x2208, 0xd82a, 0x220b, 0xd82a,
+	0x2223, 0xd82a, 0x2225, 0xd82a, 0x223c, 0xd82a, 0x2243, 0xd82a,
+	0x2245, 0xd82a, 0x2248, 0xd82a, 0x003d, 0xd82a, 0x2261, 0xd82a,
+	0x224d, 0xd82a, 0x003c, 0xd82a, 0x003e, 0xd82a, 0x2264, 0xd82a,
+	0x2265, 0xd82a, 0x2272, 0xd82a, 0x2273, 0xd82a, 0x2276, 0xd82a,
+	0x2277, 0xd82a, 0x227a, 0xd82a, 0x227b, 0xd82a, 0x2282, 0xd82a,
+	0x2283, 0xd82a, 0x2286, 0xd82a, 0x2287, 0xd82a, 0x22a2, 0xd82a,
+	0x22a8, 0xd82a, 0x22a9, 0xd82a, 0x22ab, 0xd82a, 0x227c, 0xd82a,
+	0x227d, 0xd82a, 0x2291, 0xd82a, 0x2292, 0xd82a, 0x22b2, 0xd82a,
+	0x22b3, 0xd82a, 0x22b4, 0xd82a, 0x22b5, 0xd82a, 0x3008, 0x3009,
+	0x24d0, 0x24d1, 0x24d2, 0x24d3, 0x24d4, 0x24d5, 0x24d6, 0x24d7,
+	0x24d8, 0x24d9, 0x24da, 0x24db, 0x24dc, 0x24dd, 0x24de, 0x24df,
+	0x24e0, 0x24e1, 0x24e2, 0x24e3, 0x24e4, 0x24e5, 0x24e6, 0x24e7,
+	0x24e8, 0x24e9, 0x2add, 0xd82a, 0x2c30, 0x2c31, 0x2c32, 0x2c33,
+	0x2c34, 0x2c35, 0x2c36, 0x2c37, 0x2c38, 0x2c39, 0x2c3a, 0x2c3b,
+	0x2c3c, 0x2c3d, 0x2c3e, 0x2c3f, 0x2c40, 0x2c41, 0x2c42, 0x2c43,
+	0x2c44, 0x2c45, 0x2c46, 0x2c47, 0x2c48, 0x2c49, 0x2c4a, 0x2c4b,
+	0x2c4c, 0x2c4d, 0x2c4e, 0x2c4f, 0x2c50, 0x2c51, 0x2c52, 0x2c53,
+	0x2c54, 0x2c55, 0x2c56, 0x2c57, 0x2c58, 0x2c59, 0x2c5a, 0x2c5b,
+	0x2c5c, 0x2c5d, 0x2c5e, 0x2c61, 0x026b, 0x1d7d, 0x027d, 0x2c68,
+	0x2c6a, 0x2c6c, 0x0251, 0x0271, 0x0250, 0x0252, 0x2c73, 0x2c76,
+	0x023f, 0x0240, 0x2c81, 0x2c83, 0x2c85, 0x2c87, 0x2c89, 0x2c8b,
+	0x2c8d, 0x2c8f, 0x2c91, 0x2c93, 0x2c95, 0x2c97, 0x2c99, 0x2c9b,
+	0x2c9d, 0x2c9f, 0x2ca1, 0x2ca3, 0x2ca5, 0x2ca7, 0x2ca9, 0x2cab,
+	0x2cad, 0x2caf, 0x2cb1, 0x2cb3, 0x2cb5, 0x2cb7, 0x2cb9, 0x2cbb,
+	0x2cbd, 0x2cbf, 0x2cc1, 0x2cc3, 0x2cc5, 0x2cc7, 0x2cc9, 0x2ccb,
+	0x2ccd, 0x2ccf, 0x2cd1, 0x2cd3, 0x2cd5, 0x2cd7, 0x2cd9, 0x2cdb,
+	0x2cdd, 0x2cdf, 0x2ce1, 0x2ce3, 0x2cec, 0x2cee, 0x2cf3, 0x304b,
+	0xd82b, 0x304d, 0xd82b, 0x304f, 0xd82b, 0x3051, 0xd82b, 0x3053,
+	0xd82b, 0x3055, 0xd82b, 0x3057, 0xd82b, 0x3059, 0xd82b, 0x305b,
+	0xd82b, 0x305d, 0xd82b, 0x305f, 0xd82b, 0x3061, 0xd82b, 0x3064,
+	0xd82b, 0x3066, 0xd82b, 0x3068, 0xd82b, 0x306f, 0xd82b, 0x306f,
+	0xd82c, 0x3072, 0xd82b, 0x3072, 0xd82c, 0x3075, 0xd82b, 0x3075,
+	0xd82c, 0x3078, 0xd82b, 0x3078, 0xd82c, 0x307b, 0xd82b, 0x307b,
+	0xd82c, 0x3046, 0xd82b, 0x309d, 0xd82b, 0x30ab, 0xd82b, 0x30ad,
+	0xd82b, 0x30af, 0xd82b, 0x30b1, 0xd82b, 0x30b3, 0xd82b, 0x30b5,
+	0xd82b, 0x30b7, 0xd82b, 0x30b9, 0xd82b, 0x30bb, 0xd82b, 0x30bd,
+	0xd82b, 0x30bf, 0xd82b, 0x30c1, 0xd82b, 0x30c4, 0xd82b, 0x30c6,
+	0xd82b, 0x30c8, 0xd82b, 0x30cf, 0xd82b, 0x30cf, 0xd82c, 0x30d2,
+	0xd82b, 0x30d2, 0xd82c, 0x30d5, 0xd82b, 0x30d5, 0xd82c, 0x30d8,
+	0xd82b, 0x30d8, 0xd82c, 0x30db, 0xd82b, 0x30db, 0xd82c, 0x30a6,
+	0xd82b, 0x30ef, 0xd82b, 0x30f0, 0xd82b, 0x30f1, 0xd82b, 0x30f2,
+	0xd82b, 0x30fd, 0xd82b, 0xa641, 0xa643, 0xa645, 0xa647, 0xa649,
+	0xa64b, 0xa64d, 0xa64f, 0xa651, 0xa653, 0xa655, 0xa657, 0xa659,
+	0xa65b, 0xa65d, 0xa65f, 0xa661, 0xa663, 0xa665, 0xa667, 0xa669,
+	0xa66b, 0xa66d, 0xa681, 0xa683, 0xa685, 0xa687, 0xa689, 0xa68b,
+	0xa68d, 0xa68f, 0xa691, 0xa693, 0xa695, 0xa697, 0xa699, 0xa69b,
+	0xa723, 0xa725, 0xa727, 0xa729, 0xa72b, 0xa72d, 0xa72f, 0xa733,
+	0xa735, 0xa737, 0xa739, 0xa73b, 0xa73d, 0xa73f, 0xa741, 0xa743,
+	0xa745, 0xa747, 0xa749, 0xa74b, 0xa74d, 0xa74f, 0xa751, 0xa753,
+	0xa755, 0xa757, 0xa759, 0xa75b, 0xa75d, 0xa75f, 0xa761, 0xa763,
+	0xa765, 0xa767, 0xa769, 0xa76b, 0xa76d, 0xa76f, 0xa77a, 0xa77c,
+	0x1d79, 0xa77f, 0xa781, 0xa783, 0xa785, 0xa787, 0xa78c, 0x0265,
+	0xa791, 0xa793, 0xa797, 0xa799, 0xa79b, 0xa79d, 0xa79f, 0xa7a1,
+	0xa7a3, 0xa7a5, 0xa7a7, 0xa7a9, 0x0266, 0x025c, 0x0261, 0x026c,
+	0x026a, 0x029e, 0x0287, 0x029d, 0xab53, 0xa7b5, 0xa7b7, 0x13a0,
+	0x13a1, 0x13a2, 0x13a3, 0x13a4, 0x13a5, 0x13a6, 0x13a7, 0x13a8,
+	0x13a9, 0x13aa, 0x13ab, 0x13ac, 0x13ad, 0x13ae, 0x13af, 0x13b0,
+	0x13b1, 0x13b2, 0x13b3, 0x13b4, 0x13b5, 0x13b6, 0x13b7, 0x13b8,
+	0x13b9, 0x13ba, 0x13bb, 0x13bc, 0x13bd, 0x13be, 0x13bf, 0x13c0,
+	0x13c1, 0x13c2, 0x13c3, 0x13c4, 0x13c5, 0x13c6, 0x13c7, 0x13c8,
+	0x13c9, 0x13ca, 0x13cb, 0x13cc, 0x13cd, 0x13ce, 0x13cf, 0x13d0,
+	0x13d1, 0x13d2, 0x13d3, 0x13d4, 0x13d5, 0x13d6, 0x13d7, 0x13d8,
+	0x13d9, 0x13da, 0x13db, 0x13dc, 0x13dd, 0x13de, 0x13df, 0x13e0,
+	0x13e1, 0x13e2, 0x13e3, 0x13e4, 0x13e5, 0x13e6, 0x13e7, 0x13e8,
+	0x13e9, 0x13ea, 0x13eb, 0x13ec, 0x13ed, 0x13ee, 0x13ef, 0x8c48,
+	0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5, 0x9f9c, 0x9f9c,
+	0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85, 0x863f,
+	0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9, 0x73de, 0x843d,
+	0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04, 0x721b, 0x862d, 0x9e1e,
+	0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8, 0x881f, 0x5eca,
+	0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7, 0x52de, 0x64c4,
+	0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c, 0x8def, 0x9732,
+	0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304, 0x9e7f,
+	0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e, 0x7262, 0x78ca, 0x8cc2,
+	0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f, 0x7d2f, 0x7e37,
+	0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c, 0x7dbe, 0x83f1,
+	0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39, 0x5be7, 0x6012,
+	0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9, 0x4e0d, 0x6ccc,
+	0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449, 0x8aaa, 0x6bba,
+	0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565, 0x4eae, 0x5169,
+	0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf, 0x52f5, 0x5442,
+	0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a, 0x9e97,
+	0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74, 0x6190, 0x6200,
+	0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4, 0x806f, 0x8f26,
+	0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd, 0x70c8, 0x88c2,
+	0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e, 0x7375, 0x4ee4,
+	0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046,
+	0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4, 0x96b8,
+	0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f, 0x6599, 0x6a02, 0x71ce,
+	0x7642, 0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e, 0x5289, 0x677b,
+	0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b, 0x7d10, 0x985e,
+	0x516d, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a, 0x5f8b,
+	0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f, 0x5c65, 0x6613,
+	0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2, 0x7f79, 0x88cf, 0x88e1,
+	0x91cc, 0x96e2, 0x533f, 0x6eba, 0x541d, 0x71d0, 0x7498, 0x85fa,
+	0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8, 0x7acb, 0x7b20,
+	0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a, 0x5207,
+	0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b, 0x884c,
+	0x964d, 0x898b, 0x5ed3, 0x5140, 0x55c0, 0x585a, 0x6674, 0x51de,
+	0x732a, 0x76ca, 0x793c, 0x795e, 0x7965, 0x798f, 0x9756, 0x7cbe,
+	0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef, 0x98fc, 0x9928,
+	0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d, 0x52c9, 0x52e4,
+	0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8, 0x5c64, 0x5c6e,
+	0x6094, 0x6168, 0x618e, 0x61f2, 0x654f, 0x65e2, 0x6691, 0x6885,
+	0x6d77, 0x6e1a, 0x6f22, 0x716e, 0x722b, 0x7422, 0x7891, 0x793e,
+	0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d, 0x798e, 0x7a40,
+	0x7a81, 0x7bc0, 0x7df4, 0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed,
+	0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3,
+	0x8d08, 0x8fb6, 0x9038, 0x96e3, 0x97ff, 0x983b, 0x6075, 0xd82d,
+	0x8218, 0x4e26, 0x51b5, 0x5168, 0x4f80, 0x5145, 0x5180, 0x52c7,
+	0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2, 0x585a, 0x58b3, 0x5944,
+	0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad, 0x60d8,
+	0x614e, 0x6108, 0x618e, 0x6160, 0x61f2, 0x6234, 0x63c4, 0x641c,
+	0x6452, 0x6556, 0x6674, 0x6717, 0x671b, 0x6756, 0x6b79, 0x6bba,
+	0x6d41, 0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e, 0x77a7, 0x7235,
+	0x72af, 0x732a, 0x7471, 0x7506, 0x753b, 0x761d, 0x761f, 0x76ca,
+	0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1, 0x7bc0, 0x7c7b,
+	0x7d5b, 0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef, 0x8779, 0x8941,
+	0x8986, 0x8996, 0x8abf, 0x8af8, 0x8acb, 0x8b01, 0x8afe, 0x8aed,
+	0x8b39, 0x8b8a, 0x8d08, 0x8f38, 0x9072, 0x9199, 0x9276, 0x967c,
+	0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b, 0x9b12, 0x9f9c,
+	0xd82e, 0xd82f, 0xd830, 0x3b9d, 0x4018, 0x4039, 0xd831, 0xd832,
+	0xd833, 0x9f43, 0x9f8e, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066,
+	0x006c, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006c, 0x0073,
+	0x0074, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574,
+	0x056b, 0x057e, 0x0576, 0x0574, 0x056d, 0x05d9, 0xd834, 0x05f2,
+	0xd835, 0x05e9, 0xd836, 0x05e9, 0xd837, 0x05e9, 0xd838, 0xd836,
+	0x05e9, 0xd838, 0xd837, 0x05d0, 0xd835, 0x05d0, 0xd839, 0x05d0,
+	0xd838, 0x05d1, 0xd838, 0x05d2, 0xd838, 0x05d3, 0xd838, 0x05d4,
+	0xd838, 0x05d5, 0xd838, 0x05d6, 0xd838, 0x05d8, 0xd838, 0x05d9,
+	0xd838, 0x05da, 0xd838, 0x05db, 0xd838, 0x05dc, 0xd838, 0x05de,
+	0xd838, 0x05e0, 0xd838, 0x05e1, 0xd838, 0x05e3, 0xd838, 0x05e4,
+	0xd838, 0x05e6, 0xd838, 0x05e7, 0xd838, 0x05e8, 0xd838, 0x05e9,
+	0xd838, 0x05ea, 0xd838, 0x05d5, 0xd83a, 0x05d1, 0xd83b, 0x05db,
+	0xd83b, 0x05e4, 0xd83b, 0xff41, 0xff42, 0xff43, 0xff44, 0xff45,
+	0xff46, 0xff47, 0xff48, 0xff49, 0xff4a, 0xff4b, 0xff4c, 0xff4d,
+	0xff4e, 0xff4f, 0xff50, 0xff51, 0xff52, 0xff53, 0xff54, 0xff55,
+	0xff56, 0xff57, 0xff58, 0xff59, 0xff5a, 0xd8be, 0xd8bf, 0xd8c0,
+	0xd8c1, 0xd8c2, 0xd8c3, 0xd8c4, 0xd8c5, 0xd8c6, 0xd8c7, 0xd8c8,
+	0xd8c9, 0xd8ca, 0xd8cb, 0xd8cc, 0xd8cd, 0xd8ce, 0xd8cf, 0xd8d0,
+	0xd8d1, 0xd8d2, 0xd8d3, 0xd8d4, 0xd8d5, 0xd8d6, 0xd8d7, 0xd8d8,
+	0xd8d9, 0xd8da, 0xd8db, 0xd8dc, 0xd8dd, 0xd8de, 0xd8df, 0xd8e0,
+	0xd8e1, 0xd8e2, 0xd8e3, 0xd8e4, 0xd8e5, 0xd8e6, 0xd8e7, 0xd8e8,
+	0xd8e9, 0xd8ea, 0xd8eb, 0xd8ec, 0xd8ed, 0xd8ee, 0xd8ef, 0xd8f0,
+	0xd8f1, 0xd8f2, 0xd8f3, 0xd8f4, 0xd8f5, 0xd8f6, 0xd8f7, 0xd8f8,
+	0xd8f9, 0xd8fa, 0xd8fb, 0xd8fc, 0xd8fd, 0xd8fe, 0xd8ff, 0xd900,
+	0xd901, 0xd902, 0xd903, 0xd904, 0xd905, 0xd906, 0xd907, 0xd908,
+	0xd909, 0xd90a, 0xd90b, 0xd90c, 0xd90d, 0xd90e, 0xd90f, 0xd910,
+	0xd911, 0xd912, 0xd913, 0xd914, 0xd915, 0xd916, 0xd917, 0xd918,
+	0xd919, 0xd91a, 0xd91b, 0xd91c, 0xd91d, 0xd91e, 0xd91f, 0xd920,
+	0xd921, 0xd922, 0xd923, 0xd924, 0xd925, 0xd926, 0xd927, 0xd928,
+	0xd929, 0xd92a, 0xd92b, 0xd92c, 0xd92d, 0xd92e, 0xd92f, 0xd930,
+	0xd931, 0xd932, 0xd933, 0xd934, 0xd935, 0xd936, 0xd937, 0xd938,
+	0xd939, 0xd93a, 0xd93b, 0xd93c, 0xd83c, 0xd83d, 0xd83e, 0xd83d,
+	0xd83f, 0xd83d, 0xd840, 0xd841, 0xd842, 0xd841, 0xd843, 0xd844,
+	0xd843, 0xd845, 0xd846, 0xd847, 0xd846, 0xd848, 0xd846, 0xd849,
+	0xd84a, 0xd84b, 0xd84c, 0xd84b, 0xd93d, 0xd93e, 0xd93f, 0xd940,
+	0xd941, 0xd942, 0xd943, 0xd944, 0xd945, 0xd946, 0xd947, 0xd948,
+	0xd949, 0xd94a, 0xd94b, 0xd94c, 0xd94d, 0xd94e, 0xd94f, 0xd950,
+	0xd951, 0xd952, 0xd953, 0xd954, 0xd955, 0xd956, 0xd957, 0xd958,
+	0xd959, 0xd95a, 0xd95b, 0xd95c, 0xd84d, 0xd84e, 0xd84f, 0xd84e,
+	0xd84f, 0xd84e, 0xd850, 0xd84f, 0xd84e, 0xd851, 0xd84f, 0xd84e,
+	0xd852, 0xd84f, 0xd84e, 0xd853, 0xd84f, 0xd84e, 0xd854, 0xd855,
+	0xd84e, 0xd856, 0xd84e, 0xd855, 0xd84e, 0xd850, 0xd856, 0xd84e,
+	0xd850, 0xd855, 0xd84e, 0xd851, 0xd856, 0xd84e, 0xd851, 0xd95d,
+	0xd95e, 0xd95f, 0xd960, 0xd961, 0xd962, 0xd963, 0xd964, 0xd965,
+	0xd966, 0xd967, 0xd968, 0xd969, 0xd96a, 0xd96b, 0xd96c, 0xd96d,
+	0xd96e, 0xd96f, 0xd970, 0xd971, 0xd972, 0xd973, 0xd974, 0xd975,
+	0xd976, 0xd977, 0xd978, 0xd979, 0xd97a, 0xd97b, 0xd97c, 0xd97d,
+	0xd97e, 0x4e3d, 0x4e38, 0x4e41, 0xd857, 0x4f60, 0x4fae, 0x4fbb,
+	0x5002, 0x507a, 0x5099, 0x50e7, 0x50cf, 0x349e, 0xd858, 0x514d,
+	0x5154, 0x5164, 0x5177, 0xd859, 0x34b9, 0x5167, 0x518d, 0xd85a,
+	0x5197, 0x51a4, 0x4ecc, 0x51ac, 0x51b5, 0xd85b, 0x51f5, 0x5203,
+	0x34df, 0x523b, 0x5246, 0x5272, 0x5277, 0x3515, 0x52c7, 0x52c9,
+	0x52e4, 0x52fa, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535a,
+	0x5373, 0x537d, 0x537f, 0x537f, 0x537f, 0xd85c, 0x7070, 0x53ca,
+	0x53df, 0xd85d, 0x53eb, 0x53f1, 0x5406, 0x549e, 0x5438, 0x5448,
+	0x5468, 0x54a2, 0x54f6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584,
+	0x5599, 0x55ab, 0x55b3, 0x55c2, 0x5716, 0x5606, 0x5717, 0x5651,
+	0x5674, 0x5207, 0x58ee, 0x57ce, 0x57f4, 0x580d, 0x578b, 0x5832,
+	0x5831, 0x58ac, 0xd85e, 0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922,
+	0x5962, 0xd85f, 0xd860, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66,
+	0x36ee, 0x36fc, 0x5b08, 0x5b3e, 0x5b3e, 0xd861, 0x5bc3, 0x5bd8,
+	0x5be7, 0x5bf3, 0xd862, 0x5bff, 0x5c06, 0x5f53, 0x5c22, 0x3781,
+	0x5c60, 0x5c6e, 0x5cc0, 0x5c8d, 0xd863, 0x5d43, 0xd864, 0x5d6e,
+	0x5d6b, 0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d,
+	0x5e69, 0x3862, 0xd865, 0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca,
+	0xd866, 0x5efe, 0xd867, 0xd867, 0x8201, 0x5f22, 0x5f22, 0x38c7,
+	0xd868, 0xd869, 0x5f62, 0x5f6b, 0x38e3, 0x5f9a, 0x5fcd, 0x5fd7,
+	0x5ff9, 0x6081, 0x393a, 0x391c, 0x6094, 0xd86a, 0x60c7, 0x6148,
+	0x614c, 0x614e, 0x614c, 0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af,
+	0x61de, 0x61f2, 0x61f6, 0x6210, 0x621b, 0x625d, 0x62b1, 0x62d4,
+	0x6350, 0xd86b, 0x633d, 0x62fc, 0x6368, 0x6383, 0x63e4, 0xd86c,
+	0x6422, 0x63c5, 0x63a9, 0x3a2e, 0x6469, 0x647e, 0x649d, 0x6477,
+	0x3a6c, 0x654f, 0x656c, 0xd86d, 0x65e3, 0x66f8, 0x6649, 0x3b19,
+	0x6691, 0x3b08, 0x3ae4, 0x5192, 0x5195, 0x6700, 0x669c, 0x80ad,
+	0x43d9, 0x6717, 0x671b, 0x6721, 0x675e, 0x6753, 0xd86e, 0x3b49,
+	0x67fa, 0x6785, 0x6852, 0x6885, 0xd86f, 0x688e, 0x681f, 0x6914,
+	0x3b9d, 0x6942, 0x69a3, 0x69ea, 0x6aa8, 0xd870, 0x6adb, 0x3c18,
+	0x6b21, 0xd871, 0x6b54, 0x3c4e, 0x6b72, 0x6b9f, 0x6bba, 0x6bbb,
+	0xd872, 0xd873, 0xd874, 0x6c4e, 0xd875, 0x6cbf, 0x6ccd, 0x6c67,
+	0x6d16, 0x6d3e, 0x6d77, 0x6d41, 0x6d69, 0x6d78, 0x6d85, 0xd876,
+	0x6d34, 0x6e2f, 0x6e6e, 0x3d33, 0x6ecb, 0x6ec7, 0xd877, 0x6df9,
+	0x6f6e, 0xd878, 0xd879, 0x6fc6, 0x7039, 0x701e, 0x701b, 0x3d96,
+	0x704a, 0x707d, 0x7077, 0x70ad, 0xd87a, 0x7145, 0xd87b, 0x719c,
+	0xd87c, 0x7228, 0x7235, 0x7250, 0xd87d, 0x7280, 0x7295, 0xd87e,
+	0xd87f, 0x737a, 0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x3eb8, 0x7447,
+	0x745c, 0x7471, 0x7485, 0x74ca, 0x3f1b, 0x7524, 0xd880, 0x753e,
+	0xd881, 0x7570, 0xd882, 0x7610, 0xd883, 0xd884, 0xd885, 0x3ffc,
+	0x4008, 0x76f4, 0xd886, 0xd887, 0xd888, 0xd889, 0x771e, 0x771f,
+	0x771f, 0x774a, 0x4039, 0x778b, 0x4046, 0x4096, 0xd88a, 0x784e,
+	0x788c, 0x78cc, 0x40e3, 0xd88b, 0x7956, 0xd88c, 0xd88d, 0x798f,
+	0x79eb, 0x412f, 0x7a40, 0x7a4a, 0x7a4f, 0xd88e, 0xd88f, 0xd88f,
+	0x7aee, 0x4202, 0xd890, 0x7bc6, 0x7bc9, 0x4227, 0xd891, 0x7cd2,
+	0x42a0, 0x7ce8, 0x7ce3, 0x7d00, 0xd892, 0x7d63, 0x4301, 0x7dc7,
+	0x7e02, 0x7e45, 0x4334, 0xd893, 0xd894, 0x4359, 0xd895, 0x7f7a,
+	0xd896, 0x7f95, 0x7ffa, 0x8005, 0xd897, 0xd898, 0x8060, 0xd899,
+	0x8070, 0xd89a, 0x43d5, 0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5,
+	0xd89b, 0xd89c, 0xd89d, 0xd89e, 0x8201, 0x8204, 0x8f9e, 0x446b,
+	0x8291, 0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3, 0x82bd, 0x82e6,
+	0xd89f, 0x82e5, 0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7,
+	0x8457, 0x8353, 0x83ca, 0x83cc, 0x83dc, 0xd8a0, 0xd8a1, 0xd8a2,
+	0x452b, 0x84f1, 0x84f3, 0x8516, 0xd8a3, 0x8564, 0xd8a4, 0x455d,
+	0x4561, 0xd8a5, 0xd8a6, 0x456b, 0x8650, 0x865c, 0x8667, 0x8669,
+	0x86a9, 0x8688, 0x870e, 0x86e2, 0x8779, 0x8728, 0x876b, 0x8786,
+	0x45d7, 0x87e1, 0x8801, 0x45f9, 0x8860, 0x8863, 0xd8a7, 0x88d7,
+	0x88de, 0x4635, 0x88fa, 0x34bb, 0xd8a8, 0xd8a9, 0x46be, 0x46c7,
+	0x8aa0, 0x8aed, 0x8b8a, 0x8c55, 0xd8aa, 0x8cab, 0x8cc1, 0x8d1b,
+	0x8d77, 0xd8ab, 0xd8ac, 0x8dcb, 0x8dbc, 0x8df0, 0xd8ad, 0x8ed4,
+	0x8f38, 0xd8ae, 0xd8af, 0x9094, 0x90f1, 0x9111, 0xd8b0, 0x911b,
+	0x9238, 0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0xd8b1, 0x958b,
+	0x4995, 0x95b7, 0xd8b2, 0x49e6, 0x96c3, 0x5db2, 0x9723, 0xd8b3,
+	0xd8b4, 0x4a6e, 0x4a76, 0x97e0, 0xd8b5, 0x4ab2, 0xd8b6, 0x980b,
+	0x980b, 0x9829, 0xd8b7, 0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2,
+	0x99fe, 0x4bce, 0xd8b8, 0x9b12, 0x9c40, 0x9cfd, 0x4cce, 0x4ced,
+	0x9d67, 0xd8b9, 0x4cf8, 0xd8ba, 0xd8bb, 0xd8bc, 0x9ebb, 0x4d56,
+	0x9ef9, 0x9efe, 0x9f05, 0x9f0f, 0x9f16, 0x9f3b, 0xd8bd,
+};
+
+static const u32 apfs_nfdcf_esc[] __aligned(64) = {
+	0x00000000,
+};
+
+static const u32 apfs_value_wide[] __aligned(64) = {
+	0xe6000300, 0xe6000301, 0xe6000302, 0xe6000303, 0xe6000308, 0xe600030a,
+	0xca000327, 0xe6000304, 0xe6000306, 0xca000328, 0xe6000307, 0xe600030c,
+	0xe600030b, 0xd800031b, 0xe600030f, 0xe6000311, 0xdc000326, 0xe6000313,
+	0xe6000653, 0xe6000654, 0xdc000655, 0x0700093c, 0x070009bc, 0x07000a3c,
+	0x07000b3c, 0x5b000c56, 0x09000dca, 0x81000f71, 0x82000f72, 0x84000f74,
+	0x82000f80, 0xdc000325, 0xdc000323, 0xdc000331, 0xdc00032d, 0xdc000330,
+	0xdc00032e, 0xdc000324, 0xe6000309, 0xe6000314, 0xe6000342, 0xf0000345,
+	0x01000338, 0x08003099, 0x0800309a, 0x000242ee, 0x0002284a, 0x00022844,
+	0x000233d5, 0x00025249, 0x00025cd0, 0x00027ed3, 0x0e0005b4, 0x110005b7,
+	0x180005c1, 0x190005c2, 0x150005bc, 0x120005b8, 0x130005b9, 0x170005bf,
+	0x00011099, 0x070110ba, 0x0001109b, 0x000110a5, 0x00011131, 0x00011127,
+	0x00011132, 0x00011347, 0x0001133e, 0x00011357, 0x000114b9, 0x000114ba,
+	0x000114b0, 0x000114bd, 0x000115b8, 0x000115af, 0x000115b9, 0x0001d157,
+	0xd801d165, 0x0001d158, 0xd801d16e, 0xd801d16f, 0xd801d170, 0xd801d171,
+	0xd801d172, 0x0001d1b9, 0x0001d1ba, 0x00020122, 0x0002063a, 0x0002051c,
+	0x0002054b, 0x000291df, 0x00020a2c, 0x00020b63, 0x000214e4, 0x000216a8,
+	0x000216ea, 0x000219c8, 0x00021b18, 0x00021de4, 0x00021de6, 0x00022183,
+	0x0002a392, 0x00022331, 0x000232b8, 0x000261da, 0x000226d4, 0x00022b0c,
+	0x00022bf1, 0x0002300a, 0x000233c3, 0x0002346d, 0x000236a3, 0x000238a7,
+	0x00023a8d, 0x00021d0b, 0x00023afa, 0x00023cbc, 0x00023d1e, 0x00023ed1,
+	0x00023f5e, 0x00023f8e, 0x00020525, 0x00024263, 0x000243ab, 0x00024608,
+	0x00024735, 0x00024814, 0x00024c36, 0x00024c92, 0x0002219f, 0x00024fa1,
+	0x00024fb8, 0x00025044, 0x000250f3, 0x000250f2, 0x00025119, 0x00025133,
+	0x0002541d, 0x00025626, 0x0002569a, 0x000256c5, 0x0002597c, 0x00025aa7,
+	0x00025bab, 0x00025c80, 0x00025f86, 0x00026228, 0x00026247, 0x000262d9,
+	0x0002633e, 0x000264da, 0x00026523, 0x000265a8, 0x0002335f, 0x000267a7,
+	0x000267b5, 0x00023393, 0x0002339c, 0x00026b3c, 0x00026c36, 0x00026d6b,
+	0x00026cd5, 0x000273ca, 0x00026f2c, 0x00026fb1, 0x000270d2, 0x00027667,
+	0x000278ae, 0x00027966, 0x00027ca8, 0x00027f2f, 0x00020804, 0x000208de,
+	0x000285d2, 0x000285ed, 0x0002872e, 0x00028bfa, 0x00028d77, 0x00029145,
+	0x0002921a, 0x0002940a, 0x00029496, 0x000295b6, 0x00029b30, 0x0002a0ce,
+	0x0002a105, 0x0002a20e, 0x0002a291, 0x0002a600, 0x00010428, 0x00010429,
+	0x0001042a, 0x0001042b, 0x0001042c, 0x0001042d, 0x0001042e, 0x0001042f,
+	0x00010430, 0x00010431, 0x00010432, 0x00010433, 0x00010434, 0x00010435,
+	0x00010436, 0x00010437, 0x00010438, 0x00010439, 0x0001043a, 0x0001043b,
+	0x0001043c, 0x0001043d, 0x0001043e, 0x0001043f, 0x00010440, 0x00010441,
+	0x00010442, 0x00010443, 0x00010444, 0x00010445, 0x00010446, 0x00010447,
+	0x00010448, 0x00010449, 0x0001044a, 0x0001044b, 0x0001044c, 0x0001044d,
+	0x0001044e, 0x0001044f, 0x000104d8, 0x000104d9, 0x000104da, 0x000104db,
+	0x000104dc, 0x000104dd, 0x000104de, 0x000104df, 0x000104e0, 0x000104e1,
+	0x000104e2, 0x000104e3, 0x000104e4, 0x000104e5, 0x000104e6, 0x000104e7,
+	0x000104e8, 0x000104e9, 0x000104ea, 0x000104eb, 0x000104ec, 0x000104ed,
+	0x000104ee, 0x000104ef, 0x000104f0, 0x000104f1, 0x000104f2, 0x000104f3,
+	0x000104f4, 0x000104f5, 0x000104f6, 0x000104f7, 0x000104f8, 0x000104f9,
+	0x000104fa, 0x000104fb, 0x00010cc0, 0x00010cc1, 0x00010cc2, 0x00010cc3,
+	0x00010cc4, 0x00010cc5, 0x00010cc6, 0x00010cc7, 0x00010cc8, 0x00010cc9,
+	0x00010cca, 0x00010ccb, 0x00010ccc, 0x00010ccd, 0x00010cce, 0x00010ccf,
+	0x00010cd0, 0x00010cd1, 0x00010cd2, 0x00010cd3, 0x00010cd4, 0x00010cd5,
+	0x00010cd6, 0x00010cd7, 0x00010cd8, 0x00010cd9, 0x00010cda, 0x00010cdb,
+	0x00010cdc, 0x00010cdd, 0x00010cde, 0x00010cdf, 0x00010ce0, 0x00010ce1,
+	0x00010ce2, 0x00010ce3, 0x00010ce4, 0x00010ce5, 0x00010ce6, 0x00010ce7,
+	0x00010ce8, 0x00010ce9, 0x00010cea, 0x00010ceb, 0x00010cec, 0x00010ced,
+	0x00010cee, 0x00010cef, 0x00010cf0, 0x00010cf1, 0x00010cf2, 0x000118c0,
+	0x000118c1, 0x000118c2, 0x000118c3, 0x000118c4, 0x000118c5, 0x000118c6,
+	0x000118c7, 0x000118c8, 0x000118c9, 0x000118ca, 0x000118cb, 0x000118cc,
+	0x000118cd, 0x000118ce, 0x000118cf, 0x000118d0, 0x000118d1, 0x000118d2,
+	0x000118d3, 0x000118d4, 0x000118d5, 0x000118d6, 0x000118d7, 0x000118d8,
+	0x000118d9, 0x000118da, 0x000118db, 0x000118dc, 0x000118dd, 0x000118de,
+	0x000118df, 0x0001e922, 0x0001e923, 0x0001e924, 0x0001e925, 0x0001e926,
+	0x0001e927, 0x0001e928, 0x0001e929, 0x0001e92a, 0x0001e92b, 0x0001e92c,
+	0x0001e92d, 0x0001e92e, 0x0001e92f, 0x0001e930, 0x0001e931, 0x0001e932,
+	0x0001e933, 0x0001e934, 0x0001e935, 0x0001e936, 0x0001e937, 0x0001e938,
+	0x0001e939, 0x0001e93a, 0x0001e93b, 0x0001e93c, 0x0001e93d, 0x0001e93e,
+	0x0001e93f, 0x0001e940, 0x0001e941, 0x0001e942, 0x0001e943,
+};
+
+static const u8 apfs_qc_planes[] __aligned(64) = {
+	0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const u8 apfs_qc_blocks[][256] __aligned(64) = {
+	{
+		  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+		 16,  17,  17,  18,  17,  17,  17,  19,  20,  21,  22,  23,  24,  25,  26,  27,
+		 28,  29,  30,  31,  32,  17,  17,  17,  17,  17,  33,  17,  34,  35,  17,  17,
+		 36,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  37,  38,  39,  40,  41,  42,  43,  43,  43,  43,
+		 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+		 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+		 43,  43,  43,  43,  43,  43,  43,  44,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  43,  45,  46,  17,  17,  47,  48,
+	},
+	{
+		 17,  49,  50,  51,  52,  17,  17,  17,  17,  17,  53,  17,  54,  17,  17,  17,
+		 55,  56,  57,  58,  59,  60,  61,  62,  63,  17,  17,  17,  64,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  65,  66,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  67,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  68,  69,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 70,  17,  17,  17,  17,  17,  17,  17,  71,  72,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+	},
+	{
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  43,  43,  73,  17,  17,  17,  17,  17,
+	},
+	{
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+		 17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+	},
+};
+
+static const u32 apfs_qc_leaves[][16] __aligned(64) = {
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0x55555557, 0xffd55555, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfffff7ff,
+		0x00001000, 0x5001c001, 0x00003000, 0x3003c003,
+	},
+	{
+		0x00000000, 0x0000000d, 0x0000d000, 0x400300dc,
+		0x00d40037, 0x000000d0, 0x0000d000, 0x40000000,
+		0x5f575dd7, 0x75fd5d75, 0x1df75dd0, 0xfdfd7754,
+		0x035d75ff, 0x0c000000, 0x00000d00, 0x000050d4,
+	},
+	{
+		0x00000000, 0x0d000000, 0x00000ddd, 0xd75fff00,
+		0xddddd577, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0xc0000000, 0x00000000, 0x00000000, 0x4fffdcdd,
+		0x0cc003ff, 0x55555554, 0x00055575, 0xfffffffc,
+		0x400fffdf, 0xddddd435, 0xdddddddd, 0x57d775f5,
+	},
+	{
+		0x40551510, 0x55515555, 0x55555555, 0xfff3ffff,
+		0xffffffff, 0xc0ff3f30, 0xdddddddd, 0xdddd0ddd,
+		0xdddf003d, 0xdddddddd, 0xdddddddd, 0xdddddddd,
+		0xf7777741, 0x000d0d00, 0x000d000d, 0xddd0d000,
+	},
+	{
+		0xdddddddd, 0xdddddddd, 0xdddddddd, 0x55555557,
+		0x55555555, 0xffffd555, 0xffffffff, 0xffffffff,
+		0xffff7fff, 0x00000003, 0x00000000, 0x30000000,
+		0xffff30c3, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffc00000, 0xffffc00f, 0xffffffff,
+		0x003fffff, 0x00000000, 0xffffffff, 0xfffffffc,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffcc, 0x3c000f3f, 0xf00c3c00, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xfffffff3, 0xffffffff, 0x00000000,
+		0xffc00000, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0x003fffff, 0xffffff00,
+	},
+	{
+		0xffffffff, 0x00300fff, 0xf0030300, 0xffffffff,
+		0xffffffff, 0xff03ffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0x000000ff, 0x00000030, 0x00000000,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xfff3ffff, 0xfcfffcf3,
+		0xf3ffffff, 0x0000fc03, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf03fffff, 0x30ffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffcf3f,
+		0xf3ffffff, 0xcf03ffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf3ffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf03cffff, 0xf0ffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xfffffcff, 0xffffffff, 0xffffffff,
+		0xf00fffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xf3fcffff, 0xffffc3ff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf30c3ffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xf00fffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffcfffff, 0xc0cfffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffc0ffff,
+		0xff00ffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfff0ffff,
+		0xff00ffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xfff0ffff, 0xffffffff, 0xfff333ff,
+		0xf3ffff3f, 0xfcff3fcf, 0xfff3ffff, 0xf00cc003,
+		0xffff0c00, 0xf3ffff3f, 0xfcff3fcf, 0xfff3ffff,
+		0xffffcfff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffcfff, 0xffc33fff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xf3ffffff, 0xffffffff, 0x55555555, 0x55555555,
+		0xf7ff7555, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0x03ffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xf555ffff,
+	},
+	{
+		0xffffffff, 0xfffffcff, 0xffffffff, 0xfffffcff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xf3ffffcf, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xfff3ffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xff03ffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xfffc3fff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xfffffffc, 0x3c0003ff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xf0000000,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xcccccfff, 0xffffffcf, 0xffffffff, 0xf33ffcff,
+		0xfffffc30, 0xffffffff, 0x003fffff, 0xffffff00,
+		0xffffffff, 0xffffffff, 0xff0fffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffcfff, 0xffffff0f,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffff3fff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xfffd5555, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0x000000c0, 0xf3fc000c, 0xfff0fcff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0x00000000, 0x00000000, 0x00000000, 0x003ff000,
+	},
+	{
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0xdf100000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0xddd00000,
+	},
+	{
+		0x00000000, 0xf000f000, 0x00000000, 0x00000000,
+		0xf000f000, 0x33330000, 0x00000000, 0xf0000000,
+		0x00000000, 0x00000000, 0x00000000, 0xcc000c00,
+		0x00000c03, 0x03000f00, 0x00000000, 0xf0000c0f,
+	},
+	{
+		0xfffffff0, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xfc000000, 0x000003f3, 0xfffffffc,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xff0fcfff, 0xffffffdf,
+		0xffffffff, 0xffffffff, 0x55555555, 0xffffffff,
+		0xffffff7f, 0xff0fffff, 0xcfffffff, 0xffffffff,
+		0x03ffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xfcf3fcff, 0xffffffff, 0xffffccff, 0xffffffff,
+		0xfff33cf3, 0xffffffff, 0x03ffffcc, 0xfff0f0f0,
+		0xfff0f0f0, 0xffffffff, 0x00ffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xf00fff00, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffc3ffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x55555fff,
+		0x55555555, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xfcffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x55555555, 0x55555555, 0xd5555555, 0xffffffff,
+		0xffffffff, 0xffffffff, 0x57777d5d, 0x5ffff7dd,
+		0xdddddddd, 0xdddddddd, 0xdddddddd, 0xdddddddd,
+		0xdddddddd, 0xdddddddd, 0x377fffdd, 0xffffffd0,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+	},
+	{
+		0xffffffff, 0xffffffff, 0x000fffff, 0xffffffff,
+		0xccffffff, 0xcccccccc, 0xfff333cc, 0xf0c30c30,
+		0xffffffff, 0xcfc3fcff, 0xccffffff, 0xcccccccc,
+		0xfff333cc, 0xf0c30c30, 0xffffffff, 0xcfc03cff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xdddddddd, 0xdddddddd, 0x3ddddddd, 0xf00000ff,
+		0xdddddddd, 0x0fdddddd, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfffffff0,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xdddddddf, 0xdddddddf,
+		0xdddddddd, 0xdddddddd, 0xdddddddd, 0xd777ffff,
+		0xf77fdddd, 0xdddddfdd, 0xd55ddddd, 0xffffdd55,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffcfff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xfffffcff, 0xffffffff, 0x00000000, 0xfffffff0,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xf03fffff, 0xffffffff,
+		0xffffffff, 0xffffff3f, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffff3f,
+		0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x0ffc3c0c,
+		0xfffffff3, 0xffffffff, 0xffffffff, 0xffffcfff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x55555555,
+		0x55555555, 0x55555555, 0x55555555, 0x55555555,
+		0xffffffff, 0xffffffff, 0xf3ffffff, 0xffffffff,
+	},
+	{
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	},
+	{
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0x00000000, 0xffffff00, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xf0000000, 0xc00003cc, 0x000fc3cc, 0x00000000,
+		0x00000000, 0x00000000, 0xf0000000, 0x00000000,
+		0x00000000, 0x00000000, 0x00000000, 0x00000000,
+		0x00000000, 0xfff00000, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffd555, 0x03ff557f, 0x000fffff, 0xcc00c000,
+		0xc0000c30, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0x00000000, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0x55555557, 0xffd55555,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xf3ffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xfffffffc, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffc00fff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x55555555, 0x55555555, 0xffff5555, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x55555555,
+		0x55555555, 0xffffff55, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x33ffffff, 0xffffffff, 0xffffffff, 0x3fc0ffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffc3ff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0x55555555, 0x55555555, 0x55555555, 0xffffffd5,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffcfff, 0xffffffff, 0xffffffff, 0x3fffffff,
+		0xffffffff, 0xfccfffff, 0xff3fffff, 0xffc3ffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffc0, 0xffffffff, 0x0fffffff, 0xfffffc3f,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffff3f,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffcffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffc3ff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffc3ffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfcffffff,
+		0xf03fffff, 0xffffffff, 0xfc000fff, 0xfffffc00,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffcfcf, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xcc3fffff,
+		0xffffff0f, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0x3f0fffff,
+		0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffff0fff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xff3fffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0x55555555, 0x55555555,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xfffffc00,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffc000,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xcfffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0x0fffffff, 0x03f00000, 0x003fffc0,
+		0xff0003c0, 0xffffffff, 0xf00fffff, 0x003fffff,
+		0xfffffffc, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xfffffc0f, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x0000c000, 0x003c0000, 0xffc00c30, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffc000, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x55555555, 0x55555555, 0xfffffff5, 0xffffffff,
+		0xffc000ff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+	{
+		0x00000000, 0xf0000000, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	},
+};
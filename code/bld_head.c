@@ -14,5 +14,37 @@
 #include <linux/types.h>
 #include <linux/nls.h>
 #include <linux/ctype.h>
+#include <linux/crc32c.h>
+#include <linux/prefetch.h>
+#include <asm/byteorder.h>
 #include "unicode.h"
 
+#ifdef APFS_UNICODE_STATS
+#include <linux/percpu.h>
+
+static DEFINE_PER_CPU(struct apfs_unistats, apfs_unistats);
+#define APFS_COUNT_ADD(counter, n)	this_cpu_add(apfs_unistats.counter, n)
+
+/**
+ * apfs_get_unistats - Read the normalization counters
+ * @stats:	on return, the sum of the counters of every cpu
+ */
+void apfs_get_unistats(struct apfs_unistats *stats)
+{
+	unsigned long *total = (unsigned long *)stats;
+	int cpu, i;
+
+	memset(stats, 0, sizeof(*stats));
+	for_each_possible_cpu(cpu) {
+		unsigned long *counters;
+
+		counters = (unsigned long *)per_cpu_ptr(&apfs_unistats, cpu);
+		for (i = 0; i < sizeof(*stats) / sizeof(*total); ++i)
+			total[i] += counters[i];
+	}
+}
+#else
+#define APFS_COUNT_ADD(counter, n)	do {} while (0)
+#endif
+#define APFS_COUNT(counter)		APFS_COUNT_ADD(counter, 1)
+
@@ -0,0 +1,537 @@
+/*
+ * Fuzzer for the user-space build of the normalization code. Every input is
+ * normalized with a cursor, with and without case folding, and the result is
+ * checked against a slow reference normalizer that reads the unicode data
+ * files directly. The work done for each input byte is also measured, and
+ * the inputs that maximize it are saved, to find the real worst case.
+ *
+ * It can be built for libFuzzer with something like:
+ *
+ *	clang -fsanitize=fuzzer -DAPFS_LIBFUZZER -DAPFS_UNICODE_STATS \
+ *		build/scripts/unicode.c build/scripts/fuzz.c
+ *
+ * Otherwise it has a main() of its own, which runs the inputs passed as files
+ * (so it can be used with AFL), or a simple mutational search when there are
+ * none.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "unicode.h"
+
+#ifndef APFS_UNICODE_STATS
+#error "The fuzzer needs the work counters, build with -DAPFS_UNICODE_STATS"
+#endif
+
+#define UNICODE_LIMIT	0x110000
+/* Longest input considered, the same as the limit for real names */
+#define MAX_INPUT	255
+/* Longest normalization of a single character, after case folding */
+#define MAX_EXPANSION	18
+
+/* Reference data, read straight from the files in the ucd directory */
+static unicode_t *ref_decomp[UNICODE_LIMIT];	/* Single level mappings */
+static unicode_t *ref_fold[UNICODE_LIMIT];	/* Full case foldings */
+static u8 ref_ccc[UNICODE_LIMIT];
+
+#define LINESIZE 1024
+
+/* Parse a list of hexadecimal code points into a new zero-terminated array */
+static unicode_t *parse_mapping(char *s)
+{
+	unicode_t mapping[19];
+	unicode_t *result;
+	int len = 0;
+
+	while (*s == ' ')
+		s++;
+	while (*s && *s != ';' && len < 18) {
+		mapping[len++] = strtoul(s, &s, 16);
+		while (*s == ' ')
+			s++;
+	}
+	mapping[len++] = 0;
+
+	result = malloc(len * sizeof(*result));
+	if (!result) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+	memcpy(result, mapping, len * sizeof(*result));
+	return result;
+}
+
+static void reference_init(void)
+{
+	char line[LINESIZE], decomp[LINESIZE], status[2];
+	unsigned int c, ccc;
+	FILE *file;
+
+	file = fopen("ucd/UnicodeData.txt", "r");
+	if (!file) {
+		printf("Failure to read unicode data!\n");
+		exit(1);
+	}
+	while (fgets(line, LINESIZE, file)) {
+		int ret;
+
+		decomp[0] = 0;
+		ret = sscanf(line, "%X;%*[^;];%*[^;];%u;%*[^;];%[^;];", &c,
+			     &ccc, decomp);
+		if (ret < 2 || c >= UNICODE_LIMIT)
+			continue;
+		ref_ccc[c] = ccc;
+		/* Canonical decompositions are the ones without a <tag> */
+		if (ret == 3 && decomp[0] != '<')
+			ref_decomp[c] = parse_mapping(decomp);
+	}
+	fclose(file);
+
+	file = fopen("ucd/CaseFolding.txt", "r");
+	if (!file) {
+		printf("Failure to read case folding data!\n");
+		exit(1);
+	}
+	while (fgets(line, LINESIZE, file)) {
+		if (sscanf(line, "%X; %1[^;]; %[^;];", &c, status, decomp) != 3)
+			continue;
+		if (status[0] != 'C' && status[0] != 'F') /* Full folding */
+			continue;
+		ref_fold[c] = parse_mapping(decomp);
+	}
+	fclose(file);
+}
+
+#define HANGUL_S_BASE	0xac00
+#define HANGUL_L_BASE	0x1100
+#define HANGUL_V_BASE	0x1161
+#define HANGUL_T_BASE	0x11a7
+#define HANGUL_T_COUNT	28
+#define HANGUL_N_COUNT	588
+#define HANGUL_S_COUNT	11172
+
+/* Full canonical decomposition of @c into @out; returns its length */
+static int ref_decompose(unicode_t c, unicode_t *out)
+{
+	const unicode_t *mapping;
+	int len = 0;
+
+	if (c - HANGUL_S_BASE < HANGUL_S_COUNT) {
+		int index = c - HANGUL_S_BASE;
+
+		out[len++] = HANGUL_L_BASE + index / HANGUL_N_COUNT;
+		out[len++] = HANGUL_V_BASE +
+			     (index % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+		if (index % HANGUL_T_COUNT)
+			out[len++] = HANGUL_T_BASE + index % HANGUL_T_COUNT;
+		return len;
+	}
+
+	mapping = ref_decomp[c];
+	if (!mapping) {
+		out[0] = c;
+		return 1;
+	}
+	for (; *mapping; ++mapping)
+		len += ref_decompose(*mapping, out + len);
+	return len;
+}
+
+/*
+ * Normalization of a single character: its full decomposition, and if
+ * requested the case folding of that, repeated until nothing changes.
+ */
+static int ref_normalize_char(unicode_t c, bool case_fold, unicode_t *out)
+{
+	unicode_t next[4 * MAX_EXPANSION];
+	int len, i;
+
+	len = ref_decompose(c, out);
+	while (case_fold) {
+		bool changed = false;
+		int next_len = 0;
+
+		for (i = 0; i < len; ++i) {
+			unicode_t decomp[MAX_EXPANSION];
+			int decomp_len, j;
+
+			decomp_len = ref_decompose(out[i], decomp);
+			for (j = 0; j < decomp_len; ++j) {
+				const unicode_t *fold = ref_fold[decomp[j]];
+
+				if (decomp_len > 1)
+					changed = true;
+				if (!fold) {
+					next[next_len++] = decomp[j];
+					continue;
+				}
+				changed = true;
+				for (; *fold; ++fold)
+					next[next_len++] = *fold;
+			}
+		}
+		if (!changed)
+			break;
+		memcpy(out, next, next_len * sizeof(*out));
+		len = next_len;
+	}
+	return len;
+}
+
+/* Strict UTF-8 decoder; returns the length of the sequence, or -1 */
+static int ref_decode(const u8 *s, int len, unicode_t *c)
+{
+	static const unicode_t min[] = {0, 0, 0x80, 0x800, 0x10000};
+	int count, i;
+
+	if (s[0] < 0x80) {
+		*c = s[0];
+		return 1;
+	}
+	if (s[0] >= 0xc0 && s[0] < 0xe0)
+		count = 2;
+	else if (s[0] >= 0xe0 && s[0] < 0xf0)
+		count = 3;
+	else if (s[0] >= 0xf0 && s[0] < 0xf8)
+		count = 4;
+	else
+		return -1;
+	if (len < count)
+		return -1;
+
+	*c = s[0] & (0x7f >> count);
+	for (i = 1; i < count; ++i) {
+		if ((s[i] & 0xc0) != 0x80)
+			return -1;
+		*c = *c << 6 | (s[i] & 0x3f);
+	}
+	if (*c < min[count] || *c >= UNICODE_LIMIT ||
+	    (*c >= 0xd800 && *c < 0xe000))
+		return -1;
+	return count;
+}
+
+/*
+ * Reference normalization of @len bytes from @s into @out; returns its length.
+ * Like the cursor, this stops at a NUL byte, and if the string has invalid
+ * UTF-8 it only normalizes the substrings that come before it. The cursor
+ * returns an ASCII char, or a two-byte starter that doesn't change, without
+ * looking at the rest of its substring, so those are kept too.
+ */
+static int ref_normalize(const u8 *s, int len, bool case_fold,
+			 unicode_t *out)
+{
+	int count = 0, boundary = 0;
+	bool boundary_kept = false;
+	int i, j;
+
+	while (len && *s) {
+		unicode_t c;
+		int utf8len, char_len;
+
+		utf8len = ref_decode(s, len, &c);
+		if (utf8len < 0) {
+			/* Drop the unfinished substring */
+			count = boundary + boundary_kept;
+			break;
+		}
+		char_len = ref_normalize_char(c, case_fold, out + count);
+		if (!count || !ref_ccc[out[count]]) {
+			boundary = count;
+			boundary_kept = c < 0x80 || (c < 0x800 && char_len == 1 &&
+					out[count] == c && !ref_ccc[c]);
+		}
+		count += char_len;
+		s += utf8len;
+		len -= utf8len;
+	}
+
+	/* Canonical ordering: a stable sort by ccc of each run of non-starters */
+	for (i = 1; i < count; ++i) {
+		unicode_t c = out[i];
+
+		if (!ref_ccc[c])
+			continue;
+		for (j = i; j > 0 && ref_ccc[out[j - 1]] > ref_ccc[c]; --j)
+			out[j] = out[j - 1];
+		out[j] = c;
+	}
+	return count;
+}
+
+/* Print @data as a C string, for the report of a failure */
+static void print_input(FILE *file, const u8 *data, size_t size)
+{
+	size_t i;
+
+	fprintf(file, "\"");
+	for (i = 0; i < size; ++i)
+		fprintf(file, "\\x%02x", data[i]);
+	fprintf(file, "\"\n");
+}
+
+static void fail(const char *msg, const u8 *data, size_t size, bool case_fold)
+{
+	printf("FAIL: %s%s for input ", msg, case_fold ? " when case folded" :
+							 "");
+	print_input(stdout, data, size);
+	fflush(stdout);
+	abort();
+}
+
+/* Shorter inputs are dominated by the fixed cost, so they never count */
+#define WORST_MIN_SIZE	16
+
+/* Largest amount of work per input byte seen so far */
+static double worst_ratio;
+/* Directory where the new worst cases get saved, if any */
+static const char *worst_dir;
+
+static void save_worst(const u8 *data, size_t size, double ratio)
+{
+	char path[4096];
+	FILE *file;
+
+	if (!worst_dir)
+		return;
+	snprintf(path, sizeof(path), "%s/worst-%08.3f", worst_dir, ratio);
+	file = fopen(path, "w");
+	if (!file)
+		return;
+	fwrite(data, 1, size, file);
+	fclose(file);
+}
+
+/*
+ * Check a single input; returns the work done for it per byte: the number of
+ * decoded characters and data lookups, for both kinds of normalization.
+ */
+static double fuzz_one(const u8 *data, size_t size)
+{
+	static unicode_t expected[MAX_INPUT * MAX_EXPANSION];
+	char name[MAX_INPUT + 1];
+	unsigned long work = 0;
+	double ratio;
+	int fold;
+
+	if (size > MAX_INPUT)
+		size = MAX_INPUT;
+	memcpy(name, data, size);
+	name[size] = 0;
+
+	for (fold = 0; fold < 2; ++fold) {
+		struct apfs_unistats before, after;
+		struct apfs_unicursor cursor;
+		int count, i;
+
+		count = ref_normalize(data, size, fold, expected);
+
+		apfs_get_unistats(&before);
+		apfs_init_unicursor(&cursor, name);
+		for (i = 0; i <= count; ++i) {
+			unicode_t c = apfs_normalize_next(&cursor, fold);
+
+			if (c != (i < count ? expected[i] : 0))
+				fail("wrong normalization", data, size, fold);
+		}
+		/* Once at the end, the cursor must stay there */
+		if (apfs_normalize_next(&cursor, fold))
+			fail("cursor went past the end", data, size, fold);
+		apfs_get_unistats(&after);
+		work += after.decodes - before.decodes +
+			after.lookups - before.lookups;
+	}
+
+	ratio = size ? (double)work / size : 0;
+	if (size >= WORST_MIN_SIZE && ratio > worst_ratio) {
+		worst_ratio = ratio;
+		save_worst(data, size, ratio);
+	}
+	return ratio;
+}
+
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+	reference_init();
+	worst_dir = getenv("APFS_FUZZ_WORST");
+	return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	fuzz_one(data, size);
+	return 0;
+}
+
+#ifndef APFS_LIBFUZZER
+
+/* Deterministic random numbers, so that a search can be repeated */
+static unsigned long long rand_state = 0x9e3779b97f4a7c15ULL;
+
+static unsigned int rand_next(void)
+{
+	rand_state ^= rand_state >> 12;
+	rand_state ^= rand_state << 25;
+	rand_state ^= rand_state >> 27;
+	return (rand_state * 0x2545f4914f6cdd1dULL) >> 32;
+}
+
+/* Pieces that are likely to make the normalization interesting */
+static const char *const dictionary[] = {
+	"a", "Z", "\xcc\x81" /* U+0301 */, "\xcc\x96" /* U+0316 */,
+	"\xcd\x85" /* U+0345 */, "\xd6\xb0" /* U+05B0 */,
+	"\xe1\xbe\x80" /* U+1F80 */, "\xe0\xbd\xb3" /* U+0F73 */,
+	"\xea\xb0\x80" /* U+AC00 */, "\xef\xac\xac" /* U+FB2C */,
+	"\xf0\x9d\x85\x9e" /* U+1D15E */, "\xcd\x84" /* U+0344 */,
+	"\xc3\x89" /* U+00C9 */, "\xe1\xba\x9e" /* U+1E9E */,
+	"\xff", "\xc3", "\xed\xa0\x80",
+};
+
+#define DICTIONARY_SIZE	(sizeof(dictionary) / sizeof(dictionary[0]))
+
+struct fuzz_input {
+	u8 data[MAX_INPUT];
+	int size;
+};
+
+/* Apply a random change to @input */
+static void mutate(struct fuzz_input *input)
+{
+	int pos = input->size ? rand_next() % input->size : 0;
+	int len, room = MAX_INPUT - input->size;
+	const char *piece;
+
+	switch (rand_next() % 6) {
+	case 0: /* Change a byte */
+		if (input->size)
+			input->data[pos] = rand_next();
+		return;
+	case 1: /* Remove a few bytes */
+		len = rand_next() % 8 + 1;
+		if (len > input->size - pos)
+			len = input->size - pos;
+		memmove(input->data + pos, input->data + pos + len,
+			input->size - pos - len);
+		input->size -= len;
+		return;
+	case 2: /* Repeat a range of bytes, sometimes a long one */
+		len = rand_next() % 2 ? rand_next() % 16 + 1 : input->size;
+		if (len > input->size - pos)
+			len = input->size - pos;
+		if (len > room)
+			len = room;
+		memmove(input->data + pos + len, input->data + pos,
+			input->size - pos);
+		input->size += len;
+		return;
+	default: /* Insert a piece from the dictionary */
+		piece = dictionary[rand_next() % DICTIONARY_SIZE];
+		len = strlen(piece);
+		if (len > room)
+			return;
+		memmove(input->data + pos + len, input->data + pos,
+			input->size - pos);
+		memcpy(input->data + pos, piece, len);
+		input->size += len;
+		return;
+	}
+}
+
+#define CORPUS_MAX	4096
+
+static void usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-n iterations] [-s seed] [-w worst_dir] [files...]\n",
+		prog);
+	exit(1);
+}
+
+/* Run the inputs from some files, or search for the worst case if none */
+int main(int argc, char *argv[])
+{
+	static struct fuzz_input corpus[CORPUS_MAX];
+	long iterations = 1000000, i;
+	int corpus_size = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:s:w:")) != -1) {
+		switch (opt) {
+		case 'n':
+			iterations = atol(optarg);
+			break;
+		case 's':
+			rand_state ^= strtoull(optarg, NULL, 0);
+			break;
+		case 'w':
+			worst_dir = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	reference_init();
+
+	if (optind < argc) {
+		for (i = optind; i < argc; ++i) {
+			struct fuzz_input input;
+			FILE *file = fopen(argv[i], "r");
+
+			if (!file) {
+				perror(argv[i]);
+				exit(1);
+			}
+			input.size = fread(input.data, 1, MAX_INPUT, file);
+			fclose(file);
+			printf("%s: %.3f units of work per byte\n", argv[i],
+			       fuzz_one(input.data, input.size));
+		}
+		return 0;
+	}
+
+	/* Start from one of each dictionary piece */
+	for (i = 0; i < DICTIONARY_SIZE; ++i) {
+		struct fuzz_input *input = &corpus[corpus_size++];
+
+		input->size = strlen(dictionary[i]);
+		memcpy(input->data, dictionary[i], input->size);
+	}
+
+	for (i = 0; i < iterations; ++i) {
+		struct fuzz_input input;
+		double old_worst = worst_ratio, ratio;
+		int changes, parent_size;
+
+		/* Newer entries in the corpus are the worse ones, so favor them */
+		if (rand_next() % 2)
+			input = corpus[corpus_size - 1 - rand_next() % 8 %
+				       corpus_size];
+		else
+			input = corpus[rand_next() % corpus_size];
+		parent_size = input.size;
+		for (changes = rand_next() % 4 + 1; changes; --changes)
+			mutate(&input);
+
+		ratio = fuzz_one(input.data, input.size);
+		if (corpus_size == CORPUS_MAX)
+			continue;
+		/*
+		 * Keep the new worst cases, and also longer inputs that come
+		 * close, because the cost of some patterns grows with length.
+		 */
+		if (worst_ratio > old_worst ||
+		    (input.size > parent_size && ratio > 0.9 * worst_ratio) ||
+		    (input.size < WORST_MIN_SIZE && !(rand_next() % 64)))
+			corpus[corpus_size++] = input;
+	}
+
+	printf("Checked %ld inputs, the worst took %.3f units of work per byte\n",
+	       iterations, worst_ratio);
+	return 0;
+}
+
+#endif /* APFS_LIBFUZZER */
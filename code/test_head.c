@@ -3,20 +3,66 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
 #include "unicode.h"
 
 #define ENOMEM 1
 #define EINVAL 2
+#define EIO 3
 
 typedef uint16_t u16;
 
+typedef uint32_t __le32;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define cpu_to_le32(x)	((__le32)(x))
+#else
+#define cpu_to_le32(x)	((__le32)__builtin_bswap32(x))
+#endif
+
 #define likely(x)	__builtin_expect(!!(x), 1)
+#define unlikely(x)	__builtin_expect(!!(x), 0)
+#define __aligned(x)	__attribute__((aligned(x)))
+#define prefetch(x)	__builtin_prefetch(x)
 
 #define swap(a, b) \
 	do { typeof(a) __tmp = (a); (a) = (b); (b) = __tmp; } while (0)
 
 #define isascii(c) (((unsigned char)(c))<=0x7f)
-#define tolower(c) (c)	/* We don't test case folding */
+#define tolower(c) (((c) >= 'A' && (c) <= 'Z') ? (c) + 'a' - 'A' : (c))
+
+static inline int fls(unsigned int x)
+{
+	return x ? 32 - __builtin_clz(x) : 0;
+}
+
+#ifdef APFS_UNICODE_STATS
+/* There are no per-cpu variables in user space, so count per thread */
+static __thread struct apfs_unistats apfs_unistats;
+#define APFS_COUNT_ADD(counter, n)	(apfs_unistats.counter += (n))
+
+/* Copy the counters of the calling thread to @stats */
+void apfs_get_unistats(struct apfs_unistats *stats)
+{
+	*stats = apfs_unistats;
+}
+#else
+#define APFS_COUNT_ADD(counter, n)	do {} while (0)
+#endif
+#define APFS_COUNT(counter)		APFS_COUNT_ADD(counter, 1)
 
 static inline void kfree(void *ptr)
 {
@@ -37,6 +83,98 @@ static inline void *kmalloc_array(size_t n, size_t size, unsigned int flags)
 	return kmalloc(n * size, flags);
 }
 
+/*
+ * Replacement for the kernel's crc32c(): the CRC32C of a buffer, starting from
+ * @crc and without a final inversion. The kernel picks the fastest version it
+ * has at runtime; here it's decided at build time.
+ */
+#if defined(__SSE4_2__)
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	const u8 *p = address;
+
+#ifdef __x86_64__
+	for (; length >= 8; length -= 8, p += 8) {
+		uint64_t word;
+
+		memcpy(&word, p, sizeof(word));
+		crc = _mm_crc32_u64(crc, word);
+	}
+#endif
+	for (; length; --length)
+		crc = _mm_crc32_u8(crc, *p++);
+	return crc;
+}
+
+#elif defined(__ARM_FEATURE_CRC32)
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	const u8 *p = address;
+
+	for (; length >= 8; length -= 8, p += 8) {
+		uint64_t word;
+
+		memcpy(&word, p, sizeof(word));
+		crc = __crc32cd(crc, word);
+	}
+	for (; length; --length)
+		crc = __crc32cb(crc, *p++);
+	return crc;
+}
+
+#else /* Slice-by-8 */
+
+#define CRC32C_POLY_LE	0x82f63b78
+
+static u32 crc32c_table[8][256];
+
+/* Filled before main(), so that threads never see a partial table */
+static void __attribute__((constructor)) crc32c_init_table(void)
+{
+	int i, j;
+
+	for (i = 0; i < 256; ++i) {
+		u32 crc = i;
+
+		for (j = 0; j < 8; ++j)
+			crc = (crc >> 1) ^ (crc & 1 ? CRC32C_POLY_LE : 0);
+		crc32c_table[0][i] = crc;
+	}
+	for (i = 0; i < 256; ++i) {
+		for (j = 1; j < 8; ++j)
+			crc32c_table[j][i] = (crc32c_table[j - 1][i] >> 8) ^
+				crc32c_table[0][crc32c_table[j - 1][i] & 0xff];
+	}
+}
+
+static inline u32 crc32c_load_le(const u8 *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (u32)p[3] << 24;
+}
+
+static u32 crc32c(u32 crc, const void *address, unsigned int length)
+{
+	u32 (*t)[256] = crc32c_table;
+	const u8 *p = address;
+
+	for (; length >= 8; length -= 8, p += 8) {
+		u32 lo = crc32c_load_le(p) ^ crc;
+		u32 hi = crc32c_load_le(p + 4);
+
+		crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+		      t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+		      t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+		      t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+	}
+	for (; length; --length)
+		crc = t[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+	return crc;
+}
+
+#endif
+
 /*
  * Sample implementation from Unicode home page.
  * http://www.stonehand.com/unicode/standard/fss-utf.html
@@ -127,130 +265,3 @@ int utf32_to_utf8(unicode_t u, u8 *s, int maxout)
 	}
 	return -1;
 }
-
-static int unilength(unsigned int *um)
-{
-	int length = 0;
-
-	if (!um)
-		return 0;
-
-	for (; *um; um++)
-		length++;
-
-	return length;
-}
-
-/* Test if @str normalizes to @norm and print the result */
-void test_normalization(unicode_t *str, unicode_t *norm)
-{
-	struct apfs_unicursor cursor;
-	int maxlen;
-	u8 *utf8str, *utf8curr;
-
-	maxlen = unilength(str) * 4 + 1; /* 4 UTF-8 bytes top, for each char */
-	utf8str = malloc(maxlen);
-	if (!utf8str) {
-		printf("Memory allocation failure!\n");
-		exit(1);
-	}
-
-	utf8curr = utf8str;
-	for (; *str; str++) {
-		int len;
-
-		len = utf32_to_utf8(*str, utf8curr, maxlen);
-		if (len < 0) /* Invalid UTF-32, ignore */
-			goto out;
-		utf8curr += len;
-		maxlen -= len;
-	}
-	*utf8curr = 0;
-
-	apfs_init_unicursor(&cursor, utf8str);
-	while (1) {
-		unicode_t curr;
-
-		curr = apfs_normalize_next(&cursor, false /* case_fold */);
-		if (curr != *norm) {
-			printf("FAIL: wrong NFD for string %s\n", utf8str);
-			break;
-		}
-		if (!curr) {
-			printf("Successful test for string %s\n", utf8str);
-			break;
-		}
-		norm++;
-	}
-
-out:
-	free(utf8str);
-}
-
-/* Test if all chars between @prev and @curr normalize to themselves */
-void test_unlisted_chars(unicode_t prev, unicode_t curr)
-{
-	unicode_t unichar[2];
-
-	unichar[1] = 0;
-	for (unichar[0] = prev + 1; unichar[0] < curr; ++unichar[0])
-		test_normalization(unichar, unichar);
-}
-
-#define LINESIZE 1024
-char line[LINESIZE];
-char col[5][LINESIZE];
-
-/* Parse the tests and run them */
-int main()
-{
-	unicode_t map[5][19];
-	FILE *file;
-	int part = 0;
-
-	file = fopen("ucd/NormalizationTest.txt", "r");
-	if (!file) {
-		printf("Failure to read test data!\n");
-		exit(1);
-	}
-
-	while (fgets(line, LINESIZE, file)) {
-		int ret;
-		unicode_t prev;
-		int i;
-
-		/* Part1 needs additional tests for unlisted chars */
-		sscanf(line, "@Part%d", &part);
-
-		/* The docs count columns from one, so ci is col[i-1] here */
-		ret = sscanf(line, "%[^#;];%[^;];%[^;];%[^;];%[^;];",
-			     col[0], col[1], col[2], col[3], col[4]);
-		if (ret != 5)
-			continue;
-
-		if (part == 1)
-			prev = map[0][0];
-		for (i = 0; i < 5; ++i) {
-			int j = 0;
-			char *s = col[i];
-
-			while (*s)
-				map[i][j++] = strtoul(s, &s, 16);
-			map[i][j] = 0;
-		}
-
-		if (part == 1)
-			test_unlisted_chars(prev, map[0][0]);
-
-		/* Expected normalizations in the tests provided by unicode */
-		test_normalization(map[0], map[2]);
-		test_normalization(map[1], map[2]);
-		test_normalization(map[2], map[2]);
-		test_normalization(map[3], map[4]);
-		test_normalization(map[4], map[4]);
-	}
-
-	fclose(file);
-	return 0;
-}
-
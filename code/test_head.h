@@ -1,7 +1,17 @@
 #ifndef _APFS_UNICODE_H
 #define _APFS_UNICODE_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 typedef uint32_t unicode_t;
 typedef uint8_t u8;
+typedef uint32_t u32;
+typedef uint64_t u64;
+
+/* Shared with the tests, like the kernel's <linux/nls.h> */
+extern int utf32_to_utf8(unicode_t u, u8 *s, int maxout);
+
+/* The tables can be loaded from a file, see apfs_load_unitables() */
+#define APFS_LOADABLE_TABLES
@@ -1,59 +1,403 @@
+/*
+ * Normalization data for a single character. The nfd field holds the position
+ * and length of the character's decomposition in apfs_nfd, and nfdcf holds
+ * those of the case folding of its decomposition in apfs_nfdcf; they are zero
+ * if the character maps to itself.
+ */
+struct apfs_unidata {
+	u16 nfd;
+	u16 nfdcf;
+	u8 ccc;
+};
+
 /* The arrays of unicode data are defined at the bottom of the file */
-/* TODO: would a single trie with all the data be more efficient? */
-static u16 apfs_nfd_trie[];
-static unicode_t apfs_nfd[];
-static u16 apfs_cf_trie[];
-static unicode_t apfs_cf[];
-static u8 apfs_ccc_trie[];
+#ifdef APFS_UNIDATA_HASH
+static const u16 apfs_hash_disp[];
+static const u32 apfs_hash_slots[];
+#else
+static const u16 apfs_trie[];
+#endif
+static const struct apfs_unidata apfs_unidata[];
+static const struct apfs_unidata apfs_unidata_2byte[];
+static const u16 apfs_nfd[];
+static const u16 apfs_nfdcf[];
+static const u32 apfs_value_wide[];
+static const u32 apfs_nfd_esc[];
+static const u32 apfs_nfdcf_esc[];
+static const u8 apfs_qc_planes[];
+static const u8 apfs_qc_blocks[][256];
+static const u32 apfs_qc_leaves[][16];
+
+#ifndef APFS_UNIDATA_HASH
+/*
+ * The shape of the trie is chosen by mktrie, which defines TRIE_HEIGHT and
+ * the key bits, shift and array position for each level, from the root down.
+ * Every node on a level has one child for each possible value of its bits.
+ */
+static const u8 apfs_trie_bits[TRIE_HEIGHT] = TRIE_LEVEL_BITS;
+static const u8 apfs_trie_shift[TRIE_HEIGHT] = TRIE_LEVEL_SHIFT;
+static const int apfs_trie_base[TRIE_HEIGHT] = TRIE_LEVEL_BASE;
+#endif
+
+#ifdef APFS_LOADABLE_TABLES
+/*
+ * In user space the tables may also come from a file built by mktrie, which
+ * is mapped and used in place; see apfs_load_unitables(). The lookups reach
+ * them through apfs_tables, which points to the built-in arrays by default.
+ */
+#define APFS_UNITABLES_MAX_HEIGHT	8
+
+struct apfs_unitables {
+	const u16 *trie;
+	const struct apfs_unidata *unidata;
+	const struct apfs_unidata *unidata_2byte;
+	const u16 *nfd;
+	const u16 *nfdcf;
+	const u32 *value_wide;
+	const u32 *nfd_esc;
+	const u32 *nfdcf_esc;
+	const u8 *qc_planes;
+	const u8 (*qc_blocks)[256];
+	const u32 (*qc_leaves)[16];
+	int trie_height;
+	const u8 *trie_bits;
+	const u8 *trie_shift;
+	const int *trie_base;
+	const u16 *hash_disp;
+	const u32 *hash_slots;
+	u32 hash_buckets;
+	u32 hash_size;
+};
+
+/* Only the lookup method that was selected by mktrie is built in */
+static const struct apfs_unitables apfs_builtin_tables = {
+	.unidata	= apfs_unidata,
+	.unidata_2byte	= apfs_unidata_2byte,
+	.nfd		= apfs_nfd,
+	.nfdcf		= apfs_nfdcf,
+	.value_wide	= apfs_value_wide,
+	.nfd_esc	= apfs_nfd_esc,
+	.nfdcf_esc	= apfs_nfdcf_esc,
+	.qc_planes	= apfs_qc_planes,
+	.qc_blocks	= apfs_qc_blocks,
+	.qc_leaves	= apfs_qc_leaves,
+#ifdef APFS_UNIDATA_HASH
+	.hash_disp	= apfs_hash_disp,
+	.hash_slots	= apfs_hash_slots,
+	.hash_buckets	= HASH_BUCKETS,
+	.hash_size	= HASH_SLOTS,
+#else
+	.trie		= apfs_trie,
+	.trie_height	= TRIE_HEIGHT,
+	.trie_bits	= apfs_trie_bits,
+	.trie_shift	= apfs_trie_shift,
+	.trie_base	= apfs_trie_base,
+#endif
+};
 
-#define TRIE_HEIGHT		5
+static const struct apfs_unitables *apfs_tables = &apfs_builtin_tables;
 
-/* A trie node has one child for each possible nibble in the key */
-#define TRIE_CHILD_SHIFT	4
-#define TRIE_CHILD_MASK		((1 << TRIE_CHILD_SHIFT) - 1)
+#define APFS_TABLE(name)	(apfs_tables->name)
+#define APFS_TRIE_HEIGHT	(apfs_tables->trie_height)
+#define APFS_HASH_BUCKETS	(apfs_tables->hash_buckets)
+#define APFS_HASH_SLOTS		(apfs_tables->hash_size)
+#else
+#define APFS_TABLE(name)	(apfs_##name)
+#define APFS_TRIE_HEIGHT	TRIE_HEIGHT
+#define APFS_HASH_BUCKETS	HASH_BUCKETS
+#define APFS_HASH_SLOTS		HASH_SLOTS
+#endif	/* APFS_LOADABLE_TABLES */
 
 /* A trie value length is stored in the last three bits of its position */
 #define TRIE_POS_SHIFT		3
 #define TRIE_SIZE_MASK		((1 << TRIE_POS_SHIFT) - 1)
 
+/*
+ * Values that are too long or too far into their array for that encoding
+ * have a length of zero. Their position is then an index into the escape
+ * array for the table, which has the length in the low byte of each entry
+ * and the real position above it.
+ */
+#define ESC_POS_SHIFT		8
+#define ESC_SIZE_MASK		((1 << ESC_POS_SHIFT) - 1)
+
+/*
+ * The value arrays have 16-bit entries. Starters from the BMP are stored as
+ * they are, and the other characters as a surrogate code point, which gives
+ * their position in apfs_value_wide.
+ */
+#define VALUE_WIDE_FIRST	0xd800
+#define VALUE_WIDE_COUNT	0x800
+
+/* Each wide value, and each normalized character, has its ccc on top */
+#define VALUE_CCC_SHIFT		24
+#define VALUE_CHAR_MASK		((1 << VALUE_CCC_SHIFT) - 1)
+
+/* Longest normalization of a single character */
+#define APFS_VALUE_MAX_LEN	8
+
+/*
+ * Each slot of the perfect hash holds a character, in its low bits, and the
+ * index of its record above them.
+ */
+#define HASH_KEY_BITS		18
+#define HASH_KEY_MASK		((1 << HASH_KEY_BITS) - 1)
+
+#ifdef APFS_UNIDATA_HASH
+/*
+ * The hash functions must be the same ones that mktrie used to build the
+ * tables. This is an integer hash with full avalanche, so that every key bit
+ * counts.
+ */
+static inline u32 apfs_hash_mix(u32 x)
+{
+	x ^= x >> 16;
+	x *= 0x7feb352d;
+	x ^= x >> 15;
+	x *= 0x846ca68b;
+	x ^= x >> 16;
+	return x;
+}
+
+/* Map a hash to the range [0, @n), without a division */
+static inline u32 apfs_hash_range(u32 hash, u32 n)
+{
+	return ((u64)hash * n) >> 32;
+}
+
+/* Position of the displacement for a hashed key */
+static inline u32 apfs_hash_bucket(u32 hash)
+{
+	return apfs_hash_range(hash, APFS_HASH_BUCKETS);
+}
+
+/* Position of the slot for a hashed key, given its displacement */
+static inline u32 apfs_hash_slot(u32 hash, u16 disp)
+{
+	return apfs_hash_range(apfs_hash_mix(hash + disp), APFS_HASH_SLOTS);
+}
+
+/* Index of the record in slot @entry, if it belongs to @key, or else zero */
+static inline int apfs_hash_index(u32 entry, unicode_t key)
+{
+	if ((entry & HASH_KEY_MASK) != key) {
+		APFS_COUNT(hash_misses);
+		return 0;
+	}
+	return entry >> HASH_KEY_BITS;
+}
+
 /**
- * apfs_trie_find - Look up a trie value
- * @trie:	trie to search
+ * apfs_hash_find - Look up the normalization data for a character
  * @key:	search key (a unicode character)
- * @result:	on return, this either holds the value (on a ccc lookup) or its
- *		position in the value array (on a cf or nfd lookup).
- * @is_ccc:	true if this a ccc (canonical combining class) lookup
  *
- * Returns the length of the value (0 if it doesn't exist).
+ * Every character with a record, outside the two-byte range, has its own
+ * slot in the perfect hash; the others land on the slot of some other key,
+ * and the check sends them to the first record, which is all zeroes. This
+ * takes two loads before the record, however sparse the data is around @key.
  */
-static int apfs_trie_find(void *trie, unicode_t key, void *result, bool is_ccc)
+static const struct apfs_unidata *apfs_hash_find(unicode_t key)
+{
+	u32 hash = apfs_hash_mix(key);
+	u16 disp = APFS_TABLE(hash_disp)[apfs_hash_bucket(hash)];
+	u32 entry = APFS_TABLE(hash_slots)[apfs_hash_slot(hash, disp)];
+
+	APFS_COUNT(hash_probes);
+	return &APFS_TABLE(unidata)[apfs_hash_index(entry, key)];
+}
+#else
+/**
+ * apfs_trie_find - Look up the normalization data for a character
+ * @key:	search key (a unicode character)
+ *
+ * Returns the data record for @key; the first record is all zeroes, and it's
+ * used for all characters that don't require any changes.
+ */
+static const struct apfs_unidata *apfs_trie_find(unicode_t key)
 {
 	int node = 0;
 	int h;
 
-	for (h = TRIE_HEIGHT - 1; h >= 0; --h) {
-		int child = (key >> (TRIE_CHILD_SHIFT * h)) & TRIE_CHILD_MASK;
-		int child_index = (node << TRIE_CHILD_SHIFT) + child;
-
-		if (is_ccc)
-			node = ((u8 *)trie)[child_index];
-		else
-			node = ((u16 *)trie)[child_index];
+	APFS_COUNT(trie_walks);
+	for (h = 0; h < APFS_TRIE_HEIGHT; ++h) {
+		int bits = APFS_TABLE(trie_bits)[h];
+		int shift = APFS_TABLE(trie_shift)[h];
+		int child = (key >> shift) & ((1 << bits) - 1);
+		int child_index = APFS_TABLE(trie_base)[h] + (node << bits) +
+				  child;
 
+		node = APFS_TABLE(trie)[child_index];
 		if (node == 0) {
-			*(u8 *)result = 0;
-			return 0;
+			APFS_COUNT(trie_misses[h < APFS_STATS_LEVELS ? h :
+					       APFS_STATS_LEVELS - 1]);
+			break;
 		}
 	}
 
-	if (is_ccc) {
-		/* ccc values fit in one byte, so no need for a value array */
-		*(u8 *)result = node;
-		return 1;
+	/* On the last level, the node is the index of the record */
+	return &APFS_TABLE(unidata)[node];
+}
+#endif	/* APFS_UNIDATA_HASH */
+
+/* Characters with a two-byte UTF-8 encoding have their own flat table */
+#define UTF8_2BYTE_FIRST	0x80
+#define UTF8_2BYTE_LAST		0x7ff
+
+/**
+ * apfs_unidata_find - Get the normalization data for a character
+ * @key:	the character
+ *
+ * Most non-ASCII names are written in scripts from the two-byte UTF-8 range,
+ * so those characters skip the trie walk and use a direct table lookup.
+ */
+static inline const struct apfs_unidata *apfs_unidata_find(unicode_t key)
+{
+	APFS_COUNT(lookups);
+	if (key - UTF8_2BYTE_FIRST <= UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST)
+		return &APFS_TABLE(unidata_2byte)[key - UTF8_2BYTE_FIRST];
+#ifdef APFS_UNIDATA_HASH
+	return apfs_hash_find(key);
+#else
+	return apfs_trie_find(key);
+#endif
+}
+
+/* Number of characters that apfs_unicursor_fill() decodes at a time */
+#define APFS_UNICURSOR_BATCH	8
+
+/**
+ * apfs_unidata_find_batch - Look up the normalization data for several keys
+ * @keys:	search keys, none of them in the two-byte range
+ * @count:	number of keys, up to APFS_UNICURSOR_BATCH
+ * @data:	on return, the data record for each key
+ *
+ * Each lookup in the trie is a chain of dependent loads, so when they are
+ * done one after the other, every cache miss waits for the one before it.
+ * Here the walks for all the keys go down the trie together, one level at a
+ * time, so that their misses overlap; the row of the next level, or the
+ * record, is prefetched as soon as its position is known. The perfect hash
+ * is handled the same way: the displacements, then the slots, and then the
+ * records are read for all the keys in turn.
+ */
+#ifdef APFS_UNIDATA_HASH
+static void apfs_unidata_find_batch(const unicode_t *keys, int count,
+				    const struct apfs_unidata **data)
+{
+	u32 hash[APFS_UNICURSOR_BATCH], slot[APFS_UNICURSOR_BATCH];
+	int i;
+
+	APFS_COUNT_ADD(lookups, count);
+	APFS_COUNT_ADD(hash_probes, count);
+	for (i = 0; i < count; ++i) {
+		hash[i] = apfs_hash_mix(keys[i]);
+		prefetch(&APFS_TABLE(hash_disp)[apfs_hash_bucket(hash[i])]);
+	}
+	for (i = 0; i < count; ++i) {
+		u16 disp = APFS_TABLE(hash_disp)[apfs_hash_bucket(hash[i])];
+
+		slot[i] = apfs_hash_slot(hash[i], disp);
+		prefetch(&APFS_TABLE(hash_slots)[slot[i]]);
 	}
+	for (i = 0; i < count; ++i) {
+		u32 entry = APFS_TABLE(hash_slots)[slot[i]];
+
+		data[i] = &APFS_TABLE(unidata)[apfs_hash_index(entry, keys[i])];
+		prefetch(data[i]);
+	}
+}
+#else
+static void apfs_unidata_find_batch(const unicode_t *keys, int count,
+				    const struct apfs_unidata **data)
+{
+	int node[APFS_UNICURSOR_BATCH] = {0};
+	int h, i;
+
+	APFS_COUNT_ADD(lookups, count);
+	APFS_COUNT_ADD(trie_walks, count);
+	for (h = 0; h < APFS_TRIE_HEIGHT; ++h) {
+		int bits = APFS_TABLE(trie_bits)[h];
+		int shift = APFS_TABLE(trie_shift)[h];
+		int base = APFS_TABLE(trie_base)[h];
+		bool last = h == APFS_TRIE_HEIGHT - 1;
+		int next_base = 0, next_bits = 0;
+
+		if (!last) {
+			next_base = APFS_TABLE(trie_base)[h + 1];
+			next_bits = APFS_TABLE(trie_bits)[h + 1];
+		}
+		for (i = 0; i < count; ++i) {
+			int child = (keys[i] >> shift) & ((1 << bits) - 1);
+
+			/* Empty children are never walked, so they stay 0 */
+			if (h && !node[i])
+				continue;
+			node[i] = APFS_TABLE(trie)[base + (node[i] << bits) +
+						   child];
+			if (!node[i])
+				APFS_COUNT(trie_misses[h < APFS_STATS_LEVELS ?
+						h : APFS_STATS_LEVELS - 1]);
+			else if (!last)
+				prefetch(&APFS_TABLE(trie)[next_base +
+						(node[i] << next_bits)]);
+			else
+				prefetch(&APFS_TABLE(unidata)[node[i]]);
+		}
+	}
+
+	/* On the last level, the node is the index of the record */
+	for (i = 0; i < count; ++i)
+		data[i] = &APFS_TABLE(unidata)[node[i]];
+}
+#endif	/* APFS_UNIDATA_HASH */
 
-	*(u16 *)result = node >> TRIE_POS_SHIFT;
-	return node & TRIE_SIZE_MASK;
+/**
+ * apfs_init_unicursor_len - Initialize a cursor for a string of known length
+ * @cursor:	cursor to initialize
+ * @utf8str:	string to normalize, not necessarily NUL-terminated
+ * @len:	length of @utf8str; a NUL byte also ends the string
+ *
+ * Names read from disk can be normalized in place this way, without copying
+ * them to a NUL-terminated buffer first.
+ */
+void apfs_init_unicursor_len(struct apfs_unicursor *cursor,
+			     const char *utf8str, int len)
+{
+	cursor->utf8curr = utf8str;
+	cursor->utf8end = utf8str + len;
+	cursor->buf_len = 0;
+	cursor->buf_pos = 0;
+	cursor->more = false;
+	cursor->stream_safe = APFS_STREAM_SAFE_OFF;
+	cursor->nonstarters = 0;
+	cursor->segs = NULL;
+}
+
+/**
+ * apfs_init_unicursor_segs - Initialize a cursor for a segmented string
+ * @cursor:	cursor to initialize
+ * @state:	room for the state of the cursor across segments
+ * @segs:	pieces of the string to normalize, in order
+ * @count:	number of pieces; must be at least one
+ *
+ * For strings that are not contiguous in memory, like a name that crosses
+ * the boundary between two blocks. The segments are read in place, and
+ * @segs and @state must remain valid while the cursor is in use. A NUL byte
+ * in any of them ends the string.
+ *
+ * The few bytes around each boundary get copied to @state, so that a
+ * substring can be decoded across it. A substring longer than that buffer
+ * (which is not possible in a valid name, or in Stream-Safe text) is rejected
+ * like invalid UTF-8 if it crosses a boundary.
+ */
+void apfs_init_unicursor_segs(struct apfs_unicursor *cursor,
+			      struct apfs_unisegs *state,
+			      const struct apfs_unisegment *segs, int count)
+{
+	apfs_init_unicursor_len(cursor, segs->ptr, segs->len);
+	state->next = segs + 1;
+	state->count = count - 1;
+	state->off = 0;
+	cursor->segs = state;
 }
 
 /**
@@ -63,10 +407,31 @@ static int apfs_trie_find(void *trie, unicode_t key, void *result, bool is_ccc)
  */
 void apfs_init_unicursor(struct apfs_unicursor *cursor, const char *utf8str)
 {
-	cursor->utf8curr = utf8str;
-	cursor->length = -1;
-	cursor->last_pos = -1;
-	cursor->last_ccc = 0;
+	apfs_init_unicursor_len(cursor, utf8str, strlen(utf8str));
+}
+
+/* Longest run of non-starters allowed by the Stream-Safe Text Format */
+#define STREAM_SAFE_MAX		30
+/* COMBINING GRAPHEME JOINER, the starter that breaks up longer runs */
+#define UNICODE_CGJ		0x034f
+
+/**
+ * apfs_unicursor_stream_safe - Set how a cursor handles long mark sequences
+ * @cursor:	cursor to set, before its first use
+ * @mode:	APFS_STREAM_SAFE to insert a CGJ before a character that would
+ *		make a run of more than 30 non-starters, as in UAX #15, or
+ *		APFS_STREAM_SAFE_STRICT to stop before it as if it were invalid
+ *
+ * The non-starters are counted in the normalized string. Without a limit,
+ * the work to reorder a run of them grows with its length, so a single name
+ * made of thousands of combining marks can keep the cpu busy; in either mode
+ * no substring has more than 30 non-starters. The output of APFS_STREAM_SAFE
+ * is not the plain normalization of such names, so their hashes will not
+ * match those computed by other implementations.
+ */
+void apfs_unicursor_stream_safe(struct apfs_unicursor *cursor, int mode)
+{
+	cursor->stream_safe = mode;
 }
 
 #define HANGUL_S_BASE	0xac00
@@ -97,16 +462,12 @@ static bool apfs_is_precomposed_hangul(unicode_t utf32char)
 	return (index >= 0 && index < HANGUL_S_COUNT);
 }
 
-/* Signals the end of the normalization for a single character */
-#define NORM_END	(unicode_t)(-1)
-
 /**
  * apfs_decompose_hangul - Decompose a Hangul syllable
  * @utf32char:	Hangul syllable to decompose
- * @off:	offset of the wanted character from the decomposition
+ * @buf:	on return, the decomposition of @utf32char
  *
- * Returns the single character at offset @off in the decomposition of
- * @utf32char, or NORM_END if this offset is past the end.
+ * Returns the length of the decomposition.
  *
  * This function was adapted from sample code in section 3.12 of the
  * Unicode Standard, version 9.0.
@@ -114,211 +475,1419 @@ static bool apfs_is_precomposed_hangul(unicode_t utf32char)
  * Copyright (C) 1991-2018 Unicode, Inc.  All rights reserved.  Distributed
  * under the Terms of Use in http://www.unicode.org/copyright.html.
  */
-static unicode_t apfs_decompose_hangul(unicode_t utf32char, int off)
+static int apfs_decompose_hangul(unicode_t utf32char, unicode_t *buf)
 {
 	int index;
-	int l, v, t;
+	int t;
 
 	index = utf32char - HANGUL_S_BASE;
 
-	l = HANGUL_L_BASE + index / HANGUL_N_COUNT;
-	if (off == 0)
-		return l;
-
-	v = HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT;
-	if (off == 1)
-		return v;
+	buf[0] = HANGUL_L_BASE + index / HANGUL_N_COUNT;
+	buf[1] = HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT;
 
 	t = HANGUL_T_BASE + index % HANGUL_T_COUNT;
-	if (off == 2 && t != HANGUL_T_BASE)
-		return t;
-
-	return NORM_END;
+	if (t == HANGUL_T_BASE)
+		return 2;
+	buf[2] = t;
+	return 3;
 }
 
 /**
  * apfs_normalize_char - Normalize a unicode character
  * @utf32char:	character to normalize
- * @off:	offset of the wanted character from the normalization
+ * @data:	normalization data for @utf32char, or NULL for ASCII and
+ *		Hangul syllables, which have none
  * @case_fold:	case fold the char?
+ * @norm:	on return, the normalization of @utf32char; there must be room
+ *		for APFS_VALUE_MAX_LEN characters
+ *
+ * Every character of the normalization has its canonical combining class in
+ * the top byte, like the entries of the wide value array.
  *
- * Returns the single character at offset @off in the normalization of
- * @utf32char, or NORM_END if this offset is past the end.
+ * Returns the length of the normalization.
  */
-static unicode_t apfs_normalize_char(unicode_t utf32char, int off,
-				     bool case_fold)
+static int apfs_normalize_char(unicode_t utf32char,
+			       const struct apfs_unidata *data, bool case_fold,
+			       unicode_t *norm)
 {
-	int nfd_len;
-	unicode_t *nfd, *cf;
-	u16 pos;
-	int ret;
+	const u16 *values;
+	unsigned int pos, len, i;
 
-	if (apfs_is_precomposed_hangul(utf32char)) /* Hangul has no case */
-		return apfs_decompose_hangul(utf32char, off);
+	if (!data) {
+		if (apfs_is_precomposed_hangul(utf32char)) /* No case */
+			return apfs_decompose_hangul(utf32char, norm);
+		norm[0] = case_fold ? tolower(utf32char) : utf32char;
+		return 1;
+	}
 
-	ret = apfs_trie_find(apfs_nfd_trie, utf32char,
-			     &pos, false /* is_ccc */);
-	if (!ret) {
-		/* The decomposition is just the same character */
-		nfd_len = 1;
-		nfd = &utf32char;
-	} else {
-		nfd_len = ret;
-		nfd = &apfs_nfd[pos];
+	pos = case_fold ? data->nfdcf : data->nfd;
+	if (!pos) {
+		/* The normalization is just the same character */
+		norm[0] = utf32char | (unicode_t)data->ccc << VALUE_CCC_SHIFT;
+		return 1;
 	}
 
-	if (!case_fold) {
-		if (off < nfd_len)
-			return nfd[off];
-		return NORM_END;
+	len = pos & TRIE_SIZE_MASK;
+	pos >>= TRIE_POS_SHIFT;
+	if (unlikely(!len)) {
+		u32 esc = (case_fold ? APFS_TABLE(nfdcf_esc) :
+				       APFS_TABLE(nfd_esc))[pos];
+
+		len = esc & ESC_SIZE_MASK;
+		pos = esc >> ESC_POS_SHIFT;
+	}
+	values = &(case_fold ? APFS_TABLE(nfdcf) : APFS_TABLE(nfd))[pos];
+	for (i = 0; i < len; ++i) {
+		unsigned int wide = (u16)(values[i] - VALUE_WIDE_FIRST);
+
+		if (wide < VALUE_WIDE_COUNT)
+			norm[i] = APFS_TABLE(value_wide)[wide];
+		else
+			norm[i] = values[i];
 	}
+	return len;
+}
 
-	for (; nfd_len > 0; nfd++, nfd_len--) {
-		int cf_len;
+/* Are there more segments after the current one? */
+static inline bool apfs_unicursor_more_segs(struct apfs_unicursor *cursor)
+{
+	return unlikely(cursor->segs) && cursor->segs->count;
+}
 
-		ret = apfs_trie_find(apfs_cf_trie, *nfd,
-				     &pos, false /* is_ccc */);
-		if (!ret) {
-			/* The case folding is just the same character */
-			cf_len = 1;
-			cf = nfd;
-		} else {
-			cf_len = ret;
-			cf = &apfs_cf[pos];
+/**
+ * apfs_unicursor_next_seg - Move the cursor to the start of the next segment
+ * @cursor:	unicode cursor for the string, at the end of a segment
+ *
+ * Returns false if there are no more segments.
+ */
+static bool apfs_unicursor_next_seg(struct apfs_unicursor *cursor)
+{
+	struct apfs_unisegs *state = cursor->segs;
+	const struct apfs_unisegment *seg;
+
+	do {
+		if (!apfs_unicursor_more_segs(cursor))
+			return false;
+		seg = state->next++;
+		state->count--;
+		cursor->utf8curr = seg->ptr + state->off;
+		cursor->utf8end = seg->ptr + seg->len;
+		state->off = 0;
+	} while (cursor->utf8curr == cursor->utf8end);
+	return true;
+}
+
+/**
+ * apfs_unicursor_carry - Join the end of a segment with the following ones
+ * @cursor:	unicode cursor for the string, near the end of a segment
+ *
+ * The rest of the current segment, from @cursor->utf8curr, is moved to the
+ * carry buffer of the segment state, and as much of the following segments
+ * as fits is copied after it. The cursor then reads from the carry buffer,
+ * and moves on to the rest of the segments when it's done with it.
+ *
+ * Returns 0 on success, or -EINVAL if the substring at @cursor->utf8curr is
+ * too long for the carry buffer.
+ */
+static int apfs_unicursor_carry(struct apfs_unicursor *cursor)
+{
+	struct apfs_unisegs *state = cursor->segs;
+	int len = cursor->utf8end - cursor->utf8curr;
+
+	if (len >= APFS_UNICURSOR_CARRY)
+		return -EINVAL;
+	memmove(state->carry, cursor->utf8curr, len);
+
+	while (len < APFS_UNICURSOR_CARRY && state->count) {
+		const struct apfs_unisegment *seg = state->next;
+		int copy = seg->len - state->off;
+
+		if (copy > APFS_UNICURSOR_CARRY - len)
+			copy = APFS_UNICURSOR_CARRY - len;
+		memcpy(state->carry + len, seg->ptr + state->off, copy);
+		len += copy;
+		state->off += copy;
+		if (state->off == seg->len) {
+			state->next++;
+			state->count--;
+			state->off = 0;
 		}
+	}
+
+	cursor->utf8curr = state->carry;
+	cursor->utf8end = state->carry + len;
+	return 0;
+}
+
+/**
+ * apfs_unicursor_stopped - Check if a cursor stopped before the end
+ * @cursor:	unicode cursor, after apfs_normalize_next() returned 0
+ *
+ * Returns true if the cursor stopped at a substring with invalid UTF-8,
+ * false if it got to the end of the string.
+ */
+bool apfs_unicursor_stopped(struct apfs_unicursor *cursor)
+{
+	if (cursor->utf8curr == cursor->utf8end)
+		return apfs_unicursor_more_segs(cursor);
+	return *cursor->utf8curr != 0;
+}
 
-		if (off < cf_len)
-			return cf[off];
-		off -= cf_len;
+/* Characters decoded ahead by apfs_unicursor_fill(), with their data */
+struct apfs_unibatch {
+	int count;
+	unicode_t chars[APFS_UNICURSOR_BATCH];
+	u8 lens[APFS_UNICURSOR_BATCH];	/* Length of each one in UTF-8 */
+	const struct apfs_unidata *data[APFS_UNICURSOR_BATCH];
+};
+
+/**
+ * apfs_unicursor_decode - Decode the next few characters of a string
+ * @cursor:	unicode cursor for the string
+ * @utf8str:	position of the first character, not at the end
+ * @max:	maximum number of characters, up to APFS_UNICURSOR_BATCH
+ * @batch:	on return, the characters and their normalization data
+ *
+ * Up to @max characters are decoded, and then looked up all together.
+ * Decoding stops early at the end of the string, at invalid UTF-8, near the
+ * end of a segment that is followed by others, and after an ASCII character,
+ * so that the ASCII fast paths get to handle the rest of the run.
+ * ASCII and Hangul syllables have no normalization data, so they get NULL.
+ *
+ * Returns the number of characters decoded, which is zero only if the first
+ * one is invalid.
+ */
+static int apfs_unicursor_decode(struct apfs_unicursor *cursor,
+				 const char *utf8str, int max,
+				 struct apfs_unibatch *batch)
+{
+	unicode_t keys[APFS_UNICURSOR_BATCH];
+	const struct apfs_unidata *data[APFS_UNICURSOR_BATCH];
+	int count, lookups = 0;
+	int i, j;
+
+	for (count = 0; count < max; ++count) {
+		unicode_t utf32char;
+		int utf8len;
+
+		if (count && ((apfs_unicursor_more_segs(cursor) &&
+			       cursor->utf8end - utf8str < 4) ||
+			      utf8str == cursor->utf8end || !*utf8str))
+			break;
+		APFS_COUNT(decodes);
+		utf8len = utf8_to_utf32(utf8str, cursor->utf8end - utf8str,
+					&utf32char);
+		if (utf8len < 0)
+			break;
+		batch->chars[count] = utf32char;
+		batch->lens[count] = utf8len;
+		batch->data[count] = NULL;
+		utf8str += utf8len;
+
+		if (utf32char < 0x80) {
+			count++;
+			break;
+		}
+		if (utf32char <= UTF8_2BYTE_LAST)
+			batch->data[count] = apfs_unidata_find(utf32char);
+		else if (!apfs_is_precomposed_hangul(utf32char))
+			keys[lookups++] = utf32char;
 	}
 
-	return NORM_END;
+	/* Only the characters that need a trie walk are left */
+	apfs_unidata_find_batch(keys, lookups, data);
+	for (i = 0, j = 0; j < lookups; ++i) {
+		if (batch->chars[i] > UTF8_2BYTE_LAST &&
+		    !apfs_is_precomposed_hangul(batch->chars[i]))
+			batch->data[i] = data[j++];
+	}
+	batch->count = count;
+	return count;
 }
 
+/*
+ * Characters of a substring are ordered by the number of starters that come
+ * before them (other than the first character), then by canonical combining
+ * class, then by position. Starters never move, and runs of non-starters get
+ * a stable sort by their ccc.
+ */
+#define KEY_GROUP_SHIFT		40
+#define KEY_CCC_SHIFT		32
+
 /**
- * apfs_get_normalization_length - Count the characters until the next starter
- * @utf8str:	string to normalize, may begin with several starters
- * @case_fold:	true if the count should consider case folding
+ * apfs_unicursor_fill - Decompose and reorder the next substrings of a string
+ * @cursor:	unicode cursor for the string
+ * @case_fold:	case fold the string?
+ *
+ * A substring begins at @cursor->utf8curr and ends before the next character
+ * whose normalization begins with a starter. Its normalized characters are
+ * decoded once and put in canonical order in the cursor buffer. Substrings
+ * that don't fit get buffered in several batches, each with the lowest sort
+ * keys that were not returned yet; @cursor->utf8curr only moves on when the
+ * last batch is buffered.
  *
- * Returns the number of unicode characters in the normalization of the
- * substring that begins at @utf8str and ends at the first nonconsecutive
- * starter. Or 0 if the substring has invalid UTF-8.
+ * The characters are decoded and looked up a few at a time, so the following
+ * substrings are also buffered while there is room, up to the next ASCII
+ * character; the work already done for them is not thrown away. If one of
+ * them can't be finished, because it doesn't fit, has invalid UTF-8 or goes
+ * on in the next segment, the buffer ends before it and it's left for the
+ * next call.
+ *
+ * In the Stream-Safe modes, the run of non-starters is counted as they get
+ * buffered. A CGJ that gets inserted is a starter, so it begins a new
+ * substring; if the fill ends there, the length of the run is kept in the
+ * cursor so that the next fill inserts it again.
+ *
+ * Returns the number of characters buffered, 0 at the end of the string, or
+ * -EINVAL if the substring has invalid UTF-8, or too many non-starters for
+ * APFS_STREAM_SAFE_STRICT.
  */
-static int apfs_get_normalization_length(const char *utf8str, bool case_fold)
+static int apfs_unicursor_fill(struct apfs_unicursor *cursor, bool case_fold)
 {
-	int utf8len, pos, norm_len = 0;
-	bool starters_over = false;
-	unicode_t utf32char;
+	u64 keys[APFS_UNICURSOR_BUFSIZE];
+	/* Room for a CGJ before the normalization of each char */
+	unicode_t norm[APFS_VALUE_MAX_LEN + 1] = {0};
+	struct apfs_unibatch batch;
+	const char *utf8str, *boundary;
+	bool resume = cursor->more;
+	bool marks, cgj;
+	int group, pos, count, next, max, boundary_count, run;
 
+	APFS_COUNT(fills);
+restart:
+	utf8str = cursor->utf8curr;
+	group = pos = count = 0;
+	boundary = NULL;
+	boundary_count = 0;
+	marks = false;
+	run = cursor->nonstarters;
+	batch.count = next = 0;
+	cursor->more = false;
 	while (1) {
-		if (!*utf8str)
-			return norm_len;
-		utf8len = utf8_to_utf32(utf8str, 4, &utf32char);
-		if (utf8len < 0) /* Invalid unicode; don't normalize anything */
-			return 0;
+		unicode_t utf32char, *chars;
+		int norm_len, i;
 
-		for (pos = 0;; pos++, norm_len++) {
-			unicode_t utf32norm;
-			u8 ccc;
+		cgj = false;
+		if (next == batch.count) {
+			/* The substring may go on in the next segment */
+			if (apfs_unicursor_more_segs(cursor) &&
+			    cursor->utf8end - utf8str < 4) {
+				if (boundary_count)
+					goto stop_early;
+				if (apfs_unicursor_carry(cursor))
+					return -EINVAL;
+				goto restart;
+			}
+			if (utf8str == cursor->utf8end || !*utf8str)
+				break;
+			/*
+			 * Once there are combining marks, the fill ends with
+			 * the substring, so don't decode past it.
+			 */
+			max = marks ? 1 : APFS_UNICURSOR_BATCH;
+			next = 0;
+			if (!apfs_unicursor_decode(cursor, utf8str, max,
+						   &batch)) {
+				if (boundary_count)
+					goto stop_early;
+				/* Invalid unicode; don't normalize anything */
+				return -EINVAL;
+			}
+		}
 
-			utf32norm = apfs_normalize_char(utf32char, pos,
-							case_fold);
-			if (utf32norm == NORM_END)
+		utf32char = batch.chars[next];
+		chars = norm + 1;
+		norm_len = apfs_normalize_char(utf32char, batch.data[next],
+					       case_fold, chars);
+		if (cursor->stream_safe) {
+			for (i = 0; i < norm_len; ++i) {
+				if (!(chars[i] >> VALUE_CCC_SHIFT))
+					break;
+			}
+			if (run + i > STREAM_SAFE_MAX) {
+				if (cursor->stream_safe ==
+				    APFS_STREAM_SAFE_STRICT) {
+					if (boundary_count)
+						goto stop_early;
+					return -EINVAL;
+				}
+				*--chars = UNICODE_CGJ;
+				norm_len++;
+				cgj = true;
+			}
+		}
+		if (pos && !(chars[0] >> VALUE_CCC_SHIFT)) {
+			/*
+			 * Reached the next substring. Keep going if it was
+			 * just starters, and there's still room.
+			 */
+			if (count && (resume || marks || utf32char < 0x80 ||
+				      count > APFS_UNICURSOR_BUFSIZE -
+					      APFS_UNICURSOR_BATCH))
 				break;
+			boundary = utf8str;
+			boundary_count = count;
+		}
 
-			apfs_trie_find(apfs_ccc_trie, utf32norm, &ccc,
-				       true /* is_ccc */);
+		for (i = 0; i < norm_len; ++i, ++pos) {
+			u64 ccc = chars[i] >> VALUE_CCC_SHIFT;
+			u64 key;
+			int j;
+
+			if (pos && !ccc)
+				group++;
+			marks |= ccc != 0;
+			key = (u64)group << KEY_GROUP_SHIFT |
+			      ccc << KEY_CCC_SHIFT | pos;
+			if (resume && key <= cursor->last_key)
+				continue; /* Returned in an earlier batch */
+
+			if (count == APFS_UNICURSOR_BUFSIZE) {
+				/* Only a lone substring is split in batches */
+				if (boundary_count)
+					goto stop_early;
+				cursor->more = true;
+				if (key > keys[count - 1])
+					continue;
+				count--; /* Leave the highest key for later */
+			}
 
-			if (ccc != 0)
-				starters_over = true;
-			else if (starters_over) /* Reached the next starter */
-				return norm_len;
+			/* Insertion sort; the buffer is almost always tiny */
+			for (j = count; j > 0 && keys[j - 1] > key; --j) {
+				keys[j] = keys[j - 1];
+				cursor->buf[j] = cursor->buf[j - 1];
+			}
+			keys[j] = key;
+			cursor->buf[j] = chars[i];
+			count++;
 		}
-		utf8str += utf8len;
+		if (cursor->stream_safe) {
+			/* The run goes on only if there was no starter */
+			for (i = norm_len; i > 0; --i) {
+				if (!(chars[i - 1] >> VALUE_CCC_SHIFT))
+					break;
+			}
+			run = i ? norm_len - i : run + norm_len;
+		}
+		utf8str += batch.lens[next++];
+	}
+
+	if (cursor->more) {
+		cursor->last_key = keys[count - 1];
+	} else {
+		cursor->utf8curr = utf8str;
+		cursor->nonstarters = cgj ? run : 0;
+		if (pos)
+			APFS_COUNT(substrings[fls(pos) <= APFS_STATS_SUBSTR ?
+					      fls(pos) - 1 :
+					      APFS_STATS_SUBSTR - 1]);
 	}
+	cursor->buf_len = count;
+	cursor->buf_pos = 0;
+	return count;
+
+stop_early:
+	/*
+	 * The keys of the last substring are higher than all the others, so
+	 * the buffer only needs to be cut where it begins.
+	 */
+	cursor->more = false;
+	cursor->nonstarters = 0;
+	cursor->utf8curr = boundary;
+	cursor->buf_len = boundary_count;
+	cursor->buf_pos = 0;
+	return boundary_count;
 }
 
+/* Word-at-a-time helpers, for when there is no SIMD to scan ASCII runs */
+#define REPEAT_BYTE(x)	((~0ul / 0xff) * (x))
+#define HAS_ZERO(w)	(((w) - REPEAT_BYTE(0x01)) & ~(w) & REPEAT_BYTE(0x80))
+
 /**
- * apfs_normalize_next - Return the next normalized character from a string
+ * apfs_ascii_len - Measure a run of ASCII characters
+ * @s:		string to scan
+ * @len:	maximum length of the run
+ *
+ * Returns the number of bytes at the start of @s that are ASCII characters
+ * other than NUL, up to @len.
+ */
+static int apfs_ascii_len(const u8 *s, int len)
+{
+	int i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+		__m256i nul = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+		u32 stop = _mm256_movemask_epi8(_mm256_or_si256(v, nul));
+
+		if (stop)
+			return i + __builtin_ctz(stop);
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+		__m128i nul = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+		u32 stop = _mm_movemask_epi8(_mm_or_si128(v, nul));
+
+		if (stop)
+			return i + __builtin_ctz(stop);
+	}
+#else
+	for (; i + sizeof(unsigned long) <= len; i += sizeof(unsigned long)) {
+		unsigned long w;
+
+		memcpy(&w, s + i, sizeof(w));
+		if ((w & REPEAT_BYTE(0x80)) || HAS_ZERO(w))
+			break;
+	}
+#endif
+	for (; i < len; ++i) {
+		if (!s[i] || !isascii(s[i]))
+			break;
+	}
+	return i;
+}
+
+/**
+ * apfs_ascii_fold - Copy a run of ASCII characters, in lower case
+ * @dst:	destination buffer
+ * @src:	ASCII characters to copy, from apfs_ascii_len()
+ * @len:	number of characters
+ */
+static void apfs_ascii_fold(u8 *dst, const u8 *src, int len)
+{
+	int i = 0;
+
+#if defined(__AVX2__)
+	for (; i + 32 <= len; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+		__m256i upper = _mm256_and_si256(
+			_mm256_cmpgt_epi8(v, _mm256_set1_epi8('A' - 1)),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), v));
+
+		v = _mm256_or_si256(v, _mm256_and_si256(upper,
+						_mm256_set1_epi8(0x20)));
+		_mm256_storeu_si256((__m256i *)(dst + i), v);
+	}
+#endif
+#if defined(__SSE2__)
+	for (; i + 16 <= len; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i upper = _mm_and_si128(
+			_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+			_mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+
+		v = _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+		_mm_storeu_si128((__m128i *)(dst + i), v);
+	}
+#else
+	for (; i + sizeof(unsigned long) <= len; i += sizeof(unsigned long)) {
+		unsigned long w, above_z, from_a;
+
+		/* All bytes are ASCII, so no carries between them */
+		memcpy(&w, src + i, sizeof(w));
+		from_a = w + REPEAT_BYTE(0x80 - 'A');
+		above_z = w + REPEAT_BYTE(0x7f - 'Z');
+		w |= ((from_a ^ above_z) & REPEAT_BYTE(0x80)) >> 2;
+		memcpy(dst + i, &w, sizeof(w));
+	}
+#endif
+	for (; i < len; ++i)
+		dst[i] = tolower(src[i]);
+}
+
+/**
+ * apfs_normalize_ascii - Return a run of normalized ASCII characters
  * @cursor:	unicode cursor for the string
+ * @buf:	buffer for the normalized characters
+ * @buflen:	size of @buf
  * @case_fold:	case fold the string?
  *
- * Sets @cursor->length to the length of the normalized substring between
- * @cursor->utf8curr and the first nonconsecutive starter. Returns a single
- * normalized character, setting @cursor->last_ccc and @cursor->last_pos to
- * its CCC and position in the substring. When the end of the substring is
- * reached, updates @cursor->utf8curr to point to the beginning of the next
- * one.
+ * ASCII characters are starters and are never changed by normalization,
+ * other than by case folding, so a whole run of them can be consumed at once.
+ * Copies the run that begins at @cursor->utf8curr to @buf, up to @buflen
+ * characters, and moves the cursor past it.
  *
- * Returns 0 if the substring has invalid UTF-8.
+ * Returns the number of characters copied, which is 0 if the cursor is not
+ * at the start of an ASCII run; apfs_normalize_next() must be called then.
+ */
+int apfs_normalize_ascii(struct apfs_unicursor *cursor, u8 *buf, int buflen,
+			 bool case_fold)
+{
+	const u8 *utf8str = (const u8 *)cursor->utf8curr;
+	int len;
+
+	/* In the middle of a substring */
+	if (cursor->buf_pos < cursor->buf_len || cursor->more)
+		return 0;
+
+	len = cursor->utf8end - cursor->utf8curr;
+	len = apfs_ascii_len(utf8str, len < buflen ? len : buflen);
+	if (case_fold)
+		apfs_ascii_fold(buf, utf8str, len);
+	else
+		memcpy(buf, utf8str, len);
+
+	cursor->utf8curr += len;
+	APFS_COUNT_ADD(ascii_chars, len);
+	return len;
+}
+
+/**
+ * apfs_normalize_next - Return the next normalized character from a string
+ * @cursor:	unicode cursor for the string
+ * @case_fold:	case fold the string?
+ *
+ * Returns a single normalized character, taken from the cursor buffer, which
+ * gets refilled with the next substring as needed. Returns 0 at the end of
+ * the string, or if the substring has invalid UTF-8.
  */
 unicode_t apfs_normalize_next(struct apfs_unicursor *cursor, bool case_fold)
 {
 	const char *utf8str = cursor->utf8curr;
-	int str_pos, min_pos = -1;
-	unicode_t utf32min = 0;
-	u8 min_ccc;
 
-new_starter:
+	APFS_COUNT(next_calls);
+	if (cursor->buf_pos < cursor->buf_len) {
+		APFS_COUNT(next_chars);
+		return cursor->buf[cursor->buf_pos++] & VALUE_CHAR_MASK;
+	}
+	if (cursor->more)
+		goto fill;
+
+	if (utf8str == cursor->utf8end) {
+		if (!apfs_unicursor_next_seg(cursor))
+			return 0;
+		utf8str = cursor->utf8curr;
+	}
+	if (!*utf8str)
+		return 0;
 	if (likely(isascii(*utf8str))) {
 		cursor->utf8curr = utf8str + 1;
+		APFS_COUNT(next_chars);
+		APFS_COUNT(ascii_chars);
 		if (case_fold)
 			return tolower(*utf8str);
 		return *utf8str;
 	}
 
-	if (cursor->length < 0) {
-		cursor->length = apfs_get_normalization_length(utf8str,
-							       case_fold);
-		if (cursor->length == 0)
-			return 0;
+	/*
+	 * A two-byte character that is a starter and normalizes to itself can
+	 * also be returned right away, without looking at the rest of the
+	 * substring. Overlong encodings are left for utf8_to_utf32() to reject.
+	 */
+	if (cursor->utf8end - utf8str >= 2 &&
+	    ((u8)utf8str[0] & 0xe0) == 0xc0 &&
+	    ((u8)utf8str[1] & 0xc0) == 0x80) {
+		unicode_t utf32char = ((utf8str[0] & 0x1f) << 6) |
+				      (utf8str[1] & 0x3f);
+		const struct apfs_unidata *data;
+
+		if (utf32char >= UTF8_2BYTE_FIRST) {
+			data = &APFS_TABLE(unidata_2byte)[utf32char -
+							  UTF8_2BYTE_FIRST];
+			if (!data->ccc &&
+			    !(case_fold ? data->nfdcf : data->nfd)) {
+				cursor->utf8curr = utf8str + 2;
+				APFS_COUNT(next_chars);
+				APFS_COUNT(twobyte_chars);
+				return utf32char;
+			}
+		}
 	}
 
-	str_pos = 0;
-	min_ccc = 0xFF;	/* Above all possible ccc's */
+fill:
+	if (apfs_unicursor_fill(cursor, case_fold) <= 0)
+		return 0;
+	APFS_COUNT(next_chars);
+	return cursor->buf[cursor->buf_pos++] & VALUE_CHAR_MASK;
+}
 
-	while (1) {
+/**
+ * apfs_qc_stable - Check the quick check bitmap for a character
+ * @utf32char:	the character, a valid code point
+ * @case_fold:	check the case folding too?
+ *
+ * Returns true if @utf32char is a starter that normalizes to itself, and
+ * also case folds to itself if @case_fold is set. A false return means that
+ * the normalization data must be looked up to know.
+ */
+static inline bool apfs_qc_stable(unicode_t utf32char, bool case_fold)
+{
+	int block = APFS_TABLE(qc_planes)[utf32char >> 16];
+	int leaf = APFS_TABLE(qc_blocks)[block][(utf32char >> 8) & 0xff];
+	u32 word = APFS_TABLE(qc_leaves)[leaf][(utf32char >> 4) & 0xf];
+
+	return (word >> (((utf32char & 0xf) << 1) + case_fold)) & 1;
+}
+
+/*
+ * The work of apfs_is_normalized(), which only adds the counters. With
+ * @stream_safe set, a run of more than 30 non-starters also fails the check.
+ */
+static bool apfs_quick_check(const char *name, int len, bool case_fold,
+			     bool stream_safe)
+{
+	const u8 *curr = (const u8 *)name;
+	const u8 *end = curr + len;
+	u8 last_ccc = 0;
+	int run = 0;
+
+	while (curr < end && *curr) {
+		const struct apfs_unidata *data;
 		unicode_t utf32char;
-		int utf8len, pos;
+		int runlen, charlen;
 
-		utf8len = utf8_to_utf32(utf8str, 4, &utf32char);
-		for (pos = 0;; pos++, str_pos++) {
-			unicode_t utf32norm;
-			u8 ccc;
+		runlen = apfs_ascii_len(curr, end - curr);
+		if (runlen) {
+			if (case_fold) {
+				int i;
 
-			utf32norm = apfs_normalize_char(utf32char, pos,
-							case_fold);
-			if (utf32norm == NORM_END)
-				break;
+				for (i = 0; i < runlen; ++i) {
+					if (curr[i] >= 'A' && curr[i] <= 'Z')
+						return false;
+				}
+			}
+			curr += runlen;
+			last_ccc = run = 0;
+			continue;
+		}
+
+		charlen = utf8_to_utf32(curr, end - curr, &utf32char);
+		if (charlen < 0)
+			return false;
+		APFS_COUNT(decodes);
+		curr += charlen;
 
-			apfs_trie_find(apfs_ccc_trie, utf32norm, &ccc,
-				       true /* is_ccc */);
+		if (apfs_qc_stable(utf32char, case_fold)) {
+			last_ccc = run = 0;
+			continue;
+		}
+		if (apfs_is_precomposed_hangul(utf32char))
+			return false;
+		data = apfs_unidata_find(utf32char);
+		if (case_fold ? data->nfdcf : data->nfd)
+			return false;
+		if (data->ccc && data->ccc < last_ccc)
+			return false;
+		run = data->ccc ? run + 1 : 0;
+		if (stream_safe && run > STREAM_SAFE_MAX)
+			return false;
+		last_ccc = data->ccc;
+	}
+	return true;
+}
+
+/* Run the quick check, and count its result */
+static bool __apfs_is_normalized(const char *name, int len, bool case_fold,
+				 bool stream_safe)
+{
+	bool ret = apfs_quick_check(name, len, case_fold, stream_safe);
+
+	if (ret)
+		APFS_COUNT(quick_yes);
+	else
+		APFS_COUNT(quick_no);
+	return ret;
+}
 
-			if (ccc >= min_ccc || ccc < cursor->last_ccc)
+/**
+ * apfs_is_normalized - Check if a string is its own normalization
+ * @name:	UTF-8 string to check, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	check against the case folded normalization?
+ *
+ * Most names are already normalized, and for those the input bytes can be
+ * used as they are. Each character is only decoded and checked against the
+ * quick check bitmap; the normalization data is looked up just for the few
+ * characters that the bitmap doesn't cover, to confirm that they map to
+ * themselves and that the combining marks are in canonical order.
+ *
+ * Returns true if the normalization of @name is identical to @name, false
+ * if it isn't, or if @name has invalid UTF-8.
+ */
+bool apfs_is_normalized(const char *name, int len, bool case_fold)
+{
+	return __apfs_is_normalized(name, len, case_fold,
+				    false /* stream_safe */);
+}
+
+/**
+ * apfs_put_char - Append a character to the output of a bulk normalization
+ * @dst:	output buffer
+ * @dstlen:	size of @dst in bytes
+ * @pos:	position in @dst for the character
+ * @utf32char:	character to append
+ * @utf8:	encode the character as UTF-8 instead of UTF-32?
+ *
+ * The character is only written if it fits in the buffer. Returns its size.
+ */
+static int apfs_put_char(u8 *dst, int dstlen, int pos, unicode_t utf32char,
+			 bool utf8)
+{
+	u8 utf8buf[4];
+	int len;
+
+	if (!utf8) {
+		if (pos + (int)sizeof(utf32char) <= dstlen)
+			memcpy(dst + pos, &utf32char, sizeof(utf32char));
+		return sizeof(utf32char);
+	}
+
+	len = utf32_to_utf8(utf32char, utf8buf, sizeof(utf8buf));
+	if (pos + len <= dstlen)
+		memcpy(dst + pos, utf8buf, len);
+	return len;
+}
+
+/**
+ * apfs_normalize_string - Normalize a whole string into a buffer
+ * @src:	UTF-8 string to normalize, not necessarily NUL-terminated
+ * @len:	length of @src; a NUL byte also ends the string
+ * @dst:	output buffer
+ * @dstlen:	size of @dst in bytes
+ * @flags:	APFS_NORM_CASE_FOLD to case fold the string, APFS_NORM_UTF8
+ *		to encode the output as UTF-8 instead of an array of unicode_t,
+ *		and APFS_NORM_STREAM_SAFE or APFS_NORM_STREAM_STRICT to limit
+ *		the runs of non-starters, see apfs_unicursor_stream_safe()
+ *
+ * The output is not NUL-terminated. If it doesn't fit in @dstlen bytes, @dst
+ * only holds part of it; the return value is still the full size, so the
+ * caller can retry with a bigger buffer. A NULL @dst with a @dstlen of zero
+ * may be used to just get the size.
+ *
+ * Returns the size of the normalized string in bytes, or -EINVAL if @src is
+ * not valid UTF-8, or is rejected by APFS_NORM_STREAM_STRICT.
+ */
+int apfs_normalize_string(const char *src, int len, void *dst, int dstlen,
+			  unsigned int flags)
+{
+	struct apfs_unicursor cursor;
+	bool case_fold = flags & APFS_NORM_CASE_FOLD;
+	bool utf8 = flags & APFS_NORM_UTF8;
+	bool stream_safe = flags & (APFS_NORM_STREAM_SAFE |
+				    APFS_NORM_STREAM_STRICT);
+	u8 *out = dst;
+	int size = 0;
+
+	/* Already normalized UTF-8 needs no work at all */
+	if (utf8 && __apfs_is_normalized(src, len, case_fold, stream_safe)) {
+		size = strnlen(src, len);
+		if (dstlen)
+			memcpy(dst, src, size < dstlen ? size : dstlen);
+		return size;
+	}
+
+	apfs_init_unicursor_len(&cursor, src, len);
+	if (flags & APFS_NORM_STREAM_STRICT)
+		apfs_unicursor_stream_safe(&cursor, APFS_STREAM_SAFE_STRICT);
+	else if (flags & APFS_NORM_STREAM_SAFE)
+		apfs_unicursor_stream_safe(&cursor, APFS_STREAM_SAFE);
+	while (1) {
+		unicode_t utf32char;
+		u8 run[64];
+		int runlen, i;
+
+		if (utf8 && size < dstlen) {
+			/* ASCII goes straight to the output buffer */
+			runlen = apfs_normalize_ascii(&cursor, out + size,
+						      dstlen - size,
+						      case_fold);
+			size += runlen;
+			if (runlen)
 				continue;
-			if (ccc > cursor->last_ccc ||
-			    str_pos > cursor->last_pos) {
-				utf32min = utf32norm;
-				min_ccc = ccc;
-				min_pos = str_pos;
-			}
 		}
 
-		utf8str += utf8len;
-		if (str_pos == cursor->length) {
-			/* Reached the following starter */
-			if (min_ccc != 0xFF) {
-				/* Not done with this substring yet */
-				cursor->last_ccc = min_ccc;
-				cursor->last_pos = min_pos;
-				return utf32min;
+		runlen = apfs_normalize_ascii(&cursor, run, sizeof(run),
+					      case_fold);
+		for (i = 0; i < runlen; ++i)
+			size += apfs_put_char(out, dstlen, size, run[i], utf8);
+		if (runlen)
+			continue;
+
+		utf32char = apfs_normalize_next(&cursor, case_fold);
+		if (!utf32char)
+			break;
+		size += apfs_put_char(out, dstlen, size, utf32char, utf8);
+	}
+
+	/* The cursor stops early on invalid UTF-8 */
+	if (apfs_unicursor_stopped(&cursor))
+		return -EINVAL;
+	return size;
+}
+
+/* Number of normalized characters hashed at a time */
+#define HASH_CHUNK	16
+
+/* Size of @utf32char in UTF-8, which must be a valid code point */
+static inline int apfs_utf8_size(unicode_t utf32char)
+{
+	if (utf32char < 0x80)
+		return 1;
+	if (utf32char < 0x800)
+		return 2;
+	return utf32char < 0x10000 ? 3 : 4;
+}
+
+/**
+ * apfs_normalize_hash_size - Hash the normalization of a string, and size it
+ * @name:	UTF-8 string to hash, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	case fold the string?
+ * @hash:	on return, the hash of the normalized string
+ *
+ * Computes the CRC32C of the normalized string, as an array of little-endian
+ * UTF-32 characters, without ever holding more than a few of them. The seed
+ * is ~0 and there is no final inversion, so the result matches a crc32c() of
+ * the characters returned by apfs_normalize_next(), one at a time. Like the
+ * cursor, the hash stops before the first substring with invalid UTF-8.
+ *
+ * Returns the size of the normalized string in UTF-8, like the return value
+ * of apfs_normalize_string() with APFS_NORM_UTF8, or -EINVAL if @name is not
+ * valid UTF-8. @hash is set in both cases.
+ */
+int apfs_normalize_hash_size(const char *name, int len, bool case_fold,
+			     u32 *hash)
+{
+	struct apfs_unicursor cursor;
+	__le32 chunk[HASH_CHUNK];
+	u32 crc = ~0;
+	int count = 0, size = 0;
+
+	/*
+	 * The characters of a normalized string are hashed as they are, so
+	 * they only need to be decoded.
+	 */
+	if (apfs_is_normalized(name, len, case_fold)) {
+		const u8 *curr = (const u8 *)name;
+		const u8 *end = curr + len;
+
+		while (curr < end && *curr) {
+			unicode_t utf32char;
+
+			if (count == HASH_CHUNK) {
+				crc = crc32c(crc, chunk, sizeof(chunk));
+				count = 0;
 			}
-			/* Continue from the next starter */
-			apfs_init_unicursor(cursor, utf8str);
-			goto new_starter;
+			curr += utf8_to_utf32(curr, end - curr, &utf32char);
+			chunk[count++] = cpu_to_le32(utf32char);
+		}
+		*hash = crc32c(crc, chunk, count * sizeof(*chunk));
+		return curr - (const u8 *)name;
+	}
+
+	apfs_init_unicursor_len(&cursor, name, len);
+	while (1) {
+		unicode_t utf32char;
+		u8 run[HASH_CHUNK];
+		int runlen, i;
+
+		if (count == HASH_CHUNK) {
+			crc = crc32c(crc, chunk, sizeof(chunk));
+			count = 0;
+		}
+
+		runlen = apfs_normalize_ascii(&cursor, run, HASH_CHUNK - count,
+					      case_fold);
+		for (i = 0; i < runlen; ++i)
+			chunk[count++] = cpu_to_le32(run[i]);
+		size += runlen;
+		if (runlen)
+			continue;
+
+		utf32char = apfs_normalize_next(&cursor, case_fold);
+		if (!utf32char)
+			break;
+		chunk[count++] = cpu_to_le32(utf32char);
+		size += apfs_utf8_size(utf32char);
+	}
+	*hash = crc32c(crc, chunk, count * sizeof(*chunk));
+
+	/* The cursor stops early on invalid UTF-8 */
+	if (apfs_unicursor_stopped(&cursor))
+		return -EINVAL;
+	return size;
+}
+
+/**
+ * apfs_normalize_hash - Hash the normalization of a string
+ * @name:	UTF-8 string to hash, not necessarily NUL-terminated
+ * @len:	length of @name; a NUL byte also ends the string
+ * @case_fold:	case fold the string?
+ *
+ * Returns the same hash as apfs_normalize_hash_size().
+ */
+u32 apfs_normalize_hash(const char *name, int len, bool case_fold)
+{
+	u32 hash;
+
+	apfs_normalize_hash_size(name, len, case_fold, &hash);
+	return hash;
+}
+
+/**
+ * apfs_normalized_cmp - Compare the normalizations of two strings
+ * @a:		first UTF-8 string, NUL-terminated
+ * @b:		second UTF-8 string, NUL-terminated
+ * @case_fold:	compare the case folded normalizations instead?
+ *
+ * The normalized strings are compared one UTF-32 character at a time, and
+ * only as far as needed to find the first difference. If either string has
+ * invalid UTF-8, the bytes after the last valid substring are compared too,
+ * so that two different invalid names never match.
+ *
+ * Returns 0 if the normalizations are equal; otherwise a negative or positive
+ * value, depending on which string sorts first.
+ */
+int apfs_normalized_cmp(const char *a, const char *b, bool case_fold)
+{
+	struct apfs_unicursor cursor_a, cursor_b;
+	unicode_t char_a, char_b;
+	int len_a, len_b;
+
+	/*
+	 * ASCII characters are starters, so the normalization of an identical
+	 * ASCII prefix is the same on both sides and can be skipped.
+	 */
+	while (*a == *b && *a && isascii(*a)) {
+		a++;
+		b++;
+	}
+
+	/* Keep going with ASCII while it lasts, since it needs no lookups */
+	while (*a && *b && isascii(*a) && isascii(*b)) {
+		char_a = case_fold ? tolower(*a) : *a;
+		char_b = case_fold ? tolower(*b) : *b;
+		if (char_a != char_b)
+			return char_a < char_b ? -1 : 1;
+		a++;
+		b++;
+	}
+	if (!*a || !*b)
+		return (u8)*a - (u8)*b;
+
+	/*
+	 * UTF-8 sorts like the code points, so normalized names need no work.
+	 * The quick check must get the real lengths: it reads whole words,
+	 * and would run past the end of the names.
+	 */
+	len_a = strlen(a);
+	len_b = strlen(b);
+	if (apfs_is_normalized(a, len_a, case_fold) &&
+	    apfs_is_normalized(b, len_b, case_fold))
+		return strcmp(a, b);
+
+	apfs_init_unicursor_len(&cursor_a, a, len_a);
+	apfs_init_unicursor_len(&cursor_b, b, len_b);
+	do {
+		char_a = apfs_normalize_next(&cursor_a, case_fold);
+		char_b = apfs_normalize_next(&cursor_b, case_fold);
+		if (char_a != char_b)
+			return char_a < char_b ? -1 : 1;
+	} while (char_a);
+
+	/* Both cursors stopped, at the end or at some invalid UTF-8 */
+	return strcmp(cursor_a.utf8curr, cursor_b.utf8curr);
+}
+
+#ifdef APFS_LOADABLE_TABLES
+/*
+ * Layout of the binary tables written by "mktrie -o", see the comment there.
+ * The tables are used in place, so the fields are little-endian like the host.
+ */
+#define APFS_UNITABLES_MAGIC	0x42544e55	/* "UNTB" */
+#define APFS_UNITABLES_VERSION	4
+#define APFS_UNITABLES_ALIGN	64
+
+enum {
+	APFS_UNITABLES_TRIE,
+	APFS_UNITABLES_UNIDATA,
+	APFS_UNITABLES_UNIDATA_2BYTE,
+	APFS_UNITABLES_NFD,
+	APFS_UNITABLES_NFDCF,
+	APFS_UNITABLES_QC_PLANES,
+	APFS_UNITABLES_QC_BLOCKS,
+	APFS_UNITABLES_QC_LEAVES,
+	APFS_UNITABLES_NFD_ESC,
+	APFS_UNITABLES_NFDCF_ESC,
+	APFS_UNITABLES_HASH_DISP,
+	APFS_UNITABLES_HASH_SLOTS,
+	APFS_UNITABLES_VALUE_WIDE,
+	APFS_UNITABLES_COUNT
+};
+
+struct apfs_unitables_header {
+	u32 magic;
+	u32 version;
+	u32 size;		/* Size of the whole file */
+	u32 checksum;		/* CRC32C, computed with this field zeroed */
+	u32 trie_height;
+	u8 trie_bits[APFS_UNITABLES_MAX_HEIGHT];
+	u8 trie_shift[APFS_UNITABLES_MAX_HEIGHT];
+	int trie_base[APFS_UNITABLES_MAX_HEIGHT];
+	struct {
+		u32 offset;
+		u32 size;
+	} tables[APFS_UNITABLES_COUNT];
+};
+
+/* Number of planes, and so of entries in the qc_planes table */
+#define APFS_QC_PLANES		17
+
+/* The tables from a file, when apfs_tables points to them */
+static struct apfs_unitables apfs_loaded_tables;
+
+/* The mapping of the file, if it was made by apfs_load_unitables() */
+static void *apfs_unitables_map;
+static size_t apfs_unitables_map_size;
+
+/**
+ * apfs_unitables_find - Find one of the tables in a binary table file
+ * @blob:	contents of the file
+ * @table:	index of the table in the header
+ * @elem_size:	size of each element of the table
+ * @count:	on return, the number of elements
+ *
+ * Returns a pointer to the table, or NULL if it's out of bounds or not made
+ * of whole elements.
+ */
+static const void *apfs_unitables_find(const u8 *blob, int table,
+				       size_t elem_size, long *count)
+{
+	const struct apfs_unitables_header *hdr = (const void *)blob;
+	u32 offset = hdr->tables[table].offset;
+	u32 size = hdr->tables[table].size;
+
+	if (offset % APFS_UNITABLES_ALIGN || offset < sizeof(*hdr) ||
+	    offset > hdr->size || size > hdr->size - offset ||
+	    size % elem_size)
+		return NULL;
+	*count = size / elem_size;
+	return blob + offset;
+}
+
+/*
+ * Check that every lookup that goes through the row of @node, on trie level
+ * @level, stays inside the trie and ends on an existing record.
+ */
+static bool apfs_unitables_walk(const struct apfs_unitables *tables,
+				long trie_count, long unidata_count,
+				int level, long node)
+{
+	int bits = tables->trie_bits[level];
+	long start = tables->trie_base[level] + (node << bits);
+	int i;
+
+	if (start < 0 || start + (1 << bits) > trie_count)
+		return false;
+	for (i = 0; i < 1 << bits; ++i) {
+		long child = tables->trie[start + i];
+
+		if (level == tables->trie_height - 1) {
+			if (child >= unidata_count)
+				return false;
+		} else if (child && !apfs_unitables_walk(tables, trie_count,
+							 unidata_count,
+							 level + 1, child)) {
+			return false;
 		}
 	}
+	return true;
+}
+
+/*
+ * Check that the entries of an escape array point inside the value array, and
+ * that the values fit the buffers of the runtime code.
+ */
+static bool apfs_escapes_valid(const u32 *esc, long esc_count, long count)
+{
+	long i;
+
+	/* The first entry is never used */
+	for (i = 1; i < esc_count; ++i) {
+		long pos = esc[i] >> ESC_POS_SHIFT;
+		long len = esc[i] & ESC_SIZE_MASK;
+
+		if (len > APFS_VALUE_MAX_LEN || pos + len > count)
+			return false;
+	}
+	return true;
+}
+
+/* Check that an encoded value points inside its value or escape array */
+static bool apfs_value_valid(u16 value, long count, long esc_count)
+{
+	long pos = value >> TRIE_POS_SHIFT;
+	long len = value & TRIE_SIZE_MASK;
+
+	if (value && !len)
+		return pos < esc_count;
+	return pos + len <= count;
+}
+
+/*
+ * Check that all entries of a value array are characters, or point inside the
+ * wide value array.
+ */
+static bool apfs_values_valid(const u16 *values, long count, long wide_count)
+{
+	long i;
+
+	for (i = 0; i < count; ++i) {
+		u16 wide = values[i] - VALUE_WIDE_FIRST;
+
+		if (!values[i] ||
+		    (wide < VALUE_WIDE_COUNT && wide >= wide_count))
+			return false;
+	}
+	return true;
+}
+
+/* Check that all entries of the wide value array are characters */
+static bool apfs_wide_valid(const u32 *wide, long wide_count)
+{
+	long i;
+
+	for (i = 0; i < wide_count; ++i) {
+		unicode_t utf32char = wide[i] & VALUE_CHAR_MASK;
+
+		if (!utf32char || utf32char > 0x10ffff)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * apfs_unitables_parse - Check a binary table file, and find its tables
+ * @blob:	contents of the file
+ * @size:	size of @blob
+ * @tables:	on return, the tables inside @blob
+ *
+ * Besides the checksum, every index stored in the tables is checked against
+ * the size of the table it points to, so that the lookups can never read out
+ * of bounds, even if the file was not built by mktrie.
+ *
+ * Returns 0 on success, or -EINVAL if @blob is not valid.
+ */
+static int apfs_unitables_parse(const u8 *blob, size_t size,
+				struct apfs_unitables *tables)
+{
+	const struct apfs_unitables_header *hdr = (const void *)blob;
+	struct apfs_unitables_header copy;
+	long trie_count = 0, unidata_count = 0, twobyte_count = 0;
+	long nfd_count = 0, nfdcf_count = 0, wide_count = 0;
+	long nfd_esc_count = 0, nfdcf_esc_count = 0;
+	long disp_count = 0, slot_count = 0;
+	long plane_count = 0, block_count = 0, leaf_count = 0;
+	long i;
+	int bits, h;
+	u32 crc;
+
+	if (cpu_to_le32(1) != 1)
+		return -EINVAL;
+	if ((unsigned long)blob % APFS_UNITABLES_ALIGN || size < sizeof(*hdr))
+		return -EINVAL;
+	if (hdr->magic != APFS_UNITABLES_MAGIC ||
+	    hdr->version != APFS_UNITABLES_VERSION ||
+	    hdr->size < sizeof(*hdr) || hdr->size > size)
+		return -EINVAL;
+
+	memcpy(&copy, hdr, sizeof(copy));
+	copy.checksum = 0;
+	crc = crc32c(~0, &copy, sizeof(copy));
+	crc = crc32c(crc, blob + sizeof(copy), hdr->size - sizeof(copy));
+	if (crc != hdr->checksum)
+		return -EINVAL;
+
+	/* The levels must split the bits of the characters among them */
+	if (hdr->trie_height < 1 ||
+	    hdr->trie_height > APFS_UNITABLES_MAX_HEIGHT)
+		return -EINVAL;
+	bits = 0;
+	for (h = hdr->trie_height - 1; h >= 0; --h) {
+		if (!hdr->trie_bits[h] || hdr->trie_shift[h] != bits)
+			return -EINVAL;
+		bits += hdr->trie_bits[h];
+	}
+	if (bits != 21)
+		return -EINVAL;
+	tables->trie_height = hdr->trie_height;
+	tables->trie_bits = hdr->trie_bits;
+	tables->trie_shift = hdr->trie_shift;
+	tables->trie_base = hdr->trie_base;
+
+	tables->trie = apfs_unitables_find(blob, APFS_UNITABLES_TRIE,
+					   sizeof(*tables->trie), &trie_count);
+	tables->unidata = apfs_unitables_find(blob, APFS_UNITABLES_UNIDATA,
+					      sizeof(*tables->unidata),
+					      &unidata_count);
+	tables->unidata_2byte = apfs_unitables_find(blob,
+					APFS_UNITABLES_UNIDATA_2BYTE,
+					sizeof(*tables->unidata_2byte),
+					&twobyte_count);
+	tables->nfd = apfs_unitables_find(blob, APFS_UNITABLES_NFD,
+					  sizeof(*tables->nfd), &nfd_count);
+	tables->nfdcf = apfs_unitables_find(blob, APFS_UNITABLES_NFDCF,
+					    sizeof(*tables->nfdcf),
+					    &nfdcf_count);
+	tables->nfd_esc = apfs_unitables_find(blob, APFS_UNITABLES_NFD_ESC,
+					      sizeof(*tables->nfd_esc),
+					      &nfd_esc_count);
+	tables->nfdcf_esc = apfs_unitables_find(blob, APFS_UNITABLES_NFDCF_ESC,
+						sizeof(*tables->nfdcf_esc),
+						&nfdcf_esc_count);
+	tables->qc_planes = apfs_unitables_find(blob, APFS_UNITABLES_QC_PLANES,
+						sizeof(*tables->qc_planes),
+						&plane_count);
+	tables->qc_blocks = apfs_unitables_find(blob, APFS_UNITABLES_QC_BLOCKS,
+						sizeof(*tables->qc_blocks),
+						&block_count);
+	tables->qc_leaves = apfs_unitables_find(blob, APFS_UNITABLES_QC_LEAVES,
+						sizeof(*tables->qc_leaves),
+						&leaf_count);
+	tables->hash_disp = apfs_unitables_find(blob, APFS_UNITABLES_HASH_DISP,
+						sizeof(*tables->hash_disp),
+						&disp_count);
+	tables->hash_slots = apfs_unitables_find(blob,
+						 APFS_UNITABLES_HASH_SLOTS,
+						 sizeof(*tables->hash_slots),
+						 &slot_count);
+	tables->value_wide = apfs_unitables_find(blob,
+						 APFS_UNITABLES_VALUE_WIDE,
+						 sizeof(*tables->value_wide),
+						 &wide_count);
+	if (!tables->trie || !tables->unidata || !tables->unidata_2byte ||
+	    !tables->nfd || !tables->nfdcf || !tables->nfd_esc ||
+	    !tables->nfdcf_esc || !tables->qc_planes ||
+	    !tables->qc_blocks || !tables->qc_leaves ||
+	    !tables->hash_disp || !tables->hash_slots || !tables->value_wide)
+		return -EINVAL;
+	if (twobyte_count != UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST + 1 ||
+	    plane_count != APFS_QC_PLANES || !unidata_count ||
+	    !disp_count || !slot_count)
+		return -EINVAL;
+	tables->hash_buckets = disp_count;
+	tables->hash_size = slot_count;
+
+	if (!apfs_unitables_walk(tables, trie_count, unidata_count, 0, 0))
+		return -EINVAL;
+	for (i = 0; i < slot_count; ++i) {
+		if (tables->hash_slots[i] >> HASH_KEY_BITS >= unidata_count)
+			return -EINVAL;
+	}
+	if (!apfs_escapes_valid(tables->nfd_esc, nfd_esc_count, nfd_count) ||
+	    !apfs_escapes_valid(tables->nfdcf_esc, nfdcf_esc_count,
+				nfdcf_count))
+		return -EINVAL;
+	for (i = 0; i < unidata_count + twobyte_count; ++i) {
+		const struct apfs_unidata *data = i < unidata_count ?
+			&tables->unidata[i] :
+			&tables->unidata_2byte[i - unidata_count];
+
+		if (!apfs_value_valid(data->nfd, nfd_count, nfd_esc_count) ||
+		    !apfs_value_valid(data->nfdcf, nfdcf_count,
+				      nfdcf_esc_count))
+			return -EINVAL;
+	}
+	if (!apfs_values_valid(tables->nfd, nfd_count, wide_count) ||
+	    !apfs_values_valid(tables->nfdcf, nfdcf_count, wide_count) ||
+	    !apfs_wide_valid(tables->value_wide, wide_count))
+		return -EINVAL;
+
+	for (i = 0; i < plane_count; ++i) {
+		if (tables->qc_planes[i] >= block_count)
+			return -EINVAL;
+	}
+	for (i = 0; i < block_count * 256; ++i) {
+		if (tables->qc_blocks[i / 256][i % 256] >= leaf_count)
+			return -EINVAL;
+	}
+	return 0;
+}
+
+/**
+ * apfs_use_unitables - Switch to the tables in a binary table file
+ * @blob:	contents of the file, aligned to a cache line
+ * @size:	size of @blob
+ *
+ * The tables are checked and then used in place, without copying, so @blob
+ * must remain valid until they are replaced. The tables can only be switched
+ * while no normalization is running on any thread.
+ *
+ * Returns 0 on success, or -EINVAL if @blob is not a valid table file; the
+ * tables in use are left alone in that case.
+ */
+int apfs_use_unitables(const void *blob, size_t size)
+{
+	struct apfs_unitables tables;
+	int err;
+
+	err = apfs_unitables_parse(blob, size, &tables);
+	if (err)
+		return err;
+	apfs_unload_unitables();
+	apfs_loaded_tables = tables;
+	apfs_tables = &apfs_loaded_tables;
+	return 0;
+}
+
+/**
+ * apfs_load_unitables - Map a binary table file and switch to its tables
+ * @path:	path to the file, written by "mktrie -o"
+ *
+ * The file is mapped read-only and shared, so all processes that load the
+ * same file also share a single copy of the tables in the page cache. Like
+ * apfs_use_unitables(), this may only be called while no normalization is
+ * running on any thread.
+ *
+ * Returns 0 on success, -EIO if the file can't be mapped, or -EINVAL if it's
+ * not a valid table file; the tables in use are left alone on failure.
+ */
+int apfs_load_unitables(const char *path)
+{
+	struct stat st;
+	void *map;
+	int fd, err;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return -EIO;
+	if (fstat(fd, &st) || st.st_size <= 0) {
+		close(fd);
+		return -EIO;
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return -EIO;
+
+	err = apfs_use_unitables(map, st.st_size);
+	if (err) {
+		munmap(map, st.st_size);
+		return err;
+	}
+	apfs_unitables_map = map;
+	apfs_unitables_map_size = st.st_size;
+	return 0;
+}
+
+/**
+ * apfs_unload_unitables - Go back to the built-in tables
+ *
+ * If the tables in use were mapped by apfs_load_unitables(), the mapping is
+ * removed. No normalization may be running on any thread.
+ */
+void apfs_unload_unitables(void)
+{
+	apfs_tables = &apfs_builtin_tables;
+	if (apfs_unitables_map)
+		munmap(apfs_unitables_map, apfs_unitables_map_size);
+	apfs_unitables_map = NULL;
+	apfs_unitables_map_size = 0;
 }
+#endif	/* APFS_LOADABLE_TABLES */
 
 /*
  * The following arrays were built with data provided by the Unicode Standard,
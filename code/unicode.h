@@ -1,17 +1,115 @@
+/* Number of normalized characters that a cursor can hold at a time */
+#define APFS_UNICURSOR_BUFSIZE	32
+
+/*
+ * Size of the buffer for substrings that cross from one input segment to the
+ * next; it fits any substring of a name, which is at most 255 bytes long.
+ */
+#define APFS_UNICURSOR_CARRY	256
+
+/* A piece of a UTF-8 string that is not contiguous in memory */
+struct apfs_unisegment {
+	const char *ptr;
+	int len;
+};
+
+/*
+ * The state of a cursor for a segmented string. It's kept apart from the
+ * cursor, so that the usual cursors for contiguous strings stay small.
+ */
+struct apfs_unisegs {
+	const struct apfs_unisegment *next; /* Segments after the current one */
+	int count;		/* Number of segments after the current one */
+	int off;		/* Bytes of the next segment already carried */
+	char carry[APFS_UNICURSOR_CARRY]; /* Substring across two segments */
+};
+
 /*
  * This structure helps apfs_normalize_next() to retrieve one normalized
  * (and case-folded) UTF-32 character at a time from a UTF-8 string.
  */
 struct apfs_unicursor {
 	const char *utf8curr;	/* Start of UTF-8 to decompose and reorder */
-	int length;		/* Length of normalization until next starter */
-	int last_pos;           /* Offset in substring of last char returned */
-	u8 last_ccc;		/* CCC of the last character returned */
+	const char *utf8end;	/* End of the current segment of UTF-8 */
+	int buf_len;		/* Number of characters in the buffer */
+	int buf_pos;		/* Position in the buffer of the next one */
+	bool more;		/* Substring didn't fit in the buffer? */
+	u64 last_key;		/* Sort key of the last char buffered */
+	u8 stream_safe;		/* One of the APFS_STREAM_SAFE_* modes */
+	u8 nonstarters;		/* Run cut by a CGJ before utf8curr, if any */
+	unicode_t buf[APFS_UNICURSOR_BUFSIZE]; /* Decomposed and reordered */
+	struct apfs_unisegs *segs; /* NULL unless the string is segmented */
 };
 
+/* Handling of long runs of non-starters, see apfs_unicursor_stream_safe() */
+#define APFS_STREAM_SAFE_OFF	0	/* Normalize them like any others */
+#define APFS_STREAM_SAFE	1	/* Break them up with a CGJ */
+#define APFS_STREAM_SAFE_STRICT	2	/* Reject them like invalid UTF-8 */
+
+/* Flags for apfs_normalize_string() */
+#define APFS_NORM_CASE_FOLD	0x01	/* Case fold the string */
+#define APFS_NORM_UTF8		0x02	/* Output UTF-8 instead of UTF-32 */
+#define APFS_NORM_STREAM_SAFE	0x04	/* Use APFS_STREAM_SAFE */
+#define APFS_NORM_STREAM_STRICT	0x08	/* Use APFS_STREAM_SAFE_STRICT */
+
 extern void apfs_init_unicursor(struct apfs_unicursor *cursor,
 				 const char *utf8str);
+extern void apfs_init_unicursor_len(struct apfs_unicursor *cursor,
+				    const char *utf8str, int len);
+extern void apfs_init_unicursor_segs(struct apfs_unicursor *cursor,
+				     struct apfs_unisegs *state,
+				     const struct apfs_unisegment *segs,
+				     int count);
+extern void apfs_unicursor_stream_safe(struct apfs_unicursor *cursor,
+				       int mode);
+extern bool apfs_unicursor_stopped(struct apfs_unicursor *cursor);
 extern unicode_t apfs_normalize_next(struct apfs_unicursor *cursor,
 				     bool case_fold);
+extern int apfs_normalize_ascii(struct apfs_unicursor *cursor, u8 *buf,
+				int buflen, bool case_fold);
+extern int apfs_normalize_string(const char *src, int len, void *dst,
+				 int dstlen, unsigned int flags);
+extern bool apfs_is_normalized(const char *name, int len, bool case_fold);
+extern u32 apfs_normalize_hash(const char *name, int len, bool case_fold);
+extern int apfs_normalize_hash_size(const char *name, int len, bool case_fold,
+				    u32 *hash);
+extern int apfs_normalized_cmp(const char *a, const char *b, bool case_fold);
+
+#ifdef APFS_LOADABLE_TABLES
+extern int apfs_use_unitables(const void *blob, size_t size);
+extern int apfs_load_unitables(const char *path);
+extern void apfs_unload_unitables(void);
+#endif
+
+#ifdef APFS_UNICODE_STATS
+/* Trie levels with their own counter of early misses; the rest share one */
+#define APFS_STATS_LEVELS	8
+/* Buckets for the characters scanned by a fill: 1, 2-3, 4-7, ..., 64+ */
+#define APFS_STATS_SUBSTR	7
+
+/*
+ * Counters for the work done by the normalization code, kept per cpu in the
+ * kernel and per thread in user space. They are only built in if
+ * APFS_UNICODE_STATS is defined, and cost nothing otherwise.
+ */
+struct apfs_unistats {
+	unsigned long next_calls;	/* Calls to apfs_normalize_next() */
+	unsigned long next_chars;	/* Characters returned by those calls */
+	unsigned long ascii_chars;	/* Characters from the ASCII fast paths */
+	unsigned long twobyte_chars;	/* Characters from the two-byte one */
+	unsigned long fills;		/* Scans of a substring */
+	unsigned long decodes;		/* Calls to utf8_to_utf32() */
+	unsigned long lookups;		/* Normalization data lookups */
+	unsigned long trie_walks;	/* Lookups that had to walk the trie */
+	unsigned long trie_misses[APFS_STATS_LEVELS]; /* Empty child, by level */
+	unsigned long substrings[APFS_STATS_SUBSTR]; /* Fills by chars scanned */
+	unsigned long quick_yes;	/* Names found normalized by quick check */
+	unsigned long quick_no;		/* Names that were not */
+	unsigned long hash_probes;	/* Lookups in the perfect hash */
+	unsigned long hash_misses;	/* Those that found no record */
+};
+
+extern void apfs_get_unistats(struct apfs_unistats *stats);
+#endif	/* APFS_UNICODE_STATS */
 
 #endif	/* _APFS_UNICODE_H */
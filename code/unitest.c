@@ -0,0 +1,1203 @@
+/*
+ * Tests for the user-space build of the normalization code: checks it against
+ * the conformance data in ucd/NormalizationTest.txt, plus some extra cases.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "unicode.h"
+#include "unicache.h"
+
+/* Kinds of checks, each with its own line in the summary */
+enum test_kind {
+	TEST_CONFORMANCE,	/* Lines from NormalizationTest.txt */
+	TEST_UNLISTED,		/* Chars not listed there, which don't change */
+	TEST_IDEMPOTENCE,	/* Normalizing twice is the same as once */
+	TEST_OTHER,		/* Everything else */
+	TEST_KINDS
+};
+
+static const char *const test_kind_names[TEST_KINDS] = {
+	"Conformance tests", "Unlisted code points", "Idempotence checks",
+	"Other tests",
+};
+
+static long test_checks[TEST_KINDS];
+static long test_failures[TEST_KINDS];
+
+/* Messages for the failed checks, printed once all workers are done */
+static char **failures;
+static int failure_count;
+static pthread_mutex_t failures_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Count a check of the given kind, and record the message if it failed */
+static void report(enum test_kind kind, bool passed, const char *fmt, ...)
+{
+	char msg[1024];
+	va_list args;
+
+	__atomic_add_fetch(&test_checks[kind], 1, __ATOMIC_RELAXED);
+	if (passed)
+		return;
+	__atomic_add_fetch(&test_failures[kind], 1, __ATOMIC_RELAXED);
+
+	va_start(args, fmt);
+	vsnprintf(msg, sizeof(msg), fmt, args);
+	va_end(args);
+
+	pthread_mutex_lock(&failures_lock);
+	failures = realloc(failures, (failure_count + 1) * sizeof(*failures));
+	if (!failures) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+	failures[failure_count] = strdup(msg);
+	if (!failures[failure_count++]) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+	pthread_mutex_unlock(&failures_lock);
+}
+
+static int unilength(unsigned int *um)
+{
+	int length = 0;
+
+	if (!um)
+		return 0;
+
+	for (; *um; um++)
+		length++;
+
+	return length;
+}
+
+/* Bit by bit CRC32C of @count characters, to check the hash against */
+static u32 hash_reference(const unicode_t *str, int count)
+{
+	u32 crc = ~0;
+	int i, j;
+
+	for (i = 0; i < count; ++i) {
+		for (j = 0; j < 32; ++j) {
+			u32 bit = (crc ^ (str[i] >> j)) & 1;
+
+			crc = (crc >> 1) ^ (bit ? 0x82f63b78 : 0);
+		}
+	}
+	return crc;
+}
+
+/* Test if apfs_normalize_string() normalizes @utf8str to @norm */
+bool test_normalize_string(u8 *utf8str, unicode_t *norm)
+{
+	unicode_t utf32buf[256];
+	u8 utf8buf[1024], expected[1024];
+	int len = strlen((char *)utf8str);
+	int normlen = unilength(norm);
+	int explen = 0;
+	int ret, i;
+	u32 hash;
+
+	ret = apfs_normalize_string((char *)utf8str, len, utf32buf,
+				    sizeof(utf32buf), 0 /* flags */);
+	if (ret != normlen * sizeof(unicode_t) ||
+	    memcmp(utf32buf, norm, ret))
+		return false;
+
+	for (i = 0; i < normlen; ++i)
+		explen += utf32_to_utf8(norm[i], expected + explen, 4);
+	expected[explen] = 0;
+	if (apfs_normalized_cmp((char *)utf8str, (char *)expected, false) ||
+	    apfs_normalized_cmp((char *)expected, (char *)utf8str, false))
+		return false;
+	ret = apfs_normalize_string((char *)utf8str, len, utf8buf,
+				    sizeof(utf8buf), APFS_NORM_UTF8);
+	if (ret != explen || memcmp(utf8buf, expected, ret))
+		return false;
+
+	/* The quick check must agree with the expected normalization */
+	if (apfs_is_normalized((char *)utf8str, len, false) !=
+	    (explen == len && !memcmp(utf8str, expected, len)))
+		return false;
+	if (!apfs_is_normalized((char *)expected, explen, false))
+		return false;
+
+	/*
+	 * The full size must be reported even if the buffer is too small, and
+	 * nothing may be written past its end.
+	 */
+	memset(utf8buf, 0xaa, sizeof(utf8buf));
+	ret = apfs_normalize_string((char *)utf8str, len, utf8buf, explen / 2,
+				    APFS_NORM_UTF8);
+	if (ret != explen)
+		return false;
+	for (i = explen / 2; i < explen; ++i) {
+		if (utf8buf[i] != 0xaa)
+			return false;
+	}
+	ret = apfs_normalize_string((char *)utf8str, len, NULL, 0,
+				    0 /* flags */);
+	if (ret != normlen * sizeof(unicode_t))
+		return false;
+
+	/* The hash is the same with or without the size */
+	ret = apfs_normalize_hash_size((char *)utf8str, len, false, &hash);
+	if (ret != explen || hash != hash_reference(norm, normlen))
+		return false;
+	return apfs_normalize_hash((char *)utf8str, len, false /* case_fold */)
+	       == hash;
+}
+
+/* Encode @str as UTF-8 in @buf; returns false if it doesn't fit or is bad */
+static bool encode_utf8(const unicode_t *str, u8 *buf, int buflen)
+{
+	for (; *str; str++) {
+		int len;
+
+		len = utf32_to_utf8(*str, buf, buflen - 1);
+		if (len < 0)
+			return false;
+		buf += len;
+		buflen -= len;
+	}
+	*buf = 0;
+	return true;
+}
+
+/*
+ * Normalize @utf8str into @out, with the string split into segments of
+ * @seglen bytes; each is copied to its own place in @buf, followed by a byte
+ * that is never valid UTF-8, to catch reads past its end. The cursor uses
+ * the Stream-Safe @mode. Returns the number of characters, or -1 if the
+ * cursor stopped early.
+ */
+static int normalize_segmented(const u8 *utf8str, int seglen, u8 *buf,
+			       unicode_t *out, bool case_fold, int mode)
+{
+	struct apfs_unisegment segs[1024];
+	struct apfs_unisegs state;
+	struct apfs_unicursor cursor;
+	int len = strlen((char *)utf8str);
+	int count = 0, nsegs = 0;
+	int i;
+
+	for (i = 0; i < len || !nsegs; i += seglen) {
+		int curr = len - i < seglen ? len - i : seglen;
+
+		memcpy(buf, utf8str + i, curr);
+		buf[curr] = 0xff;
+		segs[nsegs].ptr = (char *)buf;
+		segs[nsegs++].len = curr;
+		buf += curr + 1;
+	}
+
+	apfs_init_unicursor_segs(&cursor, &state, segs, nsegs);
+	apfs_unicursor_stream_safe(&cursor, mode);
+	while (1) {
+		u8 run[16];
+		int runlen;
+
+		runlen = apfs_normalize_ascii(&cursor, run, sizeof(run),
+					      case_fold);
+		for (i = 0; i < runlen; ++i)
+			out[count++] = run[i];
+		if (runlen)
+			continue;
+		out[count] = apfs_normalize_next(&cursor, case_fold);
+		if (!out[count])
+			break;
+		count++;
+	}
+	return apfs_unicursor_stopped(&cursor) ? -1 : count;
+}
+
+/*
+ * Test that @utf8str normalizes to @norm when split into segments. Strings
+ * that may have a substring too long to cross a boundary can also be cut
+ * short, but never normalized wrong.
+ */
+static bool test_segments(const u8 *utf8str, const unicode_t *norm)
+{
+	static const int seglens[] = {1, 2, 3, 5, 64};
+	bool fits = strlen((char *)utf8str) <= APFS_UNICURSOR_CARRY - 4;
+	int normlen = unilength((unsigned int *)norm);
+	unicode_t out[512];
+	u8 buf[4096];
+	int i;
+
+	for (i = 0; i < sizeof(seglens) / sizeof(seglens[0]); ++i) {
+		int count;
+
+		count = normalize_segmented(utf8str, seglens[i], buf, out,
+					    false /* case_fold */,
+					    APFS_STREAM_SAFE_OFF);
+		if (count < 0 && !fits)
+			continue;
+		if (count != normlen ||
+		    memcmp(out, norm, count * sizeof(*out)))
+			return false;
+	}
+	return true;
+}
+
+/* Test if @str normalizes to @norm */
+void test_normalization(enum test_kind kind, unicode_t *str, unicode_t *norm)
+{
+	struct apfs_unicursor cursor;
+	unicode_t *fullnorm = norm;
+	u8 utf8str[1024];
+
+	if (!encode_utf8(str, utf8str, sizeof(utf8str)))
+		return; /* Invalid UTF-32, ignore */
+
+	apfs_init_unicursor(&cursor, (char *)utf8str);
+	while (1) {
+		unicode_t curr;
+
+		curr = apfs_normalize_next(&cursor, false /* case_fold */);
+		if (curr != *norm) {
+			report(kind, false, "FAIL: wrong NFD for string %s",
+			       utf8str);
+			return;
+		}
+		if (!curr)
+			break;
+		norm++;
+	}
+	report(kind, test_segments(utf8str, fullnorm),
+	       "FAIL: wrong NFD for segmented string %s", utf8str);
+	report(kind, test_normalize_string(utf8str, fullnorm),
+	       "FAIL: wrong bulk NFD for string %s", utf8str);
+}
+
+/* Test that normalizing the normalization of @c changes nothing */
+static void test_idempotence(unicode_t c)
+{
+	unicode_t str[2] = {c, 0};
+	u8 utf8str[8], once[256], twice[256];
+	int fold;
+
+	if (!encode_utf8(str, utf8str, sizeof(utf8str)))
+		return; /* Surrogate */
+
+	for (fold = 0; fold < 2; ++fold) {
+		unsigned int flags = APFS_NORM_UTF8;
+		struct apfs_unicursor cursor;
+		int len, len2;
+		bool same;
+
+		if (fold)
+			flags |= APFS_NORM_CASE_FOLD;
+		len = apfs_normalize_string((char *)utf8str, strlen((char *)utf8str),
+					    once, sizeof(once) - 1, flags);
+		if (len < 0 || len >= sizeof(once)) {
+			report(TEST_IDEMPOTENCE, false,
+			       "FAIL: can't normalize U+%04X", c);
+			continue;
+		}
+		len2 = apfs_normalize_string((char *)once, len, twice,
+					     sizeof(twice), flags);
+		report(TEST_IDEMPOTENCE, len2 == len && !memcmp(once, twice, len),
+		       "FAIL: normalization of U+%04X is not stable%s", c,
+		       fold ? " when case folded" : "");
+
+		/*
+		 * The quick check must agree with the cursor, which doesn't
+		 * use it; the bulk normalization does.
+		 */
+		apfs_init_unicursor(&cursor, (char *)utf8str);
+		same = apfs_normalize_next(&cursor, fold) == c &&
+		       !apfs_normalize_next(&cursor, fold);
+		report(TEST_IDEMPOTENCE,
+		       apfs_is_normalized((char *)once, len, fold) &&
+		       apfs_is_normalized((char *)utf8str, sizeof(utf8str),
+					  fold) == same,
+		       "FAIL: wrong quick check for U+%04X%s", c,
+		       fold ? " when case folded" : "");
+	}
+}
+
+/*
+ * Normalize @utf8str into @out, consuming ASCII runs in chunks of at most
+ * @chunk characters if @chunk is not zero. Returns the number of characters.
+ */
+int normalize_with_runs(const char *utf8str, unicode_t *out, int chunk,
+			bool case_fold)
+{
+	struct apfs_unicursor cursor;
+	u8 run[256];
+	int count = 0;
+
+	apfs_init_unicursor(&cursor, utf8str);
+	while (1) {
+		int len, i;
+
+		if (chunk) {
+			len = apfs_normalize_ascii(&cursor, run, chunk,
+						   case_fold);
+			for (i = 0; i < len; ++i)
+				out[count++] = run[i];
+			if (len)
+				continue;
+		}
+		out[count] = apfs_normalize_next(&cursor, case_fold);
+		if (!out[count])
+			return count;
+		count++;
+	}
+}
+
+/* Compare two arrays of characters, the way apfs_normalized_cmp() should */
+static int cmp_reference(const unicode_t *a, int alen, const unicode_t *b,
+			 int blen)
+{
+	int i;
+
+	for (i = 0; i < alen && i < blen; ++i) {
+		if (a[i] != b[i])
+			return a[i] < b[i] ? -1 : 1;
+	}
+	return alen == blen ? 0 : alen < blen ? -1 : 1;
+}
+
+static int sign(int x)
+{
+	return (x > 0) - (x < 0);
+}
+
+/*
+ * Test apfs_normalized_cmp() on @s, whose normalization is @norm, against
+ * some variations of it: a change of case, or of a single character.
+ */
+static bool test_cmp_variants(const char *s, const unicode_t *norm, int count,
+			      bool case_fold)
+{
+	static const char *const edits[] = {"A", "a", "~", "\xc3\x89",
+					    "e\xcc\x81", "\xcc\x81", ""};
+	unicode_t other[300];
+	char variant[300], other_name[300];
+	int len = strlen(s);
+	int pos, i;
+
+	if (apfs_normalized_cmp(s, s, case_fold))
+		return false;
+
+	/* Swap the case of all ASCII letters */
+	for (i = 0; i <= len; ++i)
+		variant[i] = (s[i] | 0x20) >= 'a' && (s[i] | 0x20) <= 'z' ?
+			     s[i] ^ 0x20 : s[i];
+	i = normalize_with_runs(variant, other, 0, case_fold);
+	if (sign(apfs_normalized_cmp(s, variant, case_fold)) !=
+	    cmp_reference(norm, count, other, i))
+		return false;
+
+	/* A longer name sorts last, even if its tail is not valid UTF-8 */
+	if (snprintf(variant, sizeof(variant), "%s.", s) >= sizeof(variant))
+		return false;
+	if (apfs_normalized_cmp(s, variant, case_fold) >= 0 ||
+	    apfs_normalized_cmp(variant, s, case_fold) <= 0)
+		return false;
+	for (i = 0; s[i] && isascii(s[i]); ++i)
+		variant[i] = s[i];
+	variant[i] = 0;
+	if (snprintf(other_name, sizeof(other_name), "%s.", variant) >=
+	    sizeof(other_name))
+		return false;
+	if (apfs_normalized_cmp(variant, other_name, case_fold) >= 0 ||
+	    apfs_normalized_cmp(other_name, variant, case_fold) <= 0)
+		return false;
+	if (snprintf(variant, sizeof(variant), "%s\xff", s) >= sizeof(variant))
+		return false;
+	if (apfs_normalized_cmp(s, variant, case_fold) >= 0)
+		return false;
+	if (snprintf(other_name, sizeof(other_name), "%s\xfe", s) >=
+	    sizeof(other_name))
+		return false;
+	if (apfs_normalized_cmp(other_name, variant, case_fold) >= 0)
+		return false;
+
+	/* Replace a single byte with each of the edits */
+	for (pos = 0; pos < len; pos += 5) {
+		for (i = 0; i < sizeof(edits) / sizeof(edits[0]); ++i) {
+			int n, expected;
+
+			memcpy(variant, s, pos);
+			strcpy(variant + pos, edits[i]);
+			strcat(variant, s + pos + 1);
+			n = normalize_with_runs(variant, other, 0, case_fold);
+			expected = cmp_reference(norm, count, other, n);
+
+			/*
+			 * Invalid names never match a valid one; the leftover
+			 * bytes make them sort last.
+			 */
+			if (!expected && apfs_normalize_string(variant,
+					strlen(variant), NULL, 0, 0) < 0)
+				expected = -1;
+
+			if (sign(apfs_normalized_cmp(s, variant, case_fold)) !=
+			    expected ||
+			    sign(apfs_normalized_cmp(variant, s, case_fold)) !=
+			    -expected)
+				return false;
+		}
+	}
+	return true;
+}
+
+/*
+ * Test that ASCII runs are normalized the same way one char at a time, with
+ * the runs starting at the given offset from an aligned buffer
+ */
+void test_ascii_runs(long offset)
+{
+	static const char pattern[] = "aZ09_.MnOpQrStUvWxYz -~@[`{AbCdEfGh";
+	char buf[256] __attribute__((aligned(64)));
+	unicode_t expected[256], actual[256];
+	int len, chunk, fold;
+
+	for (len = 0; len < 80; ++len) {
+		char *s = buf + offset;
+		int i;
+
+		for (i = 0; i < len; ++i)
+			s[i] = pattern[(i * 3) % (sizeof(pattern) - 1)];
+		/* Follow the run with an accented char and more ASCII */
+		strcpy(s + len, "\xc3\x89Tail");
+
+		for (fold = 0; fold < 2; ++fold) {
+			int count;
+
+			count = normalize_with_runs(s, expected, 0, fold);
+			report(TEST_OTHER,
+			       apfs_normalize_hash(s, strlen(s), fold) ==
+			       hash_reference(expected, count),
+			       "FAIL: wrong hash for string %s", s);
+			report(TEST_OTHER,
+			       test_cmp_variants(s, expected, count, fold),
+			       "FAIL: wrong comparison for string %s", s);
+			for (chunk = 1; chunk < 64; chunk += 7) {
+				bool ok;
+
+				ok = normalize_with_runs(s, actual, chunk,
+							 fold) == count &&
+				     !memcmp(expected, actual,
+					     count * sizeof(*actual));
+				report(TEST_OTHER, ok,
+				       "FAIL: wrong ASCII run for string %s",
+				       s);
+			}
+		}
+	}
+}
+
+/* Test long runs of non-starters, which don't fit in the cursor buffer */
+void test_long_sequences(long unused)
+{
+	/* Marks in order of increasing canonical combining class */
+	static const unicode_t marks[] = {0x05b0, 0x0316, 0x0301, 0x0345};
+	static const int order[] = {2, 0, 3, 1};
+	unicode_t str[202], norm[202];
+	int len, i, j, k;
+
+	for (len = 0; len < 200; len += 3) {
+		str[0] = norm[0] = 'a';
+		for (i = 0; i < len; ++i)
+			str[i + 1] = marks[order[i % 4]];
+		str[len + 1] = 'b';
+		str[len + 2] = 0;
+
+		/* A stable sort by ccc of the marks that follow the 'a' */
+		k = 1;
+		for (j = 0; j < 4; ++j) {
+			for (i = 0; i < len; ++i) {
+				if (str[i + 1] == marks[j])
+					norm[k++] = marks[j];
+			}
+		}
+		norm[k++] = 'b';
+		norm[k] = 0;
+		test_normalization(TEST_OTHER, str, norm);
+	}
+
+	/* Any substring that fits in a name can cross segments */
+	for (len = 0; 1 + 2 * len <= 255; ++len) {
+		u8 utf8str[256], buf[1024];
+		unicode_t out[256];
+		int count, seglen;
+
+		utf8str[0] = 'a';
+		for (i = 0; i < len; ++i)
+			memcpy(utf8str + 1 + 2 * i, "\xcc\x81", 2);
+		utf8str[1 + 2 * len] = 0;
+
+		/* Split in bytes, and in two halves like a name across pages */
+		for (seglen = 1; seglen <= 128; seglen += 127) {
+			count = normalize_segmented(utf8str, seglen, buf, out,
+						    false,
+						    APFS_STREAM_SAFE_OFF);
+			report(TEST_OTHER, count == len + 1,
+			       "FAIL: wrong segmented NFD for %d marks", len);
+		}
+	}
+}
+
+/*
+ * Normalize @utf8str into @out with the Stream-Safe @mode, one character at
+ * a time. Returns the number of characters, or -1 if the cursor stopped
+ * early; @bounded is cleared if a substring didn't fit in the buffer.
+ */
+static int normalize_stream_safe(const u8 *utf8str, unicode_t *out,
+				 bool case_fold, int mode, bool *bounded)
+{
+	struct apfs_unicursor cursor;
+	int count = 0;
+
+	apfs_init_unicursor(&cursor, (char *)utf8str);
+	apfs_unicursor_stream_safe(&cursor, mode);
+	while ((out[count] = apfs_normalize_next(&cursor, case_fold))) {
+		if (cursor.more)
+			*bounded = false;
+		count++;
+	}
+	return apfs_unicursor_stopped(&cursor) ? -1 : count;
+}
+
+/*
+ * Test the Stream-Safe modes on long runs of marks: a CGJ must break them up
+ * every 30 non-starters, and no substring may need more than one fill. The
+ * strict mode must reject the same runs that get a CGJ.
+ */
+void test_stream_safe(long unused)
+{
+	/* Marks in order of increasing canonical combining class */
+	static const unicode_t marks[] = {0x05b0, 0x0327, 0x0316, 0x0301};
+	static const int order[] = {3, 1, 0, 2};
+	unicode_t str[1004], norm[1100], out[1100];
+	u8 utf8str[4096], buf[8192];
+	int len, i, j, k, fold;
+
+	for (len = 0; len < 1000; len += len < 70 ? 1 : 37) {
+		int chunk, utf8len, ret;
+		bool bounded = true;
+
+		str[0] = norm[0] = 'a';
+		for (i = 0; i < len; ++i)
+			str[i + 1] = marks[order[i % 4]];
+		str[len + 1] = 'b';
+		str[len + 2] = 0;
+		encode_utf8(str, utf8str, sizeof(utf8str));
+		utf8len = strlen((char *)utf8str);
+
+		/* Each run of 30 marks gets its own stable sort by ccc */
+		k = 1;
+		for (chunk = 0; chunk < len; chunk += 30) {
+			if (chunk)
+				norm[k++] = 0x034f;
+			for (j = 0; j < 4; ++j) {
+				for (i = chunk; i < len && i < chunk + 30; ++i) {
+					if (str[i + 1] == marks[j])
+						norm[k++] = marks[j];
+				}
+			}
+		}
+		norm[k++] = 'b';
+		norm[k] = 0;
+
+		for (fold = 0; fold < 2; ++fold) {
+			ret = normalize_stream_safe(utf8str, out, fold,
+						    APFS_STREAM_SAFE,
+						    &bounded);
+			report(TEST_OTHER, ret == k &&
+			       !memcmp(out, norm, k * sizeof(*out)),
+			       "FAIL: no CGJ in %d marks", len);
+			report(TEST_OTHER, bounded,
+			       "FAIL: unbounded substring in %d marks", len);
+
+			ret = normalize_stream_safe(utf8str, out, fold,
+						    APFS_STREAM_SAFE_STRICT,
+						    &bounded);
+			report(TEST_OTHER, len > 30 ? ret < 0 : ret == k,
+			       "FAIL: wrong strict handling of %d marks", len);
+		}
+
+		ret = normalize_segmented(utf8str, 5, buf, out, false,
+					  APFS_STREAM_SAFE);
+		report(TEST_OTHER, ret == k &&
+		       !memcmp(out, norm, k * sizeof(*out)),
+		       "FAIL: no segmented CGJ in %d marks", len);
+
+		ret = apfs_normalize_string((char *)utf8str, utf8len, out,
+					    sizeof(out), APFS_NORM_STREAM_SAFE);
+		report(TEST_OTHER, ret == k * sizeof(*out) &&
+		       !memcmp(out, norm, ret),
+		       "FAIL: no bulk CGJ in %d marks", len);
+		ret = apfs_normalize_string((char *)utf8str, utf8len, NULL, 0,
+					    APFS_NORM_UTF8 |
+					    APFS_NORM_STREAM_STRICT);
+		report(TEST_OTHER, len > 30 ? ret < 0 : ret >= 0,
+		       "FAIL: wrong bulk strict handling of %d marks", len);
+	}
+
+	/*
+	 * The normalized marks are counted, so a char that decomposes to two
+	 * of them gets a CGJ if it would make the run too long, and the quick
+	 * check can't skip a long run that is already normalized.
+	 */
+	for (len = 28; len <= 30; ++len) {
+		u8 utf8buf[256];
+		int ret;
+
+		k = 0;
+		norm[k++] = 'a';
+		for (i = 0; i < len; ++i)
+			norm[k++] = 0x0301;
+		if (len > 28)
+			norm[k++] = 0x034f;
+		norm[k++] = 0x0308;
+		norm[k++] = 0x0301;
+		norm[k] = 0;
+		memcpy(str, norm, (len + 1) * sizeof(*str));
+		str[len + 1] = 0x0344;
+		str[len + 2] = 0;
+		encode_utf8(str, utf8str, sizeof(utf8str));
+
+		ret = apfs_normalize_string((char *)utf8str, strlen(
+					    (char *)utf8str), out, sizeof(out),
+					    APFS_NORM_STREAM_SAFE);
+		report(TEST_OTHER, ret == k * sizeof(*out) &&
+		       !memcmp(out, norm, ret),
+		       "FAIL: wrong CGJ for U+0344 after %d marks", len);
+
+		/* The same, but already normalized */
+		str[len + 1] = 0x0301;
+		str[len + 2] = 0x0301;
+		str[len + 3] = 0;
+		encode_utf8(str, utf8str, sizeof(utf8str));
+		ret = apfs_normalize_string((char *)utf8str, strlen(
+					    (char *)utf8str), utf8buf,
+					    sizeof(utf8buf), APFS_NORM_UTF8 |
+					    APFS_NORM_STREAM_SAFE);
+		report(TEST_OTHER,
+		       ret == strlen((char *)utf8str) + 2 * (len > 28),
+		       "FAIL: quick check let %d marks through", len + 2);
+	}
+}
+
+/*
+ * The case folding of U+0345 is a starter, so a character like U+1F80 is a
+ * whole substring under NFD but more than one if case folded.
+ */
+void test_case_fold_starters(long unused)
+{
+	static const unicode_t expected[] = {0x03b1, 0x0313, 0x03b9, 0x0301, 0};
+	struct apfs_unicursor cursor;
+	int i;
+
+	apfs_init_unicursor(&cursor, "\xe1\xbe\x80\xcc\x81");
+	for (i = 0; i < 5; ++i) {
+		if (apfs_normalize_next(&cursor, true) != expected[i])
+			break;
+	}
+	report(TEST_OTHER, i == 5, "FAIL: wrong case fold for U+1F80");
+}
+
+/* A line of NormalizationTest.txt */
+struct conformance_test {
+	unicode_t map[5][19];	/* The five columns */
+};
+
+static struct conformance_test *conformance_tests;
+static int conformance_count;
+
+/* Code points listed in part 1 of the tests, which are checked there */
+#define UNICODE_LIMIT	0x110000
+static u8 listed[UNICODE_LIMIT / 8];
+
+#define LINESIZE 1024
+
+/* Read the conformance tests into memory */
+static void read_conformance_tests(void)
+{
+	char line[LINESIZE];
+	char col[5][LINESIZE];
+	FILE *file;
+	int part = 0;
+	int size = 0;
+
+	file = fopen("ucd/NormalizationTest.txt", "r");
+	if (!file) {
+		printf("Failure to read test data!\n");
+		exit(1);
+	}
+
+	while (fgets(line, LINESIZE, file)) {
+		struct conformance_test *test;
+		int ret;
+		int i;
+
+		/* Part1 lists every char with a decomposition */
+		sscanf(line, "@Part%d", &part);
+
+		/* The docs count columns from one, so ci is col[i-1] here */
+		ret = sscanf(line, "%[^#;];%[^;];%[^;];%[^;];%[^;];",
+			     col[0], col[1], col[2], col[3], col[4]);
+		if (ret != 5)
+			continue;
+
+		if (conformance_count == size) {
+			size = size ? 2 * size : 1024;
+			conformance_tests = realloc(conformance_tests,
+						    size * sizeof(*test));
+			if (!conformance_tests) {
+				printf("Memory allocation failure!\n");
+				exit(1);
+			}
+		}
+		test = &conformance_tests[conformance_count++];
+
+		for (i = 0; i < 5; ++i) {
+			int j = 0;
+			char *s = col[i];
+
+			while (*s)
+				test->map[i][j++] = strtoul(s, &s, 16);
+			test->map[i][j] = 0;
+		}
+
+		if (part == 1) {
+			unicode_t c = test->map[0][0];
+
+			listed[c / 8] |= 1 << (c % 8);
+		}
+	}
+
+	fclose(file);
+}
+
+/* Number of conformance tests, or code points, run by each job */
+#define CONFORMANCE_BATCH	512
+#define CODE_POINT_BATCH	4096
+
+/* Run a batch of the conformance tests */
+static void test_conformance(long batch)
+{
+	int first = batch * CONFORMANCE_BATCH;
+	int i;
+
+	for (i = first; i < conformance_count &&
+			i < first + CONFORMANCE_BATCH; ++i) {
+		unicode_t (*map)[19] = conformance_tests[i].map;
+
+		/* Expected normalizations in the tests provided by unicode */
+		test_normalization(TEST_CONFORMANCE, map[0], map[2]);
+		test_normalization(TEST_CONFORMANCE, map[1], map[2]);
+		test_normalization(TEST_CONFORMANCE, map[2], map[2]);
+		test_normalization(TEST_CONFORMANCE, map[3], map[4]);
+		test_normalization(TEST_CONFORMANCE, map[4], map[4]);
+	}
+}
+
+/*
+ * Run a batch of the code point sweep: chars not listed in the tests must
+ * normalize to themselves, and no normalization may change if repeated
+ */
+static void test_code_points(long batch)
+{
+	unicode_t unichar[2];
+	unicode_t first = batch * CODE_POINT_BATCH;
+
+	unichar[1] = 0;
+	for (unichar[0] = first; unichar[0] < first + CODE_POINT_BATCH;
+	     ++unichar[0]) {
+		unicode_t c = unichar[0];
+
+		if (!c)
+			continue;
+		if (!(listed[c / 8] & 1 << (c % 8)))
+			test_normalization(TEST_UNLISTED, unichar, unichar);
+		test_idempotence(c);
+	}
+}
+
+/* Cache shared by all the jobs of test_unicache(), to check the locking */
+static struct apfs_unicache *shared_cache;
+
+/* Names looked up by the jobs of test_unicache(), and lookups per job */
+#define UNICACHE_NAMES		64
+#define UNICACHE_LOOKUPS	20000
+
+static char unicache_names[UNICACHE_NAMES][256];
+static u32 unicache_hashes[2][UNICACHE_NAMES];
+static int unicache_lens[2][UNICACHE_NAMES];
+
+/* Pick the names for test_unicache(), and normalize them without the cache */
+static void prepare_unicache(void)
+{
+	int i, fold;
+
+	shared_cache = apfs_unicache_create(UNICACHE_NAMES / 2);
+	if (!shared_cache) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+
+	for (i = 0; i < UNICACHE_NAMES; ++i) {
+		struct conformance_test *test;
+		char *name = unicache_names[i];
+
+		test = &conformance_tests[(i * 7919) % conformance_count];
+		encode_utf8(test->map[0], (u8 *)name,
+			    sizeof(unicache_names[i]));
+		for (fold = 0; fold < 2; ++fold) {
+			unsigned int flags = APFS_NORM_UTF8;
+
+			if (fold)
+				flags |= APFS_NORM_CASE_FOLD;
+			unicache_hashes[fold][i] =
+				apfs_normalize_hash(name, strlen(name), fold);
+			unicache_lens[fold][i] =
+				apfs_normalize_string(name, strlen(name), NULL,
+						      0, flags);
+		}
+	}
+}
+
+/*
+ * Look up the names again and again, in a cache too small for all of them,
+ * and check every result against the uncached functions. All the jobs share
+ * the cache, so they race for its entries.
+ */
+static void test_unicache(long seed)
+{
+	unsigned int state = seed * 2654435761u + 1;
+	int i;
+
+	for (i = 0; i < UNICACHE_LOOKUPS; ++i) {
+		int j, fold, len;
+		u32 hash;
+
+		state = state * 1103515245 + 12345;
+		/* A few names are much hotter than the others */
+		j = (state >> 8) % (state & 0x80 ? 8 : UNICACHE_NAMES);
+		fold = (state >> 20) & 1;
+		len = apfs_unicache_lookup(shared_cache, unicache_names[j],
+					   strlen(unicache_names[j]), fold,
+					   &hash);
+		report(TEST_OTHER, len == unicache_lens[fold][j] &&
+		       hash == unicache_hashes[fold][j],
+		       "FAIL: wrong cached normalization for string %s",
+		       unicache_names[j]);
+	}
+}
+
+/* Check the counters of a cache, and that it never grows past its size */
+static void test_unicache_stats(long unused)
+{
+	struct apfs_unicache_stats stats;
+	struct apfs_unicache *cache;
+	char name[32];
+	u32 hash;
+	int i, len;
+
+	cache = apfs_unicache_create(APFS_UNICACHE_SHARDS);
+	if (!cache) {
+		report(TEST_OTHER, false, "FAIL: can't create a cache");
+		return;
+	}
+
+	apfs_unicache_lookup(cache, "caf\xc3\xa9", 5, false, &hash);
+	len = apfs_unicache_lookup(cache, "caf\xc3\xa9", 5, false, &hash);
+	report(TEST_OTHER, len == 6 &&
+	       hash == apfs_normalize_hash("caf\xc3\xa9", 5, false),
+	       "FAIL: wrong cached normalization for a hit");
+	len = apfs_unicache_lookup(cache, "caf\xc3", 4, false, &hash);
+	report(TEST_OTHER, len < 0, "FAIL: cached invalid UTF-8");
+	apfs_unicache_get_stats(cache, &stats);
+	report(TEST_OTHER, stats.hits == 1 && stats.misses == 1 &&
+	       stats.uncached == 1 && stats.evictions == 0,
+	       "FAIL: wrong cache counters after a hit");
+
+	/* Far more names than entries, so most of them must be evicted */
+	for (i = 0; i < 1000; ++i) {
+		sprintf(name, "name-%d", i);
+		apfs_unicache_lookup(cache, name, strlen(name), false, &hash);
+	}
+	apfs_unicache_get_stats(cache, &stats);
+	report(TEST_OTHER, stats.misses == 1001 &&
+	       stats.evictions >= stats.misses - APFS_UNICACHE_SHARDS &&
+	       stats.evictions < stats.misses,
+	       "FAIL: wrong cache counters after evictions");
+	apfs_unicache_destroy(cache);
+}
+
+/* Bitwise CRC32C, to fix the checksum of corrupted table files */
+static u32 test_crc32c(u32 crc, const u8 *p, size_t len)
+{
+	int k;
+
+	while (len--) {
+		crc ^= *p++;
+		for (k = 0; k < 8; ++k)
+			crc = (crc >> 1) ^ (0x82f63b78 & -(crc & 1));
+	}
+	return crc;
+}
+
+/* Offsets in the header of the binary tables, see blob_write() in mktrie */
+#define BLOB_CHECKSUM_OFFSET	12
+#define BLOB_TRIE_OFFSET	68
+#define BLOB_NFD_OFFSET		(BLOB_TRIE_OFFSET + 8 * 3)
+#define BLOB_HASH_SLOTS_OFFSET	(BLOB_TRIE_OFFSET + 8 * 11)
+
+/* Check that corrupted copies of the table file in @blob are rejected */
+static void test_bad_unitables(const u8 *blob, size_t size)
+{
+	u8 *copy;
+	u32 offset, crc;
+	size_t alloc = (size + 63) & ~(size_t)63;
+
+	copy = aligned_alloc(64, alloc);
+	if (!copy) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+
+	memcpy(copy, blob, size);
+	report(TEST_OTHER, apfs_use_unitables(copy, size) == 0,
+	       "FAIL: rejected valid tables");
+	apfs_unload_unitables();
+	report(TEST_OTHER, apfs_use_unitables(copy, size - 1) < 0,
+	       "FAIL: accepted truncated tables");
+
+	copy[0] ^= 1;
+	report(TEST_OTHER, apfs_use_unitables(copy, size) < 0,
+	       "FAIL: accepted tables with a bad magic");
+	memcpy(copy, blob, size);
+	copy[size / 2] ^= 1;
+	report(TEST_OTHER, apfs_use_unitables(copy, size) < 0,
+	       "FAIL: accepted tables with a bad checksum");
+
+	/* A root entry pointing past the trie, with a valid checksum */
+	memcpy(copy, blob, size);
+	memcpy(&offset, copy + BLOB_TRIE_OFFSET, sizeof(offset));
+	copy[offset] = copy[offset + 1] = 0xff;
+	memset(copy + BLOB_CHECKSUM_OFFSET, 0, sizeof(crc));
+	crc = test_crc32c(~0, copy, size);
+	memcpy(copy + BLOB_CHECKSUM_OFFSET, &crc, sizeof(crc));
+	report(TEST_OTHER, apfs_use_unitables(copy, size) < 0,
+	       "FAIL: accepted tables with a bad trie entry");
+
+	/* A hash slot with a record index past the records */
+	memcpy(copy, blob, size);
+	memcpy(&offset, copy + BLOB_HASH_SLOTS_OFFSET, sizeof(offset));
+	copy[offset + 3] = 0xff;
+	memset(copy + BLOB_CHECKSUM_OFFSET, 0, sizeof(crc));
+	crc = test_crc32c(~0, copy, size);
+	memcpy(copy + BLOB_CHECKSUM_OFFSET, &crc, sizeof(crc));
+	report(TEST_OTHER, apfs_use_unitables(copy, size) < 0,
+	       "FAIL: accepted tables with a bad hash slot");
+
+	/* A value pointing past the end of the wide value array */
+	memcpy(copy, blob, size);
+	memcpy(&offset, copy + BLOB_NFD_OFFSET, sizeof(offset));
+	copy[offset] = 0xff;
+	copy[offset + 1] = 0xdf;
+	memset(copy + BLOB_CHECKSUM_OFFSET, 0, sizeof(crc));
+	crc = test_crc32c(~0, copy, size);
+	memcpy(copy + BLOB_CHECKSUM_OFFSET, &crc, sizeof(crc));
+	report(TEST_OTHER, apfs_use_unitables(copy, size) < 0,
+	       "FAIL: accepted tables with a bad wide value");
+
+	free(copy);
+}
+
+/*
+ * Check the tables in the binary file written by mktrie against the built-in
+ * ones, for every code point. The tables can't be switched while other
+ * threads normalize, so this runs before the workers start.
+ */
+static void test_unitables(const char *path)
+{
+	u32 *hashes;
+	u8 *blob;
+	FILE *file;
+	long size;
+	unicode_t c;
+
+	file = fopen(path, "rb");
+	if (!file) {
+		report(TEST_OTHER, false, "FAIL: can't open %s", path);
+		return;
+	}
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	rewind(file);
+	blob = malloc(size);
+	hashes = malloc(2 * UNICODE_LIMIT * sizeof(*hashes));
+	if (!blob || !hashes) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+	if (fread(blob, 1, size, file) != size) {
+		report(TEST_OTHER, false, "FAIL: can't read %s", path);
+		fclose(file);
+		goto out;
+	}
+	fclose(file);
+
+	report(TEST_OTHER, apfs_load_unitables("no/such/tables") < 0,
+	       "FAIL: loaded tables from a missing file");
+	test_bad_unitables(blob, size);
+
+	for (c = 1; c < UNICODE_LIMIT; ++c) {
+		u8 utf8[4];
+		int len = utf32_to_utf8(c, utf8, sizeof(utf8));
+
+		if (len <= 0)
+			continue;
+		hashes[2 * c] = apfs_normalize_hash((char *)utf8, len, false);
+		hashes[2 * c + 1] = apfs_normalize_hash((char *)utf8, len, true);
+	}
+
+	if (apfs_load_unitables(path)) {
+		report(TEST_OTHER, false, "FAIL: can't load %s", path);
+		goto out;
+	}
+	for (c = 1; c < UNICODE_LIMIT; ++c) {
+		u8 utf8[4];
+		int len = utf32_to_utf8(c, utf8, sizeof(utf8));
+
+		if (len <= 0)
+			continue;
+		report(TEST_OTHER,
+		       hashes[2 * c] == apfs_normalize_hash((char *)utf8, len,
+							    false) &&
+		       hashes[2 * c + 1] == apfs_normalize_hash((char *)utf8,
+								len, true),
+		       "FAIL: loaded tables differ for 0x%x", c);
+	}
+	apfs_unload_unitables();
+
+out:
+	free(hashes);
+	free(blob);
+}
+
+struct test_job {
+	void (*run)(long arg);
+	long arg;
+};
+
+static struct test_job *jobs;
+static int job_count;
+static int next_job;
+
+static void add_job(void (*run)(long arg), long arg)
+{
+	jobs = realloc(jobs, (job_count + 1) * sizeof(*jobs));
+	if (!jobs) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+	jobs[job_count].run = run;
+	jobs[job_count++].arg = arg;
+}
+
+/* Take jobs from the shared list until there are none left */
+static void *test_worker(void *unused)
+{
+	while (1) {
+		int job = __atomic_fetch_add(&next_job, 1, __ATOMIC_RELAXED);
+
+		if (job >= job_count)
+			return NULL;
+		jobs[job].run(jobs[job].arg);
+	}
+}
+
+static int cmp_strings(const void *a, const void *b)
+{
+	return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/*
+ * Parse the tests and run them on all cpus; the optional arguments are files
+ * of binary tables from mktrie, to check against the built-in ones.
+ */
+int main(int argc, char *argv[])
+{
+	struct timespec start, end;
+	pthread_t *threads;
+	long total_failures = 0;
+	int thread_count;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	read_conformance_tests();
+	prepare_unicache();
+	for (i = 1; i < argc; ++i)
+		test_unitables(argv[i]);
+
+	/* The slowest jobs go first, so that no thread is left behind */
+	for (i = 0; i < 32; ++i)
+		add_job(test_ascii_runs, i);
+	add_job(test_long_sequences, 0);
+	add_job(test_stream_safe, 0);
+	add_job(test_case_fold_starters, 0);
+	for (i = 0; i < 8; ++i)
+		add_job(test_unicache, i);
+	add_job(test_unicache_stats, 0);
+	for (i = 0; i * CONFORMANCE_BATCH < conformance_count; ++i)
+		add_job(test_conformance, i);
+	for (i = 0; i * CODE_POINT_BATCH < UNICODE_LIMIT; ++i)
+		add_job(test_code_points, i);
+
+	thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (thread_count < 1)
+		thread_count = 1;
+	threads = calloc(thread_count, sizeof(*threads));
+	if (!threads) {
+		printf("Memory allocation failure!\n");
+		exit(1);
+	}
+	for (i = 0; i < thread_count; ++i) {
+		if (pthread_create(&threads[i], NULL, test_worker, NULL)) {
+			printf("Failure to start test thread!\n");
+			exit(1);
+		}
+	}
+	for (i = 0; i < thread_count; ++i)
+		pthread_join(threads[i], NULL);
+	free(threads);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	/* The order of the failures depends on the threads, so sort them */
+	if (failure_count)
+		qsort(failures, failure_count, sizeof(*failures),
+		      cmp_strings);
+	for (i = 0; i < failure_count; ++i)
+		printf("%s\n", failures[i]);
+
+	apfs_unicache_destroy(shared_cache);
+
+	for (i = 0; i < TEST_KINDS; ++i) {
+		printf("%-22s %8ld passed, %ld failed\n", test_kind_names[i],
+		       test_checks[i] - test_failures[i], test_failures[i]);
+		total_failures += test_failures[i];
+	}
+	printf("%s in %.2fs with %d threads\n",
+	       total_failures ? "FAIL: some tests failed" : "All tests passed",
+	       end.tv_sec - start.tv_sec + (end.tv_nsec - start.tv_nsec) / 1e9,
+	       thread_count);
+	return total_failures != 0;
+}
@@ -11,6 +11,7 @@
 #include <unistd.h>
 #include <stdbool.h>
 #include <assert.h>
+#include <time.h>
 
 #define LINESIZE	1024
 
@@ -19,25 +20,97 @@ char buf0[LINESIZE];
 
 int verbose = 0;
 
+/* Unicode characters fit in 21 bits, so one bit per level at most */
+#define KEY_BITS	21
+#define MAX_HEIGHT	KEY_BITS
+
+/* How the bits of the key are split among the levels of a trie */
+struct trie_layout {
+	int height;			/* Number of levels */
+	int bits[MAX_HEIGHT];		/* Key bits for each level */
+	int shift[MAX_HEIGHT];		/* Shift to get the bits for each level */
+	int base[MAX_HEIGHT];		/* Position of row zero of each level */
+	int start[MAX_HEIGHT];		/* Position of the first row printed */
+};
+
+/* Layout for the tries that are only used internally, by the parser */
+struct trie_layout parse_layout;
+
 struct trie_node {
-	unsigned int depth;		/* 5 for leaf nodes */
+	unsigned int depth;		/* Layout height for leaf nodes */
 	unsigned int pos;		/* Position in the printed array */
 	unsigned int *value;		/* NULL if not a leaf node */
 	struct trie_node *parent;	/* NULL for the root node */
 	unsigned int index;		/* Index among its siblings */
-	struct trie_node *children[16];	/* One child for each possible nibble */
+	unsigned int key;		/* First key in the range of the node */
+	struct trie_layout *layout;	/* Key split for the whole trie */
+	struct trie_node **children;	/* One child for each value of the bits */
 	unsigned int descendants;	/* Number of descendants */
+	struct trie_node *same;		/* Earlier node with the same row */
+	unsigned int shares;		/* Number of later nodes with this row */
+	unsigned long heat;		/* Profile lookups that go through here */
+	unsigned long row_heat;		/* The same, for all nodes with the row */
 };
 
+/* Parse a level split like "8,4,4,5" into @layout */
+static bool layout_init(struct trie_layout *layout, const char *split)
+{
+	char *end;
+	int total = 0;
+	int i;
+
+	memset(layout, 0, sizeof(*layout));
+	for (i = 0; *split; ++i) {
+		if (i == MAX_HEIGHT)
+			return false;
+		layout->bits[i] = strtol(split, &end, 10);
+		if (end == split || layout->bits[i] <= 0)
+			return false;
+		total += layout->bits[i];
+		split = *end == ',' ? end + 1 : end;
+	}
+	if (total != KEY_BITS)
+		return false;
+
+	layout->height = i;
+	for (i = 0; i < layout->height; ++i) {
+		total -= layout->bits[i];
+		layout->shift[i] = total;
+	}
+	return true;
+}
+
+/* Number of children for a node on a given level */
+static int level_width(struct trie_layout *layout, int depth)
+{
+	return 1 << layout->bits[depth];
+}
+
+static struct trie_node *trie_alloc(struct trie_layout *layout)
+{
+	struct trie_node *root;
+
+	root = calloc(1, sizeof(*root));
+	if (!root)
+		exit(1);
+	root->children = calloc(level_width(layout, 0), sizeof(*root));
+	if (!root->children)
+		exit(1);
+	root->depth = 0;
+	root->layout = layout;
+	return root;
+}
+
 static void trie_insert(struct trie_node *node, unsigned int unichar,
 			unsigned int *value)
 {
+	struct trie_layout *layout = node->layout;
 	struct trie_node *child;
 	unsigned int shift;
 	unsigned int branch;
 
-	shift = (4 - node->depth) * 4;
-	branch = (unichar >> shift) & 0xf;
+	shift = layout->shift[node->depth];
+	branch = (unichar >> shift) & (level_width(layout, node->depth) - 1);
 	child = node->children[branch];
 
 	if (!child) {
@@ -48,10 +121,19 @@ static void trie_insert(struct trie_node *node, unsigned int unichar,
 		child->depth = node->depth + 1;
 		child->parent = node;
 		child->index = branch;
+		child->key = node->key | (branch << shift);
+		child->layout = layout;
+		if (child->depth < layout->height) {
+			child->children = calloc(level_width(layout,
+							     child->depth),
+						 sizeof(*child));
+			if (!child->children)
+				exit(1);
+		}
 		for (; node; node = node->parent)
 			node->descendants++;
 	}
-	if (child->depth == 5) { /* Reached the leaf node */
+	if (child->depth == layout->height) { /* Reached the leaf node */
 		child->value = value;
 		return;
 	}
@@ -59,21 +141,33 @@ static void trie_insert(struct trie_node *node, unsigned int unichar,
 	trie_insert(child, unichar, value);
 }
 
-/* Return a description of the range covered by this node, e.g. 00001f__ */
-void get_range(struct trie_node *node, char *desc)
+/* Get the value for @unichar in a trie, or NULL if it has none */
+static unsigned int *trie_find(struct trie_node *root, unsigned int unichar)
 {
-	char tmp[2];
+	struct trie_layout *layout = root->layout;
+	struct trie_node *node = root;
 	int i;
 
-	for (i = 4; i >= 0; --i) {
-		if (i < node->depth) {
-			sprintf(tmp, "%.1x", node->index);
-			node = node->parent;
-		} else {
-			sprintf(tmp, "_");
-		}
-		*(desc + i) = tmp[0];
+	for (i = 0; i < layout->height; ++i) {
+		int index = (unichar >> layout->shift[i]) &
+			    (level_width(layout, i) - 1);
+		node = node->children[index];
+		if (!node)
+			return NULL;
 	}
+	return node->value;
+}
+
+/* Return a description of the range covered by this node */
+void get_range(struct trie_node *node, char *desc)
+{
+	unsigned int last = node->key;
+
+	if (node->depth)
+		last += (1 << node->layout->shift[node->depth - 1]) - 1;
+	else
+		last += (1 << KEY_BITS) - 1;
+	sprintf(desc, "0x%.6x-0x%.6x", node->key, last);
 }
 
 /* Find the first child with index above @index */
@@ -82,7 +176,7 @@ static struct trie_node *first_child(struct trie_node *node, int index)
 	int i;
 	struct trie_node *child;
 
-	for (i = index; i < 16; ++i) {
+	for (i = index; i < level_width(node->layout, node->depth); ++i) {
 		child = node->children[i];
 		if (child) {
 			return child;
@@ -139,41 +233,381 @@ static int unilength(unsigned int *um)
 	return length;
 }
 
-static void trie_calculate_positions(struct trie_node *root, bool is_ccc)
+/*
+ * Number of times each character was seen in the profile corpus, or NULL if
+ * there is no profile; only the characters that walk the trie at runtime
+ * are counted.
+ */
+#define UNICODE_LIMIT	0x110000
+unsigned long *profile;
+
+/* Characters that the runtime code looks up without walking the trie */
+#define UTF8_2BYTE_FIRST	0x80
+#define UTF8_2BYTE_LAST		0x7ff
+#define HANGUL_S_FIRST		0xac00
+#define HANGUL_S_LAST		0xd7a3
+
+/*
+ * Read a corpus of UTF-8 text, like a list of filenames, and count how many
+ * times each character would walk the trie. Malformed bytes are skipped.
+ */
+static void profile_init(const char *path)
+{
+	FILE *file;
+	unsigned long total = 0;
+	int c;
+
+	profile = calloc(UNICODE_LIMIT, sizeof(*profile));
+	if (!profile)
+		exit(1);
+	file = fopen(path, "r");
+	if (!file) {
+		perror(path);
+		exit(1);
+	}
+
+	c = getc(file);
+	while (c != EOF) {
+		unsigned int unichar;
+		int extra, i;
+
+		if (c < 0x80 || c >= 0xf8 || (c & 0xc0) == 0x80) {
+			c = getc(file); /* ASCII, or not the start of a char */
+			continue;
+		}
+		extra = c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : 1;
+		unichar = c & (0x3f >> extra);
+		for (i = 0; i < extra; ++i) {
+			c = getc(file);
+			if (c == EOF || (c & 0xc0) != 0x80)
+				break;
+			unichar = (unichar << 6) | (c & 0x3f);
+		}
+		if (i < extra) /* Truncated, and c is the next byte already */
+			continue;
+		c = getc(file);
+
+		if (unichar <= UTF8_2BYTE_LAST || unichar >= UNICODE_LIMIT ||
+		    (unichar >= HANGUL_S_FIRST && unichar <= HANGUL_S_LAST))
+			continue;
+		profile[unichar]++;
+		total++;
+	}
+	fclose(file);
+	if (verbose > 0)
+		printf("Profile has %lu trie lookups\n", total);
+}
+
+/* Add the profile lookups to the heat of every node on their path */
+static void trie_heat(struct trie_node *root)
+{
+	struct trie_layout *layout = root->layout;
+	struct trie_node *n;
+	unsigned int unichar;
+	int i;
+
+	for (i = 0; i <= layout->height; ++i) {
+		for (n = level_first(root, i); n; n = level_next(n))
+			n->heat = 0;
+	}
+	if (!profile)
+		return;
+
+	for (unichar = 0; unichar < UNICODE_LIMIT; ++unichar) {
+		if (!profile[unichar])
+			continue;
+		n = root;
+		for (i = 0; n; ++i) {
+			n->heat += profile[unichar];
+			if (i == layout->height)
+				break;
+			n = n->children[(unichar >> layout->shift[i]) &
+					(level_width(layout, i) - 1)];
+		}
+	}
+}
+
+/* Order nodes by decreasing heat; the sort must keep ties in level order */
+static int cmp_row_heat(const void *a, const void *b)
+{
+	struct trie_node *x = *(struct trie_node **)a;
+	struct trie_node *y = *(struct trie_node **)b;
+
+	if (x->row_heat != y->row_heat)
+		return x->row_heat < y->row_heat ? 1 : -1;
+	return (x->pos > y->pos) - (x->pos < y->pos);
+}
+
+/* Fields of a record in the combined trie */
+#define REC_NFD		0
+#define REC_NFDCF	1
+#define REC_CCC		2
+#define REC_FIELDS	3
+
+/* Size of a struct apfs_unidata in the runtime code, padding included */
+#define RECORD_BYTES	6
+
+/* Distinct records of the combined trie, in the order they get printed */
+unsigned int **records;
+int record_count;
+
+/* Find the index of @rec in the record array, adding it if needed */
+static int record_index(unsigned int *rec)
+{
+	int i;
+
+	for (i = 0; i < record_count; ++i) {
+		if (!memcmp(records[i], rec, REC_FIELDS * sizeof(*rec)))
+			return i;
+	}
+
+	records = realloc(records, (record_count + 1) * sizeof(*records));
+	if (!records)
+		exit(1);
+	records[record_count] = rec;
+	return record_count++;
+}
+
+/* Position of a child of @node in the trie array, or zero if it has none */
+static unsigned int child_pos(struct trie_node *node, int index)
+{
+	struct trie_node *child = node->children[index];
+
+	return child ? child->pos : 0;
+}
+
+/* Hash the row of a node, once the positions of its children are known */
+static unsigned int row_hash(struct trie_node *node)
+{
+	unsigned int hash = 2166136261u; /* FNV-1a */
+	int j;
+
+	for (j = 0; j < level_width(node->layout, node->depth); ++j)
+		hash = (hash ^ child_pos(node, j)) * 16777619u;
+	return hash;
+}
+
+static bool row_equal(struct trie_node *a, struct trie_node *b)
+{
+	int j;
+
+	for (j = 0; j < level_width(a->layout, a->depth); ++j) {
+		if (child_pos(a, j) != child_pos(b, j))
+			return false;
+	}
+	return true;
+}
+
+/*
+ * Put the records with the most profile lookups first, after the empty one,
+ * and update the leaves to match.
+ */
+static void records_sort(struct trie_node *root)
+{
+	struct trie_layout *layout = root->layout;
+	unsigned long *heat;
+	int *order, *index;
+	unsigned int **sorted;
+	struct trie_node *n;
+	int i, j;
+
+	heat = calloc(record_count, sizeof(*heat));
+	order = malloc(record_count * sizeof(*order));
+	index = malloc(record_count * sizeof(*index));
+	sorted = malloc(record_count * sizeof(*sorted));
+	if (!heat || !order || !index || !sorted)
+		exit(1);
+	for (n = level_first(root, layout->height); n; n = level_next(n))
+		heat[n->pos] += n->heat;
+
+	/* An insertion sort is stable, and there are only a few thousand */
+	for (i = 0; i < record_count; ++i) {
+		for (j = i; j > 1 && heat[order[j - 1]] < heat[i]; --j)
+			order[j] = order[j - 1];
+		order[j] = i;
+	}
+	for (i = 0; i < record_count; ++i) {
+		sorted[i] = records[order[i]];
+		index[order[i]] = i;
+	}
+	memcpy(records, sorted, record_count * sizeof(*records));
+	for (n = level_first(root, layout->height); n; n = level_next(n))
+		n->pos = index[n->pos];
+
+	free(heat);
+	free(order);
+	free(index);
+	free(sorted);
+}
+
+/* Entries of the trie array in a cache line, which must be a power of two */
+#define LINE_ENTRIES	(64 / sizeof(unsigned short))
+
+/* Bytes of trie array saved by sharing rows, in the last calculation */
+unsigned int trie_saved_bytes;
+
+/*
+ * Calculate the positions for the combined trie, and return the total number
+ * of entries in its array.
+ */
+static unsigned int trie_calculate_positions(struct trie_node *root)
 {
+	struct trie_layout *layout = root->layout;
+	unsigned int rows[MAX_HEIGHT];
 	struct trie_node *n;
 	unsigned int current;
 	int i;
 
-	/* The trie array gives the position of the children for each node */
-	current = 0;
-	for (i = 0; i < 5; ++i) {
+	trie_heat(root);
+
+	/* Record zero is empty, for characters that don't need any changes */
+	record_count = 0;
+	record_index(calloc(REC_FIELDS, sizeof(unsigned int)));
+
+	/* The leaf nodes give the position of their record */
+	for (n = level_first(root, layout->height); n; n = level_next(n))
+		n->pos = record_index(n->value);
+	assert(record_count <= 0x10000);
+	if (profile)
+		records_sort(root);
+
+	/*
+	 * The trie array gives the position of the children for each node,
+	 * as a row number within their level. Zero means there is no child,
+	 * so the rows are counted from one, except for the root. Nodes whose
+	 * rows are identical share a single one, so the trie is really a DAG;
+	 * this must go from the bottom up, since a row holds the positions of
+	 * the rows below.
+	 */
+	trie_saved_bytes = 0;
+	for (i = layout->height - 1; i >= 0; --i) {
+		struct trie_node **table;
+		unsigned int count = 0, size = 1;
+		unsigned int row = i ? 1 : 0;
+
+		for (n = level_first(root, i); n; n = level_next(n))
+			count++;
+		while (size < 2 * count)
+			size <<= 1;
+		table = calloc(size, sizeof(*table));
+		if (!table)
+			exit(1);
+
+		/* Rows are numbered in level order for now */
+		for (n = level_first(root, i); n; n = level_next(n)) {
+			unsigned int slot = row_hash(n) & (size - 1);
+
+			while (table[slot] && !row_equal(table[slot], n))
+				slot = (slot + 1) & (size - 1);
+			if (table[slot]) {
+				n->same = table[slot];
+				n->same->shares++;
+				n->same->row_heat += n->heat;
+				trie_saved_bytes += level_width(layout, i) *
+						    sizeof(unsigned short);
+				continue;
+			}
+			table[slot] = n;
+			n->same = NULL;
+			n->shares = 0;
+			n->row_heat = n->heat;
+			n->pos = row++;
+		}
+		assert(row <= 0x10000);
+		rows[i] = row - (i ? 1 : 0);
+		free(table);
+
+		/*
+		 * With a profile, the hottest rows come first on each level,
+		 * so that the lookups for common scripts share cache lines.
+		 */
+		if (profile && rows[i] > 1) {
+			struct trie_node **order;
+			unsigned int j = 0;
+
+			order = malloc(rows[i] * sizeof(*order));
+			if (!order)
+				exit(1);
+			for (n = level_first(root, i); n; n = level_next(n)) {
+				if (!n->same)
+					order[j++] = n;
+			}
+			qsort(order, rows[i], sizeof(*order), cmp_row_heat);
+			for (j = 0; j < rows[i]; ++j)
+				order[j]->pos = j + (i ? 1 : 0);
+			free(order);
+		}
 		for (n = level_first(root, i); n; n = level_next(n)) {
-			n->pos = current >> 4; /* Last bits are zero, ignore */
-			current = current + 16;
+			if (n->same)
+				n->pos = n->same->pos;
 		}
 	}
 
-	/* The value of the leaf nodes will be  stored in a separate array */
+	/* Each level starts on a new cache line of the runtime array */
 	current = 0;
-	for (n = level_first(root, 5); n; n = level_next(n)) {
-		int len;
+	for (i = 0; i < layout->height; ++i) {
+		current = (current + LINE_ENTRIES - 1) & ~(LINE_ENTRIES - 1);
+		layout->start[i] = current;
+		layout->base[i] = current - (i ? 1 : 0) * level_width(layout, i);
+		current += rows[i] * level_width(layout, i);
+	}
+	return current;
+}
 
-		if (!n->value)
-			continue;
+/*
+ * The records encode each value in 16 bits, as its position in the data array
+ * followed by its length in the last VALUE_LEN_BITS. A value that is too long
+ * or too far into the array for that gets escaped instead: its length is set
+ * to zero, and its position is an index into the escape array of the table,
+ * which holds the real position and length in 32 bits. Entry zero of the
+ * escape array is unused, since an encoded value of zero means no mapping.
+ */
+#define VALUE_LEN_BITS		3
+#define VALUE_LEN_LIMIT		((1 << VALUE_LEN_BITS) - 1)
+#define VALUE_POS_LIMIT		(1 << (16 - VALUE_LEN_BITS))
+#define ESC_LEN_BITS		8
 
-		if (is_ccc) {
-			/* no data array, the 'pos' is just the value */
-			n->pos = n->value[0];
-			continue;
-		}
+struct value_escapes {
+	unsigned int entries[VALUE_POS_LIMIT];
+	int count;
+};
+
+struct value_escapes nfd_escapes, nfdcf_escapes;
+
+/* Values from this position on are escaped; it's lowered by -e for tests */
+unsigned int escape_pos = VALUE_POS_LIMIT;
+
+/* Calculate the encoded position of each value in a data array */
+static void values_calculate_positions(struct trie_node *root,
+				       struct value_escapes *esc)
+{
+	struct trie_node *n;
+	unsigned int current;
+
+	/* The value of the leaf nodes will be  stored in a separate array */
+	current = 0;
+	esc->entries[0] = 0;
+	esc->count = 1;
+	for (n = level_first(root, root->layout->height); n;
+	     n = level_next(n)) {
+		int len;
 
 		len = unilength(n->value);
 
 		/* Save both position and length of the value */
-		assert(len < 8);
-		assert(!(current & 0xe000));
-		n->pos = (current << 3) + len;
+		if (len <= VALUE_LEN_LIMIT && current < escape_pos) {
+			n->pos = (current << VALUE_LEN_BITS) + len;
+		} else {
+			if (esc->count == VALUE_POS_LIMIT ||
+			    len >= 1 << ESC_LEN_BITS ||
+			    current >= 1 << (32 - ESC_LEN_BITS)) {
+				fprintf(stderr, "Too many values to encode\n");
+				exit(1);
+			}
+			esc->entries[esc->count] =
+				(current << ESC_LEN_BITS) + len;
+			n->pos = esc->count++ << VALUE_LEN_BITS;
+		}
 
 		current += len;
 	}
@@ -317,171 +751,1630 @@ static void ccc_init(struct trie_node *ccc_root)
 		exit(1);
 }
 
-static void trie_print(struct trie_node *root, char *trie_name, FILE *file,
-		       bool is_ccc)
+/* Position in the trie array of the row of @n, which must not be shared */
+static unsigned int row_start(struct trie_node *n)
 {
-	struct trie_node *n = root;
-	char range[5];
-	int i;
-	int count;
-
-	if (verbose > 0)
-		printf("Printing to unicode.c\n");
+	struct trie_layout *layout = n->layout;
+	int depth = n->depth;
 
-	trie_calculate_positions(root, is_ccc);
+	return layout->start[depth] +
+	       (n->pos - (depth ? 1 : 0)) * level_width(layout, depth);
+}
 
-	if (is_ccc)
-		fprintf(file, "static u8 apfs_%s_trie[] = {\n", trie_name);
-	else
-		fprintf(file, "static u16 apfs_%s_trie[] = {\n", trie_name);
+/*
+ * Fill @array with the entries of a trie, after calculating the positions;
+ * the array must be zeroed first, for the padding between levels.
+ */
+static void trie_flatten(struct trie_node *root, unsigned short *array)
+{
+	struct trie_layout *layout = root->layout;
+	struct trie_node *n;
+	int i;
 
-	for (i = 0; i < 5; ++i) {
+	for (i = 0; i < layout->height; ++i) {
 		for (n = level_first(root, i); n; n = level_next(n)) {
 			int j;
 
-			get_range(n, range);
-			fprintf(file, "\t/* Node for range 0x%.5s */\n",
-				range);
+			if (n->same) /* The row was already written */
+				continue;
+			for (j = 0; j < level_width(layout, i); j++)
+				array[row_start(n) + j] = child_pos(n, j);
+		}
+	}
+}
 
-			for (j = 0; j < 16; j++) {
-				unsigned int pos = 0;
+/* Order nodes by their position in the trie array */
+static int cmp_pos(const void *a, const void *b)
+{
+	struct trie_node *x = *(struct trie_node **)a;
+	struct trie_node *y = *(struct trie_node **)b;
 
-				if (j % 8 == 0)
-					fprintf(file, "\t");
-				if (n->children[j])
-					pos = n->children[j]->pos;
+	return (x->pos > y->pos) - (x->pos < y->pos);
+}
 
-				if (is_ccc)
-					fprintf(file, "0x%.2x,", pos);
-				else
-					fprintf(file, "0x%.4x,", pos);
+/*
+ * The records can also be found with a minimal perfect hash instead of the
+ * trie. The characters that have a record, other than those in the flat
+ * two-byte table, are spread among buckets of a few keys each; then, from the
+ * largest bucket down, each bucket gets the first displacement that sends all
+ * of its keys to free slots (this is the CHD algorithm). A lookup loads the
+ * displacement for the bucket of the key and then the slot, which holds the
+ * key to check against and the index of the record.
+ */
+#define HASH_BUCKET_KEYS	4		/* Average keys in a bucket */
+#define HASH_DISP_LIMIT		0x10000		/* Displacements are 16 bits */
+#define HASH_KEY_BITS		18		/* The index goes above the key */
 
-				if (j % 8 != 7)
-					fprintf(file, " ");
-				else
-					fprintf(file, "\n");
-			}
-		}
-	}
-	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
-	fprintf(file, "\n};\n");
+/* Look up the records with the perfect hash, in the generated code? */
+bool use_hash;
 
-	if (is_ccc) /* No data array for ccc */
-		return;
+/* The tables of the perfect hash, once built by hash_build() */
+unsigned short *hash_disp;
+unsigned int *hash_slots;
+unsigned int hash_buckets, hash_size, hash_keys, hash_max_disp;
 
-	fprintf(file, "\nstatic unicode_t apfs_%s[] = {\n", trie_name);
-	count = 0;
-	for (n = level_first(root, 5); n; n = level_next(n)) {
-		unsigned int *curr;
+/* Integer hash with full avalanche, the same as apfs_hash_mix() */
+static unsigned int hash_mix(unsigned int x)
+{
+	x ^= x >> 16;
+	x *= 0x7feb352d;
+	x ^= x >> 15;
+	x *= 0x846ca68b;
+	x ^= x >> 16;
+	return x;
+}
 
-		for (curr = n->value; *curr; curr++) {
-			if (count % 6 == 0)
-				fprintf(file, "\t");
-			fprintf(file, "0x%.6x,", *curr);
-			count++;
-			if (count % 6 != 0)
-				fprintf(file, " ");
-			else
-				fprintf(file, "\n");
-		}
-	}
-	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
-	fprintf(file, "\n};\n");
+/* Map a hash to the range [0, @n), without a division */
+static unsigned int hash_range(unsigned int hash, unsigned int n)
+{
+	return ((unsigned long long)hash * n) >> 32;
 }
 
-/* Get the partial nfd decomposition for @unichar in the current iteration */
-static unsigned int *get_current_nfd(struct trie_node *nfdi_root,
-				     unsigned int unichar)
+static unsigned int hash_slot(unsigned int key, unsigned int disp)
 {
-	struct trie_node *node = nfdi_root;
-	int i;
+	return hash_range(hash_mix(hash_mix(key) + disp), hash_size);
+}
 
-	for (i = 4; i >= 0; --i) {
-		int index = (unichar >> (4 * i)) & 0xf;
-		node = node->children[index];
-		if (!node)
-			return NULL;
-	}
-	return node->value;
+/* Used to sort the buckets from the largest down */
+static unsigned int *bucket_sizes;
+
+static int cmp_bucket_size(const void *a, const void *b)
+{
+	unsigned int x = bucket_sizes[*(unsigned int *)a];
+	unsigned int y = bucket_sizes[*(unsigned int *)b];
+
+	if (x != y)
+		return (x < y) - (x > y);
+	return (*(unsigned int *)a > *(unsigned int *)b) -
+	       (*(unsigned int *)a < *(unsigned int *)b);
 }
 
-/* Iterate the unicode decompositions as much as needed */
-static void nfdi_iterate(struct trie_node *nfdi_root)
+/*
+ * Try to give every bucket a displacement, with @hash_size slots; returns
+ * false if some bucket can't be placed.
+ */
+static bool hash_place(unsigned int *keys, unsigned int *indexes,
+		       unsigned int *first, unsigned int *order)
 {
-	struct trie_node *n;
-	unsigned int *unichar;
-	unsigned int mapping[19]; /* Magic - guaranteed not to be exceeded. */
-	bool unchanged = true;
+	bool *taken;
+	unsigned int b, i, disp;
 
-	for (n = level_first(nfdi_root, 5); n; n = level_next(n)) {
-		unsigned int *map_cursor = mapping;
-		unsigned int map_size;
+	taken = calloc(hash_size, sizeof(*taken));
+	hash_slots = calloc(hash_size, sizeof(*hash_slots));
+	if (!taken || !hash_slots)
+		exit(1);
+	hash_max_disp = 0;
 
-		for (unichar = n->value; *unichar; ++unichar) {
-			unsigned int *decomp;
-			int len;
+	for (b = 0; b < hash_buckets; ++b) {
+		unsigned int bucket = order[b];
+		unsigned int start = first[bucket];
+		unsigned int count = bucket_sizes[bucket];
 
-			decomp = get_current_nfd(nfdi_root, *unichar);
-			if (decomp) {
-				unchanged = false;
-				len = unilength(decomp);
-			} else {
-				decomp = unichar;
-				len = 1;
+		for (disp = 0; disp < HASH_DISP_LIMIT; ++disp) {
+			for (i = 0; i < count; ++i) {
+				unsigned int slot = hash_slot(keys[start + i],
+							      disp);
+
+				if (taken[slot])
+					break;
+				taken[slot] = true;
 			}
-			memcpy(map_cursor, decomp, len * sizeof(unsigned int));
-			map_cursor += len;
+			if (i == count)
+				break;
+			while (i--)
+				taken[hash_slot(keys[start + i], disp)] = false;
+		}
+		if (disp == HASH_DISP_LIMIT) {
+			free(taken);
+			free(hash_slots);
+			return false;
 		}
-		*map_cursor = 0;
-		++map_cursor;
-		map_size = (map_cursor - mapping) * sizeof(unsigned int);
 
-		free(n->value);
-		n->value = malloc(map_size);
-		if (!n->value)
-			exit(1);
-		memcpy(n->value, mapping, map_size);
-	}
+		hash_disp[bucket] = disp;
+		if (disp > hash_max_disp)
+			hash_max_disp = disp;
+		for (i = 0; i < count; ++i) {
+			unsigned int slot = hash_slot(keys[start + i], disp);
 
-	if (!unchanged)
-		nfdi_iterate(nfdi_root);
+			hash_slots[slot] = indexes[start + i] << HASH_KEY_BITS |
+					   keys[start + i];
+		}
+	}
+	free(taken);
+	return true;
 }
 
-int main()
+/* Build the perfect hash, once the trie positions are calculated */
+static void hash_build(struct trie_node *root)
 {
-	struct trie_node *nfd_root, *cf_root, *ccc_root;
-	FILE *out;
+	struct trie_layout *layout = root->layout;
+	unsigned int *keys, *indexes, *first, *order, *fill;
+	unsigned int *sorted_keys, *sorted_indexes;
+	struct trie_node *n;
+	unsigned int i;
 
-	out = fopen("unicode.c.tmp", "w");
-	if (!out)
-		exit(1);
+	free(hash_disp);
+	free(hash_slots);
 
-	nfd_root = calloc(1, sizeof(*nfd_root));
-	if (!nfd_root)
+	hash_keys = 0;
+	for (n = level_first(root, layout->height); n; n = level_next(n))
+		hash_keys++;
+	keys = malloc(hash_keys * sizeof(*keys));
+	indexes = malloc(hash_keys * sizeof(*indexes));
+	if (!keys || !indexes)
 		exit(1);
-	nfd_root->depth = 0;
-	nfdi_init(nfd_root);
-	nfdi_iterate(nfd_root);
-	trie_print(nfd_root, "nfd", out, false /* is_ccc */);
-
-	fprintf(out, "\n");
+	hash_keys = 0;
+	for (n = level_first(root, layout->height); n; n = level_next(n)) {
+		if (!n->pos ||
+		    (n->key >= UTF8_2BYTE_FIRST && n->key <= UTF8_2BYTE_LAST))
+			continue;
+		if (n->key >= 1 << HASH_KEY_BITS ||
+		    n->pos >= 1 << (32 - HASH_KEY_BITS)) {
+			fprintf(stderr, "Character 0x%x doesn't fit the hash slots\n",
+				n->key);
+			exit(1);
+		}
+		keys[hash_keys] = n->key;
+		indexes[hash_keys++] = n->pos;
+	}
 
-	cf_root = calloc(1, sizeof(*cf_root));
-	if (!cf_root)
+	/* Group the keys by bucket */
+	hash_buckets = (hash_keys + HASH_BUCKET_KEYS - 1) / HASH_BUCKET_KEYS;
+	bucket_sizes = calloc(hash_buckets, sizeof(*bucket_sizes));
+	first = malloc(hash_buckets * sizeof(*first));
+	fill = calloc(hash_buckets, sizeof(*fill));
+	order = malloc(hash_buckets * sizeof(*order));
+	sorted_keys = malloc(hash_keys * sizeof(*sorted_keys));
+	sorted_indexes = malloc(hash_keys * sizeof(*sorted_indexes));
+	hash_disp = calloc(hash_buckets, sizeof(*hash_disp));
+	if (!bucket_sizes || !first || !fill || !order || !sorted_keys ||
+	    !sorted_indexes || !hash_disp)
 		exit(1);
-	cf_root->depth = 0;
-	cf_init(cf_root);
-	trie_print(cf_root, "cf", out, false /* is_ccc */);
-
-	fprintf(out, "\n");
+	for (i = 0; i < hash_keys; ++i)
+		bucket_sizes[hash_range(hash_mix(keys[i]), hash_buckets)]++;
+	for (i = 0; i < hash_buckets; ++i) {
+		first[i] = i ? first[i - 1] + bucket_sizes[i - 1] : 0;
+		order[i] = i;
+	}
+	for (i = 0; i < hash_keys; ++i) {
+		unsigned int bucket = hash_range(hash_mix(keys[i]),
+						 hash_buckets);
+		unsigned int pos = first[bucket] + fill[bucket]++;
 
-	ccc_root = calloc(1, sizeof(*ccc_root));
-	if (!ccc_root)
+		sorted_keys[pos] = keys[i];
+		sorted_indexes[pos] = indexes[i];
+	}
+	qsort(order, hash_buckets, sizeof(*order), cmp_bucket_size);
+
+	/* A minimal hash is almost always found; if not, add a few slots */
+	hash_size = hash_keys;
+	while (!hash_place(sorted_keys, sorted_indexes, first, order))
+		hash_size += hash_keys / 64 + 1;
+
+	free(sorted_indexes);
+	free(sorted_keys);
+	free(order);
+	free(fill);
+	free(first);
+	free(bucket_sizes);
+	free(indexes);
+	free(keys);
+}
+
+/* Total size of the perfect hash tables, in bytes */
+static unsigned int hash_bytes(void)
+{
+	return hash_buckets * sizeof(*hash_disp) +
+	       hash_size * sizeof(*hash_slots);
+}
+
+/* Print the tables of the perfect hash, once it's built */
+static void hash_print(FILE *file, FILE *header)
+{
+	unsigned int i;
+
+	fprintf(header, "/* The records are found with a perfect hash, not the trie */\n");
+	fprintf(header, "#define APFS_UNIDATA_HASH\n");
+	fprintf(header, "#define HASH_BUCKETS\t\t%u\n", hash_buckets);
+	fprintf(header, "#define HASH_SLOTS\t\t%u\n\n", hash_size);
+	printf("Perfect hash has %u bytes, for %u keys\n", hash_bytes(),
+	       hash_keys);
+
+	fprintf(file, "\nstatic const u16 apfs_hash_disp[] __aligned(64) = {\n");
+	for (i = 0; i < hash_buckets; ++i) {
+		if (i % 8 == 0)
+			fprintf(file, "\t");
+		fprintf(file, "0x%.4x,", hash_disp[i]);
+		if (i % 8 != 7)
+			fprintf(file, " ");
+		else
+			fprintf(file, "\n");
+	}
+	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
+	fprintf(file, "\n};\n");
+
+	fprintf(file, "\nstatic const u32 apfs_hash_slots[] __aligned(64) = {\n");
+	for (i = 0; i < hash_size; ++i) {
+		if (i % 6 == 0)
+			fprintf(file, "\t");
+		fprintf(file, "0x%.8x,", hash_slots[i]);
+		if ((i + 1) % 6 != 0)
+			fprintf(file, " ");
+		else
+			fprintf(file, "\n");
+	}
+	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
+	fprintf(file, "\n};\n");
+}
+
+/* Print the macros that describe the shape of the trie to the runtime code */
+static void trie_print_header(struct trie_layout *layout, FILE *file)
+{
+	int i;
+
+	fprintf(file, "/* Key bits for each level of apfs_trie, from the root down */\n");
+	fprintf(file, "#define TRIE_HEIGHT\t\t%d\n", layout->height);
+	fprintf(file, "#define TRIE_LEVEL_BITS\t\t{");
+	for (i = 0; i < layout->height; ++i)
+		fprintf(file, " %d,", layout->bits[i]);
+	fprintf(file, " }\n");
+	fprintf(file, "#define TRIE_LEVEL_SHIFT\t{");
+	for (i = 0; i < layout->height; ++i)
+		fprintf(file, " %d,", layout->shift[i]);
+	fprintf(file, " }\n");
+
+	fprintf(file, "\n/* Position of row zero for each level of the trie */\n");
+	fprintf(file, "#define TRIE_LEVEL_BASE\t\t{");
+	for (i = 0; i < layout->height; ++i)
+		fprintf(file, " %d,", layout->base[i]);
+	fprintf(file, " }\n\n");
+}
+
+/* Print the trie array, once the positions are calculated */
+static void trie_array_print(struct trie_node *root, FILE *file)
+{
+	struct trie_layout *layout = root->layout;
+	struct trie_node *n = root;
+	unsigned int printed = 0;
+	char range[20];
+	int i;
+
+	fprintf(file, "static const u16 apfs_trie[] __aligned(64) = {\n");
+
+	for (i = 0; i < layout->height; ++i) {
+		struct trie_node **order;
+		unsigned int count = 0, k;
+
+		if (printed < layout->start[i])
+			fprintf(file, "\t/* Padding up to a cache line */\n");
+		for (k = 0; printed < layout->start[i]; ++printed, ++k) {
+			if (k % 8 == 0)
+				fprintf(file, "\t");
+			fprintf(file, "0x0000,");
+			if (k % 8 != 7 && printed + 1 < layout->start[i])
+				fprintf(file, " ");
+			else
+				fprintf(file, "\n");
+		}
+
+		/* The rows don't follow the level order with a profile */
+		for (n = level_first(root, i); n; n = level_next(n))
+			count += !n->same;
+		order = malloc(count * sizeof(*order));
+		if (!order)
+			exit(1);
+		count = 0;
+		for (n = level_first(root, i); n; n = level_next(n)) {
+			if (!n->same)
+				order[count++] = n;
+		}
+		qsort(order, count, sizeof(*order), cmp_pos);
+
+		for (k = 0; k < count; ++k) {
+			int j;
+
+			n = order[k];
+			printed += level_width(layout, i);
+			get_range(n, range);
+			if (n->shares)
+				fprintf(file, "\t/* Node for range %s and %u more */\n",
+					range, n->shares);
+			else
+				fprintf(file, "\t/* Node for range %s */\n",
+					range);
+
+			for (j = 0; j < level_width(layout, i); j++) {
+				if (j % 8 == 0)
+					fprintf(file, "\t");
+
+				fprintf(file, "0x%.4x,", child_pos(n, j));
+
+				if (j % 8 != 7)
+					fprintf(file, " ");
+				else
+					fprintf(file, "\n");
+			}
+		}
+		free(order);
+	}
+	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
+	fprintf(file, "\n};\n");
+}
+
+/* Print the lookup tables for the records, and the records themselves */
+static void trie_print(struct trie_node *root, FILE *file, FILE *header)
+{
+	unsigned int entries;
+	int i;
+
+	if (verbose > 0)
+		printf("Printing to unicode.c\n");
+
+	entries = trie_calculate_positions(root);
+	trie_print_header(root->layout, header);
+	if (use_hash) {
+		hash_build(root);
+		hash_print(file, header);
+	} else {
+		printf("Trie array has %u bytes, %u saved by sharing identical rows\n",
+		       entries * 2, trie_saved_bytes);
+		trie_array_print(root, file);
+	}
+
+	fprintf(file, "\nstatic const struct apfs_unidata apfs_unidata[] __aligned(64) = {\n");
+	for (i = 0; i < record_count; ++i) {
+		unsigned int *rec = records[i];
+
+		if (i % 3 == 0)
+			fprintf(file, "\t");
+		fprintf(file, "{0x%.4x, 0x%.4x, %3d},", rec[REC_NFD],
+			rec[REC_NFDCF], rec[REC_CCC]);
+		if (i % 3 != 2)
+			fprintf(file, " ");
+		else
+			fprintf(file, "\n");
+	}
+	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
+	fprintf(file, "\n};\n");
+}
+
+/* Print the flat record table, once the trie positions are calculated */
+static void records_2byte_print(struct trie_node *root, FILE *file)
+{
+	unsigned int unichar;
+	unsigned int empty[REC_FIELDS] = {0};
+	int i;
+
+	fprintf(file, "\nstatic const struct apfs_unidata apfs_unidata_2byte[] __aligned(64) = {\n");
+	for (unichar = UTF8_2BYTE_FIRST; unichar <= UTF8_2BYTE_LAST;
+	     ++unichar) {
+		unsigned int *rec = trie_find(root, unichar);
+
+		if (!rec)
+			rec = empty;
+		i = unichar - UTF8_2BYTE_FIRST;
+		if (i % 48 == 0)
+			fprintf(file, "\t/* Characters from 0x%.4x */\n",
+				unichar);
+		if (i % 3 == 0)
+			fprintf(file, "\t");
+		fprintf(file, "{0x%.4x, 0x%.4x, %3d},", rec[REC_NFD],
+			rec[REC_NFDCF], rec[REC_CCC]);
+		if (i % 3 != 2)
+			fprintf(file, " ");
+		else
+			fprintf(file, "\n");
+	}
+	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
+	fprintf(file, "\n};\n");
+}
+
+/*
+ * The value arrays have a 16-bit entry for each character of a mapping. Most
+ * of those are starters from the BMP, and are stored as they are. The others,
+ * which have a combining class or are outside the BMP, are stored as one of
+ * the surrogate code points, which are never part of a mapping; it gives the
+ * position of the character in the wide value array, which holds its 32-bit
+ * value with the combining class in the top byte. A character only needs one
+ * wide entry, however many mappings it's part of.
+ */
+#define VALUE_WIDE_FIRST	0xd800
+#define VALUE_WIDE_LIMIT	0x800
+
+/* Longest mapping that the runtime code has room for */
+#define VALUE_MAX_LEN		8
+
+unsigned int value_wide[VALUE_WIDE_LIMIT];
+int value_wide_count;
+
+/* Get the 16-bit entry for a character with a combining class of @ccc */
+static unsigned int value_entry(unsigned int unichar, unsigned int ccc)
+{
+	unsigned int wide = ccc << 24 | unichar;
+	int i;
+
+	if (!ccc && unichar < 0x10000)
+		return unichar;
+	for (i = 0; i < value_wide_count; ++i) {
+		if (value_wide[i] == wide)
+			return VALUE_WIDE_FIRST + i;
+	}
+	if (value_wide_count == VALUE_WIDE_LIMIT) {
+		fprintf(stderr, "Too many wide characters in the mappings\n");
+		exit(1);
+	}
+	value_wide[value_wide_count] = wide;
+	return VALUE_WIDE_FIRST + value_wide_count++;
+}
+
+/*
+ * Fill @array with the 16-bit entries for a trie of mappings, taking the
+ * canonical combining class of each character from @ccc_root, and add the
+ * characters that need it to the wide array. Returns the number of entries;
+ * @array may be NULL to just count them.
+ */
+static int values_flatten(struct trie_node *root, struct trie_node *ccc_root,
+			  unsigned short *array)
+{
+	struct trie_node *n;
+	int count = 0;
+
+	for (n = level_first(root, root->layout->height); n;
+	     n = level_next(n)) {
+		unsigned int *curr;
+
+		if (unilength(n->value) > VALUE_MAX_LEN) {
+			fprintf(stderr, "Mapping for 0x%x is too long\n",
+				n->key);
+			exit(1);
+		}
+		for (curr = n->value; *curr; curr++) {
+			unsigned int *ccc = trie_find(ccc_root, *curr);
+
+			if (array)
+				array[count] = value_entry(*curr,
+							   ccc ? *ccc : 0);
+			count++;
+		}
+	}
+	return count;
+}
+
+/* Print the data array for a trie of mappings, and its escape array */
+static void values_print(struct trie_node *root, struct trie_node *ccc_root,
+			 struct value_escapes *esc, char *array_name,
+			 FILE *file)
+{
+	unsigned short *values;
+	int count, i;
+
+	count = values_flatten(root, ccc_root, NULL);
+	values = malloc(count * sizeof(*values));
+	if (!values)
 		exit(1);
-	ccc_root->depth = 0;
+	values_flatten(root, ccc_root, values);
+
+	fprintf(file, "\nstatic const u16 apfs_%s[] __aligned(64) = {\n",
+		array_name);
+	for (i = 0; i < count; ++i) {
+		if (i % 8 == 0)
+			fprintf(file, "\t");
+		fprintf(file, "0x%.4x,", values[i]);
+		if (i % 8 != 7)
+			fprintf(file, " ");
+		else
+			fprintf(file, "\n");
+	}
+	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
+	fprintf(file, "\n};\n");
+	free(values);
+
+	fprintf(file, "\nstatic const u32 apfs_%s_esc[] __aligned(64) = {\n",
+		array_name);
+	for (i = 0; i < esc->count; ++i) {
+		if (i % 6 == 0)
+			fprintf(file, "\t");
+		fprintf(file, "0x%.8x,", esc->entries[i]);
+		if ((i + 1) % 6 != 0)
+			fprintf(file, " ");
+		else
+			fprintf(file, "\n");
+	}
+	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
+	fprintf(file, "\n};\n");
+}
+
+/* Print the wide value array, once all the value arrays are flattened */
+static void values_wide_print(FILE *file)
+{
+	int i;
+
+	fprintf(file, "\nstatic const u32 apfs_value_wide[] __aligned(64) = {\n");
+	for (i = 0; i < value_wide_count; ++i) {
+		if (i % 6 == 0)
+			fprintf(file, "\t");
+		fprintf(file, "0x%.8x,", value_wide[i]);
+		if ((i + 1) % 6 != 0)
+			fprintf(file, " ");
+		else
+			fprintf(file, "\n");
+	}
+	fseek(file, -1, SEEK_CUR); /* Remove the final space or newline */
+	fprintf(file, "\n};\n");
+}
+
+/*
+ * The quick check bitmap has two bits for each character: the low one is set
+ * if the character is a starter that normalizes to itself, and the high one
+ * if it also case folds to itself. It's a three-level table, like the UCD
+ * *_QC properties would be: the plane of the character selects a table of
+ * blocks, and the block selects a leaf of 256 characters, which is exactly
+ * one cache line. Identical tables and leaves are only stored once.
+ */
+#define QC_PLANES	17
+#define QC_BLOCKS	256		/* Blocks of 256 characters in a plane */
+#define QC_LEAF_WORDS	16		/* 32-bit words in a leaf */
+
+unsigned int qc_leaves[QC_PLANES * QC_BLOCKS][QC_LEAF_WORDS];
+int qc_leaf_count;
+unsigned int qc_blocks[QC_PLANES][QC_BLOCKS];
+int qc_block_count;
+unsigned int qc_planes[QC_PLANES];
+
+/* Get the two quick check bits for @unichar */
+static unsigned int qc_bits(struct trie_node *uni_root, unsigned int unichar)
+{
+	unsigned int *rec;
+
+	if (unichar >= HANGUL_S_FIRST && unichar <= HANGUL_S_LAST)
+		return 0;
+	rec = trie_find(uni_root, unichar);
+	if (!rec)
+		return 3;
+	if (rec[REC_CCC] || rec[REC_NFD])
+		return 0;
+	return rec[REC_NFDCF] ? 1 : 3;
+}
+
+/* Build the quick check bitmap for the characters in the combined trie */
+static void qc_init(struct trie_node *uni_root)
+{
+	int plane, block, i;
+
+	qc_leaf_count = 0;
+	qc_block_count = 0;
+	for (plane = 0; plane < QC_PLANES; ++plane) {
+		unsigned int *blocks = qc_blocks[qc_block_count];
+
+		for (block = 0; block < QC_BLOCKS; ++block) {
+			unsigned int *leaf = qc_leaves[qc_leaf_count];
+			unsigned int first = (plane << 16) | (block << 8);
+
+			memset(leaf, 0, sizeof(qc_leaves[0]));
+			for (i = 0; i < 256; ++i)
+				leaf[i >> 4] |= qc_bits(uni_root, first + i) <<
+						((i & 0xf) << 1);
+			for (i = 0; i < qc_leaf_count; ++i) {
+				if (!memcmp(qc_leaves[i], leaf,
+					    sizeof(qc_leaves[0])))
+					break;
+			}
+			if (i == qc_leaf_count)
+				qc_leaf_count++;
+			blocks[block] = i;
+		}
+
+		for (i = 0; i < qc_block_count; ++i) {
+			if (!memcmp(qc_blocks[i], blocks, sizeof(qc_blocks[0])))
+				break;
+		}
+		if (i == qc_block_count)
+			qc_block_count++;
+		qc_planes[plane] = i;
+	}
+
+	/* The runtime code uses a byte for each leaf index */
+	assert(qc_leaf_count <= 256);
+}
+
+/* Size of the quick check bitmap in the runtime code */
+static unsigned int qc_bytes(void)
+{
+	return QC_PLANES + qc_block_count * QC_BLOCKS +
+	       qc_leaf_count * QC_LEAF_WORDS * 4;
+}
+
+static void qc_print(struct trie_node *uni_root, FILE *file)
+{
+	int i, j;
+
+	qc_init(uni_root);
+	printf("Quick check bitmap has %u bytes\n", qc_bytes());
+
+	fprintf(file, "\nstatic const u8 apfs_qc_planes[] __aligned(64) = {\n\t");
+	for (i = 0; i < QC_PLANES; ++i)
+		fprintf(file, "%d,%s", qc_planes[i],
+			i < QC_PLANES - 1 ? " " : "\n");
+	fprintf(file, "};\n");
+
+	fprintf(file, "\nstatic const u8 apfs_qc_blocks[][%d] __aligned(64) = {\n",
+		QC_BLOCKS);
+	for (i = 0; i < qc_block_count; ++i) {
+		fprintf(file, "\t{\n");
+		for (j = 0; j < QC_BLOCKS; ++j) {
+			if (j % 16 == 0)
+				fprintf(file, "\t\t");
+			fprintf(file, "%3d,", qc_blocks[i][j]);
+			fprintf(file, j % 16 != 15 ? " " : "\n");
+		}
+		fprintf(file, "\t},\n");
+	}
+	fprintf(file, "};\n");
+
+	fprintf(file, "\nstatic const u32 apfs_qc_leaves[][%d] __aligned(64) = {\n",
+		QC_LEAF_WORDS);
+	for (i = 0; i < qc_leaf_count; ++i) {
+		fprintf(file, "\t{\n");
+		for (j = 0; j < QC_LEAF_WORDS; ++j) {
+			if (j % 4 == 0)
+				fprintf(file, "\t\t");
+			fprintf(file, "0x%.8x,", qc_leaves[i][j]);
+			fprintf(file, j % 4 != 3 ? " " : "\n");
+		}
+		fprintf(file, "\t},\n");
+	}
+	fprintf(file, "};\n");
+}
+
+/*
+ * The binary tables hold the same arrays as the C code, for user space
+ * programs that would rather mmap them than have them built in. The file
+ * starts with a header of little-endian fields:
+ *
+ *	u32 magic, version, size of the file, checksum, trie height
+ *	u8 key bits for each trie level, then u8 shift for each level
+ *	s32 position of row zero of each level
+ *	u32 offset and u32 size of each table, in the order of enum blob_table
+ *
+ * Unused levels are zero. Each table starts on a cache line, and has the same
+ * contents as the C array; the records are 6 bytes each, the last one being
+ * padding. Both the trie and the perfect hash are always included, so that
+ * the file works with either build of the runtime code. The checksum is the
+ * CRC32C of the whole file, with the checksum field set to zero, a seed of ~0
+ * and no final inversion.
+ */
+#define BLOB_MAGIC		0x42544e55	/* "UNTB" */
+#define BLOB_VERSION		4
+#define BLOB_MAX_HEIGHT		8
+#define BLOB_ALIGN		64
+
+enum blob_table {
+	BLOB_TRIE,
+	BLOB_UNIDATA,
+	BLOB_UNIDATA_2BYTE,
+	BLOB_NFD,
+	BLOB_NFDCF,
+	BLOB_QC_PLANES,
+	BLOB_QC_BLOCKS,
+	BLOB_QC_LEAVES,
+	BLOB_NFD_ESC,
+	BLOB_NFDCF_ESC,
+	BLOB_HASH_DISP,
+	BLOB_HASH_SLOTS,
+	BLOB_VALUE_WIDE,
+	BLOB_TABLES
+};
+
+#define BLOB_HEADER_SIZE	(5 * 4 + 2 * BLOB_MAX_HEIGHT + \
+				 4 * BLOB_MAX_HEIGHT + 8 * BLOB_TABLES)
+
+static void put16(unsigned char *p, unsigned int val)
+{
+	p[0] = val;
+	p[1] = val >> 8;
+}
+
+static void put32(unsigned char *p, unsigned int val)
+{
+	put16(p, val);
+	put16(p + 2, val >> 16);
+}
+
+static unsigned int crc32c(unsigned int crc, const unsigned char *p,
+			   size_t len)
+{
+	int k;
+
+	while (len--) {
+		crc ^= *p++;
+		for (k = 0; k < 8; ++k)
+			crc = (crc >> 1) ^ (0x82f63b78 & -(crc & 1));
+	}
+	return crc;
+}
+
+/* Write the record @rec of the combined trie to @p */
+static void blob_put_record(unsigned char *p, unsigned int *rec)
+{
+	put16(p, rec[REC_NFD]);
+	put16(p + 2, rec[REC_NFDCF]);
+	p[4] = rec[REC_CCC];
+	p[5] = 0;
+}
+
+/* Write all the tables to the binary file at @path */
+static void blob_write(const char *path, struct trie_node *uni_root,
+		       struct trie_node *nfd_root,
+		       struct trie_node *nfdcf_root,
+		       struct trie_node *ccc_root)
+{
+	struct trie_layout *layout = uni_root->layout;
+	unsigned int empty[REC_FIELDS] = {0};
+	unsigned int offset[BLOB_TABLES], size[BLOB_TABLES];
+	unsigned short *trie, *nfd, *nfdcf;
+	unsigned int *qc_leaf;
+	unsigned char *blob, *p;
+	unsigned int entries, total, unichar;
+	int nfd_count, nfdcf_count;
+	FILE *file;
+	int i, j;
+
+	if (layout->height > BLOB_MAX_HEIGHT) {
+		fprintf(stderr, "Too many trie levels for the binary tables\n");
+		exit(1);
+	}
+
+	entries = trie_calculate_positions(uni_root);
+	hash_build(uni_root);
+	nfd_count = values_flatten(nfd_root, ccc_root, NULL);
+	nfdcf_count = values_flatten(nfdcf_root, ccc_root, NULL);
+	qc_init(uni_root);
+
+	size[BLOB_TRIE] = entries * 2;
+	size[BLOB_UNIDATA] = record_count * RECORD_BYTES;
+	size[BLOB_UNIDATA_2BYTE] = (UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST + 1) *
+				   RECORD_BYTES;
+	size[BLOB_NFD] = nfd_count * 2;
+	size[BLOB_NFDCF] = nfdcf_count * 2;
+	size[BLOB_QC_PLANES] = QC_PLANES;
+	size[BLOB_QC_BLOCKS] = qc_block_count * QC_BLOCKS;
+	size[BLOB_QC_LEAVES] = qc_leaf_count * QC_LEAF_WORDS * 4;
+	size[BLOB_NFD_ESC] = nfd_escapes.count * 4;
+	size[BLOB_NFDCF_ESC] = nfdcf_escapes.count * 4;
+	size[BLOB_HASH_DISP] = hash_buckets * 2;
+	size[BLOB_HASH_SLOTS] = hash_size * 4;
+	size[BLOB_VALUE_WIDE] = value_wide_count * 4;
+
+	total = BLOB_HEADER_SIZE;
+	for (i = 0; i < BLOB_TABLES; ++i) {
+		total = (total + BLOB_ALIGN - 1) & ~(BLOB_ALIGN - 1);
+		offset[i] = total;
+		total += size[i];
+	}
+
+	blob = calloc(1, total);
+	trie = calloc(entries, sizeof(*trie));
+	nfd = malloc(nfd_count * sizeof(*nfd));
+	nfdcf = malloc(nfdcf_count * sizeof(*nfdcf));
+	if (!blob || !trie || !nfd || !nfdcf)
+		exit(1);
+	trie_flatten(uni_root, trie);
+	values_flatten(nfd_root, ccc_root, nfd);
+	values_flatten(nfdcf_root, ccc_root, nfdcf);
+
+	put32(blob, BLOB_MAGIC);
+	put32(blob + 4, BLOB_VERSION);
+	put32(blob + 8, total);
+	put32(blob + 16, layout->height);
+	p = blob + 20;
+	for (i = 0; i < layout->height; ++i) {
+		p[i] = layout->bits[i];
+		p[BLOB_MAX_HEIGHT + i] = layout->shift[i];
+		put32(p + 2 * BLOB_MAX_HEIGHT + 4 * i, layout->base[i]);
+	}
+	p += 6 * BLOB_MAX_HEIGHT;
+	for (i = 0; i < BLOB_TABLES; ++i) {
+		put32(p + 8 * i, offset[i]);
+		put32(p + 8 * i + 4, size[i]);
+	}
+
+	for (i = 0; i < entries; ++i)
+		put16(blob + offset[BLOB_TRIE] + 2 * i, trie[i]);
+	for (i = 0; i < record_count; ++i)
+		blob_put_record(blob + offset[BLOB_UNIDATA] + i * RECORD_BYTES,
+				records[i]);
+	for (unichar = UTF8_2BYTE_FIRST; unichar <= UTF8_2BYTE_LAST;
+	     ++unichar) {
+		unsigned int *rec = trie_find(uni_root, unichar);
+
+		p = blob + offset[BLOB_UNIDATA_2BYTE] +
+		    (unichar - UTF8_2BYTE_FIRST) * RECORD_BYTES;
+		blob_put_record(p, rec ? rec : empty);
+	}
+	for (i = 0; i < nfd_count; ++i)
+		put16(blob + offset[BLOB_NFD] + 2 * i, nfd[i]);
+	for (i = 0; i < nfdcf_count; ++i)
+		put16(blob + offset[BLOB_NFDCF] + 2 * i, nfdcf[i]);
+	for (i = 0; i < QC_PLANES; ++i)
+		blob[offset[BLOB_QC_PLANES] + i] = qc_planes[i];
+	for (i = 0; i < qc_block_count; ++i) {
+		for (j = 0; j < QC_BLOCKS; ++j)
+			blob[offset[BLOB_QC_BLOCKS] + i * QC_BLOCKS + j] =
+				qc_blocks[i][j];
+	}
+	for (i = 0; i < qc_leaf_count; ++i) {
+		qc_leaf = qc_leaves[i];
+		for (j = 0; j < QC_LEAF_WORDS; ++j)
+			put32(blob + offset[BLOB_QC_LEAVES] +
+			      4 * (i * QC_LEAF_WORDS + j), qc_leaf[j]);
+	}
+
+	for (i = 0; i < nfd_escapes.count; ++i)
+		put32(blob + offset[BLOB_NFD_ESC] + 4 * i,
+		      nfd_escapes.entries[i]);
+	for (i = 0; i < nfdcf_escapes.count; ++i)
+		put32(blob + offset[BLOB_NFDCF_ESC] + 4 * i,
+		      nfdcf_escapes.entries[i]);
+	for (i = 0; i < hash_buckets; ++i)
+		put16(blob + offset[BLOB_HASH_DISP] + 2 * i, hash_disp[i]);
+	for (i = 0; i < hash_size; ++i)
+		put32(blob + offset[BLOB_HASH_SLOTS] + 4 * i, hash_slots[i]);
+	for (i = 0; i < value_wide_count; ++i)
+		put32(blob + offset[BLOB_VALUE_WIDE] + 4 * i, value_wide[i]);
+
+	put32(blob + 12, crc32c(~0, blob, total));
+
+	file = fopen(path, "wb");
+	if (!file) {
+		perror(path);
+		exit(1);
+	}
+	if (fwrite(blob, 1, total, file) != total || fclose(file)) {
+		perror(path);
+		exit(1);
+	}
+	printf("Binary tables have %u bytes\n", total);
+
+	free(nfdcf);
+	free(nfd);
+	free(trie);
+	free(blob);
+}
+
+/*
+ * Copy the leaves of @root into field @field of the records in the combined
+ * trie.  For mapping tries the field is the encoded position of the value;
+ * for the ccc trie it's the value itself.
+ */
+static void trie_merge(struct trie_node *uni_root, struct trie_node *root,
+		       int field)
+{
+	struct trie_node *n;
+
+	for (n = level_first(root, root->layout->height); n;
+	     n = level_next(n)) {
+		unsigned int *rec;
+
+		rec = trie_find(uni_root, n->key);
+		if (!rec) {
+			rec = calloc(REC_FIELDS, sizeof(*rec));
+			if (!rec)
+				exit(1);
+			trie_insert(uni_root, n->key, rec);
+		}
+		rec[field] = field == REC_CCC ? n->value[0] : n->pos;
+	}
+}
+
+/* Iterate the unicode decompositions as much as needed */
+static void nfdi_iterate(struct trie_node *nfdi_root)
+{
+	struct trie_node *n;
+	unsigned int *unichar;
+	unsigned int mapping[19]; /* Magic - guaranteed not to be exceeded. */
+	bool unchanged = true;
+
+	for (n = level_first(nfdi_root, nfdi_root->layout->height); n;
+	     n = level_next(n)) {
+		unsigned int *map_cursor = mapping;
+		unsigned int map_size;
+
+		for (unichar = n->value; *unichar; ++unichar) {
+			unsigned int *decomp;
+			int len;
+
+			/* The partial decomposition in the current iteration */
+			decomp = trie_find(nfdi_root, *unichar);
+			if (decomp) {
+				unchanged = false;
+				len = unilength(decomp);
+			} else {
+				decomp = unichar;
+				len = 1;
+			}
+			memcpy(map_cursor, decomp, len * sizeof(unsigned int));
+			map_cursor += len;
+		}
+		*map_cursor = 0;
+		++map_cursor;
+		map_size = (map_cursor - mapping) * sizeof(unsigned int);
+
+		free(n->value);
+		n->value = malloc(map_size);
+		if (!n->value)
+			exit(1);
+		memcpy(n->value, mapping, map_size);
+	}
+
+	if (!unchanged)
+		nfdi_iterate(nfdi_root);
+}
+
+/* Apply the case folding to each character of a decomposition */
+static void nfdcf_step(unsigned int *value, unsigned int *mapping,
+		       struct trie_node *nfd_root, struct trie_node *cf_root)
+{
+	unsigned int *map_cursor = mapping;
+	unsigned int *unichar;
+
+	for (unichar = value; *unichar; ++unichar) {
+		unsigned int *decomp, *fold;
+		unsigned int *curr;
+		int len;
+
+		decomp = trie_find(nfd_root, *unichar);
+		if (!decomp)
+			decomp = unichar;
+		len = decomp == unichar ? 1 : unilength(decomp);
+
+		for (curr = decomp; curr < decomp + len; ++curr) {
+			fold = trie_find(cf_root, *curr);
+			if (fold) {
+				memcpy(map_cursor, fold,
+				       unilength(fold) * sizeof(*fold));
+				map_cursor += unilength(fold);
+			} else {
+				*map_cursor++ = *curr;
+			}
+		}
+	}
+	*map_cursor = 0;
+}
+
+/*
+ * Build the trie with the case folding of the full decomposition for every
+ * character that has either, iterating until the result is stable.
+ */
+static void nfdcf_init(struct trie_node *nfdcf_root,
+		       struct trie_node *nfd_root, struct trie_node *cf_root)
+{
+	struct trie_node *roots[2] = {nfd_root, cf_root};
+	struct trie_node *n;
+	unsigned int mapping[19]; /* Magic - guaranteed not to be exceeded. */
+	unsigned int *um;
+	int i;
+
+	for (i = 0; i < 2; ++i) {
+		for (n = level_first(roots[i], roots[i]->layout->height); n;
+		     n = level_next(n)) {
+			if (trie_find(nfdcf_root, n->key))
+				continue;
+
+			mapping[0] = n->key;
+			mapping[1] = 0;
+			while (1) {
+				unsigned int next[19];
+				int len;
+
+				nfdcf_step(mapping, next, nfd_root, cf_root);
+				len = unilength(next) + 1;
+				assert(len <= 19);
+				if (!memcmp(next, mapping, len * sizeof(*next)))
+					break;
+				memcpy(mapping, next, len * sizeof(*next));
+			}
+
+			um = malloc((unilength(mapping) + 1) * sizeof(*um));
+			if (!um)
+				exit(1);
+			memcpy(um, mapping, (unilength(mapping) + 1) *
+					    sizeof(*um));
+			trie_insert(nfdcf_root, n->key, um);
+		}
+	}
+}
+
+/* Characters listed in UnicodeData.txt, to measure the cost of lookups */
+unsigned int *samples;
+int sample_count;
+
+static void sample_init(void)
+{
+	FILE *file;
+	unsigned int unichar;
+
+	file = fopen("ucd/UnicodeData.txt", "r");
+	if (!file)
+		exit(1);
+
+	while (fgets(line, LINESIZE, file)) {
+		if (sscanf(line, "%X;", &unichar) != 1)
+			continue;
+		samples = realloc(samples, (sample_count + 1) * sizeof(*samples));
+		if (!samples)
+			exit(1);
+		samples[sample_count++] = unichar;
+	}
+	fclose(file);
+	if (sample_count == 0)
+		exit(1);
+}
+
+/*
+ * Look up @key in a flattened trie, the same way the runtime code does.
+ * If @loads and @lines are not NULL, add to them the number of dependent
+ * loads and of distinct cache lines touched by the lookup.
+ */
+static unsigned int flat_lookup(unsigned short *trie,
+				struct trie_layout *layout, unsigned int key,
+				int *loads, int *lines)
+{
+	unsigned long line_seen[MAX_HEIGHT];
+	unsigned int node = 0;
+	int h, i;
+
+	for (h = 0; h < layout->height; ++h) {
+		unsigned int child = (key >> layout->shift[h]) &
+				     (level_width(layout, h) - 1);
+		int index = layout->base[h] + (node << layout->bits[h]) + child;
+
+		node = trie[index];
+		if (loads) {
+			(*loads)++;
+			line_seen[h] = index * sizeof(*trie) / 64;
+			for (i = 0; i < h; ++i) {
+				if (line_seen[i] == line_seen[h])
+					break;
+			}
+			if (i == h)
+				(*lines)++;
+		}
+		if (!node)
+			break;
+	}
+	return node;
+}
+
+/* Candidate level splits for the autotuning mode */
+static const char *candidate_layouts[] = {
+	"4,4,4,4,5", "5,4,4,4,4", "9,4,4,4", "8,4,4,5", "7,5,5,4",
+	"9,6,6", "8,7,6", "10,6,5", "11,5,5", "12,5,4", "11,10", "13,8",
+};
+
+/* Default level split, as last selected by the autotuning mode */
+#define DEFAULT_LAYOUT	"12,5,4"
+
+/*
+ * Build the combined trie with each of the candidate layouts, report the size
+ * of its array and the cost of a lookup, and select the layout with the
+ * fewest loads per lookup that fits in @budget bytes.
+ */
+static void autotune(struct trie_node *nfd_root, struct trie_node *nfdcf_root,
+		     struct trie_node *ccc_root, struct trie_layout *chosen,
+		     unsigned int budget)
+{
+	int ncands = sizeof(candidate_layouts) / sizeof(*candidate_layouts);
+	double best_loads = 0;
+	unsigned int best_bytes = 0;
+	int best = -1;
+	int i;
+
+	sample_init();
+	printf("%-12s %6s %8s %8s %8s %10s\n", "layout", "levels", "bytes",
+	       "loads", "lines", "ns/lookup");
+
+	for (i = 0; i < ncands; ++i) {
+		struct trie_layout layout;
+		struct trie_node *uni_root;
+		unsigned short *trie;
+		unsigned int entries, bytes, sink = 0;
+		struct timespec start, end;
+		int loads = 0, lines = 0;
+		double avg_loads, ns;
+		int rep, j;
+
+		if (!layout_init(&layout, candidate_layouts[i]))
+			exit(1);
+		uni_root = trie_alloc(&layout);
+		trie_merge(uni_root, nfd_root, REC_NFD);
+		trie_merge(uni_root, nfdcf_root, REC_NFDCF);
+		trie_merge(uni_root, ccc_root, REC_CCC);
+
+		entries = trie_calculate_positions(uni_root);
+		bytes = entries * sizeof(*trie);
+		trie = calloc(entries, sizeof(*trie));
+		if (!trie)
+			exit(1);
+		trie_flatten(uni_root, trie);
+
+		for (j = 0; j < sample_count; ++j)
+			flat_lookup(trie, &layout, samples[j], &loads, &lines);
+		avg_loads = (double)loads / sample_count;
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (rep = 0; rep < 100; ++rep) {
+			for (j = 0; j < sample_count; ++j)
+				sink += flat_lookup(trie, &layout, samples[j],
+						    NULL, NULL);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		ns = (end.tv_sec - start.tv_sec) * 1e9 +
+		     (end.tv_nsec - start.tv_nsec);
+		ns /= 100.0 * sample_count;
+
+		printf("%-12s %6d %8u %8.3f %8.3f %10.2f%s\n",
+		       candidate_layouts[i], layout.height, bytes, avg_loads,
+		       (double)lines / sample_count, ns, sink ? "" : " ");
+
+		/* Timings are noisy, so keep the selection reproducible */
+		if (bytes <= budget &&
+		    (best < 0 || avg_loads < best_loads ||
+		     (avg_loads == best_loads && bytes < best_bytes))) {
+			best = i;
+			best_loads = avg_loads;
+			best_bytes = bytes;
+		}
+		free(trie);
+	}
+
+	if (best < 0) {
+		fprintf(stderr, "No candidate layout fits in %u bytes\n",
+			budget);
+		exit(1);
+	}
+	printf("Selected layout %s\n", candidate_layouts[best]);
+	layout_init(chosen, candidate_layouts[best]);
+}
+
+/*
+ * Unicode blocks for the lookup cost report. The data files don't include
+ * Blocks.txt, so these are some of the blocks of Unicode 9.0 that are most
+ * likely to show up in filenames.
+ */
+static const struct {
+	unsigned int first, last;
+	const char *name;
+} report_blocks[] = {
+	{0x0000, 0x007f, "Basic_Latin"},
+	{0x0080, 0x00ff, "Latin-1_Supplement"},
+	{0x0100, 0x017f, "Latin_Extended-A"},
+	{0x0180, 0x024f, "Latin_Extended-B"},
+	{0x0250, 0x02af, "IPA_Extensions"},
+	{0x0300, 0x036f, "Combining_Diacritical_Marks"},
+	{0x0370, 0x03ff, "Greek_and_Coptic"},
+	{0x0400, 0x04ff, "Cyrillic"},
+	{0x0530, 0x058f, "Armenian"},
+	{0x0590, 0x05ff, "Hebrew"},
+	{0x0600, 0x06ff, "Arabic"},
+	{0x0900, 0x097f, "Devanagari"},
+	{0x0980, 0x09ff, "Bengali"},
+	{0x0e00, 0x0e7f, "Thai"},
+	{0x0f00, 0x0fff, "Tibetan"},
+	{0x10a0, 0x10ff, "Georgian"},
+	{0x1100, 0x11ff, "Hangul_Jamo"},
+	{0x1e00, 0x1eff, "Latin_Extended_Additional"},
+	{0x1f00, 0x1fff, "Greek_Extended"},
+	{0x2000, 0x206f, "General_Punctuation"},
+	{0x20a0, 0x20cf, "Currency_Symbols"},
+	{0x2100, 0x214f, "Letterlike_Symbols"},
+	{0x2190, 0x21ff, "Arrows"},
+	{0x2200, 0x22ff, "Mathematical_Operators"},
+	{0x2460, 0x24ff, "Enclosed_Alphanumerics"},
+	{0x2600, 0x26ff, "Miscellaneous_Symbols"},
+	{0x3000, 0x303f, "CJK_Symbols_and_Punctuation"},
+	{0x3040, 0x309f, "Hiragana"},
+	{0x30a0, 0x30ff, "Katakana"},
+	{0x3400, 0x4dbf, "CJK_Unified_Ideographs_Extension_A"},
+	{0x4e00, 0x9fff, "CJK_Unified_Ideographs"},
+	{0xac00, 0xd7af, "Hangul_Syllables"},
+	{0xf900, 0xfaff, "CJK_Compatibility_Ideographs"},
+	{0xfb00, 0xfb4f, "Alphabetic_Presentation_Forms"},
+	{0xff00, 0xffef, "Halfwidth_and_Fullwidth_Forms"},
+	{0x1d100, 0x1d1ff, "Musical_Symbols"},
+	{0x1f300, 0x1f5ff, "Miscellaneous_Symbols_and_Pictographs"},
+	{0x1f600, 0x1f64f, "Emoticons"},
+	{0x20000, 0x2a6df, "CJK_Unified_Ideographs_Extension_B"},
+	{0x2f800, 0x2fa1f, "CJK_Compatibility_Ideographs_Supplement"},
+	{0xe0000, 0xe007f, "Tags"},
+};
+
+/* Report the shape of a trie, level by level */
+static void report_trie(FILE *file, const char *name, struct trie_node *root)
+{
+	struct trie_layout *layout = root->layout;
+	unsigned int total_bytes = 0, leaves = 0;
+	struct trie_node *n;
+	int i, j;
+
+	for (i = 0; i < layout->height; ++i) {
+		unsigned int nodes = 0, rows = 0, used = 0, slots, bytes;
+
+		for (n = level_first(root, i); n; n = level_next(n)) {
+			nodes++;
+			if (!n->same)
+				rows++;
+			for (j = 0; j < level_width(layout, i); ++j)
+				used += n->children[j] != NULL;
+		}
+		slots = nodes * level_width(layout, i);
+		bytes = rows * level_width(layout, i) * sizeof(unsigned short);
+		total_bytes += bytes;
+		fprintf(file, "trie=%s level=%d bits=%d nodes=%u rows=%u used=%u slots=%u fill=%.4f bytes=%u\n",
+			name, i, layout->bits[i], nodes, rows, used, slots,
+			(double)used / slots, bytes);
+	}
+	for (n = level_first(root, layout->height); n; n = level_next(n))
+		leaves++;
+	fprintf(file, "trie=%s levels=%d leaves=%u bytes=%u\n", name,
+		layout->height, leaves, total_bytes);
+}
+
+/*
+ * Report how much room is left in the 16-bit encoding of the value positions,
+ * and how many values had to be escaped. Returns the size of the value array
+ * and its escape array.
+ */
+static unsigned int report_values(FILE *file, const char *name,
+				  struct trie_node *root,
+				  struct value_escapes *esc)
+{
+	unsigned int entries = 0, longest = 0;
+	struct trie_node *n;
+
+	for (n = level_first(root, root->layout->height); n;
+	     n = level_next(n)) {
+		unsigned int len = unilength(n->value);
+
+		entries += len;
+		if (len > longest)
+			longest = len;
+	}
+	fprintf(file, "values=%s entries=%u bytes=%u offset_limit=%u offset_headroom=%u longest=%u length_limit=%u escapes=%d escape_bytes=%d\n",
+		name, entries, entries * 2, VALUE_POS_LIMIT,
+		entries < VALUE_POS_LIMIT ? VALUE_POS_LIMIT - entries : 0,
+		longest, VALUE_LEN_LIMIT, esc->count - 1, esc->count * 4);
+	return entries * 2 + esc->count * 4;
+}
+
+/*
+ * Report the number of distinct cache lines touched by the record lookup of
+ * the runtime code, for the characters of each block. Two-byte characters
+ * read a single record from their flat table; the others walk the trie and
+ * then read their record, or with the perfect hash, read a displacement and a
+ * slot before the record.
+ */
+static void report_blocks_cost(FILE *file, struct trie_node *uni_root,
+			       unsigned int entries)
+{
+	struct trie_layout *layout = uni_root->layout;
+	unsigned short *trie;
+	int nblocks = sizeof(report_blocks) / sizeof(*report_blocks);
+	int b;
+
+	trie = calloc(entries, sizeof(*trie));
+	if (!trie)
+		exit(1);
+	trie_flatten(uni_root, trie);
+
+	for (b = 0; b < nblocks; ++b) {
+		unsigned int first = report_blocks[b].first;
+		unsigned int last = report_blocks[b].last;
+		unsigned long total_loads = 0, total_lines = 0;
+		int max_lines = 0;
+		unsigned int c;
+
+		for (c = first; c <= last; ++c) {
+			int loads = 0, lines = 0;
+
+			if (c >= UTF8_2BYTE_FIRST && c <= UTF8_2BYTE_LAST) {
+				loads = lines = 1;
+			} else if (use_hash) {
+				loads = lines = 3;
+			} else {
+				flat_lookup(trie, layout, c, &loads, &lines);
+				loads++; /* The record itself */
+				lines++;
+			}
+			total_loads += loads;
+			total_lines += lines;
+			if (lines > max_lines)
+				max_lines = lines;
+		}
+		fprintf(file, "block=%.4x-%.4x name=%s chars=%u loads=%.3f lines=%.3f max_lines=%d\n",
+			first, last, report_blocks[b].name, last - first + 1,
+			(double)total_loads / (last - first + 1),
+			(double)total_lines / (last - first + 1), max_lines);
+	}
+	free(trie);
+}
+
+/*
+ * Report the cost of the trie lookups in the profile: the average number of
+ * cache lines touched per lookup, and the total number of distinct lines of
+ * the trie and record arrays that the whole profile needs, which is what the
+ * ordering by heat tries to keep low.
+ */
+static void report_profile(FILE *file, struct trie_node *uni_root,
+			   unsigned int entries)
+{
+	struct trie_layout *layout = uni_root->layout;
+	unsigned int trie_lines = (entries * sizeof(unsigned short) + 63) / 64;
+	unsigned int rec_lines = (record_count * RECORD_BYTES + 63) / 64;
+	unsigned long lookups = 0, total_lines = 0;
+	unsigned int working_set = 0;
+	unsigned short *trie;
+	bool *seen;
+	unsigned int unichar, i;
+
+	trie = calloc(entries, sizeof(*trie));
+	seen = calloc(trie_lines + rec_lines, sizeof(*seen));
+	if (!trie || !seen)
+		exit(1);
+	trie_flatten(uni_root, trie);
+
+	for (unichar = 0; unichar < UNICODE_LIMIT; ++unichar) {
+		unsigned int node = 0;
+		int loads = 0, lines = 0;
+		int h;
+
+		if (!profile[unichar])
+			continue;
+		for (h = 0; h < layout->height; ++h) {
+			unsigned int child = (unichar >> layout->shift[h]) &
+					     (level_width(layout, h) - 1);
+			unsigned int index = layout->base[h] +
+					     (node << layout->bits[h]) + child;
+
+			seen[index * sizeof(*trie) / 64] = true;
+			node = trie[index];
+			if (!node)
+				break;
+		}
+		seen[trie_lines + node * RECORD_BYTES / 64] = true;
+
+		flat_lookup(trie, layout, unichar, &loads, &lines);
+		lookups += profile[unichar];
+		total_lines += profile[unichar] * (lines + 1);
+	}
+	for (i = 0; i < trie_lines + rec_lines; ++i)
+		working_set += seen[i];
+
+	fprintf(file, "profile lookups=%lu lines=%.3f working_set_lines=%u\n",
+		lookups, lookups ? (double)total_lines / lookups : 0,
+		working_set);
+	free(trie);
+	free(seen);
+}
+
+/*
+ * Write a report on the generated tables to @path. Every line is a list of
+ * key=value pairs, so that reports for different unicode versions or trie
+ * layouts can be compared with diff, or parsed by scripts.
+ */
+static void report(const char *path, struct trie_node *nfd_root,
+		   struct trie_node *cf_root, struct trie_node *nfdcf_root,
+		   struct trie_node *ccc_root, struct trie_node *uni_root)
+{
+	struct trie_layout *layout = uni_root->layout;
+	unsigned int entries, lookup_bytes, value_bytes, total;
+	FILE *file;
+	int i;
+
+	file = fopen(path, "w");
+	if (!file) {
+		perror(path);
+		exit(1);
+	}
+
+	fprintf(file, "layout=");
+	for (i = 0; i < layout->height; ++i)
+		fprintf(file, "%d%s", layout->bits[i],
+			i < layout->height - 1 ? "," : "\n");
+
+	/* The tables built by the parser, before they get combined */
+	report_trie(file, "nfd", nfd_root);
+	report_trie(file, "cf", cf_root);
+	report_trie(file, "nfdcf", nfdcf_root);
+	report_trie(file, "ccc", ccc_root);
+
+	/* The tables that end up in the runtime code */
+	entries = trie_calculate_positions(uni_root);
+	report_trie(file, "combined", uni_root);
+	fprintf(file, "trie=combined saved_bytes=%u\n", trie_saved_bytes);
+	hash_build(uni_root);
+	fprintf(file, "hash=records keys=%u buckets=%u slots=%u load=%.4f max_disp=%u bytes=%u\n",
+		hash_keys, hash_buckets, hash_size,
+		(double)hash_keys / hash_size, hash_max_disp, hash_bytes());
+	fprintf(file, "records=combined count=%d limit=%d bytes=%d\n",
+		record_count, 0x10000, record_count * RECORD_BYTES);
+	fprintf(file, "records=2byte count=%d bytes=%d\n",
+		UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST + 1,
+		(UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST + 1) * RECORD_BYTES);
+	value_bytes = report_values(file, "nfd", nfd_root, &nfd_escapes);
+	value_bytes += report_values(file, "nfdcf", nfdcf_root,
+				     &nfdcf_escapes);
+	value_bytes += value_wide_count * 4;
+	fprintf(file, "values=wide count=%d limit=%d bytes=%d\n",
+		value_wide_count, VALUE_WIDE_LIMIT, value_wide_count * 4);
+	fprintf(file, "qc=bitmap blocks=%d leaves=%d bytes=%u\n", qc_block_count,
+		qc_leaf_count, qc_bytes());
+
+	report_blocks_cost(file, uni_root, entries);
+	if (profile)
+		report_profile(file, uni_root, entries);
+
+	lookup_bytes = use_hash ? hash_bytes() :
+				  entries * sizeof(unsigned short);
+	fprintf(file, "lookup=%s bytes=%u\n", use_hash ? "hash" : "trie",
+		lookup_bytes);
+	total = lookup_bytes +
+		(record_count + UTF8_2BYTE_LAST - UTF8_2BYTE_FIRST + 1) *
+		RECORD_BYTES + value_bytes + qc_bytes();
+	fprintf(file, "total_bytes=%u\n", total);
+	fclose(file);
+}
+
+static void usage(char *prog)
+{
+	fprintf(stderr, "usage: %s [-v] [-l split | -a [-b budget]] [-p profile] [-r report]\n"
+		"       [-o tables] [-e pos] [-H] [-c code] [-t header]\n", prog);
+	fprintf(stderr, "  -l split   key bits for each trie level, e.g. 8,4,4,5\n");
+	fprintf(stderr, "  -a         try several level splits and pick one\n");
+	fprintf(stderr, "  -b budget  maximum trie size in bytes for -a\n");
+	fprintf(stderr, "  -p profile order the tables by the chars in a UTF-8 corpus\n");
+	fprintf(stderr, "  -r report  write statistics on the tables to a file\n");
+	fprintf(stderr, "  -o tables  also write the tables to a binary file\n");
+	fprintf(stderr, "  -e pos     escape the values from this position on, for tests\n");
+	fprintf(stderr, "  -H         find the records with a perfect hash, not the trie\n");
+	fprintf(stderr, "  -c code    write the tables as C code here, not to unicode.c.tmp\n");
+	fprintf(stderr, "  -t header  write the trie header here, not to unitrie.h.tmp\n");
+	exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+	struct trie_node *nfd_root, *cf_root, *nfdcf_root, *ccc_root;
+	struct trie_node *uni_root;
+	struct trie_layout uni_layout;
+	unsigned int budget = 32 * 1024;
+	char *report_path = NULL;
+	char *blob_path = NULL;
+	char *code_path = "unicode.c.tmp";
+	char *header_path = "unitrie.h.tmp";
+	bool tune = false;
+	FILE *out, *header;
+	int opt;
+
+	if (!layout_init(&uni_layout, DEFAULT_LAYOUT))
+		exit(1);
+	while ((opt = getopt(argc, argv, "vl:ab:p:r:o:e:Hc:t:")) != -1) {
+		switch (opt) {
+		case 'v':
+			verbose++;
+			break;
+		case 'l':
+			if (!layout_init(&uni_layout, optarg)) {
+				fprintf(stderr, "Invalid level split %s\n",
+					optarg);
+				usage(argv[0]);
+			}
+			break;
+		case 'a':
+			tune = true;
+			break;
+		case 'b':
+			budget = strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			profile_init(optarg);
+			break;
+		case 'r':
+			report_path = optarg;
+			break;
+		case 'o':
+			blob_path = optarg;
+			break;
+		case 'e':
+			escape_pos = strtoul(optarg, NULL, 0);
+			if (escape_pos > VALUE_POS_LIMIT)
+				escape_pos = VALUE_POS_LIMIT;
+			break;
+		case 'H':
+			use_hash = true;
+			break;
+		case 'c':
+			code_path = optarg;
+			break;
+		case 't':
+			header_path = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+
+	/* The parser tries are never printed, so their layout doesn't matter */
+	if (!layout_init(&parse_layout, DEFAULT_LAYOUT))
+		exit(1);
+
+	out = fopen(code_path, "w");
+	if (!out) {
+		perror(code_path);
+		exit(1);
+	}
+	header = fopen(header_path, "w");
+	if (!header) {
+		perror(header_path);
+		exit(1);
+	}
+
+	nfd_root = trie_alloc(&parse_layout);
+	nfdi_init(nfd_root);
+	nfdi_iterate(nfd_root);
+	values_calculate_positions(nfd_root, &nfd_escapes);
+
+	cf_root = trie_alloc(&parse_layout);
+	cf_init(cf_root);
+
+	/* Case folding always comes after the decomposition, so do both */
+	nfdcf_root = trie_alloc(&parse_layout);
+	nfdcf_init(nfdcf_root, nfd_root, cf_root);
+	values_calculate_positions(nfdcf_root, &nfdcf_escapes);
+
+	ccc_root = trie_alloc(&parse_layout);
 	ccc_init(ccc_root);
-	trie_print(ccc_root, "ccc", out, true /* is_ccc */);
+
+	if (tune)
+		autotune(nfd_root, nfdcf_root, ccc_root, &uni_layout, budget);
+
+	/* A single trie gives all the data for a character in one lookup */
+	uni_root = trie_alloc(&uni_layout);
+	trie_merge(uni_root, nfd_root, REC_NFD);
+	trie_merge(uni_root, nfdcf_root, REC_NFDCF);
+	trie_merge(uni_root, ccc_root, REC_CCC);
+	trie_print(uni_root, out, header);
+	records_2byte_print(uni_root, out);
+
+	values_print(nfd_root, ccc_root, &nfd_escapes, "nfd", out);
+	values_print(nfdcf_root, ccc_root, &nfdcf_escapes, "nfdcf", out);
+	values_wide_print(out);
+	qc_print(uni_root, out);
+
+	if (blob_path)
+		blob_write(blob_path, uni_root, nfd_root, nfdcf_root, ccc_root);
+	if (report_path)
+		report(report_path, nfd_root, cf_root, nfdcf_root, ccc_root,
+		       uni_root);
 
 	return 0;
 }
-